@@ -28,6 +28,10 @@
 #include <sys/types.h>
 #include <sys/mman.h>
 #endif
+#ifdef __linux__
+#include <sys/ioctl.h>
+#include <linux/fs.h>
+#endif
 #include "config.h"
 #include "monitor.h"
 #include "sysemu.h"
@@ -41,6 +45,7 @@
 #include "net.h"
 #include "gdbstub.h"
 #include "hw/smbios.h"
+#include "qemu-thread.h"
 
 #include "replay_fix.h"
 
@@ -95,6 +100,64 @@ const uint32_t arch_type = QEMU_ARCH;
 #define RAM_SAVE_FLAG_PAGE     0x08
 #define RAM_SAVE_FLAG_EOS      0x10
 #define RAM_SAVE_FLAG_CONTINUE 0x20
+#define RAM_SAVE_FLAG_EXTERNAL 0x40
+
+/* Record/replay snapshots keep RAM out of the stream, in a raw image where
+   each block starts on a host page boundary and zero pages are holes.  The
+   stream carries a RAM_SAVE_FLAG_EXTERNAL record giving each block's offset
+   in the image, and loading maps the image copy-on-write over guest RAM, so
+   pages are read only when touched and replays of the same recording share
+   the clean ones through the page cache.  Pages that change after the image
+   is written still go into the stream as usual.  See ram_set_external. */
+static int ram_external_fd = -1;
+static uint64_t ram_external_base;
+static int ram_external_mapped;
+
+void ram_set_external(int fd, uint64_t base)
+{
+    ram_external_fd = fd;
+    ram_external_base = base;
+    ram_external_mapped = 0;
+}
+
+static int ram_pwrite_full(const uint8_t *buf, size_t len, uint64_t offset)
+{
+    while (len > 0) {
+        ssize_t n = pwrite(ram_external_fd, buf, len, offset);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return -1;
+        }
+        buf += n;
+        len -= n;
+        offset += n;
+    }
+    return 0;
+}
+
+static int ram_pread_full(uint8_t *buf, size_t len, uint64_t offset)
+{
+    while (len > 0) {
+        ssize_t n = pread(ram_external_fd, buf, len, offset);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n < 0) {
+            return -1;
+        }
+        if (n == 0) {
+            /* past the end of the image is all zeroes */
+            memset(buf, 0, len);
+            break;
+        }
+        buf += n;
+        len -= n;
+        offset += n;
+    }
+    return 0;
+}
 
 static int is_dup_page(uint8_t *page, uint8_t ch)
 {
@@ -178,6 +241,256 @@ static int ram_save_block(QEMUFile *f)
     return bytes_sent;
 }
 
+/* The image is written by up to RAM_EXTERNAL_MAX_THREADS threads, each
+   taking every n-th slice of guest RAM.  With a base image (the last one
+   loaded, or one given to ram_set_external_base), the base is first cloned
+   into the new image where the filesystem supports it, and only pages that
+   differ from it are written, so unchanged pages are stored once. */
+#define RAM_EXTERNAL_MAX_THREADS 8
+#define RAM_EXTERNAL_SLICE (16 << 20)
+
+typedef struct {
+    uint8_t *host;
+    ram_addr_t length;
+    uint64_t offset;            /* in the image */
+} RAMImageSlice;
+
+typedef struct {
+    QemuThread thread;
+    RAMImageSlice *slices;
+    int num_slices, first, stride;
+    const uint8_t *base;        /* mapped base image, or NULL */
+    uint64_t base_len;          /* how much of it was cloned */
+    int error;
+} RAMImageWorker;
+
+static int ram_base_fd = -1;
+static uint64_t ram_base_offset, ram_base_len;
+
+void ram_set_external_base(int fd, uint64_t base, uint64_t len)
+{
+    if (ram_base_fd >= 0) {
+        close(ram_base_fd);
+    }
+    ram_base_fd = fd;
+    ram_base_offset = base;
+    ram_base_len = len;
+}
+
+static int ram_page_needs_write(RAMImageWorker *w, uint8_t *page,
+                                uint64_t offset)
+{
+    if (w->base && offset + TARGET_PAGE_SIZE <= w->base_len) {
+        return memcmp(page, w->base + offset, TARGET_PAGE_SIZE) != 0;
+    }
+    return !is_dup_page(page, 0);
+}
+
+static void *ram_save_external_worker(void *opaque)
+{
+    RAMImageWorker *w = opaque;
+    int i;
+
+    for (i = w->first; i < w->num_slices && !w->error; i += w->stride) {
+        RAMImageSlice *sl = &w->slices[i];
+        ram_addr_t addr, run = 0;
+
+        /* write runs of pages that need it, leaving holes (or the base's
+           pages) for the rest */
+        for (addr = 0; addr <= sl->length; addr += TARGET_PAGE_SIZE) {
+            if (addr < sl->length &&
+                ram_page_needs_write(w, sl->host + addr, sl->offset + addr)) {
+                continue;
+            }
+            if (addr > run && ram_pwrite_full(sl->host + run, addr - run,
+                        ram_external_base + sl->offset + run) < 0) {
+                w->error = 1;
+                break;
+            }
+            run = addr + TARGET_PAGE_SIZE;
+        }
+    }
+    return NULL;
+}
+
+/* Clones up to len bytes of the base image to the start of the new one.
+   Returns how much was cloned. */
+static uint64_t ram_clone_base(uint64_t len)
+{
+#ifdef FICLONERANGE
+    struct file_clone_range range;
+
+    if (ram_base_fd < 0) {
+        return 0;
+    }
+    if (len > ram_base_len) {
+        len = ram_base_len;
+    }
+    len &= ~((uint64_t)getpagesize() - 1);
+    range.src_fd = ram_base_fd;
+    range.src_offset = ram_base_offset;
+    range.src_length = len;
+    range.dest_offset = ram_external_base;
+    if (len > 0 && ioctl(ram_external_fd, FICLONERANGE, &range) == 0) {
+        return len;
+    }
+#endif
+    return 0;
+}
+
+/* Writes every block to the RAM image and marks it clean, so only pages
+   dirtied from here on are sent in the stream. */
+static int ram_save_external(QEMUFile *f)
+{
+    RAMBlock *block;
+    uint64_t offset = 0, num_blocks = 0, base_len;
+    long page_size = getpagesize();
+    RAMImageSlice *slices = NULL;
+    RAMImageWorker workers[RAM_EXTERNAL_MAX_THREADS];
+    int num_slices = 0, num_threads, i, error = 0;
+    uint8_t *base = NULL;
+
+    QLIST_FOREACH(block, &ram_list.blocks, next) {
+        num_blocks++;
+    }
+    qemu_put_be64(f, RAM_SAVE_FLAG_EXTERNAL);
+    qemu_put_be64(f, num_blocks);
+
+    QLIST_FOREACH(block, &ram_list.blocks, next) {
+        ram_addr_t addr;
+
+        qemu_put_byte(f, strlen(block->idstr));
+        qemu_put_buffer(f, (uint8_t *)block->idstr, strlen(block->idstr));
+        qemu_put_be64(f, offset);
+
+        for (addr = 0; addr < block->length; addr += RAM_EXTERNAL_SLICE) {
+            slices = g_realloc(slices, (num_slices + 1) * sizeof(*slices));
+            slices[num_slices].host = block->host + addr;
+            slices[num_slices].length = MIN(block->length - addr,
+                                            RAM_EXTERNAL_SLICE);
+            slices[num_slices].offset = offset + addr;
+            num_slices++;
+        }
+        offset += (block->length + page_size - 1) & ~(page_size - 1);
+    }
+    if (ftruncate(ram_external_fd, ram_external_base + offset) != 0) {
+        g_free(slices);
+        return -1;
+    }
+
+    base_len = ram_clone_base(offset);
+    if (base_len > 0) {
+        base = mmap(NULL, base_len, PROT_READ, MAP_SHARED, ram_base_fd,
+                    ram_base_offset);
+        if (base == MAP_FAILED) {
+            /* the clone can't be checked, so overwrite all of it */
+            base = NULL;
+            if (ftruncate(ram_external_fd, ram_external_base) != 0 ||
+                ftruncate(ram_external_fd, ram_external_base + offset) != 0) {
+                g_free(slices);
+                return -1;
+            }
+        }
+    }
+
+    num_threads = MIN(MAX(sysconf(_SC_NPROCESSORS_ONLN), 1),
+                      RAM_EXTERNAL_MAX_THREADS);
+    num_threads = MIN(num_threads, MAX(num_slices, 1));
+    for (i = 0; i < num_threads; i++) {
+        workers[i].slices = slices;
+        workers[i].num_slices = num_slices;
+        workers[i].first = i;
+        workers[i].stride = num_threads;
+        workers[i].base = base;
+        workers[i].base_len = base ? base_len : 0;
+        workers[i].error = 0;
+    }
+    /* this thread does the first share */
+    for (i = 1; i < num_threads; i++) {
+        qemu_thread_create(&workers[i].thread, ram_save_external_worker,
+                           &workers[i]);
+    }
+    ram_save_external_worker(&workers[0]);
+    for (i = 0; i < num_threads; i++) {
+        if (i > 0) {
+            pthread_join(workers[i].thread.thread, NULL);
+        }
+        error |= workers[i].error;
+    }
+    if (base) {
+        munmap(base, base_len);
+    }
+    g_free(slices);
+    if (error) {
+        return -1;
+    }
+
+    QLIST_FOREACH(block, &ram_list.blocks, next) {
+        cpu_physical_memory_reset_dirty(block->offset,
+                                        block->offset + block->length,
+                                        MIGRATION_DIRTY_FLAG);
+    }
+    return 0;
+}
+
+/* Maps (or reads) each block from the RAM image.  The image then becomes
+   the base for the next one saved, since a replay's later snapshots are
+   mostly the same memory. */
+static int ram_load_external(QEMUFile *f)
+{
+    uint64_t num_blocks = qemu_get_be64(f);
+    uint64_t image_end = 0;
+    long page_size = getpagesize();
+    char id[256];
+
+    if (ram_external_fd < 0) {
+        fprintf(stderr, "Snapshot keeps RAM in a separate image, "
+                "which was not found\n");
+        return -EINVAL;
+    }
+
+    while (num_blocks--) {
+        RAMBlock *block;
+        uint64_t offset;
+        uint8_t len;
+
+        len = qemu_get_byte(f);
+        qemu_get_buffer(f, (uint8_t *)id, len);
+        id[len] = 0;
+        offset = ram_external_base + qemu_get_be64(f);
+
+        QLIST_FOREACH(block, &ram_list.blocks, next) {
+            if (!strncmp(id, block->idstr, sizeof(id))) {
+                break;
+            }
+        }
+        if (!block) {
+            fprintf(stderr, "Can't find block %s!\n", id);
+            return -EINVAL;
+        }
+
+        if (!(block->flags & (RAM_PREALLOC_MASK | RAM_SHARED_MASK)) &&
+            !mem_path && !kvm_enabled() &&
+            (uintptr_t)block->host % page_size == 0 &&
+            block->length % page_size == 0 && offset % page_size == 0) {
+            if (mmap(block->host, block->length, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_FIXED, ram_external_fd, offset) == MAP_FAILED) {
+                fprintf(stderr, "Can't map RAM image for block %s: %s\n",
+                        id, strerror(errno));
+                return -EIO;
+            }
+            ram_external_mapped = 1;
+        } else if (ram_pread_full(block->host, block->length, offset) < 0) {
+            fprintf(stderr, "Can't read RAM image for block %s: %s\n",
+                    id, strerror(errno));
+            return -EIO;
+        }
+        image_end = MAX(image_end, offset - ram_external_base + block->length);
+    }
+    ram_set_external_base(dup(ram_external_fd), ram_external_base, image_end);
+    return 0;
+}
+
 static uint64_t bytes_transferred;
 
 static ram_addr_t ram_save_remaining(void)
@@ -298,6 +611,11 @@ int ram_save_live(Monitor *mon, QEMUFile *f, int stage, void *opaque)
             qemu_put_buffer(f, (uint8_t *)block->idstr, strlen(block->idstr));
             qemu_put_be64(f, block->length);
         }
+
+        if (ram_external_fd >= 0 && ram_save_external(f) < 0) {
+            qemu_file_set_error(f, -EIO);
+            return -EIO;
+        }
     }
 
     bytes_transferred_last = bytes_transferred;
@@ -434,6 +752,13 @@ int ram_load(QEMUFile *f, void *opaque, int version_id)
             }
         }
 
+        if (flags & RAM_SAVE_FLAG_EXTERNAL) {
+            error = ram_load_external(f);
+            if (error) {
+                return error;
+            }
+        }
+
         if (flags & RAM_SAVE_FLAG_COMPRESS) {
             void *host;
             uint8_t ch;
@@ -449,7 +774,9 @@ int ram_load(QEMUFile *f, void *opaque, int version_id)
             ch = qemu_get_byte(f);
             memset(host, ch, TARGET_PAGE_SIZE);
 #ifndef _WIN32
-            if (ch == 0 &&
+            /* dropping a page of a mapped RAM image would bring back the
+               image's contents, not zeroes */
+            if (ch == 0 && !ram_external_mapped &&
                 (!kvm_enabled() || kvm_has_sync_mmu())) {
                 qemu_madvise(host, TARGET_PAGE_SIZE, QEMU_MADV_DONTNEED);
             }
@@ -504,6 +504,8 @@ extern ram_addr_t ram_size;
 
 /* RAM is pre-allocated and passed into qemu_ram_alloc_from_ptr */
 #define RAM_PREALLOC_MASK   (1 << 0)
+/* RAM is mapped shared from the -mem-shared file */
+#define RAM_SHARED_MASK     (1 << 1)
 
 typedef struct RAMBlock {
     uint8_t *host;
@@ -524,6 +526,7 @@ typedef struct RAMList {
 extern RAMList ram_list;
 
 extern const char *mem_path;
+extern const char *mem_shared_path;
 extern int mem_prealloc;
 
 /* physical memory access */
@@ -546,6 +549,7 @@ extern int mem_prealloc;
 
 #define VGA_DIRTY_FLAG       0x01
 #define CODE_DIRTY_FLAG      0x02
+#define PANDA_DIRTY_FLAG     0x04 /* see panda_memsavep_dirty */
 #define MIGRATION_DIRTY_FLAG 0x08
 
 /* read dirty bit (return 0 or 1) */
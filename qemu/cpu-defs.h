@@ -222,7 +222,10 @@ typedef struct CPUWatchpoint {
     /* record and replay */                                             \
     uint64_t rr_guest_instr_count;                                      \
     uint64_t rr_guest_pc;                                               \
-    uint64_t panda_guest_pc;
+    uint64_t panda_guest_pc;                                            \
+    /* host return address of the load being instrumented (see     */  \
+    /* panda_restart_insn)                                          */  \
+    void *panda_mem_retaddr;
 
 // record/replay
 #ifndef GUEST_ICOUNT
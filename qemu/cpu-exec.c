@@ -51,6 +51,7 @@ bool bb_invalidate_done = false;
 #ifdef CONFIG_SOFTMMU
 // TRL 0810 record replay stuff 
 #include "rr_log.h"
+#include "sysemu.h"
 #endif
 
 #include <signal.h>
@@ -177,13 +178,13 @@ static TranslationBlock *tb_find_slow(CPUState *env,
  not_found:
    /* if no translated code available, then translate it now */
 
-    for(plist = panda_cbs[PANDA_CB_BEFORE_BLOCK_TRANSLATE]; plist != NULL; plist = panda_cb_list_next(plist)) {
+    for(plist = panda_cb_list_first(PANDA_CB_BEFORE_BLOCK_TRANSLATE); plist != NULL; plist = panda_cb_list_next(plist)) {
         plist->entry.before_block_translate(env, pc);
     }
 
     tb = tb_gen_code(env, pc, cs_base, flags, 0);
 
-    for(plist = panda_cbs[PANDA_CB_AFTER_BLOCK_TRANSLATE]; plist != NULL; plist = panda_cb_list_next(plist)) {
+    for(plist = panda_cb_list_first(PANDA_CB_AFTER_BLOCK_TRANSLATE); plist != NULL; plist = panda_cb_list_next(plist)) {
         plist->entry.after_block_translate(env, tb);
     }
 
@@ -376,6 +377,14 @@ int cpu_exec(CPUState *env)
                     rr_skipped_callsite_location = RR_CALLSITE_MAIN_LOOP_WAIT;
                     rr_replay_skipped_calls();
                 }
+                //mz SMP: leave at the end of this vCPU's slice, so that
+                //tcg_exec_all can move on to the next one.  In replay the
+                //switch points come from the log.
+                if ((rr_in_replay() && rr_replay_cpu_switch()) ||
+                        (rr_in_record() && rr_cpu_slice_expired())) {
+                    env->exception_index = EXCP_INTERRUPT;
+                    cpu_loop_exit(env);
+                }
 #endif
                 // cache interrupt request value.
                 interrupt_request = env->interrupt_request;
@@ -735,7 +744,7 @@ int cpu_exec(CPUState *env)
                 panda_cb_list *plist;
                 bool panda_invalidate_tb = false;
                 if (unlikely(!bb_invalidate_done)) {
-                    for(plist = panda_cbs[PANDA_CB_BEFORE_BLOCK_EXEC_INVALIDATE_OPT];
+                    for(plist = panda_cb_list_first(PANDA_CB_BEFORE_BLOCK_EXEC_INVALIDATE_OPT);
                             plist != NULL; plist = panda_cb_list_next(plist)) {
                         panda_invalidate_tb |=
                             plist->entry.before_block_exec_invalidate_opt(env, tb);
@@ -812,6 +821,14 @@ int cpu_exec(CPUState *env)
                     break;
                 }
 
+                // Pause requested over the memory-access socket
+                if (rr_mode == RR_REPLAY && rr_pause_at_instr_count &&
+                        rr_get_guest_instr_count() >= rr_pause_at_instr_count) {
+                    rr_pause_at_instr_count = 0;
+                    vm_stop(RUN_STATE_PAUSED);
+                    break;
+                }
+
                 // Check for replay failure (otherwise infinite loop would result)
                 if (rr_mode == RR_REPLAY) {
                     RR_prog_point pp = rr_prog_point();
@@ -847,13 +864,13 @@ int cpu_exec(CPUState *env)
                         bb_invalidate_done = false;
 
                         // PANDA instrumentation: before basic block exec
-                        for(plist = panda_cbs[PANDA_CB_BEFORE_BLOCK_EXEC];
+                        for(plist = panda_cb_list_first(PANDA_CB_BEFORE_BLOCK_EXEC);
                                 plist != NULL; plist = panda_cb_list_next(plist)) {
                             plist->entry.before_block_exec(env, tb);
                         }
 
 #if defined(CONFIG_LLVM)
-                        if(execute_llvm) {
+                        if(execute_llvm && !tb->llvm_bypass) {
                             assert(tb->llvm_tc_ptr);
                             next_tb = tcg_llvm_qemu_tb_exec(env, tb);
                         } else {
@@ -864,7 +881,7 @@ int cpu_exec(CPUState *env)
                         next_tb = tcg_qemu_tb_exec(env, tc_ptr);
 #endif
 
-                        for(plist = panda_cbs[PANDA_CB_AFTER_BLOCK_EXEC]; plist != NULL; plist = panda_cb_list_next(plist)) {
+                        for(plist = panda_cb_list_first(PANDA_CB_AFTER_BLOCK_EXEC); plist != NULL; plist = panda_cb_list_next(plist)) {
                             plist->entry.after_block_exec(env, tb, (TranslationBlock *)(next_tb & ~3));
                         }
 
@@ -907,6 +924,12 @@ int cpu_exec(CPUState *env)
             /* Reload env after longjmp - the compiler may have smashed all
              * local variables as longjmp is marked 'noreturn'. */
             env = cpu_single_env;
+            /* whatever block we left isn't running any more */
+            env->current_tb = NULL;
+            /* any callback loops we jumped out of are over */
+            if (unlikely(panda_profiling)) {
+                panda_profile_unwind();
+            }
         }
     } /* for(;;) */
 
@@ -1075,6 +1075,41 @@ static int tcg_cpu_exec(CPUState *env)
     return ret;
 }
 
+//mz SMP record/replay: run one slice of the vCPU the log currently follows.
+//In record, the next runnable vCPU in round-robin order is then chosen and
+//the switch logged; in replay, cpu_exec has already followed any switch in
+//the log.
+static void rr_tcg_exec_smp(void)
+{
+    CPUState *env = rr_get_cpu();
+    CPUState *next;
+
+    qemu_clock_enable(vm_clock,
+                      (env->singlestep_enabled & SSTEP_NOTIMER) == 0);
+
+    if (cpu_can_run(env)) {
+        if (rr_in_record()) {
+            rr_begin_cpu_slice();
+        }
+        if (tcg_cpu_exec(env) == EXCP_DEBUG) {
+            cpu_handle_guest_debug(env);
+            return;
+        }
+    } else if (env->stop || env->stopped) {
+        return;
+    }
+
+    if (rr_in_record()) {
+        next = env;
+        do {
+            next = next->next_cpu ? next->next_cpu : first_cpu;
+        } while (next != env && (!cpu_can_run(next) || cpu_thread_is_idle(next)));
+        if (next != env) {
+            rr_record_cpu_switch(next);
+        }
+    }
+}
+
 static void tcg_exec_all(void)
 {
     int r;
@@ -1082,6 +1117,17 @@ static void tcg_exec_all(void)
     /* Account partial waits to the vm_clock.  */
     qemu_clock_warp(vm_clock);
 
+    if (rr_on() && rr_smp()) {
+        if (!exit_request) {
+            rr_tcg_exec_smp();
+        }
+        if (rr_in_replay()) {
+            rr_use_live_exit_request = 0;
+        }
+        exit_request = 0;
+        return;
+    }
+
     if (next_cpu == NULL) {
         next_cpu = first_cpu;
     }
@@ -198,6 +198,9 @@ struct TranslationBlock {
     uint8_t *llvm_tc_ptr;
     uint8_t *llvm_tc_end;
     struct TranslationBlock* llvm_tb_next[2];
+    /* set by a plugin (before_block_exec) to run the TCG code for this
+       block even though execute_llvm is on */
+    uint8_t llvm_bypass;
 #endif
 
 };
@@ -322,6 +325,7 @@ TranslationBlock *tb_find_pc(unsigned long pc_ptr);
 extern spinlock_t tb_lock;
 
 extern int tb_invalidated_flag;
+extern uint64_t tb_gen_count;
 
 /* The return address may point to the start of the next instruction.
    Subtracting one gets us the call instruction itself.  */
@@ -80,6 +80,7 @@
 //#include "tcg-llvm.h"
 void tcg_llvm_tb_alloc(TranslationBlock *tb);
 void tcg_llvm_tb_free(struct TranslationBlock *tb);
+struct TranslationBlock *tcg_llvm_find_tb(uintptr_t tc_ptr);
 #endif
 
 //#define DEBUG_TB_INVALIDATE
@@ -250,6 +251,8 @@ static int tlb_flush_count;
 #endif
 static int tb_flush_count;
 static int tb_phys_invalidate_count;
+/* every translation, across flushes */
+uint64_t tb_gen_count;
 
 #ifdef _WIN32
 static void map_exec(void *addr, long size)
@@ -1033,9 +1036,6 @@ TranslationBlock *tb_gen_code(CPUState *env,
     tb_page_addr_t phys_pc, phys_page2;
     target_ulong virt_page2;
     int code_gen_size;
-#ifdef CONFIG_LLVM
-    int i;
-#endif
 
     phys_pc = get_page_addr_code(env, pc);
     tb = tb_alloc(pc);
@@ -1053,22 +1053,9 @@ TranslationBlock *tb_gen_code(CPUState *env,
     tb->flags = flags;
     tb->cflags = cflags;
     cpu_gen_code(env, tb, &code_gen_size);
+    tb_gen_count++;
 #ifdef CONFIG_LLVM
-    // Sanity check. We had a bug before where we were misrecording
-    // translated code sizes, and so TC blocks appeared to overlap.
-    if (generate_llvm) {
-        for (i = 0; i < nb_tbs; i++) {
-            TranslationBlock *other = &tbs[i];
-            if (tb == other) continue;
-            if (other->llvm_tc_ptr <= tb->llvm_tc_ptr &&
-                    tb->llvm_tc_ptr < other->llvm_tc_end) {
-                assert(false && "Allocating apparently overlapping blocks!");
-            } else if (other->llvm_tc_ptr < tb->llvm_tc_end &&
-                    tb->llvm_tc_end <= other->llvm_tc_end) {
-                assert(false && "Allocating apparently overlapping blocks!");
-            }
-        }
-    }
+    tb->llvm_bypass = 0;
 #endif
     code_gen_ptr = (void *)(((unsigned long)code_gen_ptr + code_gen_size + CODE_GEN_ALIGN - 1) & ~(CODE_GEN_ALIGN - 1));
 
@@ -1402,16 +1389,11 @@ TranslationBlock *tb_find_pc(unsigned long tc_ptr)
         return NULL;
 
 #if defined(CONFIG_LLVM)
-    if(execute_llvm) {
-        for(m=0; m<nb_tbs; m++) {
-            tb = &tbs[m];
-            if(tb->llvm_function) {
-                if(tc_ptr >= (uintptr_t) tb->llvm_tc_ptr &&
-                   tc_ptr <  (uintptr_t) tb->llvm_tc_end)
-                    return tb;
-            }
-        }
-        return NULL;
+    /* blocks can still run their TCG code (llvm_bypass), so only look
+       at the LLVM ranges if this isn't in the TCG buffer */
+    if(execute_llvm && (tc_ptr < (unsigned long)code_gen_buffer ||
+                tc_ptr >= (unsigned long)code_gen_ptr)) {
+        return tcg_llvm_find_tb(tc_ptr);
     }
 #endif
 
@@ -2093,6 +2075,152 @@ CPUState *cpu_copy(CPUState *env)
 
 #if !defined(CONFIG_USER_ONLY)
 
+/* Translation cache for panda_virtual_memory_rw and panda_virt_to_phys, so
+   introspection doesn't walk the guest page tables on every read.  Entries
+   are keyed by (ASID, virtual page) and set-associative on the page.  Each
+   ASID has a generation number; flushing an ASID just gives it a new one,
+   which orphans its entries.  Generations are never reused (until they
+   wrap, which clears everything).
+
+   Entries follow the guest's own TLB maintenance: a global flush clears
+   the cache, a non-global flush on x86 (a CR3 write, which happens after
+   the new CR3 is in place) clears the current ASID, and a page flush
+   clears that page in every ASID, since kernel mappings are shared.  A
+   guest may change the page tables of an address space that isn't
+   running without flushing anything, but must flush when it switches to
+   it, so stale entries can only be seen for ASIDs other than the current
+   one between the change and the switch.  Other targets don't use
+   flush_global to mean "keep global pages" (ARM's TLBIALL invalidates
+   everything, for both TTBRs and any old one), so there any full TLB
+   flush clears the cache.  Failed translations are not cached.  Plugins that need more can call panda_v2p_flush. */
+#define V2P_CACHE_SETS 4096
+#define V2P_CACHE_WAYS 4
+#define V2P_ASID_SLOTS 256
+
+typedef struct V2PCacheEntry {
+    target_ulong asid;
+    target_ulong vpage;
+    target_phys_addr_t ppage;
+    uint32_t gen;
+} V2PCacheEntry;
+
+typedef struct V2PAsid {
+    target_ulong asid;
+    uint32_t gen;
+} V2PAsid;
+
+static V2PCacheEntry v2p_cache[V2P_CACHE_SETS][V2P_CACHE_WAYS];
+static uint8_t v2p_victim[V2P_CACHE_SETS];
+static V2PAsid v2p_asids[V2P_ASID_SLOTS];
+static uint32_t v2p_next_gen = 1;
+
+void panda_v2p_flush(void)
+{
+    memset(v2p_cache, 0, sizeof(v2p_cache));
+    memset(v2p_asids, 0, sizeof(v2p_asids));
+    v2p_next_gen = 1;
+}
+
+static uint32_t v2p_new_gen(void)
+{
+    if (v2p_next_gen == UINT32_MAX) {
+        panda_v2p_flush();
+    }
+    return v2p_next_gen++;
+}
+
+static inline V2PAsid *v2p_asid_slot(target_ulong asid)
+{
+    return &v2p_asids[((uint32_t)(asid >> 12) * 0x9e3779b1u) >> 24];
+}
+
+void panda_v2p_flush_asid(target_ulong asid)
+{
+    V2PAsid *slot = v2p_asid_slot(asid);
+    if (slot->gen && slot->asid == asid) {
+        slot->gen = v2p_new_gen();
+    }
+}
+
+static void v2p_flush_page(target_ulong vpage)
+{
+    V2PCacheEntry *set = v2p_cache[(vpage >> TARGET_PAGE_BITS) & (V2P_CACHE_SETS - 1)];
+    int i;
+
+    for (i = 0; i < V2P_CACHE_WAYS; i++) {
+        if (set[i].vpage == vpage) {
+            set[i].gen = 0;
+        }
+    }
+}
+
+/* The page table that translates page, if the cache supports this target */
+static inline int v2p_asid(CPUState *env, target_ulong page, target_ulong *asid)
+{
+#if defined(TARGET_I386)
+    *asid = env->cr[3];
+    return 1;
+#elif defined(TARGET_ARM)
+    *asid = (page & env->cp15.c2_mask) ? env->cp15.c2_base1 : env->cp15.c2_base0;
+    return 1;
+#else
+    return 0;
+#endif
+}
+
+static void v2p_flush_current(CPUState *env)
+{
+#if defined(TARGET_I386)
+    target_ulong asid;
+
+    if (v2p_asid(env, 0, &asid)) {
+        panda_v2p_flush_asid(asid);
+    }
+#else
+    panda_v2p_flush();
+#endif
+}
+
+/* cpu_get_phys_page_debug, through the cache */
+static target_phys_addr_t panda_get_phys_page(CPUState *env, target_ulong page)
+{
+    target_ulong asid;
+    target_phys_addr_t phys_addr;
+    V2PAsid *slot;
+    V2PCacheEntry *set, *e;
+    unsigned int set_idx;
+    int i;
+
+    if (!v2p_asid(env, page, &asid)) {
+        return cpu_get_phys_page_debug(env, page);
+    }
+    slot = v2p_asid_slot(asid);
+    if (!slot->gen || slot->asid != asid) {
+        slot->asid = asid;
+        slot->gen = v2p_new_gen();
+    }
+    set_idx = (page >> TARGET_PAGE_BITS) & (V2P_CACHE_SETS - 1);
+    set = v2p_cache[set_idx];
+    for (i = 0; i < V2P_CACHE_WAYS; i++) {
+        if (set[i].gen == slot->gen && set[i].vpage == page &&
+            set[i].asid == asid) {
+            return set[i].ppage;
+        }
+    }
+
+    phys_addr = cpu_get_phys_page_debug(env, page);
+    if (phys_addr == -1) {
+        return -1;
+    }
+    e = &set[v2p_victim[set_idx]];
+    v2p_victim[set_idx] = (v2p_victim[set_idx] + 1) % V2P_CACHE_WAYS;
+    e->asid = asid;
+    e->vpage = page;
+    e->ppage = phys_addr;
+    e->gen = slot->gen;
+    return phys_addr;
+}
+
 static inline void tlb_flush_jmp_cache(CPUState *env, target_ulong addr)
 {
     unsigned int i;
@@ -2140,6 +2268,12 @@ void tlb_flush(CPUState *env, int flush_global)
     env->tlb_flush_addr = -1;
     env->tlb_flush_mask = 0;
     tlb_flush_count++;
+
+    if (flush_global) {
+        panda_v2p_flush();
+    } else {
+        v2p_flush_current(env);
+    }
 }
 
 static inline void tlb_flush_entry(CPUTLBEntry *tlb_entry, target_ulong addr)
@@ -2177,6 +2311,7 @@ void tlb_flush_page(CPUState *env, target_ulong addr)
     env->current_tb = NULL;
 
     addr &= TARGET_PAGE_MASK;
+    v2p_flush_page(addr);
     i = (addr >> TARGET_PAGE_BITS) & (CPU_TLB_SIZE - 1);
     for (mmu_idx = 0; mmu_idx < NB_MMU_MODES; mmu_idx++)
         tlb_flush_entry(&env->tlb_table[mmu_idx][i], addr);
@@ -3019,6 +3154,42 @@ static void *file_ram_alloc(RAMBlock *block,
 }
 #endif
 
+#ifndef _WIN32
+static int mem_shared_fd = -1;
+
+/* Blocks go in the -mem-shared file at their ram_addr offsets. */
+static void *shared_ram_alloc(RAMBlock *block, ram_addr_t memory)
+{
+    struct stat st;
+    void *area;
+
+    if (mem_shared_fd < 0) {
+        mem_shared_fd = open(mem_shared_path, O_RDWR | O_CREAT | O_TRUNC, 0600);
+        if (mem_shared_fd < 0) {
+            perror(mem_shared_path);
+            return NULL;
+        }
+    }
+    if (block->offset % getpagesize() != 0 ||
+        fstat(mem_shared_fd, &st) != 0) {
+        return NULL;
+    }
+    if (st.st_size < block->offset + memory &&
+        ftruncate(mem_shared_fd, block->offset + memory) != 0) {
+        perror("shared_ram_alloc: can't grow RAM file");
+        return NULL;
+    }
+    area = mmap(0, memory, PROT_READ | PROT_WRITE, MAP_SHARED,
+                mem_shared_fd, block->offset);
+    if (area == MAP_FAILED) {
+        perror("shared_ram_alloc: can't mmap RAM pages");
+        return NULL;
+    }
+    block->flags |= RAM_SHARED_MASK;
+    return area;
+}
+#endif
+
 static ram_addr_t find_ram_offset(ram_addr_t size)
 {
     RAMBlock *block, *next_block;
@@ -3092,6 +3263,17 @@ ram_addr_t qemu_ram_alloc_from_ptr(DeviceState *dev, const char *name,
     if (host) {
         new_block->host = host;
         new_block->flags |= RAM_PREALLOC_MASK;
+    } else if (mem_shared_path && !mem_path && !xen_enabled()) {
+#ifndef _WIN32
+        new_block->host = shared_ram_alloc(new_block, size);
+        if (!new_block->host) {
+            fprintf(stderr, "Could not allocate RAM in %s\n", mem_shared_path);
+            exit(1);
+        }
+#else
+        fprintf(stderr, "-mem-shared option unsupported\n");
+        exit(1);
+#endif
     } else {
         if (mem_path) {
 #if defined (__linux__) && !defined(TARGET_S390X)
@@ -3170,6 +3352,8 @@ void qemu_ram_free(ram_addr_t addr)
             QLIST_REMOVE(block, next);
             if (block->flags & RAM_PREALLOC_MASK) {
                 ;
+            } else if (block->flags & RAM_SHARED_MASK) {
+                munmap(block->host, block->length);
             } else if (mem_path) {
 #if defined (__linux__) && !defined(TARGET_S390X)
                 if (block->fd) {
@@ -3216,7 +3400,11 @@ void qemu_ram_remap(ram_addr_t addr, ram_addr_t length)
             } else {
                 flags = MAP_FIXED;
                 munmap(vaddr, length);
-                if (mem_path) {
+                if (block->flags & RAM_SHARED_MASK) {
+                    area = mmap(vaddr, length, PROT_READ | PROT_WRITE,
+                                flags | MAP_SHARED, mem_shared_fd,
+                                block->offset + offset);
+                } else if (mem_path) {
 #if defined(__linux__) && !defined(TARGET_S390X)
                     if (block->fd) {
 #ifdef MAP_POPULATE
@@ -4206,7 +4394,7 @@ static int cpu_physical_memory_rw_ex(target_phys_addr_t addr, uint8_t *buf,
                 if (rr_mode == RR_REPLAY) {
                     // run all callbacks registered for cpu_physical_memory_rw ram case
                     panda_cb_list *plist;
-                    for (plist = panda_cbs[PANDA_CB_REPLAY_BEFORE_CPU_PHYSICAL_MEM_RW_RAM]; plist != NULL; plist = panda_cb_list_next(plist)) {
+                    for (plist = panda_cb_list_first(PANDA_CB_REPLAY_BEFORE_CPU_PHYSICAL_MEM_RW_RAM); plist != NULL; plist = panda_cb_list_next(plist)) {
                         plist->entry.replay_before_cpu_physical_mem_rw_ram(cpu_single_env, is_write, buf, addr1, l);
                     }
                 }
@@ -4214,7 +4402,7 @@ static int cpu_physical_memory_rw_ex(target_phys_addr_t addr, uint8_t *buf,
                 if (rr_mode == RR_REPLAY) {
                     // run all callbacks registered for cpu_physical_memory_rw ram case
                     panda_cb_list *plist;
-                    for (plist = panda_cbs[PANDA_CB_REPLAY_AFTER_CPU_PHYSICAL_MEM_RW_RAM]; plist != NULL; plist = panda_cb_list_next(plist)) {
+                    for (plist = panda_cb_list_first(PANDA_CB_REPLAY_AFTER_CPU_PHYSICAL_MEM_RW_RAM); plist != NULL; plist = panda_cb_list_next(plist)) {
                         plist->entry.replay_after_cpu_physical_mem_rw_ram(cpu_single_env, is_write, buf, addr1, l);
                     }
                 }
@@ -4282,7 +4470,7 @@ static int cpu_physical_memory_rw_ex(target_phys_addr_t addr, uint8_t *buf,
                 if (rr_mode == RR_REPLAY) {
                     // run all callbacks registered for cpu_physical_memory_rw ram case
                     panda_cb_list *plist;
-                    for (plist = panda_cbs[PANDA_CB_REPLAY_BEFORE_CPU_PHYSICAL_MEM_RW_RAM]; plist != NULL; plist = panda_cb_list_next(plist)) {
+                    for (plist = panda_cb_list_first(PANDA_CB_REPLAY_BEFORE_CPU_PHYSICAL_MEM_RW_RAM); plist != NULL; plist = panda_cb_list_next(plist)) {
                         plist->entry.replay_before_cpu_physical_mem_rw_ram(cpu_single_env, is_write, buf, addr1, l);
                     }
                 }
@@ -4290,7 +4478,7 @@ static int cpu_physical_memory_rw_ex(target_phys_addr_t addr, uint8_t *buf,
                 if (rr_mode == RR_REPLAY) {
                     // run all callbacks registered for cpu_physical_memory_rw ram case
                     panda_cb_list *plist;
-                    for (plist = panda_cbs[PANDA_CB_REPLAY_AFTER_CPU_PHYSICAL_MEM_RW_RAM]; plist != NULL; plist = panda_cb_list_next(plist)) {
+                    for (plist = panda_cb_list_first(PANDA_CB_REPLAY_AFTER_CPU_PHYSICAL_MEM_RW_RAM); plist != NULL; plist = panda_cb_list_next(plist)) {
                         plist->entry.replay_after_cpu_physical_mem_rw_ram(cpu_single_env, is_write, buf, addr1, l);
                     }
                 }
@@ -5080,7 +5268,7 @@ target_phys_addr_t panda_virt_to_phys(CPUState *env, target_ulong addr){
     target_ulong page;
     target_phys_addr_t phys_addr;
     page = addr & TARGET_PAGE_MASK;
-    phys_addr = cpu_get_phys_page_debug(env, page);
+    phys_addr = panda_get_phys_page(env, page);
     /* if no physical page mapped, return an error */
     if (phys_addr == -1)
         return -1;
@@ -5088,6 +5276,25 @@ target_phys_addr_t panda_virt_to_phys(CPUState *env, target_ulong addr){
     return phys_addr;
 }
 
+/* Only valid from a before-read memory callback during a block that runs
+   its TCG code.  Like a fault on the load, except that nothing is raised:
+   the guest state goes back to the start of the instruction and execution
+   picks up there with a new block.  The instruction has already been
+   counted, and will be again when it reruns. */
+void panda_restart_insn(CPUState *env)
+{
+    unsigned long retaddr = (unsigned long)env->panda_mem_retaddr;
+    TranslationBlock *tb = tb_find_pc(retaddr);
+
+    assert(tb != NULL);
+    cpu_restore_state(tb, env, retaddr);
+    if (rr_mode != RR_OFF) {
+        env->rr_guest_instr_count--;
+    }
+    env->exception_index = -1;
+    cpu_loop_exit(env);
+}
+
 int panda_virtual_memory_rw(CPUState *env, target_ulong addr,
                         uint8_t *buf, int len, int is_write)
 {
@@ -5098,7 +5305,7 @@ int panda_virtual_memory_rw(CPUState *env, target_ulong addr,
 
     while (len > 0) {
         page = addr & TARGET_PAGE_MASK;
-        phys_addr = cpu_get_phys_page_debug(env, page);
+        phys_addr = panda_get_phys_page(env, page);
         /* if no physical page mapped, return an error */
         if (phys_addr == -1)
             return -1;
@@ -5238,6 +5445,7 @@ void dump_exec_info(FILE *f, fprintf_function cpu_fprintf)
                 nb_tbs ? (direct_jmp2_count * 100) / nb_tbs : 0);
     cpu_fprintf(f, "\nStatistics:\n");
     cpu_fprintf(f, "TB flush count      %d\n", tb_flush_count);
+    cpu_fprintf(f, "TB gen count        %" PRIu64 "\n", tb_gen_count);
     cpu_fprintf(f, "TB invalidate count %d\n", tb_phys_invalidate_count);
     cpu_fprintf(f, "TLB flush count     %d\n", tlb_flush_count);
     tcg_dump_info(f, cpu_fprintf);
@@ -1458,4 +1458,12 @@ ETEXI
         .help       = "send a command to a PANDA plugin",
         .mhandler.cmd = hmp_panda_plugin_cmd,
     },
+
+    {
+        .name       = "panda_profile",
+        .args_type  = "reset:-r",
+        .params     = "[-r]",
+        .help       = "show time spent in PANDA plugin callbacks (needs -panda-profile); -r resets the counters",
+        .mhandler.cmd = hmp_panda_profile,
+    },
         
@@ -4621,7 +4621,7 @@ abi_long do_syscall(void *cpu_env, int num, abi_long arg1,
     void *p;
 
     panda_cb_list *plist;
-    for(plist = panda_cbs[PANDA_CB_USER_BEFORE_SYSCALL]; plist != NULL;
+    for(plist = panda_cb_list_first(PANDA_CB_USER_BEFORE_SYSCALL); plist != NULL;
             plist = panda_cb_list_next(plist)) {
         plist->entry.user_before_syscall(cpu_env, fcntl_flags_tbl,
                                          num, arg1, arg2, arg3, arg4,
@@ -8173,7 +8173,7 @@ fail:
     if(do_strace)
         print_syscall_ret(num, ret);
 
-    for(plist = panda_cbs[PANDA_CB_USER_AFTER_SYSCALL]; plist != NULL;
+    for(plist = panda_cb_list_first(PANDA_CB_USER_AFTER_SYSCALL); plist != NULL;
             plist = panda_cb_list_next(plist)) {
         plist->entry.user_after_syscall(cpu_env, fcntl_flags_tbl,num, arg1,
                                         arg2, arg3, arg4, arg5, arg6, arg7,
@@ -10,6 +10,10 @@
 #include "qemu-common.h"
 #include "cpu-common.h"
 #include "config.h"
+#include "cpu.h"
+#include "sysemu.h"
+#include "main-loop.h"
+#include "rr_log.h"
 
 #include <stdlib.h>
 #include <stdio.h>
@@ -22,25 +26,70 @@
 #include <signal.h>
 #include <stdint.h>
 
-struct request{
-    uint8_t type;      // 0 quit, 1 read, 2 write, ... rest reserved
-    uint64_t address;  // address to read from OR write to
-    uint64_t length;   // number of bytes to read OR write
-};
+static int
+write_full (int fd, const void *buf, size_t len)
+{
+    while (len > 0){
+        ssize_t nbytes = write(fd, buf, len);
+        if (nbytes < 0 && errno == EINTR){
+            continue;
+        }
+        if (nbytes <= 0){
+            return -1;
+        }
+        buf = (const uint8_t *) buf + nbytes;
+        len -= nbytes;
+    }
+    return 0;
+}
 
-static uint64_t
-connection_read_memory (uint64_t user_paddr, void *buf, uint64_t user_len)
+static int
+read_full (int fd, void *buf, size_t len)
 {
-    target_phys_addr_t paddr = (target_phys_addr_t) user_paddr;
-    target_phys_addr_t len = (target_phys_addr_t) user_len;
-    void *guestmem = cpu_physical_memory_map(paddr, &len, 0);
-    if (!guestmem){
-        return 0;
+    while (len > 0){
+        ssize_t nbytes = read(fd, buf, len);
+        if (nbytes < 0 && errno == EINTR){
+            continue;
+        }
+        if (nbytes <= 0){
+            return -1;
+        }
+        buf = (uint8_t *) buf + nbytes;
+        len -= nbytes;
     }
-    memcpy(buf, guestmem, len);
-    cpu_physical_memory_unmap(guestmem, len, 0, len);
+    return 0;
+}
 
-    return len;
+// Sends guest memory straight from where it is mapped, with zeroes for
+// anything that can't be mapped. Returns how many bytes were guest memory,
+// or -1 if the connection failed.
+static int64_t
+connection_send_memory (int connection_fd, uint64_t user_paddr, uint64_t user_len)
+{
+    static const uint8_t zeroes[TARGET_PAGE_SIZE];
+    uint64_t sent = 0, found = 0;
+
+    while (sent < user_len){
+        target_phys_addr_t paddr = (target_phys_addr_t) (user_paddr + sent);
+        target_phys_addr_t len = (target_phys_addr_t) (user_len - sent);
+        void *guestmem = cpu_physical_memory_map(paddr, &len, 0);
+        int ret;
+        if (guestmem){
+            ret = write_full(connection_fd, guestmem, len);
+            cpu_physical_memory_unmap(guestmem, len, 0, len);
+            found += len;
+        }
+        else{
+            len = MIN(len, TARGET_PAGE_SIZE - (paddr & ~TARGET_PAGE_MASK));
+            ret = write_full(connection_fd, zeroes, len);
+        }
+        if (ret < 0){
+            return -1;
+        }
+        sent += len;
+    }
+
+    return found;
 }
 
 static uint64_t
@@ -78,40 +127,227 @@ send_fail_ack (int connection_fd)
     }
 }
 
+static void
+send_ack (int connection_fd, int ok)
+{
+    if (ok){
+        send_success_ack(connection_fd);
+    }
+    else{
+        send_fail_ack(connection_fd);
+    }
+}
+
+// Collects the RAM parts of the physical address space; registering it
+// replays the current mappings into set_memory.
+typedef struct {
+    CPUPhysMemoryClient client;
+    struct ram_range *ranges;
+    uint32_t count;
+} LayoutClient;
+
+static void
+layout_set_memory (CPUPhysMemoryClient *client, target_phys_addr_t start_addr,
+                   ram_addr_t size, ram_addr_t phys_offset, bool log_dirty)
+{
+    LayoutClient *layout = container_of(client, LayoutClient, client);
+    ram_addr_t flags = phys_offset & ~TARGET_PAGE_MASK;
+    ram_addr_t ram_addr = phys_offset & TARGET_PAGE_MASK;
+    RAMBlock *block;
+
+    if (flags != IO_MEM_RAM && flags != IO_MEM_ROM){
+        return;
+    }
+    // split at RAM block boundaries; only some blocks may be shared
+    while (size > 0){
+        struct ram_range *range;
+        ram_addr_t len = size;
+
+        QLIST_FOREACH(block, &ram_list.blocks, next){
+            if (ram_addr - block->offset < block->length){
+                break;
+            }
+        }
+        if (!block){
+            return;
+        }
+        len = MIN(len, block->offset + block->length - ram_addr);
+
+        layout->ranges = g_realloc(layout->ranges,
+                (layout->count + 1) * sizeof(struct ram_range));
+        range = &layout->ranges[layout->count++];
+        range->address = start_addr;
+        range->length = len;
+        range->offset = (block->flags & RAM_SHARED_MASK) ? ram_addr : -1;
+
+        start_addr += len;
+        ram_addr += len;
+        size -= len;
+    }
+}
+
+static int
+layout_sync_dirty_bitmap (CPUPhysMemoryClient *client,
+                          target_phys_addr_t start_addr,
+                          target_phys_addr_t end_addr)
+{
+    return 0;
+}
+
+static int
+layout_migration_log (CPUPhysMemoryClient *client, int enable)
+{
+    return 0;
+}
+
+static void
+connection_send_layout (int connection_fd)
+{
+    LayoutClient layout = {
+        .client = {
+            .set_memory = layout_set_memory,
+            .sync_dirty_bitmap = layout_sync_dirty_bitmap,
+            .migration_log = layout_migration_log,
+        },
+    };
+
+    qemu_mutex_lock_iothread();
+    cpu_register_phys_memory_client(&layout.client);
+    cpu_unregister_phys_memory_client(&layout.client);
+    qemu_mutex_unlock_iothread();
+
+    if (write_full(connection_fd, &layout.count, sizeof(layout.count)) == 0 &&
+        write_full(connection_fd, layout.ranges,
+                   layout.count * sizeof(struct ram_range)) == 0){
+        send_success_ack(connection_fd);
+    }
+    g_free(layout.ranges);
+}
+
+static void
+wait_for_pause (void)
+{
+    while (runstate_is_running()){
+        usleep(1000);
+    }
+}
+
+static void
+pause_vm (void)
+{
+    if (runstate_is_running()){
+        qemu_system_vmstop_request(RUN_STATE_PAUSED);
+    }
+    wait_for_pause();
+}
+
+static void
+send_pause_reply (int connection_fd, int ok)
+{
+    uint64_t count = rr_get_guest_instr_count();
+    send_ack(connection_fd, ok);
+    if (write_full(connection_fd, &count, sizeof(count)) < 0){
+        printf("QemuMemoryAccess: failed to send instruction count\n");
+    }
+}
+
+static void
+connection_run_until (int connection_fd, uint64_t instr_count)
+{
+    if (rr_mode != RR_REPLAY){
+        send_pause_reply(connection_fd, 0);
+        return;
+    }
+    if (instr_count > rr_get_guest_instr_count()){
+        rr_pause_at_instr_count = instr_count;
+        qemu_mutex_lock_iothread();
+        if (!runstate_is_running()){
+            vm_start();
+        }
+        qemu_mutex_unlock_iothread();
+        // cpu_exec pauses it when the count is reached
+        wait_for_pause();
+    }
+    else{
+        pause_vm();
+    }
+    rr_pause_at_instr_count = 0;
+    send_pause_reply(connection_fd, 1);
+}
+
 static void
 connection_handler (int connection_fd)
 {
     int nbytes;
     struct request req;
+    struct segment *segs = NULL;
+    uint8_t *status = NULL;
+    uint64_t max_segs = 0;
 
     while (1){
         // client request should match the struct request format
         nbytes = read(connection_fd, &req, sizeof(struct request));
-        if (nbytes != sizeof(struct request)){
+        if (nbytes <= 0){
+            // client went away
+            break;
+        }
+        else if (nbytes != sizeof(struct request)){
             // error
             continue;
         }
-        else if (req.type == 0){
+        else if (req.type == REQ_QUIT){
             // request to quit, goodbye
             break;
         }
-        else if (req.type == 1){
-            // request to read
-            char *buf = malloc(req.length + 1);
-            nbytes = connection_read_memory(req.address, buf, req.length);
-            if (nbytes != req.length){
-                // read failure, return failure message
-                buf[req.length] = 0; // set last byte to 0 for failure
-                nbytes = write(connection_fd, buf, req.length + 1);
+        else if (req.type == REQ_READ){
+            // request to read; the bytes go out as they are
+            int64_t found = connection_send_memory(connection_fd, req.address, req.length);
+            if (found < 0){
+                break;
             }
-            else{
-                // read success, return bytes
-                buf[req.length] = 1; // set last byte to 1 for success
-                nbytes = write(connection_fd, buf, req.length + 1);
+            // last byte is 1 for success, 0 for failure
+            send_ack(connection_fd, found == req.length);
+        }
+        else if (req.type == REQ_READV){
+            // batched read of req.length segments
+            uint64_t i;
+            if (req.length > REQ_READV_MAX_SEGS){
+                // the segments that follow can't be skipped safely
+                printf("QemuMemoryAccess: too many segments in readv (%" PRIu64 ")\n", req.length);
+                send_fail_ack(connection_fd);
+                break;
             }
-            free(buf);
+            if (req.length > max_segs){
+                max_segs = req.length;
+                segs = g_realloc(segs, max_segs * sizeof(struct segment));
+                status = g_realloc(status, max_segs);
+            }
+            if (read_full(connection_fd, segs, req.length * sizeof(struct segment)) < 0){
+                break;
+            }
+            for (i = 0; i < req.length; i++){
+                int64_t found = connection_send_memory(connection_fd,
+                        segs[i].address, segs[i].length);
+                if (found < 0){
+                    break;
+                }
+                status[i] = (found == segs[i].length);
+            }
+            if (i < req.length || write_full(connection_fd, status, req.length) < 0){
+                break;
+            }
+        }
+        else if (req.type == REQ_LAYOUT){
+            connection_send_layout(connection_fd);
+        }
+        else if (req.type == REQ_PAUSE){
+            pause_vm();
+            send_pause_reply(connection_fd, 1);
+        }
+        else if (req.type == REQ_RUN_UNTIL){
+            connection_run_until(connection_fd, req.address);
         }
-        else if (req.type == 2){
+        else if (req.type == REQ_WRITE){
             // request to write
             void *write_buf = malloc(req.length);
             nbytes = read(connection_fd, write_buf, req.length);
@@ -141,6 +377,8 @@ connection_handler (int connection_fd)
         }
     }
 
+    g_free(segs);
+    g_free(status);
     close(connection_fd);
 }
 
@@ -5,5 +5,59 @@
  * Author: Bryan D. Payne (bdpayne@acm.org)
  */
 
+#ifndef MEMORY_ACCESS_H
+#define MEMORY_ACCESS_H
+
+#include <stdint.h>
+
+/* Requests and their replies:
+ *
+ * REQ_READ: length bytes of memory, then a status byte (1 ok, 0 failed).
+ * REQ_WRITE: followed by length bytes to write; the reply is a status byte.
+ * REQ_READV: followed by length struct segment; the reply is each segment's
+ *     bytes back to back, then one status byte per segment. A request for
+ *     more than REQ_READV_MAX_SEGS segments is answered with a single 0
+ *     status byte and the connection is closed.
+ * REQ_LAYOUT: a uint32_t count, count struct ram_range covering guest RAM,
+ *     then a status byte.
+ * REQ_PAUSE: stops the VM. The reply is a status byte, then the guest
+ *     instruction count as a uint64_t.
+ * REQ_RUN_UNTIL: replay only. Resumes the VM and pauses it again at the
+ *     first block boundary once address instructions have run. Replies as
+ *     REQ_PAUSE, once paused.
+ */
+typedef enum {
+    REQ_QUIT,
+    REQ_READ,
+    REQ_WRITE,
+    REQ_READV,
+    REQ_LAYOUT,
+    REQ_PAUSE,
+    REQ_RUN_UNTIL
+} req_type_t;
+
+struct request{
+    uint8_t type;      // a req_type_t
+    uint64_t address;  // address to read from OR write to
+    uint64_t length;   // number of bytes to read OR write
+};
+
+struct segment{
+    uint64_t address;
+    uint64_t length;
+};
+
+#define REQ_READV_MAX_SEGS 4096
+
+/* Guest physical memory [address, address + length) is at offset in the
+ * -mem-shared file, which can be mapped instead of read over the socket;
+ * offset is -1 if that memory isn't in the file. */
+struct ram_range{
+    uint64_t address;
+    uint64_t length;
+    int64_t offset;
+};
+
 int memory_access_start (const char *path);
 
+#endif
@@ -87,6 +87,13 @@ uint64_t ram_bytes_total(void);
 
 int ram_save_live(Monitor *mon, QEMUFile *f, int stage, void *opaque);
 int ram_load(QEMUFile *f, void *opaque, int version_id);
+/* While fd >= 0, RAM is saved to and loaded from a raw image in fd starting
+   at offset base, rather than carried in the stream (see arch_init.c). */
+void ram_set_external(int fd, uint64_t base);
+/* Later RAM images share unchanged pages with the len-byte image at base in
+   fd where the filesystem allows.  Takes ownership of fd; -1 clears it.
+   Loading an image makes it the base. */
+void ram_set_external_base(int fd, uint64_t base, uint64_t len);
 
 extern int incoming_expected;
 
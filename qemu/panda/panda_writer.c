@@ -0,0 +1,155 @@
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <pthread.h>
+#include "panda_writer.h"
+
+typedef struct {
+    size_t len;
+    uint8_t *data;
+} PandaWriterBuf;
+
+struct PandaWriter {
+    panda_writer_item_fn write;
+    void *opaque;
+
+    // byte writers only
+    panda_writer_bytes_fn write_bytes;
+    void *bytes_opaque;
+    PandaWriterBuf *cur;
+
+    pthread_mutex_t lock;
+    pthread_cond_t nonempty;
+    pthread_cond_t nonfull;
+    void *queue[PANDA_WRITER_QUEUE_LEN];
+    uint32_t head;
+    uint32_t count;
+    int done;
+    pthread_t thread;
+};
+
+static void *panda_writer_thread(void *arg) {
+    PandaWriter *w = (PandaWriter *) arg;
+    while (1) {
+        pthread_mutex_lock(&w->lock);
+        while (w->count == 0 && !w->done) {
+            pthread_cond_wait(&w->nonempty, &w->lock);
+        }
+        if (w->count == 0) {
+            pthread_mutex_unlock(&w->lock);
+            break;
+        }
+        void *item = w->queue[w->head];
+        w->head = (w->head + 1) % PANDA_WRITER_QUEUE_LEN;
+        w->count--;
+        pthread_cond_signal(&w->nonfull);
+        pthread_mutex_unlock(&w->lock);
+
+        w->write(w->opaque, item);
+    }
+    return NULL;
+}
+
+static PandaWriter *panda_writer_start(PandaWriter *w) {
+    pthread_mutex_init(&w->lock, NULL);
+    pthread_cond_init(&w->nonempty, NULL);
+    pthread_cond_init(&w->nonfull, NULL);
+    if (pthread_create(&w->thread, NULL, panda_writer_thread, w) != 0) {
+        pthread_mutex_destroy(&w->lock);
+        pthread_cond_destroy(&w->nonempty);
+        pthread_cond_destroy(&w->nonfull);
+        free(w);
+        return NULL;
+    }
+    return w;
+}
+
+PandaWriter *panda_writer_new(panda_writer_item_fn write, void *opaque) {
+    PandaWriter *w = (PandaWriter *) calloc(1, sizeof(PandaWriter));
+    w->write = write;
+    w->opaque = opaque;
+    return panda_writer_start(w);
+}
+
+void panda_writer_queue(PandaWriter *w, void *item) {
+    pthread_mutex_lock(&w->lock);
+    while (w->count == PANDA_WRITER_QUEUE_LEN) {
+        pthread_cond_wait(&w->nonfull, &w->lock);
+    }
+    w->queue[(w->head + w->count) % PANDA_WRITER_QUEUE_LEN] = item;
+    w->count++;
+    pthread_cond_signal(&w->nonempty);
+    pthread_mutex_unlock(&w->lock);
+}
+
+static PandaWriterBuf *panda_writer_buf_new(void) {
+    PandaWriterBuf *buf = (PandaWriterBuf *) malloc(sizeof(PandaWriterBuf));
+    buf->len = 0;
+    buf->data = (uint8_t *) malloc(PANDA_WRITER_BUF_SIZE);
+    return buf;
+}
+
+// item write function of byte writers
+static void panda_writer_write_buf(void *opaque, void *item) {
+    PandaWriter *w = (PandaWriter *) opaque;
+    PandaWriterBuf *buf = (PandaWriterBuf *) item;
+    w->write_bytes(w->bytes_opaque, buf->data, buf->len);
+    free(buf->data);
+    free(buf);
+}
+
+PandaWriter *panda_writer_new_bytes(panda_writer_bytes_fn write, void *opaque) {
+    PandaWriter *w = (PandaWriter *) calloc(1, sizeof(PandaWriter));
+    w->write = panda_writer_write_buf;
+    w->opaque = w;
+    w->write_bytes = write;
+    w->bytes_opaque = opaque;
+    w->cur = panda_writer_buf_new();
+    PandaWriterBuf *cur = w->cur;
+    if (!panda_writer_start(w)) {
+        free(cur->data);
+        free(cur);
+        return NULL;
+    }
+    return w;
+}
+
+void panda_writer_append(PandaWriter *w, const void *data, size_t len) {
+    const uint8_t *p = (const uint8_t *) data;
+    assert (w->cur != NULL);
+    while (len > 0) {
+        size_t n = PANDA_WRITER_BUF_SIZE - w->cur->len;
+        if (n > len) n = len;
+        memcpy(w->cur->data + w->cur->len, p, n);
+        w->cur->len += n;
+        p += n;
+        len -= n;
+        if (w->cur->len == PANDA_WRITER_BUF_SIZE) {
+            panda_writer_queue(w, w->cur);
+            w->cur = panda_writer_buf_new();
+        }
+    }
+}
+
+void panda_writer_close(PandaWriter *w) {
+    if (w->cur) {
+        if (w->cur->len > 0) {
+            panda_writer_queue(w, w->cur);
+        }
+        else {
+            free(w->cur->data);
+            free(w->cur);
+        }
+        w->cur = NULL;
+    }
+    pthread_mutex_lock(&w->lock);
+    w->done = 1;
+    pthread_cond_signal(&w->nonempty);
+    pthread_mutex_unlock(&w->lock);
+    pthread_join(w->thread, NULL);
+    pthread_mutex_destroy(&w->lock);
+    pthread_cond_destroy(&w->nonempty);
+    pthread_cond_destroy(&w->nonfull);
+    free(w);
+}
@@ -0,0 +1,47 @@
+#ifndef __PANDA_WRITER_H_
+#define __PANDA_WRITER_H_
+
+#include <stddef.h>
+
+/*
+  Background writer for plugins and traces that produce output faster than
+  they want to wait on the disk (or zlib).  Items are queued on the
+  emulation thread and handed, in order, to a write function on a writer
+  thread.  At most PANDA_WRITER_QUEUE_LEN items wait at a time; past that,
+  queueing blocks until the writer catches up.
+
+  For plain byte streams, panda_writer_new_bytes gathers appended bytes
+  into buffers of PANDA_WRITER_BUF_SIZE and queues each full buffer.
+*/
+
+#define PANDA_WRITER_QUEUE_LEN 4
+#define PANDA_WRITER_BUF_SIZE (1 << 20)
+
+typedef struct PandaWriter PandaWriter;
+
+// Called on the writer thread with each queued item, which it owns.
+typedef void (*panda_writer_item_fn)(void *opaque, void *item);
+// Called on the writer thread with each full (or final) buffer.
+typedef void (*panda_writer_bytes_fn)(void *opaque, const void *data, size_t len);
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Both return NULL if the writer thread can't be started.
+PandaWriter *panda_writer_new(panda_writer_item_fn write, void *opaque);
+PandaWriter *panda_writer_new_bytes(panda_writer_bytes_fn write, void *opaque);
+
+void panda_writer_queue(PandaWriter *w, void *item);
+
+// byte writers only
+void panda_writer_append(PandaWriter *w, const void *data, size_t len);
+
+// Queues what is left, waits for the writer to finish it all and frees w.
+void panda_writer_close(PandaWriter *w);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
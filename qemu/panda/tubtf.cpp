@@ -2,7 +2,9 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
+#include <zlib.h>
 #include "tubtf.h"
+#include "panda_writer.h"
 
 // yes, this is a global.  I assume you only want one trace.
 int tubtf_on = 0;
@@ -50,6 +52,154 @@ static void tubtf_write_u64_at(uint64_t val, uint64_t pos) {
     fseek(fp, current_pos, SEEK_SET);
 }
 
+/*
+   Columnar traces.  Rows are gathered column by column into a chunk; full
+   chunks are queued for a panda_writer thread that compresses and writes
+   them and builds the chunk index.
+   */
+
+typedef struct {
+    uint32_t num_rows;
+    uint32_t cap;
+    uint64_t first_instr;
+    uint64_t *col[TUBTF_NUM_COL];
+} TubtfChunk;
+
+typedef struct {
+    TubtfChunk *cur;
+    PandaWriter *writer;
+    uint64_t instr;   // arg3 of the last TUBTFE_LLVM_FN row added
+
+    // only touched by the writer thread until it is closed
+    z_stream zs;
+    uint8_t *zbuf;
+    uLong zbuf_size;
+    TubtfChunkIndex *index;
+    uint64_t num_chunks;
+    uint64_t index_cap;
+    uint64_t next_row;
+    uint64_t offset;
+} TubtfColumnar;
+
+static TubtfChunk *tubtf_chunk_new(void) {
+    TubtfChunk *chunk = (TubtfChunk *) malloc(sizeof(TubtfChunk));
+    chunk->num_rows = 0;
+    chunk->cap = TUBTF_CHUNK_ROWS;
+    for (int c = 0; c < TUBTF_NUM_COL; c++) {
+        chunk->col[c] = (uint64_t *) malloc(chunk->cap * sizeof(uint64_t));
+    }
+    return chunk;
+}
+
+static void tubtf_chunk_free(TubtfChunk *chunk) {
+    for (int c = 0; c < TUBTF_NUM_COL; c++) {
+        free(chunk->col[c]);
+    }
+    free(chunk);
+}
+
+static void tubtf_write_chunk(TubtfColumnar *tc, TubtfChunk *chunk) {
+    FILE *fp = (FILE *) tubtf->fp;
+    uLong raw_size = (uLong) chunk->num_rows * sizeof(uint64_t) * TUBTF_NUM_COL;
+    uLong bound = deflateBound(&tc->zs, raw_size);
+    if (bound > tc->zbuf_size) {
+        tc->zbuf = (uint8_t *) realloc(tc->zbuf, bound);
+        tc->zbuf_size = bound;
+    }
+    tc->zs.next_out = tc->zbuf;
+    tc->zs.avail_out = bound;
+    for (int c = 0; c < TUBTF_NUM_COL; c++) {
+        tc->zs.next_in = (Bytef *) chunk->col[c];
+        tc->zs.avail_in = chunk->num_rows * sizeof(uint64_t);
+        int ret = deflate(&tc->zs, (c == TUBTF_NUM_COL - 1) ? Z_FINISH : Z_NO_FLUSH);
+        assert (tc->zs.avail_in == 0);
+        assert (ret == ((c == TUBTF_NUM_COL - 1) ? Z_STREAM_END : Z_OK));
+    }
+    uint32_t stored_size = bound - tc->zs.avail_out;
+    deflateReset(&tc->zs);
+
+    if (tc->num_chunks == tc->index_cap) {
+        tc->index_cap = tc->index_cap ? tc->index_cap * 2 : 1024;
+        tc->index = (TubtfChunkIndex *) realloc(tc->index, tc->index_cap * sizeof(TubtfChunkIndex));
+    }
+    TubtfChunkIndex *ie = &tc->index[tc->num_chunks++];
+    ie->offset = tc->offset;
+    ie->first_row = tc->next_row;
+    ie->first_instr = chunk->first_instr;
+    ie->num_rows = chunk->num_rows;
+    ie->stored_size = stored_size;
+
+    fwrite(&chunk->num_rows, sizeof(uint32_t), 1, fp);
+    fwrite(&stored_size, sizeof(uint32_t), 1, fp);
+    fwrite(tc->zbuf, stored_size, 1, fp);
+    tc->offset += 2 * sizeof(uint32_t) + stored_size;
+    tc->next_row += chunk->num_rows;
+}
+
+// runs on the writer thread
+static void tubtf_writer(void *opaque, void *item) {
+    TubtfColumnar *tc = (TubtfColumnar *) opaque;
+    TubtfChunk *chunk = (TubtfChunk *) item;
+    tubtf_write_chunk(tc, chunk);
+    tubtf_chunk_free(chunk);
+}
+
+static void tubtf_columnar_add(uint64_t *row) {
+    TubtfColumnar *tc = (TubtfColumnar *) tubtf->columnar;
+    TubtfChunk *chunk = tc->cur;
+    if ((chunk->num_rows >= TUBTF_CHUNK_ROWS && row[2] == TUBTFE_LLVM_FN) ||
+        chunk->num_rows >= TUBTF_MAX_CHUNK_ROWS) {
+        panda_writer_queue(tc->writer, chunk);
+        chunk = tc->cur = tubtf_chunk_new();
+    }
+    if (chunk->num_rows == chunk->cap) {
+        chunk->cap *= 2;
+        for (int c = 0; c < TUBTF_NUM_COL; c++) {
+            chunk->col[c] = (uint64_t *) realloc(chunk->col[c], chunk->cap * sizeof(uint64_t));
+        }
+    }
+    // a chunk cut in the middle of a block is still indexed by the
+    // instruction count of the block it starts in
+    if (row[2] == TUBTFE_LLVM_FN) {
+        tc->instr = row[5];
+    }
+    if (chunk->num_rows == 0) {
+        chunk->first_instr = tc->instr;
+    }
+    for (int c = 0; c < TUBTF_NUM_COL; c++) {
+        chunk->col[c][chunk->num_rows] = row[c];
+    }
+    chunk->num_rows++;
+}
+
+static void tubtf_columnar_close(void) {
+    TubtfColumnar *tc = (TubtfColumnar *) tubtf->columnar;
+    if (tc->cur->num_rows > 0) {
+        panda_writer_queue(tc->writer, tc->cur);
+    }
+    else {
+        tubtf_chunk_free(tc->cur);
+    }
+    tc->cur = NULL;
+    panda_writer_close(tc->writer);
+
+    FILE *fp = (FILE *) tubtf->fp;
+    TubtfFooter footer;
+    footer.index_offset = tc->offset;
+    footer.num_chunks = tc->num_chunks;
+    footer.num_rows = tc->next_row;
+    memcpy(footer.magic, TUBTF_INDEX_MAGIC, sizeof(footer.magic));
+    fwrite(tc->index, sizeof(TubtfChunkIndex), tc->num_chunks, fp);
+    fwrite(&footer, sizeof(footer), 1, fp);
+    printf ("%lu rows in %lu chunks\n", (unsigned long) tc->next_row, (unsigned long) tc->num_chunks);
+
+    deflateEnd(&tc->zs);
+    free(tc->zbuf);
+    free(tc->index);
+    free(tc);
+    tubtf->columnar = NULL;
+}
+
 static void tubtf_write_contents_bits(void) {
     assert (tubtf != NULL);
     tubtf_write_u64_at(tubtf->contents_bits, 8);
@@ -65,6 +215,7 @@ void tubtf_open(char *filename, TubtfColw colw) {
     tubtf->num_rows = 0;
     tubtf->filename = strdup(filename);
     tubtf->fp = fopen(filename, "w");
+    tubtf->columnar = NULL;
     // write the header
     tubtf_write_u32_at(tubtf->version, 0);
     tubtf_write_u32_at(tubtf->colw, 4);
@@ -75,17 +226,27 @@ void tubtf_open(char *filename, TubtfColw colw) {
     fseek((FILE*) tubtf->fp, header_size, SEEK_SET);
 }
 
+void tubtf_open_columnar(char *filename) {
+    tubtf_open(filename, TUBTF_COLW_64);
+    tubtf->version = TUBTF_VERSION_COLUMNAR;
+    tubtf_write_u32_at(tubtf->version, 0);
+
+    TubtfColumnar *tc = (TubtfColumnar *) calloc(1, sizeof(TubtfColumnar));
+    tc->cur = tubtf_chunk_new();
+    tc->offset = TUBTF_HEADER_SIZE;
+    int ret = deflateInit(&tc->zs, Z_BEST_SPEED);
+    assert (ret == Z_OK);
+    tubtf->columnar = tc;
+    tc->writer = panda_writer_new(tubtf_writer, tc);
+    assert (tc->writer != NULL);
+}
+
 
 void tubtf_write_el_32(uint32_t cr3, uint32_t eip, uint32_t type, uint32_t arg1, uint32_t arg2, uint32_t arg3, uint32_t arg4)  {
     assert (tubtf != NULL);
     assert (tubtf->colw == TUBTF_COLW_32);
-    fwrite(&(cr3),  sizeof(cr3),  1, (FILE*) tubtf->fp);
-    fwrite(&(eip),  sizeof(eip),  1, (FILE*) tubtf->fp);
-    fwrite(&(type), sizeof(type), 1, (FILE*) tubtf->fp);
-    fwrite(&(arg1), sizeof(arg1), 1, (FILE*) tubtf->fp);
-    fwrite(&(arg2), sizeof(arg2), 1, (FILE*) tubtf->fp);
-    fwrite(&(arg3), sizeof(arg3), 1, (FILE*) tubtf->fp);
-    fwrite(&(arg4), sizeof(arg4), 1, (FILE*) tubtf->fp);
+    uint32_t row[TUBTF_NUM_COL] = { cr3, eip, type, arg1, arg2, arg3, arg4 };
+    fwrite(row, sizeof(row), 1, (FILE*) tubtf->fp);
     tubtf->num_rows ++;
 }
 
@@ -93,19 +254,22 @@ void tubtf_write_el_32(uint32_t cr3, uint32_t eip, uint32_t type, uint32_t arg1,
 void tubtf_write_el_64(uint64_t cr3, uint64_t eip, uint64_t type, uint64_t arg1, uint64_t arg2, uint64_t arg3, uint64_t arg4) {
     assert (tubtf != NULL);
     assert (tubtf->colw == TUBTF_COLW_64);
-    fwrite(&(cr3),  sizeof(cr3),  1, (FILE*) tubtf->fp);
-    fwrite(&(eip),  sizeof(eip),  1, (FILE*) tubtf->fp);
-    fwrite(&(type), sizeof(type), 1, (FILE*) tubtf->fp);
-    fwrite(&(arg1), sizeof(arg1), 1, (FILE*) tubtf->fp);
-    fwrite(&(arg2), sizeof(arg2), 1, (FILE*) tubtf->fp);
-    fwrite(&(arg3), sizeof(arg3), 1, (FILE*) tubtf->fp);
-    fwrite(&(arg4), sizeof(arg4), 1, (FILE*) tubtf->fp);
+    uint64_t row[TUBTF_NUM_COL] = { cr3, eip, type, arg1, arg2, arg3, arg4 };
+    if (tubtf->columnar) {
+        tubtf_columnar_add(row);
+    }
+    else {
+        fwrite(row, sizeof(row), 1, (FILE*) tubtf->fp);
+    }
     tubtf->num_rows ++;
 }
 
 
 void tubtf_close(void) {
     assert (tubtf != NULL);
+    if (tubtf->columnar) {
+        tubtf_columnar_close();
+    }
     tubtf_write_contents_bits();
     // fill in number of rows in matrix
     fseek((FILE*) tubtf->fp, sizeof (tubtf->version) + sizeof(tubtf->colw) + sizeof(tubtf->contents_bits), SEEK_SET);
@@ -77,6 +77,32 @@
   readily be loaded into python with numpy and then navigated, analyzed, and
   queried.
 
+  ==============================================================================
+  COLUMNAR TRACES
+
+  A version 1 trace (see tubtf_open_columnar) has the same header and the
+  same rows, but the body is a sequence of chunks, each holding a run of
+  consecutive rows stored column by column (all cr3s, then all eips, ...)
+  and zlib-compressed.  Columns are always 64 bits.
+
+  field  width   name
+  0      4       num_rows in chunk
+  1      4       stored_size, bytes of compressed data that follow
+
+  A chunk is cut only before a TUBTFE_LLVM_FN element once it has
+  TUBTF_CHUNK_ROWS rows, so each chunk starts with a whole LLVM block and
+  can be decoded on its own (or, for traces with no LLVM blocks, every
+  TUBTF_MAX_CHUNK_ROWS rows).
+
+  After the last chunk comes the chunk index, one TubtfChunkIndex per
+  chunk, then a TubtfFooter at the very end of the file.  first_instr in
+  the index is arg3 of the last TUBTFE_LLVM_FN element at or before the
+  chunk's first row (0 if there is none), which llvm_trace sets to the
+  guest instruction count.  It never decreases from one chunk to the next,
+  so a reader can find the part of a trace around an instruction count
+  without decompressing anything before it.  num_rows in the header is
+  only 32 bits; the footer has the full count.
+
  */
 
 
@@ -86,6 +112,29 @@
 
 #define TUBTF_NUM_COL 7
 
+#define TUBTF_VERSION_ROWS 0
+#define TUBTF_VERSION_COLUMNAR 1
+#define TUBTF_HEADER_SIZE 20
+
+#define TUBTF_CHUNK_ROWS (1 << 16)
+#define TUBTF_MAX_CHUNK_ROWS (1 << 20)
+#define TUBTF_INDEX_MAGIC "TUBTFIDX"
+
+typedef struct {
+  uint64_t offset;        // of the chunk header
+  uint64_t first_row;
+  uint64_t first_instr;
+  uint32_t num_rows;
+  uint32_t stored_size;
+} __attribute__((packed)) TubtfChunkIndex;
+
+typedef struct {
+  uint64_t index_offset;
+  uint64_t num_chunks;
+  uint64_t num_rows;
+  char magic[8];
+} __attribute__((packed)) TubtfFooter;
+
 typedef enum {
   TUBTF_COLW_32,
   TUBTF_COLW_64
@@ -100,6 +149,8 @@ typedef struct tubtf_struct {
   uint32_t num_rows;
   char *filename;
   void *fp;
+  // writer state for columnar traces, NULL otherwise
+  void *columnar;
 } TubtfTrace;
 
 // opens trace file & writes header
@@ -109,6 +160,10 @@ extern "C" {
 #endif
 void tubtf_open(char *filename, TubtfColw colw);
 
+// opens a version 1 (columnar, compressed) trace. Chunks are compressed and
+// written by a background thread; tubtf_close waits for it.
+void tubtf_open_columnar(char *filename);
+
 uint32_t tubtf_element_size(void);
 
 // writes a single trace element
@@ -14,7 +14,7 @@ PANDAENDCOMMENT */
 void helper_panda_insn_exec(target_ulong pc) {
     // PANDA instrumentation: before basic block 
     panda_cb_list *plist;
-    for(plist = panda_cbs[PANDA_CB_INSN_EXEC]; plist != NULL; plist = panda_cb_list_next(plist)) {
+    for(plist = panda_cb_list_first(PANDA_CB_INSN_EXEC); plist != NULL; plist = panda_cb_list_next(plist)) {
         plist->entry.insn_exec(env, pc);
     }
 }
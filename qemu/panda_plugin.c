@@ -18,6 +18,11 @@ PANDAENDCOMMENT */
 #include "qmp-commands.h"
 #include "hmp.h"
 #include "error.h"
+#include "qerror.h"
+#include "qemu-timer.h"
+#ifdef CONFIG_SOFTMMU
+#include "monitor.h"
+#endif
 
 #include <libgen.h>
 
@@ -55,6 +60,7 @@ bool panda_please_flush_tb = false;
 bool panda_update_pc = false;
 bool panda_use_memcb = false;
 bool panda_tb_chaining = true;
+bool panda_profiling = false;
 
 
 
@@ -181,6 +187,9 @@ void panda_unload_plugin_idx(int plugin_idx) {
 }
 
 void panda_unload_plugins(void) {
+    if (panda_profiling) {
+        panda_profile_report(stdout, fprintf);
+    }
     // Unload them starting from the end to avoid having to shuffle everything
     // down each time
     while (nb_panda_plugins > 0) {
@@ -204,6 +213,7 @@ void panda_register_callback(void *plugin, panda_cb_type type, panda_cb cb) {
     new_list->prev = NULL;
     new_list->next = NULL;
     new_list->enabled = true;
+    new_list->type = type;
     if(panda_cbs[type] != NULL) {
         new_list->next = panda_cbs[type];
         panda_cbs[type]->prev = new_list;
@@ -297,20 +307,261 @@ void panda_disable_plugin(void *plugin) {
     }
 }
 
+static void panda_profile_end(panda_cb_list *plist, bool more);
+
 panda_cb_list* panda_cb_list_next(panda_cb_list* plist) {
     // Allows to navigate the callback linked list skipping disabled callbacks
     panda_cb_list* node = plist->next;
-    if (node == NULL) {
-        return node;
+    while (node != NULL && !node->enabled) {
+        node = node->next;
     }
+    if (unlikely(panda_profiling)) {
+        panda_profile_end(plist, node != NULL);
+    }
+    return node;
+}
 
-    if (node->enabled) {
-        return node;
-    } else {
-        return panda_cb_list_next(node);
+/* Each dispatch loop pushes a start time (panda_cb_list_first); each step
+   of the loop charges the callback that just ran and restarts the clock,
+   and the last step pops.  The stack lets a callback that triggers other
+   callbacks keep its own start time. */
+#define PANDA_PROFILE_DEPTH 16
+#define PANDA_PROFILE_PPP_MAX 256
+
+typedef struct {
+    const char *cb_name;
+    void *fn;
+    uint64_t calls;
+    uint64_t ticks;
+} panda_ppp_profile;
+
+static int64_t profile_start[PANDA_PROFILE_DEPTH];
+static int profile_depth;
+static int64_t profile_epoch;
+static panda_ppp_profile profile_ppp[PANDA_PROFILE_PPP_MAX];
+
+static const char *panda_cb_names[PANDA_CB_LAST] = {
+    [PANDA_CB_BEFORE_BLOCK_TRANSLATE] = "before_block_translate",
+    [PANDA_CB_AFTER_BLOCK_TRANSLATE] = "after_block_translate",
+    [PANDA_CB_BEFORE_BLOCK_EXEC_INVALIDATE_OPT] = "before_block_exec_invalidate_opt",
+    [PANDA_CB_BEFORE_BLOCK_EXEC] = "before_block_exec",
+    [PANDA_CB_AFTER_BLOCK_EXEC] = "after_block_exec",
+    [PANDA_CB_INSN_TRANSLATE] = "insn_translate",
+    [PANDA_CB_INSN_EXEC] = "insn_exec",
+    [PANDA_CB_VIRT_MEM_READ] = "virt_mem_read",
+    [PANDA_CB_VIRT_MEM_WRITE] = "virt_mem_write",
+    [PANDA_CB_PHYS_MEM_READ] = "phys_mem_read",
+    [PANDA_CB_PHYS_MEM_WRITE] = "phys_mem_write",
+    [PANDA_CB_VIRT_MEM_BEFORE_READ] = "virt_mem_before_read",
+    [PANDA_CB_VIRT_MEM_BEFORE_WRITE] = "virt_mem_before_write",
+    [PANDA_CB_PHYS_MEM_BEFORE_READ] = "phys_mem_before_read",
+    [PANDA_CB_PHYS_MEM_BEFORE_WRITE] = "phys_mem_before_write",
+    [PANDA_CB_VIRT_MEM_AFTER_READ] = "virt_mem_after_read",
+    [PANDA_CB_VIRT_MEM_AFTER_WRITE] = "virt_mem_after_write",
+    [PANDA_CB_PHYS_MEM_AFTER_READ] = "phys_mem_after_read",
+    [PANDA_CB_PHYS_MEM_AFTER_WRITE] = "phys_mem_after_write",
+    [PANDA_CB_HD_READ] = "hd_read",
+    [PANDA_CB_HD_WRITE] = "hd_write",
+    [PANDA_CB_GUEST_HYPERCALL] = "guest_hypercall",
+    [PANDA_CB_MONITOR] = "monitor",
+    [PANDA_CB_CPU_RESTORE_STATE] = "cpu_restore_state",
+    [PANDA_CB_BEFORE_REPLAY_LOADVM] = "before_replay_loadvm",
+#ifndef CONFIG_SOFTMMU
+    [PANDA_CB_USER_BEFORE_SYSCALL] = "user_before_syscall",
+    [PANDA_CB_USER_AFTER_SYSCALL] = "user_after_syscall",
+#endif
+#ifdef CONFIG_PANDA_VMI
+    [PANDA_CB_VMI_AFTER_FORK] = "vmi_after_fork",
+    [PANDA_CB_VMI_AFTER_EXEC] = "vmi_after_exec",
+    [PANDA_CB_VMI_AFTER_CLONE] = "vmi_after_clone",
+#endif
+    [PANDA_CB_VMI_PGD_CHANGED] = "vmi_pgd_changed",
+    [PANDA_CB_REPLAY_HD_TRANSFER] = "replay_hd_transfer",
+    [PANDA_CB_REPLAY_NET_TRANSFER] = "replay_net_transfer",
+    [PANDA_CB_REPLAY_BEFORE_CPU_PHYSICAL_MEM_RW_RAM] = "replay_before_cpu_physical_mem_rw_ram",
+    [PANDA_CB_REPLAY_AFTER_CPU_PHYSICAL_MEM_RW_RAM] = "replay_after_cpu_physical_mem_rw_ram",
+    [PANDA_CB_REPLAY_HANDLE_PACKET] = "replay_handle_packet",
+};
+
+int64_t panda_profile_ticks(void) {
+    return cpu_get_real_ticks();
+}
+
+void panda_profile_begin(void) {
+    if (profile_depth < PANDA_PROFILE_DEPTH) {
+        profile_start[profile_depth] = cpu_get_real_ticks();
+    }
+    profile_depth++;
+}
+
+// after a longjmp back to cpu_exec, out of whatever callbacks were running
+void panda_profile_unwind(void) {
+    profile_depth = 0;
+}
+
+static void panda_profile_end(panda_cb_list *plist, bool more) {
+    int64_t now;
+    if (profile_depth == 0) return;
+    if (profile_depth <= PANDA_PROFILE_DEPTH) {
+        now = cpu_get_real_ticks();
+        plist->prof_calls++;
+        plist->prof_ticks += now - profile_start[profile_depth - 1];
+        if (more) {
+            profile_start[profile_depth - 1] = now;
+        }
+    }
+    if (!more) {
+        profile_depth--;
+    }
+}
+
+void panda_profile_ppp(const char *cb_name, void *fn, int64_t start) {
+    int64_t now = cpu_get_real_ticks();
+    unsigned int i = ((uintptr_t) fn >> 4) % PANDA_PROFILE_PPP_MAX;
+    unsigned int n;
+    // open addressing on the callback; full tables just stop counting
+    for (n = 0; n < PANDA_PROFILE_PPP_MAX; n++) {
+        panda_ppp_profile *p = &profile_ppp[(i + n) % PANDA_PROFILE_PPP_MAX];
+        if (p->fn == NULL) {
+            p->fn = fn;
+            p->cb_name = cb_name;
+        }
+        else if (p->fn != fn || strcmp(p->cb_name, cb_name) != 0) {
+            continue;
+        }
+        p->calls++;
+        p->ticks += now - start;
+        return;
     }
 }
 
+void panda_profile_reset(void) {
+    int i;
+    panda_cb_list *plist;
+    for (i = 0; i < PANDA_CB_LAST; i++) {
+        for (plist = panda_cbs[i]; plist != NULL; plist = plist->next) {
+            plist->prof_calls = plist->prof_ticks = 0;
+        }
+    }
+    for (i = 0; i < PANDA_PROFILE_PPP_MAX; i++) {
+        profile_ppp[i].calls = profile_ppp[i].ticks = 0;
+    }
+    profile_epoch = cpu_get_real_ticks();
+}
+
+typedef struct {
+    char who[64];
+    const char *what;
+    uint64_t calls;
+    uint64_t ticks;
+} panda_profile_row;
+
+static int panda_profile_row_cmp(const void *a, const void *b) {
+    const panda_profile_row *ra = a, *rb = b;
+    if (ra->ticks != rb->ticks) return ra->ticks < rb->ticks ? 1 : -1;
+    return 0;
+}
+
+static void panda_profile_print_header(FILE *f, fprintf_function pr, const char *title) {
+    pr(f, "%-24s %-36s %14s %16s %10s %7s\n", title, "callback",
+       "calls", "ticks", "ticks/call", "% run");
+}
+
+static void panda_profile_print_row(FILE *f, fprintf_function pr, const char *who,
+                                    const char *what, uint64_t calls, uint64_t ticks,
+                                    int64_t elapsed) {
+    pr(f, "%-24s %-36s %14" PRIu64 " %16" PRIu64 " %10" PRIu64 " %6.2f%%\n",
+       who, what, calls, ticks, ticks / calls,
+       elapsed > 0 ? 100.0 * ticks / elapsed : 0.0);
+}
+
+static void panda_profile_print(FILE *f, fprintf_function pr, const char *title,
+                                panda_profile_row *rows, int n, int64_t elapsed) {
+    int i;
+    if (n == 0) return;
+    panda_profile_print_header(f, pr, title);
+    for (i = 0; i < n; i++) {
+        panda_profile_print_row(f, pr, rows[i].who, rows[i].what,
+                                rows[i].calls, rows[i].ticks, elapsed);
+    }
+}
+
+static const char *panda_plugin_name(void *plugin) {
+    int i;
+    for (i = 0; i < nb_panda_plugins; i++) {
+        if (panda_plugins[i].plugin == plugin) return panda_plugins[i].name;
+    }
+    return "?";
+}
+
+// Rows for the plugin callbacks, then the plugin-to-plugin callbacks, each
+// sorted by time. *n_plugin of the *n rows are plugin callbacks.
+static panda_profile_row *panda_profile_collect(int *n_plugin, int *n_rows) {
+    panda_profile_row *rows;
+    panda_cb_list *plist;
+    int i, j, n = 0, first_ppp;
+
+    // one row per (plugin, callback type)
+    for (i = 0; i < PANDA_CB_LAST; i++) {
+        for (plist = panda_cbs[i]; plist != NULL; plist = plist->next) n++;
+    }
+    rows = g_new0(panda_profile_row, n + PANDA_PROFILE_PPP_MAX);
+    n = 0;
+    for (i = 0; i < PANDA_CB_LAST; i++) {
+        for (plist = panda_cbs[i]; plist != NULL; plist = plist->next) {
+            const char *who = panda_plugin_name(plist->owner);
+            if (plist->prof_calls == 0) continue;
+            for (j = 0; j < n; j++) {
+                if (rows[j].what == panda_cb_names[i] && !strcmp(rows[j].who, who)) break;
+            }
+            if (j == n) {
+                snprintf(rows[n].who, sizeof(rows[n].who), "%s", who);
+                rows[n].what = panda_cb_names[i] ? panda_cb_names[i] : "?";
+                n++;
+            }
+            rows[j].calls += plist->prof_calls;
+            rows[j].ticks += plist->prof_ticks;
+        }
+    }
+    qsort(rows, n, sizeof(*rows), panda_profile_row_cmp);
+    first_ppp = n;
+
+    // plugin-to-plugin callbacks, named by the library that implements them
+    for (i = 0; i < PANDA_PROFILE_PPP_MAX; i++) {
+        panda_ppp_profile *p = &profile_ppp[i];
+        Dl_info info;
+        if (p->calls == 0) continue;
+        if (dladdr(p->fn, &info) && info.dli_fname) {
+            const char *base = strrchr(info.dli_fname, '/');
+            snprintf(rows[n].who, sizeof(rows[n].who), "%s",
+                     base ? base + 1 : info.dli_fname);
+        }
+        else {
+            snprintf(rows[n].who, sizeof(rows[n].who), "%p", p->fn);
+        }
+        rows[n].what = p->cb_name;
+        rows[n].calls = p->calls;
+        rows[n].ticks = p->ticks;
+        n++;
+    }
+    qsort(rows + first_ppp, n - first_ppp, sizeof(*rows), panda_profile_row_cmp);
+
+    *n_plugin = first_ppp;
+    *n_rows = n;
+    return rows;
+}
+
+void panda_profile_report(FILE *f, fprintf_function pr) {
+    int64_t elapsed = cpu_get_real_ticks() - profile_epoch;
+    int n_plugin, n;
+    panda_profile_row *rows = panda_profile_collect(&n_plugin, &n);
+
+    pr(f, "PANDA callback profile, %" PRId64 " ticks of run time\n", elapsed);
+    panda_profile_print(f, pr, "plugin", rows, n_plugin, elapsed);
+    panda_profile_print(f, pr, "PPP callee", rows + n_plugin, n - n_plugin, elapsed);
+    g_free(rows);
+}
+
 bool panda_flush_tb(void) {
     if(panda_please_flush_tb) {
         panda_please_flush_tb = false;
@@ -375,6 +626,28 @@ void panda_disable_llvm_helpers(void){
 
 #endif
 
+int panda_virtual_memory_read_string(CPUState *env, target_ulong addr, char *buf, int maxlen) {
+    int n = 0;
+    if (maxlen <= 0) return -1;
+    while (n < maxlen - 1) {
+        // never read past the end of a page, in case the next isn't mapped
+        int l = TARGET_PAGE_SIZE - ((addr + n) & ~TARGET_PAGE_MASK);
+        if (l > maxlen - 1 - n) l = maxlen - 1 - n;
+        if (panda_virtual_memory_rw(env, addr + n, (uint8_t *)buf + n, l, 0) < 0) {
+            if (n == 0) {
+                buf[0] = 0;
+                return -1;
+            }
+            break;
+        }
+        char *end = memchr(buf + n, 0, l);
+        if (end) return end - buf;
+        n += l;
+    }
+    buf[n] = 0;
+    return n;
+}
+
 void panda_memsavep(FILE *f) {
 #ifdef CONFIG_SOFTMMU
     if (!f) return;
@@ -395,6 +668,51 @@ void panda_memsavep(FILE *f) {
 #endif
 }
 
+#ifdef CONFIG_SOFTMMU
+static void panda_memsavep_reset_dirty(void) {
+    RAMBlock *block;
+    QLIST_FOREACH(block, &ram_list.blocks, next) {
+        cpu_physical_memory_reset_dirty(block->offset,
+                block->offset + block->length, PANDA_DIRTY_FLAG);
+    }
+}
+#endif
+
+void panda_memsavep_track(void) {
+#ifdef CONFIG_SOFTMMU
+    panda_memsavep_reset_dirty();
+#endif
+}
+
+uint64_t panda_memsavep_dirty(FILE *f) {
+    uint64_t pages = 0;
+#ifdef CONFIG_SOFTMMU
+    if (!f) return 0;
+    panda_memdelta_header hdr = { PANDA_MEMDELTA_MAGIC, 1, TARGET_PAGE_SIZE };
+    uint8_t mem_buf[TARGET_PAGE_SIZE];
+    ram_addr_t addr;
+    fwrite(&hdr, sizeof(hdr), 1, f);
+    for (addr = 0; addr < ram_size; addr += TARGET_PAGE_SIZE) {
+        ram_addr_t pd = cpu_get_physical_page_desc(addr);
+        uint64_t paddr = addr;
+        // I/O pages are always zeroes in the full dump
+        if ((pd & ~TARGET_PAGE_MASK) > IO_MEM_ROM && !(pd & IO_MEM_ROMD)) {
+            continue;
+        }
+        if (!cpu_physical_memory_get_dirty(pd & TARGET_PAGE_MASK,
+                    PANDA_DIRTY_FLAG)) {
+            continue;
+        }
+        panda_physical_memory_rw(addr, mem_buf, TARGET_PAGE_SIZE, 0);
+        fwrite(&paddr, sizeof(paddr), 1, f);
+        fwrite(mem_buf, TARGET_PAGE_SIZE, 1, f);
+        pages++;
+    }
+    panda_memsavep_reset_dirty();
+#endif
+    return pages;
+}
+
 // Parse out arguments and return them to caller
 panda_arg_list *panda_get_args(const char *plugin_name) {
     panda_arg_list *ret = NULL;
@@ -610,6 +928,43 @@ void qmp_plugin_cmd(const char * cmd, Error **errp) {
     
 }
 
+PandaProfile *qmp_panda_profile(bool has_reset, bool reset, Error **errp) {
+    PandaProfile *prof;
+    PandaProfileInfoList *cur = NULL;
+    panda_profile_row *rows;
+    int i, n_plugin, n;
+
+    if (!panda_profiling) {
+        error_set(errp, QERR_FEATURE_DISABLED, "panda-profile");
+        return NULL;
+    }
+
+    prof = g_malloc0(sizeof(*prof));
+    prof->ticks = cpu_get_real_ticks() - profile_epoch;
+    rows = panda_profile_collect(&n_plugin, &n);
+    for (i = 0; i < n; i++) {
+        PandaProfileInfoList *info = g_malloc0(sizeof(*info));
+        info->value = g_malloc0(sizeof(*info->value));
+        info->value->plugin = g_strdup(rows[i].who);
+        info->value->callback = g_strdup(rows[i].what);
+        info->value->ppp = (i >= n_plugin);
+        info->value->calls = rows[i].calls;
+        info->value->ticks = rows[i].ticks;
+        if (!cur) {
+            prof->callbacks = cur = info;
+        } else {
+            cur->next = info;
+            cur = info;
+        }
+    }
+    g_free(rows);
+
+    if (has_reset && reset) {
+        panda_profile_reset();
+    }
+    return prof;
+}
+
 // HMP
 void hmp_panda_load_plugin(Monitor *mon, const QDict *qdict) {
     Error *err;
@@ -633,10 +988,46 @@ void hmp_panda_list_plugins(Monitor *mon, const QDict *qdict) {
     qmp_list_plugins(&err);
 }
 
+static int GCC_FMT_ATTR(2, 3) panda_monitor_fprintf(FILE *stream, const char *fmt, ...) {
+    va_list ap;
+    va_start(ap, fmt);
+    monitor_vprintf((Monitor *)stream, fmt, ap);
+    va_end(ap);
+    return 0;
+}
+
+void hmp_panda_profile(Monitor *mon, const QDict *qdict) {
+    Error *err = NULL;
+    PandaProfile *prof;
+    PandaProfileInfoList *l;
+    bool ppp = false, first = true;
+
+    prof = qmp_panda_profile(true, qdict_get_try_bool(qdict, "reset", 0), &err);
+    if (err) {
+        error_free(err);
+        monitor_printf(mon, "Profiling is off; start QEMU with -panda-profile.\n");
+        return;
+    }
+    monitor_printf(mon, "PANDA callback profile, %" PRId64 " ticks of run time\n",
+                   prof->ticks);
+    for (l = prof->callbacks; l != NULL; l = l->next) {
+        if (first || l->value->ppp != ppp) {
+            panda_profile_print_header((FILE *)mon, panda_monitor_fprintf,
+                                       l->value->ppp ? "PPP callee" : "plugin");
+            ppp = l->value->ppp;
+            first = false;
+        }
+        panda_profile_print_row((FILE *)mon, panda_monitor_fprintf,
+                                l->value->plugin, l->value->callback,
+                                l->value->calls, l->value->ticks, prof->ticks);
+    }
+    qapi_free_PandaProfile(prof);
+}
+
 void hmp_panda_plugin_cmd(Monitor *mon, const QDict *qdict) {
     panda_cb_list *plist;
     const char *cmd = qdict_get_try_str(qdict, "cmd");
-    for(plist = panda_cbs[PANDA_CB_MONITOR]; plist != NULL; plist = panda_cb_list_next(plist)) {
+    for(plist = panda_cb_list_first(PANDA_CB_MONITOR); plist != NULL; plist = panda_cb_list_next(plist)) {
         plist->entry.monitor(mon, cmd);
     }
 }
@@ -702,6 +702,9 @@ struct _panda_cb_list {
     panda_cb_list *next;
     panda_cb_list *prev;
     bool enabled;
+    panda_cb_type type;
+    uint64_t prof_calls;    // with -panda-profile
+    uint64_t prof_ticks;
 };
 panda_cb_list* panda_cb_list_next(panda_cb_list* plist);
 void panda_enable_plugin(void *plugin);
@@ -727,12 +730,32 @@ void   panda_unload_plugins(void);
 #ifdef CONFIG_SOFTMMU
 int panda_physical_memory_rw(target_phys_addr_t addr, uint8_t *buf, int len, int is_write);
 target_phys_addr_t panda_virt_to_phys(CPUState *env, target_ulong addr);
+// Virtual-to-physical translations for the two functions above and below
+// are cached per address space, following the guest's TLB flushes (see
+// exec.c). Plugins that change guest page tables themselves, or need
+// translations of another address space right after the guest edits it,
+// can drop the cache.
+void panda_v2p_flush(void);
+void panda_v2p_flush_asid(target_ulong asid);
+// From a phys/virt_mem_before_read callback in a block running its TCG code:
+// abandon the block and run the current instruction again from its start,
+// in a new block. Doesn't return.
+void QEMU_NORETURN panda_restart_insn(CPUState *env);
 #endif
 
 // is_write == 1 means this is a write to the virtual memory addr of the contents of buf.
 // is_write == 0 is a read from that addr into buf.  
 int panda_virtual_memory_rw(CPUState *env, target_ulong addr, uint8_t *buf, int len, int is_write);
 
+// Reads a NUL-terminated string of at most maxlen - 1 characters into buf,
+// a page at a time, and always terminates buf. Returns strlen(buf), which
+// stops short if the string runs into an unmapped page, or -1 if nothing
+// could be read.
+int panda_virtual_memory_read_string(CPUState *env, target_ulong addr, char *buf, int maxlen);
+// Reads a whole guest struct, e.g. panda_virtual_memory_read_struct(env, va, &task).
+#define panda_virtual_memory_read_struct(env, addr, ptr) \
+    panda_virtual_memory_rw((env), (addr), (uint8_t *)(ptr), sizeof(*(ptr)), 0)
+
 bool panda_flush_tb(void);
 
 void panda_do_flush_tb(void);
@@ -747,6 +770,20 @@ void panda_disable_llvm_helpers(void);
 void panda_enable_tb_chaining(void);
 void panda_disable_tb_chaining(void);
 void panda_memsavep(FILE *f);
+// Incremental dumps: panda_memsavep_track starts tracking writes to guest
+// RAM (call it right after a full panda_memsavep). panda_memsavep_dirty
+// then writes only the pages written since the last call to either: a
+// PANDA_MEMDELTA_MAGIC header, then (uint64_t physical address, page)
+// records, little-endian. It returns the number of pages written.
+// scripts/memdelta.py rebuilds full images from these.
+#define PANDA_MEMDELTA_MAGIC "PANDADLT"
+typedef struct {
+    char magic[8];
+    uint32_t version;       // 1
+    uint32_t page_size;
+} panda_memdelta_header;
+void panda_memsavep_track(void);
+uint64_t panda_memsavep_dirty(FILE *f);
 
 extern bool panda_update_pc;
 extern bool panda_use_memcb;
@@ -758,6 +795,26 @@ extern bool panda_tb_chaining;
 extern char panda_argv[MAX_PANDA_PLUGIN_ARGS][256];
 extern int panda_argc;
 
+// Callback profiling (-panda-profile). Dispatch loops start with
+// panda_cb_list_first; it and panda_cb_list_next time each callback,
+// inclusive of any callbacks it triggers. PPP_RUN_CB does the same for
+// plugin-to-plugin callbacks. Reported at exit and by the panda_profile
+// monitor command.
+extern bool panda_profiling;
+void panda_profile_begin(void);
+void panda_profile_unwind(void);
+int64_t panda_profile_ticks(void);
+void panda_profile_ppp(const char *cb_name, void *fn, int64_t start);
+void panda_profile_report(FILE *f, fprintf_function pr);
+void panda_profile_reset(void);
+
+static inline panda_cb_list *panda_cb_list_first(panda_cb_type type) {
+    if (__builtin_expect(panda_profiling, 0) && panda_cbs[type] != NULL) {
+        panda_profile_begin();
+    }
+    return panda_cbs[type];
+}
+
 
 // this stuff is used by the new qemu cmd-line arg '-os os_name'
 typedef enum OSTypeEnum { OST_UNKNOWN, OST_WINDOWS, OST_LINUX } PandaOsType;
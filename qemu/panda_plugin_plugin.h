@@ -2,7 +2,24 @@
 #ifndef __PANDA_PLUGIN_PLUGIN_H_
 #define __PANDA_PLUGIN_PLUGIN_H_
 
+#include <assert.h>
 #include <dlfcn.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Callback profiling for PPP_RUN_CB (see panda_plugin.h); declared here
+// too for plugins that use this header on its own.
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern bool panda_profiling;
+int64_t panda_profile_ticks(void);
+void panda_profile_ppp(const char *cb_name, void *fn, int64_t start);
+#ifdef __cplusplus
+}
+#endif
 
 /*
 
@@ -37,8 +54,94 @@ in the list at the right point.
 
 
 
-  
-#define PPP_MAX_CB 256
+
+/*
+  Registrations are kept by slot; what PPP_RUN_CB walks is a dense copy
+  rebuilt whenever a callback is added, so running skips no empty slots.
+  Callbacks registered with a filter (see PPP_CB_BOILERPLATE_FILTERED) are
+  kept apart from the rest and only run when their filter matches.
+*/
+
+#define PPP_FILTER_ASID 1   // asid equals filter.asid
+#define PPP_FILTER_PC   2   // filter.pc_start <= pc < filter.pc_end
+#define PPP_FILTER_NUM  4   // num (e.g. syscall number) equals filter.num
+
+typedef struct {
+  uint32_t flags;   // PPP_FILTER_*; 0 matches everything
+  uint64_t asid;
+  uint64_t pc_start;
+  uint64_t pc_end;
+  uint64_t num;
+} ppp_filter;
+
+typedef struct {
+  void *fn;
+  bool filtered;
+  ppp_filter filter;
+} ppp_cb_slot;
+
+typedef struct {
+  void **cb;              // unfiltered callbacks, in slot order
+  int num_cb;
+  void **fcb;             // filtered callbacks, in slot order
+  ppp_filter *filter;     // filter[i] goes with fcb[i]
+  int num_fcb;
+  bool any;               // anything registered at all
+  ppp_cb_slot *slots;     // every registration; NULL fn is an empty slot
+  int num_slots;
+} ppp_cb_list;
+
+static inline bool ppp_filter_match(const ppp_filter *f, uint64_t asid,
+                                    uint64_t pc, uint64_t num) {
+  if ((f->flags & PPP_FILTER_ASID) && f->asid != asid) return false;
+  if ((f->flags & PPP_FILTER_PC) && (pc < f->pc_start || pc >= f->pc_end)) return false;
+  if ((f->flags & PPP_FILTER_NUM) && f->num != num) return false;
+  return true;
+}
+
+// Callbacks may register more callbacks while PPP_RUN_CB is walking the
+// list, so the dense arrays are replaced rather than resized in place.
+static inline void ppp_cb_list_add(ppp_cb_list *l, void *fn, int slot_num,
+                                   const ppp_filter *filter) {
+  int i, n = 0, nf = 0;
+  assert (slot_num >= 0);
+  if (slot_num >= l->num_slots) {
+    l->slots = (ppp_cb_slot *) realloc(l->slots, (slot_num + 1) * sizeof(ppp_cb_slot));
+    assert (l->slots);
+    memset(l->slots + l->num_slots, 0, (slot_num + 1 - l->num_slots) * sizeof(ppp_cb_slot));
+    l->num_slots = slot_num + 1;
+  }
+  l->slots[slot_num].fn = fn;
+  l->slots[slot_num].filtered = (filter != NULL);
+  if (filter) l->slots[slot_num].filter = *filter;
+
+  void **cb = (void **) malloc(l->num_slots * sizeof(void *));
+  void **fcb = (void **) malloc(l->num_slots * sizeof(void *));
+  ppp_filter *flt = (ppp_filter *) malloc(l->num_slots * sizeof(ppp_filter));
+  assert (cb && fcb && flt);
+  for (i = 0; i < l->num_slots; i++) {
+    if (l->slots[i].fn == NULL) continue;
+    if (l->slots[i].filtered) {
+      fcb[nf] = l->slots[i].fn;
+      flt[nf] = l->slots[i].filter;
+      nf++;
+    }
+    else {
+      cb[n++] = l->slots[i].fn;
+    }
+  }
+  void **old_cb = l->cb, **old_fcb = l->fcb;
+  ppp_filter *old_flt = l->filter;
+  l->cb = cb;
+  l->fcb = fcb;
+  l->filter = flt;
+  l->num_cb = n;
+  l->num_fcb = nf;
+  l->any = (n + nf) > 0;
+  free(old_cb);
+  free(old_fcb);
+  free(old_flt);
+}
 
 
 // use this at head of A plugin
@@ -48,58 +151,106 @@ extern "C" { \
 void ppp_add_cb_##cb_name(cb_name##_t fptr) ;				\
 void ppp_add_cb_##cb_name##_slot(cb_name##_t fptr, int slot_num) ; \
 }
+#define PPP_PROT_REG_CB_FILTERED(cb_name) \
+PPP_PROT_REG_CB(cb_name) \
+extern "C" { \
+void ppp_add_cb_##cb_name##_filtered(cb_name##_t fptr, const ppp_filter *filter) ; \
+}
 #else
 #define PPP_PROT_REG_CB(cb_name) \
 void ppp_add_cb_##cb_name(cb_name##_t fptr) ;				\
 void ppp_add_cb_##cb_name##_slot(cb_name##_t fptr, int slot_num) ;
+#define PPP_PROT_REG_CB_FILTERED(cb_name) \
+PPP_PROT_REG_CB(cb_name) \
+void ppp_add_cb_##cb_name##_filtered(cb_name##_t fptr, const ppp_filter *filter) ;
 #endif
 
 /*
   employ this somewhere in the plugin near the top.
-  1. creates global array of fn pointers for this plugin
-  2. creates global int tracking the number of plugins
-  3. create fn for registering a callback
-  4. creates a fn for registering a callback in a particlular slot.  Since the
-  callbacks are in an array and we will call them in order, one may want to
-  take advantage of that fact by ordering them carefully.  However, be careful
-  as there isnt any attempt, here, to detect if you leave a slot empty
+  1. creates the global list of callbacks for this plugin
+  2. create fn for registering a callback
+  3. creates a fn for registering a callback in a particlular slot.  Since the
+  callbacks are run in slot order, one may want to take advantage of that
+  fact by ordering them carefully.  Registering in a slot already in use
+  replaces that callback; slots left empty are skipped.
 */
 
 #define PPP_CB_BOILERPLATE(cb_name)		\
-cb_name##_t ppp_##cb_name##_cb[PPP_MAX_CB];	\
-int ppp_##cb_name##_num_cb = 0;				\
+ppp_cb_list ppp_##cb_name##_cbs;				\
 							\
 void ppp_add_cb_##cb_name(cb_name##_t fptr) {			\
-  assert (ppp_##cb_name##_num_cb < PPP_MAX_CB);				\
-  ppp_##cb_name##_cb[ppp_##cb_name##_num_cb] = fptr;			\
-  ppp_##cb_name##_num_cb += 1;						\
+  ppp_cb_list_add(&ppp_##cb_name##_cbs, (void *) fptr,			\
+                  ppp_##cb_name##_cbs.num_slots, NULL);			\
 }									\
 									\
 void ppp_add_cb_##cb_name##_slot(cb_name##_t fptr, int slot_num) {	\
-  assert (slot_num < PPP_MAX_CB);					\
-  ppp_##cb_name##_cb[slot_num] = fptr;					\
-  ppp_##cb_name##_num_cb = MAX(slot_num, ppp_##cb_name##_num_cb);	\
-}									
+  ppp_cb_list_add(&ppp_##cb_name##_cbs, (void *) fptr, slot_num, NULL);	\
+}
+
+/*
+  Use this instead of PPP_CB_BOILERPLATE for callbacks that are run with
+  PPP_RUN_CB_FILTERED.  It adds a fn for registering a callback that only
+  runs when the ppp_filter it is registered with matches.
+*/
+
+#define PPP_CB_BOILERPLATE_FILTERED(cb_name)	\
+PPP_CB_BOILERPLATE(cb_name)			\
+							\
+void ppp_add_cb_##cb_name##_filtered(cb_name##_t fptr, const ppp_filter *filter) { \
+  ppp_cb_list_add(&ppp_##cb_name##_cbs, (void *) fptr,			\
+                  ppp_##cb_name##_cbs.num_slots, filter);		\
+}
 
 #define PPP_CB_EXTERN(cb_name) \
-extern cb_name##_t ppp_##cb_name##_cb[PPP_MAX_CB]; \
-extern int ppp_##cb_name##_num_cb;
+extern ppp_cb_list ppp_##cb_name##_cbs;
 
 /*
   And employ this where you want the callback functions to be called 
 */
- 
+
+#define PPP_CALL_CB(cb_name, fn, ...)                                   \
+  {                                                                     \
+    if (__builtin_expect(panda_profiling, 0)) {                         \
+      int64_t ppp_start = panda_profile_ticks();                        \
+      ((cb_name##_t) (fn))( __VA_ARGS__ ) ;                             \
+      panda_profile_ppp(#cb_name, (fn), ppp_start);                     \
+    }                                                                   \
+    else {                                                              \
+      ((cb_name##_t) (fn))( __VA_ARGS__ ) ;                             \
+    }                                                                   \
+  }
+
 #define PPP_RUN_CB(cb_name, ...)					\
   {									\
     int ppp_cb_ind;							\
-    for (ppp_cb_ind = 0; ppp_cb_ind < ppp_##cb_name##_num_cb; ppp_cb_ind++) { \
-      if (ppp_##cb_name##_cb[ppp_cb_ind] != NULL) {			\
-	ppp_##cb_name##_cb[ppp_cb_ind]( __VA_ARGS__ ) ;			\
+    for (ppp_cb_ind = 0; ppp_cb_ind < ppp_##cb_name##_cbs.num_cb; ppp_cb_ind++) { \
+      PPP_CALL_CB(cb_name, ppp_##cb_name##_cbs.cb[ppp_cb_ind], __VA_ARGS__); \
+    }									\
+  }
+
+/*
+  Like PPP_RUN_CB, but also runs the callbacks registered with a filter
+  whose filter matches asid, pc and num.  Those run after the unfiltered
+  ones.  asid, pc and num are only evaluated if there are any.
+*/
+
+#define PPP_RUN_CB_FILTERED(cb_name, asid, pc, num, ...)		\
+  {									\
+    PPP_RUN_CB(cb_name, __VA_ARGS__)					\
+    if (ppp_##cb_name##_cbs.num_fcb > 0) {				\
+      uint64_t ppp_asid = (asid), ppp_pc = (pc), ppp_num = (num);	\
+      int ppp_fcb_ind;							\
+      for (ppp_fcb_ind = 0; ppp_fcb_ind < ppp_##cb_name##_cbs.num_fcb; ppp_fcb_ind++) { \
+        if (ppp_filter_match(&ppp_##cb_name##_cbs.filter[ppp_fcb_ind], ppp_asid, ppp_pc, ppp_num)) { \
+          PPP_CALL_CB(cb_name, ppp_##cb_name##_cbs.fcb[ppp_fcb_ind], __VA_ARGS__); \
+        }								\
       }									\
     }									\
   }
 
-#define PPP_CHECK_CB(cb_name) (ppp_##cb_name##_num_cb > 0)
+// True if anything is registered; check it before doing work that only
+// matters to the callbacks (reading guest memory, copying arguments).
+#define PPP_CHECK_CB(cb_name) (ppp_##cb_name##_cbs.any)
 
 /****************************************************************
 This stuff gets used in "plugin B", i.e., the plugin that wants
@@ -122,6 +273,25 @@ to add a callback to be run inside of plugin A.
     add_cb (cb_func);							\
   }
 
+// Like PPP_REG_CB, but cb_func only runs when filter (a ppp_filter *)
+// matches.  Plugin A must have used PPP_CB_BOILERPLATE_FILTERED.
+#define PPP_REG_CB_FILTERED(other_plugin, cb_name, cb_func, filter)	\
+  {									\
+    dlerror();								\
+    void *op = panda_get_plugin_by_name("panda_" other_plugin ".so");	\
+    if (!op) {								\
+      printf("In trying to add plugin callback, couldn't load %s plugin\n", other_plugin); \
+      assert (op);							\
+    }									\
+    void (*add_cb)(cb_name##_t fptr, const ppp_filter *f) =		\
+      (void (*)(cb_name##_t, const ppp_filter *)) dlsym(op, "ppp_add_cb_" #cb_name "_filtered"); \
+    if (!add_cb) {							\
+      printf("%s plugin has no filtered %s callback\n", other_plugin, #cb_name); \
+      assert (add_cb != 0);						\
+    }									\
+    add_cb (cb_func, filter);						\
+  }
+
 
 
 
@@ -54,13 +54,13 @@ extern "C" {
 
 #include "callstack_instr_int_fns.h"
 
-PPP_PROT_REG_CB(on_call);
-PPP_PROT_REG_CB(on_ret);
+PPP_PROT_REG_CB_FILTERED(on_call);
+PPP_PROT_REG_CB_FILTERED(on_ret);
 
 }
 
-PPP_CB_BOILERPLATE(on_call);
-PPP_CB_BOILERPLATE(on_ret);
+PPP_CB_BOILERPLATE_FILTERED(on_call);
+PPP_CB_BOILERPLATE_FILTERED(on_ret);
 
 enum instr_type {
   INSTR_UNKNOWN = 0,
@@ -304,7 +304,7 @@ int before_block_exec(CPUState *env, TranslationBlock *tb) {
             //printf("Matched at depth %d\n", v.size()-i);
             //v.erase(v.begin()+i, v.end());
 
-            PPP_RUN_CB(on_ret, env, w[i]);
+            PPP_RUN_CB_FILTERED(on_ret, panda_current_asid(env), w[i], 0, env, w[i]);
             v.erase(v.begin()+i, v.end());
             w.erase(w.begin()+i, w.end());
 
@@ -329,7 +329,7 @@ int after_block_exec(CPUState *env, TranslationBlock *tb, TranslationBlock *next
         cpu_get_tb_cpu_state(env, &pc, &cs_base, &flags);
         function_stacks[get_stackid(env,tb->pc)].push_back(pc);
 
-        PPP_RUN_CB(on_call, env, pc);
+        PPP_RUN_CB_FILTERED(on_call, panda_current_asid(env), pc, 0, env, pc);
     }
     else if (tb_type == INSTR_RET) {
         //printf("Just executed a RET in TB " TARGET_FMT_lx "\n", tb->pc);
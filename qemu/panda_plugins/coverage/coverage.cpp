@@ -50,42 +50,187 @@ void uninit_plugin(void *);
 }
 
 #include <set>
+#include <map>
+#include <unordered_set>
+#include <vector>
+#include <string>
 
 const char *process_name;
 target_ulong process_asid=0;
 std::set<uint64_t> process_bb;
 uint64_t process_total_bb=0;
 
+// ASID we last saw, and whether it's the one we're collecting for. Only
+// recomputed (via OSI) when the ASID changes.
+target_ulong last_asid = (target_ulong) -1;
+bool in_process = false;
+
+// Edge mode: AFL-style hit counts, indexed by hash(prev block) ^ hash(block)
+bool edge_mode = false;
+uint8_t *edge_map = NULL;
+uint64_t edge_map_mask = 0;
+uint64_t prev_loc = 0;
+
+// Edge mode also keeps each block executed (start, size) for drcov. A
+// direct-mapped cache of recent pcs keeps the set off the fast path.
+#define SEEN_CACHE_SIZE 4096
+target_ulong seen_cache[SEEN_CACHE_SIZE];
+std::unordered_set<uint64_t> seen_blocks;
+
+// Modules of the process, by base, as seen on the way into it
+struct CoverageModule {
+    target_ulong size;
+    std::string path;
+};
+std::map<target_ulong,CoverageModule> modules;
+
+const char *bitmap_file;
+const char *drcov_file;
+
+static void update_modules(CPUState *env, OsiProc *p) {
+    OsiModules *ms = get_libraries(env, p);
+    if (!ms) return;
+    for (uint32_t i = 0; i < ms->num; i++) {
+        OsiModule *m = &ms->module[i];
+        const char *path = m->file ? m->file : m->name;
+        modules[m->base] = CoverageModule{m->size, path ? path : "[unknown]"};
+    }
+    free_osimodules(ms);
+}
+
+static bool is_process(OsiProc *p) {
+    return p && p->name && strcmp(process_name, p->name) == 0;
+}
+
+// Work out whether the new ASID belongs to the process we want
+static void coverage_asid_changed(CPUState *env, target_ulong asid) {
+    last_asid = asid;
+    // an edge doesn't span a context switch
+    prev_loc = 0;
+    if (process_name[0] == '\0') {
+        // mode=bb has never collected anything without a process
+        in_process = edge_mode;
+        return;
+    }
+    if (process_asid == 0) {
+        OsiProc *p = get_current_process(env);
+        if (is_process(p)) {
+            process_asid = asid;
+            printf ("coverage plugin: saw cr3=0x" TARGET_FMT_lx " for process=[%s]\n",
+                    asid, process_name);
+        }
+        free_osiproc(p);
+    }
+    in_process = (process_asid != 0 && process_asid == asid);
+    if (in_process && edge_mode) {
+        // OSI may still report the process we're switching away from
+        OsiProc *p = get_current_process(env);
+        if (is_process(p)) update_modules(env, p);
+        free_osiproc(p);
+    }
+}
+
 int coverage_before_block_exec(CPUState *env, TranslationBlock *tb) {
 #ifdef CONFIG_SOFTMMU
-    OsiProc *p = get_current_process(env);
-    uint64_t asid = panda_current_asid(env);    
-    if (process_asid == 0) {
-        // look for process matching the one we want
-        if (p && p->name) {
-            if (strcmp(process_name, p->name) == 0) {
-                process_asid = asid;
-                printf ("coverage plugin: saw cr3=0x%" PRIx64 " for process=[%s]\n",
-                        asid, process_name);
-            }
+    target_ulong asid = panda_current_asid(env);
+    if (unlikely(asid != last_asid)) coverage_asid_changed(env, asid);
+    if (!in_process) return 0;
+
+    if (edge_mode) {
+        uint64_t cur_loc = (tb->pc >> 4) ^ (tb->pc << 8);
+        edge_map[(cur_loc ^ prev_loc) & edge_map_mask]++;
+        prev_loc = cur_loc >> 1;
+
+        target_ulong *seen = &seen_cache[(tb->pc ^ (tb->pc >> 12)) % SEEN_CACHE_SIZE];
+        if (unlikely(*seen != tb->pc)) {
+            *seen = tb->pc;
+            seen_blocks.insert(((uint64_t)tb->pc << 16) | (tb->size & 0xffff));
         }
     }
-    if (process_asid !=0 && process_asid == asid) {
+    else {
         // collect bb for this asid
         process_bb.insert(tb->pc);
-        // and count number of bb executed (regardless of repetetion)
-        process_total_bb ++;
     }
-    free_osiproc(p);
+    // and count number of bb executed (regardless of repetetion)
+    process_total_bb ++;
 #endif
     return 0;
 }
 
+// drcov (DynamoRIO coverage) format, version 2, as read by lighthouse and
+// friends: a text header and module table, then one binary record per
+// block with its offset into its module.
+static void write_drcov(const char *fname) {
+    FILE *fp = fopen(fname, "wb");
+    if (!fp) {
+        printf ("coverage plugin: can't write %s\n", fname);
+        return;
+    }
+    std::map<target_ulong,uint16_t> mod_ids;
+    fprintf(fp, "DRCOV VERSION: 2\n");
+    fprintf(fp, "DRCOV FLAVOR: panda\n");
+    fprintf(fp, "Module Table: version 2, count %zu\n", modules.size());
+    fprintf(fp, "Columns: id, base, end, entry, checksum, timestamp, path\n");
+    for (auto &kvp : modules) {
+        uint16_t id = mod_ids.size();
+        mod_ids[kvp.first] = id;
+        fprintf(fp, "%3u, 0x%" PRIx64 ", 0x%" PRIx64 ", 0x0, 0x0, 0x0, %s\n", id,
+                (uint64_t)kvp.first, (uint64_t)kvp.first + kvp.second.size,
+                kvp.second.path.c_str());
+    }
+
+    struct __attribute__((packed)) {
+        uint32_t start;
+        uint16_t size;
+        uint16_t mod_id;
+    } bb;
+    std::vector<decltype(bb)> bbs;
+    uint64_t unmapped = 0;
+    for (uint64_t b : seen_blocks) {
+        target_ulong pc = b >> 16;
+        auto it = modules.upper_bound(pc);
+        if (it == modules.begin() || pc >= (--it)->first + it->second.size) {
+            unmapped++;
+            continue;
+        }
+        bb.start = pc - it->first;
+        bb.size = b & 0xffff;
+        bb.mod_id = mod_ids[it->first];
+        bbs.push_back(bb);
+    }
+    fprintf(fp, "BB Table: %zu bbs\n", bbs.size());
+    fwrite(bbs.data(), sizeof(bb), bbs.size(), fp);
+    fclose(fp);
+    printf ("coverage plugin: wrote %zu blocks in %zu modules to %s (%" PRIu64 " outside any module)\n",
+            bbs.size(), modules.size(), fname, unmapped);
+}
+
 bool init_plugin(void *self) {
 
     printf ("Initializing plugin coverage\n");
     panda_arg_list *args = panda_get_args("coverage");
     process_name = panda_parse_string(args, "process", "");
+    const char *mode = panda_parse_string(args, "mode", "bb");
+    if (strcmp(mode, "edge") == 0) {
+        edge_mode = true;
+    }
+    else if (strcmp(mode, "bb") != 0) {
+        printf ("coverage plugin: unknown mode %s, expected bb or edge\n", mode);
+        return false;
+    }
+    if (edge_mode) {
+        uint64_t map_size = panda_parse_uint64(args, "map_size", 1 << 16);
+        if (map_size == 0 || (map_size & (map_size - 1)) != 0) {
+            printf ("coverage plugin: map_size must be a power of two\n");
+            return false;
+        }
+        edge_map = (uint8_t *) calloc(map_size, 1);
+        edge_map_mask = map_size - 1;
+        bitmap_file = panda_parse_string(args, "bitmap", "coverage_bitmap.bin");
+        drcov_file = panda_parse_string(args, "drcov", "coverage.drcov");
+        // never a block's pc, so nothing starts out cached
+        memset(seen_cache, 0xff, sizeof(seen_cache));
+    }
     panda_require("osi");
     // this sets up OS introspection API
     assert(init_osi_api());
@@ -97,6 +242,21 @@ bool init_plugin(void *self) {
 
 void uninit_plugin(void *self) {
     printf ("coverage plugin: total sequential bb for process = %" PRIu64 "\n", process_total_bb);
+    if (edge_mode) {
+        uint64_t edges = 0;
+        for (uint64_t i = 0; i <= edge_map_mask; i++) edges += (edge_map[i] != 0);
+        printf ("coverage plugin: total unique bb for process = %zu\n", seen_blocks.size());
+        printf ("coverage plugin: %" PRIu64 " of %" PRIu64 " edge map entries hit\n",
+                edges, edge_map_mask + 1);
+        FILE *fp = fopen(bitmap_file, "wb");
+        if (fp) {
+            fwrite(edge_map, 1, edge_map_mask + 1, fp);
+            fclose(fp);
+        }
+        if (process_name[0] != '\0') write_drcov(drcov_file);
+        free(edge_map);
+        return;
+    }
     printf ("coverage plugin: total unique bb for process = %d\n", (int) (process_bb.size()));
     for ( auto pc : process_bb ) {
         printf ("coverage plugin:   bb 0x%" PRIx64 "\n", pc);
@@ -112,18 +112,8 @@ uint32_t last_open_asid;
 uint64_t file_pos = 0;
 
 uint32_t guest_strncpy(CPUState *env, char *buf, size_t maxlen, target_ulong guest_addr) {
-    buf[0] = 0;
-    unsigned i;
-    for (i=0; i<maxlen; i++) {
-        uint8_t c;
-        panda_virtual_memory_rw(env, guest_addr+i, &c, 1, 0);
-        buf[i] = c;
-        if (c==0) {
-            break;
-        }
-    }
-    buf[maxlen-1] = 0;
-    return i;
+    int n = panda_virtual_memory_read_string(env, guest_addr, buf, maxlen);
+    return n < 0 ? 0 : n;
 }
 
 uint32_t guest_wstrncpy(CPUState *env, char *buf, size_t maxlen, target_ulong guest_addr) {
@@ -94,6 +94,8 @@ bool init_plugin(void *self) {
     panda_require("win7proc");
     PPP_REG_CB("taint2", on_taint_change, taint_change);
     taint2_track_taint_state();
+    // taint queries logged to the pandalog include the taint compute number
+    taint2_track_tcn();
     return true;
 }
 
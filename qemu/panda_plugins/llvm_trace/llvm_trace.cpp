@@ -37,6 +37,7 @@ extern "C" {
 #include "panda_plugin.h"
 #include "panda_common.h"
 #include "tubtf.h"
+#include "rr_log.h"
 
 #ifndef CONFIG_SOFTMMU
 #include "syscall_defs.h"
@@ -148,7 +149,9 @@ int before_block_exec(CPUState *env, TranslationBlock *tb){
     uint32_t pc, unk;
     sscanf(llvm_fn_name, "tcg-llvm-tb-%d-%x", &unk, &pc);
     env->panda_guest_pc = pc;
-    tubtf_write_el_64(panda_current_asid(env), pc, TUBTFE_LLVM_FN, unk, panda_in_kernel(env), 0, 0);
+    // arg3 lets readers find blocks by guest instruction count
+    tubtf_write_el_64(panda_current_asid(env), pc, TUBTFE_LLVM_FN, unk, panda_in_kernel(env),
+        rr_get_guest_instr_count(), 0);
   }
   else {
     fprintf(funclog, "%s\n", tcg_llvm_get_func_name(tb));
@@ -288,7 +291,9 @@ bool init_plugin(void *self) {
     panda_arg_list *args = panda_get_args("llvm_trace");
     basedir = panda_parse_string(args, "base", "/tmp");
     tubtf_on = panda_parse_bool(args, "tubtf");
-    
+    bool columnar = panda_parse_bool(args, "columnar");
+    if (columnar) tubtf_on = 1;
+
     printf("llvm_trace using basedir=%s\n", basedir);
 
     if (tubtf_on) {
@@ -296,7 +301,8 @@ bool init_plugin(void *self) {
       char tubtf_path[256];
       strcpy(tubtf_path, basedir);
       strcat(tubtf_path, "/tubtf.log");
-      tubtf_open(tubtf_path, TUBTF_COLW_64);
+      if (columnar) tubtf_open_columnar(tubtf_path);
+      else tubtf_open(tubtf_path, TUBTF_COLW_64);
       panda_enable_precise_pc();
     }
     else {
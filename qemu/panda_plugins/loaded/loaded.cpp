@@ -77,18 +77,8 @@ void die(const char* fmt, ...) {
 }
 
 uint32_t guest_strncpy(CPUState *env, char *buf, size_t maxlen, target_ulong guest_addr) {
-    buf[0] = 0;
-    unsigned i;
-    for (i=0; i<maxlen; i++) {
-        uint8_t c;
-        panda_virtual_memory_rw(env, guest_addr+i, &c, 1, 0);
-        buf[i] = c;
-        if (c==0) {
-            break;
-        }
-    }
-    buf[maxlen-1] = 0;
-    return i;
+    int n = panda_virtual_memory_read_string(env, guest_addr, buf, maxlen);
+    return n < 0 ? 0 : n;
 }
 #if defined(TARGET_I386)
 void linux_mmap_pgoff_return(CPUState *env,target_ulong pc,uint32_t addr,uint32_t len,uint32_t prot,uint32_t flags,uint32_t fd,uint32_t pgoff) {
@@ -22,24 +22,61 @@ PANDAENDCOMMENT */
 #include "panda_plugin.h"
 
 #include <stdio.h>
+#include <inttypes.h>
 
 extern RR_log *rr_nondet_log;
 bool dump_done = false;
 
 static double percent = 0.0;
+static double step = 0.0;
+static bool incremental = false;
 static const char *filename = NULL;
+static FILE *index_file = NULL;
+static int dumps = 0;
 
 bool init_plugin(void *);
 void uninit_plugin(void *);
 
 int before_block_exec(CPUState *env, TranslationBlock *tb);
 
+// The first dump goes to filename, later ones to filename.N. In
+// incremental mode later dumps hold only the pages changed since the one
+// before, and filename.index lists them all in order.
+static void save_memory(void) {
+    char *name = dumps == 0 ? g_strdup(filename) :
+        g_strdup_printf("%s.%d", filename, dumps);
+    FILE *f = fopen(name, "wb");
+    if (!f) {
+        printf("memsavep: Couldn't open %s.\n", name);
+        g_free(name);
+        return;
+    }
+    if (incremental && dumps > 0) {
+        uint64_t pages = panda_memsavep_dirty(f);
+        printf("memsavep: Saving %" PRIu64 " changed pages to %s.\n", pages, name);
+    } else {
+        printf("memsavep: Saving memory to %s.\n", name);
+        panda_memsavep(f);
+        if (incremental) panda_memsavep_track();
+    }
+    fclose(f);
+    if (index_file) {
+        fprintf(index_file, "%" PRIu64 " %s\n", rr_get_guest_instr_count(), name);
+        fflush(index_file);
+    }
+    g_free(name);
+    dumps++;
+}
+
 int before_block_exec(CPUState *env, TranslationBlock *tb) {
     if (rr_get_percentage() > percent && !dump_done) {
-        printf("memsavep: Saving memory to %s.\n", filename);
-        panda_memsavep(fopen(filename, "wb"));
-        dump_done = true;
-        rr_end_replay_requested = 1;
+        save_memory();
+        if (step > 0 && percent + step < 100.0) {
+            percent += step;
+        } else {
+            dump_done = true;
+            rr_end_replay_requested = 1;
+        }
     }
     return 0;
 }
@@ -50,11 +87,20 @@ bool init_plugin(void *self) {
 
     panda_arg_list *args = panda_get_args("memsavep");
     percent = panda_parse_double(args, "percent", 0.0);
+    step = panda_parse_double(args, "step", 0.0);
+    incremental = panda_parse_bool(args, "incremental");
     filename = panda_parse_string(args, "file", "memsavep.raw");
 
+    if (incremental) {
+        char *index_name = g_strdup_printf("%s.index", filename);
+        index_file = fopen(index_name, "w");
+        g_free(index_name);
+        if (!index_file) return false;
+    }
+
     return true;
 }
 
 void uninit_plugin(void *self) {
-
+    if (index_file) fclose(index_file);
 }
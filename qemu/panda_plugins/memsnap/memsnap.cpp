@@ -18,6 +18,7 @@ PANDAENDCOMMENT */
 extern "C" {
 
 #include "config.h"
+#include "rr_log.h"
 #include "qemu-common.h"
 #include "monitor.h"
 #include "cpu.h"
@@ -52,6 +53,13 @@ std::set<prog_point> tap_points;
 
 bool done = false;
 
+// In incremental mode only the first snapshot is a full dump; later ones
+// (.delta) hold the pages changed since the snapshot before, and
+// memsnap.index lists them all in order.
+static bool incremental = false;
+static FILE *index_file = NULL;
+static bool first_snapshot = true;
+
 int mem_callback(CPUState *env, target_ulong pc, target_ulong addr,
                        target_ulong size, void *buf) {
     if(done) return 1;
@@ -63,11 +71,22 @@ int mem_callback(CPUState *env, target_ulong pc, target_ulong addr,
     if (tap_points.find(p) != tap_points.end()) {
         tap_points.erase(p);
         char path[256];
-        sprintf(path, TARGET_FMT_lx "." TARGET_FMT_lx "." TARGET_FMT_lx ".mem",
-            p.caller, p.pc, p.cr3);
+        bool delta = incremental && !first_snapshot;
+        sprintf(path, TARGET_FMT_lx "." TARGET_FMT_lx "." TARGET_FMT_lx ".%s",
+            p.caller, p.pc, p.cr3, delta ? "delta" : "mem");
         FILE *f = fopen(path, "wb");
-        panda_memsavep(f);
+        if (delta) {
+            panda_memsavep_dirty(f);
+        } else {
+            panda_memsavep(f);
+            if (incremental) panda_memsavep_track();
+        }
         fclose(f);
+        if (index_file) {
+            fprintf(index_file, "%" PRIu64 " %s\n", rr_get_guest_instr_count(), path);
+            fflush(index_file);
+        }
+        first_snapshot = false;
     }
     
     if (tap_points.empty()) done = true;
@@ -99,6 +118,13 @@ bool init_plugin(void *self) {
 
     if(!init_callstack_instr_api()) return false;
 
+    panda_arg_list *args = panda_get_args("memsnap");
+    incremental = panda_parse_bool(args, "incremental");
+    if (incremental) {
+        index_file = fopen("memsnap.index", "w");
+        if (!index_file) return false;
+    }
+
     panda_enable_precise_pc();
     panda_enable_memcb();    
     pcb.virt_mem_write = mem_callback;
@@ -110,5 +136,5 @@ bool init_plugin(void *self) {
 }
 
 void uninit_plugin(void *self) {
-
+    if (index_file) fclose(index_file);
 }
@@ -25,15 +25,21 @@ extern "C" {
 
 #include "panda_plugin.h"
 #include "rr_log.h"
+#include "panda/panda_writer.h"
 }
 
 #include <wctype.h>
 #include <zlib.h>
 #include <stdio.h>
+#include <stdarg.h>
 #include <stdlib.h>
 #include <ctype.h>
 #include <math.h>
 #include <map>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <unordered_map>
 
 // These need to be extern "C" so that the ABI is compatible with
 // QEMU/PANDA, which is written in C
@@ -58,19 +64,145 @@ struct ustring_pos {
     uint16_t ch[MAX_STRLEN];
 };
 
-std::map<target_ulong,string_pos> read_text_tracker;
-std::map<target_ulong,string_pos> write_text_tracker;
-std::map<target_ulong,ustring_pos> read_utext_tracker;
-std::map<target_ulong,ustring_pos> write_utext_tracker;
+struct text_tracker {
+    string_pos sp;
+    ustring_pos usp;
+};
+
+// Trackers for each (pc, read/write), found through an open addressing
+// table with linear probing.  Trackers are never removed.
+struct tracker_slot {
+    uint64_t key;
+    uint32_t idx;
+};
+#define TRACKER_EMPTY ((uint64_t) -1)
+
+std::vector<text_tracker> trackers;
+std::vector<uint64_t> tracker_keys;
+std::vector<tracker_slot> tracker_table(1024, tracker_slot{TRACKER_EMPTY, 0});
+
+static inline size_t tracker_hash(uint64_t key, size_t mask) {
+    return (key * 0x9E3779B97F4A7C15ULL >> 20) & mask;
+}
+
+static void tracker_grow(void) {
+    std::vector<tracker_slot> table(tracker_table.size() * 2, tracker_slot{TRACKER_EMPTY, 0});
+    size_t mask = table.size() - 1;
+    for (auto &slot : tracker_table) {
+        if (slot.key == TRACKER_EMPTY) continue;
+        size_t i = tracker_hash(slot.key, mask);
+        while (table[i].key != TRACKER_EMPTY) i = (i + 1) & mask;
+        table[i] = slot;
+    }
+    tracker_table.swap(table);
+}
+
+static text_tracker &get_tracker(target_ulong pc, bool is_write) {
+    uint64_t key = ((uint64_t) pc << 1) | is_write;
+    size_t mask = tracker_table.size() - 1;
+    size_t i = tracker_hash(key, mask);
+    while (tracker_table[i].key != TRACKER_EMPTY) {
+        if (tracker_table[i].key == key) {
+            return trackers[tracker_table[i].idx];
+        }
+        i = (i + 1) & mask;
+    }
+    if (2 * (trackers.size() + 1) > tracker_table.size()) {
+        tracker_grow();
+        return get_tracker(pc, is_write);
+    }
+    tracker_table[i].key = key;
+    tracker_table[i].idx = trackers.size();
+    trackers.push_back(text_tracker());
+    tracker_keys.push_back(key);
+    return trackers.back();
+}
+
+// Report lines go through a panda_writer, whose thread compresses them.
+struct report_writer {
+    gzFile fp;
+    PandaWriter *writer;
+} mem_report;
+
+// runs on the writer thread
+static void report_write_bytes(void *opaque, const void *data, size_t len) {
+    report_writer *w = (report_writer *) opaque;
+    gzwrite(w->fp, data, len);
+}
+
+static bool report_open(report_writer *w, const char *filename) {
+    w->fp = gzopen(filename, "w");
+    if (!w->fp) {
+        return false;
+    }
+    w->writer = panda_writer_new_bytes(report_write_bytes, w);
+    if (!w->writer) {
+        gzclose(w->fp);
+        return false;
+    }
+    return true;
+}
+
+static void report_line(report_writer *w, const char *fmt, ...) {
+    char line[64 + 4 * MAX_STRLEN];
+    va_list args;
+    va_start(args, fmt);
+    int n = vsnprintf(line, sizeof(line), fmt, args);
+    va_end(args);
+    if (n < 0) return;
+    panda_writer_append(w->writer, line, std::min((size_t) n, sizeof(line) - 1));
+}
+
+static void report_close(report_writer *w) {
+    panda_writer_close(w->writer);
+    gzclose(w->fp);
+}
+
+// With dedup, each distinct string is reported once, at the end, with the
+// instruction counts where it was first and last seen and how often.
+struct string_stats {
+    uint64_t first;
+    uint64_t last;
+    uint64_t hits;
+};
+std::unordered_map<std::string, string_stats> seen_strings;
 
-gzFile mem_report = NULL;
 int min_strlen;
+bool dedup;
+
+static void report_string(const char *str, int len) {
+    uint64_t instr = rr_get_guest_instr_count();
+    if (dedup) {
+        auto it = seen_strings.find(std::string(str, len));
+        if (it == seen_strings.end()) {
+            seen_strings.insert(std::make_pair(std::string(str, len), string_stats{instr, instr, 1}));
+        }
+        else {
+            it->second.last = instr;
+            it->second.hits++;
+        }
+    }
+    else {
+        report_line(&mem_report, "%llu:%.*s\n", (unsigned long long) instr, len, str);
+    }
+}
+
+static void report_ustring(ustring_pos &usp) {
+    gsize bytes_written = 0;
+    gchar *out_str = g_convert((gchar *)usp.ch, usp.nch*2,
+        "UTF-8", "UTF-16LE", NULL, &bytes_written, NULL);
+    if (out_str) {
+        report_string(out_str, bytes_written);
+    }
+    g_free(out_str);
+}
 
 int mem_callback(CPUState *env, target_ulong pc, target_ulong addr,
                        target_ulong size, void *buf, bool is_write) {
 
-    string_pos &sp = is_write ? write_text_tracker[pc] : read_text_tracker[pc];
-    ustring_pos &usp = is_write ? write_utext_tracker[pc] : read_utext_tracker[pc];
+    text_tracker &tracker = get_tracker(pc, is_write);
+    string_pos &sp = tracker.sp;
+    ustring_pos &usp = tracker.usp;
 
     // ASCII
     for (unsigned int i = 0; i < size; i++) {
@@ -79,14 +211,14 @@ int mem_callback(CPUState *env, target_ulong pc, target_ulong addr,
             sp.ch[sp.nch++] = val;
             // If we max out the string, chop it
             if (sp.nch == MAX_STRLEN - 1) {
-                gzprintf(mem_report, "%llu:%.*s\n", rr_get_guest_instr_count(), sp.nch, sp.ch);
+                report_string((char *)sp.ch, sp.nch);
                 sp.nch = 0;
             }
         }
         else {
             // Don't bother with strings shorter than min
             if (sp.nch >= min_strlen) {
-                gzprintf(mem_report, "%llu:%.*s\n", rr_get_guest_instr_count(), sp.nch, sp.ch);
+                report_string((char *)sp.ch, sp.nch);
             }
             sp.nch = 0;
         }
@@ -106,22 +238,14 @@ int mem_callback(CPUState *env, target_ulong pc, target_ulong addr,
             usp.ch[usp.nch++] = val;
             // If we max out the string, chop it
             if (usp.nch == MAX_STRLEN - 1) {
-                gsize bytes_written = 0;
-                gchar *out_str = g_convert((gchar *)usp.ch, usp.nch*2,
-                    "UTF-8", "UTF-16LE", NULL, &bytes_written, NULL);
-                gzprintf(mem_report, "%llu:%s\n", rr_get_guest_instr_count(), out_str);
-                g_free(out_str);
+                report_ustring(usp);
                 usp.nch = 0;
             }
         }
         else {
             // Don't bother with strings shorter than min
             if (usp.nch >= min_strlen) {
-                gsize bytes_written = 0;
-                gchar *out_str = g_convert((gchar *)usp.ch, usp.nch*2,
-                    "UTF-8", "UTF-16LE", NULL, &bytes_written, NULL);
-                gzprintf(mem_report, "%llu:%s\n", rr_get_guest_instr_count(), out_str);
-                g_free(out_str);
+                report_ustring(usp);
             }
             usp.nch = 0;
         }
@@ -150,11 +274,11 @@ bool init_plugin(void *self) {
 
     const char *prefix = panda_parse_string(args, "name", "memstrings");
     min_strlen = panda_parse_ulong(args, "len", 4);
+    dedup = panda_parse_bool(args, "dedup");
 
     char matchfile[128] = {};
     sprintf(matchfile, "%s_strings.txt.gz", prefix);
-    mem_report = gzopen(matchfile, "w");
-    if(!mem_report) {
+    if(!report_open(&mem_report, matchfile)) {
         printf("Couldn't write report:\n");
         perror("fopen");
         return false;
@@ -174,35 +298,41 @@ bool init_plugin(void *self) {
 }
 
 void uninit_plugin(void *self) {
-    // Save any that we haven't flushed yet
-    for (auto &kvp : read_text_tracker) {
-        if (kvp.second.nch > min_strlen) {
-            gzprintf(mem_report, "%llu:%.*s\n", rr_get_guest_instr_count(), kvp.second.nch, kvp.second.ch);
+    // Save any that we haven't flushed yet, reads before writes
+    for (int is_write = 0; is_write < 2; is_write++) {
+        for (size_t i = 0; i < trackers.size(); i++) {
+            string_pos &sp = trackers[i].sp;
+            if ((tracker_keys[i] & 1) == (uint64_t) is_write && sp.nch > min_strlen) {
+                report_string((char *)sp.ch, sp.nch);
+            }
         }
     }
-    for (auto &kvp : write_text_tracker) {
-        if (kvp.second.nch > min_strlen) {
-            gzprintf(mem_report, "%llu:%.*s\n", rr_get_guest_instr_count(), kvp.second.nch, kvp.second.ch);
+    for (int is_write = 0; is_write < 2; is_write++) {
+        for (size_t i = 0; i < trackers.size(); i++) {
+            ustring_pos &usp = trackers[i].usp;
+            if ((tracker_keys[i] & 1) == (uint64_t) is_write && usp.nch > min_strlen) {
+                report_ustring(usp);
+            }
         }
     }
-    for (auto &kvp : read_utext_tracker) {
-        if (kvp.second.nch > min_strlen) {
-            gsize bytes_written = 0;
-            gchar *out_str = g_convert((gchar *)kvp.second.ch, kvp.second.nch*2,
-                "UTF-8", "UTF-16LE", NULL, &bytes_written, NULL);
-            gzprintf(mem_report, "%llu:%s\n", rr_get_guest_instr_count(), out_str);
-            g_free(out_str);
+
+    if (dedup) {
+        std::vector<std::pair<const std::string *, string_stats>> strings;
+        strings.reserve(seen_strings.size());
+        for (auto &kvp : seen_strings) {
+            strings.push_back(std::make_pair(&kvp.first, kvp.second));
         }
-    }
-    for (auto &kvp : write_utext_tracker) {
-        if (kvp.second.nch > min_strlen) {
-            gsize bytes_written = 0;
-            gchar *out_str = g_convert((gchar *)kvp.second.ch, kvp.second.nch*2,
-                "UTF-8", "UTF-16LE", NULL, &bytes_written, NULL);
-            gzprintf(mem_report, "%llu:%s\n", rr_get_guest_instr_count(), out_str);
-            g_free(out_str);
+        std::sort(strings.begin(), strings.end(),
+            [](const std::pair<const std::string *, string_stats> &a,
+               const std::pair<const std::string *, string_stats> &b) {
+                return a.second.first < b.second.first;
+            });
+        for (auto &s : strings) {
+            report_line(&mem_report, "%llu:%llu:%llu:%.*s\n",
+                (unsigned long long) s.second.first, (unsigned long long) s.second.last,
+                (unsigned long long) s.second.hits, (int) s.first->size(), s.first->data());
         }
     }
 
-    gzclose(mem_report);
+    report_close(&mem_report);
 }
@@ -23,12 +23,19 @@ extern "C" {
 
 #include "panda_plugin.h"
 #include "panda/network.h"
+#include "panda/panda_writer.h"
+#include "panda_plugin_plugin.h"
+
+#include "network.h"
 
 }
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
 #include <pcap/pcap.h>
+#include <zlib.h>
 
 extern "C" {
 
@@ -38,63 +45,137 @@ void uninit_plugin(void *);
 int handle_packet(CPUState *env, uint8_t *buf, int size, uint8_t direction,
     uint64_t old_buf_addr);
 
+PPP_PROT_REG_CB(on_packet);
+
 }
 
+PPP_CB_BOILERPLATE(on_packet);
+
 panda_arg_list *args;
-pcap_dumper_t *plugin_log;
-
-// RW Yanked from net.c
-static void hex_dump(FILE *f, const uint8_t *buf, int size)
-{
-    int len, i, j, c;
-
-    for(i=0;i<size;i+=16) {
-        len = size - i;
-        if (len > 16)
-            len = 16;
-        fprintf(f, "%08x ", i);
-        for(j=0;j<16;j++) {
-            if (j < len)
-                fprintf(f, " %02x", buf[i+j]);
-            else
-                fprintf(f, "   ");
-        }
-        fprintf(f, " ");
-        for(j=0;j<len;j++) {
-            c = buf[i+j];
-            if (c < ' ' || c > '~')
-                c = '.';
-            fprintf(f, "%c", c);
-        }
-        fprintf(f, "\n");
+
+// Compiled capture filter; unset if no filter was given.
+pcap_t *pcap_handle;
+struct bpf_program filter_prog;
+bool have_filter;
+
+// Packets are written in pcap format through a panda_writer, whose thread
+// compresses them if asked to.
+#define SNAPLEN 65535
+
+struct pcap_file_header_le {
+    uint32_t magic;
+    uint16_t version_major;
+    uint16_t version_minor;
+    int32_t thiszone;
+    uint32_t sigfigs;
+    uint32_t snaplen;
+    uint32_t linktype;
+};
+
+// struct pcap_pkthdr has a struct timeval, which isn't 32 bits everywhere.
+struct pcap_record_header {
+    uint32_t ts_sec;
+    uint32_t ts_usec;
+    uint32_t caplen;
+    uint32_t len;
+};
+
+struct pcap_writer {
+    FILE *fp;
+    gzFile gz;
+    PandaWriter *writer;
+} plugin_log;
+
+bool logging;
+uint64_t packets_seen, packets_logged;
+
+// runs on the writer thread
+static void log_write_bytes(void *opaque, const void *data, size_t len) {
+    pcap_writer *w = (pcap_writer *) opaque;
+    if (w->gz) {
+        gzwrite(w->gz, data, len);
     }
+    else {
+        fwrite(data, 1, len, w->fp);
+    }
+}
+
+static bool log_open(pcap_writer *w, const char *filename, bool compress) {
+    w->fp = NULL;
+    w->gz = NULL;
+    if (compress) {
+        w->gz = gzopen(filename, "wb");
+        if (!w->gz) return false;
+    }
+    else {
+        w->fp = fopen(filename, "wb");
+        if (!w->fp) return false;
+    }
+    w->writer = panda_writer_new_bytes(log_write_bytes, w);
+    if (!w->writer) {
+        if (w->gz) gzclose(w->gz);
+        else fclose(w->fp);
+        return false;
+    }
+
+    pcap_file_header_le fh = {};
+    fh.magic = 0xa1b2c3d4;
+    fh.version_major = 2;
+    fh.version_minor = 4;
+    fh.snaplen = SNAPLEN;
+    fh.linktype = DLT_EN10MB;
+    panda_writer_append(w->writer, &fh, sizeof(fh));
+    return true;
+}
+
+static void log_write(pcap_writer *w, const uint8_t *buf, int size) {
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    pcap_record_header rh;
+    rh.ts_sec = tv.tv_sec;
+    rh.ts_usec = tv.tv_usec;
+    rh.caplen = size < SNAPLEN ? size : SNAPLEN;
+    rh.len = size;
+    panda_writer_append(w->writer, &rh, sizeof(rh));
+    panda_writer_append(w->writer, buf, rh.caplen);
+}
+
+static void log_close(pcap_writer *w) {
+    panda_writer_close(w->writer);
+    if (w->gz) gzclose(w->gz);
+    else fclose(w->fp);
 }
 
 bool init_plugin(void *self) {
     panda_cb pcb;
 
-    int i;
-    char *tblog_filename = NULL;
     args = panda_get_args("network");
-    if (args != NULL) {
-        for (i = 0; i < args->nargs; i++) {
-            // Format is sample:file=<file>
-            if (0 == strncmp(args->list[i].key, "file", 4)) {
-                tblog_filename = args->list[i].value;
-            }
+    const char *filename = panda_parse_string(args, "file", NULL);
+    const char *filter = panda_parse_string(args, "filter", NULL);
+    bool compress = panda_parse_bool(args, "compress");
+
+    if (filter) {
+        pcap_handle = pcap_open_dead(DLT_EN10MB, SNAPLEN);
+        if (pcap_compile(pcap_handle, &filter_prog, filter, 1,
+                    PCAP_NETMASK_UNKNOWN) != 0) {
+            fprintf(stderr, "network: bad filter '%s': %s\n", filter,
+                    pcap_geterr(pcap_handle));
+            pcap_close(pcap_handle);
+            return false;
         }
+        have_filter = true;
     }
 
-    if (!tblog_filename) {
-        fprintf(stderr, "Plugin 'network' needs argument: -panda-arg network:file=<file>\n");
-        return false;
+    // Without a file, the plugin only hands packets to other plugins
+    // through on_packet.
+    if (filename) {
+        if (!log_open(&plugin_log, filename, compress)) {
+            fprintf(stderr, "network: couldn't open %s\n", filename);
+            return false;
+        }
+        logging = true;
     }
 
-    pcap_t *p = pcap_open_dead(DLT_EN10MB, 65535);
-    pcap_activate(p);
-    plugin_log = pcap_dump_open(p, tblog_filename);
-    if(!plugin_log) return false;
-
     pcb.replay_handle_packet = handle_packet;
     panda_register_callback(self, PANDA_CB_REPLAY_HANDLE_PACKET, pcb);
     
@@ -103,31 +184,35 @@ bool init_plugin(void *self) {
 
 void uninit_plugin(void *self) {
     printf("Unloading network plugin.\n");
+    printf("network: %" PRIu64 " packets, %" PRIu64 " passed the filter\n",
+            packets_seen, packets_logged);
     panda_free_args(args);
-    pcap_dump_close(plugin_log);
+    if (logging) {
+        log_close(&plugin_log);
+    }
+    if (have_filter) {
+        pcap_freecode(&filter_prog);
+        pcap_close(pcap_handle);
+    }
 }
 
 int handle_packet(CPUState *env, uint8_t *buf, int size, uint8_t direction,
         uint64_t old_buf_addr){
-//    switch (direction){
-//        case PANDA_NET_RX:
-//            fprintf(plugin_log, "RX:\n");
-//            break;
-//        case PANDA_NET_TX:
-//            fprintf(plugin_log, "TX:\n");
-//            break;
-//        default:
-//            assert(0);
-//            break;
-//    }
-//    hex_dump(plugin_log, buf, size);
-//    fprintf(plugin_log, "\n");
-    struct pcap_pkthdr h = {};
-    gettimeofday(&h.ts, NULL);
-    h.caplen = size;
-    h.len = size;
-    pcap_dump((u_char *)plugin_log, &h, buf);
+    packets_seen++;
+    if (have_filter) {
+        struct pcap_pkthdr h = {};
+        h.caplen = size < SNAPLEN ? size : SNAPLEN;
+        h.len = size;
+        if (!pcap_offline_filter(&filter_prog, &h, buf)) {
+            return 0;
+        }
+    }
+    packets_logged++;
+
+    if (logging) {
+        log_write(&plugin_log, buf, size);
+    }
+    PPP_RUN_CB(on_packet, env, buf, size, direction, old_buf_addr);
 
     return 0;
 }
-
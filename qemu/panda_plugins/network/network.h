@@ -0,0 +1,9 @@
+#ifndef __NETWORK_H
+#define __NETWORK_H
+
+// Called for each packet the replay delivers (or sends) that passes the
+// plugin's filter. direction is PANDA_NET_RX or PANDA_NET_TX.
+typedef void (* on_packet_t)(CPUState *env, uint8_t *buf, int size,
+    uint8_t direction, uint64_t old_buf_addr);
+
+#endif
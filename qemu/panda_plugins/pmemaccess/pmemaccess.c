@@ -18,18 +18,6 @@
 #define PLUGIN_ARG_COMMAND_KEY "command"
 #define PLUGIN_ARG_MODE_KEY "mode"
 
-typedef enum {
-  REQ_QUIT,
-  REQ_READ,
-  REQ_WRITE
-} req_type_t;
-
-struct request{
-  uint8_t type;      // 0 quit, 1 read, 2 write, ... rest reserved
-  uint64_t address;  // address to read from OR write to
-  uint64_t length;   // number of bytes to read OR write
-};
-
 // Prototypes
 bool init_plugin(void *self);
 bool uninit_plugin(void *self);
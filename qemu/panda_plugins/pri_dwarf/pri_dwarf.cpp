@@ -81,6 +81,7 @@ void on_global_livevar_iter(CPUState *env, target_ulong pc, liveVarCB f, void *a
 const char *guest_debug_path = NULL;
 const char *host_debug_path = NULL;
 const char *proc_to_monitor = NULL;
+const char *cache_dir = NULL;
 #if defined(TARGET_I386) && !defined(TARGET_X86_64)
 // These need to be extern "C" so that the ABI is compatible with
 // QEMU/PANDA, which is written in C
@@ -96,6 +97,7 @@ PPP_CB_BOILERPLATE(on_pri_dwarf_line_change);
 #include <map>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <algorithm>
 //#include <boost/algorithm/string/join.hpp>
 #define MAX_FILENAME 256
@@ -174,7 +176,6 @@ typedef struct LineRange {
         lowpc(lowpc), highpc(highpc), function_addr(function_addr),
         filename(filename), line_number(line_number), line_off(line_off) {}
 } LineRange;
-std::vector<LineRange> line_range_list;
 std::vector<LineRange> fn_start_line_range_list;
 std::map<std::string, LineRange> fn_name_to_line_info;
 
@@ -188,7 +189,7 @@ std::map<Dwarf_Addr,std::pair<Dwarf_Locdesc**, Dwarf_Signed>> funct_to_framepoin
 bool sortRange(const LineRange &x1,
                const LineRange &x2){
     return x1.lowpc < x2.lowpc ||
-           x1.highpc < x2.highpc;
+           (x1.lowpc == x2.lowpc && x1.highpc < x2.highpc);
 }
 
 struct CompareRangeAndPC
@@ -203,6 +204,66 @@ struct CompareRangeAndPC
             return ln_info.lowpc < pc;
     }
 };
+
+// Line ranges of one loaded module, rebased to where it is mapped.  Modules
+// don't overlap in the monitored process, so a pc only has to be searched
+// for in the lines of the module that contains it.
+struct LineTable {
+    Dwarf_Addr lowpc, highpc;
+    std::vector<LineRange> lines;
+};
+// keyed by highpc, so upper_bound(pc) is the only candidate
+std::map<Dwarf_Addr, LineTable> line_tables;
+// .plt entries of functions we have line info for (lowpc == highpc)
+std::map<Dwarf_Addr, LineRange> plt_lines;
+// lines of the instructions translate_callback_dwarf instrumented
+std::unordered_map<target_ulong, LineRange> line_boundaries;
+
+const LineRange *find_line(Dwarf_Addr pc) {
+    auto mod = line_tables.upper_bound(pc);
+    if (mod != line_tables.end() && pc >= mod->second.lowpc) {
+        const std::vector<LineRange> &lines = mod->second.lines;
+        auto it = std::lower_bound(lines.begin(), lines.end(), pc, CompareRangeAndPC());
+        if (it != lines.end() && pc >= it->lowpc)
+            return &*it;
+    }
+    auto plt = plt_lines.find(pc);
+    if (plt != plt_lines.end())
+        return &plt->second;
+    return NULL;
+}
+
+// Everything we keep from a module's DWARF, at link-time addresses, so that
+// it can be cached by build-id and installed at whatever base it is loaded.
+struct ModLoc {
+    Dwarf_Addr lopc, hipc;
+    std::vector<Dwarf_Loc> ops;
+};
+struct ModVar {
+    std::string name;
+    Dwarf_Off die_off;
+    std::vector<ModLoc> locs;
+};
+struct ModFunc {
+    std::string name;
+    Dwarf_Addr lowpc, highpc;
+    bool has_fp;
+    std::vector<ModLoc> fp;
+    std::vector<ModVar> vars;
+};
+struct ModLine {
+    Dwarf_Addr lowpc, highpc;
+    Dwarf_Unsigned line_number, line_off;
+    uint32_t file;      // index into files
+    int32_t func;       // index into funcs, -1 if not in a function
+};
+struct ModuleInfo {
+    std::vector<std::string> files;
+    std::vector<ModLine> lines;     // sorted by lowpc
+    std::vector<ModFunc> funcs;
+    std::vector<ModVar> globals;
+};
+
 /*
     required string file_callee = 1;
     required string function_name_callee = 2;
@@ -309,16 +370,21 @@ static bool elf_check_ehdr(struct elfhdr *ehdr)
             && (ehdr->e_type == ET_EXEC || ehdr->e_type == ET_DYN));
 }
 
-uint64_t elf_get_baseaddr(const char *fname, const char *basename, target_ulong actual_base_address) {
+// Also returns the end of the highest PT_LOAD segment in *load_end and the
+// hex .note.gnu.build-id (empty if there is none) in *build_id.
+uint64_t elf_get_baseaddr(const char *fname, const char *basename, target_ulong actual_base_address,
+        uint64_t *load_end, std::string *build_id) {
     // XXX: note: byte swapping omitted
     // XXX: 64-bit support omitted. Mess with ELFCLASS
     struct elfhdr ehdr;
     struct elf_phdr *phdr;
     struct elf_shdr *shdr;
     uint16_t shstrndx;
-    uint32_t load_addr, loaddr, hiaddr;
+    uint32_t load_addr, loaddr, hiaddr = 0;
     int i, retval;
 
+    *load_end = 0;
+
     FILE *f = fopen(fname, "rb");
     if (0 == fread(&ehdr, sizeof(ehdr), 1, f)){
         printf("Read 0 bytes from file\n");
@@ -401,6 +467,23 @@ uint64_t elf_get_baseaddr(const char *fname, const char *basename, target_ulong
                 return -1;
             }
         }
+        else if (strcmp(".note.gnu.build-id", &shstrtable[shdr[i].sh_name]) == 0){
+            uint8_t *note = (uint8_t *) malloc(shdr[i].sh_size);
+            fseek(f, shdr[i].sh_offset, SEEK_SET);
+            if (shdr[i].sh_size == fread(note, 1, shdr[i].sh_size, f) && shdr[i].sh_size >= sizeof(Elf32_Nhdr)){
+                Elf32_Nhdr *nhdr = (Elf32_Nhdr *) note;
+                uint32_t desc_off = sizeof(Elf32_Nhdr) + ((nhdr->n_namesz + 3) & ~3);
+                if (nhdr->n_type == 3 /* NT_GNU_BUILD_ID */ &&
+                        desc_off + nhdr->n_descsz <= shdr[i].sh_size){
+                    char hex[3];
+                    for (uint32_t j = 0; j < nhdr->n_descsz; j++){
+                        sprintf(hex, "%02x", note[desc_off+j]);
+                        *build_id += hex;
+                    }
+                }
+            }
+            free(note);
+        }
         else if (strcmp(".rel.plt", &shstrtable[shdr[i].sh_name]) == 0){
             //printf("got .rel.plt\n");
             relplt = (Elf32_Rel *) malloc(shdr[i].sh_size);
@@ -447,6 +530,7 @@ uint64_t elf_get_baseaddr(const char *fname, const char *basename, target_ulong
     }
     // load address is the low addr
     load_addr = loaddr;
+    *load_end = hiaddr;
     bool norelro = (actual_base_address == 0 || load_addr == actual_base_address);
     //printf("load addr: 0x%x\n", load_addr);
     // check if there is a .plt and a dynamic str table
@@ -472,16 +556,14 @@ uint64_t elf_get_baseaddr(const char *fname, const char *basename, target_ulong
         auto it = fn_name_to_line_info.find(plt_fun_name);
         if (it != fn_name_to_line_info.end()){
             const LineRange &lr = it->second;
-            line_range_list.push_back(LineRange(plt_fun_addr, plt_fun_addr,
-                        lr.line_number, lr.filename, lr.function_addr, lr.line_off));
+            plt_lines.insert(std::make_pair(plt_fun_addr, LineRange(plt_fun_addr, plt_fun_addr,
+                        lr.line_number, lr.filename, lr.function_addr, lr.line_off)));
         }
         else {
             dynl_functions[std::string(basename) + ":plt!" + plt_fun_name] = plt_fun_addr;
             addr_to_dynl_function[plt_fun_addr] = "plt!" + plt_fun_name;
         }
     }
-    // sort the line_range_list because we changed it
-    std::sort(line_range_list.begin(), line_range_list.end(), sortRange);
 
     return load_addr;
 }
@@ -671,12 +753,25 @@ std::string getNameFromDie(Dwarf_Die the_die){
 void __dwarf_type_iter (CPUState *env, target_ulong base_addr, LocType loc_t, Dwarf_Debug dbg,
         Dwarf_Die the_die, std::string astnodename, dwarfTypeCB cb, int recursion_level);
 
+// Variable DIEs are found by offset the first time they are needed, so
+// modules loaded from the line table cache never walk their DIE trees.
+static Dwarf_Die var_type_die(DwarfVarType *var_ty){
+    Dwarf_Error err;
+    if (var_ty->var_die == NULL &&
+            dwarf_offdie(var_ty->dbg, var_ty->var_off, &var_ty->var_die, &err) != DW_DLV_OK){
+        var_ty->var_die = NULL;
+    }
+    return var_ty->var_die;
+}
+
 void dwarf_type_iter (CPUState *env, target_ulong base_addr, LocType loc_t, DwarfVarType *var_ty, dwarfTypeCB cb,
         int recursion_level){
     Dwarf_Error err;
     int rc;
     Dwarf_Debug dbg = var_ty->dbg;
-    Dwarf_Die the_die = var_ty->var_die;
+    Dwarf_Die the_die = var_type_die(var_ty);
+    if (the_die == NULL)
+        return;
     Dwarf_Unsigned dec_line;
     rc = dwarf_get_attr_unsigned(the_die, DW_AT_decl_line, &dec_line, &err);
     if (rc != DW_DLV_OK)
@@ -950,7 +1045,9 @@ const char *dwarf_type_to_string ( DwarfVarType *var_ty ){
     Dwarf_Die cur_die;
     std::string type_name;
     Dwarf_Debug dbg = var_ty->dbg;
-    Dwarf_Die the_die = var_ty->var_die;
+    Dwarf_Die the_die = var_type_die(var_ty);
+    if (the_die == NULL)
+        return "?";
 
     rc = dwarf_diename(the_die, &die_name, &err);
 
@@ -1074,17 +1171,18 @@ const char *dwarf_type_to_string ( DwarfVarType *var_ty ){
     return type_name.c_str();
 }
 
-// Copies the location list for a particular attrbibute to locdesclist_copy in order to use the location information
+// Copies the location list for a particular attrbibute to locs in order to use the location information
 // at future points in the program
 // From what I have observed, attr must be either DW_AT_location or DW_AT_frame_base, but it could theoretically be
 // any attribute that represents a location list
-// relocates the address range for DW_OP_ADDRs and the "live ranges" for each variable
-int get_die_loc_info(Dwarf_Debug dbg, Dwarf_Die the_die, Dwarf_Half attr, Dwarf_Locdesc ***locdesclist_out, Dwarf_Signed *loccnt, uint64_t base_address, uint64_t cu_base_address,bool needs_reloc) {
+// adds the CU base address to the "live ranges"; relocation to the module's load address happens in install_locs
+int get_die_loc_info(Dwarf_Debug dbg, Dwarf_Die the_die, Dwarf_Half attr, std::vector<ModLoc> &locs, uint64_t cu_base_address) {
     Dwarf_Error err;
     Dwarf_Bool hasLocation;
     Dwarf_Attribute locationAttr;
     Dwarf_Locdesc **locdesclist;
-    int i, j;
+    Dwarf_Signed loccnt;
+    int i;
 
 
     if (dwarf_hasattr(the_die, attr, &hasLocation, &err) != DW_DLV_OK)
@@ -1094,7 +1192,7 @@ int get_die_loc_info(Dwarf_Debug dbg, Dwarf_Die the_die, Dwarf_Half attr, Dwarf_
             die("Error obtaining location attr\n");
         // dwarf_formexprloc(attr, expr_len, block_ptr, &err);
         // this is slow, figure out a faster way to get the location information
-        else if (dwarf_loclist_n(locationAttr, &locdesclist, loccnt, &err) != DW_DLV_OK){
+        else if (dwarf_loclist_n(locationAttr, &locdesclist, &loccnt, &err) != DW_DLV_OK){
             char *die_name = 0;
             if (dwarf_diename(the_die, &die_name, &err) != DW_DLV_OK){
                 die("Not able to get location list for var without a name.  Probably optimized out\n");
@@ -1104,47 +1202,21 @@ int get_die_loc_info(Dwarf_Debug dbg, Dwarf_Die the_die, Dwarf_Half attr, Dwarf_
             }
         }
         else {
-            *locdesclist_out = locdesclist;
-            //*locdesclist_out = (Dwarf_Locdesc **) malloc(sizeof(Dwarf_Locdesc *)*(*loccnt));
-            //printf("Variable locs: %llu [", *loccnt);
-            for (i = 0; i < *loccnt; i++){
-                // copy data to new malloc locdesc that won't be dealloc'd in dwarf cleanup function
-                //Dwarf_Locdesc *locdesc_copy = (Dwarf_Locdesc *) malloc(sizeof(Dwarf_Locdesc));
-                //memcpy(locdesc_copy, locdesclist[i], sizeof(Dwarf_Locdesc));
-                //Dwarf_Loc *loc_recs = (Dwarf_Loc *) malloc(locdesclist[i]->ld_cents*sizeof(Dwarf_Loc));
-                //memcpy(loc_recs, locdesclist[i]->ld_s, locdesclist[i]->ld_cents*sizeof(Dwarf_Loc));
-                //(*locdesclist_out)[i] = locdesc_copy;
-                //(*locdesclist_out)[i]->ld_s = loc_recs;
-
-                // patch lo and hi address in locdesc structure
-                // for variable "liveness" - this is a different usage of word live than typical uses
-                // live in this context means that the value at the location of the variable
-                // represents the actual value of the variable
-                // if lo = 0 and hi = 0xffffffff then variable is "live" for total scope of function
-                // if hipc and lopc both equal 0 than object has been optimized out
-                // if hi is 0xffffffff and lo does't equal 0 then this will add base address to hi
-                // im basically assuming that hi will not be 0xffffffff unless the variable is
-                // live for all scope of program
-                if ((Dwarf_Addr) -1 != (*locdesclist_out)[i]->ld_hipc){
-                    if (needs_reloc){
-                        (*locdesclist_out)[i]->ld_lopc += base_address;
-                        (*locdesclist_out)[i]->ld_hipc += base_address;
-                        for (j = 0; j < (*locdesclist_out)[i]->ld_cents; j++){
-                            if ((*locdesclist_out)[i]->ld_s[j].lr_atom == DW_OP_addr)
-                                (*locdesclist_out)[i]->ld_s[j].lr_number += base_address;
-                        }
-                    }
-                    // we also have to add the CU base address for address ranges, but not for any other relocation.  Weird
-                    (*locdesclist_out)[i]->ld_lopc += cu_base_address;
-                    (*locdesclist_out)[i]->ld_hipc += cu_base_address;
+            locs.resize(loccnt);
+            for (i = 0; i < loccnt; i++){
+                ModLoc &loc = locs[i];
+                loc.lopc = locdesclist[i]->ld_lopc;
+                loc.hipc = locdesclist[i]->ld_hipc;
+                loc.ops.assign(locdesclist[i]->ld_s, locdesclist[i]->ld_s + locdesclist[i]->ld_cents);
+                // we also have to add the CU base address for address ranges, but not for any other relocation.  Weird
+                if ((Dwarf_Addr) -1 != loc.hipc){
+                    loc.lopc += cu_base_address;
+                    loc.hipc += cu_base_address;
                 }
-                //printf("{ %llx-%llx ", (*locdesclist_out)[i]->ld_lopc, (*locdesclist_out)[i]->ld_hipc);
-                // dwarf_formexprloc(attr, exprnlen, block_ptr,err)
-                //load_section(dbg, locdesclist[i]->ld_section_offset, &elem_loc_expr, &err);
-                //process_dwarf_locs((*locdesclist_out)[i]->ld_s, (*locdesclist_out)[i]->ld_cents);
-                //printf("}");
+                dwarf_dealloc(dbg, locdesclist[i]->ld_s, DW_DLA_LOC_BLOCK);
+                dwarf_dealloc(dbg, locdesclist[i], DW_DLA_LOCDESC);
             }
-            //printf("]\n");
+            dwarf_dealloc(dbg, locdesclist, DW_DLA_LIST);
             return 0;
         }
         printf("Attribute does not have a location\n");
@@ -1154,16 +1226,57 @@ int get_die_loc_info(Dwarf_Debug dbg, Dwarf_Die the_die, Dwarf_Half attr, Dwarf_
 
 }
 
-void load_func_from_die(Dwarf_Debug *dbg, Dwarf_Die the_die,
-        const char *basename,  uint64_t base_address,uint64_t cu_base_address, bool needs_reloc){
+// Builds the Dwarf_Locdesc list the live var iterators walk, relocated to where the module is loaded
+// relocates the address range for DW_OP_ADDRs and the "live ranges" for each variable
+Dwarf_Locdesc **install_locs(const std::vector<ModLoc> &locs, uint64_t base_address, bool needs_reloc) {
+    Dwarf_Locdesc **locdesclist = (Dwarf_Locdesc **) malloc(sizeof(Dwarf_Locdesc *)*locs.size());
+    for (size_t i = 0; i < locs.size(); i++){
+        Dwarf_Locdesc *ld = (Dwarf_Locdesc *) calloc(1, sizeof(Dwarf_Locdesc));
+        ld->ld_lopc = locs[i].lopc;
+        ld->ld_hipc = locs[i].hipc;
+        ld->ld_cents = locs[i].ops.size();
+        ld->ld_s = (Dwarf_Loc *) malloc(sizeof(Dwarf_Loc)*ld->ld_cents);
+        std::copy(locs[i].ops.begin(), locs[i].ops.end(), ld->ld_s);
+        // patch lo and hi address in locdesc structure
+        // for variable "liveness" - this is a different usage of word live than typical uses
+        // live in this context means that the value at the location of the variable
+        // represents the actual value of the variable
+        // if lo = 0 and hi = 0xffffffff then variable is "live" for total scope of function
+        // if hipc and lopc both equal 0 than object has been optimized out
+        // if hi is 0xffffffff and lo does't equal 0 then this will add base address to hi
+        // im basically assuming that hi will not be 0xffffffff unless the variable is
+        // live for all scope of program
+        if ((Dwarf_Addr) -1 != ld->ld_hipc && needs_reloc){
+            ld->ld_lopc += base_address;
+            ld->ld_hipc += base_address;
+            for (int j = 0; j < ld->ld_cents; j++){
+                if (ld->ld_s[j].lr_atom == DW_OP_addr)
+                    ld->ld_s[j].lr_number += base_address;
+            }
+        }
+        locdesclist[i] = ld;
+    }
+    return locdesclist;
+}
+
+bool load_var_from_die(Dwarf_Debug dbg, Dwarf_Die the_die, uint64_t cu_base_address, ModVar &var) {
+    Dwarf_Error err;
+    var.name = getNameFromDie(the_die);
+    if (dwarf_dieoffset(the_die, &var.die_off, &err) != DW_DLV_OK)
+        return false;
+    // no location means the value is likely optimized out
+    return -1 != get_die_loc_info(dbg, the_die, DW_AT_location, var.locs, cu_base_address);
+}
+
+void load_func_from_die(Dwarf_Debug dbg, Dwarf_Die the_die,
+        uint64_t cu_base_address, ModuleInfo &mod){
     char* die_name = 0;
     Dwarf_Error err;
     Dwarf_Half tag;
     Dwarf_Attribute* attrs;
     Dwarf_Addr lowpc = 0, highpc = 0;
     Dwarf_Signed attrcount, i;
-    Dwarf_Locdesc **locdesclist;
-    Dwarf_Signed loccnt;
+    ModFunc func;
 
     int rc = dwarf_diename(the_die, &die_name, &err);
     if (rc == DW_DLV_ERROR){
@@ -1187,7 +1300,7 @@ void load_func_from_die(Dwarf_Debug *dbg, Dwarf_Die the_die,
         die("Error in dwarf_attlist\n");
 
     bool found_highpc = false;
-    bool found_fp_info = false;
+    func.has_fp = false;
     for (i = 0; i < attrcount; ++i) {
         Dwarf_Half attrcode;
         if (dwarf_whatattr(attrs[i], &attrcode, &err) != DW_DLV_OK)
@@ -1226,102 +1339,32 @@ void load_func_from_die(Dwarf_Debug *dbg, Dwarf_Die the_die,
         }
         else if (attrcode == DW_AT_frame_base){
             // get where attribute frame base attribute points
-            if (-1 == get_die_loc_info(*dbg, the_die, attrcode, &locdesclist,&loccnt, base_address, cu_base_address, needs_reloc)){
+            if (-1 == get_die_loc_info(dbg, the_die, attrcode, func.fp, cu_base_address)){
                 printf("Was not able to get [%s] location info for it\'s frame pointer\n", die_name);
             }
             else{
-                found_fp_info = true;
+                func.has_fp = true;
             }
         }
     }
 
-    if (found_highpc) {
-        if (needs_reloc) {
-            lowpc += base_address;
-            highpc += base_address;
-        }
-        //functions[std::string(basename)+"!"+die_name] = std::make_pair(lowpc, highpc);
-        auto lineToFuncAddress = [lowpc, highpc](LineRange &x){
-                // if a line range (we just need to check its lowpc) fits between range of a function
-                // we update the LineRange to reflect that the line is in the current function
-                if (x.lowpc < highpc && x.lowpc >= lowpc){
-                    x.function_addr = lowpc;
-                }
-        };
-        auto lineIsFunctionDef = [lowpc](LineRange &x){
-            return x.lowpc == lowpc;
-        };
-        auto funct_line_it = std::find_if(line_range_list.begin(), line_range_list.end(), lineIsFunctionDef);
-
-        if (funct_line_it != line_range_list.end()){
-            fn_start_line_range_list.push_back(*funct_line_it);
-            // add the LineRange information for the function to fn_name_to_line_info for later use
-            // when resolving dwarf information for .plt functions
-            // NOTE: this assumes that all function names are unique.
-
-            fn_name_to_line_info.insert(std::make_pair(std::string(die_name),
-                        LineRange(lowpc,
-                            highpc,
-                            funct_line_it->line_number,
-                            funct_line_it->filename,
-                            lowpc,
-                            funct_line_it->line_off)));
-
-            // now check if current function we are processing is in dynl_functions if so
-            // point the dynl_function to this function's line number, filename, and line_off
-            for (auto lib_name : processed_libs) {
-                if (dynl_functions.find(lib_name + ":plt!" + std::string(die_name)) != dynl_functions.end()){
-                    //printf("Trying to match function to %s\n",(lib_name + ":plt!" + std::string(die_name)).c_str());
-                    Dwarf_Addr plt_addr = dynl_functions[lib_name + ":plt!" + std::string(die_name)];
-                    //printf("Found it at 0x%llx, adding to line_range_list\n", plt_addr);
-                    //printf(" found a plt function defintion for %s\n", basename);
-
-                    line_range_list.push_back(LineRange(plt_addr,
-                                                        plt_addr,
-                                                        funct_line_it->line_number,
-                                                        funct_line_it->filename,
-                                                        lowpc,
-                                                        funct_line_it->line_off));
-
-                }
-            }
-        }
-        else {
-            printf("Could not find start of function [%s] in line number table something went wrong\n", die_name);
-        }
-
-        // this is if we want the start of the function to be one PAST the line that represents start of function
-        // in order to skip past function prologue
-        //if (funct_line_it != line_range_list.end()){
-        //    ++funct_line_it;
-        //    fn_start_line_range_list.push_back(*funct_line_it);
-        //}
-        std::for_each(line_range_list.begin(), line_range_list.end(), lineToFuncAddress);
-        funcaddrs[lowpc] = std::string(basename) + "!" + die_name;
-        // now add functions frame pointer locaiton list funct_to_framepointers mapping
-        if (found_fp_info){
-            funct_to_framepointers[lowpc] = std::make_pair(locdesclist, loccnt);
-        }
-        else {
-            funct_to_framepointers[lowpc] = std::make_pair((Dwarf_Locdesc **)NULL, 0);
-        }
-    }
-    else {
+    if (!found_highpc) {
         // we are processing a function that is in the .plt so we skip it because the function
         // is either defined in a library we don't have access to or a library our dwarf processor
         // will process later (or maybe already has!)
         return;
     }
+    func.name = die_name;
+    func.lowpc = lowpc;
+    func.highpc = highpc;
+
     // Load information about arguments and local variables
     //printf("Loading arguments and variables for %s\n", die_name);
     Dwarf_Die arg_child;
-    std::vector<std::string> params;
-    std::string argname;
-    std::vector<VarInfo> var_list;
     if (dwarf_child(the_die, &arg_child, &err) != DW_DLV_OK) {
+        mod.funcs.push_back(func);
         return;
     }
-    DwarfVarType *dvt;
     /* Now go over all children DIEs */
     while (arg_child != NULL) {
         if (dwarf_tag(arg_child, &tag, &err) != DW_DLV_OK) {
@@ -1331,20 +1374,12 @@ void load_func_from_die(Dwarf_Debug *dbg, Dwarf_Die the_die,
         switch (tag) {
             /* fall through to default case to get sibling die */
             case DW_TAG_formal_parameter:
-                argname = getNameFromDie(arg_child);
-
-                dvt = (DwarfVarType *)malloc(sizeof(DwarfVarType));
-                *dvt = {*dbg, arg_child};
-
-                if (-1 == get_die_loc_info(*dbg, arg_child, DW_AT_location, &locdesclist,&loccnt, base_address, cu_base_address, needs_reloc)){
-                    // value is likely optimized out, so has no location
-                    //printf("Var [%s] has no loc\n", argname.c_str());
-                } else {
-                    var_list.push_back(VarInfo((void *)dvt,argname,locdesclist,loccnt));
+            case DW_TAG_variable:
+                {
+                    ModVar var;
+                    if (load_var_from_die(dbg, arg_child, cu_base_address, var))
+                        func.vars.push_back(var);
                 }
-                // doesn't work but if we wanted to keep track of params we
-                // could do something like this
-                //params.push_back(dvt, argname);
                 break;
             /* fall through to default case to get sibling die */
             case DW_TAG_unspecified_parameters:
@@ -1375,25 +1410,12 @@ void load_func_from_die(Dwarf_Debug *dbg, Dwarf_Die the_die,
                         continue;
                     }
                 }
-            case DW_TAG_variable:
-                argname = getNameFromDie(arg_child);
-
-                dvt = (DwarfVarType *)malloc(sizeof(DwarfVarType));
-                *dvt = {*dbg, arg_child};
-
-                if (-1 == get_die_loc_info(*dbg, arg_child, DW_AT_location, &locdesclist,&loccnt, base_address, cu_base_address, needs_reloc)){
-                    // value is likely optimized out, so has no location
-                    //printf("Var [%s] has no loc\n", argname.c_str());
-                } else {
-                    var_list.push_back(VarInfo((void *)dvt, argname, locdesclist, loccnt));
-                }
-                break;
             case DW_TAG_label:
             default:
                 //printf("UNKNOWN tag in function dwarf analysis\n");
                 break;
         }
-        rc = dwarf_siblingof(*dbg, arg_child, &arg_child, &err);
+        rc = dwarf_siblingof(dbg, arg_child, &arg_child, &err);
 
         if (rc == DW_DLV_ERROR) {
             die("Error getting sibling of DIE\n");
@@ -1403,24 +1425,26 @@ void load_func_from_die(Dwarf_Debug *dbg, Dwarf_Die the_die,
             arg_child = NULL; /* done */
         }
     }
-    //funct_to_cu_base[lowpc] = cu_base_address;
-    funcvars[lowpc] = var_list;
-    //funcparams[lowpc] = boost::algorithm::join(params, ", ");
-    //printf(" %s #variables: %lu\n", funcaddrs[lowpc].c_str(), var_list.size());
+    mod.funcs.push_back(func);
+}
 
+bool sortModLine(const ModLine &x1, const ModLine &x2){
+    return x1.lowpc < x2.lowpc ||
+           (x1.lowpc == x2.lowpc && x1.highpc < x2.highpc);
 }
 
-/* Load all function and globar variable info.
+/* Load all line, function and global variable info for a module.
 */
-bool load_debug_info(Dwarf_Debug *dbg, const char *basename, uint64_t base_address, bool needs_reloc) {
+bool load_debug_info(Dwarf_Debug dbg, const char *basename, ModuleInfo &mod) {
     Dwarf_Unsigned cu_header_length, abbrev_offset, next_cu_header;
     Dwarf_Half version_stamp, address_size;
     Dwarf_Error err;
     Dwarf_Die no_die = 0, cu_die, child_die;
+    std::map<std::string, uint32_t> file_idx;
     int count = 0;
     /* Find compilation unit header */
     while (dwarf_next_cu_header(
-                *dbg,
+                dbg,
                 &cu_header_length,
                 &version_stamp,
                 &abbrev_offset,
@@ -1428,7 +1452,7 @@ bool load_debug_info(Dwarf_Debug *dbg, const char *basename, uint64_t base_addre
                 &next_cu_header,
                 &err) != DW_DLV_NO_ENTRY) {
         /* Expect the CU to have a single sibling - a DIE */
-        if (dwarf_siblingof(*dbg, no_die, &cu_die, &err) == DW_DLV_ERROR) {
+        if (dwarf_siblingof(dbg, no_die, &cu_die, &err) == DW_DLV_ERROR) {
             die("Error getting sibling of CU\n");
             continue;
         }
@@ -1447,46 +1471,35 @@ bool load_debug_info(Dwarf_Debug *dbg, const char *basename, uint64_t base_addre
         }
         int i;
         if (DW_DLV_OK == dwarf_srclines(cu_die, &dwarf_lines, &line_count, &err)){
-            char *filenm_tmp;
-            char *filenm_cu;
-            if (line_count > 0){
-                dwarf_linesrc(dwarf_lines[0], &filenm_tmp, &err);
-                filenm_cu = (char *) malloc(strlen(filenm_tmp)+1);
-                strcpy(filenm_cu, filenm_tmp);
-
-                for (i = 1; i < line_count; i++){
-                    char *filenm_line;
-                    filenm_tmp = NULL;
-                    Dwarf_Addr upper_bound_addr;
-                    Dwarf_Addr lower_bound_addr;
-                    Dwarf_Unsigned line_num;
-                    Dwarf_Unsigned line_off;
-                    dwarf_lineaddr(dwarf_lines[i-1], &lower_bound_addr, &err);
-                    dwarf_lineaddr(dwarf_lines[i], &upper_bound_addr, &err);
-
-                    dwarf_lineno(dwarf_lines[i-1], &line_num, &err);
-                    dwarf_lineoff_b(dwarf_lines[i-1], &line_off, &err);
-                    dwarf_linesrc(dwarf_lines[i-1], &filenm_tmp, &err);
-                    if (!filenm_tmp || 0 == strcmp(filenm_tmp, filenm_cu)){
-                        filenm_line = filenm_cu;
-                    }
-                    else {
-                        filenm_line = (char *) malloc(strlen(filenm_tmp)+1);
-                        strcpy(filenm_line, filenm_tmp);
-                    }
-                    //std::vector<std::tuple<Dwarf_Addr, Dwarf_Addr, Dwarf_Unsigned, char *, Dwarf_Addr>> line_range_list;
-                    if (needs_reloc){
-                        line_range_list.push_back(LineRange(base_address+lower_bound_addr,
-                                                            base_address+upper_bound_addr,
-                                                            line_num, filenm_line, line_off, 0));
-                    }
-                    else{
-                        line_range_list.push_back(LineRange(lower_bound_addr, upper_bound_addr, line_num,
-                                                            filenm_line, line_off, 0));
-                    }
-                    //printf("line no: %lld at addr: 0x%llx\n", line_num, lower_bound_addr);
+            for (i = 1; i < line_count; i++){
+                char *filenm_tmp = NULL;
+                Dwarf_Bool end_seq = false;
+                ModLine line;
+                // the row after an end of sequence starts an unrelated range
+                dwarf_lineendsequence(dwarf_lines[i-1], &end_seq, &err);
+                if (end_seq)
+                    continue;
+                dwarf_lineaddr(dwarf_lines[i-1], &line.lowpc, &err);
+                dwarf_lineaddr(dwarf_lines[i], &line.highpc, &err);
+                // several rows for one address only describe the last of them
+                if (line.lowpc >= line.highpc)
+                    continue;
+
+                dwarf_lineno(dwarf_lines[i-1], &line.line_number, &err);
+                dwarf_lineoff_b(dwarf_lines[i-1], &line.line_off, &err);
+                if (dwarf_linesrc(dwarf_lines[i-1], &filenm_tmp, &err) != DW_DLV_OK)
+                    filenm_tmp = (char *) "?";
+                auto it = file_idx.find(filenm_tmp);
+                if (it == file_idx.end()){
+                    it = file_idx.insert(std::make_pair(std::string(filenm_tmp), mod.files.size())).first;
+                    mod.files.push_back(filenm_tmp);
                 }
+                line.file = it->second;
+                line.func = -1;
+                mod.lines.push_back(line);
+                //printf("line no: %lld at addr: 0x%llx\n", line_num, lower_bound_addr);
             }
+            dwarf_srclines_dealloc(dbg, dwarf_lines, line_count);
         }
         else
             printf("Could not get get function line number\n");
@@ -1498,34 +1511,22 @@ bool load_debug_info(Dwarf_Debug *dbg, const char *basename, uint64_t base_addre
         }
 
         /* Now go over all children DIEs */
-        DwarfVarType *dvt;
         while (1) {
-            std::string argname;
             int rc;
             Dwarf_Half tag;
             if (dwarf_tag(child_die, &tag, &err) != DW_DLV_OK)
                 die("Error in dwarf_tag\n");
 
             if (tag == DW_TAG_subprogram){
-                load_func_from_die(dbg, child_die, basename, base_address, cu_base_address, needs_reloc);
+                load_func_from_die(dbg, child_die, cu_base_address, mod);
             }
             else if (tag == DW_TAG_variable){
-
-                Dwarf_Locdesc **locdesclist=NULL;
-                Dwarf_Signed loccnt;
-                argname = getNameFromDie(child_die);
-                dvt = (DwarfVarType *)malloc(sizeof(DwarfVarType));
-                *dvt = {*dbg, child_die};
-                if (-1 == get_die_loc_info(*dbg, child_die, DW_AT_location, &locdesclist,&loccnt, base_address, cu_base_address, needs_reloc)){
-                    // value is likely optimized out
-                    //printf("Var [%s] has no loc\n", argname.c_str());
-                }
-                else{
-                    global_var_list.push_back(VarInfo((void *)dvt,argname,locdesclist,loccnt));
-                }
+                ModVar var;
+                if (load_var_from_die(dbg, child_die, cu_base_address, var))
+                    mod.globals.push_back(var);
             }
 
-            rc = dwarf_siblingof(*dbg, child_die, &child_die, &err);
+            rc = dwarf_siblingof(dbg, child_die, &child_die, &err);
 
             if (rc == DW_DLV_ERROR) {
                 die("Error getting sibling of DIE\n");
@@ -1538,35 +1539,346 @@ bool load_debug_info(Dwarf_Debug *dbg, const char *basename, uint64_t base_addre
         count ++;
     }
     printf("Processed %d Compilation Units\n", count);
-    // sort the line number ranges
     if (count < 1){
          return false;
     }
+    // sort the line number ranges and tag each one with the function it is in,
+    // a later (nested) function taking precedence
+    std::sort(mod.lines.begin(), mod.lines.end(), sortModLine);
+    for (size_t f = 0; f < mod.funcs.size(); f++){
+        const ModFunc &func = mod.funcs[f];
+        ModLine key;
+        key.lowpc = func.lowpc;
+        key.highpc = 0;
+        auto it = std::lower_bound(mod.lines.begin(), mod.lines.end(), key, sortModLine);
+        for (; it != mod.lines.end() && it->lowpc < func.highpc; ++it){
+            it->func = f;
+        }
+    }
+    return true;
+}
+
+/* On-disk cache of ModuleInfo, one file per build-id under cache_dir.
+ * Everything is written in host byte order; a cache is only good for the
+ * host that wrote it.
+*/
+#define LINE_CACHE_MAGIC "PRIDWARF"
+#define LINE_CACHE_VERSION 1
+
+static void cache_put(FILE *fp, const void *buf, size_t len) {
+    fwrite(buf, 1, len, fp);
+}
+static void cache_put_u64(FILE *fp, Dwarf_Unsigned v) {
+    cache_put(fp, &v, sizeof(v));
+}
+static void cache_put_str(FILE *fp, const std::string &str) {
+    cache_put_u64(fp, str.size());
+    cache_put(fp, str.data(), str.size());
+}
+static void cache_put_locs(FILE *fp, const std::vector<ModLoc> &locs) {
+    cache_put_u64(fp, locs.size());
+    for (auto &loc : locs){
+        cache_put_u64(fp, loc.lopc);
+        cache_put_u64(fp, loc.hipc);
+        cache_put_u64(fp, loc.ops.size());
+        for (auto &op : loc.ops){
+            cache_put_u64(fp, op.lr_atom);
+            cache_put_u64(fp, op.lr_number);
+            cache_put_u64(fp, op.lr_number2);
+            cache_put_u64(fp, op.lr_offset);
+        }
+    }
+}
+static void cache_put_var(FILE *fp, const ModVar &var) {
+    cache_put_str(fp, var.name);
+    cache_put_u64(fp, var.die_off);
+    cache_put_locs(fp, var.locs);
+}
+
+static bool cache_get(FILE *fp, void *buf, size_t len) {
+    return fread(buf, 1, len, fp) == len;
+}
+static bool cache_get_u64(FILE *fp, Dwarf_Unsigned *v) {
+    return cache_get(fp, v, sizeof(*v));
+}
+// counts are checked against what is left of the file before anything is
+// allocated for them, so a damaged cache can't make us allocate wildly
+static bool cache_get_count(FILE *fp, Dwarf_Unsigned *n, uint64_t remaining) {
+    return cache_get_u64(fp, n) && *n <= remaining;
+}
+static bool cache_get_str(FILE *fp, std::string &str, uint64_t remaining) {
+    Dwarf_Unsigned n;
+    if (!cache_get_count(fp, &n, remaining)) return false;
+    str.resize(n);
+    return n == 0 || cache_get(fp, &str[0], n);
+}
+static bool cache_get_locs(FILE *fp, std::vector<ModLoc> &locs, uint64_t remaining) {
+    Dwarf_Unsigned n, nops, v;
+    if (!cache_get_count(fp, &n, remaining)) return false;
+    locs.resize(n);
+    for (auto &loc : locs){
+        if (!cache_get_u64(fp, &loc.lopc) || !cache_get_u64(fp, &loc.hipc) ||
+                !cache_get_count(fp, &nops, remaining))
+            return false;
+        loc.ops.resize(nops);
+        for (auto &op : loc.ops){
+            if (!cache_get_u64(fp, &v)) return false;
+            op.lr_atom = v;
+            if (!cache_get_u64(fp, &v)) return false;
+            op.lr_number = v;
+            if (!cache_get_u64(fp, &v)) return false;
+            op.lr_number2 = v;
+            if (!cache_get_u64(fp, &v)) return false;
+            op.lr_offset = v;
+        }
+    }
+    return true;
+}
+static bool cache_get_var(FILE *fp, ModVar &var, uint64_t remaining) {
+    return cache_get_str(fp, var.name, remaining) && cache_get_u64(fp, &var.die_off) && cache_get_locs(fp, var.locs, remaining);
+}
+
+std::string cache_path(const std::string &build_id) {
+    return std::string(cache_dir) + "/" + build_id + ".lines";
+}
+
+bool read_line_cache(const std::string &build_id, ModuleInfo &mod) {
+    std::string path = cache_path(build_id);
+    struct stat st;
+    char magic[8];
+    Dwarf_Unsigned version, n, i, v;
+    FILE *fp = fopen(path.c_str(), "rb");
+    if (!fp) return false;
+    bool ok = false;
+    uint64_t remaining = (fstat(fileno(fp), &st) == 0) ? st.st_size : 0;
+
+    if (!cache_get(fp, magic, sizeof(magic)) || memcmp(magic, LINE_CACHE_MAGIC, sizeof(magic)) != 0 ||
+            !cache_get_u64(fp, &version) || version != LINE_CACHE_VERSION)
+        goto out;
+    if (!cache_get_count(fp, &n, remaining)) goto out;
+    mod.files.resize(n);
+    for (i = 0; i < n; i++){
+        if (!cache_get_str(fp, mod.files[i], remaining)) goto out;
+    }
+    if (!cache_get_count(fp, &n, remaining)) goto out;
+    mod.lines.resize(n);
+    for (i = 0; i < n; i++){
+        ModLine &line = mod.lines[i];
+        if (!cache_get_u64(fp, &line.lowpc) || !cache_get_u64(fp, &line.highpc) ||
+                !cache_get_u64(fp, &line.line_number) || !cache_get_u64(fp, &line.line_off) ||
+                !cache_get_u64(fp, &v))
+            goto out;
+        line.file = v >> 32;
+        line.func = (int32_t) v;
+        if (line.file >= mod.files.size()) goto out;
+    }
+    if (!cache_get_count(fp, &n, remaining)) goto out;
+    mod.funcs.resize(n);
+    for (i = 0; i < n; i++){
+        ModFunc &func = mod.funcs[i];
+        Dwarf_Unsigned nvars;
+        if (!cache_get_str(fp, func.name, remaining) || !cache_get_u64(fp, &func.lowpc) ||
+                !cache_get_u64(fp, &func.highpc) || !cache_get_u64(fp, &v) ||
+                !cache_get_locs(fp, func.fp, remaining) || !cache_get_count(fp, &nvars, remaining))
+            goto out;
+        func.has_fp = v;
+        func.vars.resize(nvars);
+        for (auto &var : func.vars){
+            if (!cache_get_var(fp, var, remaining)) goto out;
+        }
+    }
+    for (i = 0; i < mod.lines.size(); i++){
+        if (mod.lines[i].func >= (int64_t) mod.funcs.size()) goto out;
+    }
+    if (!cache_get_count(fp, &n, remaining)) goto out;
+    mod.globals.resize(n);
+    for (i = 0; i < n; i++){
+        if (!cache_get_var(fp, mod.globals[i], remaining)) goto out;
+    }
+    ok = true;
+out:
+    fclose(fp);
+    if (!ok){
+        printf("Ignoring bad line table cache %s\n", path.c_str());
+        mod = ModuleInfo();
+    }
+    return ok;
+}
+
+void write_line_cache(const std::string &build_id, const ModuleInfo &mod) {
+    std::string path = cache_path(build_id);
+    // written under a temporary name so a concurrent run never sees half a cache
+    std::string tmp_path = path + "." + std::to_string(getpid());
+    FILE *fp = fopen(tmp_path.c_str(), "wb");
+    if (!fp){
+        printf("Couldn't write line table cache %s: %s\n", tmp_path.c_str(), strerror(errno));
+        return;
+    }
+    cache_put(fp, LINE_CACHE_MAGIC, 8);
+    cache_put_u64(fp, LINE_CACHE_VERSION);
+    cache_put_u64(fp, mod.files.size());
+    for (auto &file : mod.files)
+        cache_put_str(fp, file);
+    cache_put_u64(fp, mod.lines.size());
+    for (auto &line : mod.lines){
+        cache_put_u64(fp, line.lowpc);
+        cache_put_u64(fp, line.highpc);
+        cache_put_u64(fp, line.line_number);
+        cache_put_u64(fp, line.line_off);
+        cache_put_u64(fp, ((uint64_t) line.file << 32) | (uint32_t) line.func);
+    }
+    cache_put_u64(fp, mod.funcs.size());
+    for (auto &func : mod.funcs){
+        cache_put_str(fp, func.name);
+        cache_put_u64(fp, func.lowpc);
+        cache_put_u64(fp, func.highpc);
+        cache_put_u64(fp, func.has_fp);
+        cache_put_locs(fp, func.fp);
+        cache_put_u64(fp, func.vars.size());
+        for (auto &var : func.vars)
+            cache_put_var(fp, var);
+    }
+    cache_put_u64(fp, mod.globals.size());
+    for (auto &var : mod.globals)
+        cache_put_var(fp, var);
+    bool failed = ferror(fp);
+    failed |= fclose(fp) != 0;
+    if (failed || rename(tmp_path.c_str(), path.c_str()) != 0){
+        printf("Couldn't write line table cache %s\n", path.c_str());
+        unlink(tmp_path.c_str());
+    }
+}
+
+VarInfo install_var(Dwarf_Debug dbg, const ModVar &var, uint64_t base_address, bool needs_reloc) {
+    DwarfVarType *dvt = (DwarfVarType *)malloc(sizeof(DwarfVarType));
+    *dvt = {dbg, NULL, var.die_off};
+    return VarInfo((void *)dvt, var.name, install_locs(var.locs, base_address, needs_reloc), var.locs.size());
+}
+
+/* Makes a module's lines, functions and variables visible to lookups,
+ * relocated to where it is loaded. Lines outside [load_lo, load_hi) (after
+ * relocation) belong to code the linker discarded and are dropped.
+*/
+void install_module(Dwarf_Debug dbg, const ModuleInfo &mod, const char *basename,
+        uint64_t base_address, bool needs_reloc, Dwarf_Addr load_lo, Dwarf_Addr load_hi) {
+    Dwarf_Addr reloc = needs_reloc ? base_address : 0;
+    std::vector<char *> files;
+    for (auto &file : mod.files)
+        files.push_back(strdup(file.c_str()));
+
+    LineTable table;
+    table.lowpc = load_lo;
+    table.highpc = load_hi;
+    for (auto &line : mod.lines){
+        Dwarf_Addr lowpc = line.lowpc + reloc;
+        if (lowpc < load_lo || line.highpc + reloc > load_hi)
+            continue;
+        Dwarf_Addr function_addr = line.func < 0 ? 0 : mod.funcs[line.func].lowpc + reloc;
+        table.lines.push_back(LineRange(lowpc, line.highpc + reloc, line.line_number,
+                    files[line.file], function_addr, line.line_off));
+    }
+    // a module loaded again replaces whatever was mapped there before
+    auto it = line_tables.upper_bound(load_lo);
+    while (it != line_tables.end() && it->second.lowpc < load_hi)
+        line_tables.erase(it++);
+    size_t num_lines = table.lines.size();
+    if (num_lines > 0)
+        line_tables[load_hi] = std::move(table);
+    // lines remembered for code translated before may be stale now
+    line_boundaries.clear();
+
+    for (auto &func : mod.funcs){
+        Dwarf_Addr lowpc = func.lowpc + reloc;
+        ModLine key;
+        key.lowpc = func.lowpc;
+        key.highpc = 0;
+        auto funct_line_it = std::lower_bound(mod.lines.begin(), mod.lines.end(), key, sortModLine);
+        if (funct_line_it != mod.lines.end() && funct_line_it->lowpc == func.lowpc){
+            LineRange fn_line(lowpc, funct_line_it->highpc + reloc, funct_line_it->line_number,
+                    files[funct_line_it->file], lowpc, funct_line_it->line_off);
+            fn_start_line_range_list.push_back(fn_line);
+            // add the LineRange information for the function to fn_name_to_line_info for later use
+            // when resolving dwarf information for .plt functions
+            // NOTE: this assumes that all function names are unique.
+            fn_name_to_line_info.insert(std::make_pair(func.name,
+                        LineRange(lowpc, func.highpc + reloc, fn_line.line_number,
+                            fn_line.filename, lowpc, fn_line.line_off)));
+
+            // now check if current function we are processing is in dynl_functions if so
+            // point the dynl_function to this function's line number, filename, and line_off
+            for (auto lib_name : processed_libs) {
+                auto dynl = dynl_functions.find(lib_name + ":plt!" + func.name);
+                if (dynl != dynl_functions.end()){
+                    Dwarf_Addr plt_addr = dynl->second;
+                    plt_lines.insert(std::make_pair(plt_addr, LineRange(plt_addr, plt_addr,
+                                    fn_line.line_number, fn_line.filename, lowpc, fn_line.line_off)));
+                }
+            }
+        }
+        else {
+            printf("Could not find start of function [%s] in line number table something went wrong\n", func.name.c_str());
+        }
+        funcaddrs[lowpc] = std::string(basename) + "!" + func.name;
+        // now add functions frame pointer locaiton list funct_to_framepointers mapping
+        if (func.has_fp){
+            funct_to_framepointers[lowpc] = std::make_pair(install_locs(func.fp, base_address, needs_reloc),
+                    (Dwarf_Signed) func.fp.size());
+        }
+        else {
+            funct_to_framepointers[lowpc] = std::make_pair((Dwarf_Locdesc **)NULL, 0);
+        }
+        std::vector<VarInfo> var_list;
+        for (auto &var : func.vars)
+            var_list.push_back(install_var(dbg, var, base_address, needs_reloc));
+        funcvars[lowpc] = var_list;
+    }
+    for (auto &var : mod.globals)
+        global_var_list.push_back(install_var(dbg, var, base_address, needs_reloc));
     std::sort(fn_start_line_range_list.begin(), fn_start_line_range_list.end(), sortRange);
-    std::sort(line_range_list.begin(), line_range_list.end(), sortRange);
     printf("Successfully loaded debug symbols for %s\n", basename);
-    printf("Number of address range to line mappings: %lu num globals: %lu\n", line_range_list.size(), global_var_list.size());
-    return true;
+    printf("Number of address range to line mappings: %lu num globals: %lu\n", num_lines, global_var_list.size());
 }
 
-bool read_debug_info(const char* dbgfile, const char *basename, uint64_t base_address, bool needs_reloc) {
+// elf_base and elf_end are the link-time extent of the module, as returned by elf_get_baseaddr
+bool read_debug_info(const char* dbgfile, const char *basename, uint64_t base_address, bool needs_reloc,
+        uint64_t elf_base, uint64_t elf_end, const std::string &build_id) {
     Dwarf_Debug *dbg = (Dwarf_Debug *) malloc(sizeof(Dwarf_Debug));
     Dwarf_Error err;
+    ModuleInfo mod;
     int fd = -1;
     if ((fd = open(dbgfile, O_RDONLY)) < 0) {
         perror("open");
         return false;
     }
 
+    // still needed with a cached module, to look up variable types
     if (dwarf_init(fd, DW_DLC_READ, 0, 0, dbg, &err) != DW_DLV_OK) {
         fprintf(stderr, "Failed DWARF initialization\n");
         return false;
     }
 
-    if (!load_debug_info(dbg, basename, base_address, needs_reloc)){
-        fprintf(stderr, "Failed DWARF loading\n");
-        return false;
+    bool use_cache = cache_dir[0] != '\0' && !build_id.empty();
+    if (use_cache && read_line_cache(build_id, mod)) {
+        printf("Loaded line tables for %s from cache\n", basename);
+    }
+    else {
+        if (!load_debug_info(*dbg, basename, mod)){
+            fprintf(stderr, "Failed DWARF loading\n");
+            return false;
+        }
+        if (use_cache)
+            write_line_cache(build_id, mod);
+    }
+
+    // without a usable ELF extent fall back to the extent of the lines themselves
+    if (elf_base >= elf_end && !mod.lines.empty()) {
+        elf_base = mod.lines.front().lowpc;
+        elf_end = 0;
+        for (auto &line : mod.lines)
+            elf_end = std::max(elf_end, (uint64_t) line.highpc);
     }
+    Dwarf_Addr reloc = needs_reloc ? base_address : 0;
+    install_module(*dbg, mod, basename, base_address, needs_reloc, elf_base + reloc, elf_end + reloc);
 
     /* don't free dbg info anymore
     if (dwarf_finish(dbg, &err) != DW_DLV_OK) {
@@ -1629,9 +1941,11 @@ void on_library_load(CPUState *env, target_ulong pc, char *guest_lib_name, targe
         fprintf(stderr, "Couldn't open %s; will not load symbols for it.\n", lib_name);
         return;
     }
-    uint64_t elf_base = elf_get_baseaddr(lib_name, basename(lib_name), base_addr);
+    uint64_t elf_end;
+    std::string build_id;
+    uint64_t elf_base = elf_get_baseaddr(lib_name, basename(lib_name), base_addr, &elf_end, &build_id);
     bool needs_reloc = elf_base != base_addr;
-    if (!read_debug_info(lib_name, basename(lib_name), base_addr, needs_reloc)) {
+    if (!read_debug_info(lib_name, basename(lib_name), base_addr, needs_reloc, elf_base, elf_end, build_id)) {
         fprintf(stderr, "Couldn't load symbols from %s.\n", lib_name);
         return;
     }
@@ -1672,9 +1986,11 @@ void ensure_dbg_initialized(CPUState *env) {
                 //fprintf(stderr, "Couldn't open %s; will not load symbols for it.\n", fname);
                 continue;
             }
-            uint64_t elf_base = elf_get_baseaddr(fname, m->name, m->base);
+            uint64_t elf_end;
+            std::string build_id;
+            uint64_t elf_base = elf_get_baseaddr(fname, m->name, m->base, &elf_end, &build_id);
             bool needs_reloc = elf_base != m->base;
-            if (!read_debug_info(fname, m->name, m->base, needs_reloc)) {
+            if (!read_debug_info(fname, m->name, m->base, needs_reloc, elf_base, elf_end, build_id)) {
                 fprintf(stderr, "Couldn't load symbols from %s.\n", fname);
                 continue;
             }
@@ -1717,54 +2033,48 @@ target_ulong get_cur_fp(CPUState *env, target_ulong pc){
 
 bool dwarf_in_target_code(CPUState *env, target_ulong pc){
     if (!correct_asid(env)) return false;
-    auto it = std::lower_bound(line_range_list.begin(), line_range_list.end(), pc, CompareRangeAndPC());
-    if (pc < it->lowpc || it == line_range_list.end())
-        return false;
-    return true;
+    return find_line(pc) != NULL;
+}
+
+// Line boundaries are worked out at translation time.  Execution within a
+// TB is sequential, so the source line can only change at an instruction
+// whose line differs from the one translated before it; only those, and
+// the first instruction of each TB (which may be entered from any line),
+// get an insn_exec callback.  Their lines are remembered in line_boundaries
+// so the exec callback doesn't have to search for them again.
+const LineRange *tr_prev_line = NULL;
+target_ulong tr_prev_pc = 0;
+bool tr_new_tb = true;
+
+int before_block_translate_dwarf(CPUState *env, target_ulong pc) {
+    tr_new_tb = true;
+    return 0;
+}
+
+static bool same_line(const LineRange *x1, const LineRange *x2) {
+    return x1->line_number == x2->line_number &&
+           x1->function_addr == x2->function_addr &&
+           x1->filename == x2->filename;
 }
 
 bool translate_callback_dwarf(CPUState *env, target_ulong pc) {
     if (!correct_asid(env)) return false;
 
-    auto it2 = std::lower_bound(line_range_list.begin(), line_range_list.end(), pc, CompareRangeAndPC());
-    /*
-    // these are just checks to make sure the lower_bound returns the same value as lower_bound
-    // after checking this through a recording, I am pretty sure that I have ironed all the kinks out
-    // in implementing lower_bound for a vector of ranges
-    auto addressInRange = [pc](std::tuple<Dwarf_Addr, Dwarf_Addr, Dwarf_Unsigned, char *, Dwarf_Addr> x) {
-        return pc >= std::get<0>(x) && pc < std::get<1>(x);
-    };
-    auto it = find_if(line_range_list.begin(), line_range_list.end(), addressInRange);
-    if (it == line_range_list.end())
+    // some retranslations (e.g. for I/O) don't go through before_block_translate,
+    // so anything that doesn't follow the last instruction also starts a TB
+    bool new_tb = tr_new_tb || pc <= tr_prev_pc || pc > tr_prev_pc + 16;
+    const LineRange *prev = tr_prev_line;
+    const LineRange *line = find_line(pc);
+    tr_new_tb = false;
+    tr_prev_pc = pc;
+    tr_prev_line = line;
+    if (line == NULL)
         return false;
-    */
-    /*
-    // debugging print statements
-    printf(" pc: 0x%x, addr1: 0x%llx-0x%llx addr2: 0x%llx-0x%llx\n", pc,std::get<0>(*it), std::get<1>(*it),
-            std::get<0>(*it2), std::get<1>(*it2));
-    //printf(" pc: 0x%x, addr2: 0x%llx-0x%llx\n", pc, std::get<0>(*it2), std::get<1>(*it2));
-    if (std::get<0>(*it) != std::get<0>(*it2)) {
-        auto before_it1 = it - 1;
-        auto after_it1 = it + 1;
-        auto before_it2 = it2 - 1;
-        auto after_it2 = it2 + 1;
-        printf(" before linear it: 0x%llx-0x%llx binary search it: 0x%llx-0x%llx\n",
-                std::get<0>(*before_it1), std::get<1>(*before_it1),
-                std::get<0>(*before_it2), std::get<1>(*before_it2));
-        printf(" after linear it: 0x%llx-0x%llx binary search it: 0x%llx-0x%llx\n",
-                std::get<0>(*after_it1), std::get<1>(*after_it1),
-                std::get<0>(*after_it2), std::get<1>(*after_it2));
-        abort();
-    }
-    */
-    // after the call to lower_bound the `pc` should be between it2->lowpc and it2->highpc
-    // if it2 == line_range_list.end() we know we definitely didn't find out pc in our line_range_list
-    if (pc < it2->lowpc || it2 == line_range_list.end())
+    if (!new_tb && prev != NULL && same_line(prev, line))
         return false;
-
-
+    line_boundaries.erase(pc);
+    line_boundaries.insert(std::make_pair(pc, *line));
     return true;
-
 }
 
 void dwarf_log_callsite(CPUState *env, char *file_callee, char *fn_callee, uint64_t lno_callee, bool isCall){
@@ -1776,8 +2086,8 @@ void dwarf_log_callsite(CPUState *env, char *file_callee, char *fn_callee, uint6
     }
 
     ra -= 5; // subtract 5 to get address of call instead of return address
-    auto it = std::lower_bound(line_range_list.begin(), line_range_list.end(), ra, CompareRangeAndPC());
-    if (ra < it->lowpc || it == line_range_list.end()){
+    const LineRange *it = find_line(ra);
+    if (it == NULL){
         //printf("No DWARF information for callsite 0x%x for current function.\n", ra);
         //printf("Callsite must be in an external library we do not have DWARF information for.\n");
         return;
@@ -1802,8 +2112,8 @@ void dwarf_log_callsite(CPUState *env, char *file_callee, char *fn_callee, uint6
 
 void on_call(CPUState *env, target_ulong pc) {
     if (!correct_asid(env)) return;
-    auto it = std::lower_bound(line_range_list.begin(), line_range_list.end(), pc, CompareRangeAndPC());
-    if (pc < it->lowpc || it == line_range_list.end()){
+    const LineRange *it = find_line(pc);
+    if (it == NULL){
         /* printf("RET: Could not find line info for 0x%x\n", pc); */
         return;
     }
@@ -1847,8 +2157,8 @@ void on_call(CPUState *env, target_ulong pc) {
 void on_ret(CPUState *env, target_ulong pc_func) {
     if (!correct_asid(env)) return;
     //printf(" on_ret address: %x\n", func);
-    auto it = std::lower_bound(line_range_list.begin(), line_range_list.end(), pc_func, CompareRangeAndPC());
-    if (pc_func < it->lowpc || it == line_range_list.end()){
+    const LineRange *it = find_line(pc_func);
+    if (it == NULL){
         /* printf("RET: Could not find line info for 0x%x\n", pc_func); */
         return;
     }
@@ -1971,8 +2281,8 @@ void dwarf_get_vma_symbol (CPUState *env, target_ulong pc, target_ulong vma, cha
     }
     target_ulong fn_address;
 
-    auto it = std::lower_bound(line_range_list.begin(), line_range_list.end(), pc, CompareRangeAndPC());
-    if (pc < it->lowpc || it == line_range_list.end() ) {
+    const LineRange *it = find_line(pc);
+    if (it == NULL) {
         *symbol_name = NULL;
         return;
     }
@@ -2002,8 +2312,8 @@ void dwarf_get_pc_source_info(CPUState *env, target_ulong pc, SrcInfo *info, int
         *rc = -1;
         return;
     }
-    auto it = std::lower_bound(line_range_list.begin(), line_range_list.end(), pc, CompareRangeAndPC());
-    if (pc < it->lowpc || it == line_range_list.end()){
+    const LineRange *it = find_line(pc);
+    if (it == NULL){
         auto it_dyn = addr_to_dynl_function.find(pc);
         if (it_dyn != addr_to_dynl_function.end()){
             //printf("In a a plt function\n");
@@ -2075,8 +2385,9 @@ void dwarf_global_livevar_iter(CPUState *env,
 int exec_callback_dwarf(CPUState *env, target_ulong pc) {
     inExecutableSource = false;
     if (!correct_asid(env)) return 0;
-    auto it2 = std::lower_bound(line_range_list.begin(), line_range_list.end(), pc, CompareRangeAndPC());
-    if (it2 == line_range_list.end() || pc < it2->lowpc)
+    auto bnd = line_boundaries.find(pc);
+    const LineRange *it2 = (bnd != line_boundaries.end()) ? &bnd->second : find_line(pc);
+    if (it2 == NULL)
         return 0;
     inExecutableSource = true;
     if (it2->lowpc == it2->highpc) {
@@ -2119,18 +2430,8 @@ int exec_callback_dwarf(CPUState *env, target_ulong pc) {
 ******************************************************************** */
 
 uint32_t guest_strncpy(CPUState *env, char *buf, size_t maxlen, target_ulong guest_addr) {
-    buf[0] = 0;
-    unsigned i;
-    for (i=0; i<maxlen; i++) {
-        uint8_t c;
-        panda_virtual_memory_rw(env, guest_addr+i, &c, 1, 0);
-        buf[i] = c;
-        if (c==0) {
-            break;
-        }
-    }
-    buf[maxlen-1] = 0;
-    return i;
+    int n = panda_virtual_memory_read_string(env, guest_addr, buf, maxlen);
+    return n < 0 ? 0 : n;
 }
 
 // get current process before each bb execs
@@ -2204,6 +2505,7 @@ bool init_plugin(void *self) {
     guest_debug_path = panda_parse_string(args, "g_debugpath", "dbg");
     host_debug_path = panda_parse_string(args, "h_debugpath", "dbg");
     proc_to_monitor = panda_parse_string(args, "proc", "None");
+    cache_dir = panda_parse_string(args, "cache_dir", "");
     // panda plugin plugin includes
     panda_require("callstack_instr");
     panda_require("osi");
@@ -2248,8 +2550,10 @@ bool init_plugin(void *self) {
     printf("opening debug info for starting binary %s\n", bin_path.c_str());
     // third arg (actual_base address or executable) is 0 because we don't know what it is, but for now
     // assume that it is not pie
-    elf_get_baseaddr(bin_path.c_str(), proc_to_monitor, 0);
-    if (!read_debug_info(bin_path.c_str(), proc_to_monitor, 0, false)) {
+    uint64_t elf_end;
+    std::string build_id;
+    uint64_t elf_base = elf_get_baseaddr(bin_path.c_str(), proc_to_monitor, 0, &elf_end, &build_id);
+    if (!read_debug_info(bin_path.c_str(), proc_to_monitor, 0, false, elf_base, elf_end, build_id)) {
         fprintf(stderr, "Couldn't load symbols from %s.\n", bin_path.c_str());
         return false;
     }
@@ -2262,6 +2566,8 @@ bool init_plugin(void *self) {
         //panda_register_callback(self, PANDA_CB_VIRT_MEM_WRITE, pcb_dwarf);
         //pcb_dwarf.virt_mem_read = virt_mem_read;
         //panda_register_callback(self, PANDA_CB_VIRT_MEM_READ, pcb_dwarf);
+        pcb_dwarf.before_block_translate = before_block_translate_dwarf;
+        panda_register_callback(self, PANDA_CB_BEFORE_BLOCK_TRANSLATE, pcb_dwarf);
         pcb_dwarf.insn_translate = translate_callback_dwarf;
         panda_register_callback(self, PANDA_CB_INSN_TRANSLATE, pcb_dwarf);
         pcb_dwarf.insn_exec = exec_callback_dwarf;
@@ -5,5 +5,6 @@ typedef void (*dwarfTypeCB)(target_ulong buf, LocType loc_t, target_ulong buf_le
 
 typedef struct DwarfVarType {
     Dwarf_Debug dbg;
-    Dwarf_Die var_die;
+    Dwarf_Die var_die;      // NULL until first looked up by var_off
+    Dwarf_Off var_off;
 } DwarfVarType;
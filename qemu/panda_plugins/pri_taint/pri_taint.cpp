@@ -362,6 +362,8 @@ bool init_plugin(void *self) {
 
     panda_require("taint2");
     assert(init_taint2_api());
+    // taint queries logged to the pandalog include the taint compute number
+    taint2_track_tcn();
 
     if (hypercall_taint) {
         panda_cb pcb;
@@ -37,9 +37,12 @@ static RR_prog_point orig_last_prog_point = {0, 0, 0};
 
 static bool snipping = false;
 static bool done = false;
+// Finish as soon as the log is copied rather than replaying to the end.
+static bool stop = false;
 
 static RR_prog_point copy_entry(void);
 static void sassert(bool condition);
+static void copy_payload(uint64_t len, bool ref);
 
 static void sassert(bool condition) {
     if (!condition) {
@@ -91,6 +94,10 @@ static void write_entry(RR_log_entry *item) {
             sassert(fwrite(&(item->variant.exit_request),
                         sizeof(item->variant.exit_request), 1, newlog) == 1);
             break;
+        case RR_CPU_SWITCH:
+            sassert(fwrite(&(item->variant.cpu_index),
+                        sizeof(item->variant.cpu_index), 1, newlog) == 1);
+            break;
         case RR_SKIPPED_CALL:
             {
                 RR_skipped_call_args *args = &item->variant.call_args;
@@ -100,10 +107,7 @@ static void write_entry(RR_log_entry *item) {
                     case RR_CALL_CPU_MEM_RW:
                         sassert(fwrite(&(args->variant.cpu_mem_rw_args),
                                     sizeof(args->variant.cpu_mem_rw_args), 1, newlog) == 1);
-                        //mz buffer length in args->variant.cpu_mem_rw_args.len
-                        //mz always allocate a new one. we free it when the item is added to the recycle list
-                        args->variant.cpu_mem_rw_args.buf = g_malloc(args->variant.cpu_mem_rw_args.len);
-                        //mz read the buffer
+                        //mz write the buffer (already read into the queue entry)
                         sassert(fwrite(args->variant.cpu_mem_rw_args.buf, 1,
                                     args->variant.cpu_mem_rw_args.len, newlog) > 0);
                         break;
@@ -155,6 +159,18 @@ static void write_entry(RR_log_entry *item) {
     }
 }
 
+// Copy a payload following an entry header, inline bytes or store references.
+static void copy_payload(uint64_t len, bool ref) {
+    uint8_t buf[RR_PAYLOAD_CHUNK];
+    uint64_t remaining = ref ? rr_payload_num_chunks(len) * sizeof(uint64_t) : len;
+    while (remaining > 0) {
+        size_t n = remaining < sizeof(buf) ? remaining : sizeof(buf);
+        sassert(fread(buf, 1, n, oldlog) == n);
+        sassert(fwrite(buf, 1, n, newlog) == n);
+        remaining -= n;
+    }
+}
+
 // Returns guest instr count (in old replay counting mode)
 static RR_prog_point copy_entry(void) {
     // Code copied from rr_log.c.
@@ -221,38 +237,35 @@ static RR_prog_point copy_entry(void) {
             sassert(fwrite(&(item->variant.exit_request),
                         sizeof(item->variant.exit_request), 1, newlog) == 1);
             break;
+        case RR_CPU_SWITCH:
+            sassert(fread(&(item->variant.cpu_index),
+                        sizeof(item->variant.cpu_index), 1, oldlog) == 1);
+            sassert(fwrite(&(item->variant.cpu_index),
+                        sizeof(item->variant.cpu_index), 1, newlog) == 1);
+            break;
         case RR_SKIPPED_CALL:
             {
                 RR_skipped_call_args *args = &item->variant.call_args;
                 //mz read kind first!
                 sassert(fread(&(args->kind), sizeof(args->kind), 1, oldlog) == 1);
                 sassert(fwrite(&(args->kind), sizeof(args->kind), 1, newlog) == 1);
-                switch(args->kind) {
+                // Store references are copied as they are; the store itself
+                // is shared with the new replay.
+                bool ref = args->kind & RR_CALL_PAYLOAD_REF;
+                switch(args->kind & ~RR_CALL_PAYLOAD_REF) {
                     case RR_CALL_CPU_MEM_RW:
                         sassert(fread(&(args->variant.cpu_mem_rw_args),
                                     sizeof(args->variant.cpu_mem_rw_args), 1, oldlog) == 1);
                         sassert(fwrite(&(args->variant.cpu_mem_rw_args),
                                     sizeof(args->variant.cpu_mem_rw_args), 1, newlog) == 1);
-                        //mz buffer length in args->variant.cpu_mem_rw_args.len
-                        //mz always allocate a new one. we free it when the item is added to the recycle list
-                        args->variant.cpu_mem_rw_args.buf = g_malloc(args->variant.cpu_mem_rw_args.len);
-                        //mz read the buffer
-                        sassert(fread(args->variant.cpu_mem_rw_args.buf, 1,
-                                    args->variant.cpu_mem_rw_args.len, oldlog) > 0);
-                        sassert(fwrite(args->variant.cpu_mem_rw_args.buf, 1,
-                                    args->variant.cpu_mem_rw_args.len, newlog) > 0);
+                        copy_payload(args->variant.cpu_mem_rw_args.len, ref);
                         break;
                     case RR_CALL_CPU_MEM_UNMAP:
                         sassert(fread(&(args->variant.cpu_mem_unmap),
                                     sizeof(args->variant.cpu_mem_unmap), 1, oldlog) == 1);
                         sassert(fwrite(&(args->variant.cpu_mem_unmap),
                                     sizeof(args->variant.cpu_mem_unmap), 1, newlog) == 1);
-                        args->variant.cpu_mem_unmap.buf = malloc(args->variant.cpu_mem_unmap.len);
-                        sassert(fread(args->variant.cpu_mem_unmap.buf, 1,
-                                    args->variant.cpu_mem_unmap.len, oldlog) > 0);
-                        sassert(fwrite(args->variant.cpu_mem_unmap.buf, 1,
-                                    args->variant.cpu_mem_unmap.len, newlog) > 0);
-                        //free(args->variant.cpu_mem_unmap.buf);
+                        copy_payload(args->variant.cpu_mem_unmap.len, ref);
                         break;
 
                     case RR_CALL_CPU_REG_MEM_REGION:
@@ -281,20 +294,7 @@ static RR_prog_point copy_entry(void) {
                                     sizeof(args->variant.handle_packet_args), 1, oldlog) == 1);
                         sassert(fwrite(&(args->variant.handle_packet_args), 
                                     sizeof(args->variant.handle_packet_args), 1, newlog) == 1);
-                        //mz XXX HACK
-                        args->old_buf_addr = (uint64_t) args->variant.handle_packet_args.buf;
-                        //mz buffer length in args->variant.cpu_mem_rw_args.len 
-                        //mz always allocate a new one. we free it when the item is added to the recycle list
-                        args->variant.handle_packet_args.buf = 
-                            malloc(args->variant.handle_packet_args.size);
-                        //mz read the buffer 
-                        sassert(fread(args->variant.handle_packet_args.buf, 
-                                    args->variant.handle_packet_args.size, 1,
-                                    oldlog) == 1 /*> 0*/);
-                        sassert(fwrite(args->variant.handle_packet_args.buf, 
-                                    args->variant.handle_packet_args.size, 1,
-                                    newlog) == 1 /*> 0*/);
-                        //free(args->variant.handle_packet_args.buf);
+                        copy_payload(args->variant.handle_packet_args.size, ref);
                         break;
 
                     default:
@@ -341,7 +341,7 @@ static void end_snip(void) {
 int before_block_exec(CPUState *env, TranslationBlock *tb) {
     uint64_t count = rr_get_guest_instr_count();
     if (!snipping && count+tb->num_guest_insns > start_count) {
-        sassert((oldlog = fopen(rr_nondet_log->name, "r")));
+        sassert((oldlog = rr_reopen_replay_log()));
         sassert(fread(&orig_last_prog_point, sizeof(RR_prog_point), 1, oldlog) == 1);
         printf("Original ending prog point: ");
         rr_spit_prog_point(orig_last_prog_point);
@@ -355,10 +355,25 @@ int before_block_exec(CPUState *env, TranslationBlock *tb) {
         printf("Writing entries to %s...\n", nondet_name);
         newlog = fopen(nondet_name, "w");
         sassert(newlog);
+        rr_copy_payload_store(nondet_name);
         // We'll fix this up later.
         RR_prog_point prog_point = {0, 0, 0};
         fwrite(&prog_point, sizeof(RR_prog_point), 1, newlog);
 
+        // A new replay starts out following first_cpu; if we're cutting in
+        // the middle of another vCPU's slice, switch to it right away.
+        if (rr_get_cpu() != first_cpu) {
+            RR_header sw;
+            uint32_t cpu_index = rr_get_cpu()->cpu_index;
+            sw.kind = RR_CPU_SWITCH;
+            sw.callsite_loc = RR_CALLSITE_TCG_EXEC_ALL;
+            sw.prog_point = prog_point;
+            sassert(fwrite(&(sw.prog_point), sizeof(sw.prog_point), 1, newlog) == 1);
+            sassert(fwrite(&(sw.kind), sizeof(sw.kind), 1, newlog) == 1);
+            sassert(fwrite(&(sw.callsite_loc), sizeof(sw.callsite_loc), 1, newlog) == 1);
+            sassert(fwrite(&cpu_index, sizeof(cpu_index), 1, newlog) == 1);
+        }
+
         fseek(oldlog, ftell(rr_nondet_log->fp), SEEK_SET);
 
         RR_log_entry *item = rr_get_queue_head();
@@ -368,6 +383,8 @@ int before_block_exec(CPUState *env, TranslationBlock *tb) {
         }
         while (prog_point.guest_instr_count < end_count && !feof(oldlog)) {
             prog_point = copy_entry();
+            // The rest of the old log, RR_LAST included, is now copied.
+            if (stop && entry.header.kind == RR_LAST) break;
         } 
         if (!feof(oldlog)) { // prog_point is the first one AFTER what we want
             printf("Reached end of old nondet log.\n");
@@ -375,6 +392,18 @@ int before_block_exec(CPUState *env, TranslationBlock *tb) {
             printf("Past desired ending point for log.\n");
         }
 
+        if (stop && entry.header.kind == RR_LAST) {
+            prog_point = orig_last_prog_point;
+            prog_point.guest_instr_count -= actual_start_count;
+            rewind(newlog);
+            fwrite(&prog_point, sizeof(RR_prog_point), 1, newlog);
+            fclose(newlog);
+            done = true;
+            printf("Copied rest of log. Ending replay.\n");
+            rr_end_replay_requested = 1;
+            return 0;
+        }
+
         snipping = true;
         printf("Continuing with replay.\n");
     }
@@ -401,6 +430,7 @@ bool init_plugin(void *self) {
         name = panda_parse_string(args, "name", "scissors");
         start_count = panda_parse_uint64(args, "start", 0);
         end_count = panda_parse_uint64(args, "end", UINT64_MAX);
+        stop = panda_parse_bool(args, "stop") && end_count == UINT64_MAX;
     }
 
     snprintf(nondet_name, 128, "%s-rr-nondet.log", name);
@@ -314,7 +314,7 @@ with open(PROTOS) as armcalls:
         calldatafill  = "for (auto x: "+cxx_vector_name +"){\n"
         calldatafill += "    x({0});\n".format(_args)
         calldatafill += "}\n"
-        calldatafill += "if (0 == ppp_on_{0}_num_cb) return;\n".format(sysretcallbackname)
+        calldatafill += "if (!PPP_CHECK_CB(on_{0})) return;\n".format(sysretcallbackname)
         calldatafill += "{0}* data = new {0};\n".format(calldataname)
         calldatafill += "data->pc = pc;\n"
         for x in arg_types:
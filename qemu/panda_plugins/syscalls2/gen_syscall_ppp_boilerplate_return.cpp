@@ -1,1054 +1,1054 @@
 #ifdef TARGET_ARM
-PPP_CB_BOILERPLATE(on_sys_setpgid_return)
-PPP_CB_BOILERPLATE(on_sys_truncate_return)
-PPP_CB_BOILERPLATE(on_sys_setfsgid_return)
-PPP_CB_BOILERPLATE(on_sys_setuid_return)
-PPP_CB_BOILERPLATE(on_sys_unlink_return)
-PPP_CB_BOILERPLATE(on_sys_io_setup_return)
-PPP_CB_BOILERPLATE(on_sys_timer_create_return)
-PPP_CB_BOILERPLATE(on_sys_fchown_return)
-PPP_CB_BOILERPLATE(on_sys_fchmodat_return)
-PPP_CB_BOILERPLATE(on_sys_sched_get_priority_max_return)
-PPP_CB_BOILERPLATE(on_sys_fsync_return)
-PPP_CB_BOILERPLATE(on_sys_getresgid_return)
-PPP_CB_BOILERPLATE(on_sys_chown_return)
-PPP_CB_BOILERPLATE(on_sys_faccessat_return)
-PPP_CB_BOILERPLATE(on_sys_getgroups_return)
-PPP_CB_BOILERPLATE(on_sys_setdomainname_return)
-PPP_CB_BOILERPLATE(on_sys_unlinkat_return)
-PPP_CB_BOILERPLATE(on_sys_getcpu_return)
-PPP_CB_BOILERPLATE(on_ARM_cacheflush_return)
-PPP_CB_BOILERPLATE(on_sys_setsid_return)
-PPP_CB_BOILERPLATE(on_sys_inotify_init1_return)
-PPP_CB_BOILERPLATE(on_sys_setregid16_return)
-PPP_CB_BOILERPLATE(on_sys_set_mempolicy_return)
-PPP_CB_BOILERPLATE(on_sys_clock_getres_return)
-PPP_CB_BOILERPLATE(on_sys_sysinfo_return)
-PPP_CB_BOILERPLATE(on_sys_setfsuid16_return)
-PPP_CB_BOILERPLATE(on_sys_clock_gettime_return)
-PPP_CB_BOILERPLATE(on_sys_getcwd_return)
-PPP_CB_BOILERPLATE(on_sys_chdir_return)
-PPP_CB_BOILERPLATE(on_sys_eventfd_return)
-PPP_CB_BOILERPLATE(on_sys_geteuid16_return)
-PPP_CB_BOILERPLATE(on_sys_fcntl64_return)
-PPP_CB_BOILERPLATE(on_sys_timer_gettime_return)
-PPP_CB_BOILERPLATE(on_sys_nfsservctl_return)
-PPP_CB_BOILERPLATE(on_sys_getitimer_return)
-PPP_CB_BOILERPLATE(on_sys_link_return)
-PPP_CB_BOILERPLATE(on_sys_getgid16_return)
-PPP_CB_BOILERPLATE(on_sys_mbind_return)
-PPP_CB_BOILERPLATE(on_sys_sendmsg_return)
-PPP_CB_BOILERPLATE(on_sys_sync_return)
-PPP_CB_BOILERPLATE(on_ARM_breakpoint_return)
-PPP_CB_BOILERPLATE(on_ARM_user26_mode_return)
-PPP_CB_BOILERPLATE(on_ARM_null_segfault_return)
-PPP_CB_BOILERPLATE(on_sys_mknod_return)
-PPP_CB_BOILERPLATE(on_sys_setregid_return)
-PPP_CB_BOILERPLATE(on_sys_geteuid_return)
-PPP_CB_BOILERPLATE(on_sys_timerfd_create_return)
-PPP_CB_BOILERPLATE(on_sys_shmat_return)
-PPP_CB_BOILERPLATE(on_sys_mprotect_return)
-PPP_CB_BOILERPLATE(on_sys_newlstat_return)
-PPP_CB_BOILERPLATE(on_sys_msgrcv_return)
-PPP_CB_BOILERPLATE(on_sys_pipe2_return)
-PPP_CB_BOILERPLATE(on_sys_ftruncate64_return)
-PPP_CB_BOILERPLATE(on_sys_swapon_return)
-PPP_CB_BOILERPLATE(on_sys_recv_return)
-PPP_CB_BOILERPLATE(on_sys_setfsuid_return)
-PPP_CB_BOILERPLATE(on_sys_getdents64_return)
-PPP_CB_BOILERPLATE(on_sys_readahead_return)
-PPP_CB_BOILERPLATE(on_sys_llseek_return)
-PPP_CB_BOILERPLATE(on_sys_fremovexattr_return)
-PPP_CB_BOILERPLATE(on_sys_pciconfig_write_return)
-PPP_CB_BOILERPLATE(on_sys_vhangup_return)
-PPP_CB_BOILERPLATE(on_sys_bdflush_return)
-PPP_CB_BOILERPLATE(on_sys_wait4_return)
-PPP_CB_BOILERPLATE(on_sys_lseek_return)
-PPP_CB_BOILERPLATE(on_sys_mq_timedreceive_return)
-PPP_CB_BOILERPLATE(on_sys_statfs64_return)
-PPP_CB_BOILERPLATE(on_sys_umask_return)
-PPP_CB_BOILERPLATE(on_sys_pread64_return)
-PPP_CB_BOILERPLATE(on_sys_lchown16_return)
-PPP_CB_BOILERPLATE(on_sys_semop_return)
-PPP_CB_BOILERPLATE(on_sys_lookup_dcookie_return)
-PPP_CB_BOILERPLATE(on_sys_stat64_return)
-PPP_CB_BOILERPLATE(on_sys_sched_getscheduler_return)
-PPP_CB_BOILERPLATE(on_sys_pivot_root_return)
-PPP_CB_BOILERPLATE(on_sys_lsetxattr_return)
-PPP_CB_BOILERPLATE(on_ARM_cmpxchg_return)
-PPP_CB_BOILERPLATE(on_sys_inotify_rm_watch_return)
-PPP_CB_BOILERPLATE(on_sys_send_return)
-PPP_CB_BOILERPLATE(on_sys_getgid_return)
-PPP_CB_BOILERPLATE(on_sys_flock_return)
-PPP_CB_BOILERPLATE(on_sys_tgkill_return)
-PPP_CB_BOILERPLATE(on_sys_utimes_return)
-PPP_CB_BOILERPLATE(on_sys_tee_return)
-PPP_CB_BOILERPLATE(on_sys_socketpair_return)
-PPP_CB_BOILERPLATE(on_sys_flistxattr_return)
-PPP_CB_BOILERPLATE(on_sys_getresuid_return)
-PPP_CB_BOILERPLATE(on_sys_fstatfs64_return)
-PPP_CB_BOILERPLATE(on_sys_setgid16_return)
-PPP_CB_BOILERPLATE(on_sys_eventfd2_return)
-PPP_CB_BOILERPLATE(on_sys_init_module_return)
-PPP_CB_BOILERPLATE(on_sys_mlockall_return)
-PPP_CB_BOILERPLATE(on_sys_io_submit_return)
-PPP_CB_BOILERPLATE(on_fork_return)
-PPP_CB_BOILERPLATE(on_sys_kill_return)
-PPP_CB_BOILERPLATE(on_sys_getpid_return)
-PPP_CB_BOILERPLATE(on_sys_fcntl_return)
-PPP_CB_BOILERPLATE(on_sys_quotactl_return)
-PPP_CB_BOILERPLATE(on_sys_adjtimex_return)
-PPP_CB_BOILERPLATE(on_sys_personality_return)
-PPP_CB_BOILERPLATE(on_sys_sync_file_range2_return)
-PPP_CB_BOILERPLATE(on_sys_add_key_return)
-PPP_CB_BOILERPLATE(on_sys_msync_return)
-PPP_CB_BOILERPLATE(on_sys_munmap_return)
-PPP_CB_BOILERPLATE(on_sys_ioprio_set_return)
-PPP_CB_BOILERPLATE(on_sys_writev_return)
-PPP_CB_BOILERPLATE(on_sys_fchown16_return)
-PPP_CB_BOILERPLATE(on_sys_sysctl_return)
-PPP_CB_BOILERPLATE(on_sys_timer_getoverrun_return)
-PPP_CB_BOILERPLATE(on_sys_mq_getsetattr_return)
-PPP_CB_BOILERPLATE(on_sys_rt_sigpending_return)
-PPP_CB_BOILERPLATE(on_sys_getxattr_return)
-PPP_CB_BOILERPLATE(on_sys_mkdir_return)
-PPP_CB_BOILERPLATE(on_sys_sched_getaffinity_return)
-PPP_CB_BOILERPLATE(on_sys_lremovexattr_return)
-PPP_CB_BOILERPLATE(on_sys_getsockopt_return)
-PPP_CB_BOILERPLATE(on_sys_unshare_return)
-PPP_CB_BOILERPLATE(on_sys_sethostname_return)
-PPP_CB_BOILERPLATE(on_sys_nice_return)
-PPP_CB_BOILERPLATE(on_sys_set_tid_address_return)
-PPP_CB_BOILERPLATE(on_sys_ptrace_return)
-PPP_CB_BOILERPLATE(on_sys_getegid_return)
-PPP_CB_BOILERPLATE(on_sys_setreuid_return)
-PPP_CB_BOILERPLATE(on_sys_arm_fadvise64_64_return)
-PPP_CB_BOILERPLATE(on_sys_rt_sigsuspend_return)
-PPP_CB_BOILERPLATE(on_execve_return)
-PPP_CB_BOILERPLATE(on_sys_settimeofday_return)
-PPP_CB_BOILERPLATE(on_sys_fgetxattr_return)
-PPP_CB_BOILERPLATE(on_sys_clock_settime_return)
-PPP_CB_BOILERPLATE(on_sys_mq_notify_return)
-PPP_CB_BOILERPLATE(on_sys_select_return)
-PPP_CB_BOILERPLATE(on_sys_getuid16_return)
-PPP_CB_BOILERPLATE(on_sys_removexattr_return)
-PPP_CB_BOILERPLATE(on_sys_io_destroy_return)
-PPP_CB_BOILERPLATE(on_sys_listen_return)
-PPP_CB_BOILERPLATE(on_sys_dup2_return)
-PPP_CB_BOILERPLATE(on_sys_io_cancel_return)
-PPP_CB_BOILERPLATE(on_sys_msgctl_return)
-PPP_CB_BOILERPLATE(on_sys_signalfd4_return)
-PPP_CB_BOILERPLATE(on_sys_kexec_load_return)
-PPP_CB_BOILERPLATE(on_sys_setresgid16_return)
-PPP_CB_BOILERPLATE(on_sys_sigpending_return)
-PPP_CB_BOILERPLATE(on_sys_getresgid16_return)
-PPP_CB_BOILERPLATE(on_sys_linkat_return)
-PPP_CB_BOILERPLATE(on_sys_setrlimit_return)
-PPP_CB_BOILERPLATE(on_sys_getpgid_return)
-PPP_CB_BOILERPLATE(on_sys_nanosleep_return)
-PPP_CB_BOILERPLATE(on_sys_open_return)
-PPP_CB_BOILERPLATE(on_sys_fchdir_return)
-PPP_CB_BOILERPLATE(on_sys_setgroups_return)
-PPP_CB_BOILERPLATE(on_sys_sched_setparam_return)
-PPP_CB_BOILERPLATE(on_sys_timer_settime_return)
-PPP_CB_BOILERPLATE(on_sys_mkdirat_return)
-PPP_CB_BOILERPLATE(on_sys_getrusage_return)
-PPP_CB_BOILERPLATE(on_vfork_return)
-PPP_CB_BOILERPLATE(on_sys_fdatasync_return)
-PPP_CB_BOILERPLATE(on_sys_clock_nanosleep_return)
-PPP_CB_BOILERPLATE(on_sys_chroot_return)
-PPP_CB_BOILERPLATE(on_sys_sendfile64_return)
-PPP_CB_BOILERPLATE(on_sys_getdents_return)
-PPP_CB_BOILERPLATE(on_sys_sendfile_return)
-PPP_CB_BOILERPLATE(on_sys_semget_return)
-PPP_CB_BOILERPLATE(on_sys_keyctl_return)
-PPP_CB_BOILERPLATE(on_sys_rmdir_return)
-PPP_CB_BOILERPLATE(on_sys_readlink_return)
-PPP_CB_BOILERPLATE(on_sys_capset_return)
-PPP_CB_BOILERPLATE(on_sys_recvmsg_return)
-PPP_CB_BOILERPLATE(on_sys_semctl_return)
-PPP_CB_BOILERPLATE(on_sys_acct_return)
-PPP_CB_BOILERPLATE(on_sys_prctl_return)
-PPP_CB_BOILERPLATE(on_sys_msgget_return)
-PPP_CB_BOILERPLATE(on_sys_setgroups16_return)
-PPP_CB_BOILERPLATE(on_sys_sysfs_return)
-PPP_CB_BOILERPLATE(on_sys_dup_return)
-PPP_CB_BOILERPLATE(on_sigreturn_return)
-PPP_CB_BOILERPLATE(on_sys_socket_return)
-PPP_CB_BOILERPLATE(on_sys_accept_return)
-PPP_CB_BOILERPLATE(on_sys_inotify_init_return)
-PPP_CB_BOILERPLATE(on_sys_fsetxattr_return)
-PPP_CB_BOILERPLATE(on_sys_pciconfig_iobase_return)
-PPP_CB_BOILERPLATE(on_sys_msgsnd_return)
-PPP_CB_BOILERPLATE(on_sys_setitimer_return)
-PPP_CB_BOILERPLATE(on_sys_getpgrp_return)
-PPP_CB_BOILERPLATE(on_sys_renameat_return)
-PPP_CB_BOILERPLATE(on_sys_rt_sigprocmask_return)
-PPP_CB_BOILERPLATE(on_sigaction_return)
-PPP_CB_BOILERPLATE(on_sys_readv_return)
-PPP_CB_BOILERPLATE(on_sys_openat_return)
-PPP_CB_BOILERPLATE(on_sys_timer_delete_return)
-PPP_CB_BOILERPLATE(on_sys_sendto_return)
-PPP_CB_BOILERPLATE(on_sys_move_pages_return)
-PPP_CB_BOILERPLATE(on_sys_symlinkat_return)
-PPP_CB_BOILERPLATE(on_sys_read_return)
-PPP_CB_BOILERPLATE(on_sys_connect_return)
-PPP_CB_BOILERPLATE(on_sys_epoll_wait_return)
-PPP_CB_BOILERPLATE(on_sys_getgroups16_return)
-PPP_CB_BOILERPLATE(on_do_mmap2_return)
-PPP_CB_BOILERPLATE(on_sys_io_getevents_return)
-PPP_CB_BOILERPLATE(on_sys_delete_module_return)
-PPP_CB_BOILERPLATE(on_sys_fstatfs_return)
-PPP_CB_BOILERPLATE(on_sys_set_robust_list_return)
-PPP_CB_BOILERPLATE(on_sys_munlock_return)
-PPP_CB_BOILERPLATE(on_sys_futex_return)
-PPP_CB_BOILERPLATE(on_sys_get_robust_list_return)
-PPP_CB_BOILERPLATE(on_sys_timerfd_settime_return)
-PPP_CB_BOILERPLATE(on_sys_setfsgid16_return)
-PPP_CB_BOILERPLATE(on_sys_lchown_return)
-PPP_CB_BOILERPLATE(on_sys_sched_setaffinity_return)
-PPP_CB_BOILERPLATE(on_sys_exit_return)
-PPP_CB_BOILERPLATE(on_sys_setsockopt_return)
-PPP_CB_BOILERPLATE(on_sys_request_key_return)
-PPP_CB_BOILERPLATE(on_sys_reboot_return)
-PPP_CB_BOILERPLATE(on_sys_setxattr_return)
-PPP_CB_BOILERPLATE(on_sys_close_return)
-PPP_CB_BOILERPLATE(on_sys_gettid_return)
-PPP_CB_BOILERPLATE(on_sys_waitid_return)
-PPP_CB_BOILERPLATE(on_ARM_set_tls_return)
-PPP_CB_BOILERPLATE(on_sys_shutdown_return)
-PPP_CB_BOILERPLATE(on_sys_getrlimit_return)
-PPP_CB_BOILERPLATE(on_sys_truncate64_return)
-PPP_CB_BOILERPLATE(on_sys_setuid16_return)
-PPP_CB_BOILERPLATE(on_sys_sched_rr_get_interval_return)
-PPP_CB_BOILERPLATE(on_sys_setgid_return)
-PPP_CB_BOILERPLATE(on_sys_pipe_return)
-PPP_CB_BOILERPLATE(on_sys_shmdt_return)
-PPP_CB_BOILERPLATE(on_sys_mlock_return)
-PPP_CB_BOILERPLATE(on_sys_timerfd_gettime_return)
-PPP_CB_BOILERPLATE(on_sys_semtimedop_return)
-PPP_CB_BOILERPLATE(on_sys_statfs_return)
-PPP_CB_BOILERPLATE(on_sys_access_return)
-PPP_CB_BOILERPLATE(on_sys_setresgid_return)
-PPP_CB_BOILERPLATE(on_sys_brk_return)
-PPP_CB_BOILERPLATE(on_sys_ioprio_get_return)
-PPP_CB_BOILERPLATE(on_sys_mq_timedsend_return)
-PPP_CB_BOILERPLATE(on_sys_munlockall_return)
-PPP_CB_BOILERPLATE(on_do_sigaltstack_return)
-PPP_CB_BOILERPLATE(on_sys_epoll_ctl_return)
-PPP_CB_BOILERPLATE(on_sys_getuid_return)
-PPP_CB_BOILERPLATE(on_sys_signalfd_return)
-PPP_CB_BOILERPLATE(on_sys_vmsplice_return)
-PPP_CB_BOILERPLATE(on_sys_sigprocmask_return)
-PPP_CB_BOILERPLATE(on_sys_fstat64_return)
-PPP_CB_BOILERPLATE(on_sys_remap_file_pages_return)
-PPP_CB_BOILERPLATE(on_sys_capget_return)
-PPP_CB_BOILERPLATE(on_sys_setresuid_return)
-PPP_CB_BOILERPLATE(on_sys_umount_return)
-PPP_CB_BOILERPLATE(on_sys_recvfrom_return)
-PPP_CB_BOILERPLATE(on_sys_pause_return)
-PPP_CB_BOILERPLATE(on_sys_fchmod_return)
-PPP_CB_BOILERPLATE(on_sys_swapoff_return)
-PPP_CB_BOILERPLATE(on_sys_ustat_return)
-PPP_CB_BOILERPLATE(on_sys_setpriority_return)
-PPP_CB_BOILERPLATE(on_sys_exit_group_return)
-PPP_CB_BOILERPLATE(on_sys_chmod_return)
-PPP_CB_BOILERPLATE(on_sys_write_return)
-PPP_CB_BOILERPLATE(on_sys_poll_return)
-PPP_CB_BOILERPLATE(on_sys_rename_return)
-PPP_CB_BOILERPLATE(on_sys_epoll_create1_return)
-PPP_CB_BOILERPLATE(on_sys_shmget_return)
-PPP_CB_BOILERPLATE(on_sys_fstatat64_return)
-PPP_CB_BOILERPLATE(on_sys_getegid16_return)
-PPP_CB_BOILERPLATE(on_sys_inotify_add_watch_return)
-PPP_CB_BOILERPLATE(on_sys_syslog_return)
-PPP_CB_BOILERPLATE(on_sys_chown16_return)
-PPP_CB_BOILERPLATE(on_sys_splice_return)
-PPP_CB_BOILERPLATE(on_sys_sched_getparam_return)
-PPP_CB_BOILERPLATE(on_sys_sched_yield_return)
-PPP_CB_BOILERPLATE(on_sys_futimesat_return)
-PPP_CB_BOILERPLATE(on_sys_fallocate_return)
-PPP_CB_BOILERPLATE(on_sys_sched_setscheduler_return)
-PPP_CB_BOILERPLATE(on_sys_times_return)
-PPP_CB_BOILERPLATE(on_sys_getppid_return)
-PPP_CB_BOILERPLATE(on_sys_ftruncate_return)
-PPP_CB_BOILERPLATE(on_sys_ioctl_return)
-PPP_CB_BOILERPLATE(on_ARM_usr32_mode_return)
-PPP_CB_BOILERPLATE(on_clone_return)
-PPP_CB_BOILERPLATE(on_sys_epoll_create_return)
-PPP_CB_BOILERPLATE(on_sys_mount_return)
-PPP_CB_BOILERPLATE(on_sys_pwrite64_return)
-PPP_CB_BOILERPLATE(on_sys_lstat64_return)
-PPP_CB_BOILERPLATE(on_sys_newfstat_return)
-PPP_CB_BOILERPLATE(on_sys_shmctl_return)
-PPP_CB_BOILERPLATE(on_sys_getsockname_return)
-PPP_CB_BOILERPLATE(on_sys_mq_open_return)
-PPP_CB_BOILERPLATE(on_sys_newuname_return)
-PPP_CB_BOILERPLATE(on_sys_getpriority_return)
-PPP_CB_BOILERPLATE(on_sys_restart_syscall_return)
-PPP_CB_BOILERPLATE(on_sys_sched_get_priority_min_return)
-PPP_CB_BOILERPLATE(on_sys_gettimeofday_return)
-PPP_CB_BOILERPLATE(on_sys_listxattr_return)
-PPP_CB_BOILERPLATE(on_sys_madvise_return)
-PPP_CB_BOILERPLATE(on_sys_lgetxattr_return)
-PPP_CB_BOILERPLATE(on_rt_sigaction_return)
-PPP_CB_BOILERPLATE(on_sys_mknodat_return)
-PPP_CB_BOILERPLATE(on_sys_readlinkat_return)
-PPP_CB_BOILERPLATE(on_sys_get_mempolicy_return)
-PPP_CB_BOILERPLATE(on_sys_rt_sigqueueinfo_return)
-PPP_CB_BOILERPLATE(on_sys_bind_return)
-PPP_CB_BOILERPLATE(on_sys_mincore_return)
-PPP_CB_BOILERPLATE(on_sys_fchownat_return)
-PPP_CB_BOILERPLATE(on_sys_utimensat_return)
-PPP_CB_BOILERPLATE(on_sys_setresuid16_return)
-PPP_CB_BOILERPLATE(on_sys_getsid_return)
-PPP_CB_BOILERPLATE(on_sys_dup3_return)
-PPP_CB_BOILERPLATE(on_sys_mq_unlink_return)
-PPP_CB_BOILERPLATE(on_sys_symlink_return)
-PPP_CB_BOILERPLATE(on_sys_llistxattr_return)
-PPP_CB_BOILERPLATE(on_sys_getpeername_return)
-PPP_CB_BOILERPLATE(on_sys_creat_return)
-PPP_CB_BOILERPLATE(on_sigsuspend_return)
-PPP_CB_BOILERPLATE(on_arm_mremap_return)
-PPP_CB_BOILERPLATE(on_sys_rt_sigtimedwait_return)
-PPP_CB_BOILERPLATE(on_sys_uselib_return)
-PPP_CB_BOILERPLATE(on_sys_newstat_return)
-PPP_CB_BOILERPLATE(on_sys_pciconfig_read_return)
-PPP_CB_BOILERPLATE(on_sys_tkill_return)
-PPP_CB_BOILERPLATE(on_sys_getresuid16_return)
-PPP_CB_BOILERPLATE(on_sys_setreuid16_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_setpgid_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_truncate_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_setfsgid_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_setuid_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_unlink_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_io_setup_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_timer_create_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_fchown_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_fchmodat_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_sched_get_priority_max_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_fsync_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getresgid_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_chown_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_faccessat_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getgroups_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_setdomainname_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_unlinkat_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getcpu_return)
+PPP_CB_BOILERPLATE_FILTERED(on_ARM_cacheflush_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_setsid_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_inotify_init1_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_setregid16_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_set_mempolicy_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_clock_getres_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_sysinfo_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_setfsuid16_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_clock_gettime_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getcwd_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_chdir_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_eventfd_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_geteuid16_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_fcntl64_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_timer_gettime_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_nfsservctl_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getitimer_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_link_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getgid16_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_mbind_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_sendmsg_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_sync_return)
+PPP_CB_BOILERPLATE_FILTERED(on_ARM_breakpoint_return)
+PPP_CB_BOILERPLATE_FILTERED(on_ARM_user26_mode_return)
+PPP_CB_BOILERPLATE_FILTERED(on_ARM_null_segfault_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_mknod_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_setregid_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_geteuid_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_timerfd_create_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_shmat_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_mprotect_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_newlstat_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_msgrcv_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_pipe2_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_ftruncate64_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_swapon_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_recv_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_setfsuid_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getdents64_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_readahead_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_llseek_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_fremovexattr_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_pciconfig_write_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_vhangup_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_bdflush_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_wait4_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_lseek_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_mq_timedreceive_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_statfs64_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_umask_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_pread64_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_lchown16_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_semop_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_lookup_dcookie_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_stat64_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_sched_getscheduler_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_pivot_root_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_lsetxattr_return)
+PPP_CB_BOILERPLATE_FILTERED(on_ARM_cmpxchg_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_inotify_rm_watch_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_send_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getgid_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_flock_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_tgkill_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_utimes_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_tee_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_socketpair_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_flistxattr_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getresuid_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_fstatfs64_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_setgid16_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_eventfd2_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_init_module_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_mlockall_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_io_submit_return)
+PPP_CB_BOILERPLATE_FILTERED(on_fork_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_kill_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getpid_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_fcntl_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_quotactl_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_adjtimex_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_personality_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_sync_file_range2_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_add_key_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_msync_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_munmap_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_ioprio_set_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_writev_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_fchown16_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_sysctl_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_timer_getoverrun_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_mq_getsetattr_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_rt_sigpending_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getxattr_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_mkdir_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_sched_getaffinity_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_lremovexattr_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getsockopt_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_unshare_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_sethostname_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_nice_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_set_tid_address_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_ptrace_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getegid_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_setreuid_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_arm_fadvise64_64_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_rt_sigsuspend_return)
+PPP_CB_BOILERPLATE_FILTERED(on_execve_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_settimeofday_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_fgetxattr_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_clock_settime_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_mq_notify_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_select_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getuid16_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_removexattr_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_io_destroy_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_listen_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_dup2_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_io_cancel_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_msgctl_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_signalfd4_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_kexec_load_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_setresgid16_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_sigpending_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getresgid16_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_linkat_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_setrlimit_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getpgid_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_nanosleep_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_open_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_fchdir_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_setgroups_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_sched_setparam_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_timer_settime_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_mkdirat_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getrusage_return)
+PPP_CB_BOILERPLATE_FILTERED(on_vfork_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_fdatasync_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_clock_nanosleep_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_chroot_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_sendfile64_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getdents_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_sendfile_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_semget_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_keyctl_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_rmdir_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_readlink_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_capset_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_recvmsg_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_semctl_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_acct_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_prctl_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_msgget_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_setgroups16_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_sysfs_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_dup_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sigreturn_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_socket_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_accept_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_inotify_init_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_fsetxattr_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_pciconfig_iobase_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_msgsnd_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_setitimer_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getpgrp_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_renameat_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_rt_sigprocmask_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sigaction_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_readv_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_openat_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_timer_delete_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_sendto_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_move_pages_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_symlinkat_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_read_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_connect_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_epoll_wait_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getgroups16_return)
+PPP_CB_BOILERPLATE_FILTERED(on_do_mmap2_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_io_getevents_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_delete_module_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_fstatfs_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_set_robust_list_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_munlock_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_futex_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_get_robust_list_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_timerfd_settime_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_setfsgid16_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_lchown_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_sched_setaffinity_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_exit_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_setsockopt_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_request_key_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_reboot_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_setxattr_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_close_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_gettid_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_waitid_return)
+PPP_CB_BOILERPLATE_FILTERED(on_ARM_set_tls_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_shutdown_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getrlimit_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_truncate64_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_setuid16_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_sched_rr_get_interval_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_setgid_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_pipe_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_shmdt_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_mlock_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_timerfd_gettime_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_semtimedop_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_statfs_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_access_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_setresgid_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_brk_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_ioprio_get_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_mq_timedsend_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_munlockall_return)
+PPP_CB_BOILERPLATE_FILTERED(on_do_sigaltstack_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_epoll_ctl_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getuid_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_signalfd_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_vmsplice_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_sigprocmask_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_fstat64_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_remap_file_pages_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_capget_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_setresuid_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_umount_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_recvfrom_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_pause_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_fchmod_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_swapoff_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_ustat_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_setpriority_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_exit_group_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_chmod_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_write_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_poll_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_rename_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_epoll_create1_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_shmget_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_fstatat64_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getegid16_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_inotify_add_watch_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_syslog_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_chown16_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_splice_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_sched_getparam_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_sched_yield_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_futimesat_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_fallocate_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_sched_setscheduler_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_times_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getppid_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_ftruncate_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_ioctl_return)
+PPP_CB_BOILERPLATE_FILTERED(on_ARM_usr32_mode_return)
+PPP_CB_BOILERPLATE_FILTERED(on_clone_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_epoll_create_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_mount_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_pwrite64_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_lstat64_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_newfstat_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_shmctl_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getsockname_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_mq_open_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_newuname_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getpriority_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_restart_syscall_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_sched_get_priority_min_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_gettimeofday_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_listxattr_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_madvise_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_lgetxattr_return)
+PPP_CB_BOILERPLATE_FILTERED(on_rt_sigaction_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_mknodat_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_readlinkat_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_get_mempolicy_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_rt_sigqueueinfo_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_bind_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_mincore_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_fchownat_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_utimensat_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_setresuid16_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getsid_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_dup3_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_mq_unlink_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_symlink_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_llistxattr_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getpeername_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_creat_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sigsuspend_return)
+PPP_CB_BOILERPLATE_FILTERED(on_arm_mremap_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_rt_sigtimedwait_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_uselib_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_newstat_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_pciconfig_read_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_tkill_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getresuid16_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_setreuid16_return)
 #endif
 #ifdef TARGET_I386
-PPP_CB_BOILERPLATE(on_sys_setpgid_return)
-PPP_CB_BOILERPLATE(on_sys_truncate_return)
-PPP_CB_BOILERPLATE(on_sys_setfsgid_return)
-PPP_CB_BOILERPLATE(on_sys_fchown16_return)
-PPP_CB_BOILERPLATE(on_sys_unlink_return)
-PPP_CB_BOILERPLATE(on_NtImpersonateThread_return)
-PPP_CB_BOILERPLATE(on_sys_sched_get_priority_max_return)
-PPP_CB_BOILERPLATE(on_sys_fsync_return)
-PPP_CB_BOILERPLATE(on_NtFlushProcessWriteBuffers_return)
-PPP_CB_BOILERPLATE(on_sys_unlinkat_return)
-PPP_CB_BOILERPLATE(on_NtReleaseKeyedEvent_return)
-PPP_CB_BOILERPLATE(on_NtClearEvent_return)
-PPP_CB_BOILERPLATE(on_NtFlushBuffersFile_return)
-PPP_CB_BOILERPLATE(on_sys_setregid16_return)
-PPP_CB_BOILERPLATE(on_NtAlpcCreateResourceReserve_return)
-PPP_CB_BOILERPLATE(on_sys_setfsuid16_return)
-PPP_CB_BOILERPLATE(on_sys_timer_getoverrun_return)
-PPP_CB_BOILERPLATE(on_sys_fsetxattr_return)
-PPP_CB_BOILERPLATE(on_NtSetInformationTransactionManager_return)
-PPP_CB_BOILERPLATE(on_NtQuerySystemEnvironmentValue_return)
-PPP_CB_BOILERPLATE(on_NtPrivilegeObjectAuditAlarm_return)
-PPP_CB_BOILERPLATE(on_NtCreateKeyTransacted_return)
-PPP_CB_BOILERPLATE(on_sys_link_return)
-PPP_CB_BOILERPLATE(on_NtCreateNamedPipeFile_return)
-PPP_CB_BOILERPLATE(on_NtQueryKey_return)
-PPP_CB_BOILERPLATE(on_sys_perf_event_open_return)
-PPP_CB_BOILERPLATE(on_sys_fstat_return)
-PPP_CB_BOILERPLATE(on_NtDuplicateObject_return)
-PPP_CB_BOILERPLATE(on_sys_mknod_return)
-PPP_CB_BOILERPLATE(on_sys_setregid_return)
-PPP_CB_BOILERPLATE(on_NtRequestPort_return)
-PPP_CB_BOILERPLATE(on_NtCreateMailslotFile_return)
-PPP_CB_BOILERPLATE(on_NtOpenThreadTokenEx_return)
-PPP_CB_BOILERPLATE(on_NtSaveMergedKeys_return)
-PPP_CB_BOILERPLATE(on_NtAccessCheckByTypeAndAuditAlarm_return)
-PPP_CB_BOILERPLATE(on_NtEnumerateTransactionObject_return)
-PPP_CB_BOILERPLATE(on_NtDrawText_return)
-PPP_CB_BOILERPLATE(on_NtAccessCheckByType_return)
-PPP_CB_BOILERPLATE(on_NtAlpcSendWaitReceivePort_return)
-PPP_CB_BOILERPLATE(on_sys_pread64_return)
-PPP_CB_BOILERPLATE(on_NtQueryTimerResolution_return)
-PPP_CB_BOILERPLATE(on_NtSetBootEntryOrder_return)
-PPP_CB_BOILERPLATE(on_NtSetInformationJobObject_return)
-PPP_CB_BOILERPLATE(on_NtQueryInformationFile_return)
-PPP_CB_BOILERPLATE(on_NtAllocateReserveObject_return)
-PPP_CB_BOILERPLATE(on_sys_inotify_rm_watch_return)
-PPP_CB_BOILERPLATE(on_NtListenPort_return)
-PPP_CB_BOILERPLATE(on_NtQueueApcThread_return)
-PPP_CB_BOILERPLATE(on_sys_add_key_return)
-PPP_CB_BOILERPLATE(on_sys_mbind_return)
-PPP_CB_BOILERPLATE(on_sys_tee_return)
-PPP_CB_BOILERPLATE(on_sys_setgid16_return)
-PPP_CB_BOILERPLATE(on_sys_mlockall_return)
-PPP_CB_BOILERPLATE(on_NtRaiseException_return)
-PPP_CB_BOILERPLATE(on_sys_kill_return)
-PPP_CB_BOILERPLATE(on_sys_getpid_return)
-PPP_CB_BOILERPLATE(on_sys_fcntl_return)
-PPP_CB_BOILERPLATE(on_sys_quotactl_return)
-PPP_CB_BOILERPLATE(on_sys_socketcall_return)
-PPP_CB_BOILERPLATE(on_NtCreateJobObject_return)
-PPP_CB_BOILERPLATE(on_sys_munmap_return)
-PPP_CB_BOILERPLATE(on_sys_ioprio_set_return)
-PPP_CB_BOILERPLATE(on_NtFlushInstallUILanguage_return)
-PPP_CB_BOILERPLATE(on_NtFilterToken_return)
-PPP_CB_BOILERPLATE(on_NtTraceEvent_return)
-PPP_CB_BOILERPLATE(on_NtReleaseSemaphore_return)
-PPP_CB_BOILERPLATE(on_NtGetWriteWatch_return)
-PPP_CB_BOILERPLATE(on_NtSinglePhaseReject_return)
-PPP_CB_BOILERPLATE(on_NtSetInformationProcess_return)
-PPP_CB_BOILERPLATE(on_sys_rt_tgsigqueueinfo_return)
-PPP_CB_BOILERPLATE(on_NtOpenSection_return)
-PPP_CB_BOILERPLATE(on_NtAlpcQueryInformation_return)
-PPP_CB_BOILERPLATE(on_NtCommitComplete_return)
-PPP_CB_BOILERPLATE(on_NtLoadDriver_return)
-PPP_CB_BOILERPLATE(on_sys_ptrace_return)
-PPP_CB_BOILERPLATE(on_sys_getegid_return)
-PPP_CB_BOILERPLATE(on_sys_sigpending_return)
-PPP_CB_BOILERPLATE(on_NtCreateEnlistment_return)
-PPP_CB_BOILERPLATE(on_NtMapViewOfSection_return)
-PPP_CB_BOILERPLATE(on_NtCreateThreadEx_return)
-PPP_CB_BOILERPLATE(on_sys_epoll_create1_return)
-PPP_CB_BOILERPLATE(on_NtLockRegistryKey_return)
-PPP_CB_BOILERPLATE(on_sys_uname_return)
-PPP_CB_BOILERPLATE(on_sys_openat_return)
-PPP_CB_BOILERPLATE(on_NtOpenSession_return)
-PPP_CB_BOILERPLATE(on_NtQueryLicenseValue_return)
-PPP_CB_BOILERPLATE(on_sys_setresgid16_return)
-PPP_CB_BOILERPLATE(on_sys_waitpid_return)
-PPP_CB_BOILERPLATE(on_sys_getresgid16_return)
-PPP_CB_BOILERPLATE(on_NtGetMUIRegistryInfo_return)
-PPP_CB_BOILERPLATE(on_NtCreateWorkerFactory_return)
-PPP_CB_BOILERPLATE(on_sys_lgetxattr_return)
-PPP_CB_BOILERPLATE(on_NtFreeUserPhysicalPages_return)
-PPP_CB_BOILERPLATE(on_sys_sendfile64_return)
-PPP_CB_BOILERPLATE(on_NtImpersonateAnonymousToken_return)
-PPP_CB_BOILERPLATE(on_sys_rmdir_return)
-PPP_CB_BOILERPLATE(on_NtRemoveProcessDebug_return)
-PPP_CB_BOILERPLATE(on_NtSetDefaultLocale_return)
-PPP_CB_BOILERPLATE(on_NtRollforwardTransactionManager_return)
-PPP_CB_BOILERPLATE(on_sys_getgid_return)
-PPP_CB_BOILERPLATE(on_NtPrepareComplete_return)
-PPP_CB_BOILERPLATE(on_NtCreatePort_return)
-PPP_CB_BOILERPLATE(on_NtCancelSynchronousIoFile_return)
-PPP_CB_BOILERPLATE(on_NtSetTimerResolution_return)
-PPP_CB_BOILERPLATE(on_NtCancelIoFileEx_return)
-PPP_CB_BOILERPLATE(on_NtUnloadKeyEx_return)
-PPP_CB_BOILERPLATE(on_NtSetInformationDebugObject_return)
-PPP_CB_BOILERPLATE(on_sigaction_return)
-PPP_CB_BOILERPLATE(on_sys_lremovexattr_return)
-PPP_CB_BOILERPLATE(on_sys_timer_delete_return)
-PPP_CB_BOILERPLATE(on_NtWaitForMultipleObjects_return)
-PPP_CB_BOILERPLATE(on_NtWaitForMultipleObjects32_return)
-PPP_CB_BOILERPLATE(on_NtAlpcCreateSecurityContext_return)
-PPP_CB_BOILERPLATE(on_NtGetNextProcess_return)
-PPP_CB_BOILERPLATE(on_sys_getgroups16_return)
-PPP_CB_BOILERPLATE(on_NtGetNlsSectionPtr_return)
-PPP_CB_BOILERPLATE(on_sys_setfsgid16_return)
-PPP_CB_BOILERPLATE(on_sys_lchown_return)
-PPP_CB_BOILERPLATE(on_NtGetNotificationResourceManager_return)
-PPP_CB_BOILERPLATE(on_sys_exit_return)
-PPP_CB_BOILERPLATE(on_NtSetHighWaitLowEventPair_return)
-PPP_CB_BOILERPLATE(on_NtDebugActiveProcess_return)
-PPP_CB_BOILERPLATE(on_NtCreateDirectoryObject_return)
-PPP_CB_BOILERPLATE(on_sys_gettid_return)
-PPP_CB_BOILERPLATE(on_NtSetEaFile_return)
-PPP_CB_BOILERPLATE(on_sys_stat_return)
-PPP_CB_BOILERPLATE(on_sys_open_by_handle_at_return)
-PPP_CB_BOILERPLATE(on_sys_epoll_pwait_return)
-PPP_CB_BOILERPLATE(on_sys_brk_return)
-PPP_CB_BOILERPLATE(on_NtOpenJobObject_return)
-PPP_CB_BOILERPLATE(on_sys_epoll_ctl_return)
-PPP_CB_BOILERPLATE(on_NtReadRequestData_return)
-PPP_CB_BOILERPLATE(on_NtAlpcCreateSectionView_return)
-PPP_CB_BOILERPLATE(on_NtRequestWaitReplyPort_return)
-PPP_CB_BOILERPLATE(on_sys_fstat64_return)
-PPP_CB_BOILERPLATE(on_sys_remap_file_pages_return)
-PPP_CB_BOILERPLATE(on_NtUnmapViewOfSection_return)
-PPP_CB_BOILERPLATE(on_sys_preadv_return)
-PPP_CB_BOILERPLATE(on_NtSuspendThread_return)
-PPP_CB_BOILERPLATE(on_NtMapUserPhysicalPages_return)
-PPP_CB_BOILERPLATE(on_NtQueryBootOptions_return)
-PPP_CB_BOILERPLATE(on_NtFlushInstructionCache_return)
-PPP_CB_BOILERPLATE(on_NtSetInformationKey_return)
-PPP_CB_BOILERPLATE(on_sys_sched_rr_get_interval_return)
-PPP_CB_BOILERPLATE(on_NtCreateEventPair_return)
-PPP_CB_BOILERPLATE(on_NtOpenKeyedEvent_return)
-PPP_CB_BOILERPLATE(on_sys_newuname_return)
-PPP_CB_BOILERPLATE(on_NtReadOnlyEnlistment_return)
-PPP_CB_BOILERPLATE(on_sys_prlimit64_return)
-PPP_CB_BOILERPLATE(on_sys_chown16_return)
-PPP_CB_BOILERPLATE(on_NtDisplayString_return)
-PPP_CB_BOILERPLATE(on_NtAdjustPrivilegesToken_return)
-PPP_CB_BOILERPLATE(on_sys_futimesat_return)
-PPP_CB_BOILERPLATE(on_NtSetInformationFile_return)
-PPP_CB_BOILERPLATE(on_NtSetVolumeInformationFile_return)
-PPP_CB_BOILERPLATE(on_NtAddAtom_return)
-PPP_CB_BOILERPLATE(on_sys_fanotify_init_return)
-PPP_CB_BOILERPLATE(on_sys_mount_return)
-PPP_CB_BOILERPLATE(on_sys_pwrite64_return)
-PPP_CB_BOILERPLATE(on_NtRemoveIoCompletionEx_return)
-PPP_CB_BOILERPLATE(on_NtCreateKey_return)
-PPP_CB_BOILERPLATE(on_sys_sched_get_priority_min_return)
-PPP_CB_BOILERPLATE(on_NtCreateTransaction_return)
-PPP_CB_BOILERPLATE(on_sys_gettimeofday_return)
-PPP_CB_BOILERPLATE(on_NtRestoreKey_return)
-PPP_CB_BOILERPLATE(on_NtSetSystemEnvironmentValueEx_return)
-PPP_CB_BOILERPLATE(on_sys_migrate_pages_return)
-PPP_CB_BOILERPLATE(on_sys_rt_sigqueueinfo_return)
-PPP_CB_BOILERPLATE(on_sys_pselect6_return)
-PPP_CB_BOILERPLATE(on_sys_fdatasync_return)
-PPP_CB_BOILERPLATE(on_sys_fchownat_return)
-PPP_CB_BOILERPLATE(on_sys_mq_unlink_return)
-PPP_CB_BOILERPLATE(on_NtSetSystemTime_return)
-PPP_CB_BOILERPLATE(on_NtPlugPlayControl_return)
-PPP_CB_BOILERPLATE(on_sys_sched_getparam_return)
-PPP_CB_BOILERPLATE(on_sys_rt_sigtimedwait_return)
-PPP_CB_BOILERPLATE(on_sys_ioctl_return)
-PPP_CB_BOILERPLATE(on_sys_newstat_return)
-PPP_CB_BOILERPLATE(on_NtPropagationComplete_return)
-PPP_CB_BOILERPLATE(on_sys_getresuid16_return)
-PPP_CB_BOILERPLATE(on_NtGetDevicePowerState_return)
-PPP_CB_BOILERPLATE(on_NtSetIntervalProfile_return)
-PPP_CB_BOILERPLATE(on_NtFlushKey_return)
-PPP_CB_BOILERPLATE(on_NtQueryDefaultUILanguage_return)
-PPP_CB_BOILERPLATE(on_NtWaitForDebugEvent_return)
-PPP_CB_BOILERPLATE(on_NtQueryDefaultLocale_return)
-PPP_CB_BOILERPLATE(on_NtCreateWaitablePort_return)
-PPP_CB_BOILERPLATE(on_sys_sendmmsg_return)
-PPP_CB_BOILERPLATE(on_sys_utimes_return)
-PPP_CB_BOILERPLATE(on_NtAssignProcessToJobObject_return)
-PPP_CB_BOILERPLATE(on_sys_get_robust_list_return)
-PPP_CB_BOILERPLATE(on_NtRecoverTransactionManager_return)
-PPP_CB_BOILERPLATE(on_sys_setsid_return)
-PPP_CB_BOILERPLATE(on_NtAccessCheckAndAuditAlarm_return)
-PPP_CB_BOILERPLATE(on_NtEnumerateSystemEnvironmentValuesEx_return)
-PPP_CB_BOILERPLATE(on_NtSetDebugFilterState_return)
-PPP_CB_BOILERPLATE(on_sys_readlink_return)
-PPP_CB_BOILERPLATE(on_NtQueryOpenSubKeysEx_return)
-PPP_CB_BOILERPLATE(on_sys_geteuid16_return)
-PPP_CB_BOILERPLATE(on_sys_fcntl64_return)
-PPP_CB_BOILERPLATE(on_sys_chown_return)
-PPP_CB_BOILERPLATE(on_sys_epoll_wait_return)
-PPP_CB_BOILERPLATE(on_NtAreMappedFilesTheSame_return)
-PPP_CB_BOILERPLATE(on_NtSaveKey_return)
-PPP_CB_BOILERPLATE(on_NtReadFile_return)
-PPP_CB_BOILERPLATE(on_sys_geteuid_return)
-PPP_CB_BOILERPLATE(on_NtClose_return)
-PPP_CB_BOILERPLATE(on_NtDeleteAtom_return)
-PPP_CB_BOILERPLATE(on_NtFsControlFile_return)
-PPP_CB_BOILERPLATE(on_sys_newlstat_return)
-PPP_CB_BOILERPLATE(on_NtReplyWaitReceivePort_return)
-PPP_CB_BOILERPLATE(on_NtAccessCheckByTypeResultListAndAuditAlarm_return)
-PPP_CB_BOILERPLATE(on_sys_setdomainname_return)
-PPP_CB_BOILERPLATE(on_NtCallbackReturn_return)
-PPP_CB_BOILERPLATE(on_NtCreatePrivateNamespace_return)
-PPP_CB_BOILERPLATE(on_NtDelayExecution_return)
-PPP_CB_BOILERPLATE(on_NtDeleteValueKey_return)
-PPP_CB_BOILERPLATE(on_NtLockProductActivationKeys_return)
-PPP_CB_BOILERPLATE(on_sys_vhangup_return)
-PPP_CB_BOILERPLATE(on_sys_wait4_return)
-PPP_CB_BOILERPLATE(on_sys_mq_timedreceive_return)
-PPP_CB_BOILERPLATE(on_sys_statfs64_return)
-PPP_CB_BOILERPLATE(on_NtDisableLastKnownGood_return)
-PPP_CB_BOILERPLATE(on_NtQueryFullAttributesFile_return)
-PPP_CB_BOILERPLATE(on_sys_lchown16_return)
-PPP_CB_BOILERPLATE(on_NtQueryInformationResourceManager_return)
-PPP_CB_BOILERPLATE(on_NtCreateProcessEx_return)
-PPP_CB_BOILERPLATE(on_sys_tgkill_return)
-PPP_CB_BOILERPLATE(on_NtCreateSymbolicLinkObject_return)
-PPP_CB_BOILERPLATE(on_sys_getresuid_return)
-PPP_CB_BOILERPLATE(on_sys_fstatfs64_return)
-PPP_CB_BOILERPLATE(on_NtMapCMFModule_return)
-PPP_CB_BOILERPLATE(on_sys_init_module_return)
-PPP_CB_BOILERPLATE(on_NtWriteFileGather_return)
-PPP_CB_BOILERPLATE(on_sys_timerfd_gettime_return)
-PPP_CB_BOILERPLATE(on_NtQueryDirectoryFile_return)
-PPP_CB_BOILERPLATE(on_NtCreateProfile_return)
-PPP_CB_BOILERPLATE(on_NtLoadKeyEx_return)
-PPP_CB_BOILERPLATE(on_NtSetHighEventPair_return)
-PPP_CB_BOILERPLATE(on_NtQueryInformationTransactionManager_return)
-PPP_CB_BOILERPLATE(on_sys_fadvise64_return)
-PPP_CB_BOILERPLATE(on_sys_oldumount_return)
-PPP_CB_BOILERPLATE(on_sys_personality_return)
-PPP_CB_BOILERPLATE(on_NtAlpcSetInformation_return)
-PPP_CB_BOILERPLATE(on_sys_msync_return)
-PPP_CB_BOILERPLATE(on_NtContinue_return)
-PPP_CB_BOILERPLATE(on_NtNotifyChangeDirectoryFile_return)
-PPP_CB_BOILERPLATE(on_sys_eventfd_return)
-PPP_CB_BOILERPLATE(on_NtCreateEvent_return)
-PPP_CB_BOILERPLATE(on_NtSaveKeyEx_return)
-PPP_CB_BOILERPLATE(on_NtWaitHighEventPair_return)
-PPP_CB_BOILERPLATE(on_sys_getxattr_return)
-PPP_CB_BOILERPLATE(on_NtQueryVolumeInformationFile_return)
-PPP_CB_BOILERPLATE(on_sys_fadvise64_64_return)
-PPP_CB_BOILERPLATE(on_NtQueryEvent_return)
-PPP_CB_BOILERPLATE(on_NtSetSystemInformation_return)
-PPP_CB_BOILERPLATE(on_NtOpenFile_return)
-PPP_CB_BOILERPLATE(on_NtPulseEvent_return)
-PPP_CB_BOILERPLATE(on_sys_getpgrp_return)
-PPP_CB_BOILERPLATE(on_NtQueryInstallUILanguage_return)
-PPP_CB_BOILERPLATE(on_NtAlpcOpenSenderProcess_return)
-PPP_CB_BOILERPLATE(on_NtSetContextThread_return)
-PPP_CB_BOILERPLATE(on_NtOpenSemaphore_return)
-PPP_CB_BOILERPLATE(on_sys_timer_settime_return)
-PPP_CB_BOILERPLATE(on_NtEnumerateValueKey_return)
-PPP_CB_BOILERPLATE(on_sys_kexec_load_return)
-PPP_CB_BOILERPLATE(on_NtInitiatePowerAction_return)
-PPP_CB_BOILERPLATE(on_sys_open_return)
-PPP_CB_BOILERPLATE(on_NtSetInformationObject_return)
-PPP_CB_BOILERPLATE(on_sys_setgroups_return)
-PPP_CB_BOILERPLATE(on_sys_getrusage_return)
-PPP_CB_BOILERPLATE(on_NtQueryObject_return)
-PPP_CB_BOILERPLATE(on_sys_eventfd2_return)
-PPP_CB_BOILERPLATE(on_NtSignalAndWaitForSingleObject_return)
-PPP_CB_BOILERPLATE(on_sys_old_select_return)
-PPP_CB_BOILERPLATE(on_NtLoadKey_return)
-PPP_CB_BOILERPLATE(on_NtAddBootEntry_return)
-PPP_CB_BOILERPLATE(on_NtSetInformationResourceManager_return)
-PPP_CB_BOILERPLATE(on_sys_pivot_root_return)
-PPP_CB_BOILERPLATE(on_NtQuerySemaphore_return)
-PPP_CB_BOILERPLATE(on_sys_inotify_init_return)
-PPP_CB_BOILERPLATE(on_sys_fgetxattr_return)
-PPP_CB_BOILERPLATE(on_sys_io_cancel_return)
-PPP_CB_BOILERPLATE(on_NtSetEvent_return)
-PPP_CB_BOILERPLATE(on_NtQuerySystemInformationEx_return)
-PPP_CB_BOILERPLATE(on_NtThawTransactions_return)
-PPP_CB_BOILERPLATE(on_NtAlpcAcceptConnectPort_return)
-PPP_CB_BOILERPLATE(on_sys_delete_module_return)
-PPP_CB_BOILERPLATE(on_sys_olduname_return)
-PPP_CB_BOILERPLATE(on_NtFlushWriteBuffer_return)
-PPP_CB_BOILERPLATE(on_NtTestAlert_return)
-PPP_CB_BOILERPLATE(on_NtOpenProcess_return)
-PPP_CB_BOILERPLATE(on_sys_modify_ldt_return)
-PPP_CB_BOILERPLATE(on_sys_old_readdir_return)
-PPP_CB_BOILERPLATE(on_NtMakeTemporaryObject_return)
-PPP_CB_BOILERPLATE(on_sys_waitid_return)
-PPP_CB_BOILERPLATE(on_sys_vfork_return)
-PPP_CB_BOILERPLATE(on_NtRollbackEnlistment_return)
-PPP_CB_BOILERPLATE(on_NtSetIoCompletionEx_return)
-PPP_CB_BOILERPLATE(on_sys_fork_return)
-PPP_CB_BOILERPLATE(on_NtModifyDriverEntry_return)
-PPP_CB_BOILERPLATE(on_NtQueryInformationWorkerFactory_return)
-PPP_CB_BOILERPLATE(on_NtAlpcRevokeSecurityContext_return)
-PPP_CB_BOILERPLATE(on_NtCreateDebugObject_return)
-PPP_CB_BOILERPLATE(on_NtWriteRequestData_return)
-PPP_CB_BOILERPLATE(on_sys_nanosleep_return)
-PPP_CB_BOILERPLATE(on_sys_flistxattr_return)
-PPP_CB_BOILERPLATE(on_sys_sigreturn_return)
-PPP_CB_BOILERPLATE(on_NtImpersonateClientOfPort_return)
-PPP_CB_BOILERPLATE(on_sys_process_vm_readv_return)
-PPP_CB_BOILERPLATE(on_sys_capget_return)
-PPP_CB_BOILERPLATE(on_NtSetInformationEnlistment_return)
-PPP_CB_BOILERPLATE(on_NtCreateProcess_return)
-PPP_CB_BOILERPLATE(on_sys_fchmod_return)
-PPP_CB_BOILERPLATE(on_sys_swapoff_return)
-PPP_CB_BOILERPLATE(on_NtQueryMutant_return)
-PPP_CB_BOILERPLATE(on_NtAdjustGroupsToken_return)
-PPP_CB_BOILERPLATE(on_NtApphelpCacheControl_return)
-PPP_CB_BOILERPLATE(on_NtSecureConnectPort_return)
-PPP_CB_BOILERPLATE(on_sys_chmod_return)
-PPP_CB_BOILERPLATE(on_NtTerminateThread_return)
-PPP_CB_BOILERPLATE(on_sys_poll_return)
-PPP_CB_BOILERPLATE(on_NtSetDefaultHardErrorPort_return)
-PPP_CB_BOILERPLATE(on_sys_splice_return)
-PPP_CB_BOILERPLATE(on_NtAlertThread_return)
-PPP_CB_BOILERPLATE(on_NtQueryInformationJobObject_return)
-PPP_CB_BOILERPLATE(on_sys_inotify_add_watch_return)
-PPP_CB_BOILERPLATE(on_sys_sysinfo_return)
-PPP_CB_BOILERPLATE(on_sys_uselib_return)
-PPP_CB_BOILERPLATE(on_NtYieldExecution_return)
-PPP_CB_BOILERPLATE(on_NtDeleteDriverEntry_return)
-PPP_CB_BOILERPLATE(on_NtOpenProcessToken_return)
-PPP_CB_BOILERPLATE(on_NtRaiseHardError_return)
-PPP_CB_BOILERPLATE(on_sys_utime_return)
-PPP_CB_BOILERPLATE(on_sys_newfstat_return)
-PPP_CB_BOILERPLATE(on_NtRecoverEnlistment_return)
-PPP_CB_BOILERPLATE(on_sys_mq_open_return)
-PPP_CB_BOILERPLATE(on_NtAlpcDeleteSectionView_return)
-PPP_CB_BOILERPLATE(on_NtAllocateUuids_return)
-PPP_CB_BOILERPLATE(on_NtCreateTransactionManager_return)
-PPP_CB_BOILERPLATE(on_NtAlpcImpersonateClientOfPort_return)
-PPP_CB_BOILERPLATE(on_NtQueryInformationPort_return)
-PPP_CB_BOILERPLATE(on_rt_sigaction_return)
-PPP_CB_BOILERPLATE(on_sys_process_vm_writev_return)
-PPP_CB_BOILERPLATE(on_NtDeleteObjectAuditAlarm_return)
-PPP_CB_BOILERPLATE(on_sys_readlinkat_return)
-PPP_CB_BOILERPLATE(on_NtPrivilegeCheck_return)
-PPP_CB_BOILERPLATE(on_NtQuerySecurityObject_return)
-PPP_CB_BOILERPLATE(on_sys_signal_return)
-PPP_CB_BOILERPLATE(on_sys_dup3_return)
-PPP_CB_BOILERPLATE(on_NtSetInformationTransaction_return)
-PPP_CB_BOILERPLATE(on_sys_symlink_return)
-PPP_CB_BOILERPLATE(on_NtAlpcOpenSenderThread_return)
-PPP_CB_BOILERPLATE(on_NtOpenKeyEx_return)
-PPP_CB_BOILERPLATE(on_sys_clock_adjtime_return)
-PPP_CB_BOILERPLATE(on_NtAccessCheckByTypeResultList_return)
-PPP_CB_BOILERPLATE(on_NtFlushVirtualMemory_return)
-PPP_CB_BOILERPLATE(on_NtReleaseMutant_return)
-PPP_CB_BOILERPLATE(on_NtSetDriverEntryOrder_return)
-PPP_CB_BOILERPLATE(on_sys_setreuid16_return)
-PPP_CB_BOILERPLATE(on_sys_io_setup_return)
-PPP_CB_BOILERPLATE(on_NtCreateResourceManager_return)
-PPP_CB_BOILERPLATE(on_NtAlertResumeThread_return)
-PPP_CB_BOILERPLATE(on_NtCreateMutant_return)
-PPP_CB_BOILERPLATE(on_sys_getresgid_return)
-PPP_CB_BOILERPLATE(on_NtQueryInformationAtom_return)
-PPP_CB_BOILERPLATE(on_sys_getgroups_return)
-PPP_CB_BOILERPLATE(on_NtOpenProcessTokenEx_return)
-PPP_CB_BOILERPLATE(on_NtDeviceIoControlFile_return)
-PPP_CB_BOILERPLATE(on_NtQueryMultipleValueKey_return)
-PPP_CB_BOILERPLATE(on_sys_set_tid_address_return)
-PPP_CB_BOILERPLATE(on_sys_set_robust_list_return)
-PPP_CB_BOILERPLATE(on_NtCreateSemaphore_return)
-PPP_CB_BOILERPLATE(on_sys_clock_gettime_return)
-PPP_CB_BOILERPLATE(on_NtAlpcConnectPort_return)
-PPP_CB_BOILERPLATE(on_NtQuerySymbolicLinkObject_return)
-PPP_CB_BOILERPLATE(on_sys_getitimer_return)
-PPP_CB_BOILERPLATE(on_sys_swapon_return)
-PPP_CB_BOILERPLATE(on_NtOpenEvent_return)
-PPP_CB_BOILERPLATE(on_NtNotifyChangeSession_return)
-PPP_CB_BOILERPLATE(on_NtOpenPrivateNamespace_return)
-PPP_CB_BOILERPLATE(on_NtCreateTimer_return)
-PPP_CB_BOILERPLATE(on_NtSetLdtEntries_return)
-PPP_CB_BOILERPLATE(on_NtQuerySystemInformation_return)
-PPP_CB_BOILERPLATE(on_NtFindAtom_return)
-PPP_CB_BOILERPLATE(on_NtCompleteConnectPort_return)
-PPP_CB_BOILERPLATE(on_NtDeleteBootEntry_return)
-PPP_CB_BOILERPLATE(on_NtCloseObjectAuditAlarm_return)
-PPP_CB_BOILERPLATE(on_sys_mprotect_return)
-PPP_CB_BOILERPLATE(on_NtQueryDriverEntryOrder_return)
-PPP_CB_BOILERPLATE(on_NtWorkerFactoryWorkerReady_return)
-PPP_CB_BOILERPLATE(on_sys_ftruncate64_return)
-PPP_CB_BOILERPLATE(on_sys_exit_group_return)
-PPP_CB_BOILERPLATE(on_NtDeletePrivateNamespace_return)
-PPP_CB_BOILERPLATE(on_sys_setfsuid_return)
-PPP_CB_BOILERPLATE(on_sys_getdents64_return)
-PPP_CB_BOILERPLATE(on_NtExtendSection_return)
-PPP_CB_BOILERPLATE(on_NtEnumerateKey_return)
-PPP_CB_BOILERPLATE(on_sys_mlock_return)
-PPP_CB_BOILERPLATE(on_sys_bdflush_return)
-PPP_CB_BOILERPLATE(on_NtSetInformationToken_return)
-PPP_CB_BOILERPLATE(on_sys_lseek_return)
-PPP_CB_BOILERPLATE(on_NtAlpcDeletePortSection_return)
-PPP_CB_BOILERPLATE(on_sys_sgetmask_return)
-PPP_CB_BOILERPLATE(on_NtRegisterThreadTerminatePort_return)
-PPP_CB_BOILERPLATE(on_NtDeleteKey_return)
-PPP_CB_BOILERPLATE(on_sys_faccessat_return)
-PPP_CB_BOILERPLATE(on_sys_sched_getscheduler_return)
-PPP_CB_BOILERPLATE(on_sys_name_to_handle_at_return)
-PPP_CB_BOILERPLATE(on_sys_access_return)
-PPP_CB_BOILERPLATE(on_NtWriteVirtualMemory_return)
-PPP_CB_BOILERPLATE(on_NtTerminateJobObject_return)
-PPP_CB_BOILERPLATE(on_sys_setresgid_return)
-PPP_CB_BOILERPLATE(on_NtSetThreadExecutionState_return)
-PPP_CB_BOILERPLATE(on_NtSetBootOptions_return)
-PPP_CB_BOILERPLATE(on_NtRemoveIoCompletion_return)
-PPP_CB_BOILERPLATE(on_NtShutdownWorkerFactory_return)
-PPP_CB_BOILERPLATE(on_NtTranslateFilePath_return)
-PPP_CB_BOILERPLATE(on_NtMapUserPhysicalPagesScatter_return)
-PPP_CB_BOILERPLATE(on_NtWriteFile_return)
-PPP_CB_BOILERPLATE(on_NtAllocateUserPhysicalPages_return)
-PPP_CB_BOILERPLATE(on_NtAlpcDeleteResourceReserve_return)
-PPP_CB_BOILERPLATE(on_sys_getcpu_return)
-PPP_CB_BOILERPLATE(on_NtQueryInformationThread_return)
-PPP_CB_BOILERPLATE(on_NtUnlockFile_return)
-PPP_CB_BOILERPLATE(on_sys_old_getrlimit_return)
-PPP_CB_BOILERPLATE(on_NtSetEventBoostPriority_return)
-PPP_CB_BOILERPLATE(on_sys_rt_sigpending_return)
-PPP_CB_BOILERPLATE(on_sys_mkdir_return)
-PPP_CB_BOILERPLATE(on_sys_unshare_return)
-PPP_CB_BOILERPLATE(on_NtQueueApcThreadEx_return)
-PPP_CB_BOILERPLATE(on_NtOpenObjectAuditAlarm_return)
-PPP_CB_BOILERPLATE(on_NtResumeProcess_return)
-PPP_CB_BOILERPLATE(on_NtQuerySystemTime_return)
-PPP_CB_BOILERPLATE(on_NtUmsThreadYield_return)
-PPP_CB_BOILERPLATE(on_NtQueryInformationTransaction_return)
-PPP_CB_BOILERPLATE(on_sys_clock_settime_return)
-PPP_CB_BOILERPLATE(on_NtSetIoCompletion_return)
-PPP_CB_BOILERPLATE(on_sys_settimeofday_return)
-PPP_CB_BOILERPLATE(on_NtQueryBootEntryOrder_return)
-PPP_CB_BOILERPLATE(on_NtQueryQuotaInformationFile_return)
-PPP_CB_BOILERPLATE(on_sys_mq_notify_return)
-PPP_CB_BOILERPLATE(on_get_thread_area_return)
-PPP_CB_BOILERPLATE(on_sys_getuid16_return)
-PPP_CB_BOILERPLATE(on_NtSetInformationWorkerFactory_return)
-PPP_CB_BOILERPLATE(on_NtLockVirtualMemory_return)
-PPP_CB_BOILERPLATE(on_NtDeleteFile_return)
-PPP_CB_BOILERPLATE(on_NtFreezeTransactions_return)
-PPP_CB_BOILERPLATE(on_NtQuerySection_return)
-PPP_CB_BOILERPLATE(on_sys_sigaltstack_return)
-PPP_CB_BOILERPLATE(on_sys_recvmmsg_return)
-PPP_CB_BOILERPLATE(on_sys_getpgid_return)
-PPP_CB_BOILERPLATE(on_NtSystemDebugControl_return)
-PPP_CB_BOILERPLATE(on_sys_time_return)
-PPP_CB_BOILERPLATE(on_sys_signalfd_return)
-PPP_CB_BOILERPLATE(on_sys_fchdir_return)
-PPP_CB_BOILERPLATE(on_NtVdmControl_return)
-PPP_CB_BOILERPLATE(on_sys_mkdirat_return)
-PPP_CB_BOILERPLATE(on_sys_readahead_return)
-PPP_CB_BOILERPLATE(on_NtAcceptConnectPort_return)
-PPP_CB_BOILERPLATE(on_sys_get_mempolicy_return)
-PPP_CB_BOILERPLATE(on_sys_mincore_return)
-PPP_CB_BOILERPLATE(on_sys_fchmodat_return)
-PPP_CB_BOILERPLATE(on_NtFreezeRegistry_return)
-PPP_CB_BOILERPLATE(on_sys_keyctl_return)
-PPP_CB_BOILERPLATE(on_sys_set_mempolicy_return)
-PPP_CB_BOILERPLATE(on_sys_capset_return)
-PPP_CB_BOILERPLATE(on_NtResumeThread_return)
-PPP_CB_BOILERPLATE(on_sys_dup_return)
-PPP_CB_BOILERPLATE(on_NtCreateSection_return)
-PPP_CB_BOILERPLATE(on_sys_mq_getsetattr_return)
-PPP_CB_BOILERPLATE(on_NtIsSystemResumeAutomatic_return)
-PPP_CB_BOILERPLATE(on_NtSetInformationThread_return)
-PPP_CB_BOILERPLATE(on_sys_setitimer_return)
-PPP_CB_BOILERPLATE(on_sys_mq_timedsend_return)
-PPP_CB_BOILERPLATE(on_sys_rt_sigprocmask_return)
-PPP_CB_BOILERPLATE(on_sys_signalfd4_return)
-PPP_CB_BOILERPLATE(on_NtOpenEventPair_return)
-PPP_CB_BOILERPLATE(on_sys_io_submit_return)
-PPP_CB_BOILERPLATE(on_NtQueryPerformanceCounter_return)
-PPP_CB_BOILERPLATE(on_NtQueryDirectoryObject_return)
-PPP_CB_BOILERPLATE(on_sys_setxattr_return)
-PPP_CB_BOILERPLATE(on_sys_io_getevents_return)
-PPP_CB_BOILERPLATE(on_sys_pipe_return)
-PPP_CB_BOILERPLATE(on_NtAlpcDeleteSecurityContext_return)
-PPP_CB_BOILERPLATE(on_NtSetValueKey_return)
-PPP_CB_BOILERPLATE(on_NtShutdownSystem_return)
-PPP_CB_BOILERPLATE(on_sys_sched_setaffinity_return)
-PPP_CB_BOILERPLATE(on_NtQueryValueKey_return)
-PPP_CB_BOILERPLATE(on_sys_llistxattr_return)
-PPP_CB_BOILERPLATE(on_NtOpenIoCompletion_return)
-PPP_CB_BOILERPLATE(on_NtReplacePartitionUnit_return)
-PPP_CB_BOILERPLATE(on_NtDuplicateToken_return)
-PPP_CB_BOILERPLATE(on_NtRenameTransactionManager_return)
-PPP_CB_BOILERPLATE(on_sys_getrlimit_return)
-PPP_CB_BOILERPLATE(on_sys_truncate64_return)
-PPP_CB_BOILERPLATE(on_NtIsUILanguageComitted_return)
-PPP_CB_BOILERPLATE(on_sys_listxattr_return)
-PPP_CB_BOILERPLATE(on_sys_linkat_return)
-PPP_CB_BOILERPLATE(on_sys_stat64_return)
-PPP_CB_BOILERPLATE(on_NtSetLowWaitHighEventPair_return)
-PPP_CB_BOILERPLATE(on_NtQueryVirtualMemory_return)
-PPP_CB_BOILERPLATE(on_NtEnableLastKnownGood_return)
-PPP_CB_BOILERPLATE(on_NtCompactKeys_return)
-PPP_CB_BOILERPLATE(on_sys_ppoll_return)
-PPP_CB_BOILERPLATE(on_NtReplyWaitReceivePortEx_return)
-PPP_CB_BOILERPLATE(on_NtConnectPort_return)
-PPP_CB_BOILERPLATE(on_NtAlpcCreatePort_return)
-PPP_CB_BOILERPLATE(on_NtCreateFile_return)
-PPP_CB_BOILERPLATE(on_sys_lstat_return)
-PPP_CB_BOILERPLATE(on_sys_pause_return)
-PPP_CB_BOILERPLATE(on_NtRollbackTransaction_return)
-PPP_CB_BOILERPLATE(on_NtOpenKeyTransacted_return)
-PPP_CB_BOILERPLATE(on_sys_ustat_return)
-PPP_CB_BOILERPLATE(on_sys_write_return)
-PPP_CB_BOILERPLATE(on_sys_rename_return)
-PPP_CB_BOILERPLATE(on_NtModifyBootEntry_return)
-PPP_CB_BOILERPLATE(on_NtGetCurrentProcessorNumber_return)
-PPP_CB_BOILERPLATE(on_NtOpenResourceManager_return)
-PPP_CB_BOILERPLATE(on_sys_syslog_return)
-PPP_CB_BOILERPLATE(on_NtCompareTokens_return)
-PPP_CB_BOILERPLATE(on_sys_fallocate_return)
-PPP_CB_BOILERPLATE(on_sys_sched_setscheduler_return)
-PPP_CB_BOILERPLATE(on_sys_getppid_return)
-PPP_CB_BOILERPLATE(on_NtNotifyChangeKey_return)
-PPP_CB_BOILERPLATE(on_sys_clone_return)
-PPP_CB_BOILERPLATE(on_sys_vm86_return)
-PPP_CB_BOILERPLATE(on_sys_lstat64_return)
-PPP_CB_BOILERPLATE(on_NtStopProfile_return)
-PPP_CB_BOILERPLATE(on_sys_restart_syscall_return)
-PPP_CB_BOILERPLATE(on_sys_lsetxattr_return)
-PPP_CB_BOILERPLATE(on_NtQueryAttributesFile_return)
-PPP_CB_BOILERPLATE(on_NtResetWriteWatch_return)
-PPP_CB_BOILERPLATE(on_sys_syncfs_return)
-PPP_CB_BOILERPLATE(on_NtCancelTimer_return)
-PPP_CB_BOILERPLATE(on_NtLoadKey2_return)
-PPP_CB_BOILERPLATE(on_NtOpenThread_return)
-PPP_CB_BOILERPLATE(on_sys_utimensat_return)
-PPP_CB_BOILERPLATE(on_NtGetPlugPlayEvent_return)
-PPP_CB_BOILERPLATE(on_sys_munlockall_return)
-PPP_CB_BOILERPLATE(on_sys_getegid16_return)
-PPP_CB_BOILERPLATE(on_NtAddDriverEntry_return)
-PPP_CB_BOILERPLATE(on_sys_execve_return)
-PPP_CB_BOILERPLATE(on_sys_tkill_return)
-PPP_CB_BOILERPLATE(on_sys_sync_file_range_return)
-PPP_CB_BOILERPLATE(on_NtRollbackComplete_return)
-PPP_CB_BOILERPLATE(on_NtWaitForWorkViaWorkerFactory_return)
-PPP_CB_BOILERPLATE(on_NtQueryInformationToken_return)
-PPP_CB_BOILERPLATE(on_sys_timer_create_return)
-PPP_CB_BOILERPLATE(on_sys_fchown_return)
-PPP_CB_BOILERPLATE(on_sys_pwritev_return)
-PPP_CB_BOILERPLATE(on_NtPrePrepareComplete_return)
-PPP_CB_BOILERPLATE(on_NtDebugContinue_return)
-PPP_CB_BOILERPLATE(on_sys_ioperm_return)
-PPP_CB_BOILERPLATE(on_NtNotifyChangeMultipleKeys_return)
-PPP_CB_BOILERPLATE(on_NtSetTimerEx_return)
-PPP_CB_BOILERPLATE(on_NtSetLowEventPair_return)
-PPP_CB_BOILERPLATE(on_NtLockFile_return)
-PPP_CB_BOILERPLATE(on_sys_rt_sigreturn_return)
-PPP_CB_BOILERPLATE(on_sys_clock_getres_return)
-PPP_CB_BOILERPLATE(on_sys_sendfile_return)
-PPP_CB_BOILERPLATE(on_sys_chdir_return)
-PPP_CB_BOILERPLATE(on_sys_ftruncate_return)
-PPP_CB_BOILERPLATE(on_NtUnloadDriver_return)
-PPP_CB_BOILERPLATE(on_sys_timer_gettime_return)
-PPP_CB_BOILERPLATE(on_NtOpenTransaction_return)
-PPP_CB_BOILERPLATE(on_sys_getgid16_return)
-PPP_CB_BOILERPLATE(on_sys_sync_return)
-PPP_CB_BOILERPLATE(on_NtUnloadKey2_return)
-PPP_CB_BOILERPLATE(on_NtRegisterProtocolAddressInformation_return)
-PPP_CB_BOILERPLATE(on_NtOpenEnlistment_return)
-PPP_CB_BOILERPLATE(on_sys_symlinkat_return)
-PPP_CB_BOILERPLATE(on_NtGetNextThread_return)
-PPP_CB_BOILERPLATE(on_sys_stime_return)
-PPP_CB_BOILERPLATE(on_NtOpenKeyTransactedEx_return)
-PPP_CB_BOILERPLATE(on_NtQueryTimer_return)
-PPP_CB_BOILERPLATE(on_sys_timerfd_create_return)
-PPP_CB_BOILERPLATE(on_NtSetUuidSeed_return)
-PPP_CB_BOILERPLATE(on_sys_pipe2_return)
-PPP_CB_BOILERPLATE(on_NtSetQuotaInformationFile_return)
-PPP_CB_BOILERPLATE(on_NtSetTimer_return)
-PPP_CB_BOILERPLATE(on_NtCreateProfileEx_return)
-PPP_CB_BOILERPLATE(on_sys_vm86old_return)
-PPP_CB_BOILERPLATE(on_NtGetContextThread_return)
-PPP_CB_BOILERPLATE(on_NtSuspendProcess_return)
-PPP_CB_BOILERPLATE(on_sys_umask_return)
-PPP_CB_BOILERPLATE(on_sys_iopl_return)
-PPP_CB_BOILERPLATE(on_NtQueryInformationEnlistment_return)
-PPP_CB_BOILERPLATE(on_sys_old_mmap_return)
-PPP_CB_BOILERPLATE(on_NtPrePrepareEnlistment_return)
-PPP_CB_BOILERPLATE(on_NtStartProfile_return)
-PPP_CB_BOILERPLATE(on_sys_fstatat64_return)
-PPP_CB_BOILERPLATE(on_NtUnloadKey_return)
-PPP_CB_BOILERPLATE(on_NtCompressKey_return)
-PPP_CB_BOILERPLATE(on_NtPrivilegedServiceAuditAlarm_return)
-PPP_CB_BOILERPLATE(on_NtAlpcQueryInformationMessage_return)
-PPP_CB_BOILERPLATE(on_NtQuerySecurityAttributesToken_return)
-PPP_CB_BOILERPLATE(on_NtReadFileScatter_return)
-PPP_CB_BOILERPLATE(on_NtReplyPort_return)
-PPP_CB_BOILERPLATE(on_NtProtectVirtualMemory_return)
-PPP_CB_BOILERPLATE(on_sys_getsid_return)
-PPP_CB_BOILERPLATE(on_NtQueryEaFile_return)
-PPP_CB_BOILERPLATE(on_NtQueryIoCompletion_return)
-PPP_CB_BOILERPLATE(on_sys_adjtimex_return)
-PPP_CB_BOILERPLATE(on_NtEnumerateBootEntries_return)
-PPP_CB_BOILERPLATE(on_NtQueryIntervalProfile_return)
-PPP_CB_BOILERPLATE(on_sys_writev_return)
-PPP_CB_BOILERPLATE(on_sys_setuid_return)
-PPP_CB_BOILERPLATE(on_sys_sysctl_return)
-PPP_CB_BOILERPLATE(on_NtCancelIoFile_return)
-PPP_CB_BOILERPLATE(on_NtAlpcCreatePortSection_return)
-PPP_CB_BOILERPLATE(on_NtOpenKey_return)
-PPP_CB_BOILERPLATE(on_sys_sched_getaffinity_return)
-PPP_CB_BOILERPLATE(on_NtAccessCheck_return)
-PPP_CB_BOILERPLATE(on_NtMakePermanentObject_return)
-PPP_CB_BOILERPLATE(on_sys_sethostname_return)
-PPP_CB_BOILERPLATE(on_sys_nice_return)
-PPP_CB_BOILERPLATE(on_NtCreateKeyedEvent_return)
-PPP_CB_BOILERPLATE(on_sys_setreuid_return)
-PPP_CB_BOILERPLATE(on_NtCommitTransaction_return)
-PPP_CB_BOILERPLATE(on_sys_rt_sigsuspend_return)
-PPP_CB_BOILERPLATE(on_NtQueryPortInformationProcess_return)
-PPP_CB_BOILERPLATE(on_NtAllocateLocallyUniqueId_return)
-PPP_CB_BOILERPLATE(on_sys_select_return)
-PPP_CB_BOILERPLATE(on_NtOpenThreadToken_return)
-PPP_CB_BOILERPLATE(on_sys_io_destroy_return)
-PPP_CB_BOILERPLATE(on_NtQueryDebugFilterState_return)
-PPP_CB_BOILERPLATE(on_sys_dup2_return)
-PPP_CB_BOILERPLATE(on_NtSetSystemEnvironmentValue_return)
-PPP_CB_BOILERPLATE(on_NtIsProcessInJob_return)
-PPP_CB_BOILERPLATE(on_sys_setrlimit_return)
-PPP_CB_BOILERPLATE(on_sys_readv_return)
-PPP_CB_BOILERPLATE(on_NtEnumerateDriverEntries_return)
-PPP_CB_BOILERPLATE(on_sys_sched_setparam_return)
-PPP_CB_BOILERPLATE(on_NtRecoverResourceManager_return)
-PPP_CB_BOILERPLATE(on_sys_chroot_return)
-PPP_CB_BOILERPLATE(on_NtPrepareEnlistment_return)
-PPP_CB_BOILERPLATE(on_sys_getdents_return)
-PPP_CB_BOILERPLATE(on_NtOpenDirectoryObject_return)
-PPP_CB_BOILERPLATE(on_NtReplyWaitReplyPort_return)
-PPP_CB_BOILERPLATE(on_sys_getcwd_return)
-PPP_CB_BOILERPLATE(on_NtPowerInformation_return)
-PPP_CB_BOILERPLATE(on_sys_acct_return)
-PPP_CB_BOILERPLATE(on_sys_prctl_return)
-PPP_CB_BOILERPLATE(on_sys_setgroups16_return)
-PPP_CB_BOILERPLATE(on_sys_sysfs_return)
-PPP_CB_BOILERPLATE(on_NtUnlockVirtualMemory_return)
-PPP_CB_BOILERPLATE(on_NtTerminateProcess_return)
-PPP_CB_BOILERPLATE(on_NtQueryInformationProcess_return)
-PPP_CB_BOILERPLATE(on_sys_renameat_return)
-PPP_CB_BOILERPLATE(on_sys_fanotify_mark_return)
-PPP_CB_BOILERPLATE(on_NtCreateToken_return)
-PPP_CB_BOILERPLATE(on_NtCreateIoCompletion_return)
-PPP_CB_BOILERPLATE(on_sys_move_pages_return)
-PPP_CB_BOILERPLATE(on_sys_read_return)
-PPP_CB_BOILERPLATE(on_sys_mmap_pgoff_return)
-PPP_CB_BOILERPLATE(on_NtSetDefaultUILanguage_return)
-PPP_CB_BOILERPLATE(on_sys_fstatfs_return)
-PPP_CB_BOILERPLATE(on_NtReleaseWorkerFactoryWorker_return)
-PPP_CB_BOILERPLATE(on_sys_munlock_return)
-PPP_CB_BOILERPLATE(on_sys_futex_return)
-PPP_CB_BOILERPLATE(on_sys_timerfd_settime_return)
-PPP_CB_BOILERPLATE(on_NtReplaceKey_return)
-PPP_CB_BOILERPLATE(on_sys_request_key_return)
-PPP_CB_BOILERPLATE(on_sys_reboot_return)
-PPP_CB_BOILERPLATE(on_NtRenameKey_return)
-PPP_CB_BOILERPLATE(on_sys_close_return)
-PPP_CB_BOILERPLATE(on_NtPropagationFailed_return)
-PPP_CB_BOILERPLATE(on_NtAlpcCancelMessage_return)
-PPP_CB_BOILERPLATE(on_sys_setuid16_return)
-PPP_CB_BOILERPLATE(on_NtOpenTransactionManager_return)
-PPP_CB_BOILERPLATE(on_sys_setgid_return)
-PPP_CB_BOILERPLATE(on_sys_fremovexattr_return)
-PPP_CB_BOILERPLATE(on_sys_ipc_return)
-PPP_CB_BOILERPLATE(on_sys_flock_return)
-PPP_CB_BOILERPLATE(on_NtThawRegistry_return)
-PPP_CB_BOILERPLATE(on_NtQueryOpenSubKeys_return)
-PPP_CB_BOILERPLATE(on_sys_ioprio_get_return)
-PPP_CB_BOILERPLATE(on_NtCreateJobSet_return)
-PPP_CB_BOILERPLATE(on_sys_mremap_return)
-PPP_CB_BOILERPLATE(on_sys_vmsplice_return)
-PPP_CB_BOILERPLATE(on_sys_statfs_return)
-PPP_CB_BOILERPLATE(on_sys_sigprocmask_return)
-PPP_CB_BOILERPLATE(on_NtResetEvent_return)
-PPP_CB_BOILERPLATE(on_sys_setresuid_return)
-PPP_CB_BOILERPLATE(on_sys_ssetmask_return)
-PPP_CB_BOILERPLATE(on_sys_umount_return)
-PPP_CB_BOILERPLATE(on_NtAllocateVirtualMemory_return)
-PPP_CB_BOILERPLATE(on_sys_setpriority_return)
-PPP_CB_BOILERPLATE(on_NtWaitForSingleObject_return)
-PPP_CB_BOILERPLATE(on_NtSerializeBoot_return)
-PPP_CB_BOILERPLATE(on_sys_llseek_return)
-PPP_CB_BOILERPLATE(on_sys_sched_yield_return)
-PPP_CB_BOILERPLATE(on_NtQuerySystemEnvironmentValueEx_return)
-PPP_CB_BOILERPLATE(on_sys_alarm_return)
-PPP_CB_BOILERPLATE(on_sys_times_return)
-PPP_CB_BOILERPLATE(on_NtOpenTimer_return)
-PPP_CB_BOILERPLATE(on_sys_inotify_init1_return)
-PPP_CB_BOILERPLATE(on_NtCreatePagingFile_return)
-PPP_CB_BOILERPLATE(on_sys_clock_nanosleep_return)
-PPP_CB_BOILERPLATE(on_sys_getuid_return)
-PPP_CB_BOILERPLATE(on_NtOpenMutant_return)
-PPP_CB_BOILERPLATE(on_sys_lookup_dcookie_return)
-PPP_CB_BOILERPLATE(on_NtSetSecurityObject_return)
-PPP_CB_BOILERPLATE(on_NtReadVirtualMemory_return)
-PPP_CB_BOILERPLATE(on_sys_getpriority_return)
-PPP_CB_BOILERPLATE(on_NtInitializeNlsFiles_return)
-PPP_CB_BOILERPLATE(on_sys_removexattr_return)
-PPP_CB_BOILERPLATE(on_NtAlpcDisconnectPort_return)
-PPP_CB_BOILERPLATE(on_sys_madvise_return)
-PPP_CB_BOILERPLATE(on_NtCreateUserProcess_return)
-PPP_CB_BOILERPLATE(on_NtFreeVirtualMemory_return)
-PPP_CB_BOILERPLATE(on_NtInitializeRegistry_return)
-PPP_CB_BOILERPLATE(on_NtCommitEnlistment_return)
-PPP_CB_BOILERPLATE(on_sys_mknodat_return)
-PPP_CB_BOILERPLATE(on_NtTraceControl_return)
-PPP_CB_BOILERPLATE(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_return)
-PPP_CB_BOILERPLATE(on_NtSetSystemPowerState_return)
-PPP_CB_BOILERPLATE(on_sys_setresuid16_return)
-PPP_CB_BOILERPLATE(on_NtCreateThread_return)
-PPP_CB_BOILERPLATE(on_NtOpenSymbolicLinkObject_return)
-PPP_CB_BOILERPLATE(on_sys_setns_return)
-PPP_CB_BOILERPLATE(on_sys_creat_return)
-PPP_CB_BOILERPLATE(on_sigsuspend_return)
-PPP_CB_BOILERPLATE(on_sys_epoll_create_return)
-PPP_CB_BOILERPLATE(on_set_thread_area_return)
-PPP_CB_BOILERPLATE(on_NtWaitLowEventPair_return)
-PPP_CB_BOILERPLATE(on_NtWaitForKeyedEvent_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_setpgid_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_truncate_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_setfsgid_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_fchown16_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_unlink_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtImpersonateThread_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_sched_get_priority_max_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_fsync_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtFlushProcessWriteBuffers_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_unlinkat_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtReleaseKeyedEvent_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtClearEvent_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtFlushBuffersFile_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_setregid16_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtAlpcCreateResourceReserve_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_setfsuid16_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_timer_getoverrun_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_fsetxattr_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSetInformationTransactionManager_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQuerySystemEnvironmentValue_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtPrivilegeObjectAuditAlarm_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtCreateKeyTransacted_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_link_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtCreateNamedPipeFile_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQueryKey_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_perf_event_open_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_fstat_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtDuplicateObject_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_mknod_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_setregid_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtRequestPort_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtCreateMailslotFile_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtOpenThreadTokenEx_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSaveMergedKeys_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtAccessCheckByTypeAndAuditAlarm_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtEnumerateTransactionObject_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtDrawText_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtAccessCheckByType_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtAlpcSendWaitReceivePort_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_pread64_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQueryTimerResolution_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSetBootEntryOrder_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSetInformationJobObject_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQueryInformationFile_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtAllocateReserveObject_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_inotify_rm_watch_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtListenPort_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQueueApcThread_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_add_key_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_mbind_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_tee_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_setgid16_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_mlockall_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtRaiseException_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_kill_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getpid_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_fcntl_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_quotactl_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_socketcall_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtCreateJobObject_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_munmap_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_ioprio_set_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtFlushInstallUILanguage_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtFilterToken_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtTraceEvent_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtReleaseSemaphore_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtGetWriteWatch_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSinglePhaseReject_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSetInformationProcess_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_rt_tgsigqueueinfo_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtOpenSection_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtAlpcQueryInformation_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtCommitComplete_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtLoadDriver_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_ptrace_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getegid_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_sigpending_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtCreateEnlistment_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtMapViewOfSection_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtCreateThreadEx_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_epoll_create1_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtLockRegistryKey_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_uname_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_openat_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtOpenSession_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQueryLicenseValue_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_setresgid16_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_waitpid_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getresgid16_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtGetMUIRegistryInfo_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtCreateWorkerFactory_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_lgetxattr_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtFreeUserPhysicalPages_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_sendfile64_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtImpersonateAnonymousToken_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_rmdir_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtRemoveProcessDebug_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSetDefaultLocale_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtRollforwardTransactionManager_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getgid_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtPrepareComplete_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtCreatePort_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtCancelSynchronousIoFile_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSetTimerResolution_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtCancelIoFileEx_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtUnloadKeyEx_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSetInformationDebugObject_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sigaction_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_lremovexattr_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_timer_delete_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtWaitForMultipleObjects_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtWaitForMultipleObjects32_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtAlpcCreateSecurityContext_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtGetNextProcess_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getgroups16_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtGetNlsSectionPtr_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_setfsgid16_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_lchown_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtGetNotificationResourceManager_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_exit_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSetHighWaitLowEventPair_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtDebugActiveProcess_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtCreateDirectoryObject_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_gettid_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSetEaFile_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_stat_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_open_by_handle_at_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_epoll_pwait_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_brk_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtOpenJobObject_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_epoll_ctl_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtReadRequestData_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtAlpcCreateSectionView_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtRequestWaitReplyPort_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_fstat64_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_remap_file_pages_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtUnmapViewOfSection_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_preadv_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSuspendThread_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtMapUserPhysicalPages_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQueryBootOptions_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtFlushInstructionCache_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSetInformationKey_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_sched_rr_get_interval_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtCreateEventPair_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtOpenKeyedEvent_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_newuname_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtReadOnlyEnlistment_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_prlimit64_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_chown16_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtDisplayString_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtAdjustPrivilegesToken_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_futimesat_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSetInformationFile_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSetVolumeInformationFile_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtAddAtom_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_fanotify_init_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_mount_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_pwrite64_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtRemoveIoCompletionEx_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtCreateKey_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_sched_get_priority_min_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtCreateTransaction_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_gettimeofday_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtRestoreKey_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSetSystemEnvironmentValueEx_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_migrate_pages_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_rt_sigqueueinfo_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_pselect6_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_fdatasync_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_fchownat_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_mq_unlink_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSetSystemTime_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtPlugPlayControl_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_sched_getparam_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_rt_sigtimedwait_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_ioctl_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_newstat_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtPropagationComplete_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getresuid16_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtGetDevicePowerState_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSetIntervalProfile_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtFlushKey_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQueryDefaultUILanguage_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtWaitForDebugEvent_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQueryDefaultLocale_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtCreateWaitablePort_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_sendmmsg_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_utimes_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtAssignProcessToJobObject_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_get_robust_list_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtRecoverTransactionManager_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_setsid_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtAccessCheckAndAuditAlarm_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtEnumerateSystemEnvironmentValuesEx_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSetDebugFilterState_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_readlink_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQueryOpenSubKeysEx_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_geteuid16_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_fcntl64_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_chown_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_epoll_wait_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtAreMappedFilesTheSame_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSaveKey_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtReadFile_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_geteuid_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtClose_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtDeleteAtom_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtFsControlFile_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_newlstat_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtReplyWaitReceivePort_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtAccessCheckByTypeResultListAndAuditAlarm_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_setdomainname_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtCallbackReturn_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtCreatePrivateNamespace_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtDelayExecution_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtDeleteValueKey_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtLockProductActivationKeys_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_vhangup_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_wait4_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_mq_timedreceive_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_statfs64_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtDisableLastKnownGood_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQueryFullAttributesFile_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_lchown16_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQueryInformationResourceManager_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtCreateProcessEx_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_tgkill_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtCreateSymbolicLinkObject_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getresuid_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_fstatfs64_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtMapCMFModule_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_init_module_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtWriteFileGather_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_timerfd_gettime_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQueryDirectoryFile_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtCreateProfile_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtLoadKeyEx_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSetHighEventPair_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQueryInformationTransactionManager_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_fadvise64_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_oldumount_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_personality_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtAlpcSetInformation_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_msync_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtContinue_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtNotifyChangeDirectoryFile_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_eventfd_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtCreateEvent_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSaveKeyEx_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtWaitHighEventPair_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getxattr_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQueryVolumeInformationFile_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_fadvise64_64_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQueryEvent_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSetSystemInformation_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtOpenFile_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtPulseEvent_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getpgrp_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQueryInstallUILanguage_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtAlpcOpenSenderProcess_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSetContextThread_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtOpenSemaphore_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_timer_settime_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtEnumerateValueKey_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_kexec_load_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtInitiatePowerAction_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_open_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSetInformationObject_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_setgroups_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getrusage_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQueryObject_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_eventfd2_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSignalAndWaitForSingleObject_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_old_select_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtLoadKey_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtAddBootEntry_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSetInformationResourceManager_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_pivot_root_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQuerySemaphore_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_inotify_init_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_fgetxattr_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_io_cancel_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSetEvent_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQuerySystemInformationEx_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtThawTransactions_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtAlpcAcceptConnectPort_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_delete_module_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_olduname_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtFlushWriteBuffer_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtTestAlert_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtOpenProcess_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_modify_ldt_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_old_readdir_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtMakeTemporaryObject_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_waitid_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_vfork_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtRollbackEnlistment_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSetIoCompletionEx_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_fork_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtModifyDriverEntry_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQueryInformationWorkerFactory_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtAlpcRevokeSecurityContext_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtCreateDebugObject_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtWriteRequestData_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_nanosleep_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_flistxattr_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_sigreturn_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtImpersonateClientOfPort_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_process_vm_readv_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_capget_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSetInformationEnlistment_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtCreateProcess_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_fchmod_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_swapoff_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQueryMutant_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtAdjustGroupsToken_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtApphelpCacheControl_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSecureConnectPort_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_chmod_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtTerminateThread_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_poll_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSetDefaultHardErrorPort_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_splice_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtAlertThread_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQueryInformationJobObject_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_inotify_add_watch_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_sysinfo_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_uselib_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtYieldExecution_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtDeleteDriverEntry_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtOpenProcessToken_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtRaiseHardError_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_utime_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_newfstat_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtRecoverEnlistment_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_mq_open_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtAlpcDeleteSectionView_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtAllocateUuids_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtCreateTransactionManager_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtAlpcImpersonateClientOfPort_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQueryInformationPort_return)
+PPP_CB_BOILERPLATE_FILTERED(on_rt_sigaction_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_process_vm_writev_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtDeleteObjectAuditAlarm_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_readlinkat_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtPrivilegeCheck_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQuerySecurityObject_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_signal_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_dup3_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSetInformationTransaction_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_symlink_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtAlpcOpenSenderThread_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtOpenKeyEx_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_clock_adjtime_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtAccessCheckByTypeResultList_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtFlushVirtualMemory_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtReleaseMutant_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSetDriverEntryOrder_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_setreuid16_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_io_setup_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtCreateResourceManager_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtAlertResumeThread_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtCreateMutant_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getresgid_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQueryInformationAtom_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getgroups_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtOpenProcessTokenEx_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtDeviceIoControlFile_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQueryMultipleValueKey_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_set_tid_address_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_set_robust_list_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtCreateSemaphore_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_clock_gettime_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtAlpcConnectPort_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQuerySymbolicLinkObject_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getitimer_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_swapon_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtOpenEvent_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtNotifyChangeSession_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtOpenPrivateNamespace_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtCreateTimer_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSetLdtEntries_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQuerySystemInformation_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtFindAtom_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtCompleteConnectPort_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtDeleteBootEntry_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtCloseObjectAuditAlarm_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_mprotect_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQueryDriverEntryOrder_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtWorkerFactoryWorkerReady_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_ftruncate64_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_exit_group_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtDeletePrivateNamespace_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_setfsuid_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getdents64_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtExtendSection_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtEnumerateKey_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_mlock_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_bdflush_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSetInformationToken_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_lseek_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtAlpcDeletePortSection_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_sgetmask_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtRegisterThreadTerminatePort_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtDeleteKey_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_faccessat_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_sched_getscheduler_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_name_to_handle_at_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_access_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtWriteVirtualMemory_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtTerminateJobObject_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_setresgid_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSetThreadExecutionState_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSetBootOptions_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtRemoveIoCompletion_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtShutdownWorkerFactory_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtTranslateFilePath_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtMapUserPhysicalPagesScatter_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtWriteFile_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtAllocateUserPhysicalPages_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtAlpcDeleteResourceReserve_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getcpu_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQueryInformationThread_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtUnlockFile_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_old_getrlimit_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSetEventBoostPriority_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_rt_sigpending_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_mkdir_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_unshare_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQueueApcThreadEx_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtOpenObjectAuditAlarm_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtResumeProcess_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQuerySystemTime_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtUmsThreadYield_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQueryInformationTransaction_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_clock_settime_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSetIoCompletion_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_settimeofday_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQueryBootEntryOrder_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQueryQuotaInformationFile_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_mq_notify_return)
+PPP_CB_BOILERPLATE_FILTERED(on_get_thread_area_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getuid16_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSetInformationWorkerFactory_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtLockVirtualMemory_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtDeleteFile_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtFreezeTransactions_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQuerySection_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_sigaltstack_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_recvmmsg_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getpgid_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSystemDebugControl_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_time_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_signalfd_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_fchdir_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtVdmControl_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_mkdirat_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_readahead_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtAcceptConnectPort_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_get_mempolicy_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_mincore_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_fchmodat_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtFreezeRegistry_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_keyctl_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_set_mempolicy_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_capset_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtResumeThread_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_dup_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtCreateSection_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_mq_getsetattr_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtIsSystemResumeAutomatic_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSetInformationThread_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_setitimer_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_mq_timedsend_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_rt_sigprocmask_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_signalfd4_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtOpenEventPair_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_io_submit_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQueryPerformanceCounter_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQueryDirectoryObject_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_setxattr_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_io_getevents_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_pipe_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtAlpcDeleteSecurityContext_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSetValueKey_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtShutdownSystem_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_sched_setaffinity_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQueryValueKey_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_llistxattr_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtOpenIoCompletion_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtReplacePartitionUnit_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtDuplicateToken_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtRenameTransactionManager_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getrlimit_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_truncate64_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtIsUILanguageComitted_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_listxattr_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_linkat_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_stat64_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSetLowWaitHighEventPair_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQueryVirtualMemory_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtEnableLastKnownGood_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtCompactKeys_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_ppoll_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtReplyWaitReceivePortEx_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtConnectPort_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtAlpcCreatePort_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtCreateFile_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_lstat_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_pause_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtRollbackTransaction_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtOpenKeyTransacted_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_ustat_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_write_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_rename_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtModifyBootEntry_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtGetCurrentProcessorNumber_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtOpenResourceManager_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_syslog_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtCompareTokens_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_fallocate_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_sched_setscheduler_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getppid_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtNotifyChangeKey_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_clone_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_vm86_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_lstat64_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtStopProfile_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_restart_syscall_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_lsetxattr_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQueryAttributesFile_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtResetWriteWatch_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_syncfs_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtCancelTimer_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtLoadKey2_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtOpenThread_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_utimensat_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtGetPlugPlayEvent_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_munlockall_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getegid16_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtAddDriverEntry_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_execve_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_tkill_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_sync_file_range_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtRollbackComplete_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtWaitForWorkViaWorkerFactory_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQueryInformationToken_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_timer_create_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_fchown_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_pwritev_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtPrePrepareComplete_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtDebugContinue_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_ioperm_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtNotifyChangeMultipleKeys_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSetTimerEx_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSetLowEventPair_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtLockFile_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_rt_sigreturn_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_clock_getres_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_sendfile_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_chdir_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_ftruncate_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtUnloadDriver_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_timer_gettime_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtOpenTransaction_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getgid16_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_sync_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtUnloadKey2_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtRegisterProtocolAddressInformation_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtOpenEnlistment_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_symlinkat_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtGetNextThread_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_stime_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtOpenKeyTransactedEx_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQueryTimer_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_timerfd_create_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSetUuidSeed_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_pipe2_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSetQuotaInformationFile_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSetTimer_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtCreateProfileEx_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_vm86old_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtGetContextThread_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSuspendProcess_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_umask_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_iopl_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQueryInformationEnlistment_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_old_mmap_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtPrePrepareEnlistment_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtStartProfile_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_fstatat64_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtUnloadKey_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtCompressKey_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtPrivilegedServiceAuditAlarm_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtAlpcQueryInformationMessage_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQuerySecurityAttributesToken_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtReadFileScatter_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtReplyPort_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtProtectVirtualMemory_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getsid_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQueryEaFile_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQueryIoCompletion_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_adjtimex_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtEnumerateBootEntries_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQueryIntervalProfile_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_writev_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_setuid_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_sysctl_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtCancelIoFile_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtAlpcCreatePortSection_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtOpenKey_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_sched_getaffinity_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtAccessCheck_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtMakePermanentObject_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_sethostname_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_nice_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtCreateKeyedEvent_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_setreuid_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtCommitTransaction_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_rt_sigsuspend_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQueryPortInformationProcess_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtAllocateLocallyUniqueId_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_select_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtOpenThreadToken_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_io_destroy_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQueryDebugFilterState_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_dup2_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSetSystemEnvironmentValue_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtIsProcessInJob_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_setrlimit_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_readv_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtEnumerateDriverEntries_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_sched_setparam_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtRecoverResourceManager_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_chroot_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtPrepareEnlistment_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getdents_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtOpenDirectoryObject_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtReplyWaitReplyPort_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getcwd_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtPowerInformation_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_acct_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_prctl_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_setgroups16_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_sysfs_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtUnlockVirtualMemory_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtTerminateProcess_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQueryInformationProcess_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_renameat_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_fanotify_mark_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtCreateToken_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtCreateIoCompletion_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_move_pages_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_read_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_mmap_pgoff_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSetDefaultUILanguage_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_fstatfs_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtReleaseWorkerFactoryWorker_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_munlock_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_futex_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_timerfd_settime_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtReplaceKey_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_request_key_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_reboot_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtRenameKey_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_close_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtPropagationFailed_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtAlpcCancelMessage_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_setuid16_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtOpenTransactionManager_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_setgid_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_fremovexattr_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_ipc_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_flock_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtThawRegistry_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQueryOpenSubKeys_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_ioprio_get_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtCreateJobSet_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_mremap_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_vmsplice_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_statfs_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_sigprocmask_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtResetEvent_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_setresuid_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_ssetmask_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_umount_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtAllocateVirtualMemory_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_setpriority_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtWaitForSingleObject_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSerializeBoot_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_llseek_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_sched_yield_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtQuerySystemEnvironmentValueEx_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_alarm_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_times_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtOpenTimer_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_inotify_init1_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtCreatePagingFile_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_clock_nanosleep_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getuid_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtOpenMutant_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_lookup_dcookie_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSetSecurityObject_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtReadVirtualMemory_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_getpriority_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtInitializeNlsFiles_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_removexattr_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtAlpcDisconnectPort_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_madvise_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtCreateUserProcess_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtFreeVirtualMemory_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtInitializeRegistry_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtCommitEnlistment_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_mknodat_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtTraceControl_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtSetSystemPowerState_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_setresuid16_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtCreateThread_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtOpenSymbolicLinkObject_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_setns_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_creat_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sigsuspend_return)
+PPP_CB_BOILERPLATE_FILTERED(on_sys_epoll_create_return)
+PPP_CB_BOILERPLATE_FILTERED(on_set_thread_area_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtWaitLowEventPair_return)
+PPP_CB_BOILERPLATE_FILTERED(on_NtWaitForKeyedEvent_return)
 #endif
 #if 1
-PPP_CB_BOILERPLATE(on_all_sys_return)
-PPP_CB_BOILERPLATE(on_unknown_sys_return)
+PPP_CB_BOILERPLATE_FILTERED(on_all_sys_return)
+PPP_CB_BOILERPLATE_FILTERED(on_unknown_sys_return)
 #endif
@@ -16,13 +16,14 @@ extern "C" {
 
 void syscall_enter_switch_windows7_x86 ( CPUState *env, target_ulong pc ) {  // osarch
 #ifdef TARGET_I386                                          // GUARD
-    ReturnPoint rp;
+    ReturnPoint rp = {};                    // params stay zero unless captured below
     rp.ordinal = EAX;                        // CALLNO
     rp.proc_id = panda_current_asid(env);
     rp.retaddr = calc_retaddr(env, pc);
     switch( EAX ) {                          // CALLNO
 // 0 NTSTATUS NtAcceptConnectPort ['PHANDLE PortHandle', ' PVOID PortContext', ' PPORT_MESSAGE ConnectionRequest', ' BOOLEAN AcceptConnection', ' PPORT_VIEW ServerView', ' PREMOTE_PORT_VIEW ClientView']
 case 0: {
+if (PPP_CHECK_CB(on_NtAcceptConnectPort_enter) || PPP_CHECK_CB(on_NtAcceptConnectPort_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -37,10 +38,12 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAcceptConnectPort_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+PPP_RUN_CB_FILTERED(on_NtAcceptConnectPort_enter, rp.proc_id, pc, 0, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 1 NTSTATUS NtAccessCheck ['PSECURITY_DESCRIPTOR SecurityDescriptor', ' HANDLE ClientToken', ' ACCESS_MASK DesiredAccess', ' PGENERIC_MAPPING GenericMapping', ' PPRIVILEGE_SET PrivilegeSet', ' PULONG PrivilegeSetLength', ' PACCESS_MASK GrantedAccess', ' PNTSTATUS AccessStatus']
 case 1: {
+if (PPP_CHECK_CB(on_NtAccessCheck_enter) || PPP_CHECK_CB(on_NtAccessCheck_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -59,10 +62,12 @@ memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 memcpy(rp.params[6], &arg6, sizeof(uint32_t));
 memcpy(rp.params[7], &arg7, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAccessCheck_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
+PPP_RUN_CB_FILTERED(on_NtAccessCheck_enter, rp.proc_id, pc, 1, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
+}
 }; break;
 // 2 NTSTATUS NtAccessCheckAndAuditAlarm ['PUNICODE_STRING SubsystemName', ' PVOID HandleId', ' PUNICODE_STRING ObjectTypeName', ' PUNICODE_STRING ObjectName', ' PSECURITY_DESCRIPTOR SecurityDescriptor', ' ACCESS_MASK DesiredAccess', ' PGENERIC_MAPPING GenericMapping', ' BOOLEAN ObjectCreation', ' PACCESS_MASK GrantedAccess', ' PNTSTATUS AccessStatus', ' PBOOLEAN GenerateOnClose']
 case 2: {
+if (PPP_CHECK_CB(on_NtAccessCheckAndAuditAlarm_enter) || PPP_CHECK_CB(on_NtAccessCheckAndAuditAlarm_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -87,10 +92,12 @@ memcpy(rp.params[8], &arg8, sizeof(uint32_t));
 memcpy(rp.params[9], &arg9, sizeof(uint32_t));
 memcpy(rp.params[10], &arg10, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAccessCheckAndAuditAlarm_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10) ; 
+PPP_RUN_CB_FILTERED(on_NtAccessCheckAndAuditAlarm_enter, rp.proc_id, pc, 2, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10) ; 
+}
 }; break;
 // 3 NTSTATUS NtAccessCheckByType ['PSECURITY_DESCRIPTOR SecurityDescriptor', ' PSID PrincipalSelfSid', ' HANDLE ClientToken', ' ACCESS_MASK DesiredAccess', ' POBJECT_TYPE_LIST ObjectTypeList', ' ULONG ObjectTypeListLength', ' PGENERIC_MAPPING GenericMapping', ' PPRIVILEGE_SET PrivilegeSet', ' PULONG PrivilegeSetLength', ' PACCESS_MASK GrantedAccess', ' PNTSTATUS AccessStatus']
 case 3: {
+if (PPP_CHECK_CB(on_NtAccessCheckByType_enter) || PPP_CHECK_CB(on_NtAccessCheckByType_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -115,10 +122,12 @@ memcpy(rp.params[8], &arg8, sizeof(uint32_t));
 memcpy(rp.params[9], &arg9, sizeof(uint32_t));
 memcpy(rp.params[10], &arg10, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAccessCheckByType_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10) ; 
+PPP_RUN_CB_FILTERED(on_NtAccessCheckByType_enter, rp.proc_id, pc, 3, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10) ; 
+}
 }; break;
 // 4 NTSTATUS NtAccessCheckByTypeAndAuditAlarm ['PUNICODE_STRING SubsystemName', ' PVOID HandleId', ' PUNICODE_STRING ObjectTypeName', ' PUNICODE_STRING ObjectName', ' PSECURITY_DESCRIPTOR SecurityDescriptor', ' PSID PrincipalSelfSid', ' ACCESS_MASK DesiredAccess', ' AUDIT_EVENT_TYPE AuditType', ' ULONG Flags', ' POBJECT_TYPE_LIST ObjectTypeList', ' ULONG ObjectTypeListLength', ' PGENERIC_MAPPING GenericMapping', ' BOOLEAN ObjectCreation', ' PACCESS_MASK GrantedAccess', ' PNTSTATUS AccessStatus', ' PBOOLEAN GenerateOnClose']
 case 4: {
+if (PPP_CHECK_CB(on_NtAccessCheckByTypeAndAuditAlarm_enter) || PPP_CHECK_CB(on_NtAccessCheckByTypeAndAuditAlarm_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -153,10 +162,12 @@ memcpy(rp.params[13], &arg13, sizeof(uint32_t));
 memcpy(rp.params[14], &arg14, sizeof(uint32_t));
 memcpy(rp.params[15], &arg15, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAccessCheckByTypeAndAuditAlarm_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11,arg12,arg13,arg14,arg15) ; 
+PPP_RUN_CB_FILTERED(on_NtAccessCheckByTypeAndAuditAlarm_enter, rp.proc_id, pc, 4, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11,arg12,arg13,arg14,arg15) ; 
+}
 }; break;
 // 5 NTSTATUS NtAccessCheckByTypeResultList ['PSECURITY_DESCRIPTOR SecurityDescriptor', ' PSID PrincipalSelfSid', ' HANDLE ClientToken', ' ACCESS_MASK DesiredAccess', ' POBJECT_TYPE_LIST ObjectTypeList', ' ULONG ObjectTypeListLength', ' PGENERIC_MAPPING GenericMapping', ' PPRIVILEGE_SET PrivilegeSet', ' PULONG PrivilegeSetLength', ' PACCESS_MASK GrantedAccess', ' PNTSTATUS AccessStatus']
 case 5: {
+if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultList_enter) || PPP_CHECK_CB(on_NtAccessCheckByTypeResultList_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -181,10 +192,12 @@ memcpy(rp.params[8], &arg8, sizeof(uint32_t));
 memcpy(rp.params[9], &arg9, sizeof(uint32_t));
 memcpy(rp.params[10], &arg10, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAccessCheckByTypeResultList_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10) ; 
+PPP_RUN_CB_FILTERED(on_NtAccessCheckByTypeResultList_enter, rp.proc_id, pc, 5, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10) ; 
+}
 }; break;
 // 6 NTSTATUS NtAccessCheckByTypeResultListAndAuditAlarm ['PUNICODE_STRING SubsystemName', ' PVOID HandleId', ' PUNICODE_STRING ObjectTypeName', ' PUNICODE_STRING ObjectName', ' PSECURITY_DESCRIPTOR SecurityDescriptor', ' PSID PrincipalSelfSid', ' ACCESS_MASK DesiredAccess', ' AUDIT_EVENT_TYPE AuditType', ' ULONG Flags', ' POBJECT_TYPE_LIST ObjectTypeList', ' ULONG ObjectTypeListLength', ' PGENERIC_MAPPING GenericMapping', ' BOOLEAN ObjectCreation', ' PACCESS_MASK GrantedAccess', ' PNTSTATUS AccessStatus', ' PBOOLEAN GenerateOnClose']
 case 6: {
+if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarm_enter) || PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarm_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -219,10 +232,12 @@ memcpy(rp.params[13], &arg13, sizeof(uint32_t));
 memcpy(rp.params[14], &arg14, sizeof(uint32_t));
 memcpy(rp.params[15], &arg15, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAccessCheckByTypeResultListAndAuditAlarm_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11,arg12,arg13,arg14,arg15) ; 
+PPP_RUN_CB_FILTERED(on_NtAccessCheckByTypeResultListAndAuditAlarm_enter, rp.proc_id, pc, 6, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11,arg12,arg13,arg14,arg15) ; 
+}
 }; break;
 // 7 NTSTATUS NtAccessCheckByTypeResultListAndAuditAlarmByHandle ['PUNICODE_STRING SubsystemName', ' PVOID HandleId', ' HANDLE ClientToken', ' PUNICODE_STRING ObjectTypeName', ' PUNICODE_STRING ObjectName', ' PSECURITY_DESCRIPTOR SecurityDescriptor', ' PSID PrincipalSelfSid', ' ACCESS_MASK DesiredAccess', ' AUDIT_EVENT_TYPE AuditType', ' ULONG Flags', ' POBJECT_TYPE_LIST ObjectTypeList', ' ULONG ObjectTypeListLength', ' PGENERIC_MAPPING GenericMapping', ' BOOLEAN ObjectCreation', ' PACCESS_MASK GrantedAccess', ' PNTSTATUS AccessStatus', ' PBOOLEAN GenerateOnClose']
 case 7: {
+if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_enter) || PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -259,10 +274,12 @@ memcpy(rp.params[14], &arg14, sizeof(uint32_t));
 memcpy(rp.params[15], &arg15, sizeof(uint32_t));
 memcpy(rp.params[16], &arg16, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11,arg12,arg13,arg14,arg15,arg16) ; 
+PPP_RUN_CB_FILTERED(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_enter, rp.proc_id, pc, 7, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11,arg12,arg13,arg14,arg15,arg16) ; 
+}
 }; break;
 // 8 NTSTATUS NtAddAtom ['PWSTR AtomName', ' ULONG Length', ' PRTL_ATOM Atom']
 case 8: {
+if (PPP_CHECK_CB(on_NtAddAtom_enter) || PPP_CHECK_CB(on_NtAddAtom_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -271,30 +288,36 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAddAtom_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtAddAtom_enter, rp.proc_id, pc, 8, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 9 NTSTATUS NtAddBootEntry ['PBOOT_ENTRY BootEntry', ' PULONG Id']
 case 9: {
+if (PPP_CHECK_CB(on_NtAddBootEntry_enter) || PPP_CHECK_CB(on_NtAddBootEntry_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtAddBootEntry_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAddBootEntry_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtAddBootEntry_enter, rp.proc_id, pc, 9, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 10 NTSTATUS NtAddDriverEntry ['PEFI_DRIVER_ENTRY DriverEntry', ' PULONG Id']
 case 10: {
+if (PPP_CHECK_CB(on_NtAddDriverEntry_enter) || PPP_CHECK_CB(on_NtAddDriverEntry_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtAddDriverEntry_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAddDriverEntry_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtAddDriverEntry_enter, rp.proc_id, pc, 10, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 11 NTSTATUS NtAdjustGroupsToken ['HANDLE TokenHandle', ' BOOLEAN ResetToDefault', ' PTOKEN_GROUPS NewState', ' ULONG BufferLength', ' PTOKEN_GROUPS PreviousState', ' PULONG ReturnLength']
 case 11: {
+if (PPP_CHECK_CB(on_NtAdjustGroupsToken_enter) || PPP_CHECK_CB(on_NtAdjustGroupsToken_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -309,10 +332,12 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAdjustGroupsToken_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+PPP_RUN_CB_FILTERED(on_NtAdjustGroupsToken_enter, rp.proc_id, pc, 11, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 12 NTSTATUS NtAdjustPrivilegesToken ['HANDLE TokenHandle', ' BOOLEAN DisableAllPrivileges', ' PTOKEN_PRIVILEGES NewState', ' ULONG BufferLength', ' PTOKEN_PRIVILEGES PreviousState', ' PULONG ReturnLength']
 case 12: {
+if (PPP_CHECK_CB(on_NtAdjustPrivilegesToken_enter) || PPP_CHECK_CB(on_NtAdjustPrivilegesToken_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -327,36 +352,44 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAdjustPrivilegesToken_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+PPP_RUN_CB_FILTERED(on_NtAdjustPrivilegesToken_enter, rp.proc_id, pc, 12, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 13 NTSTATUS NtAlertResumeThread ['HANDLE ThreadHandle', ' PULONG PreviousSuspendCount']
 case 13: {
+if (PPP_CHECK_CB(on_NtAlertResumeThread_enter) || PPP_CHECK_CB(on_NtAlertResumeThread_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtAlertResumeThread_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAlertResumeThread_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtAlertResumeThread_enter, rp.proc_id, pc, 13, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 14 NTSTATUS NtAlertThread ['HANDLE ThreadHandle']
 case 14: {
+if (PPP_CHECK_CB(on_NtAlertThread_enter) || PPP_CHECK_CB(on_NtAlertThread_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtAlertThread_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAlertThread_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtAlertThread_enter, rp.proc_id, pc, 14, env,pc,arg0) ; 
+}
 }; break;
 // 15 NTSTATUS NtAllocateLocallyUniqueId ['PLUID Luid']
 case 15: {
+if (PPP_CHECK_CB(on_NtAllocateLocallyUniqueId_enter) || PPP_CHECK_CB(on_NtAllocateLocallyUniqueId_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtAllocateLocallyUniqueId_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAllocateLocallyUniqueId_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtAllocateLocallyUniqueId_enter, rp.proc_id, pc, 15, env,pc,arg0) ; 
+}
 }; break;
 // 16 NTSTATUS NtAllocateReserveObject ['PHANDLE MemoryReserveHandle', ' POBJECT_ATTRIBUTES ObjectAttributes', ' MEMORY_RESERVE_TYPE Type']
 case 16: {
+if (PPP_CHECK_CB(on_NtAllocateReserveObject_enter) || PPP_CHECK_CB(on_NtAllocateReserveObject_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -365,10 +398,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAllocateReserveObject_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtAllocateReserveObject_enter, rp.proc_id, pc, 16, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 17 NTSTATUS NtAllocateUserPhysicalPages ['HANDLE ProcessHandle', ' PULONG_PTR NumberOfPages', ' PULONG_PTR UserPfnArray']
 case 17: {
+if (PPP_CHECK_CB(on_NtAllocateUserPhysicalPages_enter) || PPP_CHECK_CB(on_NtAllocateUserPhysicalPages_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -377,10 +412,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAllocateUserPhysicalPages_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtAllocateUserPhysicalPages_enter, rp.proc_id, pc, 17, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 18 NTSTATUS NtAllocateUuids ['PULARGE_INTEGER Time', ' PULONG Range', ' PULONG Sequence', ' PCHAR Seed']
 case 18: {
+if (PPP_CHECK_CB(on_NtAllocateUuids_enter) || PPP_CHECK_CB(on_NtAllocateUuids_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -391,10 +428,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAllocateUuids_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtAllocateUuids_enter, rp.proc_id, pc, 18, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 19 NTSTATUS NtAllocateVirtualMemory ['HANDLE ProcessHandle', ' PVOID *BaseAddress', ' ULONG_PTR ZeroBits', ' PSIZE_T RegionSize', ' ULONG AllocationType', ' ULONG Protect']
 case 19: {
+if (PPP_CHECK_CB(on_NtAllocateVirtualMemory_enter) || PPP_CHECK_CB(on_NtAllocateVirtualMemory_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -409,10 +448,12 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAllocateVirtualMemory_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+PPP_RUN_CB_FILTERED(on_NtAllocateVirtualMemory_enter, rp.proc_id, pc, 19, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 20 NTSTATUS NtAlpcAcceptConnectPort ['PHANDLE PortHandle', ' HANDLE ConnectionPortHandle', ' ULONG Flags', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PALPC_PORT_ATTRIBUTES PortAttributes', ' PVOID PortContext', ' PPORT_MESSAGE ConnectionRequest', ' PALPC_MESSAGE_ATTRIBUTES ConnectionMessageAttributes', ' BOOLEAN AcceptConnection']
 case 20: {
+if (PPP_CHECK_CB(on_NtAlpcAcceptConnectPort_enter) || PPP_CHECK_CB(on_NtAlpcAcceptConnectPort_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -433,10 +474,12 @@ memcpy(rp.params[6], &arg6, sizeof(uint32_t));
 memcpy(rp.params[7], &arg7, sizeof(uint32_t));
 memcpy(rp.params[8], &arg8, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAlpcAcceptConnectPort_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+PPP_RUN_CB_FILTERED(on_NtAlpcAcceptConnectPort_enter, rp.proc_id, pc, 20, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+}
 }; break;
 // 21 NTSTATUS NtAlpcCancelMessage ['HANDLE PortHandle', ' ULONG Flags', ' PALPC_CONTEXT_ATTR MessageContext']
 case 21: {
+if (PPP_CHECK_CB(on_NtAlpcCancelMessage_enter) || PPP_CHECK_CB(on_NtAlpcCancelMessage_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -445,10 +488,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAlpcCancelMessage_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtAlpcCancelMessage_enter, rp.proc_id, pc, 21, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 22 NTSTATUS NtAlpcConnectPort ['PHANDLE PortHandle', ' PUNICODE_STRING PortName', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PALPC_PORT_ATTRIBUTES PortAttributes', ' ULONG Flags', ' PSID RequiredServerSid', ' PPORT_MESSAGE ConnectionMessage', ' PULONG BufferLength', ' PALPC_MESSAGE_ATTRIBUTES OutMessageAttributes', ' PALPC_MESSAGE_ATTRIBUTES InMessageAttributes', ' PLARGE_INTEGER Timeout']
 case 22: {
+if (PPP_CHECK_CB(on_NtAlpcConnectPort_enter) || PPP_CHECK_CB(on_NtAlpcConnectPort_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -473,10 +518,12 @@ memcpy(rp.params[8], &arg8, sizeof(uint32_t));
 memcpy(rp.params[9], &arg9, sizeof(uint32_t));
 memcpy(rp.params[10], &arg10, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAlpcConnectPort_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10) ; 
+PPP_RUN_CB_FILTERED(on_NtAlpcConnectPort_enter, rp.proc_id, pc, 22, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10) ; 
+}
 }; break;
 // 23 NTSTATUS NtAlpcCreatePort ['PHANDLE PortHandle', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PALPC_PORT_ATTRIBUTES PortAttributes']
 case 23: {
+if (PPP_CHECK_CB(on_NtAlpcCreatePort_enter) || PPP_CHECK_CB(on_NtAlpcCreatePort_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -485,10 +532,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAlpcCreatePort_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtAlpcCreatePort_enter, rp.proc_id, pc, 23, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 24 NTSTATUS NtAlpcCreatePortSection ['HANDLE PortHandle', ' ULONG Flags', ' HANDLE SectionHandle', ' SIZE_T SectionSize', ' PALPC_HANDLE AlpcSectionHandle', ' PSIZE_T ActualSectionSize']
 case 24: {
+if (PPP_CHECK_CB(on_NtAlpcCreatePortSection_enter) || PPP_CHECK_CB(on_NtAlpcCreatePortSection_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -503,10 +552,12 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAlpcCreatePortSection_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+PPP_RUN_CB_FILTERED(on_NtAlpcCreatePortSection_enter, rp.proc_id, pc, 24, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 25 NTSTATUS NtAlpcCreateResourceReserve ['HANDLE PortHandle', ' ULONG Flags', ' SIZE_T MessageSize', ' PALPC_HANDLE ResourceId']
 case 25: {
+if (PPP_CHECK_CB(on_NtAlpcCreateResourceReserve_enter) || PPP_CHECK_CB(on_NtAlpcCreateResourceReserve_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -517,10 +568,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAlpcCreateResourceReserve_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtAlpcCreateResourceReserve_enter, rp.proc_id, pc, 25, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 26 NTSTATUS NtAlpcCreateSectionView ['HANDLE PortHandle', ' ULONG Flags', ' PALPC_DATA_VIEW_ATTR ViewAttributes']
 case 26: {
+if (PPP_CHECK_CB(on_NtAlpcCreateSectionView_enter) || PPP_CHECK_CB(on_NtAlpcCreateSectionView_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -529,10 +582,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAlpcCreateSectionView_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtAlpcCreateSectionView_enter, rp.proc_id, pc, 26, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 27 NTSTATUS NtAlpcCreateSecurityContext ['HANDLE PortHandle', ' ULONG Flags', ' PALPC_SECURITY_ATTR SecurityAttribute']
 case 27: {
+if (PPP_CHECK_CB(on_NtAlpcCreateSecurityContext_enter) || PPP_CHECK_CB(on_NtAlpcCreateSecurityContext_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -541,10 +596,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAlpcCreateSecurityContext_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtAlpcCreateSecurityContext_enter, rp.proc_id, pc, 27, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 28 NTSTATUS NtAlpcDeletePortSection ['HANDLE PortHandle', ' ULONG Flags', ' ALPC_HANDLE SectionHandle']
 case 28: {
+if (PPP_CHECK_CB(on_NtAlpcDeletePortSection_enter) || PPP_CHECK_CB(on_NtAlpcDeletePortSection_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -553,10 +610,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAlpcDeletePortSection_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtAlpcDeletePortSection_enter, rp.proc_id, pc, 28, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 29 NTSTATUS NtAlpcDeleteResourceReserve ['HANDLE PortHandle', ' ULONG Flags', ' ALPC_HANDLE ResourceId']
 case 29: {
+if (PPP_CHECK_CB(on_NtAlpcDeleteResourceReserve_enter) || PPP_CHECK_CB(on_NtAlpcDeleteResourceReserve_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -565,10 +624,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAlpcDeleteResourceReserve_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtAlpcDeleteResourceReserve_enter, rp.proc_id, pc, 29, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 30 NTSTATUS NtAlpcDeleteSectionView ['HANDLE PortHandle', ' ULONG Flags', ' PVOID ViewBase']
 case 30: {
+if (PPP_CHECK_CB(on_NtAlpcDeleteSectionView_enter) || PPP_CHECK_CB(on_NtAlpcDeleteSectionView_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -577,10 +638,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAlpcDeleteSectionView_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtAlpcDeleteSectionView_enter, rp.proc_id, pc, 30, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 31 NTSTATUS NtAlpcDeleteSecurityContext ['HANDLE PortHandle', ' ULONG Flags', ' ALPC_HANDLE ContextHandle']
 case 31: {
+if (PPP_CHECK_CB(on_NtAlpcDeleteSecurityContext_enter) || PPP_CHECK_CB(on_NtAlpcDeleteSecurityContext_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -589,20 +652,24 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAlpcDeleteSecurityContext_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtAlpcDeleteSecurityContext_enter, rp.proc_id, pc, 31, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 32 NTSTATUS NtAlpcDisconnectPort ['HANDLE PortHandle', ' ULONG Flags']
 case 32: {
+if (PPP_CHECK_CB(on_NtAlpcDisconnectPort_enter) || PPP_CHECK_CB(on_NtAlpcDisconnectPort_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtAlpcDisconnectPort_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAlpcDisconnectPort_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtAlpcDisconnectPort_enter, rp.proc_id, pc, 32, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 33 NTSTATUS NtAlpcImpersonateClientOfPort ['HANDLE PortHandle', ' PPORT_MESSAGE PortMessage', ' PVOID Reserved']
 case 33: {
+if (PPP_CHECK_CB(on_NtAlpcImpersonateClientOfPort_enter) || PPP_CHECK_CB(on_NtAlpcImpersonateClientOfPort_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -611,10 +678,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAlpcImpersonateClientOfPort_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtAlpcImpersonateClientOfPort_enter, rp.proc_id, pc, 33, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 34 NTSTATUS NtAlpcOpenSenderProcess ['PHANDLE ProcessHandle', ' HANDLE PortHandle', ' PPORT_MESSAGE PortMessage', ' ULONG Flags', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
 case 34: {
+if (PPP_CHECK_CB(on_NtAlpcOpenSenderProcess_enter) || PPP_CHECK_CB(on_NtAlpcOpenSenderProcess_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -629,10 +698,12 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAlpcOpenSenderProcess_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+PPP_RUN_CB_FILTERED(on_NtAlpcOpenSenderProcess_enter, rp.proc_id, pc, 34, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 35 NTSTATUS NtAlpcOpenSenderThread ['PHANDLE ThreadHandle', ' HANDLE PortHandle', ' PPORT_MESSAGE PortMessage', ' ULONG Flags', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
 case 35: {
+if (PPP_CHECK_CB(on_NtAlpcOpenSenderThread_enter) || PPP_CHECK_CB(on_NtAlpcOpenSenderThread_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -647,10 +718,12 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAlpcOpenSenderThread_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+PPP_RUN_CB_FILTERED(on_NtAlpcOpenSenderThread_enter, rp.proc_id, pc, 35, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 36 NTSTATUS NtAlpcQueryInformation ['HANDLE PortHandle', ' ALPC_PORT_INFORMATION_CLASS PortInformationClass', ' PVOID PortInformation', ' ULONG Length', ' PULONG ReturnLength']
 case 36: {
+if (PPP_CHECK_CB(on_NtAlpcQueryInformation_enter) || PPP_CHECK_CB(on_NtAlpcQueryInformation_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -663,10 +736,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAlpcQueryInformation_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtAlpcQueryInformation_enter, rp.proc_id, pc, 36, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 37 NTSTATUS NtAlpcQueryInformationMessage ['HANDLE PortHandle', ' PPORT_MESSAGE PortMessage', ' ALPC_MESSAGE_INFORMATION_CLASS MessageInformationClass', ' PVOID MessageInformation', ' ULONG Length', ' PULONG ReturnLength']
 case 37: {
+if (PPP_CHECK_CB(on_NtAlpcQueryInformationMessage_enter) || PPP_CHECK_CB(on_NtAlpcQueryInformationMessage_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -681,10 +756,12 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAlpcQueryInformationMessage_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+PPP_RUN_CB_FILTERED(on_NtAlpcQueryInformationMessage_enter, rp.proc_id, pc, 37, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 38 NTSTATUS NtAlpcRevokeSecurityContext ['HANDLE PortHandle', ' ULONG Flags', ' ALPC_HANDLE ContextHandle']
 case 38: {
+if (PPP_CHECK_CB(on_NtAlpcRevokeSecurityContext_enter) || PPP_CHECK_CB(on_NtAlpcRevokeSecurityContext_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -693,10 +770,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAlpcRevokeSecurityContext_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtAlpcRevokeSecurityContext_enter, rp.proc_id, pc, 38, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 39 NTSTATUS NtAlpcSendWaitReceivePort ['HANDLE PortHandle', ' ULONG Flags', ' PPORT_MESSAGE SendMessage', ' PALPC_MESSAGE_ATTRIBUTES SendMessageAttributes', ' PPORT_MESSAGE ReceiveMessage', ' PULONG BufferLength', ' PALPC_MESSAGE_ATTRIBUTES ReceiveMessageAttributes', ' PLARGE_INTEGER Timeout']
 case 39: {
+if (PPP_CHECK_CB(on_NtAlpcSendWaitReceivePort_enter) || PPP_CHECK_CB(on_NtAlpcSendWaitReceivePort_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -715,10 +794,12 @@ memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 memcpy(rp.params[6], &arg6, sizeof(uint32_t));
 memcpy(rp.params[7], &arg7, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAlpcSendWaitReceivePort_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
+PPP_RUN_CB_FILTERED(on_NtAlpcSendWaitReceivePort_enter, rp.proc_id, pc, 39, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
+}
 }; break;
 // 40 NTSTATUS NtAlpcSetInformation ['HANDLE PortHandle', ' ALPC_PORT_INFORMATION_CLASS PortInformationClass', ' PVOID PortInformation', ' ULONG Length']
 case 40: {
+if (PPP_CHECK_CB(on_NtAlpcSetInformation_enter) || PPP_CHECK_CB(on_NtAlpcSetInformation_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -729,40 +810,48 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAlpcSetInformation_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtAlpcSetInformation_enter, rp.proc_id, pc, 40, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 41 NTSTATUS NtApphelpCacheControl ['APPHELPCOMMAND type', ' PVOID buf']
 case 41: {
+if (PPP_CHECK_CB(on_NtApphelpCacheControl_enter) || PPP_CHECK_CB(on_NtApphelpCacheControl_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtApphelpCacheControl_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtApphelpCacheControl_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtApphelpCacheControl_enter, rp.proc_id, pc, 41, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 42 NTSTATUS NtAreMappedFilesTheSame ['PVOID File1MappedAsAnImage', ' PVOID File2MappedAsFile']
 case 42: {
+if (PPP_CHECK_CB(on_NtAreMappedFilesTheSame_enter) || PPP_CHECK_CB(on_NtAreMappedFilesTheSame_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtAreMappedFilesTheSame_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAreMappedFilesTheSame_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtAreMappedFilesTheSame_enter, rp.proc_id, pc, 42, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 43 NTSTATUS NtAssignProcessToJobObject ['HANDLE JobHandle', ' HANDLE ProcessHandle']
 case 43: {
+if (PPP_CHECK_CB(on_NtAssignProcessToJobObject_enter) || PPP_CHECK_CB(on_NtAssignProcessToJobObject_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtAssignProcessToJobObject_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAssignProcessToJobObject_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtAssignProcessToJobObject_enter, rp.proc_id, pc, 43, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 44 NTSTATUS NtCallbackReturn ['PVOID OutputBuffer', ' ULONG OutputLength', ' NTSTATUS Status']
 case 44: {
+if (PPP_CHECK_CB(on_NtCallbackReturn_enter) || PPP_CHECK_CB(on_NtCallbackReturn_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -771,20 +860,24 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCallbackReturn_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtCallbackReturn_enter, rp.proc_id, pc, 44, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 45 NTSTATUS NtCancelIoFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock']
 case 45: {
+if (PPP_CHECK_CB(on_NtCancelIoFile_enter) || PPP_CHECK_CB(on_NtCancelIoFile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtCancelIoFile_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCancelIoFile_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtCancelIoFile_enter, rp.proc_id, pc, 45, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 46 NTSTATUS NtCancelIoFileEx ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoRequestToCancel', ' PIO_STATUS_BLOCK IoStatusBlock']
 case 46: {
+if (PPP_CHECK_CB(on_NtCancelIoFileEx_enter) || PPP_CHECK_CB(on_NtCancelIoFileEx_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -793,10 +886,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCancelIoFileEx_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtCancelIoFileEx_enter, rp.proc_id, pc, 46, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 47 NTSTATUS NtCancelSynchronousIoFile ['HANDLE ThreadHandle', ' PIO_STATUS_BLOCK IoRequestToCancel', ' PIO_STATUS_BLOCK IoStatusBlock']
 case 47: {
+if (PPP_CHECK_CB(on_NtCancelSynchronousIoFile_enter) || PPP_CHECK_CB(on_NtCancelSynchronousIoFile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -805,36 +900,44 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCancelSynchronousIoFile_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtCancelSynchronousIoFile_enter, rp.proc_id, pc, 47, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 48 NTSTATUS NtCancelTimer ['HANDLE TimerHandle', ' PBOOLEAN CurrentState']
 case 48: {
+if (PPP_CHECK_CB(on_NtCancelTimer_enter) || PPP_CHECK_CB(on_NtCancelTimer_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtCancelTimer_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCancelTimer_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtCancelTimer_enter, rp.proc_id, pc, 48, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 49 NTSTATUS NtClearEvent ['HANDLE EventHandle']
 case 49: {
+if (PPP_CHECK_CB(on_NtClearEvent_enter) || PPP_CHECK_CB(on_NtClearEvent_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtClearEvent_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtClearEvent_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtClearEvent_enter, rp.proc_id, pc, 49, env,pc,arg0) ; 
+}
 }; break;
 // 50 NTSTATUS NtClose ['HANDLE Handle']
 case 50: {
+if (PPP_CHECK_CB(on_NtClose_enter) || PPP_CHECK_CB(on_NtClose_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtClose_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtClose_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtClose_enter, rp.proc_id, pc, 50, env,pc,arg0) ; 
+}
 }; break;
 // 51 NTSTATUS NtCloseObjectAuditAlarm ['PUNICODE_STRING SubsystemName', ' PVOID HandleId', ' BOOLEAN GenerateOnClose']
 case 51: {
+if (PPP_CHECK_CB(on_NtCloseObjectAuditAlarm_enter) || PPP_CHECK_CB(on_NtCloseObjectAuditAlarm_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -843,50 +946,60 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCloseObjectAuditAlarm_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtCloseObjectAuditAlarm_enter, rp.proc_id, pc, 51, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 52 NTSTATUS NtCommitComplete ['HANDLE EnlistmentHandle', ' PLARGE_INTEGER TmVirtualClock']
 case 52: {
+if (PPP_CHECK_CB(on_NtCommitComplete_enter) || PPP_CHECK_CB(on_NtCommitComplete_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtCommitComplete_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCommitComplete_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtCommitComplete_enter, rp.proc_id, pc, 52, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 53 NTSTATUS NtCommitEnlistment ['HANDLE EnlistmentHandle', ' PLARGE_INTEGER TmVirtualClock']
 case 53: {
+if (PPP_CHECK_CB(on_NtCommitEnlistment_enter) || PPP_CHECK_CB(on_NtCommitEnlistment_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtCommitEnlistment_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCommitEnlistment_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtCommitEnlistment_enter, rp.proc_id, pc, 53, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 54 NTSTATUS NtCommitTransaction ['HANDLE TransactionHandle', ' BOOLEAN Wait']
 case 54: {
+if (PPP_CHECK_CB(on_NtCommitTransaction_enter) || PPP_CHECK_CB(on_NtCommitTransaction_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtCommitTransaction_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCommitTransaction_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtCommitTransaction_enter, rp.proc_id, pc, 54, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 55 NTSTATUS NtCompactKeys ['ULONG Count', ' HANDLE KeyArray[]']
 case 55: {
+if (PPP_CHECK_CB(on_NtCompactKeys_enter) || PPP_CHECK_CB(on_NtCompactKeys_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtCompactKeys_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCompactKeys_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtCompactKeys_enter, rp.proc_id, pc, 55, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 56 NTSTATUS NtCompareTokens ['HANDLE FirstTokenHandle', ' HANDLE SecondTokenHandle', ' PBOOLEAN Equal']
 case 56: {
+if (PPP_CHECK_CB(on_NtCompareTokens_enter) || PPP_CHECK_CB(on_NtCompareTokens_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -895,26 +1008,32 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCompareTokens_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtCompareTokens_enter, rp.proc_id, pc, 56, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 57 NTSTATUS NtCompleteConnectPort ['HANDLE PortHandle']
 case 57: {
+if (PPP_CHECK_CB(on_NtCompleteConnectPort_enter) || PPP_CHECK_CB(on_NtCompleteConnectPort_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtCompleteConnectPort_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCompleteConnectPort_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtCompleteConnectPort_enter, rp.proc_id, pc, 57, env,pc,arg0) ; 
+}
 }; break;
 // 58 NTSTATUS NtCompressKey ['HANDLE Key']
 case 58: {
+if (PPP_CHECK_CB(on_NtCompressKey_enter) || PPP_CHECK_CB(on_NtCompressKey_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtCompressKey_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCompressKey_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtCompressKey_enter, rp.proc_id, pc, 58, env,pc,arg0) ; 
+}
 }; break;
 // 59 NTSTATUS NtConnectPort ['PHANDLE PortHandle', ' PUNICODE_STRING PortName', ' PSECURITY_QUALITY_OF_SERVICE SecurityQos', ' PPORT_VIEW ClientView', ' PREMOTE_PORT_VIEW ServerView', ' PULONG MaxMessageLength', ' PVOID ConnectionInformation', ' PULONG ConnectionInformationLength']
 case 59: {
+if (PPP_CHECK_CB(on_NtConnectPort_enter) || PPP_CHECK_CB(on_NtConnectPort_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -933,20 +1052,24 @@ memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 memcpy(rp.params[6], &arg6, sizeof(uint32_t));
 memcpy(rp.params[7], &arg7, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtConnectPort_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
+PPP_RUN_CB_FILTERED(on_NtConnectPort_enter, rp.proc_id, pc, 59, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
+}
 }; break;
 // 60 NTSTATUS NtContinue ['PCONTEXT ContextRecord', ' BOOLEAN TestAlert']
 case 60: {
+if (PPP_CHECK_CB(on_NtContinue_enter) || PPP_CHECK_CB(on_NtContinue_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtContinue_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtContinue_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtContinue_enter, rp.proc_id, pc, 60, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 61 NTSTATUS NtCreateDebugObject ['PHANDLE DebugObjectHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' ULONG Flags']
 case 61: {
+if (PPP_CHECK_CB(on_NtCreateDebugObject_enter) || PPP_CHECK_CB(on_NtCreateDebugObject_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -957,10 +1080,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreateDebugObject_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateDebugObject_enter, rp.proc_id, pc, 61, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 62 NTSTATUS NtCreateDirectoryObject ['PHANDLE DirectoryHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
 case 62: {
+if (PPP_CHECK_CB(on_NtCreateDirectoryObject_enter) || PPP_CHECK_CB(on_NtCreateDirectoryObject_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -969,10 +1094,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreateDirectoryObject_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateDirectoryObject_enter, rp.proc_id, pc, 62, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 63 NTSTATUS NtCreateEnlistment ['PHANDLE EnlistmentHandle', ' ACCESS_MASK DesiredAccess', ' HANDLE ResourceManagerHandle', ' HANDLE TransactionHandle', ' POBJECT_ATTRIBUTES ObjectAttributes', ' ULONG CreateOptions', ' NOTIFICATION_MASK NotificationMask', ' PVOID EnlistmentKey']
 case 63: {
+if (PPP_CHECK_CB(on_NtCreateEnlistment_enter) || PPP_CHECK_CB(on_NtCreateEnlistment_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -991,10 +1118,12 @@ memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 memcpy(rp.params[6], &arg6, sizeof(uint32_t));
 memcpy(rp.params[7], &arg7, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreateEnlistment_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateEnlistment_enter, rp.proc_id, pc, 63, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
+}
 }; break;
 // 64 NTSTATUS NtCreateEvent ['PHANDLE EventHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' EVENT_TYPE EventType', ' BOOLEAN InitialState']
 case 64: {
+if (PPP_CHECK_CB(on_NtCreateEvent_enter) || PPP_CHECK_CB(on_NtCreateEvent_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1007,10 +1136,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreateEvent_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateEvent_enter, rp.proc_id, pc, 64, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 65 NTSTATUS NtCreateEventPair ['PHANDLE EventPairHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
 case 65: {
+if (PPP_CHECK_CB(on_NtCreateEventPair_enter) || PPP_CHECK_CB(on_NtCreateEventPair_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1019,10 +1150,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreateEventPair_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateEventPair_enter, rp.proc_id, pc, 65, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 66 NTSTATUS NtCreateFile ['PHANDLE FileHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PIO_STATUS_BLOCK IoStatusBlock', ' PLARGE_INTEGER AllocationSize', ' ULONG FileAttributes', ' ULONG ShareAccess', ' ULONG CreateDisposition', ' ULONG CreateOptions', ' PVOID EaBuffer', ' ULONG EaLength']
 case 66: {
+if (PPP_CHECK_CB(on_NtCreateFile_enter) || PPP_CHECK_CB(on_NtCreateFile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1047,10 +1180,12 @@ memcpy(rp.params[8], &arg8, sizeof(uint32_t));
 memcpy(rp.params[9], &arg9, sizeof(uint32_t));
 memcpy(rp.params[10], &arg10, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreateFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateFile_enter, rp.proc_id, pc, 66, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10) ; 
+}
 }; break;
 // 67 NTSTATUS NtCreateIoCompletion ['PHANDLE IoCompletionHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' ULONG Count']
 case 67: {
+if (PPP_CHECK_CB(on_NtCreateIoCompletion_enter) || PPP_CHECK_CB(on_NtCreateIoCompletion_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1061,10 +1196,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreateIoCompletion_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateIoCompletion_enter, rp.proc_id, pc, 67, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 68 NTSTATUS NtCreateJobObject ['PHANDLE JobHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
 case 68: {
+if (PPP_CHECK_CB(on_NtCreateJobObject_enter) || PPP_CHECK_CB(on_NtCreateJobObject_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1073,10 +1210,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreateJobObject_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateJobObject_enter, rp.proc_id, pc, 68, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 69 NTSTATUS NtCreateJobSet ['ULONG NumJob', ' PJOB_SET_ARRAY UserJobSet', ' ULONG Flags']
 case 69: {
+if (PPP_CHECK_CB(on_NtCreateJobSet_enter) || PPP_CHECK_CB(on_NtCreateJobSet_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1085,10 +1224,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreateJobSet_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateJobSet_enter, rp.proc_id, pc, 69, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 70 NTSTATUS NtCreateKey ['PHANDLE KeyHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' ULONG TitleIndex', ' PUNICODE_STRING Class', ' ULONG CreateOptions', ' PULONG Disposition']
 case 70: {
+if (PPP_CHECK_CB(on_NtCreateKey_enter) || PPP_CHECK_CB(on_NtCreateKey_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1105,10 +1246,12 @@ memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 memcpy(rp.params[6], &arg6, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreateKey_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateKey_enter, rp.proc_id, pc, 70, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
+}
 }; break;
 // 71 NTSTATUS NtCreateKeyedEvent ['PHANDLE KeyedEventHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' ULONG Flags']
 case 71: {
+if (PPP_CHECK_CB(on_NtCreateKeyedEvent_enter) || PPP_CHECK_CB(on_NtCreateKeyedEvent_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1119,10 +1262,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreateKeyedEvent_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateKeyedEvent_enter, rp.proc_id, pc, 71, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 72 NTSTATUS NtCreateKeyTransacted ['PHANDLE KeyHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' ULONG TitleIndex', ' PUNICODE_STRING Class', ' ULONG CreateOptions', ' HANDLE TransactionHandle', ' PULONG Disposition']
 case 72: {
+if (PPP_CHECK_CB(on_NtCreateKeyTransacted_enter) || PPP_CHECK_CB(on_NtCreateKeyTransacted_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1141,10 +1286,12 @@ memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 memcpy(rp.params[6], &arg6, sizeof(uint32_t));
 memcpy(rp.params[7], &arg7, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreateKeyTransacted_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateKeyTransacted_enter, rp.proc_id, pc, 72, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
+}
 }; break;
 // 73 NTSTATUS NtCreateMailslotFile ['PHANDLE FileHandle', ' ULONG DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PIO_STATUS_BLOCK IoStatusBlock', ' ULONG CreateOptions', ' ULONG MailslotQuota', ' ULONG MaximumMessageSize', ' PLARGE_INTEGER ReadTimeout']
 case 73: {
+if (PPP_CHECK_CB(on_NtCreateMailslotFile_enter) || PPP_CHECK_CB(on_NtCreateMailslotFile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1163,10 +1310,12 @@ memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 memcpy(rp.params[6], &arg6, sizeof(uint32_t));
 memcpy(rp.params[7], &arg7, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreateMailslotFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateMailslotFile_enter, rp.proc_id, pc, 73, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
+}
 }; break;
 // 74 NTSTATUS NtCreateMutant ['PHANDLE MutantHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' BOOLEAN InitialOwner']
 case 74: {
+if (PPP_CHECK_CB(on_NtCreateMutant_enter) || PPP_CHECK_CB(on_NtCreateMutant_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1177,10 +1326,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreateMutant_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateMutant_enter, rp.proc_id, pc, 74, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 75 NTSTATUS NtCreateNamedPipeFile ['PHANDLE FileHandle', ' ULONG DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PIO_STATUS_BLOCK IoStatusBlock', ' ULONG ShareAccess', ' ULONG CreateDisposition', ' ULONG CreateOptions', ' ULONG NamedPipeType', ' ULONG ReadMode', ' ULONG CompletionMode', ' ULONG MaximumInstances', ' ULONG InboundQuota', ' ULONG OutboundQuota', ' PLARGE_INTEGER DefaultTimeout']
 case 75: {
+if (PPP_CHECK_CB(on_NtCreateNamedPipeFile_enter) || PPP_CHECK_CB(on_NtCreateNamedPipeFile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1211,10 +1362,12 @@ memcpy(rp.params[11], &arg11, sizeof(uint32_t));
 memcpy(rp.params[12], &arg12, sizeof(uint32_t));
 memcpy(rp.params[13], &arg13, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreateNamedPipeFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11,arg12,arg13) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateNamedPipeFile_enter, rp.proc_id, pc, 75, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11,arg12,arg13) ; 
+}
 }; break;
 // 76 NTSTATUS NtCreatePagingFile ['PUNICODE_STRING PageFileName', ' PLARGE_INTEGER MinimumSize', ' PLARGE_INTEGER MaximumSize', ' ULONG Priority']
 case 76: {
+if (PPP_CHECK_CB(on_NtCreatePagingFile_enter) || PPP_CHECK_CB(on_NtCreatePagingFile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1225,10 +1378,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreatePagingFile_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtCreatePagingFile_enter, rp.proc_id, pc, 76, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 77 NTSTATUS NtCreatePort ['PHANDLE PortHandle', ' POBJECT_ATTRIBUTES ObjectAttributes', ' ULONG MaxConnectionInfoLength', ' ULONG MaxMessageLength', ' ULONG MaxPoolUsage']
 case 77: {
+if (PPP_CHECK_CB(on_NtCreatePort_enter) || PPP_CHECK_CB(on_NtCreatePort_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1241,10 +1396,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreatePort_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtCreatePort_enter, rp.proc_id, pc, 77, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 78 NTSTATUS NtCreatePrivateNamespace ['PHANDLE NamespaceHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PVOID BoundaryDescriptor']
 case 78: {
+if (PPP_CHECK_CB(on_NtCreatePrivateNamespace_enter) || PPP_CHECK_CB(on_NtCreatePrivateNamespace_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1255,10 +1412,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreatePrivateNamespace_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtCreatePrivateNamespace_enter, rp.proc_id, pc, 78, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 79 NTSTATUS NtCreateProcess ['PHANDLE ProcessHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' HANDLE ParentProcess', ' BOOLEAN InheritObjectTable', ' HANDLE SectionHandle', ' HANDLE DebugPort', ' HANDLE ExceptionPort']
 case 79: {
+if (PPP_CHECK_CB(on_NtCreateProcess_enter) || PPP_CHECK_CB(on_NtCreateProcess_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1277,10 +1436,12 @@ memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 memcpy(rp.params[6], &arg6, sizeof(uint32_t));
 memcpy(rp.params[7], &arg7, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreateProcess_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateProcess_enter, rp.proc_id, pc, 79, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
+}
 }; break;
 // 80 NTSTATUS NtCreateProcessEx ['PHANDLE ProcessHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' HANDLE ParentProcess', ' ULONG Flags', ' HANDLE SectionHandle', ' HANDLE DebugPort', ' HANDLE ExceptionPort', ' ULONG JobMemberLevel']
 case 80: {
+if (PPP_CHECK_CB(on_NtCreateProcessEx_enter) || PPP_CHECK_CB(on_NtCreateProcessEx_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1301,10 +1462,12 @@ memcpy(rp.params[6], &arg6, sizeof(uint32_t));
 memcpy(rp.params[7], &arg7, sizeof(uint32_t));
 memcpy(rp.params[8], &arg8, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreateProcessEx_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateProcessEx_enter, rp.proc_id, pc, 80, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+}
 }; break;
 // 81 NTSTATUS NtCreateProfile ['PHANDLE ProfileHandle', ' HANDLE Process', ' PVOID RangeBase', ' SIZE_T RangeSize', ' ULONG BucketSize', ' PULONG Buffer', ' ULONG BufferSize', ' KPROFILE_SOURCE ProfileSource', ' KAFFINITY Affinity']
 case 81: {
+if (PPP_CHECK_CB(on_NtCreateProfile_enter) || PPP_CHECK_CB(on_NtCreateProfile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1325,10 +1488,12 @@ memcpy(rp.params[6], &arg6, sizeof(uint32_t));
 memcpy(rp.params[7], &arg7, sizeof(uint32_t));
 memcpy(rp.params[8], &arg8, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreateProfile_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateProfile_enter, rp.proc_id, pc, 81, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+}
 }; break;
 // 82 NTSTATUS NtCreateProfileEx ['PHANDLE ProfileHandle', ' HANDLE Process', ' PVOID ProfileBase', ' SIZE_T ProfileSize', ' ULONG BucketSize', ' PULONG Buffer', ' ULONG BufferSize', ' KPROFILE_SOURCE ProfileSource', ' ULONG GroupAffinityCount', ' PGROUP_AFFINITY GroupAffinity']
 case 82: {
+if (PPP_CHECK_CB(on_NtCreateProfileEx_enter) || PPP_CHECK_CB(on_NtCreateProfileEx_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1351,10 +1516,12 @@ memcpy(rp.params[7], &arg7, sizeof(uint32_t));
 memcpy(rp.params[8], &arg8, sizeof(uint32_t));
 memcpy(rp.params[9], &arg9, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreateProfileEx_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateProfileEx_enter, rp.proc_id, pc, 82, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9) ; 
+}
 }; break;
 // 83 NTSTATUS NtCreateResourceManager ['PHANDLE ResourceManagerHandle', ' ACCESS_MASK DesiredAccess', ' HANDLE TmHandle', ' LPGUID RmGuid', ' POBJECT_ATTRIBUTES ObjectAttributes', ' ULONG CreateOptions', ' PUNICODE_STRING Description']
 case 83: {
+if (PPP_CHECK_CB(on_NtCreateResourceManager_enter) || PPP_CHECK_CB(on_NtCreateResourceManager_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1371,10 +1538,12 @@ memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 memcpy(rp.params[6], &arg6, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreateResourceManager_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateResourceManager_enter, rp.proc_id, pc, 83, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
+}
 }; break;
 // 84 NTSTATUS NtCreateSection ['PHANDLE SectionHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PLARGE_INTEGER MaximumSize', ' ULONG SectionPageProtection', ' ULONG AllocationAttributes', ' HANDLE FileHandle']
 case 84: {
+if (PPP_CHECK_CB(on_NtCreateSection_enter) || PPP_CHECK_CB(on_NtCreateSection_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1391,10 +1560,12 @@ memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 memcpy(rp.params[6], &arg6, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreateSection_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateSection_enter, rp.proc_id, pc, 84, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
+}
 }; break;
 // 85 NTSTATUS NtCreateSemaphore ['PHANDLE SemaphoreHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' LONG InitialCount', ' LONG MaximumCount']
 case 85: {
+if (PPP_CHECK_CB(on_NtCreateSemaphore_enter) || PPP_CHECK_CB(on_NtCreateSemaphore_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1407,10 +1578,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(int32_t));
 memcpy(rp.params[4], &arg4, sizeof(int32_t));
 }
-PPP_RUN_CB(on_NtCreateSemaphore_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateSemaphore_enter, rp.proc_id, pc, 85, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 86 NTSTATUS NtCreateSymbolicLinkObject ['PHANDLE LinkHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PUNICODE_STRING LinkTarget']
 case 86: {
+if (PPP_CHECK_CB(on_NtCreateSymbolicLinkObject_enter) || PPP_CHECK_CB(on_NtCreateSymbolicLinkObject_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1421,10 +1594,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreateSymbolicLinkObject_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateSymbolicLinkObject_enter, rp.proc_id, pc, 86, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 87 NTSTATUS NtCreateThread ['PHANDLE ThreadHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' HANDLE ProcessHandle', ' PCLIENT_ID ClientId', ' PCONTEXT ThreadContext', ' PINITIAL_TEB InitialTeb', ' BOOLEAN CreateSuspended']
 case 87: {
+if (PPP_CHECK_CB(on_NtCreateThread_enter) || PPP_CHECK_CB(on_NtCreateThread_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1443,10 +1618,12 @@ memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 memcpy(rp.params[6], &arg6, sizeof(uint32_t));
 memcpy(rp.params[7], &arg7, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreateThread_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateThread_enter, rp.proc_id, pc, 87, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
+}
 }; break;
 // 88 NTSTATUS NtCreateThreadEx ['PHANDLE ThreadHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' HANDLE ProcessHandle', ' PVOID StartRoutine', ' PVOID Argument', ' ULONG CreateFlags', ' ULONG_PTR ZeroBits', ' SIZE_T StackSize', ' SIZE_T MaximumStackSize', ' PPS_ATTRIBUTE_LIST AttributeList']
 case 88: {
+if (PPP_CHECK_CB(on_NtCreateThreadEx_enter) || PPP_CHECK_CB(on_NtCreateThreadEx_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1471,10 +1648,12 @@ memcpy(rp.params[8], &arg8, sizeof(uint32_t));
 memcpy(rp.params[9], &arg9, sizeof(uint32_t));
 memcpy(rp.params[10], &arg10, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreateThreadEx_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateThreadEx_enter, rp.proc_id, pc, 88, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10) ; 
+}
 }; break;
 // 89 NTSTATUS NtCreateTimer ['PHANDLE TimerHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' TIMER_TYPE TimerType']
 case 89: {
+if (PPP_CHECK_CB(on_NtCreateTimer_enter) || PPP_CHECK_CB(on_NtCreateTimer_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1485,10 +1664,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreateTimer_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateTimer_enter, rp.proc_id, pc, 89, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 90 NTSTATUS NtCreateToken ['PHANDLE TokenHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' TOKEN_TYPE TokenType', ' PLUID AuthenticationId', ' PLARGE_INTEGER ExpirationTime', ' PTOKEN_USER User', ' PTOKEN_GROUPS Groups', ' PTOKEN_PRIVILEGES Privileges', ' PTOKEN_OWNER Owner', ' PTOKEN_PRIMARY_GROUP PrimaryGroup', ' PTOKEN_DEFAULT_DACL DefaultDacl', ' PTOKEN_SOURCE TokenSource']
 case 90: {
+if (PPP_CHECK_CB(on_NtCreateToken_enter) || PPP_CHECK_CB(on_NtCreateToken_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1517,10 +1698,12 @@ memcpy(rp.params[10], &arg10, sizeof(uint32_t));
 memcpy(rp.params[11], &arg11, sizeof(uint32_t));
 memcpy(rp.params[12], &arg12, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreateToken_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11,arg12) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateToken_enter, rp.proc_id, pc, 90, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11,arg12) ; 
+}
 }; break;
 // 91 NTSTATUS NtCreateTransaction ['PHANDLE TransactionHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' LPGUID Uow', ' HANDLE TmHandle', ' ULONG CreateOptions', ' ULONG IsolationLevel', ' ULONG IsolationFlags', ' PLARGE_INTEGER Timeout', ' PUNICODE_STRING Description']
 case 91: {
+if (PPP_CHECK_CB(on_NtCreateTransaction_enter) || PPP_CHECK_CB(on_NtCreateTransaction_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1543,10 +1726,12 @@ memcpy(rp.params[7], &arg7, sizeof(uint32_t));
 memcpy(rp.params[8], &arg8, sizeof(uint32_t));
 memcpy(rp.params[9], &arg9, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreateTransaction_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateTransaction_enter, rp.proc_id, pc, 91, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9) ; 
+}
 }; break;
 // 92 NTSTATUS NtCreateTransactionManager ['PHANDLE TmHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PUNICODE_STRING LogFileName', ' ULONG CreateOptions', ' ULONG CommitStrength']
 case 92: {
+if (PPP_CHECK_CB(on_NtCreateTransactionManager_enter) || PPP_CHECK_CB(on_NtCreateTransactionManager_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1561,10 +1746,12 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreateTransactionManager_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateTransactionManager_enter, rp.proc_id, pc, 92, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 93 NTSTATUS NtCreateUserProcess ['PHANDLE ProcessHandle', ' PHANDLE ThreadHandle', ' ACCESS_MASK ProcessDesiredAccess', ' ACCESS_MASK ThreadDesiredAccess', ' POBJECT_ATTRIBUTES ProcessObjectAttributes', ' POBJECT_ATTRIBUTES ThreadObjectAttributes', ' ULONG ProcessFlags', ' ULONG ThreadFlags', ' PRTL_USER_PROCESS_PARAMETERS ProcessParameters', ' PPROCESS_CREATE_INFO CreateInfo', ' PPROCESS_ATTRIBUTE_LIST AttributeList']
 case 93: {
+if (PPP_CHECK_CB(on_NtCreateUserProcess_enter) || PPP_CHECK_CB(on_NtCreateUserProcess_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1589,10 +1776,12 @@ memcpy(rp.params[8], &arg8, sizeof(uint32_t));
 memcpy(rp.params[9], &arg9, sizeof(uint32_t));
 memcpy(rp.params[10], &arg10, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreateUserProcess_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateUserProcess_enter, rp.proc_id, pc, 93, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10) ; 
+}
 }; break;
 // 94 NTSTATUS NtCreateWaitablePort ['PHANDLE PortHandle', ' POBJECT_ATTRIBUTES ObjectAttributes', ' ULONG MaxConnectionInfoLength', ' ULONG MaxMessageLength', ' ULONG MaxPoolUsage']
 case 94: {
+if (PPP_CHECK_CB(on_NtCreateWaitablePort_enter) || PPP_CHECK_CB(on_NtCreateWaitablePort_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1605,10 +1794,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreateWaitablePort_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateWaitablePort_enter, rp.proc_id, pc, 94, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 95 NTSTATUS NtCreateWorkerFactory ['PHANDLE WorkerFactoryHandleReturn', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' HANDLE CompletionPortHandle', ' HANDLE WorkerProcessHandle', ' PVOID StartRoutine', ' PVOID StartParameter', ' ULONG MaxThreadCount', ' SIZE_T StackReserve', ' SIZE_T StackCommit']
 case 95: {
+if (PPP_CHECK_CB(on_NtCreateWorkerFactory_enter) || PPP_CHECK_CB(on_NtCreateWorkerFactory_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1631,20 +1822,24 @@ memcpy(rp.params[7], &arg7, sizeof(uint32_t));
 memcpy(rp.params[8], &arg8, sizeof(uint32_t));
 memcpy(rp.params[9], &arg9, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreateWorkerFactory_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateWorkerFactory_enter, rp.proc_id, pc, 95, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9) ; 
+}
 }; break;
 // 96 NTSTATUS NtDebugActiveProcess ['HANDLE ProcessHandle', ' HANDLE DebugObjectHandle']
 case 96: {
+if (PPP_CHECK_CB(on_NtDebugActiveProcess_enter) || PPP_CHECK_CB(on_NtDebugActiveProcess_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtDebugActiveProcess_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtDebugActiveProcess_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtDebugActiveProcess_enter, rp.proc_id, pc, 96, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 97 NTSTATUS NtDebugContinue ['HANDLE DebugObjectHandle', ' PCLIENT_ID ClientId', ' NTSTATUS ContinueStatus']
 case 97: {
+if (PPP_CHECK_CB(on_NtDebugContinue_enter) || PPP_CHECK_CB(on_NtDebugContinue_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1653,60 +1848,74 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtDebugContinue_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtDebugContinue_enter, rp.proc_id, pc, 97, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 98 NTSTATUS NtDelayExecution ['BOOLEAN Alertable', ' PLARGE_INTEGER DelayInterval']
 case 98: {
+if (PPP_CHECK_CB(on_NtDelayExecution_enter) || PPP_CHECK_CB(on_NtDelayExecution_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtDelayExecution_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtDelayExecution_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtDelayExecution_enter, rp.proc_id, pc, 98, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 99 NTSTATUS NtDeleteAtom ['RTL_ATOM Atom']
 case 99: {
+if (PPP_CHECK_CB(on_NtDeleteAtom_enter) || PPP_CHECK_CB(on_NtDeleteAtom_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtDeleteAtom_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtDeleteAtom_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtDeleteAtom_enter, rp.proc_id, pc, 99, env,pc,arg0) ; 
+}
 }; break;
 // 100 NTSTATUS NtDeleteBootEntry ['ULONG Id']
 case 100: {
+if (PPP_CHECK_CB(on_NtDeleteBootEntry_enter) || PPP_CHECK_CB(on_NtDeleteBootEntry_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtDeleteBootEntry_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtDeleteBootEntry_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtDeleteBootEntry_enter, rp.proc_id, pc, 100, env,pc,arg0) ; 
+}
 }; break;
 // 101 NTSTATUS NtDeleteDriverEntry ['ULONG Id']
 case 101: {
+if (PPP_CHECK_CB(on_NtDeleteDriverEntry_enter) || PPP_CHECK_CB(on_NtDeleteDriverEntry_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtDeleteDriverEntry_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtDeleteDriverEntry_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtDeleteDriverEntry_enter, rp.proc_id, pc, 101, env,pc,arg0) ; 
+}
 }; break;
 // 102 NTSTATUS NtDeleteFile ['POBJECT_ATTRIBUTES ObjectAttributes']
 case 102: {
+if (PPP_CHECK_CB(on_NtDeleteFile_enter) || PPP_CHECK_CB(on_NtDeleteFile_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtDeleteFile_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtDeleteFile_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtDeleteFile_enter, rp.proc_id, pc, 102, env,pc,arg0) ; 
+}
 }; break;
 // 103 NTSTATUS NtDeleteKey ['HANDLE KeyHandle']
 case 103: {
+if (PPP_CHECK_CB(on_NtDeleteKey_enter) || PPP_CHECK_CB(on_NtDeleteKey_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtDeleteKey_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtDeleteKey_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtDeleteKey_enter, rp.proc_id, pc, 103, env,pc,arg0) ; 
+}
 }; break;
 // 104 NTSTATUS NtDeleteObjectAuditAlarm ['PUNICODE_STRING SubsystemName', ' PVOID HandleId', ' BOOLEAN GenerateOnClose']
 case 104: {
+if (PPP_CHECK_CB(on_NtDeleteObjectAuditAlarm_enter) || PPP_CHECK_CB(on_NtDeleteObjectAuditAlarm_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1715,28 +1924,34 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtDeleteObjectAuditAlarm_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtDeleteObjectAuditAlarm_enter, rp.proc_id, pc, 104, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 105 NTSTATUS NtDeletePrivateNamespace ['HANDLE NamespaceHandle']
 case 105: {
+if (PPP_CHECK_CB(on_NtDeletePrivateNamespace_enter) || PPP_CHECK_CB(on_NtDeletePrivateNamespace_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtDeletePrivateNamespace_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtDeletePrivateNamespace_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtDeletePrivateNamespace_enter, rp.proc_id, pc, 105, env,pc,arg0) ; 
+}
 }; break;
 // 106 NTSTATUS NtDeleteValueKey ['HANDLE KeyHandle', ' PUNICODE_STRING ValueName']
 case 106: {
+if (PPP_CHECK_CB(on_NtDeleteValueKey_enter) || PPP_CHECK_CB(on_NtDeleteValueKey_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtDeleteValueKey_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtDeleteValueKey_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtDeleteValueKey_enter, rp.proc_id, pc, 106, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 107 NTSTATUS NtDeviceIoControlFile ['HANDLE FileHandle', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' ULONG IoControlCode', ' PVOID InputBuffer', ' ULONG InputBufferLength', ' PVOID OutputBuffer', ' ULONG OutputBufferLength']
 case 107: {
+if (PPP_CHECK_CB(on_NtDeviceIoControlFile_enter) || PPP_CHECK_CB(on_NtDeviceIoControlFile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1759,32 +1974,40 @@ memcpy(rp.params[7], &arg7, sizeof(uint32_t));
 memcpy(rp.params[8], &arg8, sizeof(uint32_t));
 memcpy(rp.params[9], &arg9, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtDeviceIoControlFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9) ; 
+PPP_RUN_CB_FILTERED(on_NtDeviceIoControlFile_enter, rp.proc_id, pc, 107, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9) ; 
+}
 }; break;
 // 108 NTSTATUS NtDisableLastKnownGood ['']
 case 108: {
+if (PPP_CHECK_CB(on_NtDisableLastKnownGood_enter) || PPP_CHECK_CB(on_NtDisableLastKnownGood_return)) {
 if (PPP_CHECK_CB(on_NtDisableLastKnownGood_return)) {
 }
-PPP_RUN_CB(on_NtDisableLastKnownGood_enter, env,pc) ; 
+PPP_RUN_CB_FILTERED(on_NtDisableLastKnownGood_enter, rp.proc_id, pc, 108, env,pc) ; 
+}
 }; break;
 // 109 NTSTATUS NtDisplayString ['PUNICODE_STRING String']
 case 109: {
+if (PPP_CHECK_CB(on_NtDisplayString_enter) || PPP_CHECK_CB(on_NtDisplayString_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtDisplayString_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtDisplayString_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtDisplayString_enter, rp.proc_id, pc, 109, env,pc,arg0) ; 
+}
 }; break;
 // 110 NTSTATUS NtDrawText ['PUNICODE_STRING Text']
 case 110: {
+if (PPP_CHECK_CB(on_NtDrawText_enter) || PPP_CHECK_CB(on_NtDrawText_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtDrawText_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtDrawText_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtDrawText_enter, rp.proc_id, pc, 110, env,pc,arg0) ; 
+}
 }; break;
 // 111 NTSTATUS NtDuplicateObject ['HANDLE SourceProcessHandle', ' HANDLE SourceHandle', ' HANDLE TargetProcessHandle', ' PHANDLE TargetHandle', ' ACCESS_MASK DesiredAccess', ' ULONG HandleAttributes', ' ULONG Options']
 case 111: {
+if (PPP_CHECK_CB(on_NtDuplicateObject_enter) || PPP_CHECK_CB(on_NtDuplicateObject_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1801,10 +2024,12 @@ memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 memcpy(rp.params[6], &arg6, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtDuplicateObject_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
+PPP_RUN_CB_FILTERED(on_NtDuplicateObject_enter, rp.proc_id, pc, 111, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
+}
 }; break;
 // 112 NTSTATUS NtDuplicateToken ['HANDLE ExistingTokenHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' BOOLEAN EffectiveOnly', ' TOKEN_TYPE TokenType', ' PHANDLE NewTokenHandle']
 case 112: {
+if (PPP_CHECK_CB(on_NtDuplicateToken_enter) || PPP_CHECK_CB(on_NtDuplicateToken_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1819,36 +2044,44 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtDuplicateToken_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+PPP_RUN_CB_FILTERED(on_NtDuplicateToken_enter, rp.proc_id, pc, 112, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 113 NTSTATUS NtEnableLastKnownGood ['']
 case 113: {
+if (PPP_CHECK_CB(on_NtEnableLastKnownGood_enter) || PPP_CHECK_CB(on_NtEnableLastKnownGood_return)) {
 if (PPP_CHECK_CB(on_NtEnableLastKnownGood_return)) {
 }
-PPP_RUN_CB(on_NtEnableLastKnownGood_enter, env,pc) ; 
+PPP_RUN_CB_FILTERED(on_NtEnableLastKnownGood_enter, rp.proc_id, pc, 113, env,pc) ; 
+}
 }; break;
 // 114 NTSTATUS NtEnumerateBootEntries ['PVOID Buffer', ' PULONG BufferLength']
 case 114: {
+if (PPP_CHECK_CB(on_NtEnumerateBootEntries_enter) || PPP_CHECK_CB(on_NtEnumerateBootEntries_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtEnumerateBootEntries_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtEnumerateBootEntries_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtEnumerateBootEntries_enter, rp.proc_id, pc, 114, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 115 NTSTATUS NtEnumerateDriverEntries ['PVOID Buffer', ' PULONG BufferLength']
 case 115: {
+if (PPP_CHECK_CB(on_NtEnumerateDriverEntries_enter) || PPP_CHECK_CB(on_NtEnumerateDriverEntries_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtEnumerateDriverEntries_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtEnumerateDriverEntries_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtEnumerateDriverEntries_enter, rp.proc_id, pc, 115, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 116 NTSTATUS NtEnumerateKey ['HANDLE KeyHandle', ' ULONG Index', ' KEY_INFORMATION_CLASS KeyInformationClass', ' PVOID KeyInformation', ' ULONG Length', ' PULONG ResultLength']
 case 116: {
+if (PPP_CHECK_CB(on_NtEnumerateKey_enter) || PPP_CHECK_CB(on_NtEnumerateKey_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1863,10 +2096,12 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtEnumerateKey_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+PPP_RUN_CB_FILTERED(on_NtEnumerateKey_enter, rp.proc_id, pc, 116, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 117 NTSTATUS NtEnumerateSystemEnvironmentValuesEx ['ULONG InformationClass', ' PVOID Buffer', ' PULONG BufferLength']
 case 117: {
+if (PPP_CHECK_CB(on_NtEnumerateSystemEnvironmentValuesEx_enter) || PPP_CHECK_CB(on_NtEnumerateSystemEnvironmentValuesEx_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1875,10 +2110,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtEnumerateSystemEnvironmentValuesEx_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtEnumerateSystemEnvironmentValuesEx_enter, rp.proc_id, pc, 117, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 118 NTSTATUS NtEnumerateTransactionObject ['HANDLE RootObjectHandle', ' KTMOBJECT_TYPE QueryType', ' PKTMOBJECT_CURSOR ObjectCursor', ' ULONG ObjectCursorLength', ' PULONG ReturnLength']
 case 118: {
+if (PPP_CHECK_CB(on_NtEnumerateTransactionObject_enter) || PPP_CHECK_CB(on_NtEnumerateTransactionObject_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1891,10 +2128,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtEnumerateTransactionObject_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtEnumerateTransactionObject_enter, rp.proc_id, pc, 118, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 119 NTSTATUS NtEnumerateValueKey ['HANDLE KeyHandle', ' ULONG Index', ' KEY_VALUE_INFORMATION_CLASS KeyValueInformationClass', ' PVOID KeyValueInformation', ' ULONG Length', ' PULONG ResultLength']
 case 119: {
+if (PPP_CHECK_CB(on_NtEnumerateValueKey_enter) || PPP_CHECK_CB(on_NtEnumerateValueKey_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1909,20 +2148,24 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtEnumerateValueKey_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+PPP_RUN_CB_FILTERED(on_NtEnumerateValueKey_enter, rp.proc_id, pc, 119, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 120 NTSTATUS NtExtendSection ['HANDLE SectionHandle', ' PLARGE_INTEGER NewSectionSize']
 case 120: {
+if (PPP_CHECK_CB(on_NtExtendSection_enter) || PPP_CHECK_CB(on_NtExtendSection_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtExtendSection_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtExtendSection_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtExtendSection_enter, rp.proc_id, pc, 120, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 121 NTSTATUS NtFilterToken ['HANDLE ExistingTokenHandle', ' ULONG Flags', ' PTOKEN_GROUPS SidsToDisable', ' PTOKEN_PRIVILEGES PrivilegesToDelete', ' PTOKEN_GROUPS RestrictedSids', ' PHANDLE NewTokenHandle']
 case 121: {
+if (PPP_CHECK_CB(on_NtFilterToken_enter) || PPP_CHECK_CB(on_NtFilterToken_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1937,10 +2180,12 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtFilterToken_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+PPP_RUN_CB_FILTERED(on_NtFilterToken_enter, rp.proc_id, pc, 121, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 122 NTSTATUS NtFindAtom ['PWSTR AtomName', ' ULONG Length', ' PRTL_ATOM Atom']
 case 122: {
+if (PPP_CHECK_CB(on_NtFindAtom_enter) || PPP_CHECK_CB(on_NtFindAtom_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1949,30 +2194,36 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtFindAtom_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtFindAtom_enter, rp.proc_id, pc, 122, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 123 NTSTATUS NtFlushBuffersFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock']
 case 123: {
+if (PPP_CHECK_CB(on_NtFlushBuffersFile_enter) || PPP_CHECK_CB(on_NtFlushBuffersFile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtFlushBuffersFile_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtFlushBuffersFile_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtFlushBuffersFile_enter, rp.proc_id, pc, 123, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 124 NTSTATUS NtFlushInstallUILanguage ['LANGID InstallUILanguage', ' ULONG SetComittedFlag']
 case 124: {
+if (PPP_CHECK_CB(on_NtFlushInstallUILanguage_enter) || PPP_CHECK_CB(on_NtFlushInstallUILanguage_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtFlushInstallUILanguage_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtFlushInstallUILanguage_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtFlushInstallUILanguage_enter, rp.proc_id, pc, 124, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 125 NTSTATUS NtFlushInstructionCache ['HANDLE ProcessHandle', ' PVOID BaseAddress', ' SIZE_T Length']
 case 125: {
+if (PPP_CHECK_CB(on_NtFlushInstructionCache_enter) || PPP_CHECK_CB(on_NtFlushInstructionCache_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1981,24 +2232,30 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtFlushInstructionCache_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtFlushInstructionCache_enter, rp.proc_id, pc, 125, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 126 NTSTATUS NtFlushKey ['HANDLE KeyHandle']
 case 126: {
+if (PPP_CHECK_CB(on_NtFlushKey_enter) || PPP_CHECK_CB(on_NtFlushKey_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtFlushKey_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtFlushKey_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtFlushKey_enter, rp.proc_id, pc, 126, env,pc,arg0) ; 
+}
 }; break;
 // 127 VOID NtFlushProcessWriteBuffers ['']
 case 127: {
+if (PPP_CHECK_CB(on_NtFlushProcessWriteBuffers_enter) || PPP_CHECK_CB(on_NtFlushProcessWriteBuffers_return)) {
 if (PPP_CHECK_CB(on_NtFlushProcessWriteBuffers_return)) {
 }
-PPP_RUN_CB(on_NtFlushProcessWriteBuffers_enter, env,pc) ; 
+PPP_RUN_CB_FILTERED(on_NtFlushProcessWriteBuffers_enter, rp.proc_id, pc, 127, env,pc) ; 
+}
 }; break;
 // 128 NTSTATUS NtFlushVirtualMemory ['HANDLE ProcessHandle', ' PVOID *BaseAddress', ' PSIZE_T RegionSize', ' PIO_STATUS_BLOCK IoStatus']
 case 128: {
+if (PPP_CHECK_CB(on_NtFlushVirtualMemory_enter) || PPP_CHECK_CB(on_NtFlushVirtualMemory_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2009,16 +2266,20 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtFlushVirtualMemory_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtFlushVirtualMemory_enter, rp.proc_id, pc, 128, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 129 NTSTATUS NtFlushWriteBuffer ['']
 case 129: {
+if (PPP_CHECK_CB(on_NtFlushWriteBuffer_enter) || PPP_CHECK_CB(on_NtFlushWriteBuffer_return)) {
 if (PPP_CHECK_CB(on_NtFlushWriteBuffer_return)) {
 }
-PPP_RUN_CB(on_NtFlushWriteBuffer_enter, env,pc) ; 
+PPP_RUN_CB_FILTERED(on_NtFlushWriteBuffer_enter, rp.proc_id, pc, 129, env,pc) ; 
+}
 }; break;
 // 130 NTSTATUS NtFreeUserPhysicalPages ['HANDLE ProcessHandle', ' PULONG_PTR NumberOfPages', ' PULONG_PTR UserPfnArray']
 case 130: {
+if (PPP_CHECK_CB(on_NtFreeUserPhysicalPages_enter) || PPP_CHECK_CB(on_NtFreeUserPhysicalPages_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2027,10 +2288,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtFreeUserPhysicalPages_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtFreeUserPhysicalPages_enter, rp.proc_id, pc, 130, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 131 NTSTATUS NtFreeVirtualMemory ['HANDLE ProcessHandle', ' PVOID *BaseAddress', ' PSIZE_T RegionSize', ' ULONG FreeType']
 case 131: {
+if (PPP_CHECK_CB(on_NtFreeVirtualMemory_enter) || PPP_CHECK_CB(on_NtFreeVirtualMemory_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2041,28 +2304,34 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtFreeVirtualMemory_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtFreeVirtualMemory_enter, rp.proc_id, pc, 131, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 132 NTSTATUS NtFreezeRegistry ['ULONG TimeOutInSeconds']
 case 132: {
+if (PPP_CHECK_CB(on_NtFreezeRegistry_enter) || PPP_CHECK_CB(on_NtFreezeRegistry_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtFreezeRegistry_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtFreezeRegistry_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtFreezeRegistry_enter, rp.proc_id, pc, 132, env,pc,arg0) ; 
+}
 }; break;
 // 133 NTSTATUS NtFreezeTransactions ['PLARGE_INTEGER FreezeTimeout', ' PLARGE_INTEGER ThawTimeout']
 case 133: {
+if (PPP_CHECK_CB(on_NtFreezeTransactions_enter) || PPP_CHECK_CB(on_NtFreezeTransactions_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtFreezeTransactions_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtFreezeTransactions_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtFreezeTransactions_enter, rp.proc_id, pc, 133, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 134 NTSTATUS NtFsControlFile ['HANDLE FileHandle', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' ULONG IoControlCode', ' PVOID InputBuffer', ' ULONG InputBufferLength', ' PVOID OutputBuffer', ' ULONG OutputBufferLength']
 case 134: {
+if (PPP_CHECK_CB(on_NtFsControlFile_enter) || PPP_CHECK_CB(on_NtFsControlFile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2085,36 +2354,44 @@ memcpy(rp.params[7], &arg7, sizeof(uint32_t));
 memcpy(rp.params[8], &arg8, sizeof(uint32_t));
 memcpy(rp.params[9], &arg9, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtFsControlFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9) ; 
+PPP_RUN_CB_FILTERED(on_NtFsControlFile_enter, rp.proc_id, pc, 134, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9) ; 
+}
 }; break;
 // 135 NTSTATUS NtGetContextThread ['HANDLE ThreadHandle', ' PCONTEXT ThreadContext']
 case 135: {
+if (PPP_CHECK_CB(on_NtGetContextThread_enter) || PPP_CHECK_CB(on_NtGetContextThread_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtGetContextThread_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtGetContextThread_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtGetContextThread_enter, rp.proc_id, pc, 135, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 136 ULONG NtGetCurrentProcessorNumber ['']
 case 136: {
+if (PPP_CHECK_CB(on_NtGetCurrentProcessorNumber_enter) || PPP_CHECK_CB(on_NtGetCurrentProcessorNumber_return)) {
 if (PPP_CHECK_CB(on_NtGetCurrentProcessorNumber_return)) {
 }
-PPP_RUN_CB(on_NtGetCurrentProcessorNumber_enter, env,pc) ; 
+PPP_RUN_CB_FILTERED(on_NtGetCurrentProcessorNumber_enter, rp.proc_id, pc, 136, env,pc) ; 
+}
 }; break;
 // 137 NTSTATUS NtGetDevicePowerState ['HANDLE Device', ' DEVICE_POWER_STATE *State']
 case 137: {
+if (PPP_CHECK_CB(on_NtGetDevicePowerState_enter) || PPP_CHECK_CB(on_NtGetDevicePowerState_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtGetDevicePowerState_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtGetDevicePowerState_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtGetDevicePowerState_enter, rp.proc_id, pc, 137, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 138 NTSTATUS NtGetMUIRegistryInfo ['ULONG Flags', ' PULONG DataSize', ' PVOID Data']
 case 138: {
+if (PPP_CHECK_CB(on_NtGetMUIRegistryInfo_enter) || PPP_CHECK_CB(on_NtGetMUIRegistryInfo_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2123,10 +2400,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtGetMUIRegistryInfo_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtGetMUIRegistryInfo_enter, rp.proc_id, pc, 138, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 139 NTSTATUS NtGetNextProcess ['HANDLE ProcessHandle', ' ACCESS_MASK DesiredAccess', ' ULONG HandleAttributes', ' ULONG Flags', ' PHANDLE NewProcessHandle']
 case 139: {
+if (PPP_CHECK_CB(on_NtGetNextProcess_enter) || PPP_CHECK_CB(on_NtGetNextProcess_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2139,10 +2418,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtGetNextProcess_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtGetNextProcess_enter, rp.proc_id, pc, 139, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 140 NTSTATUS NtGetNextThread ['HANDLE ProcessHandle', ' HANDLE ThreadHandle', ' ACCESS_MASK DesiredAccess', ' ULONG HandleAttributes', ' ULONG Flags', ' PHANDLE NewThreadHandle']
 case 140: {
+if (PPP_CHECK_CB(on_NtGetNextThread_enter) || PPP_CHECK_CB(on_NtGetNextThread_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2157,10 +2438,12 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtGetNextThread_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+PPP_RUN_CB_FILTERED(on_NtGetNextThread_enter, rp.proc_id, pc, 140, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 141 NTSTATUS NtGetNlsSectionPtr ['ULONG SectionType', ' ULONG SectionData', ' PVOID ContextData', ' PVOID *SectionPointer', ' PULONG SectionSize']
 case 141: {
+if (PPP_CHECK_CB(on_NtGetNlsSectionPtr_enter) || PPP_CHECK_CB(on_NtGetNlsSectionPtr_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2173,10 +2456,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtGetNlsSectionPtr_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtGetNlsSectionPtr_enter, rp.proc_id, pc, 141, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 142 NTSTATUS NtGetNotificationResourceManager ['HANDLE ResourceManagerHandle', ' PTRANSACTION_NOTIFICATION TransactionNotification', ' ULONG NotificationLength', ' PLARGE_INTEGER Timeout', ' PULONG ReturnLength', ' ULONG Asynchronous', ' ULONG_PTR AsynchronousContext']
 case 142: {
+if (PPP_CHECK_CB(on_NtGetNotificationResourceManager_enter) || PPP_CHECK_CB(on_NtGetNotificationResourceManager_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2193,10 +2478,12 @@ memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 memcpy(rp.params[6], &arg6, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtGetNotificationResourceManager_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
+PPP_RUN_CB_FILTERED(on_NtGetNotificationResourceManager_enter, rp.proc_id, pc, 142, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
+}
 }; break;
 // 143 NTSTATUS NtGetPlugPlayEvent ['HANDLE EventHandle', ' PVOID Context', ' PPLUGPLAY_EVENT_BLOCK EventBlock', ' ULONG EventBufferSize']
 case 143: {
+if (PPP_CHECK_CB(on_NtGetPlugPlayEvent_enter) || PPP_CHECK_CB(on_NtGetPlugPlayEvent_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2207,10 +2494,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtGetPlugPlayEvent_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtGetPlugPlayEvent_enter, rp.proc_id, pc, 143, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 144 NTSTATUS NtGetWriteWatch ['HANDLE ProcessHandle', ' ULONG Flags', ' PVOID BaseAddress', ' SIZE_T RegionSize', ' PVOID *UserAddressArray', ' PULONG_PTR EntriesInUserAddressArray', ' PULONG Granularity']
 case 144: {
+if (PPP_CHECK_CB(on_NtGetWriteWatch_enter) || PPP_CHECK_CB(on_NtGetWriteWatch_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2227,28 +2516,34 @@ memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 memcpy(rp.params[6], &arg6, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtGetWriteWatch_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
+PPP_RUN_CB_FILTERED(on_NtGetWriteWatch_enter, rp.proc_id, pc, 144, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
+}
 }; break;
 // 145 NTSTATUS NtImpersonateAnonymousToken ['HANDLE ThreadHandle']
 case 145: {
+if (PPP_CHECK_CB(on_NtImpersonateAnonymousToken_enter) || PPP_CHECK_CB(on_NtImpersonateAnonymousToken_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtImpersonateAnonymousToken_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtImpersonateAnonymousToken_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtImpersonateAnonymousToken_enter, rp.proc_id, pc, 145, env,pc,arg0) ; 
+}
 }; break;
 // 146 NTSTATUS NtImpersonateClientOfPort ['HANDLE PortHandle', ' PPORT_MESSAGE Message']
 case 146: {
+if (PPP_CHECK_CB(on_NtImpersonateClientOfPort_enter) || PPP_CHECK_CB(on_NtImpersonateClientOfPort_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtImpersonateClientOfPort_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtImpersonateClientOfPort_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtImpersonateClientOfPort_enter, rp.proc_id, pc, 146, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 147 NTSTATUS NtImpersonateThread ['HANDLE ServerThreadHandle', ' HANDLE ClientThreadHandle', ' PSECURITY_QUALITY_OF_SERVICE SecurityQos']
 case 147: {
+if (PPP_CHECK_CB(on_NtImpersonateThread_enter) || PPP_CHECK_CB(on_NtImpersonateThread_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2257,10 +2552,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtImpersonateThread_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtImpersonateThread_enter, rp.proc_id, pc, 147, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 148 NTSTATUS NtInitializeNlsFiles ['PVOID *BaseAddress', ' PLCID DefaultLocaleId', ' PLARGE_INTEGER DefaultCasingTableSize']
 case 148: {
+if (PPP_CHECK_CB(on_NtInitializeNlsFiles_enter) || PPP_CHECK_CB(on_NtInitializeNlsFiles_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2269,18 +2566,22 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtInitializeNlsFiles_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtInitializeNlsFiles_enter, rp.proc_id, pc, 148, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 149 NTSTATUS NtInitializeRegistry ['USHORT BootCondition']
 case 149: {
+if (PPP_CHECK_CB(on_NtInitializeRegistry_enter) || PPP_CHECK_CB(on_NtInitializeRegistry_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtInitializeRegistry_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtInitializeRegistry_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtInitializeRegistry_enter, rp.proc_id, pc, 149, env,pc,arg0) ; 
+}
 }; break;
 // 150 NTSTATUS NtInitiatePowerAction ['POWER_ACTION SystemAction', ' SYSTEM_POWER_STATE MinSystemState', ' ULONG Flags', ' BOOLEAN Asynchronous']
 case 150: {
+if (PPP_CHECK_CB(on_NtInitiatePowerAction_enter) || PPP_CHECK_CB(on_NtInitiatePowerAction_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2291,60 +2592,74 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtInitiatePowerAction_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtInitiatePowerAction_enter, rp.proc_id, pc, 150, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 151 NTSTATUS NtIsProcessInJob ['HANDLE ProcessHandle', ' HANDLE JobHandle']
 case 151: {
+if (PPP_CHECK_CB(on_NtIsProcessInJob_enter) || PPP_CHECK_CB(on_NtIsProcessInJob_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtIsProcessInJob_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtIsProcessInJob_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtIsProcessInJob_enter, rp.proc_id, pc, 151, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 152 BOOLEAN NtIsSystemResumeAutomatic ['']
 case 152: {
+if (PPP_CHECK_CB(on_NtIsSystemResumeAutomatic_enter) || PPP_CHECK_CB(on_NtIsSystemResumeAutomatic_return)) {
 if (PPP_CHECK_CB(on_NtIsSystemResumeAutomatic_return)) {
 }
-PPP_RUN_CB(on_NtIsSystemResumeAutomatic_enter, env,pc) ; 
+PPP_RUN_CB_FILTERED(on_NtIsSystemResumeAutomatic_enter, rp.proc_id, pc, 152, env,pc) ; 
+}
 }; break;
 // 153 NTSTATUS NtIsUILanguageComitted ['']
 case 153: {
+if (PPP_CHECK_CB(on_NtIsUILanguageComitted_enter) || PPP_CHECK_CB(on_NtIsUILanguageComitted_return)) {
 if (PPP_CHECK_CB(on_NtIsUILanguageComitted_return)) {
 }
-PPP_RUN_CB(on_NtIsUILanguageComitted_enter, env,pc) ; 
+PPP_RUN_CB_FILTERED(on_NtIsUILanguageComitted_enter, rp.proc_id, pc, 153, env,pc) ; 
+}
 }; break;
 // 154 NTSTATUS NtListenPort ['HANDLE PortHandle', ' PPORT_MESSAGE ConnectionRequest']
 case 154: {
+if (PPP_CHECK_CB(on_NtListenPort_enter) || PPP_CHECK_CB(on_NtListenPort_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtListenPort_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtListenPort_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtListenPort_enter, rp.proc_id, pc, 154, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 155 NTSTATUS NtLoadDriver ['PUNICODE_STRING DriverServiceName']
 case 155: {
+if (PPP_CHECK_CB(on_NtLoadDriver_enter) || PPP_CHECK_CB(on_NtLoadDriver_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtLoadDriver_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtLoadDriver_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtLoadDriver_enter, rp.proc_id, pc, 155, env,pc,arg0) ; 
+}
 }; break;
 // 156 NTSTATUS NtLoadKey ['POBJECT_ATTRIBUTES TargetKey', ' POBJECT_ATTRIBUTES SourceFile']
 case 156: {
+if (PPP_CHECK_CB(on_NtLoadKey_enter) || PPP_CHECK_CB(on_NtLoadKey_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtLoadKey_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtLoadKey_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtLoadKey_enter, rp.proc_id, pc, 156, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 157 NTSTATUS NtLoadKey2 ['POBJECT_ATTRIBUTES TargetKey', ' POBJECT_ATTRIBUTES SourceFile', ' ULONG Flags']
 case 157: {
+if (PPP_CHECK_CB(on_NtLoadKey2_enter) || PPP_CHECK_CB(on_NtLoadKey2_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2353,10 +2668,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtLoadKey2_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtLoadKey2_enter, rp.proc_id, pc, 157, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 158 NTSTATUS NtLoadKeyEx ['POBJECT_ATTRIBUTES TargetKey', ' POBJECT_ATTRIBUTES SourceFile', ' ULONG Flags', ' HANDLE TrustClassKey ']
 case 158: {
+if (PPP_CHECK_CB(on_NtLoadKeyEx_enter) || PPP_CHECK_CB(on_NtLoadKeyEx_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2367,10 +2684,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtLoadKeyEx_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtLoadKeyEx_enter, rp.proc_id, pc, 158, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 159 NTSTATUS NtLockFile ['HANDLE FileHandle', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' PLARGE_INTEGER ByteOffset', ' PLARGE_INTEGER Length', ' ULONG Key', ' BOOLEAN FailImmediately', ' BOOLEAN ExclusiveLock']
 case 159: {
+if (PPP_CHECK_CB(on_NtLockFile_enter) || PPP_CHECK_CB(on_NtLockFile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2393,28 +2712,34 @@ memcpy(rp.params[7], &arg7, sizeof(uint32_t));
 memcpy(rp.params[8], &arg8, sizeof(uint32_t));
 memcpy(rp.params[9], &arg9, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtLockFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9) ; 
+PPP_RUN_CB_FILTERED(on_NtLockFile_enter, rp.proc_id, pc, 159, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9) ; 
+}
 }; break;
 // 160 NTSTATUS NtLockProductActivationKeys ['ULONG *pPrivateVer', ' ULONG *pSafeMode']
 case 160: {
+if (PPP_CHECK_CB(on_NtLockProductActivationKeys_enter) || PPP_CHECK_CB(on_NtLockProductActivationKeys_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtLockProductActivationKeys_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtLockProductActivationKeys_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtLockProductActivationKeys_enter, rp.proc_id, pc, 160, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 161 NTSTATUS NtLockRegistryKey ['HANDLE KeyHandle']
 case 161: {
+if (PPP_CHECK_CB(on_NtLockRegistryKey_enter) || PPP_CHECK_CB(on_NtLockRegistryKey_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtLockRegistryKey_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtLockRegistryKey_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtLockRegistryKey_enter, rp.proc_id, pc, 161, env,pc,arg0) ; 
+}
 }; break;
 // 162 NTSTATUS NtLockVirtualMemory ['HANDLE ProcessHandle', ' PVOID *BaseAddress', ' PSIZE_T RegionSize', ' ULONG MapType']
 case 162: {
+if (PPP_CHECK_CB(on_NtLockVirtualMemory_enter) || PPP_CHECK_CB(on_NtLockVirtualMemory_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2425,26 +2750,32 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtLockVirtualMemory_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtLockVirtualMemory_enter, rp.proc_id, pc, 162, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 163 NTSTATUS NtMakePermanentObject ['HANDLE Handle']
 case 163: {
+if (PPP_CHECK_CB(on_NtMakePermanentObject_enter) || PPP_CHECK_CB(on_NtMakePermanentObject_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtMakePermanentObject_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtMakePermanentObject_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtMakePermanentObject_enter, rp.proc_id, pc, 163, env,pc,arg0) ; 
+}
 }; break;
 // 164 NTSTATUS NtMakeTemporaryObject ['HANDLE Handle']
 case 164: {
+if (PPP_CHECK_CB(on_NtMakeTemporaryObject_enter) || PPP_CHECK_CB(on_NtMakeTemporaryObject_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtMakeTemporaryObject_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtMakeTemporaryObject_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtMakeTemporaryObject_enter, rp.proc_id, pc, 164, env,pc,arg0) ; 
+}
 }; break;
 // 165 NTSTATUS NtMapCMFModule ['ULONG What', ' ULONG Index', ' PULONG CacheIndexOut', ' PULONG CacheFlagsOut', ' PULONG ViewSizeOut', ' PVOID *BaseAddress']
 case 165: {
+if (PPP_CHECK_CB(on_NtMapCMFModule_enter) || PPP_CHECK_CB(on_NtMapCMFModule_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2459,10 +2790,12 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtMapCMFModule_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+PPP_RUN_CB_FILTERED(on_NtMapCMFModule_enter, rp.proc_id, pc, 165, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 166 NTSTATUS NtMapUserPhysicalPages ['PVOID VirtualAddress', ' ULONG_PTR NumberOfPages', ' PULONG_PTR UserPfnArray']
 case 166: {
+if (PPP_CHECK_CB(on_NtMapUserPhysicalPages_enter) || PPP_CHECK_CB(on_NtMapUserPhysicalPages_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2471,10 +2804,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtMapUserPhysicalPages_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtMapUserPhysicalPages_enter, rp.proc_id, pc, 166, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 167 NTSTATUS NtMapUserPhysicalPagesScatter ['PVOID *VirtualAddresses', ' ULONG_PTR NumberOfPages', ' PULONG_PTR UserPfnArray']
 case 167: {
+if (PPP_CHECK_CB(on_NtMapUserPhysicalPagesScatter_enter) || PPP_CHECK_CB(on_NtMapUserPhysicalPagesScatter_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2483,10 +2818,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtMapUserPhysicalPagesScatter_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtMapUserPhysicalPagesScatter_enter, rp.proc_id, pc, 167, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 168 NTSTATUS NtMapViewOfSection ['HANDLE SectionHandle', ' HANDLE ProcessHandle', ' PVOID *BaseAddress', ' ULONG_PTR ZeroBits', ' SIZE_T CommitSize', ' PLARGE_INTEGER SectionOffset', ' PSIZE_T ViewSize', ' SECTION_INHERIT InheritDisposition', ' ULONG AllocationType', ' WIN32_PROTECTION_MASK Win32Protect']
 case 168: {
+if (PPP_CHECK_CB(on_NtMapViewOfSection_enter) || PPP_CHECK_CB(on_NtMapViewOfSection_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2509,26 +2846,32 @@ memcpy(rp.params[7], &arg7, sizeof(uint32_t));
 memcpy(rp.params[8], &arg8, sizeof(uint32_t));
 memcpy(rp.params[9], &arg9, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtMapViewOfSection_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9) ; 
+PPP_RUN_CB_FILTERED(on_NtMapViewOfSection_enter, rp.proc_id, pc, 168, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9) ; 
+}
 }; break;
 // 169 NTSTATUS NtModifyBootEntry ['PBOOT_ENTRY BootEntry']
 case 169: {
+if (PPP_CHECK_CB(on_NtModifyBootEntry_enter) || PPP_CHECK_CB(on_NtModifyBootEntry_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtModifyBootEntry_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtModifyBootEntry_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtModifyBootEntry_enter, rp.proc_id, pc, 169, env,pc,arg0) ; 
+}
 }; break;
 // 170 NTSTATUS NtModifyDriverEntry ['PEFI_DRIVER_ENTRY DriverEntry']
 case 170: {
+if (PPP_CHECK_CB(on_NtModifyDriverEntry_enter) || PPP_CHECK_CB(on_NtModifyDriverEntry_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtModifyDriverEntry_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtModifyDriverEntry_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtModifyDriverEntry_enter, rp.proc_id, pc, 170, env,pc,arg0) ; 
+}
 }; break;
 // 171 NTSTATUS NtNotifyChangeDirectoryFile ['HANDLE FileHandle', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID Buffer', ' ULONG Length', ' ULONG CompletionFilter', ' BOOLEAN WatchTree']
 case 171: {
+if (PPP_CHECK_CB(on_NtNotifyChangeDirectoryFile_enter) || PPP_CHECK_CB(on_NtNotifyChangeDirectoryFile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2549,10 +2892,12 @@ memcpy(rp.params[6], &arg6, sizeof(uint32_t));
 memcpy(rp.params[7], &arg7, sizeof(uint32_t));
 memcpy(rp.params[8], &arg8, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtNotifyChangeDirectoryFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+PPP_RUN_CB_FILTERED(on_NtNotifyChangeDirectoryFile_enter, rp.proc_id, pc, 171, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+}
 }; break;
 // 172 NTSTATUS NtNotifyChangeKey ['HANDLE KeyHandle', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' ULONG CompletionFilter', ' BOOLEAN WatchTree', ' PVOID Buffer', ' ULONG BufferSize', ' BOOLEAN Asynchronous']
 case 172: {
+if (PPP_CHECK_CB(on_NtNotifyChangeKey_enter) || PPP_CHECK_CB(on_NtNotifyChangeKey_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2575,10 +2920,12 @@ memcpy(rp.params[7], &arg7, sizeof(uint32_t));
 memcpy(rp.params[8], &arg8, sizeof(uint32_t));
 memcpy(rp.params[9], &arg9, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtNotifyChangeKey_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9) ; 
+PPP_RUN_CB_FILTERED(on_NtNotifyChangeKey_enter, rp.proc_id, pc, 172, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9) ; 
+}
 }; break;
 // 173 NTSTATUS NtNotifyChangeMultipleKeys ['HANDLE MasterKeyHandle', ' ULONG Count', ' OBJECT_ATTRIBUTES SlaveObjects[]', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' ULONG CompletionFilter', ' BOOLEAN WatchTree', ' PVOID Buffer', ' ULONG BufferSize', ' BOOLEAN Asynchronous']
 case 173: {
+if (PPP_CHECK_CB(on_NtNotifyChangeMultipleKeys_enter) || PPP_CHECK_CB(on_NtNotifyChangeMultipleKeys_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2605,10 +2952,12 @@ memcpy(rp.params[9], &arg9, sizeof(uint32_t));
 memcpy(rp.params[10], &arg10, sizeof(uint32_t));
 memcpy(rp.params[11], &arg11, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtNotifyChangeMultipleKeys_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11) ; 
+PPP_RUN_CB_FILTERED(on_NtNotifyChangeMultipleKeys_enter, rp.proc_id, pc, 173, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11) ; 
+}
 }; break;
 // 174 NTSTATUS NtNotifyChangeSession ['HANDLE Session', ' ULONG IoStateSequence', ' PVOID Reserved', ' ULONG Action', ' IO_SESSION_STATE IoState', ' IO_SESSION_STATE IoState2', ' PVOID Buffer', ' ULONG BufferSize']
 case 174: {
+if (PPP_CHECK_CB(on_NtNotifyChangeSession_enter) || PPP_CHECK_CB(on_NtNotifyChangeSession_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2627,10 +2976,12 @@ memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 memcpy(rp.params[6], &arg6, sizeof(uint32_t));
 memcpy(rp.params[7], &arg7, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtNotifyChangeSession_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
+PPP_RUN_CB_FILTERED(on_NtNotifyChangeSession_enter, rp.proc_id, pc, 174, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
+}
 }; break;
 // 175 NTSTATUS NtOpenDirectoryObject ['PHANDLE DirectoryHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
 case 175: {
+if (PPP_CHECK_CB(on_NtOpenDirectoryObject_enter) || PPP_CHECK_CB(on_NtOpenDirectoryObject_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2639,10 +2990,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtOpenDirectoryObject_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtOpenDirectoryObject_enter, rp.proc_id, pc, 175, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 176 NTSTATUS NtOpenEnlistment ['PHANDLE EnlistmentHandle', ' ACCESS_MASK DesiredAccess', ' HANDLE ResourceManagerHandle', ' LPGUID EnlistmentGuid', ' POBJECT_ATTRIBUTES ObjectAttributes']
 case 176: {
+if (PPP_CHECK_CB(on_NtOpenEnlistment_enter) || PPP_CHECK_CB(on_NtOpenEnlistment_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2655,10 +3008,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtOpenEnlistment_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtOpenEnlistment_enter, rp.proc_id, pc, 176, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 177 NTSTATUS NtOpenEvent ['PHANDLE EventHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
 case 177: {
+if (PPP_CHECK_CB(on_NtOpenEvent_enter) || PPP_CHECK_CB(on_NtOpenEvent_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2667,10 +3022,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtOpenEvent_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtOpenEvent_enter, rp.proc_id, pc, 177, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 178 NTSTATUS NtOpenEventPair ['PHANDLE EventPairHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
 case 178: {
+if (PPP_CHECK_CB(on_NtOpenEventPair_enter) || PPP_CHECK_CB(on_NtOpenEventPair_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2679,10 +3036,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtOpenEventPair_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtOpenEventPair_enter, rp.proc_id, pc, 178, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 179 NTSTATUS NtOpenFile ['PHANDLE FileHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PIO_STATUS_BLOCK IoStatusBlock', ' ULONG ShareAccess', ' ULONG OpenOptions']
 case 179: {
+if (PPP_CHECK_CB(on_NtOpenFile_enter) || PPP_CHECK_CB(on_NtOpenFile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2697,10 +3056,12 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtOpenFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+PPP_RUN_CB_FILTERED(on_NtOpenFile_enter, rp.proc_id, pc, 179, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 180 NTSTATUS NtOpenIoCompletion ['PHANDLE IoCompletionHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
 case 180: {
+if (PPP_CHECK_CB(on_NtOpenIoCompletion_enter) || PPP_CHECK_CB(on_NtOpenIoCompletion_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2709,10 +3070,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtOpenIoCompletion_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtOpenIoCompletion_enter, rp.proc_id, pc, 180, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 181 NTSTATUS NtOpenJobObject ['PHANDLE JobHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
 case 181: {
+if (PPP_CHECK_CB(on_NtOpenJobObject_enter) || PPP_CHECK_CB(on_NtOpenJobObject_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2721,10 +3084,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtOpenJobObject_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtOpenJobObject_enter, rp.proc_id, pc, 181, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 182 NTSTATUS NtOpenKey ['PHANDLE KeyHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
 case 182: {
+if (PPP_CHECK_CB(on_NtOpenKey_enter) || PPP_CHECK_CB(on_NtOpenKey_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2733,10 +3098,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtOpenKey_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtOpenKey_enter, rp.proc_id, pc, 182, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 183 NTSTATUS NtOpenKeyEx ['PHANDLE KeyHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' ULONG OpenOptions']
 case 183: {
+if (PPP_CHECK_CB(on_NtOpenKeyEx_enter) || PPP_CHECK_CB(on_NtOpenKeyEx_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2747,10 +3114,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtOpenKeyEx_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtOpenKeyEx_enter, rp.proc_id, pc, 183, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 184 NTSTATUS NtOpenKeyedEvent ['PHANDLE KeyedEventHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
 case 184: {
+if (PPP_CHECK_CB(on_NtOpenKeyedEvent_enter) || PPP_CHECK_CB(on_NtOpenKeyedEvent_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2759,10 +3128,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtOpenKeyedEvent_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtOpenKeyedEvent_enter, rp.proc_id, pc, 184, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 185 NTSTATUS NtOpenKeyTransacted ['PHANDLE KeyHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' HANDLE TransactionHandle']
 case 185: {
+if (PPP_CHECK_CB(on_NtOpenKeyTransacted_enter) || PPP_CHECK_CB(on_NtOpenKeyTransacted_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2773,10 +3144,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtOpenKeyTransacted_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtOpenKeyTransacted_enter, rp.proc_id, pc, 185, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 186 NTSTATUS NtOpenKeyTransactedEx ['PHANDLE KeyHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' ULONG OpenOptions', ' HANDLE TransactionHandle']
 case 186: {
+if (PPP_CHECK_CB(on_NtOpenKeyTransactedEx_enter) || PPP_CHECK_CB(on_NtOpenKeyTransactedEx_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2789,10 +3162,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtOpenKeyTransactedEx_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtOpenKeyTransactedEx_enter, rp.proc_id, pc, 186, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 187 NTSTATUS NtOpenMutant ['PHANDLE MutantHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
 case 187: {
+if (PPP_CHECK_CB(on_NtOpenMutant_enter) || PPP_CHECK_CB(on_NtOpenMutant_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2801,10 +3176,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtOpenMutant_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtOpenMutant_enter, rp.proc_id, pc, 187, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 188 NTSTATUS NtOpenObjectAuditAlarm ['PUNICODE_STRING SubsystemName', ' PVOID HandleId', ' PUNICODE_STRING ObjectTypeName', ' PUNICODE_STRING ObjectName', ' PSECURITY_DESCRIPTOR SecurityDescriptor', ' HANDLE ClientToken', ' ACCESS_MASK DesiredAccess', ' ACCESS_MASK GrantedAccess', ' PPRIVILEGE_SET Privileges', ' BOOLEAN ObjectCreation', ' BOOLEAN AccessGranted', ' PBOOLEAN GenerateOnClose']
 case 188: {
+if (PPP_CHECK_CB(on_NtOpenObjectAuditAlarm_enter) || PPP_CHECK_CB(on_NtOpenObjectAuditAlarm_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2831,10 +3208,12 @@ memcpy(rp.params[9], &arg9, sizeof(uint32_t));
 memcpy(rp.params[10], &arg10, sizeof(uint32_t));
 memcpy(rp.params[11], &arg11, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtOpenObjectAuditAlarm_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11) ; 
+PPP_RUN_CB_FILTERED(on_NtOpenObjectAuditAlarm_enter, rp.proc_id, pc, 188, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11) ; 
+}
 }; break;
 // 189 NTSTATUS NtOpenPrivateNamespace ['PHANDLE NamespaceHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PVOID BoundaryDescriptor']
 case 189: {
+if (PPP_CHECK_CB(on_NtOpenPrivateNamespace_enter) || PPP_CHECK_CB(on_NtOpenPrivateNamespace_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2845,10 +3224,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtOpenPrivateNamespace_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtOpenPrivateNamespace_enter, rp.proc_id, pc, 189, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 190 NTSTATUS NtOpenProcess ['PHANDLE ProcessHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PCLIENT_ID ClientId']
 case 190: {
+if (PPP_CHECK_CB(on_NtOpenProcess_enter) || PPP_CHECK_CB(on_NtOpenProcess_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2859,10 +3240,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtOpenProcess_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtOpenProcess_enter, rp.proc_id, pc, 190, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 191 NTSTATUS NtOpenProcessToken ['HANDLE ProcessHandle', ' ACCESS_MASK DesiredAccess', ' PHANDLE TokenHandle']
 case 191: {
+if (PPP_CHECK_CB(on_NtOpenProcessToken_enter) || PPP_CHECK_CB(on_NtOpenProcessToken_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2871,10 +3254,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtOpenProcessToken_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtOpenProcessToken_enter, rp.proc_id, pc, 191, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 192 NTSTATUS NtOpenProcessTokenEx ['HANDLE ProcessHandle', ' ACCESS_MASK DesiredAccess', ' ULONG HandleAttributes', ' PHANDLE TokenHandle']
 case 192: {
+if (PPP_CHECK_CB(on_NtOpenProcessTokenEx_enter) || PPP_CHECK_CB(on_NtOpenProcessTokenEx_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2885,10 +3270,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtOpenProcessTokenEx_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtOpenProcessTokenEx_enter, rp.proc_id, pc, 192, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 193 NTSTATUS NtOpenResourceManager ['PHANDLE ResourceManagerHandle', ' ACCESS_MASK DesiredAccess', ' HANDLE TmHandle', ' LPGUID ResourceManagerGuid', ' POBJECT_ATTRIBUTES ObjectAttributes']
 case 193: {
+if (PPP_CHECK_CB(on_NtOpenResourceManager_enter) || PPP_CHECK_CB(on_NtOpenResourceManager_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2901,10 +3288,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtOpenResourceManager_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtOpenResourceManager_enter, rp.proc_id, pc, 193, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 194 NTSTATUS NtOpenSection ['PHANDLE SectionHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
 case 194: {
+if (PPP_CHECK_CB(on_NtOpenSection_enter) || PPP_CHECK_CB(on_NtOpenSection_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2913,10 +3302,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtOpenSection_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtOpenSection_enter, rp.proc_id, pc, 194, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 195 NTSTATUS NtOpenSemaphore ['PHANDLE SemaphoreHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
 case 195: {
+if (PPP_CHECK_CB(on_NtOpenSemaphore_enter) || PPP_CHECK_CB(on_NtOpenSemaphore_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2925,10 +3316,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtOpenSemaphore_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtOpenSemaphore_enter, rp.proc_id, pc, 195, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 196 NTSTATUS NtOpenSession ['PHANDLE SessionHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
 case 196: {
+if (PPP_CHECK_CB(on_NtOpenSession_enter) || PPP_CHECK_CB(on_NtOpenSession_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2937,10 +3330,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtOpenSession_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtOpenSession_enter, rp.proc_id, pc, 196, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 197 NTSTATUS NtOpenSymbolicLinkObject ['PHANDLE LinkHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
 case 197: {
+if (PPP_CHECK_CB(on_NtOpenSymbolicLinkObject_enter) || PPP_CHECK_CB(on_NtOpenSymbolicLinkObject_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2949,10 +3344,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtOpenSymbolicLinkObject_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtOpenSymbolicLinkObject_enter, rp.proc_id, pc, 197, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 198 NTSTATUS NtOpenThread ['PHANDLE ThreadHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PCLIENT_ID ClientId']
 case 198: {
+if (PPP_CHECK_CB(on_NtOpenThread_enter) || PPP_CHECK_CB(on_NtOpenThread_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2963,10 +3360,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtOpenThread_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtOpenThread_enter, rp.proc_id, pc, 198, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 199 NTSTATUS NtOpenThreadToken ['HANDLE ThreadHandle', ' ACCESS_MASK DesiredAccess', ' BOOLEAN OpenAsSelf', ' PHANDLE TokenHandle']
 case 199: {
+if (PPP_CHECK_CB(on_NtOpenThreadToken_enter) || PPP_CHECK_CB(on_NtOpenThreadToken_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2977,10 +3376,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtOpenThreadToken_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtOpenThreadToken_enter, rp.proc_id, pc, 199, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 200 NTSTATUS NtOpenThreadTokenEx ['HANDLE ThreadHandle', ' ACCESS_MASK DesiredAccess', ' BOOLEAN OpenAsSelf', ' ULONG HandleAttributes', ' PHANDLE TokenHandle']
 case 200: {
+if (PPP_CHECK_CB(on_NtOpenThreadTokenEx_enter) || PPP_CHECK_CB(on_NtOpenThreadTokenEx_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2993,10 +3394,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtOpenThreadTokenEx_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtOpenThreadTokenEx_enter, rp.proc_id, pc, 200, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 201 NTSTATUS NtOpenTimer ['PHANDLE TimerHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
 case 201: {
+if (PPP_CHECK_CB(on_NtOpenTimer_enter) || PPP_CHECK_CB(on_NtOpenTimer_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3005,10 +3408,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtOpenTimer_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtOpenTimer_enter, rp.proc_id, pc, 201, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 202 NTSTATUS NtOpenTransaction ['PHANDLE TransactionHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' LPGUID Uow', ' HANDLE TmHandle']
 case 202: {
+if (PPP_CHECK_CB(on_NtOpenTransaction_enter) || PPP_CHECK_CB(on_NtOpenTransaction_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3021,10 +3426,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtOpenTransaction_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtOpenTransaction_enter, rp.proc_id, pc, 202, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 203 NTSTATUS NtOpenTransactionManager ['PHANDLE TmHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PUNICODE_STRING LogFileName', ' LPGUID TmIdentity', ' ULONG OpenOptions']
 case 203: {
+if (PPP_CHECK_CB(on_NtOpenTransactionManager_enter) || PPP_CHECK_CB(on_NtOpenTransactionManager_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3039,10 +3446,12 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtOpenTransactionManager_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+PPP_RUN_CB_FILTERED(on_NtOpenTransactionManager_enter, rp.proc_id, pc, 203, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 204 NTSTATUS NtPlugPlayControl ['PLUGPLAY_CONTROL_CLASS PnPControlClass', ' PVOID PnPControlData', ' ULONG PnPControlDataLength']
 case 204: {
+if (PPP_CHECK_CB(on_NtPlugPlayControl_enter) || PPP_CHECK_CB(on_NtPlugPlayControl_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3051,10 +3460,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtPlugPlayControl_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtPlugPlayControl_enter, rp.proc_id, pc, 204, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 205 NTSTATUS NtPowerInformation ['POWER_INFORMATION_LEVEL InformationLevel', ' PVOID InputBuffer', ' ULONG InputBufferLength', ' PVOID OutputBuffer', ' ULONG OutputBufferLength']
 case 205: {
+if (PPP_CHECK_CB(on_NtPowerInformation_enter) || PPP_CHECK_CB(on_NtPowerInformation_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3067,50 +3478,60 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtPowerInformation_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtPowerInformation_enter, rp.proc_id, pc, 205, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 206 NTSTATUS NtPrepareComplete ['HANDLE EnlistmentHandle', ' PLARGE_INTEGER TmVirtualClock']
 case 206: {
+if (PPP_CHECK_CB(on_NtPrepareComplete_enter) || PPP_CHECK_CB(on_NtPrepareComplete_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtPrepareComplete_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtPrepareComplete_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtPrepareComplete_enter, rp.proc_id, pc, 206, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 207 NTSTATUS NtPrepareEnlistment ['HANDLE EnlistmentHandle', ' PLARGE_INTEGER TmVirtualClock']
 case 207: {
+if (PPP_CHECK_CB(on_NtPrepareEnlistment_enter) || PPP_CHECK_CB(on_NtPrepareEnlistment_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtPrepareEnlistment_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtPrepareEnlistment_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtPrepareEnlistment_enter, rp.proc_id, pc, 207, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 208 NTSTATUS NtPrePrepareComplete ['HANDLE EnlistmentHandle', ' PLARGE_INTEGER TmVirtualClock']
 case 208: {
+if (PPP_CHECK_CB(on_NtPrePrepareComplete_enter) || PPP_CHECK_CB(on_NtPrePrepareComplete_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtPrePrepareComplete_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtPrePrepareComplete_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtPrePrepareComplete_enter, rp.proc_id, pc, 208, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 209 NTSTATUS NtPrePrepareEnlistment ['HANDLE EnlistmentHandle', ' PLARGE_INTEGER TmVirtualClock']
 case 209: {
+if (PPP_CHECK_CB(on_NtPrePrepareEnlistment_enter) || PPP_CHECK_CB(on_NtPrePrepareEnlistment_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtPrePrepareEnlistment_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtPrePrepareEnlistment_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtPrePrepareEnlistment_enter, rp.proc_id, pc, 209, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 210 NTSTATUS NtPrivilegeCheck ['HANDLE ClientToken', ' PPRIVILEGE_SET RequiredPrivileges', ' PBOOLEAN Result']
 case 210: {
+if (PPP_CHECK_CB(on_NtPrivilegeCheck_enter) || PPP_CHECK_CB(on_NtPrivilegeCheck_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3119,10 +3540,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtPrivilegeCheck_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtPrivilegeCheck_enter, rp.proc_id, pc, 210, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 211 NTSTATUS NtPrivilegedServiceAuditAlarm ['PUNICODE_STRING SubsystemName', ' PUNICODE_STRING ServiceName', ' HANDLE ClientToken', ' PPRIVILEGE_SET Privileges', ' BOOLEAN AccessGranted']
 case 211: {
+if (PPP_CHECK_CB(on_NtPrivilegedServiceAuditAlarm_enter) || PPP_CHECK_CB(on_NtPrivilegedServiceAuditAlarm_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3135,10 +3558,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtPrivilegedServiceAuditAlarm_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtPrivilegedServiceAuditAlarm_enter, rp.proc_id, pc, 211, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 212 NTSTATUS NtPrivilegeObjectAuditAlarm ['PUNICODE_STRING SubsystemName', ' PVOID HandleId', ' HANDLE ClientToken', ' ACCESS_MASK DesiredAccess', ' PPRIVILEGE_SET Privileges', ' BOOLEAN AccessGranted']
 case 212: {
+if (PPP_CHECK_CB(on_NtPrivilegeObjectAuditAlarm_enter) || PPP_CHECK_CB(on_NtPrivilegeObjectAuditAlarm_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3153,10 +3578,12 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtPrivilegeObjectAuditAlarm_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+PPP_RUN_CB_FILTERED(on_NtPrivilegeObjectAuditAlarm_enter, rp.proc_id, pc, 212, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 213 NTSTATUS NtPropagationComplete ['HANDLE ResourceManagerHandle', ' ULONG RequestCookie', ' ULONG BufferLength', ' PVOID Buffer']
 case 213: {
+if (PPP_CHECK_CB(on_NtPropagationComplete_enter) || PPP_CHECK_CB(on_NtPropagationComplete_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3167,10 +3594,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtPropagationComplete_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtPropagationComplete_enter, rp.proc_id, pc, 213, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 214 NTSTATUS NtPropagationFailed ['HANDLE ResourceManagerHandle', ' ULONG RequestCookie', ' NTSTATUS PropStatus']
 case 214: {
+if (PPP_CHECK_CB(on_NtPropagationFailed_enter) || PPP_CHECK_CB(on_NtPropagationFailed_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3179,10 +3608,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtPropagationFailed_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtPropagationFailed_enter, rp.proc_id, pc, 214, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 215 NTSTATUS NtProtectVirtualMemory ['HANDLE ProcessHandle', ' PVOID *BaseAddress', ' PSIZE_T RegionSize', ' WIN32_PROTECTION_MASK NewProtectWin32', ' PULONG OldProtect']
 case 215: {
+if (PPP_CHECK_CB(on_NtProtectVirtualMemory_enter) || PPP_CHECK_CB(on_NtProtectVirtualMemory_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3195,78 +3626,94 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtProtectVirtualMemory_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtProtectVirtualMemory_enter, rp.proc_id, pc, 215, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 216 NTSTATUS NtPulseEvent ['HANDLE EventHandle', ' PLONG PreviousState']
 case 216: {
+if (PPP_CHECK_CB(on_NtPulseEvent_enter) || PPP_CHECK_CB(on_NtPulseEvent_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtPulseEvent_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtPulseEvent_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtPulseEvent_enter, rp.proc_id, pc, 216, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 217 NTSTATUS NtQueryAttributesFile ['POBJECT_ATTRIBUTES ObjectAttributes', ' PFILE_BASIC_INFORMATION FileInformation']
 case 217: {
+if (PPP_CHECK_CB(on_NtQueryAttributesFile_enter) || PPP_CHECK_CB(on_NtQueryAttributesFile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtQueryAttributesFile_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryAttributesFile_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryAttributesFile_enter, rp.proc_id, pc, 217, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 218 NTSTATUS NtQueryBootEntryOrder ['PULONG Ids', ' PULONG Count']
 case 218: {
+if (PPP_CHECK_CB(on_NtQueryBootEntryOrder_enter) || PPP_CHECK_CB(on_NtQueryBootEntryOrder_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtQueryBootEntryOrder_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryBootEntryOrder_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryBootEntryOrder_enter, rp.proc_id, pc, 218, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 219 NTSTATUS NtQueryBootOptions ['PBOOT_OPTIONS BootOptions', ' PULONG BootOptionsLength']
 case 219: {
+if (PPP_CHECK_CB(on_NtQueryBootOptions_enter) || PPP_CHECK_CB(on_NtQueryBootOptions_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtQueryBootOptions_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryBootOptions_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryBootOptions_enter, rp.proc_id, pc, 219, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 220 NTSTATUS NtQueryDebugFilterState ['ULONG ComponentId', ' ULONG Level']
 case 220: {
+if (PPP_CHECK_CB(on_NtQueryDebugFilterState_enter) || PPP_CHECK_CB(on_NtQueryDebugFilterState_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtQueryDebugFilterState_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryDebugFilterState_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryDebugFilterState_enter, rp.proc_id, pc, 220, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 221 NTSTATUS NtQueryDefaultLocale ['BOOLEAN UserProfile', ' PLCID DefaultLocaleId']
 case 221: {
+if (PPP_CHECK_CB(on_NtQueryDefaultLocale_enter) || PPP_CHECK_CB(on_NtQueryDefaultLocale_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtQueryDefaultLocale_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryDefaultLocale_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryDefaultLocale_enter, rp.proc_id, pc, 221, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 222 NTSTATUS NtQueryDefaultUILanguage ['LANGID *DefaultUILanguageId']
 case 222: {
+if (PPP_CHECK_CB(on_NtQueryDefaultUILanguage_enter) || PPP_CHECK_CB(on_NtQueryDefaultUILanguage_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtQueryDefaultUILanguage_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryDefaultUILanguage_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryDefaultUILanguage_enter, rp.proc_id, pc, 222, env,pc,arg0) ; 
+}
 }; break;
 // 223 NTSTATUS NtQueryDirectoryFile ['HANDLE FileHandle', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID FileInformation', ' ULONG Length', ' FILE_INFORMATION_CLASS FileInformationClass', ' BOOLEAN ReturnSingleEntry', ' PUNICODE_STRING FileName', ' BOOLEAN RestartScan']
 case 223: {
+if (PPP_CHECK_CB(on_NtQueryDirectoryFile_enter) || PPP_CHECK_CB(on_NtQueryDirectoryFile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3291,10 +3738,12 @@ memcpy(rp.params[8], &arg8, sizeof(uint32_t));
 memcpy(rp.params[9], &arg9, sizeof(uint32_t));
 memcpy(rp.params[10], &arg10, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryDirectoryFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryDirectoryFile_enter, rp.proc_id, pc, 223, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10) ; 
+}
 }; break;
 // 224 NTSTATUS NtQueryDirectoryObject ['HANDLE DirectoryHandle', ' PVOID Buffer', ' ULONG Length', ' BOOLEAN ReturnSingleEntry', ' BOOLEAN RestartScan', ' PULONG Context', ' PULONG ReturnLength']
 case 224: {
+if (PPP_CHECK_CB(on_NtQueryDirectoryObject_enter) || PPP_CHECK_CB(on_NtQueryDirectoryObject_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3311,20 +3760,24 @@ memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 memcpy(rp.params[6], &arg6, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryDirectoryObject_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryDirectoryObject_enter, rp.proc_id, pc, 224, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
+}
 }; break;
 // 225 NTSTATUS NtQueryDriverEntryOrder ['PULONG Ids', ' PULONG Count']
 case 225: {
+if (PPP_CHECK_CB(on_NtQueryDriverEntryOrder_enter) || PPP_CHECK_CB(on_NtQueryDriverEntryOrder_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtQueryDriverEntryOrder_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryDriverEntryOrder_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryDriverEntryOrder_enter, rp.proc_id, pc, 225, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 226 NTSTATUS NtQueryEaFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID Buffer', ' ULONG Length', ' BOOLEAN ReturnSingleEntry', ' PVOID EaList', ' ULONG EaListLength', ' PULONG EaIndex', ' BOOLEAN RestartScan']
 case 226: {
+if (PPP_CHECK_CB(on_NtQueryEaFile_enter) || PPP_CHECK_CB(on_NtQueryEaFile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3345,10 +3798,12 @@ memcpy(rp.params[6], &arg6, sizeof(uint32_t));
 memcpy(rp.params[7], &arg7, sizeof(uint32_t));
 memcpy(rp.params[8], &arg8, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryEaFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryEaFile_enter, rp.proc_id, pc, 226, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+}
 }; break;
 // 227 NTSTATUS NtQueryEvent ['HANDLE EventHandle', ' EVENT_INFORMATION_CLASS EventInformationClass', ' PVOID EventInformation', ' ULONG EventInformationLength', ' PULONG ReturnLength']
 case 227: {
+if (PPP_CHECK_CB(on_NtQueryEvent_enter) || PPP_CHECK_CB(on_NtQueryEvent_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3361,20 +3816,24 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryEvent_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryEvent_enter, rp.proc_id, pc, 227, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 228 NTSTATUS NtQueryFullAttributesFile ['POBJECT_ATTRIBUTES ObjectAttributes', ' PFILE_NETWORK_OPEN_INFORMATION FileInformation']
 case 228: {
+if (PPP_CHECK_CB(on_NtQueryFullAttributesFile_enter) || PPP_CHECK_CB(on_NtQueryFullAttributesFile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtQueryFullAttributesFile_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryFullAttributesFile_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryFullAttributesFile_enter, rp.proc_id, pc, 228, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 229 NTSTATUS NtQueryInformationAtom ['RTL_ATOM Atom', ' ATOM_INFORMATION_CLASS InformationClass', ' PVOID AtomInformation', ' ULONG AtomInformationLength', ' PULONG ReturnLength']
 case 229: {
+if (PPP_CHECK_CB(on_NtQueryInformationAtom_enter) || PPP_CHECK_CB(on_NtQueryInformationAtom_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3387,10 +3846,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryInformationAtom_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryInformationAtom_enter, rp.proc_id, pc, 229, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 230 NTSTATUS NtQueryInformationEnlistment ['HANDLE EnlistmentHandle', ' ENLISTMENT_INFORMATION_CLASS EnlistmentInformationClass', ' PVOID EnlistmentInformation', ' ULONG EnlistmentInformationLength', ' PULONG ReturnLength']
 case 230: {
+if (PPP_CHECK_CB(on_NtQueryInformationEnlistment_enter) || PPP_CHECK_CB(on_NtQueryInformationEnlistment_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3403,10 +3864,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryInformationEnlistment_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryInformationEnlistment_enter, rp.proc_id, pc, 230, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 231 NTSTATUS NtQueryInformationFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID FileInformation', ' ULONG Length', ' FILE_INFORMATION_CLASS FileInformationClass']
 case 231: {
+if (PPP_CHECK_CB(on_NtQueryInformationFile_enter) || PPP_CHECK_CB(on_NtQueryInformationFile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3419,10 +3882,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryInformationFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryInformationFile_enter, rp.proc_id, pc, 231, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 232 NTSTATUS NtQueryInformationJobObject ['HANDLE JobHandle', ' JOBOBJECTINFOCLASS JobObjectInformationClass', ' PVOID JobObjectInformation', ' ULONG JobObjectInformationLength', ' PULONG ReturnLength']
 case 232: {
+if (PPP_CHECK_CB(on_NtQueryInformationJobObject_enter) || PPP_CHECK_CB(on_NtQueryInformationJobObject_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3435,10 +3900,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryInformationJobObject_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryInformationJobObject_enter, rp.proc_id, pc, 232, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 233 NTSTATUS NtQueryInformationPort ['HANDLE PortHandle', ' PORT_INFORMATION_CLASS PortInformationClass', ' PVOID PortInformation', ' ULONG Length', ' PULONG ReturnLength']
 case 233: {
+if (PPP_CHECK_CB(on_NtQueryInformationPort_enter) || PPP_CHECK_CB(on_NtQueryInformationPort_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3451,10 +3918,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryInformationPort_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryInformationPort_enter, rp.proc_id, pc, 233, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 234 NTSTATUS NtQueryInformationProcess ['HANDLE ProcessHandle', ' PROCESSINFOCLASS ProcessInformationClass', ' PVOID ProcessInformation', ' ULONG ProcessInformationLength', ' PULONG ReturnLength']
 case 234: {
+if (PPP_CHECK_CB(on_NtQueryInformationProcess_enter) || PPP_CHECK_CB(on_NtQueryInformationProcess_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3467,10 +3936,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryInformationProcess_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryInformationProcess_enter, rp.proc_id, pc, 234, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 235 NTSTATUS NtQueryInformationResourceManager ['HANDLE ResourceManagerHandle', ' RESOURCEMANAGER_INFORMATION_CLASS ResourceManagerInformationClass', ' PVOID ResourceManagerInformation', ' ULONG ResourceManagerInformationLength', ' PULONG ReturnLength']
 case 235: {
+if (PPP_CHECK_CB(on_NtQueryInformationResourceManager_enter) || PPP_CHECK_CB(on_NtQueryInformationResourceManager_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3483,10 +3954,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryInformationResourceManager_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryInformationResourceManager_enter, rp.proc_id, pc, 235, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 236 NTSTATUS NtQueryInformationThread ['HANDLE ThreadHandle', ' THREADINFOCLASS ThreadInformationClass', ' PVOID ThreadInformation', ' ULONG ThreadInformationLength', ' PULONG ReturnLength']
 case 236: {
+if (PPP_CHECK_CB(on_NtQueryInformationThread_enter) || PPP_CHECK_CB(on_NtQueryInformationThread_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3499,10 +3972,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryInformationThread_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryInformationThread_enter, rp.proc_id, pc, 236, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 237 NTSTATUS NtQueryInformationToken ['HANDLE TokenHandle', ' TOKEN_INFORMATION_CLASS TokenInformationClass', ' PVOID TokenInformation', ' ULONG TokenInformationLength', ' PULONG ReturnLength']
 case 237: {
+if (PPP_CHECK_CB(on_NtQueryInformationToken_enter) || PPP_CHECK_CB(on_NtQueryInformationToken_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3515,10 +3990,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryInformationToken_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryInformationToken_enter, rp.proc_id, pc, 237, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 238 NTSTATUS NtQueryInformationTransaction ['HANDLE TransactionHandle', ' TRANSACTION_INFORMATION_CLASS TransactionInformationClass', ' PVOID TransactionInformation', ' ULONG TransactionInformationLength', ' PULONG ReturnLength']
 case 238: {
+if (PPP_CHECK_CB(on_NtQueryInformationTransaction_enter) || PPP_CHECK_CB(on_NtQueryInformationTransaction_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3531,10 +4008,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryInformationTransaction_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryInformationTransaction_enter, rp.proc_id, pc, 238, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 239 NTSTATUS NtQueryInformationTransactionManager ['HANDLE TransactionManagerHandle', ' TRANSACTIONMANAGER_INFORMATION_CLASS TransactionManagerInformationClass', ' PVOID TransactionManagerInformation', ' ULONG TransactionManagerInformationLength', ' PULONG ReturnLength']
 case 239: {
+if (PPP_CHECK_CB(on_NtQueryInformationTransactionManager_enter) || PPP_CHECK_CB(on_NtQueryInformationTransactionManager_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3547,10 +4026,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryInformationTransactionManager_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryInformationTransactionManager_enter, rp.proc_id, pc, 239, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 240 NTSTATUS NtQueryInformationWorkerFactory ['HANDLE WorkerFactoryHandle', ' WORKERFACTORYINFOCLASS WorkerFactoryInformationClass', ' PVOID WorkerFactoryInformation', ' ULONG WorkerFactoryInformationLength', ' PULONG ReturnLength']
 case 240: {
+if (PPP_CHECK_CB(on_NtQueryInformationWorkerFactory_enter) || PPP_CHECK_CB(on_NtQueryInformationWorkerFactory_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3563,28 +4044,34 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryInformationWorkerFactory_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryInformationWorkerFactory_enter, rp.proc_id, pc, 240, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 241 NTSTATUS NtQueryInstallUILanguage ['LANGID *InstallUILanguageId']
 case 241: {
+if (PPP_CHECK_CB(on_NtQueryInstallUILanguage_enter) || PPP_CHECK_CB(on_NtQueryInstallUILanguage_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtQueryInstallUILanguage_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryInstallUILanguage_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryInstallUILanguage_enter, rp.proc_id, pc, 241, env,pc,arg0) ; 
+}
 }; break;
 // 242 NTSTATUS NtQueryIntervalProfile ['KPROFILE_SOURCE ProfileSource', ' PULONG Interval']
 case 242: {
+if (PPP_CHECK_CB(on_NtQueryIntervalProfile_enter) || PPP_CHECK_CB(on_NtQueryIntervalProfile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtQueryIntervalProfile_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryIntervalProfile_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryIntervalProfile_enter, rp.proc_id, pc, 242, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 243 NTSTATUS NtQueryIoCompletion ['HANDLE IoCompletionHandle', ' IO_COMPLETION_INFORMATION_CLASS IoCompletionInformationClass', ' PVOID IoCompletionInformation', ' ULONG IoCompletionInformationLength', ' PULONG ReturnLength']
 case 243: {
+if (PPP_CHECK_CB(on_NtQueryIoCompletion_enter) || PPP_CHECK_CB(on_NtQueryIoCompletion_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3597,10 +4084,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryIoCompletion_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryIoCompletion_enter, rp.proc_id, pc, 243, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 244 NTSTATUS NtQueryKey ['HANDLE KeyHandle', ' KEY_INFORMATION_CLASS KeyInformationClass', ' PVOID KeyInformation', ' ULONG Length', ' PULONG ResultLength']
 case 244: {
+if (PPP_CHECK_CB(on_NtQueryKey_enter) || PPP_CHECK_CB(on_NtQueryKey_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3613,10 +4102,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryKey_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryKey_enter, rp.proc_id, pc, 244, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 245 NTSTATUS NtQueryLicenseValue ['PUNICODE_STRING Name', ' PULONG Type', ' PVOID Buffer', ' ULONG Length', ' PULONG ReturnedLength']
 case 245: {
+if (PPP_CHECK_CB(on_NtQueryLicenseValue_enter) || PPP_CHECK_CB(on_NtQueryLicenseValue_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3629,10 +4120,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryLicenseValue_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryLicenseValue_enter, rp.proc_id, pc, 245, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 246 NTSTATUS NtQueryMultipleValueKey ['HANDLE KeyHandle', ' PKEY_VALUE_ENTRY ValueEntries', ' ULONG EntryCount', ' PVOID ValueBuffer', ' PULONG BufferLength', ' PULONG RequiredBufferLength']
 case 246: {
+if (PPP_CHECK_CB(on_NtQueryMultipleValueKey_enter) || PPP_CHECK_CB(on_NtQueryMultipleValueKey_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3647,10 +4140,12 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryMultipleValueKey_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryMultipleValueKey_enter, rp.proc_id, pc, 246, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 247 NTSTATUS NtQueryMutant ['HANDLE MutantHandle', ' MUTANT_INFORMATION_CLASS MutantInformationClass', ' PVOID MutantInformation', ' ULONG MutantInformationLength', ' PULONG ReturnLength']
 case 247: {
+if (PPP_CHECK_CB(on_NtQueryMutant_enter) || PPP_CHECK_CB(on_NtQueryMutant_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3663,10 +4158,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryMutant_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryMutant_enter, rp.proc_id, pc, 247, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 248 NTSTATUS NtQueryObject ['HANDLE Handle', ' OBJECT_INFORMATION_CLASS ObjectInformationClass', ' PVOID ObjectInformation', ' ULONG ObjectInformationLength', ' PULONG ReturnLength']
 case 248: {
+if (PPP_CHECK_CB(on_NtQueryObject_enter) || PPP_CHECK_CB(on_NtQueryObject_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3679,20 +4176,24 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryObject_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryObject_enter, rp.proc_id, pc, 248, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 249 NTSTATUS NtQueryOpenSubKeys ['POBJECT_ATTRIBUTES TargetKey', ' PULONG HandleCount']
 case 249: {
+if (PPP_CHECK_CB(on_NtQueryOpenSubKeys_enter) || PPP_CHECK_CB(on_NtQueryOpenSubKeys_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtQueryOpenSubKeys_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryOpenSubKeys_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryOpenSubKeys_enter, rp.proc_id, pc, 249, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 250 NTSTATUS NtQueryOpenSubKeysEx ['POBJECT_ATTRIBUTES TargetKey', ' ULONG BufferLength', ' PVOID Buffer', ' PULONG RequiredSize']
 case 250: {
+if (PPP_CHECK_CB(on_NtQueryOpenSubKeysEx_enter) || PPP_CHECK_CB(on_NtQueryOpenSubKeysEx_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3703,26 +4204,32 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryOpenSubKeysEx_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryOpenSubKeysEx_enter, rp.proc_id, pc, 250, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 251 NTSTATUS NtQueryPerformanceCounter ['PLARGE_INTEGER PerformanceCounter', ' PLARGE_INTEGER PerformanceFrequency']
 case 251: {
+if (PPP_CHECK_CB(on_NtQueryPerformanceCounter_enter) || PPP_CHECK_CB(on_NtQueryPerformanceCounter_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtQueryPerformanceCounter_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryPerformanceCounter_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryPerformanceCounter_enter, rp.proc_id, pc, 251, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 252 NTSTATUS NtQueryPortInformationProcess ['']
 case 252: {
+if (PPP_CHECK_CB(on_NtQueryPortInformationProcess_enter) || PPP_CHECK_CB(on_NtQueryPortInformationProcess_return)) {
 if (PPP_CHECK_CB(on_NtQueryPortInformationProcess_return)) {
 }
-PPP_RUN_CB(on_NtQueryPortInformationProcess_enter, env,pc) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryPortInformationProcess_enter, rp.proc_id, pc, 252, env,pc) ; 
+}
 }; break;
 // 253 NTSTATUS NtQueryQuotaInformationFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID Buffer', ' ULONG Length', ' BOOLEAN ReturnSingleEntry', ' PVOID SidList', ' ULONG SidListLength', ' PULONG StartSid', ' BOOLEAN RestartScan']
 case 253: {
+if (PPP_CHECK_CB(on_NtQueryQuotaInformationFile_enter) || PPP_CHECK_CB(on_NtQueryQuotaInformationFile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3743,10 +4250,12 @@ memcpy(rp.params[6], &arg6, sizeof(uint32_t));
 memcpy(rp.params[7], &arg7, sizeof(uint32_t));
 memcpy(rp.params[8], &arg8, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryQuotaInformationFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryQuotaInformationFile_enter, rp.proc_id, pc, 253, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+}
 }; break;
 // 254 NTSTATUS NtQuerySection ['HANDLE SectionHandle', ' SECTION_INFORMATION_CLASS SectionInformationClass', ' PVOID SectionInformation', ' SIZE_T SectionInformationLength', ' PSIZE_T ReturnLength']
 case 254: {
+if (PPP_CHECK_CB(on_NtQuerySection_enter) || PPP_CHECK_CB(on_NtQuerySection_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3759,10 +4268,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQuerySection_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtQuerySection_enter, rp.proc_id, pc, 254, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 255 NTSTATUS NtQuerySecurityAttributesToken ['HANDLE TokenHandle', ' PUNICODE_STRING Attributes', ' ULONG NumberOfAttributes', ' PVOID Buffer', ' ULONG Length', ' PULONG ReturnLength']
 case 255: {
+if (PPP_CHECK_CB(on_NtQuerySecurityAttributesToken_enter) || PPP_CHECK_CB(on_NtQuerySecurityAttributesToken_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3777,10 +4288,12 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQuerySecurityAttributesToken_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+PPP_RUN_CB_FILTERED(on_NtQuerySecurityAttributesToken_enter, rp.proc_id, pc, 255, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 256 NTSTATUS NtQuerySecurityObject ['HANDLE Handle', ' SECURITY_INFORMATION SecurityInformation', ' PSECURITY_DESCRIPTOR SecurityDescriptor', ' ULONG Length', ' PULONG LengthNeeded']
 case 256: {
+if (PPP_CHECK_CB(on_NtQuerySecurityObject_enter) || PPP_CHECK_CB(on_NtQuerySecurityObject_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3793,10 +4306,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQuerySecurityObject_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtQuerySecurityObject_enter, rp.proc_id, pc, 256, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 257 NTSTATUS NtQuerySemaphore ['HANDLE SemaphoreHandle', ' SEMAPHORE_INFORMATION_CLASS SemaphoreInformationClass', ' PVOID SemaphoreInformation', ' ULONG SemaphoreInformationLength', ' PULONG ReturnLength']
 case 257: {
+if (PPP_CHECK_CB(on_NtQuerySemaphore_enter) || PPP_CHECK_CB(on_NtQuerySemaphore_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3809,10 +4324,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQuerySemaphore_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtQuerySemaphore_enter, rp.proc_id, pc, 257, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 258 NTSTATUS NtQuerySymbolicLinkObject ['HANDLE LinkHandle', ' PUNICODE_STRING LinkTarget', ' PULONG ReturnedLength']
 case 258: {
+if (PPP_CHECK_CB(on_NtQuerySymbolicLinkObject_enter) || PPP_CHECK_CB(on_NtQuerySymbolicLinkObject_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3821,10 +4338,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQuerySymbolicLinkObject_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtQuerySymbolicLinkObject_enter, rp.proc_id, pc, 258, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 259 NTSTATUS NtQuerySystemEnvironmentValue ['PUNICODE_STRING VariableName', ' PWSTR VariableValue', ' USHORT ValueLength', ' PUSHORT ReturnLength']
 case 259: {
+if (PPP_CHECK_CB(on_NtQuerySystemEnvironmentValue_enter) || PPP_CHECK_CB(on_NtQuerySystemEnvironmentValue_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3835,10 +4354,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQuerySystemEnvironmentValue_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtQuerySystemEnvironmentValue_enter, rp.proc_id, pc, 259, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 260 NTSTATUS NtQuerySystemEnvironmentValueEx ['PUNICODE_STRING VariableName', ' LPGUID VendorGuid', ' PVOID Value', ' PULONG ValueLength', ' PULONG Attributes']
 case 260: {
+if (PPP_CHECK_CB(on_NtQuerySystemEnvironmentValueEx_enter) || PPP_CHECK_CB(on_NtQuerySystemEnvironmentValueEx_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3851,10 +4372,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQuerySystemEnvironmentValueEx_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtQuerySystemEnvironmentValueEx_enter, rp.proc_id, pc, 260, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 261 NTSTATUS NtQuerySystemInformation ['SYSTEM_INFORMATION_CLASS SystemInformationClass', ' PVOID SystemInformation', ' ULONG SystemInformationLength', ' PULONG ReturnLength']
 case 261: {
+if (PPP_CHECK_CB(on_NtQuerySystemInformation_enter) || PPP_CHECK_CB(on_NtQuerySystemInformation_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3865,10 +4388,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQuerySystemInformation_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtQuerySystemInformation_enter, rp.proc_id, pc, 261, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 262 NTSTATUS NtQuerySystemInformationEx ['SYSTEM_INFORMATION_CLASS SystemInformationClass', ' PVOID QueryInformation', ' ULONG QueryInformationLength', ' PVOID SystemInformation', ' ULONG SystemInformationLength', ' PULONG ReturnLength']
 case 262: {
+if (PPP_CHECK_CB(on_NtQuerySystemInformationEx_enter) || PPP_CHECK_CB(on_NtQuerySystemInformationEx_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3883,18 +4408,22 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQuerySystemInformationEx_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+PPP_RUN_CB_FILTERED(on_NtQuerySystemInformationEx_enter, rp.proc_id, pc, 262, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 263 NTSTATUS NtQuerySystemTime ['PLARGE_INTEGER SystemTime']
 case 263: {
+if (PPP_CHECK_CB(on_NtQuerySystemTime_enter) || PPP_CHECK_CB(on_NtQuerySystemTime_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtQuerySystemTime_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQuerySystemTime_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtQuerySystemTime_enter, rp.proc_id, pc, 263, env,pc,arg0) ; 
+}
 }; break;
 // 264 NTSTATUS NtQueryTimer ['HANDLE TimerHandle', ' TIMER_INFORMATION_CLASS TimerInformationClass', ' PVOID TimerInformation', ' ULONG TimerInformationLength', ' PULONG ReturnLength']
 case 264: {
+if (PPP_CHECK_CB(on_NtQueryTimer_enter) || PPP_CHECK_CB(on_NtQueryTimer_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3907,10 +4436,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryTimer_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryTimer_enter, rp.proc_id, pc, 264, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 265 NTSTATUS NtQueryTimerResolution ['PULONG MaximumTime', ' PULONG MinimumTime', ' PULONG CurrentTime']
 case 265: {
+if (PPP_CHECK_CB(on_NtQueryTimerResolution_enter) || PPP_CHECK_CB(on_NtQueryTimerResolution_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3919,10 +4450,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryTimerResolution_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryTimerResolution_enter, rp.proc_id, pc, 265, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 266 NTSTATUS NtQueryValueKey ['HANDLE KeyHandle', ' PUNICODE_STRING ValueName', ' KEY_VALUE_INFORMATION_CLASS KeyValueInformationClass', ' PVOID KeyValueInformation', ' ULONG Length', ' PULONG ResultLength']
 case 266: {
+if (PPP_CHECK_CB(on_NtQueryValueKey_enter) || PPP_CHECK_CB(on_NtQueryValueKey_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3937,10 +4470,12 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryValueKey_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryValueKey_enter, rp.proc_id, pc, 266, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 267 NTSTATUS NtQueryVirtualMemory ['HANDLE ProcessHandle', ' PVOID BaseAddress', ' MEMORY_INFORMATION_CLASS MemoryInformationClass', ' PVOID MemoryInformation', ' SIZE_T MemoryInformationLength', ' PSIZE_T ReturnLength']
 case 267: {
+if (PPP_CHECK_CB(on_NtQueryVirtualMemory_enter) || PPP_CHECK_CB(on_NtQueryVirtualMemory_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3955,10 +4490,12 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryVirtualMemory_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryVirtualMemory_enter, rp.proc_id, pc, 267, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 268 NTSTATUS NtQueryVolumeInformationFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID FsInformation', ' ULONG Length', ' FS_INFORMATION_CLASS FsInformationClass']
 case 268: {
+if (PPP_CHECK_CB(on_NtQueryVolumeInformationFile_enter) || PPP_CHECK_CB(on_NtQueryVolumeInformationFile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3971,10 +4508,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryVolumeInformationFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryVolumeInformationFile_enter, rp.proc_id, pc, 268, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 269 NTSTATUS NtQueueApcThread ['HANDLE ThreadHandle', ' PPS_APC_ROUTINE ApcRoutine', ' PVOID ApcArgument1', ' PVOID ApcArgument2', ' PVOID ApcArgument3']
 case 269: {
+if (PPP_CHECK_CB(on_NtQueueApcThread_enter) || PPP_CHECK_CB(on_NtQueueApcThread_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3987,10 +4526,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueueApcThread_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtQueueApcThread_enter, rp.proc_id, pc, 269, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 270 NTSTATUS NtQueueApcThreadEx ['HANDLE ThreadHandle', ' HANDLE UserApcReserveHandle', ' PPS_APC_ROUTINE ApcRoutine', ' PVOID ApcArgument1', ' PVOID ApcArgument2', ' PVOID ApcArgument3']
 case 270: {
+if (PPP_CHECK_CB(on_NtQueueApcThreadEx_enter) || PPP_CHECK_CB(on_NtQueueApcThreadEx_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -4005,10 +4546,12 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueueApcThreadEx_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+PPP_RUN_CB_FILTERED(on_NtQueueApcThreadEx_enter, rp.proc_id, pc, 270, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 271 NTSTATUS NtRaiseException ['PEXCEPTION_RECORD ExceptionRecord', ' PCONTEXT ContextRecord', ' BOOLEAN FirstChance']
 case 271: {
+if (PPP_CHECK_CB(on_NtRaiseException_enter) || PPP_CHECK_CB(on_NtRaiseException_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -4017,10 +4560,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtRaiseException_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtRaiseException_enter, rp.proc_id, pc, 271, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 272 NTSTATUS NtRaiseHardError ['NTSTATUS ErrorStatus', ' ULONG NumberOfParameters', ' ULONG UnicodeStringParameterMask', ' PULONG_PTR Parameters', ' ULONG ValidResponseOptions', ' PULONG Response']
 case 272: {
+if (PPP_CHECK_CB(on_NtRaiseHardError_enter) || PPP_CHECK_CB(on_NtRaiseHardError_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -4035,10 +4580,12 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtRaiseHardError_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+PPP_RUN_CB_FILTERED(on_NtRaiseHardError_enter, rp.proc_id, pc, 272, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 273 NTSTATUS NtReadFile ['HANDLE FileHandle', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID Buffer', ' ULONG Length', ' PLARGE_INTEGER ByteOffset', ' PULONG Key']
 case 273: {
+if (PPP_CHECK_CB(on_NtReadFile_enter) || PPP_CHECK_CB(on_NtReadFile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -4059,10 +4606,12 @@ memcpy(rp.params[6], &arg6, sizeof(uint32_t));
 memcpy(rp.params[7], &arg7, sizeof(uint32_t));
 memcpy(rp.params[8], &arg8, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtReadFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+PPP_RUN_CB_FILTERED(on_NtReadFile_enter, rp.proc_id, pc, 273, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+}
 }; break;
 // 274 NTSTATUS NtReadFileScatter ['HANDLE FileHandle', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' PFILE_SEGMENT_ELEMENT SegmentArray', ' ULONG Length', ' PLARGE_INTEGER ByteOffset', ' PULONG Key']
 case 274: {
+if (PPP_CHECK_CB(on_NtReadFileScatter_enter) || PPP_CHECK_CB(on_NtReadFileScatter_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -4083,20 +4632,24 @@ memcpy(rp.params[6], &arg6, sizeof(uint32_t));
 memcpy(rp.params[7], &arg7, sizeof(uint32_t));
 memcpy(rp.params[8], &arg8, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtReadFileScatter_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+PPP_RUN_CB_FILTERED(on_NtReadFileScatter_enter, rp.proc_id, pc, 274, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+}
 }; break;
 // 275 NTSTATUS NtReadOnlyEnlistment ['HANDLE EnlistmentHandle', ' PLARGE_INTEGER TmVirtualClock']
 case 275: {
+if (PPP_CHECK_CB(on_NtReadOnlyEnlistment_enter) || PPP_CHECK_CB(on_NtReadOnlyEnlistment_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtReadOnlyEnlistment_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtReadOnlyEnlistment_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtReadOnlyEnlistment_enter, rp.proc_id, pc, 275, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 276 NTSTATUS NtReadRequestData ['HANDLE PortHandle', ' PPORT_MESSAGE Message', ' ULONG DataEntryIndex', ' PVOID Buffer', ' SIZE_T BufferSize', ' PSIZE_T NumberOfBytesRead']
 case 276: {
+if (PPP_CHECK_CB(on_NtReadRequestData_enter) || PPP_CHECK_CB(on_NtReadRequestData_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -4111,10 +4664,12 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtReadRequestData_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+PPP_RUN_CB_FILTERED(on_NtReadRequestData_enter, rp.proc_id, pc, 276, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 277 NTSTATUS NtReadVirtualMemory ['HANDLE ProcessHandle', ' PVOID BaseAddress', ' PVOID Buffer', ' SIZE_T BufferSize', ' PSIZE_T NumberOfBytesRead']
 case 277: {
+if (PPP_CHECK_CB(on_NtReadVirtualMemory_enter) || PPP_CHECK_CB(on_NtReadVirtualMemory_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -4127,36 +4682,44 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtReadVirtualMemory_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtReadVirtualMemory_enter, rp.proc_id, pc, 277, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 278 NTSTATUS NtRecoverEnlistment ['HANDLE EnlistmentHandle', ' PVOID EnlistmentKey']
 case 278: {
+if (PPP_CHECK_CB(on_NtRecoverEnlistment_enter) || PPP_CHECK_CB(on_NtRecoverEnlistment_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtRecoverEnlistment_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtRecoverEnlistment_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtRecoverEnlistment_enter, rp.proc_id, pc, 278, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 279 NTSTATUS NtRecoverResourceManager ['HANDLE ResourceManagerHandle']
 case 279: {
+if (PPP_CHECK_CB(on_NtRecoverResourceManager_enter) || PPP_CHECK_CB(on_NtRecoverResourceManager_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtRecoverResourceManager_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtRecoverResourceManager_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtRecoverResourceManager_enter, rp.proc_id, pc, 279, env,pc,arg0) ; 
+}
 }; break;
 // 280 NTSTATUS NtRecoverTransactionManager ['HANDLE TransactionManagerHandle']
 case 280: {
+if (PPP_CHECK_CB(on_NtRecoverTransactionManager_enter) || PPP_CHECK_CB(on_NtRecoverTransactionManager_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtRecoverTransactionManager_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtRecoverTransactionManager_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtRecoverTransactionManager_enter, rp.proc_id, pc, 280, env,pc,arg0) ; 
+}
 }; break;
 // 281 NTSTATUS NtRegisterProtocolAddressInformation ['HANDLE ResourceManager', ' PCRM_PROTOCOL_ID ProtocolId', ' ULONG ProtocolInformationSize', ' PVOID ProtocolInformation', ' ULONG CreateOptions']
 case 281: {
+if (PPP_CHECK_CB(on_NtRegisterProtocolAddressInformation_enter) || PPP_CHECK_CB(on_NtRegisterProtocolAddressInformation_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -4169,18 +4732,22 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtRegisterProtocolAddressInformation_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtRegisterProtocolAddressInformation_enter, rp.proc_id, pc, 281, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 282 NTSTATUS NtRegisterThreadTerminatePort ['HANDLE PortHandle']
 case 282: {
+if (PPP_CHECK_CB(on_NtRegisterThreadTerminatePort_enter) || PPP_CHECK_CB(on_NtRegisterThreadTerminatePort_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtRegisterThreadTerminatePort_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtRegisterThreadTerminatePort_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtRegisterThreadTerminatePort_enter, rp.proc_id, pc, 282, env,pc,arg0) ; 
+}
 }; break;
 // 283 NTSTATUS NtReleaseKeyedEvent ['HANDLE KeyedEventHandle', ' PVOID KeyValue', ' BOOLEAN Alertable', ' PLARGE_INTEGER Timeout']
 case 283: {
+if (PPP_CHECK_CB(on_NtReleaseKeyedEvent_enter) || PPP_CHECK_CB(on_NtReleaseKeyedEvent_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -4191,20 +4758,24 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtReleaseKeyedEvent_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtReleaseKeyedEvent_enter, rp.proc_id, pc, 283, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 284 NTSTATUS NtReleaseMutant ['HANDLE MutantHandle', ' PLONG PreviousCount']
 case 284: {
+if (PPP_CHECK_CB(on_NtReleaseMutant_enter) || PPP_CHECK_CB(on_NtReleaseMutant_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtReleaseMutant_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtReleaseMutant_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtReleaseMutant_enter, rp.proc_id, pc, 284, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 285 NTSTATUS NtReleaseSemaphore ['HANDLE SemaphoreHandle', ' LONG ReleaseCount', ' PLONG PreviousCount']
 case 285: {
+if (PPP_CHECK_CB(on_NtReleaseSemaphore_enter) || PPP_CHECK_CB(on_NtReleaseSemaphore_return)) {
 uint32_t arg0 = get_32(env, 0);
 int32_t arg1 = get_s32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -4213,18 +4784,22 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(int32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtReleaseSemaphore_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtReleaseSemaphore_enter, rp.proc_id, pc, 285, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 286 NTSTATUS NtReleaseWorkerFactoryWorker ['HANDLE WorkerFactoryHandle']
 case 286: {
+if (PPP_CHECK_CB(on_NtReleaseWorkerFactoryWorker_enter) || PPP_CHECK_CB(on_NtReleaseWorkerFactoryWorker_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtReleaseWorkerFactoryWorker_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtReleaseWorkerFactoryWorker_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtReleaseWorkerFactoryWorker_enter, rp.proc_id, pc, 286, env,pc,arg0) ; 
+}
 }; break;
 // 287 NTSTATUS NtRemoveIoCompletion ['HANDLE IoCompletionHandle', ' PVOID *KeyContext', ' PVOID *ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' PLARGE_INTEGER Timeout']
 case 287: {
+if (PPP_CHECK_CB(on_NtRemoveIoCompletion_enter) || PPP_CHECK_CB(on_NtRemoveIoCompletion_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -4237,10 +4812,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtRemoveIoCompletion_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtRemoveIoCompletion_enter, rp.proc_id, pc, 287, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 288 NTSTATUS NtRemoveIoCompletionEx ['HANDLE IoCompletionHandle', ' PFILE_IO_COMPLETION_INFORMATION IoCompletionInformation', ' ULONG Count', ' PULONG NumEntriesRemoved', ' PLARGE_INTEGER Timeout', ' BOOLEAN Alertable']
 case 288: {
+if (PPP_CHECK_CB(on_NtRemoveIoCompletionEx_enter) || PPP_CHECK_CB(on_NtRemoveIoCompletionEx_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -4255,40 +4832,48 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtRemoveIoCompletionEx_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+PPP_RUN_CB_FILTERED(on_NtRemoveIoCompletionEx_enter, rp.proc_id, pc, 288, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 289 NTSTATUS NtRemoveProcessDebug ['HANDLE ProcessHandle', ' HANDLE DebugObjectHandle']
 case 289: {
+if (PPP_CHECK_CB(on_NtRemoveProcessDebug_enter) || PPP_CHECK_CB(on_NtRemoveProcessDebug_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtRemoveProcessDebug_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtRemoveProcessDebug_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtRemoveProcessDebug_enter, rp.proc_id, pc, 289, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 290 NTSTATUS NtRenameKey ['HANDLE KeyHandle', ' PUNICODE_STRING NewName']
 case 290: {
+if (PPP_CHECK_CB(on_NtRenameKey_enter) || PPP_CHECK_CB(on_NtRenameKey_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtRenameKey_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtRenameKey_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtRenameKey_enter, rp.proc_id, pc, 290, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 291 NTSTATUS NtRenameTransactionManager ['PUNICODE_STRING LogFileName', ' LPGUID ExistingTransactionManagerGuid']
 case 291: {
+if (PPP_CHECK_CB(on_NtRenameTransactionManager_enter) || PPP_CHECK_CB(on_NtRenameTransactionManager_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtRenameTransactionManager_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtRenameTransactionManager_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtRenameTransactionManager_enter, rp.proc_id, pc, 291, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 292 NTSTATUS NtReplaceKey ['POBJECT_ATTRIBUTES NewFile', ' HANDLE TargetHandle', ' POBJECT_ATTRIBUTES OldFile']
 case 292: {
+if (PPP_CHECK_CB(on_NtReplaceKey_enter) || PPP_CHECK_CB(on_NtReplaceKey_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -4297,10 +4882,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtReplaceKey_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtReplaceKey_enter, rp.proc_id, pc, 292, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 293 NTSTATUS NtReplacePartitionUnit ['PUNICODE_STRING TargetInstancePath', ' PUNICODE_STRING SpareInstancePath', ' ULONG Flags']
 case 293: {
+if (PPP_CHECK_CB(on_NtReplacePartitionUnit_enter) || PPP_CHECK_CB(on_NtReplacePartitionUnit_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -4309,20 +4896,24 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtReplacePartitionUnit_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtReplacePartitionUnit_enter, rp.proc_id, pc, 293, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 294 NTSTATUS NtReplyPort ['HANDLE PortHandle', ' PPORT_MESSAGE ReplyMessage']
 case 294: {
+if (PPP_CHECK_CB(on_NtReplyPort_enter) || PPP_CHECK_CB(on_NtReplyPort_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtReplyPort_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtReplyPort_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtReplyPort_enter, rp.proc_id, pc, 294, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 295 NTSTATUS NtReplyWaitReceivePort ['HANDLE PortHandle', ' PVOID *PortContext ', ' PPORT_MESSAGE ReplyMessage', ' PPORT_MESSAGE ReceiveMessage']
 case 295: {
+if (PPP_CHECK_CB(on_NtReplyWaitReceivePort_enter) || PPP_CHECK_CB(on_NtReplyWaitReceivePort_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -4333,10 +4924,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtReplyWaitReceivePort_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtReplyWaitReceivePort_enter, rp.proc_id, pc, 295, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 296 NTSTATUS NtReplyWaitReceivePortEx ['HANDLE PortHandle', ' PVOID *PortContext', ' PPORT_MESSAGE ReplyMessage', ' PPORT_MESSAGE ReceiveMessage', ' PLARGE_INTEGER Timeout']
 case 296: {
+if (PPP_CHECK_CB(on_NtReplyWaitReceivePortEx_enter) || PPP_CHECK_CB(on_NtReplyWaitReceivePortEx_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -4349,30 +4942,36 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtReplyWaitReceivePortEx_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtReplyWaitReceivePortEx_enter, rp.proc_id, pc, 296, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 297 NTSTATUS NtReplyWaitReplyPort ['HANDLE PortHandle', ' PPORT_MESSAGE ReplyMessage']
 case 297: {
+if (PPP_CHECK_CB(on_NtReplyWaitReplyPort_enter) || PPP_CHECK_CB(on_NtReplyWaitReplyPort_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtReplyWaitReplyPort_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtReplyWaitReplyPort_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtReplyWaitReplyPort_enter, rp.proc_id, pc, 297, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 298 NTSTATUS NtRequestPort ['HANDLE PortHandle', ' PPORT_MESSAGE RequestMessage']
 case 298: {
+if (PPP_CHECK_CB(on_NtRequestPort_enter) || PPP_CHECK_CB(on_NtRequestPort_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtRequestPort_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtRequestPort_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtRequestPort_enter, rp.proc_id, pc, 298, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 299 NTSTATUS NtRequestWaitReplyPort ['HANDLE PortHandle', ' PPORT_MESSAGE RequestMessage', ' PPORT_MESSAGE ReplyMessage']
 case 299: {
+if (PPP_CHECK_CB(on_NtRequestWaitReplyPort_enter) || PPP_CHECK_CB(on_NtRequestWaitReplyPort_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -4381,20 +4980,24 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtRequestWaitReplyPort_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtRequestWaitReplyPort_enter, rp.proc_id, pc, 299, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 300 NTSTATUS NtResetEvent ['HANDLE EventHandle', ' PLONG PreviousState']
 case 300: {
+if (PPP_CHECK_CB(on_NtResetEvent_enter) || PPP_CHECK_CB(on_NtResetEvent_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtResetEvent_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtResetEvent_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtResetEvent_enter, rp.proc_id, pc, 300, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 301 NTSTATUS NtResetWriteWatch ['HANDLE ProcessHandle', ' PVOID BaseAddress', ' SIZE_T RegionSize']
 case 301: {
+if (PPP_CHECK_CB(on_NtResetWriteWatch_enter) || PPP_CHECK_CB(on_NtResetWriteWatch_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -4403,10 +5006,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtResetWriteWatch_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtResetWriteWatch_enter, rp.proc_id, pc, 301, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 302 NTSTATUS NtRestoreKey ['HANDLE KeyHandle', ' HANDLE FileHandle', ' ULONG Flags']
 case 302: {
+if (PPP_CHECK_CB(on_NtRestoreKey_enter) || PPP_CHECK_CB(on_NtRestoreKey_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -4415,78 +5020,94 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtRestoreKey_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtRestoreKey_enter, rp.proc_id, pc, 302, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 303 NTSTATUS NtResumeProcess ['HANDLE ProcessHandle']
 case 303: {
+if (PPP_CHECK_CB(on_NtResumeProcess_enter) || PPP_CHECK_CB(on_NtResumeProcess_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtResumeProcess_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtResumeProcess_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtResumeProcess_enter, rp.proc_id, pc, 303, env,pc,arg0) ; 
+}
 }; break;
 // 304 NTSTATUS NtResumeThread ['HANDLE ThreadHandle', ' PULONG PreviousSuspendCount']
 case 304: {
+if (PPP_CHECK_CB(on_NtResumeThread_enter) || PPP_CHECK_CB(on_NtResumeThread_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtResumeThread_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtResumeThread_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtResumeThread_enter, rp.proc_id, pc, 304, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 305 NTSTATUS NtRollbackComplete ['HANDLE EnlistmentHandle', ' PLARGE_INTEGER TmVirtualClock']
 case 305: {
+if (PPP_CHECK_CB(on_NtRollbackComplete_enter) || PPP_CHECK_CB(on_NtRollbackComplete_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtRollbackComplete_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtRollbackComplete_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtRollbackComplete_enter, rp.proc_id, pc, 305, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 306 NTSTATUS NtRollbackEnlistment ['HANDLE EnlistmentHandle', ' PLARGE_INTEGER TmVirtualClock']
 case 306: {
+if (PPP_CHECK_CB(on_NtRollbackEnlistment_enter) || PPP_CHECK_CB(on_NtRollbackEnlistment_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtRollbackEnlistment_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtRollbackEnlistment_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtRollbackEnlistment_enter, rp.proc_id, pc, 306, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 307 NTSTATUS NtRollbackTransaction ['HANDLE TransactionHandle', ' BOOLEAN Wait']
 case 307: {
+if (PPP_CHECK_CB(on_NtRollbackTransaction_enter) || PPP_CHECK_CB(on_NtRollbackTransaction_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtRollbackTransaction_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtRollbackTransaction_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtRollbackTransaction_enter, rp.proc_id, pc, 307, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 308 NTSTATUS NtRollforwardTransactionManager ['HANDLE TransactionManagerHandle', ' PLARGE_INTEGER TmVirtualClock']
 case 308: {
+if (PPP_CHECK_CB(on_NtRollforwardTransactionManager_enter) || PPP_CHECK_CB(on_NtRollforwardTransactionManager_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtRollforwardTransactionManager_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtRollforwardTransactionManager_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtRollforwardTransactionManager_enter, rp.proc_id, pc, 308, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 309 NTSTATUS NtSaveKey ['HANDLE KeyHandle', ' HANDLE FileHandle']
 case 309: {
+if (PPP_CHECK_CB(on_NtSaveKey_enter) || PPP_CHECK_CB(on_NtSaveKey_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtSaveKey_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSaveKey_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtSaveKey_enter, rp.proc_id, pc, 309, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 310 NTSTATUS NtSaveKeyEx ['HANDLE KeyHandle', ' HANDLE FileHandle', ' ULONG Format']
 case 310: {
+if (PPP_CHECK_CB(on_NtSaveKeyEx_enter) || PPP_CHECK_CB(on_NtSaveKeyEx_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -4495,10 +5116,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSaveKeyEx_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtSaveKeyEx_enter, rp.proc_id, pc, 310, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 311 NTSTATUS NtSaveMergedKeys ['HANDLE HighPrecedenceKeyHandle', ' HANDLE LowPrecedenceKeyHandle', ' HANDLE FileHandle']
 case 311: {
+if (PPP_CHECK_CB(on_NtSaveMergedKeys_enter) || PPP_CHECK_CB(on_NtSaveMergedKeys_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -4507,10 +5130,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSaveMergedKeys_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtSaveMergedKeys_enter, rp.proc_id, pc, 311, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 312 NTSTATUS NtSecureConnectPort ['PHANDLE PortHandle', ' PUNICODE_STRING PortName', ' PSECURITY_QUALITY_OF_SERVICE SecurityQos', ' PPORT_VIEW ClientView', ' PSID RequiredServerSid', ' PREMOTE_PORT_VIEW ServerView', ' PULONG MaxMessageLength', ' PVOID ConnectionInformation', ' PULONG ConnectionInformationLength']
 case 312: {
+if (PPP_CHECK_CB(on_NtSecureConnectPort_enter) || PPP_CHECK_CB(on_NtSecureConnectPort_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -4531,46 +5156,56 @@ memcpy(rp.params[6], &arg6, sizeof(uint32_t));
 memcpy(rp.params[7], &arg7, sizeof(uint32_t));
 memcpy(rp.params[8], &arg8, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSecureConnectPort_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+PPP_RUN_CB_FILTERED(on_NtSecureConnectPort_enter, rp.proc_id, pc, 312, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+}
 }; break;
 // 313 NTSTATUS NtSerializeBoot ['']
 case 313: {
+if (PPP_CHECK_CB(on_NtSerializeBoot_enter) || PPP_CHECK_CB(on_NtSerializeBoot_return)) {
 if (PPP_CHECK_CB(on_NtSerializeBoot_return)) {
 }
-PPP_RUN_CB(on_NtSerializeBoot_enter, env,pc) ; 
+PPP_RUN_CB_FILTERED(on_NtSerializeBoot_enter, rp.proc_id, pc, 313, env,pc) ; 
+}
 }; break;
 // 314 NTSTATUS NtSetBootEntryOrder ['PULONG Ids', ' ULONG Count']
 case 314: {
+if (PPP_CHECK_CB(on_NtSetBootEntryOrder_enter) || PPP_CHECK_CB(on_NtSetBootEntryOrder_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtSetBootEntryOrder_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetBootEntryOrder_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtSetBootEntryOrder_enter, rp.proc_id, pc, 314, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 315 NTSTATUS NtSetBootOptions ['PBOOT_OPTIONS BootOptions', ' ULONG FieldsToChange']
 case 315: {
+if (PPP_CHECK_CB(on_NtSetBootOptions_enter) || PPP_CHECK_CB(on_NtSetBootOptions_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtSetBootOptions_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetBootOptions_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtSetBootOptions_enter, rp.proc_id, pc, 315, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 316 NTSTATUS NtSetContextThread ['HANDLE ThreadHandle', ' PCONTEXT ThreadContext']
 case 316: {
+if (PPP_CHECK_CB(on_NtSetContextThread_enter) || PPP_CHECK_CB(on_NtSetContextThread_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtSetContextThread_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetContextThread_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtSetContextThread_enter, rp.proc_id, pc, 316, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 317 NTSTATUS NtSetDebugFilterState ['ULONG ComponentId', ' ULONG Level', ' BOOLEAN State']
 case 317: {
+if (PPP_CHECK_CB(on_NtSetDebugFilterState_enter) || PPP_CHECK_CB(on_NtSetDebugFilterState_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -4579,46 +5214,56 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetDebugFilterState_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtSetDebugFilterState_enter, rp.proc_id, pc, 317, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 318 NTSTATUS NtSetDefaultHardErrorPort ['HANDLE DefaultHardErrorPort']
 case 318: {
+if (PPP_CHECK_CB(on_NtSetDefaultHardErrorPort_enter) || PPP_CHECK_CB(on_NtSetDefaultHardErrorPort_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtSetDefaultHardErrorPort_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetDefaultHardErrorPort_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtSetDefaultHardErrorPort_enter, rp.proc_id, pc, 318, env,pc,arg0) ; 
+}
 }; break;
 // 319 NTSTATUS NtSetDefaultLocale ['BOOLEAN UserProfile', ' LCID DefaultLocaleId']
 case 319: {
+if (PPP_CHECK_CB(on_NtSetDefaultLocale_enter) || PPP_CHECK_CB(on_NtSetDefaultLocale_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtSetDefaultLocale_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetDefaultLocale_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtSetDefaultLocale_enter, rp.proc_id, pc, 319, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 320 NTSTATUS NtSetDefaultUILanguage ['LANGID DefaultUILanguageId']
 case 320: {
+if (PPP_CHECK_CB(on_NtSetDefaultUILanguage_enter) || PPP_CHECK_CB(on_NtSetDefaultUILanguage_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtSetDefaultUILanguage_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetDefaultUILanguage_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtSetDefaultUILanguage_enter, rp.proc_id, pc, 320, env,pc,arg0) ; 
+}
 }; break;
 // 321 NTSTATUS NtSetDriverEntryOrder ['PULONG Ids', ' ULONG Count']
 case 321: {
+if (PPP_CHECK_CB(on_NtSetDriverEntryOrder_enter) || PPP_CHECK_CB(on_NtSetDriverEntryOrder_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtSetDriverEntryOrder_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetDriverEntryOrder_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtSetDriverEntryOrder_enter, rp.proc_id, pc, 321, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 322 NTSTATUS NtSetEaFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID Buffer', ' ULONG Length']
 case 322: {
+if (PPP_CHECK_CB(on_NtSetEaFile_enter) || PPP_CHECK_CB(on_NtSetEaFile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -4629,44 +5274,54 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetEaFile_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtSetEaFile_enter, rp.proc_id, pc, 322, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 323 NTSTATUS NtSetEvent ['HANDLE EventHandle', ' PLONG PreviousState']
 case 323: {
+if (PPP_CHECK_CB(on_NtSetEvent_enter) || PPP_CHECK_CB(on_NtSetEvent_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtSetEvent_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetEvent_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtSetEvent_enter, rp.proc_id, pc, 323, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 324 NTSTATUS NtSetEventBoostPriority ['HANDLE EventHandle']
 case 324: {
+if (PPP_CHECK_CB(on_NtSetEventBoostPriority_enter) || PPP_CHECK_CB(on_NtSetEventBoostPriority_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtSetEventBoostPriority_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetEventBoostPriority_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtSetEventBoostPriority_enter, rp.proc_id, pc, 324, env,pc,arg0) ; 
+}
 }; break;
 // 325 NTSTATUS NtSetHighEventPair ['HANDLE EventPairHandle']
 case 325: {
+if (PPP_CHECK_CB(on_NtSetHighEventPair_enter) || PPP_CHECK_CB(on_NtSetHighEventPair_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtSetHighEventPair_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetHighEventPair_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtSetHighEventPair_enter, rp.proc_id, pc, 325, env,pc,arg0) ; 
+}
 }; break;
 // 326 NTSTATUS NtSetHighWaitLowEventPair ['HANDLE EventPairHandle']
 case 326: {
+if (PPP_CHECK_CB(on_NtSetHighWaitLowEventPair_enter) || PPP_CHECK_CB(on_NtSetHighWaitLowEventPair_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtSetHighWaitLowEventPair_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetHighWaitLowEventPair_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtSetHighWaitLowEventPair_enter, rp.proc_id, pc, 326, env,pc,arg0) ; 
+}
 }; break;
 // 327 NTSTATUS NtSetInformationDebugObject ['HANDLE DebugObjectHandle', ' DEBUGOBJECTINFOCLASS DebugObjectInformationClass', ' PVOID DebugInformation', ' ULONG DebugInformationLength', ' PULONG ReturnLength']
 case 327: {
+if (PPP_CHECK_CB(on_NtSetInformationDebugObject_enter) || PPP_CHECK_CB(on_NtSetInformationDebugObject_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -4679,10 +5334,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetInformationDebugObject_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtSetInformationDebugObject_enter, rp.proc_id, pc, 327, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 328 NTSTATUS NtSetInformationEnlistment ['HANDLE EnlistmentHandle', ' ENLISTMENT_INFORMATION_CLASS EnlistmentInformationClass', ' PVOID EnlistmentInformation', ' ULONG EnlistmentInformationLength']
 case 328: {
+if (PPP_CHECK_CB(on_NtSetInformationEnlistment_enter) || PPP_CHECK_CB(on_NtSetInformationEnlistment_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -4693,10 +5350,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetInformationEnlistment_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtSetInformationEnlistment_enter, rp.proc_id, pc, 328, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 329 NTSTATUS NtSetInformationFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID FileInformation', ' ULONG Length', ' FILE_INFORMATION_CLASS FileInformationClass']
 case 329: {
+if (PPP_CHECK_CB(on_NtSetInformationFile_enter) || PPP_CHECK_CB(on_NtSetInformationFile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -4709,10 +5368,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetInformationFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtSetInformationFile_enter, rp.proc_id, pc, 329, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 330 NTSTATUS NtSetInformationJobObject ['HANDLE JobHandle', ' JOBOBJECTINFOCLASS JobObjectInformationClass', ' PVOID JobObjectInformation', ' ULONG JobObjectInformationLength']
 case 330: {
+if (PPP_CHECK_CB(on_NtSetInformationJobObject_enter) || PPP_CHECK_CB(on_NtSetInformationJobObject_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -4723,10 +5384,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetInformationJobObject_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtSetInformationJobObject_enter, rp.proc_id, pc, 330, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 331 NTSTATUS NtSetInformationKey ['HANDLE KeyHandle', ' KEY_SET_INFORMATION_CLASS KeySetInformationClass', ' PVOID KeySetInformation', ' ULONG KeySetInformationLength']
 case 331: {
+if (PPP_CHECK_CB(on_NtSetInformationKey_enter) || PPP_CHECK_CB(on_NtSetInformationKey_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -4737,10 +5400,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetInformationKey_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtSetInformationKey_enter, rp.proc_id, pc, 331, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 332 NTSTATUS NtSetInformationObject ['HANDLE Handle', ' OBJECT_INFORMATION_CLASS ObjectInformationClass', ' PVOID ObjectInformation', ' ULONG ObjectInformationLength']
 case 332: {
+if (PPP_CHECK_CB(on_NtSetInformationObject_enter) || PPP_CHECK_CB(on_NtSetInformationObject_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -4751,10 +5416,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetInformationObject_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtSetInformationObject_enter, rp.proc_id, pc, 332, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 333 NTSTATUS NtSetInformationProcess ['HANDLE ProcessHandle', ' PROCESSINFOCLASS ProcessInformationClass', ' PVOID ProcessInformation', ' ULONG ProcessInformationLength']
 case 333: {
+if (PPP_CHECK_CB(on_NtSetInformationProcess_enter) || PPP_CHECK_CB(on_NtSetInformationProcess_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -4765,10 +5432,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetInformationProcess_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtSetInformationProcess_enter, rp.proc_id, pc, 333, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 334 NTSTATUS NtSetInformationResourceManager ['HANDLE ResourceManagerHandle', ' RESOURCEMANAGER_INFORMATION_CLASS ResourceManagerInformationClass', ' PVOID ResourceManagerInformation', ' ULONG ResourceManagerInformationLength']
 case 334: {
+if (PPP_CHECK_CB(on_NtSetInformationResourceManager_enter) || PPP_CHECK_CB(on_NtSetInformationResourceManager_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -4779,10 +5448,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetInformationResourceManager_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtSetInformationResourceManager_enter, rp.proc_id, pc, 334, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 335 NTSTATUS NtSetInformationThread ['HANDLE ThreadHandle', ' THREADINFOCLASS ThreadInformationClass', ' PVOID ThreadInformation', ' ULONG ThreadInformationLength']
 case 335: {
+if (PPP_CHECK_CB(on_NtSetInformationThread_enter) || PPP_CHECK_CB(on_NtSetInformationThread_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -4793,10 +5464,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetInformationThread_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtSetInformationThread_enter, rp.proc_id, pc, 335, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 336 NTSTATUS NtSetInformationToken ['HANDLE TokenHandle', ' TOKEN_INFORMATION_CLASS TokenInformationClass', ' PVOID TokenInformation', ' ULONG TokenInformationLength']
 case 336: {
+if (PPP_CHECK_CB(on_NtSetInformationToken_enter) || PPP_CHECK_CB(on_NtSetInformationToken_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -4807,10 +5480,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetInformationToken_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtSetInformationToken_enter, rp.proc_id, pc, 336, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 337 NTSTATUS NtSetInformationTransaction ['HANDLE TransactionHandle', ' TRANSACTION_INFORMATION_CLASS TransactionInformationClass', ' PVOID TransactionInformation', ' ULONG TransactionInformationLength']
 case 337: {
+if (PPP_CHECK_CB(on_NtSetInformationTransaction_enter) || PPP_CHECK_CB(on_NtSetInformationTransaction_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -4821,10 +5496,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetInformationTransaction_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtSetInformationTransaction_enter, rp.proc_id, pc, 337, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 338 NTSTATUS NtSetInformationTransactionManager ['HANDLE TmHandle', ' TRANSACTIONMANAGER_INFORMATION_CLASS TransactionManagerInformationClass', ' PVOID TransactionManagerInformation', ' ULONG TransactionManagerInformationLength']
 case 338: {
+if (PPP_CHECK_CB(on_NtSetInformationTransactionManager_enter) || PPP_CHECK_CB(on_NtSetInformationTransactionManager_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -4835,10 +5512,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetInformationTransactionManager_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtSetInformationTransactionManager_enter, rp.proc_id, pc, 338, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 339 NTSTATUS NtSetInformationWorkerFactory ['HANDLE WorkerFactoryHandle', ' WORKERFACTORYINFOCLASS WorkerFactoryInformationClass', ' PVOID WorkerFactoryInformation', ' ULONG WorkerFactoryInformationLength']
 case 339: {
+if (PPP_CHECK_CB(on_NtSetInformationWorkerFactory_enter) || PPP_CHECK_CB(on_NtSetInformationWorkerFactory_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -4849,20 +5528,24 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetInformationWorkerFactory_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtSetInformationWorkerFactory_enter, rp.proc_id, pc, 339, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 340 NTSTATUS NtSetIntervalProfile ['ULONG Interval', ' KPROFILE_SOURCE Source']
 case 340: {
+if (PPP_CHECK_CB(on_NtSetIntervalProfile_enter) || PPP_CHECK_CB(on_NtSetIntervalProfile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtSetIntervalProfile_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetIntervalProfile_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtSetIntervalProfile_enter, rp.proc_id, pc, 340, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 341 NTSTATUS NtSetIoCompletion ['HANDLE IoCompletionHandle', ' PVOID KeyContext', ' PVOID ApcContext', ' NTSTATUS IoStatus', ' ULONG_PTR IoStatusInformation']
 case 341: {
+if (PPP_CHECK_CB(on_NtSetIoCompletion_enter) || PPP_CHECK_CB(on_NtSetIoCompletion_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -4875,10 +5558,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetIoCompletion_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtSetIoCompletion_enter, rp.proc_id, pc, 341, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 342 NTSTATUS NtSetIoCompletionEx ['HANDLE IoCompletionHandle', ' HANDLE IoCompletionReserveHandle', ' PVOID KeyContext', ' PVOID ApcContext', ' NTSTATUS IoStatus', ' ULONG_PTR IoStatusInformation']
 case 342: {
+if (PPP_CHECK_CB(on_NtSetIoCompletionEx_enter) || PPP_CHECK_CB(on_NtSetIoCompletionEx_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -4893,10 +5578,12 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetIoCompletionEx_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+PPP_RUN_CB_FILTERED(on_NtSetIoCompletionEx_enter, rp.proc_id, pc, 342, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 343 NTSTATUS NtSetLdtEntries ['ULONG Selector0', ' ULONG Entry0Low', ' ULONG Entry0Hi', ' ULONG Selector1', ' ULONG Entry1Low', ' ULONG Entry1Hi']
 case 343: {
+if (PPP_CHECK_CB(on_NtSetLdtEntries_enter) || PPP_CHECK_CB(on_NtSetLdtEntries_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -4911,26 +5598,32 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetLdtEntries_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+PPP_RUN_CB_FILTERED(on_NtSetLdtEntries_enter, rp.proc_id, pc, 343, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 344 NTSTATUS NtSetLowEventPair ['HANDLE EventPairHandle']
 case 344: {
+if (PPP_CHECK_CB(on_NtSetLowEventPair_enter) || PPP_CHECK_CB(on_NtSetLowEventPair_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtSetLowEventPair_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetLowEventPair_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtSetLowEventPair_enter, rp.proc_id, pc, 344, env,pc,arg0) ; 
+}
 }; break;
 // 345 NTSTATUS NtSetLowWaitHighEventPair ['HANDLE EventPairHandle']
 case 345: {
+if (PPP_CHECK_CB(on_NtSetLowWaitHighEventPair_enter) || PPP_CHECK_CB(on_NtSetLowWaitHighEventPair_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtSetLowWaitHighEventPair_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetLowWaitHighEventPair_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtSetLowWaitHighEventPair_enter, rp.proc_id, pc, 345, env,pc,arg0) ; 
+}
 }; break;
 // 346 NTSTATUS NtSetQuotaInformationFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID Buffer', ' ULONG Length']
 case 346: {
+if (PPP_CHECK_CB(on_NtSetQuotaInformationFile_enter) || PPP_CHECK_CB(on_NtSetQuotaInformationFile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -4941,10 +5634,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetQuotaInformationFile_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtSetQuotaInformationFile_enter, rp.proc_id, pc, 346, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 347 NTSTATUS NtSetSecurityObject ['HANDLE Handle', ' SECURITY_INFORMATION SecurityInformation', ' PSECURITY_DESCRIPTOR SecurityDescriptor']
 case 347: {
+if (PPP_CHECK_CB(on_NtSetSecurityObject_enter) || PPP_CHECK_CB(on_NtSetSecurityObject_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -4953,20 +5648,24 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetSecurityObject_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtSetSecurityObject_enter, rp.proc_id, pc, 347, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 348 NTSTATUS NtSetSystemEnvironmentValue ['PUNICODE_STRING VariableName', ' PUNICODE_STRING VariableValue']
 case 348: {
+if (PPP_CHECK_CB(on_NtSetSystemEnvironmentValue_enter) || PPP_CHECK_CB(on_NtSetSystemEnvironmentValue_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtSetSystemEnvironmentValue_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetSystemEnvironmentValue_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtSetSystemEnvironmentValue_enter, rp.proc_id, pc, 348, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 349 NTSTATUS NtSetSystemEnvironmentValueEx ['PUNICODE_STRING VariableName', ' LPGUID VendorGuid', ' PVOID Value', ' ULONG ValueLength', ' ULONG Attributes']
 case 349: {
+if (PPP_CHECK_CB(on_NtSetSystemEnvironmentValueEx_enter) || PPP_CHECK_CB(on_NtSetSystemEnvironmentValueEx_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -4979,10 +5678,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetSystemEnvironmentValueEx_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtSetSystemEnvironmentValueEx_enter, rp.proc_id, pc, 349, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 350 NTSTATUS NtSetSystemInformation ['SYSTEM_INFORMATION_CLASS SystemInformationClass', ' PVOID SystemInformation', ' ULONG SystemInformationLength']
 case 350: {
+if (PPP_CHECK_CB(on_NtSetSystemInformation_enter) || PPP_CHECK_CB(on_NtSetSystemInformation_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -4991,10 +5692,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetSystemInformation_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtSetSystemInformation_enter, rp.proc_id, pc, 350, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 351 NTSTATUS NtSetSystemPowerState ['POWER_ACTION SystemAction', ' SYSTEM_POWER_STATE MinSystemState', ' ULONG Flags']
 case 351: {
+if (PPP_CHECK_CB(on_NtSetSystemPowerState_enter) || PPP_CHECK_CB(on_NtSetSystemPowerState_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -5003,30 +5706,36 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetSystemPowerState_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtSetSystemPowerState_enter, rp.proc_id, pc, 351, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 352 NTSTATUS NtSetSystemTime ['PLARGE_INTEGER SystemTime', ' PLARGE_INTEGER PreviousTime']
 case 352: {
+if (PPP_CHECK_CB(on_NtSetSystemTime_enter) || PPP_CHECK_CB(on_NtSetSystemTime_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtSetSystemTime_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetSystemTime_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtSetSystemTime_enter, rp.proc_id, pc, 352, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 353 NTSTATUS NtSetThreadExecutionState ['EXECUTION_STATE esFlags', ' PEXECUTION_STATE PreviousFlags']
 case 353: {
+if (PPP_CHECK_CB(on_NtSetThreadExecutionState_enter) || PPP_CHECK_CB(on_NtSetThreadExecutionState_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtSetThreadExecutionState_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetThreadExecutionState_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtSetThreadExecutionState_enter, rp.proc_id, pc, 353, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 354 NTSTATUS NtSetTimer ['HANDLE TimerHandle', ' PLARGE_INTEGER DueTime', ' PTIMER_APC_ROUTINE TimerApcRoutine', ' PVOID TimerContext', ' BOOLEAN WakeTimer', ' LONG Period', ' PBOOLEAN PreviousState']
 case 354: {
+if (PPP_CHECK_CB(on_NtSetTimer_enter) || PPP_CHECK_CB(on_NtSetTimer_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -5043,10 +5752,12 @@ memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(int32_t));
 memcpy(rp.params[6], &arg6, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetTimer_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
+PPP_RUN_CB_FILTERED(on_NtSetTimer_enter, rp.proc_id, pc, 354, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
+}
 }; break;
 // 355 NTSTATUS NtSetTimerEx ['HANDLE TimerHandle', ' TIMER_SET_INFORMATION_CLASS TimerSetInformationClass', ' PVOID TimerSetInformation', ' ULONG TimerSetInformationLength']
 case 355: {
+if (PPP_CHECK_CB(on_NtSetTimerEx_enter) || PPP_CHECK_CB(on_NtSetTimerEx_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -5057,10 +5768,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetTimerEx_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtSetTimerEx_enter, rp.proc_id, pc, 355, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 356 NTSTATUS NtSetTimerResolution ['ULONG DesiredTime', ' BOOLEAN SetResolution', ' PULONG ActualTime']
 case 356: {
+if (PPP_CHECK_CB(on_NtSetTimerResolution_enter) || PPP_CHECK_CB(on_NtSetTimerResolution_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -5069,18 +5782,22 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetTimerResolution_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtSetTimerResolution_enter, rp.proc_id, pc, 356, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 357 NTSTATUS NtSetUuidSeed ['PCHAR Seed']
 case 357: {
+if (PPP_CHECK_CB(on_NtSetUuidSeed_enter) || PPP_CHECK_CB(on_NtSetUuidSeed_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtSetUuidSeed_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetUuidSeed_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtSetUuidSeed_enter, rp.proc_id, pc, 357, env,pc,arg0) ; 
+}
 }; break;
 // 358 NTSTATUS NtSetValueKey ['HANDLE KeyHandle', ' PUNICODE_STRING ValueName', ' ULONG TitleIndex', ' ULONG Type', ' PVOID Data', ' ULONG DataSize']
 case 358: {
+if (PPP_CHECK_CB(on_NtSetValueKey_enter) || PPP_CHECK_CB(on_NtSetValueKey_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -5095,10 +5812,12 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetValueKey_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+PPP_RUN_CB_FILTERED(on_NtSetValueKey_enter, rp.proc_id, pc, 358, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 359 NTSTATUS NtSetVolumeInformationFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID FsInformation', ' ULONG Length', ' FS_INFORMATION_CLASS FsInformationClass']
 case 359: {
+if (PPP_CHECK_CB(on_NtSetVolumeInformationFile_enter) || PPP_CHECK_CB(on_NtSetVolumeInformationFile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -5111,28 +5830,34 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetVolumeInformationFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtSetVolumeInformationFile_enter, rp.proc_id, pc, 359, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 360 NTSTATUS NtShutdownSystem ['SHUTDOWN_ACTION Action']
 case 360: {
+if (PPP_CHECK_CB(on_NtShutdownSystem_enter) || PPP_CHECK_CB(on_NtShutdownSystem_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtShutdownSystem_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtShutdownSystem_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtShutdownSystem_enter, rp.proc_id, pc, 360, env,pc,arg0) ; 
+}
 }; break;
 // 361 NTSTATUS NtShutdownWorkerFactory ['HANDLE WorkerFactoryHandle', ' LONG *PendingWorkerCount']
 case 361: {
+if (PPP_CHECK_CB(on_NtShutdownWorkerFactory_enter) || PPP_CHECK_CB(on_NtShutdownWorkerFactory_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtShutdownWorkerFactory_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtShutdownWorkerFactory_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtShutdownWorkerFactory_enter, rp.proc_id, pc, 361, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 362 NTSTATUS NtSignalAndWaitForSingleObject ['HANDLE SignalHandle', ' HANDLE WaitHandle', ' BOOLEAN Alertable', ' PLARGE_INTEGER Timeout']
 case 362: {
+if (PPP_CHECK_CB(on_NtSignalAndWaitForSingleObject_enter) || PPP_CHECK_CB(on_NtSignalAndWaitForSingleObject_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -5143,54 +5868,66 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSignalAndWaitForSingleObject_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtSignalAndWaitForSingleObject_enter, rp.proc_id, pc, 362, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 363 NTSTATUS NtSinglePhaseReject ['HANDLE EnlistmentHandle', ' PLARGE_INTEGER TmVirtualClock']
 case 363: {
+if (PPP_CHECK_CB(on_NtSinglePhaseReject_enter) || PPP_CHECK_CB(on_NtSinglePhaseReject_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtSinglePhaseReject_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSinglePhaseReject_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtSinglePhaseReject_enter, rp.proc_id, pc, 363, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 364 NTSTATUS NtStartProfile ['HANDLE ProfileHandle']
 case 364: {
+if (PPP_CHECK_CB(on_NtStartProfile_enter) || PPP_CHECK_CB(on_NtStartProfile_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtStartProfile_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtStartProfile_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtStartProfile_enter, rp.proc_id, pc, 364, env,pc,arg0) ; 
+}
 }; break;
 // 365 NTSTATUS NtStopProfile ['HANDLE ProfileHandle']
 case 365: {
+if (PPP_CHECK_CB(on_NtStopProfile_enter) || PPP_CHECK_CB(on_NtStopProfile_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtStopProfile_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtStopProfile_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtStopProfile_enter, rp.proc_id, pc, 365, env,pc,arg0) ; 
+}
 }; break;
 // 366 NTSTATUS NtSuspendProcess ['HANDLE ProcessHandle']
 case 366: {
+if (PPP_CHECK_CB(on_NtSuspendProcess_enter) || PPP_CHECK_CB(on_NtSuspendProcess_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtSuspendProcess_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSuspendProcess_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtSuspendProcess_enter, rp.proc_id, pc, 366, env,pc,arg0) ; 
+}
 }; break;
 // 367 NTSTATUS NtSuspendThread ['HANDLE ThreadHandle', ' PULONG PreviousSuspendCount']
 case 367: {
+if (PPP_CHECK_CB(on_NtSuspendThread_enter) || PPP_CHECK_CB(on_NtSuspendThread_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtSuspendThread_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSuspendThread_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtSuspendThread_enter, rp.proc_id, pc, 367, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 368 NTSTATUS NtSystemDebugControl ['SYSDBG_COMMAND Command', ' PVOID InputBuffer', ' ULONG InputBufferLength', ' PVOID OutputBuffer', ' ULONG OutputBufferLength', ' PULONG ReturnLength']
 case 368: {
+if (PPP_CHECK_CB(on_NtSystemDebugControl_enter) || PPP_CHECK_CB(on_NtSystemDebugControl_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -5205,58 +5942,72 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSystemDebugControl_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+PPP_RUN_CB_FILTERED(on_NtSystemDebugControl_enter, rp.proc_id, pc, 368, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 369 NTSTATUS NtTerminateJobObject ['HANDLE JobHandle', ' NTSTATUS ExitStatus']
 case 369: {
+if (PPP_CHECK_CB(on_NtTerminateJobObject_enter) || PPP_CHECK_CB(on_NtTerminateJobObject_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtTerminateJobObject_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtTerminateJobObject_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtTerminateJobObject_enter, rp.proc_id, pc, 369, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 370 NTSTATUS NtTerminateProcess ['HANDLE ProcessHandle', ' NTSTATUS ExitStatus']
 case 370: {
+if (PPP_CHECK_CB(on_NtTerminateProcess_enter) || PPP_CHECK_CB(on_NtTerminateProcess_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtTerminateProcess_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtTerminateProcess_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtTerminateProcess_enter, rp.proc_id, pc, 370, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 371 NTSTATUS NtTerminateThread ['HANDLE ThreadHandle', ' NTSTATUS ExitStatus']
 case 371: {
+if (PPP_CHECK_CB(on_NtTerminateThread_enter) || PPP_CHECK_CB(on_NtTerminateThread_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtTerminateThread_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtTerminateThread_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtTerminateThread_enter, rp.proc_id, pc, 371, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 372 NTSTATUS NtTestAlert ['']
 case 372: {
+if (PPP_CHECK_CB(on_NtTestAlert_enter) || PPP_CHECK_CB(on_NtTestAlert_return)) {
 if (PPP_CHECK_CB(on_NtTestAlert_return)) {
 }
-PPP_RUN_CB(on_NtTestAlert_enter, env,pc) ; 
+PPP_RUN_CB_FILTERED(on_NtTestAlert_enter, rp.proc_id, pc, 372, env,pc) ; 
+}
 }; break;
 // 373 NTSTATUS NtThawRegistry ['']
 case 373: {
+if (PPP_CHECK_CB(on_NtThawRegistry_enter) || PPP_CHECK_CB(on_NtThawRegistry_return)) {
 if (PPP_CHECK_CB(on_NtThawRegistry_return)) {
 }
-PPP_RUN_CB(on_NtThawRegistry_enter, env,pc) ; 
+PPP_RUN_CB_FILTERED(on_NtThawRegistry_enter, rp.proc_id, pc, 373, env,pc) ; 
+}
 }; break;
 // 374 NTSTATUS NtThawTransactions ['']
 case 374: {
+if (PPP_CHECK_CB(on_NtThawTransactions_enter) || PPP_CHECK_CB(on_NtThawTransactions_return)) {
 if (PPP_CHECK_CB(on_NtThawTransactions_return)) {
 }
-PPP_RUN_CB(on_NtThawTransactions_enter, env,pc) ; 
+PPP_RUN_CB_FILTERED(on_NtThawTransactions_enter, rp.proc_id, pc, 374, env,pc) ; 
+}
 }; break;
 // 375 NTSTATUS NtTraceControl ['ULONG FunctionCode', ' PVOID InBuffer', ' ULONG InBufferLen', ' PVOID OutBuffer', ' ULONG OutBufferLen', ' PULONG ReturnLength']
 case 375: {
+if (PPP_CHECK_CB(on_NtTraceControl_enter) || PPP_CHECK_CB(on_NtTraceControl_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -5271,10 +6022,12 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtTraceControl_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+PPP_RUN_CB_FILTERED(on_NtTraceControl_enter, rp.proc_id, pc, 375, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 376 NTSTATUS NtTraceEvent ['HANDLE TraceHandle', ' ULONG Flags', ' ULONG FieldSize', ' PVOID Fields']
 case 376: {
+if (PPP_CHECK_CB(on_NtTraceEvent_enter) || PPP_CHECK_CB(on_NtTraceEvent_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -5285,10 +6038,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtTraceEvent_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtTraceEvent_enter, rp.proc_id, pc, 376, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 377 NTSTATUS NtTranslateFilePath ['PFILE_PATH InputFilePath', ' ULONG OutputType', ' PFILE_PATH OutputFilePath', ' PULONG OutputFilePathLength']
 case 377: {
+if (PPP_CHECK_CB(on_NtTranslateFilePath_enter) || PPP_CHECK_CB(on_NtTranslateFilePath_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -5299,54 +6054,66 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtTranslateFilePath_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtTranslateFilePath_enter, rp.proc_id, pc, 377, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 378 NTSTATUS NtUmsThreadYield ['PVOID SchedulerParam']
 case 378: {
+if (PPP_CHECK_CB(on_NtUmsThreadYield_enter) || PPP_CHECK_CB(on_NtUmsThreadYield_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtUmsThreadYield_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtUmsThreadYield_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtUmsThreadYield_enter, rp.proc_id, pc, 378, env,pc,arg0) ; 
+}
 }; break;
 // 379 NTSTATUS NtUnloadDriver ['PUNICODE_STRING DriverServiceName']
 case 379: {
+if (PPP_CHECK_CB(on_NtUnloadDriver_enter) || PPP_CHECK_CB(on_NtUnloadDriver_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtUnloadDriver_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtUnloadDriver_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtUnloadDriver_enter, rp.proc_id, pc, 379, env,pc,arg0) ; 
+}
 }; break;
 // 380 NTSTATUS NtUnloadKey ['POBJECT_ATTRIBUTES TargetKey']
 case 380: {
+if (PPP_CHECK_CB(on_NtUnloadKey_enter) || PPP_CHECK_CB(on_NtUnloadKey_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtUnloadKey_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtUnloadKey_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtUnloadKey_enter, rp.proc_id, pc, 380, env,pc,arg0) ; 
+}
 }; break;
 // 381 NTSTATUS NtUnloadKey2 ['POBJECT_ATTRIBUTES TargetKey', ' ULONG Flags']
 case 381: {
+if (PPP_CHECK_CB(on_NtUnloadKey2_enter) || PPP_CHECK_CB(on_NtUnloadKey2_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtUnloadKey2_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtUnloadKey2_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtUnloadKey2_enter, rp.proc_id, pc, 381, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 382 NTSTATUS NtUnloadKeyEx ['POBJECT_ATTRIBUTES TargetKey', ' HANDLE Event']
 case 382: {
+if (PPP_CHECK_CB(on_NtUnloadKeyEx_enter) || PPP_CHECK_CB(on_NtUnloadKeyEx_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtUnloadKeyEx_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtUnloadKeyEx_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtUnloadKeyEx_enter, rp.proc_id, pc, 382, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 383 NTSTATUS NtUnlockFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock', ' PLARGE_INTEGER ByteOffset', ' PLARGE_INTEGER Length', ' ULONG Key']
 case 383: {
+if (PPP_CHECK_CB(on_NtUnlockFile_enter) || PPP_CHECK_CB(on_NtUnlockFile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -5359,10 +6126,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtUnlockFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtUnlockFile_enter, rp.proc_id, pc, 383, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 384 NTSTATUS NtUnlockVirtualMemory ['HANDLE ProcessHandle', ' PVOID *BaseAddress', ' PSIZE_T RegionSize', ' ULONG MapType']
 case 384: {
+if (PPP_CHECK_CB(on_NtUnlockVirtualMemory_enter) || PPP_CHECK_CB(on_NtUnlockVirtualMemory_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -5373,30 +6142,36 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtUnlockVirtualMemory_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtUnlockVirtualMemory_enter, rp.proc_id, pc, 384, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 385 NTSTATUS NtUnmapViewOfSection ['HANDLE ProcessHandle', ' PVOID BaseAddress']
 case 385: {
+if (PPP_CHECK_CB(on_NtUnmapViewOfSection_enter) || PPP_CHECK_CB(on_NtUnmapViewOfSection_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtUnmapViewOfSection_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtUnmapViewOfSection_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtUnmapViewOfSection_enter, rp.proc_id, pc, 385, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 386 NTSTATUS NtVdmControl ['VDMSERVICECLASS Service', ' PVOID ServiceData']
 case 386: {
+if (PPP_CHECK_CB(on_NtVdmControl_enter) || PPP_CHECK_CB(on_NtVdmControl_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtVdmControl_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtVdmControl_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtVdmControl_enter, rp.proc_id, pc, 386, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 387 NTSTATUS NtWaitForDebugEvent ['HANDLE DebugObjectHandle', ' BOOLEAN Alertable', ' PLARGE_INTEGER Timeout', ' PDBGUI_WAIT_STATE_CHANGE WaitStateChange']
 case 387: {
+if (PPP_CHECK_CB(on_NtWaitForDebugEvent_enter) || PPP_CHECK_CB(on_NtWaitForDebugEvent_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -5407,10 +6182,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtWaitForDebugEvent_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtWaitForDebugEvent_enter, rp.proc_id, pc, 387, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 388 NTSTATUS NtWaitForKeyedEvent ['HANDLE KeyedEventHandle', ' PVOID KeyValue', ' BOOLEAN Alertable', ' PLARGE_INTEGER Timeout']
 case 388: {
+if (PPP_CHECK_CB(on_NtWaitForKeyedEvent_enter) || PPP_CHECK_CB(on_NtWaitForKeyedEvent_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -5421,10 +6198,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtWaitForKeyedEvent_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtWaitForKeyedEvent_enter, rp.proc_id, pc, 388, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 389 NTSTATUS NtWaitForMultipleObjects ['ULONG Count', ' HANDLE Handles[]', ' WAIT_TYPE WaitType', ' BOOLEAN Alertable', ' PLARGE_INTEGER Timeout']
 case 389: {
+if (PPP_CHECK_CB(on_NtWaitForMultipleObjects_enter) || PPP_CHECK_CB(on_NtWaitForMultipleObjects_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -5437,10 +6216,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtWaitForMultipleObjects_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtWaitForMultipleObjects_enter, rp.proc_id, pc, 389, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 390 NTSTATUS NtWaitForMultipleObjects32 ['ULONG Count', ' LONG Handles[]', ' WAIT_TYPE WaitType', ' BOOLEAN Alertable', ' PLARGE_INTEGER Timeout']
 case 390: {
+if (PPP_CHECK_CB(on_NtWaitForMultipleObjects32_enter) || PPP_CHECK_CB(on_NtWaitForMultipleObjects32_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -5453,10 +6234,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtWaitForMultipleObjects32_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtWaitForMultipleObjects32_enter, rp.proc_id, pc, 390, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 391 NTSTATUS NtWaitForSingleObject ['HANDLE Handle', ' BOOLEAN Alertable', ' PLARGE_INTEGER Timeout']
 case 391: {
+if (PPP_CHECK_CB(on_NtWaitForSingleObject_enter) || PPP_CHECK_CB(on_NtWaitForSingleObject_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -5465,44 +6248,54 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtWaitForSingleObject_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtWaitForSingleObject_enter, rp.proc_id, pc, 391, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 392 NTSTATUS NtWaitForWorkViaWorkerFactory ['HANDLE WorkerFactoryHandle', ' PFILE_IO_COMPLETION_INFORMATION MiniPacket']
 case 392: {
+if (PPP_CHECK_CB(on_NtWaitForWorkViaWorkerFactory_enter) || PPP_CHECK_CB(on_NtWaitForWorkViaWorkerFactory_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtWaitForWorkViaWorkerFactory_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtWaitForWorkViaWorkerFactory_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtWaitForWorkViaWorkerFactory_enter, rp.proc_id, pc, 392, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 393 NTSTATUS NtWaitHighEventPair ['HANDLE EventPairHandle']
 case 393: {
+if (PPP_CHECK_CB(on_NtWaitHighEventPair_enter) || PPP_CHECK_CB(on_NtWaitHighEventPair_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtWaitHighEventPair_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtWaitHighEventPair_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtWaitHighEventPair_enter, rp.proc_id, pc, 393, env,pc,arg0) ; 
+}
 }; break;
 // 394 NTSTATUS NtWaitLowEventPair ['HANDLE EventPairHandle']
 case 394: {
+if (PPP_CHECK_CB(on_NtWaitLowEventPair_enter) || PPP_CHECK_CB(on_NtWaitLowEventPair_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtWaitLowEventPair_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtWaitLowEventPair_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtWaitLowEventPair_enter, rp.proc_id, pc, 394, env,pc,arg0) ; 
+}
 }; break;
 // 395 NTSTATUS NtWorkerFactoryWorkerReady ['HANDLE WorkerFactoryHandle']
 case 395: {
+if (PPP_CHECK_CB(on_NtWorkerFactoryWorkerReady_enter) || PPP_CHECK_CB(on_NtWorkerFactoryWorkerReady_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtWorkerFactoryWorkerReady_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtWorkerFactoryWorkerReady_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtWorkerFactoryWorkerReady_enter, rp.proc_id, pc, 395, env,pc,arg0) ; 
+}
 }; break;
 // 396 NTSTATUS NtWriteFile ['HANDLE FileHandle', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID Buffer', ' ULONG Length', ' PLARGE_INTEGER ByteOffset', ' PULONG Key']
 case 396: {
+if (PPP_CHECK_CB(on_NtWriteFile_enter) || PPP_CHECK_CB(on_NtWriteFile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -5523,10 +6316,12 @@ memcpy(rp.params[6], &arg6, sizeof(uint32_t));
 memcpy(rp.params[7], &arg7, sizeof(uint32_t));
 memcpy(rp.params[8], &arg8, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtWriteFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+PPP_RUN_CB_FILTERED(on_NtWriteFile_enter, rp.proc_id, pc, 396, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+}
 }; break;
 // 397 NTSTATUS NtWriteFileGather ['HANDLE FileHandle', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' PFILE_SEGMENT_ELEMENT SegmentArray', ' ULONG Length', ' PLARGE_INTEGER ByteOffset', ' PULONG Key']
 case 397: {
+if (PPP_CHECK_CB(on_NtWriteFileGather_enter) || PPP_CHECK_CB(on_NtWriteFileGather_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -5547,10 +6342,12 @@ memcpy(rp.params[6], &arg6, sizeof(uint32_t));
 memcpy(rp.params[7], &arg7, sizeof(uint32_t));
 memcpy(rp.params[8], &arg8, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtWriteFileGather_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+PPP_RUN_CB_FILTERED(on_NtWriteFileGather_enter, rp.proc_id, pc, 397, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+}
 }; break;
 // 398 NTSTATUS NtWriteRequestData ['HANDLE PortHandle', ' PPORT_MESSAGE Message', ' ULONG DataEntryIndex', ' PVOID Buffer', ' SIZE_T BufferSize', ' PSIZE_T NumberOfBytesWritten']
 case 398: {
+if (PPP_CHECK_CB(on_NtWriteRequestData_enter) || PPP_CHECK_CB(on_NtWriteRequestData_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -5565,10 +6362,12 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtWriteRequestData_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+PPP_RUN_CB_FILTERED(on_NtWriteRequestData_enter, rp.proc_id, pc, 398, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 399 NTSTATUS NtWriteVirtualMemory ['HANDLE ProcessHandle', ' PVOID BaseAddress', ' PVOID Buffer', ' SIZE_T BufferSize', ' PSIZE_T NumberOfBytesWritten']
 case 399: {
+if (PPP_CHECK_CB(on_NtWriteVirtualMemory_enter) || PPP_CHECK_CB(on_NtWriteVirtualMemory_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -5581,18 +6380,21 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtWriteVirtualMemory_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtWriteVirtualMemory_enter, rp.proc_id, pc, 399, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 400 NTSTATUS NtYieldExecution ['']
 case 400: {
+if (PPP_CHECK_CB(on_NtYieldExecution_enter) || PPP_CHECK_CB(on_NtYieldExecution_return)) {
 if (PPP_CHECK_CB(on_NtYieldExecution_return)) {
 }
-PPP_RUN_CB(on_NtYieldExecution_enter, env,pc) ; 
+PPP_RUN_CB_FILTERED(on_NtYieldExecution_enter, rp.proc_id, pc, 400, env,pc) ; 
+}
 }; break;
 default:
-PPP_RUN_CB(on_unknown_sys_enter, env, pc, EAX);
+PPP_RUN_CB_FILTERED(on_unknown_sys_enter, rp.proc_id, pc, rp.ordinal, env, pc, rp.ordinal);
 }
-PPP_RUN_CB(on_all_sys_enter, env, pc, EAX);
+PPP_RUN_CB_FILTERED(on_all_sys_enter, rp.proc_id, pc, rp.ordinal, env, pc, rp.ordinal);
 appendReturnPoint(rp);
 #endif
  } 
@@ -16,13 +16,14 @@ extern "C" {
 
 void syscall_enter_switch_windowsxp_sp3_x86 ( CPUState *env, target_ulong pc ) {  // osarch
 #ifdef TARGET_I386                                          // GUARD
-    ReturnPoint rp;
+    ReturnPoint rp = {};                    // params stay zero unless captured below
     rp.ordinal = EAX;                        // CALLNO
     rp.proc_id = panda_current_asid(env);
     rp.retaddr = calc_retaddr(env, pc);
     switch( EAX ) {                          // CALLNO
 // 0 NTSTATUS NtAcceptConnectPort ['PHANDLE PortHandle', ' PVOID PortContext', ' PPORT_MESSAGE ConnectionRequest', ' BOOLEAN AcceptConnection', ' PPORT_VIEW ServerView', ' PREMOTE_PORT_VIEW ClientView']
 case 0: {
+if (PPP_CHECK_CB(on_NtAcceptConnectPort_enter) || PPP_CHECK_CB(on_NtAcceptConnectPort_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -37,10 +38,12 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAcceptConnectPort_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+PPP_RUN_CB_FILTERED(on_NtAcceptConnectPort_enter, rp.proc_id, pc, 0, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 1 NTSTATUS NtAccessCheck ['PSECURITY_DESCRIPTOR SecurityDescriptor', ' HANDLE ClientToken', ' ACCESS_MASK DesiredAccess', ' PGENERIC_MAPPING GenericMapping', ' PPRIVILEGE_SET PrivilegeSet', ' PULONG PrivilegeSetLength', ' PACCESS_MASK GrantedAccess', ' PNTSTATUS AccessStatus']
 case 1: {
+if (PPP_CHECK_CB(on_NtAccessCheck_enter) || PPP_CHECK_CB(on_NtAccessCheck_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -59,10 +62,12 @@ memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 memcpy(rp.params[6], &arg6, sizeof(uint32_t));
 memcpy(rp.params[7], &arg7, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAccessCheck_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
+PPP_RUN_CB_FILTERED(on_NtAccessCheck_enter, rp.proc_id, pc, 1, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
+}
 }; break;
 // 2 NTSTATUS NtAccessCheckAndAuditAlarm ['PUNICODE_STRING SubsystemName', ' PVOID HandleId', ' PUNICODE_STRING ObjectTypeName', ' PUNICODE_STRING ObjectName', ' PSECURITY_DESCRIPTOR SecurityDescriptor', ' ACCESS_MASK DesiredAccess', ' PGENERIC_MAPPING GenericMapping', ' BOOLEAN ObjectCreation', ' PACCESS_MASK GrantedAccess', ' PNTSTATUS AccessStatus', ' PBOOLEAN GenerateOnClose']
 case 2: {
+if (PPP_CHECK_CB(on_NtAccessCheckAndAuditAlarm_enter) || PPP_CHECK_CB(on_NtAccessCheckAndAuditAlarm_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -87,10 +92,12 @@ memcpy(rp.params[8], &arg8, sizeof(uint32_t));
 memcpy(rp.params[9], &arg9, sizeof(uint32_t));
 memcpy(rp.params[10], &arg10, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAccessCheckAndAuditAlarm_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10) ; 
+PPP_RUN_CB_FILTERED(on_NtAccessCheckAndAuditAlarm_enter, rp.proc_id, pc, 2, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10) ; 
+}
 }; break;
 // 3 NTSTATUS NtAccessCheckByType ['PSECURITY_DESCRIPTOR SecurityDescriptor', ' PSID PrincipalSelfSid', ' HANDLE ClientToken', ' ACCESS_MASK DesiredAccess', ' POBJECT_TYPE_LIST ObjectTypeList', ' ULONG ObjectTypeListLength', ' PGENERIC_MAPPING GenericMapping', ' PPRIVILEGE_SET PrivilegeSet', ' PULONG PrivilegeSetLength', ' PACCESS_MASK GrantedAccess', ' PNTSTATUS AccessStatus']
 case 3: {
+if (PPP_CHECK_CB(on_NtAccessCheckByType_enter) || PPP_CHECK_CB(on_NtAccessCheckByType_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -115,10 +122,12 @@ memcpy(rp.params[8], &arg8, sizeof(uint32_t));
 memcpy(rp.params[9], &arg9, sizeof(uint32_t));
 memcpy(rp.params[10], &arg10, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAccessCheckByType_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10) ; 
+PPP_RUN_CB_FILTERED(on_NtAccessCheckByType_enter, rp.proc_id, pc, 3, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10) ; 
+}
 }; break;
 // 4 NTSTATUS NtAccessCheckByTypeAndAuditAlarm ['PUNICODE_STRING SubsystemName', ' PVOID HandleId', ' PUNICODE_STRING ObjectTypeName', ' PUNICODE_STRING ObjectName', ' PSECURITY_DESCRIPTOR SecurityDescriptor', ' PSID PrincipalSelfSid', ' ACCESS_MASK DesiredAccess', ' AUDIT_EVENT_TYPE AuditType', ' ULONG Flags', ' POBJECT_TYPE_LIST ObjectTypeList', ' ULONG ObjectTypeListLength', ' PGENERIC_MAPPING GenericMapping', ' BOOLEAN ObjectCreation', ' PACCESS_MASK GrantedAccess', ' PNTSTATUS AccessStatus', ' PBOOLEAN GenerateOnClose']
 case 4: {
+if (PPP_CHECK_CB(on_NtAccessCheckByTypeAndAuditAlarm_enter) || PPP_CHECK_CB(on_NtAccessCheckByTypeAndAuditAlarm_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -153,10 +162,12 @@ memcpy(rp.params[13], &arg13, sizeof(uint32_t));
 memcpy(rp.params[14], &arg14, sizeof(uint32_t));
 memcpy(rp.params[15], &arg15, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAccessCheckByTypeAndAuditAlarm_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11,arg12,arg13,arg14,arg15) ; 
+PPP_RUN_CB_FILTERED(on_NtAccessCheckByTypeAndAuditAlarm_enter, rp.proc_id, pc, 4, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11,arg12,arg13,arg14,arg15) ; 
+}
 }; break;
 // 5 NTSTATUS NtAccessCheckByTypeResultList ['PSECURITY_DESCRIPTOR SecurityDescriptor', ' PSID PrincipalSelfSid', ' HANDLE ClientToken', ' ACCESS_MASK DesiredAccess', ' POBJECT_TYPE_LIST ObjectTypeList', ' ULONG ObjectTypeListLength', ' PGENERIC_MAPPING GenericMapping', ' PPRIVILEGE_SET PrivilegeSet', ' PULONG PrivilegeSetLength', ' PACCESS_MASK GrantedAccess', ' PNTSTATUS AccessStatus']
 case 5: {
+if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultList_enter) || PPP_CHECK_CB(on_NtAccessCheckByTypeResultList_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -181,10 +192,12 @@ memcpy(rp.params[8], &arg8, sizeof(uint32_t));
 memcpy(rp.params[9], &arg9, sizeof(uint32_t));
 memcpy(rp.params[10], &arg10, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAccessCheckByTypeResultList_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10) ; 
+PPP_RUN_CB_FILTERED(on_NtAccessCheckByTypeResultList_enter, rp.proc_id, pc, 5, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10) ; 
+}
 }; break;
 // 6 NTSTATUS NtAccessCheckByTypeResultListAndAuditAlarm ['PUNICODE_STRING SubsystemName', ' PVOID HandleId', ' PUNICODE_STRING ObjectTypeName', ' PUNICODE_STRING ObjectName', ' PSECURITY_DESCRIPTOR SecurityDescriptor', ' PSID PrincipalSelfSid', ' ACCESS_MASK DesiredAccess', ' AUDIT_EVENT_TYPE AuditType', ' ULONG Flags', ' POBJECT_TYPE_LIST ObjectTypeList', ' ULONG ObjectTypeListLength', ' PGENERIC_MAPPING GenericMapping', ' BOOLEAN ObjectCreation', ' PACCESS_MASK GrantedAccess', ' PNTSTATUS AccessStatus', ' PBOOLEAN GenerateOnClose']
 case 6: {
+if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarm_enter) || PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarm_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -219,10 +232,12 @@ memcpy(rp.params[13], &arg13, sizeof(uint32_t));
 memcpy(rp.params[14], &arg14, sizeof(uint32_t));
 memcpy(rp.params[15], &arg15, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAccessCheckByTypeResultListAndAuditAlarm_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11,arg12,arg13,arg14,arg15) ; 
+PPP_RUN_CB_FILTERED(on_NtAccessCheckByTypeResultListAndAuditAlarm_enter, rp.proc_id, pc, 6, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11,arg12,arg13,arg14,arg15) ; 
+}
 }; break;
 // 7 NTSTATUS NtAccessCheckByTypeResultListAndAuditAlarmByHandle ['PUNICODE_STRING SubsystemName', ' PVOID HandleId', ' HANDLE ClientToken', ' PUNICODE_STRING ObjectTypeName', ' PUNICODE_STRING ObjectName', ' PSECURITY_DESCRIPTOR SecurityDescriptor', ' PSID PrincipalSelfSid', ' ACCESS_MASK DesiredAccess', ' AUDIT_EVENT_TYPE AuditType', ' ULONG Flags', ' POBJECT_TYPE_LIST ObjectTypeList', ' ULONG ObjectTypeListLength', ' PGENERIC_MAPPING GenericMapping', ' BOOLEAN ObjectCreation', ' PACCESS_MASK GrantedAccess', ' PNTSTATUS AccessStatus', ' PBOOLEAN GenerateOnClose']
 case 7: {
+if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_enter) || PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -259,10 +274,12 @@ memcpy(rp.params[14], &arg14, sizeof(uint32_t));
 memcpy(rp.params[15], &arg15, sizeof(uint32_t));
 memcpy(rp.params[16], &arg16, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11,arg12,arg13,arg14,arg15,arg16) ; 
+PPP_RUN_CB_FILTERED(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_enter, rp.proc_id, pc, 7, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11,arg12,arg13,arg14,arg15,arg16) ; 
+}
 }; break;
 // 8 NTSTATUS NtAddAtom ['PWSTR AtomName', ' ULONG Length', ' PRTL_ATOM Atom']
 case 8: {
+if (PPP_CHECK_CB(on_NtAddAtom_enter) || PPP_CHECK_CB(on_NtAddAtom_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -271,20 +288,24 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAddAtom_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtAddAtom_enter, rp.proc_id, pc, 8, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 9 NTSTATUS NtEnumerateBootEntries ['PVOID Buffer', ' PULONG BufferLength']
 case 9: {
+if (PPP_CHECK_CB(on_NtEnumerateBootEntries_enter) || PPP_CHECK_CB(on_NtEnumerateBootEntries_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtEnumerateBootEntries_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtEnumerateBootEntries_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtEnumerateBootEntries_enter, rp.proc_id, pc, 9, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 10 NTSTATUS NtAdjustGroupsToken ['HANDLE TokenHandle', ' BOOLEAN ResetToDefault', ' PTOKEN_GROUPS NewState', ' ULONG BufferLength', ' PTOKEN_GROUPS PreviousState', ' PULONG ReturnLength']
 case 10: {
+if (PPP_CHECK_CB(on_NtAdjustGroupsToken_enter) || PPP_CHECK_CB(on_NtAdjustGroupsToken_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -299,10 +320,12 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAdjustGroupsToken_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+PPP_RUN_CB_FILTERED(on_NtAdjustGroupsToken_enter, rp.proc_id, pc, 10, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 11 NTSTATUS NtAdjustPrivilegesToken ['HANDLE TokenHandle', ' BOOLEAN DisableAllPrivileges', ' PTOKEN_PRIVILEGES NewState', ' ULONG BufferLength', ' PTOKEN_PRIVILEGES PreviousState', ' PULONG ReturnLength']
 case 11: {
+if (PPP_CHECK_CB(on_NtAdjustPrivilegesToken_enter) || PPP_CHECK_CB(on_NtAdjustPrivilegesToken_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -317,36 +340,44 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAdjustPrivilegesToken_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+PPP_RUN_CB_FILTERED(on_NtAdjustPrivilegesToken_enter, rp.proc_id, pc, 11, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 12 NTSTATUS NtAlertResumeThread ['HANDLE ThreadHandle', ' PULONG PreviousSuspendCount']
 case 12: {
+if (PPP_CHECK_CB(on_NtAlertResumeThread_enter) || PPP_CHECK_CB(on_NtAlertResumeThread_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtAlertResumeThread_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAlertResumeThread_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtAlertResumeThread_enter, rp.proc_id, pc, 12, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 13 NTSTATUS NtAlertThread ['HANDLE ThreadHandle']
 case 13: {
+if (PPP_CHECK_CB(on_NtAlertThread_enter) || PPP_CHECK_CB(on_NtAlertThread_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtAlertThread_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAlertThread_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtAlertThread_enter, rp.proc_id, pc, 13, env,pc,arg0) ; 
+}
 }; break;
 // 14 NTSTATUS NtAllocateLocallyUniqueId ['PLUID Luid']
 case 14: {
+if (PPP_CHECK_CB(on_NtAllocateLocallyUniqueId_enter) || PPP_CHECK_CB(on_NtAllocateLocallyUniqueId_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtAllocateLocallyUniqueId_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAllocateLocallyUniqueId_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtAllocateLocallyUniqueId_enter, rp.proc_id, pc, 14, env,pc,arg0) ; 
+}
 }; break;
 // 15 NTSTATUS NtAllocateUserPhysicalPages ['HANDLE ProcessHandle', ' PULONG_PTR NumberOfPages', ' PULONG_PTR UserPfnArray']
 case 15: {
+if (PPP_CHECK_CB(on_NtAllocateUserPhysicalPages_enter) || PPP_CHECK_CB(on_NtAllocateUserPhysicalPages_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -355,10 +386,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAllocateUserPhysicalPages_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtAllocateUserPhysicalPages_enter, rp.proc_id, pc, 15, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 16 NTSTATUS NtAllocateUuids ['PULARGE_INTEGER Time', ' PULONG Range', ' PULONG Sequence', ' PCHAR Seed']
 case 16: {
+if (PPP_CHECK_CB(on_NtAllocateUuids_enter) || PPP_CHECK_CB(on_NtAllocateUuids_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -369,10 +402,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAllocateUuids_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtAllocateUuids_enter, rp.proc_id, pc, 16, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 17 NTSTATUS NtAllocateVirtualMemory ['HANDLE ProcessHandle', ' PVOID *BaseAddress', ' ULONG_PTR ZeroBits', ' PSIZE_T RegionSize', ' ULONG AllocationType', ' ULONG Protect']
 case 17: {
+if (PPP_CHECK_CB(on_NtAllocateVirtualMemory_enter) || PPP_CHECK_CB(on_NtAllocateVirtualMemory_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -387,30 +422,36 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAllocateVirtualMemory_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+PPP_RUN_CB_FILTERED(on_NtAllocateVirtualMemory_enter, rp.proc_id, pc, 17, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 18 NTSTATUS NtAreMappedFilesTheSame ['PVOID File1MappedAsAnImage', ' PVOID File2MappedAsFile']
 case 18: {
+if (PPP_CHECK_CB(on_NtAreMappedFilesTheSame_enter) || PPP_CHECK_CB(on_NtAreMappedFilesTheSame_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtAreMappedFilesTheSame_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAreMappedFilesTheSame_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtAreMappedFilesTheSame_enter, rp.proc_id, pc, 18, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 19 NTSTATUS NtAssignProcessToJobObject ['HANDLE JobHandle', ' HANDLE ProcessHandle']
 case 19: {
+if (PPP_CHECK_CB(on_NtAssignProcessToJobObject_enter) || PPP_CHECK_CB(on_NtAssignProcessToJobObject_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtAssignProcessToJobObject_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtAssignProcessToJobObject_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtAssignProcessToJobObject_enter, rp.proc_id, pc, 19, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 20 NTSTATUS NtCallbackReturn ['PVOID OutputBuffer', ' ULONG OutputLength', ' NTSTATUS Status']
 case 20: {
+if (PPP_CHECK_CB(on_NtCallbackReturn_enter) || PPP_CHECK_CB(on_NtCallbackReturn_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -419,54 +460,66 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCallbackReturn_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtCallbackReturn_enter, rp.proc_id, pc, 20, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 21 NTSTATUS NtModifyBootEntry ['PBOOT_ENTRY BootEntry']
 case 21: {
+if (PPP_CHECK_CB(on_NtModifyBootEntry_enter) || PPP_CHECK_CB(on_NtModifyBootEntry_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtModifyBootEntry_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtModifyBootEntry_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtModifyBootEntry_enter, rp.proc_id, pc, 21, env,pc,arg0) ; 
+}
 }; break;
 // 22 NTSTATUS NtCancelIoFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock']
 case 22: {
+if (PPP_CHECK_CB(on_NtCancelIoFile_enter) || PPP_CHECK_CB(on_NtCancelIoFile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtCancelIoFile_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCancelIoFile_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtCancelIoFile_enter, rp.proc_id, pc, 22, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 23 NTSTATUS NtCancelTimer ['HANDLE TimerHandle', ' PBOOLEAN CurrentState']
 case 23: {
+if (PPP_CHECK_CB(on_NtCancelTimer_enter) || PPP_CHECK_CB(on_NtCancelTimer_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtCancelTimer_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCancelTimer_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtCancelTimer_enter, rp.proc_id, pc, 23, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 24 NTSTATUS NtClearEvent ['HANDLE EventHandle']
 case 24: {
+if (PPP_CHECK_CB(on_NtClearEvent_enter) || PPP_CHECK_CB(on_NtClearEvent_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtClearEvent_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtClearEvent_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtClearEvent_enter, rp.proc_id, pc, 24, env,pc,arg0) ; 
+}
 }; break;
 // 25 NTSTATUS NtClose ['HANDLE Handle']
 case 25: {
+if (PPP_CHECK_CB(on_NtClose_enter) || PPP_CHECK_CB(on_NtClose_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtClose_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtClose_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtClose_enter, rp.proc_id, pc, 25, env,pc,arg0) ; 
+}
 }; break;
 // 26 NTSTATUS NtCloseObjectAuditAlarm ['PUNICODE_STRING SubsystemName', ' PVOID HandleId', ' BOOLEAN GenerateOnClose']
 case 26: {
+if (PPP_CHECK_CB(on_NtCloseObjectAuditAlarm_enter) || PPP_CHECK_CB(on_NtCloseObjectAuditAlarm_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -475,20 +528,24 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCloseObjectAuditAlarm_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtCloseObjectAuditAlarm_enter, rp.proc_id, pc, 26, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 27 NTSTATUS NtCompactKeys ['ULONG Count', ' HANDLE KeyArray[]']
 case 27: {
+if (PPP_CHECK_CB(on_NtCompactKeys_enter) || PPP_CHECK_CB(on_NtCompactKeys_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtCompactKeys_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCompactKeys_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtCompactKeys_enter, rp.proc_id, pc, 27, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 28 NTSTATUS NtCompareTokens ['HANDLE FirstTokenHandle', ' HANDLE SecondTokenHandle', ' PBOOLEAN Equal']
 case 28: {
+if (PPP_CHECK_CB(on_NtCompareTokens_enter) || PPP_CHECK_CB(on_NtCompareTokens_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -497,26 +554,32 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCompareTokens_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtCompareTokens_enter, rp.proc_id, pc, 28, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 29 NTSTATUS NtCompleteConnectPort ['HANDLE PortHandle']
 case 29: {
+if (PPP_CHECK_CB(on_NtCompleteConnectPort_enter) || PPP_CHECK_CB(on_NtCompleteConnectPort_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtCompleteConnectPort_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCompleteConnectPort_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtCompleteConnectPort_enter, rp.proc_id, pc, 29, env,pc,arg0) ; 
+}
 }; break;
 // 30 NTSTATUS NtCompressKey ['HANDLE Key']
 case 30: {
+if (PPP_CHECK_CB(on_NtCompressKey_enter) || PPP_CHECK_CB(on_NtCompressKey_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtCompressKey_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCompressKey_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtCompressKey_enter, rp.proc_id, pc, 30, env,pc,arg0) ; 
+}
 }; break;
 // 31 NTSTATUS NtConnectPort ['PHANDLE PortHandle', ' PUNICODE_STRING PortName', ' PSECURITY_QUALITY_OF_SERVICE SecurityQos', ' PPORT_VIEW ClientView', ' PREMOTE_PORT_VIEW ServerView', ' PULONG MaxMessageLength', ' PVOID ConnectionInformation', ' PULONG ConnectionInformationLength']
 case 31: {
+if (PPP_CHECK_CB(on_NtConnectPort_enter) || PPP_CHECK_CB(on_NtConnectPort_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -535,20 +598,24 @@ memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 memcpy(rp.params[6], &arg6, sizeof(uint32_t));
 memcpy(rp.params[7], &arg7, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtConnectPort_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
+PPP_RUN_CB_FILTERED(on_NtConnectPort_enter, rp.proc_id, pc, 31, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
+}
 }; break;
 // 32 NTSTATUS NtContinue ['PCONTEXT ContextRecord', ' BOOLEAN TestAlert']
 case 32: {
+if (PPP_CHECK_CB(on_NtContinue_enter) || PPP_CHECK_CB(on_NtContinue_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtContinue_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtContinue_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtContinue_enter, rp.proc_id, pc, 32, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 33 NTSTATUS NtCreateDebugObject ['PHANDLE DebugObjectHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' ULONG Flags']
 case 33: {
+if (PPP_CHECK_CB(on_NtCreateDebugObject_enter) || PPP_CHECK_CB(on_NtCreateDebugObject_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -559,10 +626,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreateDebugObject_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateDebugObject_enter, rp.proc_id, pc, 33, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 34 NTSTATUS NtCreateDirectoryObject ['PHANDLE DirectoryHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
 case 34: {
+if (PPP_CHECK_CB(on_NtCreateDirectoryObject_enter) || PPP_CHECK_CB(on_NtCreateDirectoryObject_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -571,10 +640,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreateDirectoryObject_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateDirectoryObject_enter, rp.proc_id, pc, 34, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 35 NTSTATUS NtCreateEvent ['PHANDLE EventHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' EVENT_TYPE EventType', ' BOOLEAN InitialState']
 case 35: {
+if (PPP_CHECK_CB(on_NtCreateEvent_enter) || PPP_CHECK_CB(on_NtCreateEvent_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -587,10 +658,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreateEvent_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateEvent_enter, rp.proc_id, pc, 35, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 36 NTSTATUS NtCreateEventPair ['PHANDLE EventPairHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
 case 36: {
+if (PPP_CHECK_CB(on_NtCreateEventPair_enter) || PPP_CHECK_CB(on_NtCreateEventPair_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -599,10 +672,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreateEventPair_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateEventPair_enter, rp.proc_id, pc, 36, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 37 NTSTATUS NtCreateFile ['PHANDLE FileHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PIO_STATUS_BLOCK IoStatusBlock', ' PLARGE_INTEGER AllocationSize', ' ULONG FileAttributes', ' ULONG ShareAccess', ' ULONG CreateDisposition', ' ULONG CreateOptions', ' PVOID EaBuffer', ' ULONG EaLength']
 case 37: {
+if (PPP_CHECK_CB(on_NtCreateFile_enter) || PPP_CHECK_CB(on_NtCreateFile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -627,10 +702,12 @@ memcpy(rp.params[8], &arg8, sizeof(uint32_t));
 memcpy(rp.params[9], &arg9, sizeof(uint32_t));
 memcpy(rp.params[10], &arg10, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreateFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateFile_enter, rp.proc_id, pc, 37, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10) ; 
+}
 }; break;
 // 38 NTSTATUS NtCreateIoCompletion ['PHANDLE IoCompletionHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' ULONG Count']
 case 38: {
+if (PPP_CHECK_CB(on_NtCreateIoCompletion_enter) || PPP_CHECK_CB(on_NtCreateIoCompletion_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -641,10 +718,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreateIoCompletion_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateIoCompletion_enter, rp.proc_id, pc, 38, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 39 NTSTATUS NtCreateJobObject ['PHANDLE JobHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
 case 39: {
+if (PPP_CHECK_CB(on_NtCreateJobObject_enter) || PPP_CHECK_CB(on_NtCreateJobObject_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -653,10 +732,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreateJobObject_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateJobObject_enter, rp.proc_id, pc, 39, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 40 NTSTATUS NtCreateJobSet ['ULONG NumJob', ' PJOB_SET_ARRAY UserJobSet', ' ULONG Flags']
 case 40: {
+if (PPP_CHECK_CB(on_NtCreateJobSet_enter) || PPP_CHECK_CB(on_NtCreateJobSet_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -665,10 +746,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreateJobSet_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateJobSet_enter, rp.proc_id, pc, 40, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 41 NTSTATUS NtCreateKey ['PHANDLE KeyHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' ULONG TitleIndex', ' PUNICODE_STRING Class', ' ULONG CreateOptions', ' PULONG Disposition']
 case 41: {
+if (PPP_CHECK_CB(on_NtCreateKey_enter) || PPP_CHECK_CB(on_NtCreateKey_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -685,10 +768,12 @@ memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 memcpy(rp.params[6], &arg6, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreateKey_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateKey_enter, rp.proc_id, pc, 41, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
+}
 }; break;
 // 42 NTSTATUS NtCreateMailslotFile ['PHANDLE FileHandle', ' ULONG DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PIO_STATUS_BLOCK IoStatusBlock', ' ULONG CreateOptions', ' ULONG MailslotQuota', ' ULONG MaximumMessageSize', ' PLARGE_INTEGER ReadTimeout']
 case 42: {
+if (PPP_CHECK_CB(on_NtCreateMailslotFile_enter) || PPP_CHECK_CB(on_NtCreateMailslotFile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -707,10 +792,12 @@ memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 memcpy(rp.params[6], &arg6, sizeof(uint32_t));
 memcpy(rp.params[7], &arg7, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreateMailslotFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateMailslotFile_enter, rp.proc_id, pc, 42, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
+}
 }; break;
 // 43 NTSTATUS NtCreateMutant ['PHANDLE MutantHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' BOOLEAN InitialOwner']
 case 43: {
+if (PPP_CHECK_CB(on_NtCreateMutant_enter) || PPP_CHECK_CB(on_NtCreateMutant_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -721,10 +808,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreateMutant_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateMutant_enter, rp.proc_id, pc, 43, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 44 NTSTATUS NtCreateNamedPipeFile ['PHANDLE FileHandle', ' ULONG DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PIO_STATUS_BLOCK IoStatusBlock', ' ULONG ShareAccess', ' ULONG CreateDisposition', ' ULONG CreateOptions', ' ULONG NamedPipeType', ' ULONG ReadMode', ' ULONG CompletionMode', ' ULONG MaximumInstances', ' ULONG InboundQuota', ' ULONG OutboundQuota', ' PLARGE_INTEGER DefaultTimeout']
 case 44: {
+if (PPP_CHECK_CB(on_NtCreateNamedPipeFile_enter) || PPP_CHECK_CB(on_NtCreateNamedPipeFile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -755,10 +844,12 @@ memcpy(rp.params[11], &arg11, sizeof(uint32_t));
 memcpy(rp.params[12], &arg12, sizeof(uint32_t));
 memcpy(rp.params[13], &arg13, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreateNamedPipeFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11,arg12,arg13) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateNamedPipeFile_enter, rp.proc_id, pc, 44, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11,arg12,arg13) ; 
+}
 }; break;
 // 45 NTSTATUS NtCreatePagingFile ['PUNICODE_STRING PageFileName', ' PLARGE_INTEGER MinimumSize', ' PLARGE_INTEGER MaximumSize', ' ULONG Priority']
 case 45: {
+if (PPP_CHECK_CB(on_NtCreatePagingFile_enter) || PPP_CHECK_CB(on_NtCreatePagingFile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -769,10 +860,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreatePagingFile_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtCreatePagingFile_enter, rp.proc_id, pc, 45, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 46 NTSTATUS NtCreatePort ['PHANDLE PortHandle', ' POBJECT_ATTRIBUTES ObjectAttributes', ' ULONG MaxConnectionInfoLength', ' ULONG MaxMessageLength', ' ULONG MaxPoolUsage']
 case 46: {
+if (PPP_CHECK_CB(on_NtCreatePort_enter) || PPP_CHECK_CB(on_NtCreatePort_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -785,10 +878,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreatePort_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtCreatePort_enter, rp.proc_id, pc, 46, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 47 NTSTATUS NtCreateProcess ['PHANDLE ProcessHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' HANDLE ParentProcess', ' BOOLEAN InheritObjectTable', ' HANDLE SectionHandle', ' HANDLE DebugPort', ' HANDLE ExceptionPort']
 case 47: {
+if (PPP_CHECK_CB(on_NtCreateProcess_enter) || PPP_CHECK_CB(on_NtCreateProcess_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -807,10 +902,12 @@ memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 memcpy(rp.params[6], &arg6, sizeof(uint32_t));
 memcpy(rp.params[7], &arg7, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreateProcess_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateProcess_enter, rp.proc_id, pc, 47, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
+}
 }; break;
 // 48 NTSTATUS NtCreateProcessEx ['PHANDLE ProcessHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' HANDLE ParentProcess', ' ULONG Flags', ' HANDLE SectionHandle', ' HANDLE DebugPort', ' HANDLE ExceptionPort', ' ULONG JobMemberLevel']
 case 48: {
+if (PPP_CHECK_CB(on_NtCreateProcessEx_enter) || PPP_CHECK_CB(on_NtCreateProcessEx_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -831,10 +928,12 @@ memcpy(rp.params[6], &arg6, sizeof(uint32_t));
 memcpy(rp.params[7], &arg7, sizeof(uint32_t));
 memcpy(rp.params[8], &arg8, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreateProcessEx_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateProcessEx_enter, rp.proc_id, pc, 48, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+}
 }; break;
 // 49 NTSTATUS NtCreateProfile ['PHANDLE ProfileHandle', ' HANDLE Process', ' PVOID RangeBase', ' SIZE_T RangeSize', ' ULONG BucketSize', ' PULONG Buffer', ' ULONG BufferSize', ' KPROFILE_SOURCE ProfileSource', ' KAFFINITY Affinity']
 case 49: {
+if (PPP_CHECK_CB(on_NtCreateProfile_enter) || PPP_CHECK_CB(on_NtCreateProfile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -855,10 +954,12 @@ memcpy(rp.params[6], &arg6, sizeof(uint32_t));
 memcpy(rp.params[7], &arg7, sizeof(uint32_t));
 memcpy(rp.params[8], &arg8, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreateProfile_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateProfile_enter, rp.proc_id, pc, 49, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+}
 }; break;
 // 50 NTSTATUS NtCreateSection ['PHANDLE SectionHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PLARGE_INTEGER MaximumSize', ' ULONG SectionPageProtection', ' ULONG AllocationAttributes', ' HANDLE FileHandle']
 case 50: {
+if (PPP_CHECK_CB(on_NtCreateSection_enter) || PPP_CHECK_CB(on_NtCreateSection_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -875,10 +976,12 @@ memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 memcpy(rp.params[6], &arg6, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreateSection_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateSection_enter, rp.proc_id, pc, 50, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
+}
 }; break;
 // 51 NTSTATUS NtCreateSemaphore ['PHANDLE SemaphoreHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' LONG InitialCount', ' LONG MaximumCount']
 case 51: {
+if (PPP_CHECK_CB(on_NtCreateSemaphore_enter) || PPP_CHECK_CB(on_NtCreateSemaphore_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -891,10 +994,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(int32_t));
 memcpy(rp.params[4], &arg4, sizeof(int32_t));
 }
-PPP_RUN_CB(on_NtCreateSemaphore_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateSemaphore_enter, rp.proc_id, pc, 51, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 52 NTSTATUS NtCreateSymbolicLinkObject ['PHANDLE LinkHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PUNICODE_STRING LinkTarget']
 case 52: {
+if (PPP_CHECK_CB(on_NtCreateSymbolicLinkObject_enter) || PPP_CHECK_CB(on_NtCreateSymbolicLinkObject_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -905,10 +1010,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreateSymbolicLinkObject_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateSymbolicLinkObject_enter, rp.proc_id, pc, 52, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 53 NTSTATUS NtCreateThread ['PHANDLE ThreadHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' HANDLE ProcessHandle', ' PCLIENT_ID ClientId', ' PCONTEXT ThreadContext', ' PINITIAL_TEB InitialTeb', ' BOOLEAN CreateSuspended']
 case 53: {
+if (PPP_CHECK_CB(on_NtCreateThread_enter) || PPP_CHECK_CB(on_NtCreateThread_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -927,10 +1034,12 @@ memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 memcpy(rp.params[6], &arg6, sizeof(uint32_t));
 memcpy(rp.params[7], &arg7, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreateThread_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateThread_enter, rp.proc_id, pc, 53, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
+}
 }; break;
 // 54 NTSTATUS NtCreateTimer ['PHANDLE TimerHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' TIMER_TYPE TimerType']
 case 54: {
+if (PPP_CHECK_CB(on_NtCreateTimer_enter) || PPP_CHECK_CB(on_NtCreateTimer_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -941,10 +1050,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreateTimer_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateTimer_enter, rp.proc_id, pc, 54, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 55 NTSTATUS NtCreateToken ['PHANDLE TokenHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' TOKEN_TYPE TokenType', ' PLUID AuthenticationId', ' PLARGE_INTEGER ExpirationTime', ' PTOKEN_USER User', ' PTOKEN_GROUPS Groups', ' PTOKEN_PRIVILEGES Privileges', ' PTOKEN_OWNER Owner', ' PTOKEN_PRIMARY_GROUP PrimaryGroup', ' PTOKEN_DEFAULT_DACL DefaultDacl', ' PTOKEN_SOURCE TokenSource']
 case 55: {
+if (PPP_CHECK_CB(on_NtCreateToken_enter) || PPP_CHECK_CB(on_NtCreateToken_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -973,10 +1084,12 @@ memcpy(rp.params[10], &arg10, sizeof(uint32_t));
 memcpy(rp.params[11], &arg11, sizeof(uint32_t));
 memcpy(rp.params[12], &arg12, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreateToken_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11,arg12) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateToken_enter, rp.proc_id, pc, 55, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11,arg12) ; 
+}
 }; break;
 // 56 NTSTATUS NtCreateWaitablePort ['PHANDLE PortHandle', ' POBJECT_ATTRIBUTES ObjectAttributes', ' ULONG MaxConnectionInfoLength', ' ULONG MaxMessageLength', ' ULONG MaxPoolUsage']
 case 56: {
+if (PPP_CHECK_CB(on_NtCreateWaitablePort_enter) || PPP_CHECK_CB(on_NtCreateWaitablePort_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -989,20 +1102,24 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreateWaitablePort_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateWaitablePort_enter, rp.proc_id, pc, 56, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 57 NTSTATUS NtDebugActiveProcess ['HANDLE ProcessHandle', ' HANDLE DebugObjectHandle']
 case 57: {
+if (PPP_CHECK_CB(on_NtDebugActiveProcess_enter) || PPP_CHECK_CB(on_NtDebugActiveProcess_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtDebugActiveProcess_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtDebugActiveProcess_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtDebugActiveProcess_enter, rp.proc_id, pc, 57, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 58 NTSTATUS NtDebugContinue ['HANDLE DebugObjectHandle', ' PCLIENT_ID ClientId', ' NTSTATUS ContinueStatus']
 case 58: {
+if (PPP_CHECK_CB(on_NtDebugContinue_enter) || PPP_CHECK_CB(on_NtDebugContinue_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1011,44 +1128,54 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtDebugContinue_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtDebugContinue_enter, rp.proc_id, pc, 58, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 59 NTSTATUS NtDelayExecution ['BOOLEAN Alertable', ' PLARGE_INTEGER DelayInterval']
 case 59: {
+if (PPP_CHECK_CB(on_NtDelayExecution_enter) || PPP_CHECK_CB(on_NtDelayExecution_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtDelayExecution_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtDelayExecution_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtDelayExecution_enter, rp.proc_id, pc, 59, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 60 NTSTATUS NtDeleteAtom ['RTL_ATOM Atom']
 case 60: {
+if (PPP_CHECK_CB(on_NtDeleteAtom_enter) || PPP_CHECK_CB(on_NtDeleteAtom_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtDeleteAtom_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtDeleteAtom_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtDeleteAtom_enter, rp.proc_id, pc, 60, env,pc,arg0) ; 
+}
 }; break;
 // 61 NTSTATUS NtDeleteFile ['POBJECT_ATTRIBUTES ObjectAttributes']
 case 61: {
+if (PPP_CHECK_CB(on_NtDeleteFile_enter) || PPP_CHECK_CB(on_NtDeleteFile_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtDeleteFile_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtDeleteFile_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtDeleteFile_enter, rp.proc_id, pc, 61, env,pc,arg0) ; 
+}
 }; break;
 // 62 NTSTATUS NtDeleteKey ['HANDLE KeyHandle']
 case 62: {
+if (PPP_CHECK_CB(on_NtDeleteKey_enter) || PPP_CHECK_CB(on_NtDeleteKey_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtDeleteKey_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtDeleteKey_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtDeleteKey_enter, rp.proc_id, pc, 62, env,pc,arg0) ; 
+}
 }; break;
 // 63 NTSTATUS NtDeleteObjectAuditAlarm ['PUNICODE_STRING SubsystemName', ' PVOID HandleId', ' BOOLEAN GenerateOnClose']
 case 63: {
+if (PPP_CHECK_CB(on_NtDeleteObjectAuditAlarm_enter) || PPP_CHECK_CB(on_NtDeleteObjectAuditAlarm_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1057,20 +1184,24 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtDeleteObjectAuditAlarm_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtDeleteObjectAuditAlarm_enter, rp.proc_id, pc, 63, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 64 NTSTATUS NtDeleteValueKey ['HANDLE KeyHandle', ' PUNICODE_STRING ValueName']
 case 64: {
+if (PPP_CHECK_CB(on_NtDeleteValueKey_enter) || PPP_CHECK_CB(on_NtDeleteValueKey_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtDeleteValueKey_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtDeleteValueKey_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtDeleteValueKey_enter, rp.proc_id, pc, 64, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 65 NTSTATUS NtDeviceIoControlFile ['HANDLE FileHandle', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' ULONG IoControlCode', ' PVOID InputBuffer', ' ULONG InputBufferLength', ' PVOID OutputBuffer', ' ULONG OutputBufferLength']
 case 65: {
+if (PPP_CHECK_CB(on_NtDeviceIoControlFile_enter) || PPP_CHECK_CB(on_NtDeviceIoControlFile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1093,18 +1224,22 @@ memcpy(rp.params[7], &arg7, sizeof(uint32_t));
 memcpy(rp.params[8], &arg8, sizeof(uint32_t));
 memcpy(rp.params[9], &arg9, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtDeviceIoControlFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9) ; 
+PPP_RUN_CB_FILTERED(on_NtDeviceIoControlFile_enter, rp.proc_id, pc, 65, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9) ; 
+}
 }; break;
 // 66 NTSTATUS NtDisplayString ['PUNICODE_STRING String']
 case 66: {
+if (PPP_CHECK_CB(on_NtDisplayString_enter) || PPP_CHECK_CB(on_NtDisplayString_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtDisplayString_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtDisplayString_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtDisplayString_enter, rp.proc_id, pc, 66, env,pc,arg0) ; 
+}
 }; break;
 // 67 NTSTATUS NtDuplicateObject ['HANDLE SourceProcessHandle', ' HANDLE SourceHandle', ' HANDLE TargetProcessHandle', ' PHANDLE TargetHandle', ' ACCESS_MASK DesiredAccess', ' ULONG HandleAttributes', ' ULONG Options']
 case 67: {
+if (PPP_CHECK_CB(on_NtDuplicateObject_enter) || PPP_CHECK_CB(on_NtDuplicateObject_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1121,10 +1256,12 @@ memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 memcpy(rp.params[6], &arg6, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtDuplicateObject_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
+PPP_RUN_CB_FILTERED(on_NtDuplicateObject_enter, rp.proc_id, pc, 67, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
+}
 }; break;
 // 68 NTSTATUS NtDuplicateToken ['HANDLE ExistingTokenHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' BOOLEAN EffectiveOnly', ' TOKEN_TYPE TokenType', ' PHANDLE NewTokenHandle']
 case 68: {
+if (PPP_CHECK_CB(on_NtDuplicateToken_enter) || PPP_CHECK_CB(on_NtDuplicateToken_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1139,10 +1276,12 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtDuplicateToken_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+PPP_RUN_CB_FILTERED(on_NtDuplicateToken_enter, rp.proc_id, pc, 68, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 69 NTSTATUS NtEnumerateKey ['HANDLE KeyHandle', ' ULONG Index', ' KEY_INFORMATION_CLASS KeyInformationClass', ' PVOID KeyInformation', ' ULONG Length', ' PULONG ResultLength']
 case 69: {
+if (PPP_CHECK_CB(on_NtEnumerateKey_enter) || PPP_CHECK_CB(on_NtEnumerateKey_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1157,10 +1296,12 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtEnumerateKey_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+PPP_RUN_CB_FILTERED(on_NtEnumerateKey_enter, rp.proc_id, pc, 69, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 70 NTSTATUS NtEnumerateSystemEnvironmentValuesEx ['ULONG InformationClass', ' PVOID Buffer', ' PULONG BufferLength']
 case 70: {
+if (PPP_CHECK_CB(on_NtEnumerateSystemEnvironmentValuesEx_enter) || PPP_CHECK_CB(on_NtEnumerateSystemEnvironmentValuesEx_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1169,10 +1310,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtEnumerateSystemEnvironmentValuesEx_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtEnumerateSystemEnvironmentValuesEx_enter, rp.proc_id, pc, 70, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 71 NTSTATUS NtEnumerateValueKey ['HANDLE KeyHandle', ' ULONG Index', ' KEY_VALUE_INFORMATION_CLASS KeyValueInformationClass', ' PVOID KeyValueInformation', ' ULONG Length', ' PULONG ResultLength']
 case 71: {
+if (PPP_CHECK_CB(on_NtEnumerateValueKey_enter) || PPP_CHECK_CB(on_NtEnumerateValueKey_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1187,20 +1330,24 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtEnumerateValueKey_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+PPP_RUN_CB_FILTERED(on_NtEnumerateValueKey_enter, rp.proc_id, pc, 71, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 72 NTSTATUS NtExtendSection ['HANDLE SectionHandle', ' PLARGE_INTEGER NewSectionSize']
 case 72: {
+if (PPP_CHECK_CB(on_NtExtendSection_enter) || PPP_CHECK_CB(on_NtExtendSection_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtExtendSection_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtExtendSection_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtExtendSection_enter, rp.proc_id, pc, 72, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 73 NTSTATUS NtFilterToken ['HANDLE ExistingTokenHandle', ' ULONG Flags', ' PTOKEN_GROUPS SidsToDisable', ' PTOKEN_PRIVILEGES PrivilegesToDelete', ' PTOKEN_GROUPS RestrictedSids', ' PHANDLE NewTokenHandle']
 case 73: {
+if (PPP_CHECK_CB(on_NtFilterToken_enter) || PPP_CHECK_CB(on_NtFilterToken_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1215,10 +1362,12 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtFilterToken_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+PPP_RUN_CB_FILTERED(on_NtFilterToken_enter, rp.proc_id, pc, 73, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 74 NTSTATUS NtFindAtom ['PWSTR AtomName', ' ULONG Length', ' PRTL_ATOM Atom']
 case 74: {
+if (PPP_CHECK_CB(on_NtFindAtom_enter) || PPP_CHECK_CB(on_NtFindAtom_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1227,20 +1376,24 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtFindAtom_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtFindAtom_enter, rp.proc_id, pc, 74, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 75 NTSTATUS NtFlushBuffersFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock']
 case 75: {
+if (PPP_CHECK_CB(on_NtFlushBuffersFile_enter) || PPP_CHECK_CB(on_NtFlushBuffersFile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtFlushBuffersFile_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtFlushBuffersFile_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtFlushBuffersFile_enter, rp.proc_id, pc, 75, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 76 NTSTATUS NtFlushInstructionCache ['HANDLE ProcessHandle', ' PVOID BaseAddress', ' SIZE_T Length']
 case 76: {
+if (PPP_CHECK_CB(on_NtFlushInstructionCache_enter) || PPP_CHECK_CB(on_NtFlushInstructionCache_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1249,18 +1402,22 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtFlushInstructionCache_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtFlushInstructionCache_enter, rp.proc_id, pc, 76, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 77 NTSTATUS NtFlushKey ['HANDLE KeyHandle']
 case 77: {
+if (PPP_CHECK_CB(on_NtFlushKey_enter) || PPP_CHECK_CB(on_NtFlushKey_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtFlushKey_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtFlushKey_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtFlushKey_enter, rp.proc_id, pc, 77, env,pc,arg0) ; 
+}
 }; break;
 // 78 NTSTATUS NtFlushVirtualMemory ['HANDLE ProcessHandle', ' PVOID *BaseAddress', ' PSIZE_T RegionSize', ' PIO_STATUS_BLOCK IoStatus']
 case 78: {
+if (PPP_CHECK_CB(on_NtFlushVirtualMemory_enter) || PPP_CHECK_CB(on_NtFlushVirtualMemory_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1271,16 +1428,20 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtFlushVirtualMemory_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtFlushVirtualMemory_enter, rp.proc_id, pc, 78, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 79 NTSTATUS NtFlushWriteBuffer ['']
 case 79: {
+if (PPP_CHECK_CB(on_NtFlushWriteBuffer_enter) || PPP_CHECK_CB(on_NtFlushWriteBuffer_return)) {
 if (PPP_CHECK_CB(on_NtFlushWriteBuffer_return)) {
 }
-PPP_RUN_CB(on_NtFlushWriteBuffer_enter, env,pc) ; 
+PPP_RUN_CB_FILTERED(on_NtFlushWriteBuffer_enter, rp.proc_id, pc, 79, env,pc) ; 
+}
 }; break;
 // 80 NTSTATUS NtFreeUserPhysicalPages ['HANDLE ProcessHandle', ' PULONG_PTR NumberOfPages', ' PULONG_PTR UserPfnArray']
 case 80: {
+if (PPP_CHECK_CB(on_NtFreeUserPhysicalPages_enter) || PPP_CHECK_CB(on_NtFreeUserPhysicalPages_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1289,10 +1450,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtFreeUserPhysicalPages_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtFreeUserPhysicalPages_enter, rp.proc_id, pc, 80, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 81 NTSTATUS NtFreeVirtualMemory ['HANDLE ProcessHandle', ' PVOID *BaseAddress', ' PSIZE_T RegionSize', ' ULONG FreeType']
 case 81: {
+if (PPP_CHECK_CB(on_NtFreeVirtualMemory_enter) || PPP_CHECK_CB(on_NtFreeVirtualMemory_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1303,10 +1466,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtFreeVirtualMemory_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtFreeVirtualMemory_enter, rp.proc_id, pc, 81, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 82 NTSTATUS NtFsControlFile ['HANDLE FileHandle', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' ULONG IoControlCode', ' PVOID InputBuffer', ' ULONG InputBufferLength', ' PVOID OutputBuffer', ' ULONG OutputBufferLength']
 case 82: {
+if (PPP_CHECK_CB(on_NtFsControlFile_enter) || PPP_CHECK_CB(on_NtFsControlFile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1329,30 +1494,36 @@ memcpy(rp.params[7], &arg7, sizeof(uint32_t));
 memcpy(rp.params[8], &arg8, sizeof(uint32_t));
 memcpy(rp.params[9], &arg9, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtFsControlFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9) ; 
+PPP_RUN_CB_FILTERED(on_NtFsControlFile_enter, rp.proc_id, pc, 82, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9) ; 
+}
 }; break;
 // 83 NTSTATUS NtGetContextThread ['HANDLE ThreadHandle', ' PCONTEXT ThreadContext']
 case 83: {
+if (PPP_CHECK_CB(on_NtGetContextThread_enter) || PPP_CHECK_CB(on_NtGetContextThread_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtGetContextThread_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtGetContextThread_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtGetContextThread_enter, rp.proc_id, pc, 83, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 84 NTSTATUS NtGetDevicePowerState ['HANDLE Device', ' DEVICE_POWER_STATE *State']
 case 84: {
+if (PPP_CHECK_CB(on_NtGetDevicePowerState_enter) || PPP_CHECK_CB(on_NtGetDevicePowerState_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtGetDevicePowerState_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtGetDevicePowerState_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtGetDevicePowerState_enter, rp.proc_id, pc, 84, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 85 NTSTATUS NtGetPlugPlayEvent ['HANDLE EventHandle', ' PVOID Context', ' PPLUGPLAY_EVENT_BLOCK EventBlock', ' ULONG EventBufferSize']
 case 85: {
+if (PPP_CHECK_CB(on_NtGetPlugPlayEvent_enter) || PPP_CHECK_CB(on_NtGetPlugPlayEvent_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1363,10 +1534,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtGetPlugPlayEvent_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtGetPlugPlayEvent_enter, rp.proc_id, pc, 85, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 86 NTSTATUS NtGetWriteWatch ['HANDLE ProcessHandle', ' ULONG Flags', ' PVOID BaseAddress', ' SIZE_T RegionSize', ' PVOID *UserAddressArray', ' PULONG_PTR EntriesInUserAddressArray', ' PULONG Granularity']
 case 86: {
+if (PPP_CHECK_CB(on_NtGetWriteWatch_enter) || PPP_CHECK_CB(on_NtGetWriteWatch_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1383,28 +1556,34 @@ memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 memcpy(rp.params[6], &arg6, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtGetWriteWatch_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
+PPP_RUN_CB_FILTERED(on_NtGetWriteWatch_enter, rp.proc_id, pc, 86, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
+}
 }; break;
 // 87 NTSTATUS NtImpersonateAnonymousToken ['HANDLE ThreadHandle']
 case 87: {
+if (PPP_CHECK_CB(on_NtImpersonateAnonymousToken_enter) || PPP_CHECK_CB(on_NtImpersonateAnonymousToken_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtImpersonateAnonymousToken_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtImpersonateAnonymousToken_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtImpersonateAnonymousToken_enter, rp.proc_id, pc, 87, env,pc,arg0) ; 
+}
 }; break;
 // 88 NTSTATUS NtImpersonateClientOfPort ['HANDLE PortHandle', ' PPORT_MESSAGE Message']
 case 88: {
+if (PPP_CHECK_CB(on_NtImpersonateClientOfPort_enter) || PPP_CHECK_CB(on_NtImpersonateClientOfPort_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtImpersonateClientOfPort_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtImpersonateClientOfPort_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtImpersonateClientOfPort_enter, rp.proc_id, pc, 88, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 89 NTSTATUS NtImpersonateThread ['HANDLE ServerThreadHandle', ' HANDLE ClientThreadHandle', ' PSECURITY_QUALITY_OF_SERVICE SecurityQos']
 case 89: {
+if (PPP_CHECK_CB(on_NtImpersonateThread_enter) || PPP_CHECK_CB(on_NtImpersonateThread_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1413,18 +1592,22 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtImpersonateThread_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtImpersonateThread_enter, rp.proc_id, pc, 89, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 90 NTSTATUS NtInitializeRegistry ['USHORT BootCondition']
 case 90: {
+if (PPP_CHECK_CB(on_NtInitializeRegistry_enter) || PPP_CHECK_CB(on_NtInitializeRegistry_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtInitializeRegistry_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtInitializeRegistry_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtInitializeRegistry_enter, rp.proc_id, pc, 90, env,pc,arg0) ; 
+}
 }; break;
 // 91 NTSTATUS NtInitiatePowerAction ['POWER_ACTION SystemAction', ' SYSTEM_POWER_STATE MinSystemState', ' ULONG Flags', ' BOOLEAN Asynchronous']
 case 91: {
+if (PPP_CHECK_CB(on_NtInitiatePowerAction_enter) || PPP_CHECK_CB(on_NtInitiatePowerAction_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1435,54 +1618,66 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtInitiatePowerAction_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtInitiatePowerAction_enter, rp.proc_id, pc, 91, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 92 NTSTATUS NtIsProcessInJob ['HANDLE ProcessHandle', ' HANDLE JobHandle']
 case 92: {
+if (PPP_CHECK_CB(on_NtIsProcessInJob_enter) || PPP_CHECK_CB(on_NtIsProcessInJob_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtIsProcessInJob_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtIsProcessInJob_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtIsProcessInJob_enter, rp.proc_id, pc, 92, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 93 BOOLEAN NtIsSystemResumeAutomatic ['']
 case 93: {
+if (PPP_CHECK_CB(on_NtIsSystemResumeAutomatic_enter) || PPP_CHECK_CB(on_NtIsSystemResumeAutomatic_return)) {
 if (PPP_CHECK_CB(on_NtIsSystemResumeAutomatic_return)) {
 }
-PPP_RUN_CB(on_NtIsSystemResumeAutomatic_enter, env,pc) ; 
+PPP_RUN_CB_FILTERED(on_NtIsSystemResumeAutomatic_enter, rp.proc_id, pc, 93, env,pc) ; 
+}
 }; break;
 // 94 NTSTATUS NtListenPort ['HANDLE PortHandle', ' PPORT_MESSAGE ConnectionRequest']
 case 94: {
+if (PPP_CHECK_CB(on_NtListenPort_enter) || PPP_CHECK_CB(on_NtListenPort_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtListenPort_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtListenPort_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtListenPort_enter, rp.proc_id, pc, 94, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 95 NTSTATUS NtLoadDriver ['PUNICODE_STRING DriverServiceName']
 case 95: {
+if (PPP_CHECK_CB(on_NtLoadDriver_enter) || PPP_CHECK_CB(on_NtLoadDriver_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtLoadDriver_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtLoadDriver_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtLoadDriver_enter, rp.proc_id, pc, 95, env,pc,arg0) ; 
+}
 }; break;
 // 96 NTSTATUS NtLoadKey ['POBJECT_ATTRIBUTES TargetKey', ' POBJECT_ATTRIBUTES SourceFile']
 case 96: {
+if (PPP_CHECK_CB(on_NtLoadKey_enter) || PPP_CHECK_CB(on_NtLoadKey_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtLoadKey_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtLoadKey_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtLoadKey_enter, rp.proc_id, pc, 96, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 97 NTSTATUS NtLoadKey2 ['POBJECT_ATTRIBUTES TargetKey', ' POBJECT_ATTRIBUTES SourceFile', ' ULONG Flags']
 case 97: {
+if (PPP_CHECK_CB(on_NtLoadKey2_enter) || PPP_CHECK_CB(on_NtLoadKey2_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1491,10 +1686,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtLoadKey2_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtLoadKey2_enter, rp.proc_id, pc, 97, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 98 NTSTATUS NtLockFile ['HANDLE FileHandle', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' PLARGE_INTEGER ByteOffset', ' PLARGE_INTEGER Length', ' ULONG Key', ' BOOLEAN FailImmediately', ' BOOLEAN ExclusiveLock']
 case 98: {
+if (PPP_CHECK_CB(on_NtLockFile_enter) || PPP_CHECK_CB(on_NtLockFile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1517,28 +1714,34 @@ memcpy(rp.params[7], &arg7, sizeof(uint32_t));
 memcpy(rp.params[8], &arg8, sizeof(uint32_t));
 memcpy(rp.params[9], &arg9, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtLockFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9) ; 
+PPP_RUN_CB_FILTERED(on_NtLockFile_enter, rp.proc_id, pc, 98, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9) ; 
+}
 }; break;
 // 99 NTSTATUS NtLockProductActivationKeys ['ULONG *pPrivateVer', ' ULONG *pSafeMode']
 case 99: {
+if (PPP_CHECK_CB(on_NtLockProductActivationKeys_enter) || PPP_CHECK_CB(on_NtLockProductActivationKeys_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtLockProductActivationKeys_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtLockProductActivationKeys_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtLockProductActivationKeys_enter, rp.proc_id, pc, 99, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 100 NTSTATUS NtLockRegistryKey ['HANDLE KeyHandle']
 case 100: {
+if (PPP_CHECK_CB(on_NtLockRegistryKey_enter) || PPP_CHECK_CB(on_NtLockRegistryKey_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtLockRegistryKey_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtLockRegistryKey_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtLockRegistryKey_enter, rp.proc_id, pc, 100, env,pc,arg0) ; 
+}
 }; break;
 // 101 NTSTATUS NtLockVirtualMemory ['HANDLE ProcessHandle', ' PVOID *BaseAddress', ' PSIZE_T RegionSize', ' ULONG MapType']
 case 101: {
+if (PPP_CHECK_CB(on_NtLockVirtualMemory_enter) || PPP_CHECK_CB(on_NtLockVirtualMemory_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1549,26 +1752,32 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtLockVirtualMemory_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtLockVirtualMemory_enter, rp.proc_id, pc, 101, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 102 NTSTATUS NtMakePermanentObject ['HANDLE Handle']
 case 102: {
+if (PPP_CHECK_CB(on_NtMakePermanentObject_enter) || PPP_CHECK_CB(on_NtMakePermanentObject_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtMakePermanentObject_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtMakePermanentObject_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtMakePermanentObject_enter, rp.proc_id, pc, 102, env,pc,arg0) ; 
+}
 }; break;
 // 103 NTSTATUS NtMakeTemporaryObject ['HANDLE Handle']
 case 103: {
+if (PPP_CHECK_CB(on_NtMakeTemporaryObject_enter) || PPP_CHECK_CB(on_NtMakeTemporaryObject_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtMakeTemporaryObject_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtMakeTemporaryObject_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtMakeTemporaryObject_enter, rp.proc_id, pc, 103, env,pc,arg0) ; 
+}
 }; break;
 // 104 NTSTATUS NtMapUserPhysicalPages ['PVOID VirtualAddress', ' ULONG_PTR NumberOfPages', ' PULONG_PTR UserPfnArray']
 case 104: {
+if (PPP_CHECK_CB(on_NtMapUserPhysicalPages_enter) || PPP_CHECK_CB(on_NtMapUserPhysicalPages_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1577,10 +1786,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtMapUserPhysicalPages_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtMapUserPhysicalPages_enter, rp.proc_id, pc, 104, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 105 NTSTATUS NtMapUserPhysicalPagesScatter ['PVOID *VirtualAddresses', ' ULONG_PTR NumberOfPages', ' PULONG_PTR UserPfnArray']
 case 105: {
+if (PPP_CHECK_CB(on_NtMapUserPhysicalPagesScatter_enter) || PPP_CHECK_CB(on_NtMapUserPhysicalPagesScatter_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1589,10 +1800,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtMapUserPhysicalPagesScatter_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtMapUserPhysicalPagesScatter_enter, rp.proc_id, pc, 105, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 106 NTSTATUS NtMapViewOfSection ['HANDLE SectionHandle', ' HANDLE ProcessHandle', ' PVOID *BaseAddress', ' ULONG_PTR ZeroBits', ' SIZE_T CommitSize', ' PLARGE_INTEGER SectionOffset', ' PSIZE_T ViewSize', ' SECTION_INHERIT InheritDisposition', ' ULONG AllocationType', ' WIN32_PROTECTION_MASK Win32Protect']
 case 106: {
+if (PPP_CHECK_CB(on_NtMapViewOfSection_enter) || PPP_CHECK_CB(on_NtMapViewOfSection_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1615,10 +1828,12 @@ memcpy(rp.params[7], &arg7, sizeof(uint32_t));
 memcpy(rp.params[8], &arg8, sizeof(uint32_t));
 memcpy(rp.params[9], &arg9, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtMapViewOfSection_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9) ; 
+PPP_RUN_CB_FILTERED(on_NtMapViewOfSection_enter, rp.proc_id, pc, 106, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9) ; 
+}
 }; break;
 // 107 NTSTATUS NtNotifyChangeDirectoryFile ['HANDLE FileHandle', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID Buffer', ' ULONG Length', ' ULONG CompletionFilter', ' BOOLEAN WatchTree']
 case 107: {
+if (PPP_CHECK_CB(on_NtNotifyChangeDirectoryFile_enter) || PPP_CHECK_CB(on_NtNotifyChangeDirectoryFile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1639,10 +1854,12 @@ memcpy(rp.params[6], &arg6, sizeof(uint32_t));
 memcpy(rp.params[7], &arg7, sizeof(uint32_t));
 memcpy(rp.params[8], &arg8, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtNotifyChangeDirectoryFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+PPP_RUN_CB_FILTERED(on_NtNotifyChangeDirectoryFile_enter, rp.proc_id, pc, 107, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+}
 }; break;
 // 108 NTSTATUS NtNotifyChangeKey ['HANDLE KeyHandle', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' ULONG CompletionFilter', ' BOOLEAN WatchTree', ' PVOID Buffer', ' ULONG BufferSize', ' BOOLEAN Asynchronous']
 case 108: {
+if (PPP_CHECK_CB(on_NtNotifyChangeKey_enter) || PPP_CHECK_CB(on_NtNotifyChangeKey_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1665,10 +1882,12 @@ memcpy(rp.params[7], &arg7, sizeof(uint32_t));
 memcpy(rp.params[8], &arg8, sizeof(uint32_t));
 memcpy(rp.params[9], &arg9, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtNotifyChangeKey_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9) ; 
+PPP_RUN_CB_FILTERED(on_NtNotifyChangeKey_enter, rp.proc_id, pc, 108, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9) ; 
+}
 }; break;
 // 109 NTSTATUS NtNotifyChangeMultipleKeys ['HANDLE MasterKeyHandle', ' ULONG Count', ' OBJECT_ATTRIBUTES SlaveObjects[]', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' ULONG CompletionFilter', ' BOOLEAN WatchTree', ' PVOID Buffer', ' ULONG BufferSize', ' BOOLEAN Asynchronous']
 case 109: {
+if (PPP_CHECK_CB(on_NtNotifyChangeMultipleKeys_enter) || PPP_CHECK_CB(on_NtNotifyChangeMultipleKeys_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1695,10 +1914,12 @@ memcpy(rp.params[9], &arg9, sizeof(uint32_t));
 memcpy(rp.params[10], &arg10, sizeof(uint32_t));
 memcpy(rp.params[11], &arg11, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtNotifyChangeMultipleKeys_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11) ; 
+PPP_RUN_CB_FILTERED(on_NtNotifyChangeMultipleKeys_enter, rp.proc_id, pc, 109, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11) ; 
+}
 }; break;
 // 110 NTSTATUS NtOpenDirectoryObject ['PHANDLE DirectoryHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
 case 110: {
+if (PPP_CHECK_CB(on_NtOpenDirectoryObject_enter) || PPP_CHECK_CB(on_NtOpenDirectoryObject_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1707,10 +1928,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtOpenDirectoryObject_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtOpenDirectoryObject_enter, rp.proc_id, pc, 110, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 111 NTSTATUS NtOpenEvent ['PHANDLE EventHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
 case 111: {
+if (PPP_CHECK_CB(on_NtOpenEvent_enter) || PPP_CHECK_CB(on_NtOpenEvent_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1719,10 +1942,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtOpenEvent_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtOpenEvent_enter, rp.proc_id, pc, 111, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 112 NTSTATUS NtOpenEventPair ['PHANDLE EventPairHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
 case 112: {
+if (PPP_CHECK_CB(on_NtOpenEventPair_enter) || PPP_CHECK_CB(on_NtOpenEventPair_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1731,10 +1956,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtOpenEventPair_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtOpenEventPair_enter, rp.proc_id, pc, 112, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 113 NTSTATUS NtOpenFile ['PHANDLE FileHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PIO_STATUS_BLOCK IoStatusBlock', ' ULONG ShareAccess', ' ULONG OpenOptions']
 case 113: {
+if (PPP_CHECK_CB(on_NtOpenFile_enter) || PPP_CHECK_CB(on_NtOpenFile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1749,10 +1976,12 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtOpenFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+PPP_RUN_CB_FILTERED(on_NtOpenFile_enter, rp.proc_id, pc, 113, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 114 NTSTATUS NtOpenIoCompletion ['PHANDLE IoCompletionHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
 case 114: {
+if (PPP_CHECK_CB(on_NtOpenIoCompletion_enter) || PPP_CHECK_CB(on_NtOpenIoCompletion_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1761,10 +1990,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtOpenIoCompletion_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtOpenIoCompletion_enter, rp.proc_id, pc, 114, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 115 NTSTATUS NtOpenJobObject ['PHANDLE JobHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
 case 115: {
+if (PPP_CHECK_CB(on_NtOpenJobObject_enter) || PPP_CHECK_CB(on_NtOpenJobObject_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1773,10 +2004,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtOpenJobObject_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtOpenJobObject_enter, rp.proc_id, pc, 115, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 116 NTSTATUS NtOpenKey ['PHANDLE KeyHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
 case 116: {
+if (PPP_CHECK_CB(on_NtOpenKey_enter) || PPP_CHECK_CB(on_NtOpenKey_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1785,10 +2018,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtOpenKey_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtOpenKey_enter, rp.proc_id, pc, 116, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 117 NTSTATUS NtOpenMutant ['PHANDLE MutantHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
 case 117: {
+if (PPP_CHECK_CB(on_NtOpenMutant_enter) || PPP_CHECK_CB(on_NtOpenMutant_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1797,10 +2032,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtOpenMutant_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtOpenMutant_enter, rp.proc_id, pc, 117, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 118 NTSTATUS NtOpenObjectAuditAlarm ['PUNICODE_STRING SubsystemName', ' PVOID HandleId', ' PUNICODE_STRING ObjectTypeName', ' PUNICODE_STRING ObjectName', ' PSECURITY_DESCRIPTOR SecurityDescriptor', ' HANDLE ClientToken', ' ACCESS_MASK DesiredAccess', ' ACCESS_MASK GrantedAccess', ' PPRIVILEGE_SET Privileges', ' BOOLEAN ObjectCreation', ' BOOLEAN AccessGranted', ' PBOOLEAN GenerateOnClose']
 case 118: {
+if (PPP_CHECK_CB(on_NtOpenObjectAuditAlarm_enter) || PPP_CHECK_CB(on_NtOpenObjectAuditAlarm_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1827,10 +2064,12 @@ memcpy(rp.params[9], &arg9, sizeof(uint32_t));
 memcpy(rp.params[10], &arg10, sizeof(uint32_t));
 memcpy(rp.params[11], &arg11, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtOpenObjectAuditAlarm_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11) ; 
+PPP_RUN_CB_FILTERED(on_NtOpenObjectAuditAlarm_enter, rp.proc_id, pc, 118, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11) ; 
+}
 }; break;
 // 119 NTSTATUS NtOpenProcess ['PHANDLE ProcessHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PCLIENT_ID ClientId']
 case 119: {
+if (PPP_CHECK_CB(on_NtOpenProcess_enter) || PPP_CHECK_CB(on_NtOpenProcess_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1841,10 +2080,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtOpenProcess_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtOpenProcess_enter, rp.proc_id, pc, 119, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 120 NTSTATUS NtOpenProcessToken ['HANDLE ProcessHandle', ' ACCESS_MASK DesiredAccess', ' PHANDLE TokenHandle']
 case 120: {
+if (PPP_CHECK_CB(on_NtOpenProcessToken_enter) || PPP_CHECK_CB(on_NtOpenProcessToken_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1853,10 +2094,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtOpenProcessToken_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtOpenProcessToken_enter, rp.proc_id, pc, 120, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 121 NTSTATUS NtOpenProcessTokenEx ['HANDLE ProcessHandle', ' ACCESS_MASK DesiredAccess', ' ULONG HandleAttributes', ' PHANDLE TokenHandle']
 case 121: {
+if (PPP_CHECK_CB(on_NtOpenProcessTokenEx_enter) || PPP_CHECK_CB(on_NtOpenProcessTokenEx_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1867,10 +2110,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtOpenProcessTokenEx_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtOpenProcessTokenEx_enter, rp.proc_id, pc, 121, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 122 NTSTATUS NtOpenSection ['PHANDLE SectionHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
 case 122: {
+if (PPP_CHECK_CB(on_NtOpenSection_enter) || PPP_CHECK_CB(on_NtOpenSection_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1879,10 +2124,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtOpenSection_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtOpenSection_enter, rp.proc_id, pc, 122, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 123 NTSTATUS NtOpenSemaphore ['PHANDLE SemaphoreHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
 case 123: {
+if (PPP_CHECK_CB(on_NtOpenSemaphore_enter) || PPP_CHECK_CB(on_NtOpenSemaphore_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1891,10 +2138,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtOpenSemaphore_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtOpenSemaphore_enter, rp.proc_id, pc, 123, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 124 NTSTATUS NtOpenSymbolicLinkObject ['PHANDLE LinkHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
 case 124: {
+if (PPP_CHECK_CB(on_NtOpenSymbolicLinkObject_enter) || PPP_CHECK_CB(on_NtOpenSymbolicLinkObject_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1903,10 +2152,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtOpenSymbolicLinkObject_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtOpenSymbolicLinkObject_enter, rp.proc_id, pc, 124, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 125 NTSTATUS NtOpenThread ['PHANDLE ThreadHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PCLIENT_ID ClientId']
 case 125: {
+if (PPP_CHECK_CB(on_NtOpenThread_enter) || PPP_CHECK_CB(on_NtOpenThread_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1917,10 +2168,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtOpenThread_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtOpenThread_enter, rp.proc_id, pc, 125, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 126 NTSTATUS NtOpenThreadToken ['HANDLE ThreadHandle', ' ACCESS_MASK DesiredAccess', ' BOOLEAN OpenAsSelf', ' PHANDLE TokenHandle']
 case 126: {
+if (PPP_CHECK_CB(on_NtOpenThreadToken_enter) || PPP_CHECK_CB(on_NtOpenThreadToken_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1931,10 +2184,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtOpenThreadToken_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtOpenThreadToken_enter, rp.proc_id, pc, 126, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 127 NTSTATUS NtOpenThreadTokenEx ['HANDLE ThreadHandle', ' ACCESS_MASK DesiredAccess', ' BOOLEAN OpenAsSelf', ' ULONG HandleAttributes', ' PHANDLE TokenHandle']
 case 127: {
+if (PPP_CHECK_CB(on_NtOpenThreadTokenEx_enter) || PPP_CHECK_CB(on_NtOpenThreadTokenEx_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1947,10 +2202,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtOpenThreadTokenEx_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtOpenThreadTokenEx_enter, rp.proc_id, pc, 127, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 128 NTSTATUS NtOpenTimer ['PHANDLE TimerHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
 case 128: {
+if (PPP_CHECK_CB(on_NtOpenTimer_enter) || PPP_CHECK_CB(on_NtOpenTimer_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1959,10 +2216,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtOpenTimer_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtOpenTimer_enter, rp.proc_id, pc, 128, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 129 NTSTATUS NtPlugPlayControl ['PLUGPLAY_CONTROL_CLASS PnPControlClass', ' PVOID PnPControlData', ' ULONG PnPControlDataLength']
 case 129: {
+if (PPP_CHECK_CB(on_NtPlugPlayControl_enter) || PPP_CHECK_CB(on_NtPlugPlayControl_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1971,10 +2230,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtPlugPlayControl_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtPlugPlayControl_enter, rp.proc_id, pc, 129, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 130 NTSTATUS NtPowerInformation ['POWER_INFORMATION_LEVEL InformationLevel', ' PVOID InputBuffer', ' ULONG InputBufferLength', ' PVOID OutputBuffer', ' ULONG OutputBufferLength']
 case 130: {
+if (PPP_CHECK_CB(on_NtPowerInformation_enter) || PPP_CHECK_CB(on_NtPowerInformation_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1987,10 +2248,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtPowerInformation_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtPowerInformation_enter, rp.proc_id, pc, 130, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 131 NTSTATUS NtPrivilegeCheck ['HANDLE ClientToken', ' PPRIVILEGE_SET RequiredPrivileges', ' PBOOLEAN Result']
 case 131: {
+if (PPP_CHECK_CB(on_NtPrivilegeCheck_enter) || PPP_CHECK_CB(on_NtPrivilegeCheck_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -1999,10 +2262,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtPrivilegeCheck_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtPrivilegeCheck_enter, rp.proc_id, pc, 131, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 132 NTSTATUS NtPrivilegeObjectAuditAlarm ['PUNICODE_STRING SubsystemName', ' PVOID HandleId', ' HANDLE ClientToken', ' ACCESS_MASK DesiredAccess', ' PPRIVILEGE_SET Privileges', ' BOOLEAN AccessGranted']
 case 132: {
+if (PPP_CHECK_CB(on_NtPrivilegeObjectAuditAlarm_enter) || PPP_CHECK_CB(on_NtPrivilegeObjectAuditAlarm_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2017,10 +2282,12 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtPrivilegeObjectAuditAlarm_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+PPP_RUN_CB_FILTERED(on_NtPrivilegeObjectAuditAlarm_enter, rp.proc_id, pc, 132, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 133 NTSTATUS NtPrivilegedServiceAuditAlarm ['PUNICODE_STRING SubsystemName', ' PUNICODE_STRING ServiceName', ' HANDLE ClientToken', ' PPRIVILEGE_SET Privileges', ' BOOLEAN AccessGranted']
 case 133: {
+if (PPP_CHECK_CB(on_NtPrivilegedServiceAuditAlarm_enter) || PPP_CHECK_CB(on_NtPrivilegedServiceAuditAlarm_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2033,10 +2300,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtPrivilegedServiceAuditAlarm_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtPrivilegedServiceAuditAlarm_enter, rp.proc_id, pc, 133, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 134 NTSTATUS NtProtectVirtualMemory ['HANDLE ProcessHandle', ' PVOID *BaseAddress', ' PSIZE_T RegionSize', ' WIN32_PROTECTION_MASK NewProtectWin32', ' PULONG OldProtect']
 case 134: {
+if (PPP_CHECK_CB(on_NtProtectVirtualMemory_enter) || PPP_CHECK_CB(on_NtProtectVirtualMemory_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2049,58 +2318,70 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtProtectVirtualMemory_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtProtectVirtualMemory_enter, rp.proc_id, pc, 134, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 135 NTSTATUS NtPulseEvent ['HANDLE EventHandle', ' PLONG PreviousState']
 case 135: {
+if (PPP_CHECK_CB(on_NtPulseEvent_enter) || PPP_CHECK_CB(on_NtPulseEvent_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtPulseEvent_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtPulseEvent_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtPulseEvent_enter, rp.proc_id, pc, 135, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 136 NTSTATUS NtQueryAttributesFile ['POBJECT_ATTRIBUTES ObjectAttributes', ' PFILE_BASIC_INFORMATION FileInformation']
 case 136: {
+if (PPP_CHECK_CB(on_NtQueryAttributesFile_enter) || PPP_CHECK_CB(on_NtQueryAttributesFile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtQueryAttributesFile_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryAttributesFile_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryAttributesFile_enter, rp.proc_id, pc, 136, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 137 NTSTATUS NtQueryDebugFilterState ['ULONG ComponentId', ' ULONG Level']
 case 137: {
+if (PPP_CHECK_CB(on_NtQueryDebugFilterState_enter) || PPP_CHECK_CB(on_NtQueryDebugFilterState_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtQueryDebugFilterState_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryDebugFilterState_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryDebugFilterState_enter, rp.proc_id, pc, 137, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 138 NTSTATUS NtQueryDefaultLocale ['BOOLEAN UserProfile', ' PLCID DefaultLocaleId']
 case 138: {
+if (PPP_CHECK_CB(on_NtQueryDefaultLocale_enter) || PPP_CHECK_CB(on_NtQueryDefaultLocale_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtQueryDefaultLocale_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryDefaultLocale_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryDefaultLocale_enter, rp.proc_id, pc, 138, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 139 NTSTATUS NtQueryDefaultUILanguage ['LANGID *DefaultUILanguageId']
 case 139: {
+if (PPP_CHECK_CB(on_NtQueryDefaultUILanguage_enter) || PPP_CHECK_CB(on_NtQueryDefaultUILanguage_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtQueryDefaultUILanguage_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryDefaultUILanguage_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryDefaultUILanguage_enter, rp.proc_id, pc, 139, env,pc,arg0) ; 
+}
 }; break;
 // 140 NTSTATUS NtQueryDirectoryFile ['HANDLE FileHandle', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID FileInformation', ' ULONG Length', ' FILE_INFORMATION_CLASS FileInformationClass', ' BOOLEAN ReturnSingleEntry', ' PUNICODE_STRING FileName', ' BOOLEAN RestartScan']
 case 140: {
+if (PPP_CHECK_CB(on_NtQueryDirectoryFile_enter) || PPP_CHECK_CB(on_NtQueryDirectoryFile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2125,10 +2406,12 @@ memcpy(rp.params[8], &arg8, sizeof(uint32_t));
 memcpy(rp.params[9], &arg9, sizeof(uint32_t));
 memcpy(rp.params[10], &arg10, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryDirectoryFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryDirectoryFile_enter, rp.proc_id, pc, 140, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10) ; 
+}
 }; break;
 // 141 NTSTATUS NtQueryDirectoryObject ['HANDLE DirectoryHandle', ' PVOID Buffer', ' ULONG Length', ' BOOLEAN ReturnSingleEntry', ' BOOLEAN RestartScan', ' PULONG Context', ' PULONG ReturnLength']
 case 141: {
+if (PPP_CHECK_CB(on_NtQueryDirectoryObject_enter) || PPP_CHECK_CB(on_NtQueryDirectoryObject_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2145,10 +2428,12 @@ memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 memcpy(rp.params[6], &arg6, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryDirectoryObject_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryDirectoryObject_enter, rp.proc_id, pc, 141, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
+}
 }; break;
 // 142 NTSTATUS NtQueryEaFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID Buffer', ' ULONG Length', ' BOOLEAN ReturnSingleEntry', ' PVOID EaList', ' ULONG EaListLength', ' PULONG EaIndex', ' BOOLEAN RestartScan']
 case 142: {
+if (PPP_CHECK_CB(on_NtQueryEaFile_enter) || PPP_CHECK_CB(on_NtQueryEaFile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2169,10 +2454,12 @@ memcpy(rp.params[6], &arg6, sizeof(uint32_t));
 memcpy(rp.params[7], &arg7, sizeof(uint32_t));
 memcpy(rp.params[8], &arg8, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryEaFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryEaFile_enter, rp.proc_id, pc, 142, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+}
 }; break;
 // 143 NTSTATUS NtQueryEvent ['HANDLE EventHandle', ' EVENT_INFORMATION_CLASS EventInformationClass', ' PVOID EventInformation', ' ULONG EventInformationLength', ' PULONG ReturnLength']
 case 143: {
+if (PPP_CHECK_CB(on_NtQueryEvent_enter) || PPP_CHECK_CB(on_NtQueryEvent_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2185,20 +2472,24 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryEvent_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryEvent_enter, rp.proc_id, pc, 143, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 144 NTSTATUS NtQueryFullAttributesFile ['POBJECT_ATTRIBUTES ObjectAttributes', ' PFILE_NETWORK_OPEN_INFORMATION FileInformation']
 case 144: {
+if (PPP_CHECK_CB(on_NtQueryFullAttributesFile_enter) || PPP_CHECK_CB(on_NtQueryFullAttributesFile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtQueryFullAttributesFile_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryFullAttributesFile_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryFullAttributesFile_enter, rp.proc_id, pc, 144, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 145 NTSTATUS NtQueryInformationAtom ['RTL_ATOM Atom', ' ATOM_INFORMATION_CLASS InformationClass', ' PVOID AtomInformation', ' ULONG AtomInformationLength', ' PULONG ReturnLength']
 case 145: {
+if (PPP_CHECK_CB(on_NtQueryInformationAtom_enter) || PPP_CHECK_CB(on_NtQueryInformationAtom_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2211,10 +2502,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryInformationAtom_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryInformationAtom_enter, rp.proc_id, pc, 145, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 146 NTSTATUS NtQueryInformationFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID FileInformation', ' ULONG Length', ' FILE_INFORMATION_CLASS FileInformationClass']
 case 146: {
+if (PPP_CHECK_CB(on_NtQueryInformationFile_enter) || PPP_CHECK_CB(on_NtQueryInformationFile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2227,10 +2520,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryInformationFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryInformationFile_enter, rp.proc_id, pc, 146, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 147 NTSTATUS NtQueryInformationJobObject ['HANDLE JobHandle', ' JOBOBJECTINFOCLASS JobObjectInformationClass', ' PVOID JobObjectInformation', ' ULONG JobObjectInformationLength', ' PULONG ReturnLength']
 case 147: {
+if (PPP_CHECK_CB(on_NtQueryInformationJobObject_enter) || PPP_CHECK_CB(on_NtQueryInformationJobObject_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2243,10 +2538,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryInformationJobObject_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryInformationJobObject_enter, rp.proc_id, pc, 147, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 148 NTSTATUS NtQueryInformationPort ['HANDLE PortHandle', ' PORT_INFORMATION_CLASS PortInformationClass', ' PVOID PortInformation', ' ULONG Length', ' PULONG ReturnLength']
 case 148: {
+if (PPP_CHECK_CB(on_NtQueryInformationPort_enter) || PPP_CHECK_CB(on_NtQueryInformationPort_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2259,10 +2556,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryInformationPort_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryInformationPort_enter, rp.proc_id, pc, 148, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 149 NTSTATUS NtQueryInformationProcess ['HANDLE ProcessHandle', ' PROCESSINFOCLASS ProcessInformationClass', ' PVOID ProcessInformation', ' ULONG ProcessInformationLength', ' PULONG ReturnLength']
 case 149: {
+if (PPP_CHECK_CB(on_NtQueryInformationProcess_enter) || PPP_CHECK_CB(on_NtQueryInformationProcess_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2275,10 +2574,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryInformationProcess_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryInformationProcess_enter, rp.proc_id, pc, 149, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 150 NTSTATUS NtQueryInformationThread ['HANDLE ThreadHandle', ' THREADINFOCLASS ThreadInformationClass', ' PVOID ThreadInformation', ' ULONG ThreadInformationLength', ' PULONG ReturnLength']
 case 150: {
+if (PPP_CHECK_CB(on_NtQueryInformationThread_enter) || PPP_CHECK_CB(on_NtQueryInformationThread_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2291,10 +2592,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryInformationThread_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryInformationThread_enter, rp.proc_id, pc, 150, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 151 NTSTATUS NtQueryInformationToken ['HANDLE TokenHandle', ' TOKEN_INFORMATION_CLASS TokenInformationClass', ' PVOID TokenInformation', ' ULONG TokenInformationLength', ' PULONG ReturnLength']
 case 151: {
+if (PPP_CHECK_CB(on_NtQueryInformationToken_enter) || PPP_CHECK_CB(on_NtQueryInformationToken_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2307,28 +2610,34 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryInformationToken_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryInformationToken_enter, rp.proc_id, pc, 151, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 152 NTSTATUS NtQueryInstallUILanguage ['LANGID *InstallUILanguageId']
 case 152: {
+if (PPP_CHECK_CB(on_NtQueryInstallUILanguage_enter) || PPP_CHECK_CB(on_NtQueryInstallUILanguage_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtQueryInstallUILanguage_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryInstallUILanguage_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryInstallUILanguage_enter, rp.proc_id, pc, 152, env,pc,arg0) ; 
+}
 }; break;
 // 153 NTSTATUS NtQueryIntervalProfile ['KPROFILE_SOURCE ProfileSource', ' PULONG Interval']
 case 153: {
+if (PPP_CHECK_CB(on_NtQueryIntervalProfile_enter) || PPP_CHECK_CB(on_NtQueryIntervalProfile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtQueryIntervalProfile_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryIntervalProfile_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryIntervalProfile_enter, rp.proc_id, pc, 153, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 154 NTSTATUS NtQueryIoCompletion ['HANDLE IoCompletionHandle', ' IO_COMPLETION_INFORMATION_CLASS IoCompletionInformationClass', ' PVOID IoCompletionInformation', ' ULONG IoCompletionInformationLength', ' PULONG ReturnLength']
 case 154: {
+if (PPP_CHECK_CB(on_NtQueryIoCompletion_enter) || PPP_CHECK_CB(on_NtQueryIoCompletion_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2341,10 +2650,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryIoCompletion_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryIoCompletion_enter, rp.proc_id, pc, 154, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 155 NTSTATUS NtQueryKey ['HANDLE KeyHandle', ' KEY_INFORMATION_CLASS KeyInformationClass', ' PVOID KeyInformation', ' ULONG Length', ' PULONG ResultLength']
 case 155: {
+if (PPP_CHECK_CB(on_NtQueryKey_enter) || PPP_CHECK_CB(on_NtQueryKey_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2357,10 +2668,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryKey_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryKey_enter, rp.proc_id, pc, 155, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 156 NTSTATUS NtQueryMultipleValueKey ['HANDLE KeyHandle', ' PKEY_VALUE_ENTRY ValueEntries', ' ULONG EntryCount', ' PVOID ValueBuffer', ' PULONG BufferLength', ' PULONG RequiredBufferLength']
 case 156: {
+if (PPP_CHECK_CB(on_NtQueryMultipleValueKey_enter) || PPP_CHECK_CB(on_NtQueryMultipleValueKey_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2375,10 +2688,12 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryMultipleValueKey_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryMultipleValueKey_enter, rp.proc_id, pc, 156, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 157 NTSTATUS NtQueryMutant ['HANDLE MutantHandle', ' MUTANT_INFORMATION_CLASS MutantInformationClass', ' PVOID MutantInformation', ' ULONG MutantInformationLength', ' PULONG ReturnLength']
 case 157: {
+if (PPP_CHECK_CB(on_NtQueryMutant_enter) || PPP_CHECK_CB(on_NtQueryMutant_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2391,10 +2706,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryMutant_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryMutant_enter, rp.proc_id, pc, 157, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 158 NTSTATUS NtQueryObject ['HANDLE Handle', ' OBJECT_INFORMATION_CLASS ObjectInformationClass', ' PVOID ObjectInformation', ' ULONG ObjectInformationLength', ' PULONG ReturnLength']
 case 158: {
+if (PPP_CHECK_CB(on_NtQueryObject_enter) || PPP_CHECK_CB(on_NtQueryObject_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2407,30 +2724,36 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryObject_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryObject_enter, rp.proc_id, pc, 158, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 159 NTSTATUS NtQueryOpenSubKeys ['POBJECT_ATTRIBUTES TargetKey', ' PULONG HandleCount']
 case 159: {
+if (PPP_CHECK_CB(on_NtQueryOpenSubKeys_enter) || PPP_CHECK_CB(on_NtQueryOpenSubKeys_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtQueryOpenSubKeys_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryOpenSubKeys_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryOpenSubKeys_enter, rp.proc_id, pc, 159, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 160 NTSTATUS NtQueryPerformanceCounter ['PLARGE_INTEGER PerformanceCounter', ' PLARGE_INTEGER PerformanceFrequency']
 case 160: {
+if (PPP_CHECK_CB(on_NtQueryPerformanceCounter_enter) || PPP_CHECK_CB(on_NtQueryPerformanceCounter_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtQueryPerformanceCounter_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryPerformanceCounter_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryPerformanceCounter_enter, rp.proc_id, pc, 160, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 161 NTSTATUS NtQueryQuotaInformationFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID Buffer', ' ULONG Length', ' BOOLEAN ReturnSingleEntry', ' PVOID SidList', ' ULONG SidListLength', ' PULONG StartSid', ' BOOLEAN RestartScan']
 case 161: {
+if (PPP_CHECK_CB(on_NtQueryQuotaInformationFile_enter) || PPP_CHECK_CB(on_NtQueryQuotaInformationFile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2451,10 +2774,12 @@ memcpy(rp.params[6], &arg6, sizeof(uint32_t));
 memcpy(rp.params[7], &arg7, sizeof(uint32_t));
 memcpy(rp.params[8], &arg8, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryQuotaInformationFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryQuotaInformationFile_enter, rp.proc_id, pc, 161, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+}
 }; break;
 // 162 NTSTATUS NtQuerySection ['HANDLE SectionHandle', ' SECTION_INFORMATION_CLASS SectionInformationClass', ' PVOID SectionInformation', ' SIZE_T SectionInformationLength', ' PSIZE_T ReturnLength']
 case 162: {
+if (PPP_CHECK_CB(on_NtQuerySection_enter) || PPP_CHECK_CB(on_NtQuerySection_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2467,10 +2792,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQuerySection_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtQuerySection_enter, rp.proc_id, pc, 162, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 163 NTSTATUS NtQuerySecurityObject ['HANDLE Handle', ' SECURITY_INFORMATION SecurityInformation', ' PSECURITY_DESCRIPTOR SecurityDescriptor', ' ULONG Length', ' PULONG LengthNeeded']
 case 163: {
+if (PPP_CHECK_CB(on_NtQuerySecurityObject_enter) || PPP_CHECK_CB(on_NtQuerySecurityObject_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2483,10 +2810,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQuerySecurityObject_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtQuerySecurityObject_enter, rp.proc_id, pc, 163, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 164 NTSTATUS NtQuerySemaphore ['HANDLE SemaphoreHandle', ' SEMAPHORE_INFORMATION_CLASS SemaphoreInformationClass', ' PVOID SemaphoreInformation', ' ULONG SemaphoreInformationLength', ' PULONG ReturnLength']
 case 164: {
+if (PPP_CHECK_CB(on_NtQuerySemaphore_enter) || PPP_CHECK_CB(on_NtQuerySemaphore_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2499,10 +2828,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQuerySemaphore_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtQuerySemaphore_enter, rp.proc_id, pc, 164, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 165 NTSTATUS NtQuerySymbolicLinkObject ['HANDLE LinkHandle', ' PUNICODE_STRING LinkTarget', ' PULONG ReturnedLength']
 case 165: {
+if (PPP_CHECK_CB(on_NtQuerySymbolicLinkObject_enter) || PPP_CHECK_CB(on_NtQuerySymbolicLinkObject_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2511,10 +2842,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQuerySymbolicLinkObject_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtQuerySymbolicLinkObject_enter, rp.proc_id, pc, 165, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 166 NTSTATUS NtQuerySystemEnvironmentValue ['PUNICODE_STRING VariableName', ' PWSTR VariableValue', ' USHORT ValueLength', ' PUSHORT ReturnLength']
 case 166: {
+if (PPP_CHECK_CB(on_NtQuerySystemEnvironmentValue_enter) || PPP_CHECK_CB(on_NtQuerySystemEnvironmentValue_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2525,10 +2858,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQuerySystemEnvironmentValue_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtQuerySystemEnvironmentValue_enter, rp.proc_id, pc, 166, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 167 NTSTATUS NtQuerySystemEnvironmentValueEx ['PUNICODE_STRING VariableName', ' LPGUID VendorGuid', ' PVOID Value', ' PULONG ValueLength', ' PULONG Attributes']
 case 167: {
+if (PPP_CHECK_CB(on_NtQuerySystemEnvironmentValueEx_enter) || PPP_CHECK_CB(on_NtQuerySystemEnvironmentValueEx_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2541,10 +2876,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQuerySystemEnvironmentValueEx_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtQuerySystemEnvironmentValueEx_enter, rp.proc_id, pc, 167, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 168 NTSTATUS NtQuerySystemInformation ['SYSTEM_INFORMATION_CLASS SystemInformationClass', ' PVOID SystemInformation', ' ULONG SystemInformationLength', ' PULONG ReturnLength']
 case 168: {
+if (PPP_CHECK_CB(on_NtQuerySystemInformation_enter) || PPP_CHECK_CB(on_NtQuerySystemInformation_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2555,18 +2892,22 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQuerySystemInformation_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtQuerySystemInformation_enter, rp.proc_id, pc, 168, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 169 NTSTATUS NtQuerySystemTime ['PLARGE_INTEGER SystemTime']
 case 169: {
+if (PPP_CHECK_CB(on_NtQuerySystemTime_enter) || PPP_CHECK_CB(on_NtQuerySystemTime_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtQuerySystemTime_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQuerySystemTime_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtQuerySystemTime_enter, rp.proc_id, pc, 169, env,pc,arg0) ; 
+}
 }; break;
 // 170 NTSTATUS NtQueryTimer ['HANDLE TimerHandle', ' TIMER_INFORMATION_CLASS TimerInformationClass', ' PVOID TimerInformation', ' ULONG TimerInformationLength', ' PULONG ReturnLength']
 case 170: {
+if (PPP_CHECK_CB(on_NtQueryTimer_enter) || PPP_CHECK_CB(on_NtQueryTimer_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2579,10 +2920,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryTimer_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryTimer_enter, rp.proc_id, pc, 170, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 171 NTSTATUS NtQueryTimerResolution ['PULONG MaximumTime', ' PULONG MinimumTime', ' PULONG CurrentTime']
 case 171: {
+if (PPP_CHECK_CB(on_NtQueryTimerResolution_enter) || PPP_CHECK_CB(on_NtQueryTimerResolution_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2591,10 +2934,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryTimerResolution_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryTimerResolution_enter, rp.proc_id, pc, 171, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 172 NTSTATUS NtQueryValueKey ['HANDLE KeyHandle', ' PUNICODE_STRING ValueName', ' KEY_VALUE_INFORMATION_CLASS KeyValueInformationClass', ' PVOID KeyValueInformation', ' ULONG Length', ' PULONG ResultLength']
 case 172: {
+if (PPP_CHECK_CB(on_NtQueryValueKey_enter) || PPP_CHECK_CB(on_NtQueryValueKey_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2609,10 +2954,12 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryValueKey_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryValueKey_enter, rp.proc_id, pc, 172, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 173 NTSTATUS NtQueryVirtualMemory ['HANDLE ProcessHandle', ' PVOID BaseAddress', ' MEMORY_INFORMATION_CLASS MemoryInformationClass', ' PVOID MemoryInformation', ' SIZE_T MemoryInformationLength', ' PSIZE_T ReturnLength']
 case 173: {
+if (PPP_CHECK_CB(on_NtQueryVirtualMemory_enter) || PPP_CHECK_CB(on_NtQueryVirtualMemory_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2627,10 +2974,12 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryVirtualMemory_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryVirtualMemory_enter, rp.proc_id, pc, 173, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 174 NTSTATUS NtQueryVolumeInformationFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID FsInformation', ' ULONG Length', ' FS_INFORMATION_CLASS FsInformationClass']
 case 174: {
+if (PPP_CHECK_CB(on_NtQueryVolumeInformationFile_enter) || PPP_CHECK_CB(on_NtQueryVolumeInformationFile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2643,10 +2992,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueryVolumeInformationFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryVolumeInformationFile_enter, rp.proc_id, pc, 174, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 175 NTSTATUS NtQueueApcThread ['HANDLE ThreadHandle', ' PPS_APC_ROUTINE ApcRoutine', ' PVOID ApcArgument1', ' PVOID ApcArgument2', ' PVOID ApcArgument3']
 case 175: {
+if (PPP_CHECK_CB(on_NtQueueApcThread_enter) || PPP_CHECK_CB(on_NtQueueApcThread_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2659,10 +3010,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtQueueApcThread_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtQueueApcThread_enter, rp.proc_id, pc, 175, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 176 NTSTATUS NtRaiseException ['PEXCEPTION_RECORD ExceptionRecord', ' PCONTEXT ContextRecord', ' BOOLEAN FirstChance']
 case 176: {
+if (PPP_CHECK_CB(on_NtRaiseException_enter) || PPP_CHECK_CB(on_NtRaiseException_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2671,10 +3024,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtRaiseException_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtRaiseException_enter, rp.proc_id, pc, 176, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 177 NTSTATUS NtRaiseHardError ['NTSTATUS ErrorStatus', ' ULONG NumberOfParameters', ' ULONG UnicodeStringParameterMask', ' PULONG_PTR Parameters', ' ULONG ValidResponseOptions', ' PULONG Response']
 case 177: {
+if (PPP_CHECK_CB(on_NtRaiseHardError_enter) || PPP_CHECK_CB(on_NtRaiseHardError_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2689,10 +3044,12 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtRaiseHardError_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+PPP_RUN_CB_FILTERED(on_NtRaiseHardError_enter, rp.proc_id, pc, 177, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 178 NTSTATUS NtReadFile ['HANDLE FileHandle', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID Buffer', ' ULONG Length', ' PLARGE_INTEGER ByteOffset', ' PULONG Key']
 case 178: {
+if (PPP_CHECK_CB(on_NtReadFile_enter) || PPP_CHECK_CB(on_NtReadFile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2713,10 +3070,12 @@ memcpy(rp.params[6], &arg6, sizeof(uint32_t));
 memcpy(rp.params[7], &arg7, sizeof(uint32_t));
 memcpy(rp.params[8], &arg8, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtReadFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+PPP_RUN_CB_FILTERED(on_NtReadFile_enter, rp.proc_id, pc, 178, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+}
 }; break;
 // 179 NTSTATUS NtReadFileScatter ['HANDLE FileHandle', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' PFILE_SEGMENT_ELEMENT SegmentArray', ' ULONG Length', ' PLARGE_INTEGER ByteOffset', ' PULONG Key']
 case 179: {
+if (PPP_CHECK_CB(on_NtReadFileScatter_enter) || PPP_CHECK_CB(on_NtReadFileScatter_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2737,10 +3096,12 @@ memcpy(rp.params[6], &arg6, sizeof(uint32_t));
 memcpy(rp.params[7], &arg7, sizeof(uint32_t));
 memcpy(rp.params[8], &arg8, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtReadFileScatter_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+PPP_RUN_CB_FILTERED(on_NtReadFileScatter_enter, rp.proc_id, pc, 179, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+}
 }; break;
 // 180 NTSTATUS NtReadRequestData ['HANDLE PortHandle', ' PPORT_MESSAGE Message', ' ULONG DataEntryIndex', ' PVOID Buffer', ' SIZE_T BufferSize', ' PSIZE_T NumberOfBytesRead']
 case 180: {
+if (PPP_CHECK_CB(on_NtReadRequestData_enter) || PPP_CHECK_CB(on_NtReadRequestData_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2755,10 +3116,12 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtReadRequestData_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+PPP_RUN_CB_FILTERED(on_NtReadRequestData_enter, rp.proc_id, pc, 180, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 181 NTSTATUS NtReadVirtualMemory ['HANDLE ProcessHandle', ' PVOID BaseAddress', ' PVOID Buffer', ' SIZE_T BufferSize', ' PSIZE_T NumberOfBytesRead']
 case 181: {
+if (PPP_CHECK_CB(on_NtReadVirtualMemory_enter) || PPP_CHECK_CB(on_NtReadVirtualMemory_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2771,28 +3134,34 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtReadVirtualMemory_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtReadVirtualMemory_enter, rp.proc_id, pc, 181, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 182 NTSTATUS NtRegisterThreadTerminatePort ['HANDLE PortHandle']
 case 182: {
+if (PPP_CHECK_CB(on_NtRegisterThreadTerminatePort_enter) || PPP_CHECK_CB(on_NtRegisterThreadTerminatePort_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtRegisterThreadTerminatePort_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtRegisterThreadTerminatePort_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtRegisterThreadTerminatePort_enter, rp.proc_id, pc, 182, env,pc,arg0) ; 
+}
 }; break;
 // 183 NTSTATUS NtReleaseMutant ['HANDLE MutantHandle', ' PLONG PreviousCount']
 case 183: {
+if (PPP_CHECK_CB(on_NtReleaseMutant_enter) || PPP_CHECK_CB(on_NtReleaseMutant_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtReleaseMutant_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtReleaseMutant_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtReleaseMutant_enter, rp.proc_id, pc, 183, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 184 NTSTATUS NtReleaseSemaphore ['HANDLE SemaphoreHandle', ' LONG ReleaseCount', ' PLONG PreviousCount']
 case 184: {
+if (PPP_CHECK_CB(on_NtReleaseSemaphore_enter) || PPP_CHECK_CB(on_NtReleaseSemaphore_return)) {
 uint32_t arg0 = get_32(env, 0);
 int32_t arg1 = get_s32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2801,10 +3170,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(int32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtReleaseSemaphore_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtReleaseSemaphore_enter, rp.proc_id, pc, 184, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 185 NTSTATUS NtRemoveIoCompletion ['HANDLE IoCompletionHandle', ' PVOID *KeyContext', ' PVOID *ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' PLARGE_INTEGER Timeout']
 case 185: {
+if (PPP_CHECK_CB(on_NtRemoveIoCompletion_enter) || PPP_CHECK_CB(on_NtRemoveIoCompletion_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2817,30 +3188,36 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtRemoveIoCompletion_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtRemoveIoCompletion_enter, rp.proc_id, pc, 185, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 186 NTSTATUS NtRemoveProcessDebug ['HANDLE ProcessHandle', ' HANDLE DebugObjectHandle']
 case 186: {
+if (PPP_CHECK_CB(on_NtRemoveProcessDebug_enter) || PPP_CHECK_CB(on_NtRemoveProcessDebug_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtRemoveProcessDebug_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtRemoveProcessDebug_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtRemoveProcessDebug_enter, rp.proc_id, pc, 186, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 187 NTSTATUS NtRenameKey ['HANDLE KeyHandle', ' PUNICODE_STRING NewName']
 case 187: {
+if (PPP_CHECK_CB(on_NtRenameKey_enter) || PPP_CHECK_CB(on_NtRenameKey_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtRenameKey_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtRenameKey_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtRenameKey_enter, rp.proc_id, pc, 187, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 188 NTSTATUS NtReplaceKey ['POBJECT_ATTRIBUTES NewFile', ' HANDLE TargetHandle', ' POBJECT_ATTRIBUTES OldFile']
 case 188: {
+if (PPP_CHECK_CB(on_NtReplaceKey_enter) || PPP_CHECK_CB(on_NtReplaceKey_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2849,20 +3226,24 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtReplaceKey_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtReplaceKey_enter, rp.proc_id, pc, 188, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 189 NTSTATUS NtReplyPort ['HANDLE PortHandle', ' PPORT_MESSAGE ReplyMessage']
 case 189: {
+if (PPP_CHECK_CB(on_NtReplyPort_enter) || PPP_CHECK_CB(on_NtReplyPort_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtReplyPort_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtReplyPort_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtReplyPort_enter, rp.proc_id, pc, 189, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 190 NTSTATUS NtReplyWaitReceivePort ['HANDLE PortHandle', ' PVOID *PortContext ', ' PPORT_MESSAGE ReplyMessage', ' PPORT_MESSAGE ReceiveMessage']
 case 190: {
+if (PPP_CHECK_CB(on_NtReplyWaitReceivePort_enter) || PPP_CHECK_CB(on_NtReplyWaitReceivePort_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2873,10 +3254,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtReplyWaitReceivePort_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtReplyWaitReceivePort_enter, rp.proc_id, pc, 190, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 191 NTSTATUS NtReplyWaitReceivePortEx ['HANDLE PortHandle', ' PVOID *PortContext', ' PPORT_MESSAGE ReplyMessage', ' PPORT_MESSAGE ReceiveMessage', ' PLARGE_INTEGER Timeout']
 case 191: {
+if (PPP_CHECK_CB(on_NtReplyWaitReceivePortEx_enter) || PPP_CHECK_CB(on_NtReplyWaitReceivePortEx_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2889,30 +3272,36 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtReplyWaitReceivePortEx_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtReplyWaitReceivePortEx_enter, rp.proc_id, pc, 191, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 192 NTSTATUS NtReplyWaitReplyPort ['HANDLE PortHandle', ' PPORT_MESSAGE ReplyMessage']
 case 192: {
+if (PPP_CHECK_CB(on_NtReplyWaitReplyPort_enter) || PPP_CHECK_CB(on_NtReplyWaitReplyPort_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtReplyWaitReplyPort_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtReplyWaitReplyPort_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtReplyWaitReplyPort_enter, rp.proc_id, pc, 192, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 194 NTSTATUS NtRequestPort ['HANDLE PortHandle', ' PPORT_MESSAGE RequestMessage']
 case 194: {
+if (PPP_CHECK_CB(on_NtRequestPort_enter) || PPP_CHECK_CB(on_NtRequestPort_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtRequestPort_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtRequestPort_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtRequestPort_enter, rp.proc_id, pc, 194, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 195 NTSTATUS NtRequestWaitReplyPort ['HANDLE PortHandle', ' PPORT_MESSAGE RequestMessage', ' PPORT_MESSAGE ReplyMessage']
 case 195: {
+if (PPP_CHECK_CB(on_NtRequestWaitReplyPort_enter) || PPP_CHECK_CB(on_NtRequestWaitReplyPort_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2921,20 +3310,24 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtRequestWaitReplyPort_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtRequestWaitReplyPort_enter, rp.proc_id, pc, 195, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 197 NTSTATUS NtResetEvent ['HANDLE EventHandle', ' PLONG PreviousState']
 case 197: {
+if (PPP_CHECK_CB(on_NtResetEvent_enter) || PPP_CHECK_CB(on_NtResetEvent_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtResetEvent_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtResetEvent_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtResetEvent_enter, rp.proc_id, pc, 197, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 198 NTSTATUS NtResetWriteWatch ['HANDLE ProcessHandle', ' PVOID BaseAddress', ' SIZE_T RegionSize']
 case 198: {
+if (PPP_CHECK_CB(on_NtResetWriteWatch_enter) || PPP_CHECK_CB(on_NtResetWriteWatch_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2943,10 +3336,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtResetWriteWatch_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtResetWriteWatch_enter, rp.proc_id, pc, 198, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 199 NTSTATUS NtRestoreKey ['HANDLE KeyHandle', ' HANDLE FileHandle', ' ULONG Flags']
 case 199: {
+if (PPP_CHECK_CB(on_NtRestoreKey_enter) || PPP_CHECK_CB(on_NtRestoreKey_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2955,38 +3350,46 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtRestoreKey_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtRestoreKey_enter, rp.proc_id, pc, 199, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 200 NTSTATUS NtResumeProcess ['HANDLE ProcessHandle']
 case 200: {
+if (PPP_CHECK_CB(on_NtResumeProcess_enter) || PPP_CHECK_CB(on_NtResumeProcess_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtResumeProcess_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtResumeProcess_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtResumeProcess_enter, rp.proc_id, pc, 200, env,pc,arg0) ; 
+}
 }; break;
 // 201 NTSTATUS NtResumeThread ['HANDLE ThreadHandle', ' PULONG PreviousSuspendCount']
 case 201: {
+if (PPP_CHECK_CB(on_NtResumeThread_enter) || PPP_CHECK_CB(on_NtResumeThread_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtResumeThread_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtResumeThread_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtResumeThread_enter, rp.proc_id, pc, 201, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 202 NTSTATUS NtSaveKey ['HANDLE KeyHandle', ' HANDLE FileHandle']
 case 202: {
+if (PPP_CHECK_CB(on_NtSaveKey_enter) || PPP_CHECK_CB(on_NtSaveKey_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtSaveKey_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSaveKey_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtSaveKey_enter, rp.proc_id, pc, 202, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 203 NTSTATUS NtSaveKeyEx ['HANDLE KeyHandle', ' HANDLE FileHandle', ' ULONG Format']
 case 203: {
+if (PPP_CHECK_CB(on_NtSaveKeyEx_enter) || PPP_CHECK_CB(on_NtSaveKeyEx_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -2995,10 +3398,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSaveKeyEx_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtSaveKeyEx_enter, rp.proc_id, pc, 203, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 204 NTSTATUS NtSaveMergedKeys ['HANDLE HighPrecedenceKeyHandle', ' HANDLE LowPrecedenceKeyHandle', ' HANDLE FileHandle']
 case 204: {
+if (PPP_CHECK_CB(on_NtSaveMergedKeys_enter) || PPP_CHECK_CB(on_NtSaveMergedKeys_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3007,10 +3412,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSaveMergedKeys_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtSaveMergedKeys_enter, rp.proc_id, pc, 204, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 205 NTSTATUS NtSecureConnectPort ['PHANDLE PortHandle', ' PUNICODE_STRING PortName', ' PSECURITY_QUALITY_OF_SERVICE SecurityQos', ' PPORT_VIEW ClientView', ' PSID RequiredServerSid', ' PREMOTE_PORT_VIEW ServerView', ' PULONG MaxMessageLength', ' PVOID ConnectionInformation', ' PULONG ConnectionInformationLength']
 case 205: {
+if (PPP_CHECK_CB(on_NtSecureConnectPort_enter) || PPP_CHECK_CB(on_NtSecureConnectPort_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3031,20 +3438,24 @@ memcpy(rp.params[6], &arg6, sizeof(uint32_t));
 memcpy(rp.params[7], &arg7, sizeof(uint32_t));
 memcpy(rp.params[8], &arg8, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSecureConnectPort_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+PPP_RUN_CB_FILTERED(on_NtSecureConnectPort_enter, rp.proc_id, pc, 205, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+}
 }; break;
 // 206 NTSTATUS NtSetContextThread ['HANDLE ThreadHandle', ' PCONTEXT ThreadContext']
 case 206: {
+if (PPP_CHECK_CB(on_NtSetContextThread_enter) || PPP_CHECK_CB(on_NtSetContextThread_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtSetContextThread_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetContextThread_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtSetContextThread_enter, rp.proc_id, pc, 206, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 207 NTSTATUS NtSetDebugFilterState ['ULONG ComponentId', ' ULONG Level', ' BOOLEAN State']
 case 207: {
+if (PPP_CHECK_CB(on_NtSetDebugFilterState_enter) || PPP_CHECK_CB(on_NtSetDebugFilterState_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3053,36 +3464,44 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetDebugFilterState_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtSetDebugFilterState_enter, rp.proc_id, pc, 207, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 208 NTSTATUS NtSetDefaultHardErrorPort ['HANDLE DefaultHardErrorPort']
 case 208: {
+if (PPP_CHECK_CB(on_NtSetDefaultHardErrorPort_enter) || PPP_CHECK_CB(on_NtSetDefaultHardErrorPort_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtSetDefaultHardErrorPort_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetDefaultHardErrorPort_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtSetDefaultHardErrorPort_enter, rp.proc_id, pc, 208, env,pc,arg0) ; 
+}
 }; break;
 // 209 NTSTATUS NtSetDefaultLocale ['BOOLEAN UserProfile', ' LCID DefaultLocaleId']
 case 209: {
+if (PPP_CHECK_CB(on_NtSetDefaultLocale_enter) || PPP_CHECK_CB(on_NtSetDefaultLocale_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtSetDefaultLocale_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetDefaultLocale_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtSetDefaultLocale_enter, rp.proc_id, pc, 209, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 210 NTSTATUS NtSetDefaultUILanguage ['LANGID DefaultUILanguageId']
 case 210: {
+if (PPP_CHECK_CB(on_NtSetDefaultUILanguage_enter) || PPP_CHECK_CB(on_NtSetDefaultUILanguage_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtSetDefaultUILanguage_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetDefaultUILanguage_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtSetDefaultUILanguage_enter, rp.proc_id, pc, 210, env,pc,arg0) ; 
+}
 }; break;
 // 211 NTSTATUS NtSetEaFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID Buffer', ' ULONG Length']
 case 211: {
+if (PPP_CHECK_CB(on_NtSetEaFile_enter) || PPP_CHECK_CB(on_NtSetEaFile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3093,44 +3512,54 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetEaFile_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtSetEaFile_enter, rp.proc_id, pc, 211, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 212 NTSTATUS NtSetEvent ['HANDLE EventHandle', ' PLONG PreviousState']
 case 212: {
+if (PPP_CHECK_CB(on_NtSetEvent_enter) || PPP_CHECK_CB(on_NtSetEvent_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtSetEvent_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetEvent_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtSetEvent_enter, rp.proc_id, pc, 212, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 213 NTSTATUS NtSetEventBoostPriority ['HANDLE EventHandle']
 case 213: {
+if (PPP_CHECK_CB(on_NtSetEventBoostPriority_enter) || PPP_CHECK_CB(on_NtSetEventBoostPriority_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtSetEventBoostPriority_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetEventBoostPriority_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtSetEventBoostPriority_enter, rp.proc_id, pc, 213, env,pc,arg0) ; 
+}
 }; break;
 // 214 NTSTATUS NtSetHighEventPair ['HANDLE EventPairHandle']
 case 214: {
+if (PPP_CHECK_CB(on_NtSetHighEventPair_enter) || PPP_CHECK_CB(on_NtSetHighEventPair_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtSetHighEventPair_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetHighEventPair_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtSetHighEventPair_enter, rp.proc_id, pc, 214, env,pc,arg0) ; 
+}
 }; break;
 // 215 NTSTATUS NtSetHighWaitLowEventPair ['HANDLE EventPairHandle']
 case 215: {
+if (PPP_CHECK_CB(on_NtSetHighWaitLowEventPair_enter) || PPP_CHECK_CB(on_NtSetHighWaitLowEventPair_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtSetHighWaitLowEventPair_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetHighWaitLowEventPair_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtSetHighWaitLowEventPair_enter, rp.proc_id, pc, 215, env,pc,arg0) ; 
+}
 }; break;
 // 216 NTSTATUS NtSetInformationDebugObject ['HANDLE DebugObjectHandle', ' DEBUGOBJECTINFOCLASS DebugObjectInformationClass', ' PVOID DebugInformation', ' ULONG DebugInformationLength', ' PULONG ReturnLength']
 case 216: {
+if (PPP_CHECK_CB(on_NtSetInformationDebugObject_enter) || PPP_CHECK_CB(on_NtSetInformationDebugObject_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3143,10 +3572,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetInformationDebugObject_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtSetInformationDebugObject_enter, rp.proc_id, pc, 216, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 217 NTSTATUS NtSetInformationFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID FileInformation', ' ULONG Length', ' FILE_INFORMATION_CLASS FileInformationClass']
 case 217: {
+if (PPP_CHECK_CB(on_NtSetInformationFile_enter) || PPP_CHECK_CB(on_NtSetInformationFile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3159,10 +3590,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetInformationFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtSetInformationFile_enter, rp.proc_id, pc, 217, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 218 NTSTATUS NtSetInformationJobObject ['HANDLE JobHandle', ' JOBOBJECTINFOCLASS JobObjectInformationClass', ' PVOID JobObjectInformation', ' ULONG JobObjectInformationLength']
 case 218: {
+if (PPP_CHECK_CB(on_NtSetInformationJobObject_enter) || PPP_CHECK_CB(on_NtSetInformationJobObject_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3173,10 +3606,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetInformationJobObject_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtSetInformationJobObject_enter, rp.proc_id, pc, 218, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 219 NTSTATUS NtSetInformationKey ['HANDLE KeyHandle', ' KEY_SET_INFORMATION_CLASS KeySetInformationClass', ' PVOID KeySetInformation', ' ULONG KeySetInformationLength']
 case 219: {
+if (PPP_CHECK_CB(on_NtSetInformationKey_enter) || PPP_CHECK_CB(on_NtSetInformationKey_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3187,10 +3622,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetInformationKey_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtSetInformationKey_enter, rp.proc_id, pc, 219, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 220 NTSTATUS NtSetInformationObject ['HANDLE Handle', ' OBJECT_INFORMATION_CLASS ObjectInformationClass', ' PVOID ObjectInformation', ' ULONG ObjectInformationLength']
 case 220: {
+if (PPP_CHECK_CB(on_NtSetInformationObject_enter) || PPP_CHECK_CB(on_NtSetInformationObject_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3201,10 +3638,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetInformationObject_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtSetInformationObject_enter, rp.proc_id, pc, 220, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 221 NTSTATUS NtSetInformationProcess ['HANDLE ProcessHandle', ' PROCESSINFOCLASS ProcessInformationClass', ' PVOID ProcessInformation', ' ULONG ProcessInformationLength']
 case 221: {
+if (PPP_CHECK_CB(on_NtSetInformationProcess_enter) || PPP_CHECK_CB(on_NtSetInformationProcess_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3215,10 +3654,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetInformationProcess_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtSetInformationProcess_enter, rp.proc_id, pc, 221, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 222 NTSTATUS NtSetInformationThread ['HANDLE ThreadHandle', ' THREADINFOCLASS ThreadInformationClass', ' PVOID ThreadInformation', ' ULONG ThreadInformationLength']
 case 222: {
+if (PPP_CHECK_CB(on_NtSetInformationThread_enter) || PPP_CHECK_CB(on_NtSetInformationThread_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3229,10 +3670,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetInformationThread_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtSetInformationThread_enter, rp.proc_id, pc, 222, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 223 NTSTATUS NtSetInformationToken ['HANDLE TokenHandle', ' TOKEN_INFORMATION_CLASS TokenInformationClass', ' PVOID TokenInformation', ' ULONG TokenInformationLength']
 case 223: {
+if (PPP_CHECK_CB(on_NtSetInformationToken_enter) || PPP_CHECK_CB(on_NtSetInformationToken_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3243,20 +3686,24 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetInformationToken_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtSetInformationToken_enter, rp.proc_id, pc, 223, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 224 NTSTATUS NtSetIntervalProfile ['ULONG Interval', ' KPROFILE_SOURCE Source']
 case 224: {
+if (PPP_CHECK_CB(on_NtSetIntervalProfile_enter) || PPP_CHECK_CB(on_NtSetIntervalProfile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtSetIntervalProfile_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetIntervalProfile_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtSetIntervalProfile_enter, rp.proc_id, pc, 224, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 225 NTSTATUS NtSetIoCompletion ['HANDLE IoCompletionHandle', ' PVOID KeyContext', ' PVOID ApcContext', ' NTSTATUS IoStatus', ' ULONG_PTR IoStatusInformation']
 case 225: {
+if (PPP_CHECK_CB(on_NtSetIoCompletion_enter) || PPP_CHECK_CB(on_NtSetIoCompletion_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3269,10 +3716,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetIoCompletion_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtSetIoCompletion_enter, rp.proc_id, pc, 225, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 226 NTSTATUS NtSetLdtEntries ['ULONG Selector0', ' ULONG Entry0Low', ' ULONG Entry0Hi', ' ULONG Selector1', ' ULONG Entry1Low', ' ULONG Entry1Hi']
 case 226: {
+if (PPP_CHECK_CB(on_NtSetLdtEntries_enter) || PPP_CHECK_CB(on_NtSetLdtEntries_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3287,26 +3736,32 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetLdtEntries_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+PPP_RUN_CB_FILTERED(on_NtSetLdtEntries_enter, rp.proc_id, pc, 226, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 227 NTSTATUS NtSetLowEventPair ['HANDLE EventPairHandle']
 case 227: {
+if (PPP_CHECK_CB(on_NtSetLowEventPair_enter) || PPP_CHECK_CB(on_NtSetLowEventPair_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtSetLowEventPair_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetLowEventPair_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtSetLowEventPair_enter, rp.proc_id, pc, 227, env,pc,arg0) ; 
+}
 }; break;
 // 228 NTSTATUS NtSetLowWaitHighEventPair ['HANDLE EventPairHandle']
 case 228: {
+if (PPP_CHECK_CB(on_NtSetLowWaitHighEventPair_enter) || PPP_CHECK_CB(on_NtSetLowWaitHighEventPair_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtSetLowWaitHighEventPair_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetLowWaitHighEventPair_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtSetLowWaitHighEventPair_enter, rp.proc_id, pc, 228, env,pc,arg0) ; 
+}
 }; break;
 // 229 NTSTATUS NtSetQuotaInformationFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID Buffer', ' ULONG Length']
 case 229: {
+if (PPP_CHECK_CB(on_NtSetQuotaInformationFile_enter) || PPP_CHECK_CB(on_NtSetQuotaInformationFile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3317,10 +3772,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetQuotaInformationFile_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtSetQuotaInformationFile_enter, rp.proc_id, pc, 229, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 230 NTSTATUS NtSetSecurityObject ['HANDLE Handle', ' SECURITY_INFORMATION SecurityInformation', ' PSECURITY_DESCRIPTOR SecurityDescriptor']
 case 230: {
+if (PPP_CHECK_CB(on_NtSetSecurityObject_enter) || PPP_CHECK_CB(on_NtSetSecurityObject_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3329,20 +3786,24 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetSecurityObject_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtSetSecurityObject_enter, rp.proc_id, pc, 230, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 231 NTSTATUS NtSetSystemEnvironmentValue ['PUNICODE_STRING VariableName', ' PUNICODE_STRING VariableValue']
 case 231: {
+if (PPP_CHECK_CB(on_NtSetSystemEnvironmentValue_enter) || PPP_CHECK_CB(on_NtSetSystemEnvironmentValue_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtSetSystemEnvironmentValue_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetSystemEnvironmentValue_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtSetSystemEnvironmentValue_enter, rp.proc_id, pc, 231, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 232 NTSTATUS NtSetSystemInformation ['SYSTEM_INFORMATION_CLASS SystemInformationClass', ' PVOID SystemInformation', ' ULONG SystemInformationLength']
 case 232: {
+if (PPP_CHECK_CB(on_NtSetSystemInformation_enter) || PPP_CHECK_CB(on_NtSetSystemInformation_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3351,10 +3812,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetSystemInformation_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtSetSystemInformation_enter, rp.proc_id, pc, 232, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 233 NTSTATUS NtSetSystemPowerState ['POWER_ACTION SystemAction', ' SYSTEM_POWER_STATE MinSystemState', ' ULONG Flags']
 case 233: {
+if (PPP_CHECK_CB(on_NtSetSystemPowerState_enter) || PPP_CHECK_CB(on_NtSetSystemPowerState_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3363,30 +3826,36 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetSystemPowerState_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtSetSystemPowerState_enter, rp.proc_id, pc, 233, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 234 NTSTATUS NtSetSystemTime ['PLARGE_INTEGER SystemTime', ' PLARGE_INTEGER PreviousTime']
 case 234: {
+if (PPP_CHECK_CB(on_NtSetSystemTime_enter) || PPP_CHECK_CB(on_NtSetSystemTime_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtSetSystemTime_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetSystemTime_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtSetSystemTime_enter, rp.proc_id, pc, 234, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 235 NTSTATUS NtSetThreadExecutionState ['EXECUTION_STATE esFlags', ' PEXECUTION_STATE PreviousFlags']
 case 235: {
+if (PPP_CHECK_CB(on_NtSetThreadExecutionState_enter) || PPP_CHECK_CB(on_NtSetThreadExecutionState_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtSetThreadExecutionState_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetThreadExecutionState_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtSetThreadExecutionState_enter, rp.proc_id, pc, 235, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 236 NTSTATUS NtSetTimer ['HANDLE TimerHandle', ' PLARGE_INTEGER DueTime', ' PTIMER_APC_ROUTINE TimerApcRoutine', ' PVOID TimerContext', ' BOOLEAN WakeTimer', ' LONG Period', ' PBOOLEAN PreviousState']
 case 236: {
+if (PPP_CHECK_CB(on_NtSetTimer_enter) || PPP_CHECK_CB(on_NtSetTimer_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3403,10 +3872,12 @@ memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(int32_t));
 memcpy(rp.params[6], &arg6, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetTimer_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
+PPP_RUN_CB_FILTERED(on_NtSetTimer_enter, rp.proc_id, pc, 236, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
+}
 }; break;
 // 237 NTSTATUS NtSetTimerResolution ['ULONG DesiredTime', ' BOOLEAN SetResolution', ' PULONG ActualTime']
 case 237: {
+if (PPP_CHECK_CB(on_NtSetTimerResolution_enter) || PPP_CHECK_CB(on_NtSetTimerResolution_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3415,18 +3886,22 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetTimerResolution_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtSetTimerResolution_enter, rp.proc_id, pc, 237, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 238 NTSTATUS NtSetUuidSeed ['PCHAR Seed']
 case 238: {
+if (PPP_CHECK_CB(on_NtSetUuidSeed_enter) || PPP_CHECK_CB(on_NtSetUuidSeed_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtSetUuidSeed_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetUuidSeed_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtSetUuidSeed_enter, rp.proc_id, pc, 238, env,pc,arg0) ; 
+}
 }; break;
 // 239 NTSTATUS NtSetValueKey ['HANDLE KeyHandle', ' PUNICODE_STRING ValueName', ' ULONG TitleIndex', ' ULONG Type', ' PVOID Data', ' ULONG DataSize']
 case 239: {
+if (PPP_CHECK_CB(on_NtSetValueKey_enter) || PPP_CHECK_CB(on_NtSetValueKey_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3441,10 +3916,12 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetValueKey_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+PPP_RUN_CB_FILTERED(on_NtSetValueKey_enter, rp.proc_id, pc, 239, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 240 NTSTATUS NtSetVolumeInformationFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID FsInformation', ' ULONG Length', ' FS_INFORMATION_CLASS FsInformationClass']
 case 240: {
+if (PPP_CHECK_CB(on_NtSetVolumeInformationFile_enter) || PPP_CHECK_CB(on_NtSetVolumeInformationFile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3457,18 +3934,22 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSetVolumeInformationFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtSetVolumeInformationFile_enter, rp.proc_id, pc, 240, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 241 NTSTATUS NtShutdownSystem ['SHUTDOWN_ACTION Action']
 case 241: {
+if (PPP_CHECK_CB(on_NtShutdownSystem_enter) || PPP_CHECK_CB(on_NtShutdownSystem_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtShutdownSystem_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtShutdownSystem_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtShutdownSystem_enter, rp.proc_id, pc, 241, env,pc,arg0) ; 
+}
 }; break;
 // 242 NTSTATUS NtSignalAndWaitForSingleObject ['HANDLE SignalHandle', ' HANDLE WaitHandle', ' BOOLEAN Alertable', ' PLARGE_INTEGER Timeout']
 case 242: {
+if (PPP_CHECK_CB(on_NtSignalAndWaitForSingleObject_enter) || PPP_CHECK_CB(on_NtSignalAndWaitForSingleObject_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3479,44 +3960,54 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSignalAndWaitForSingleObject_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtSignalAndWaitForSingleObject_enter, rp.proc_id, pc, 242, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 243 NTSTATUS NtStartProfile ['HANDLE ProfileHandle']
 case 243: {
+if (PPP_CHECK_CB(on_NtStartProfile_enter) || PPP_CHECK_CB(on_NtStartProfile_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtStartProfile_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtStartProfile_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtStartProfile_enter, rp.proc_id, pc, 243, env,pc,arg0) ; 
+}
 }; break;
 // 244 NTSTATUS NtStopProfile ['HANDLE ProfileHandle']
 case 244: {
+if (PPP_CHECK_CB(on_NtStopProfile_enter) || PPP_CHECK_CB(on_NtStopProfile_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtStopProfile_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtStopProfile_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtStopProfile_enter, rp.proc_id, pc, 244, env,pc,arg0) ; 
+}
 }; break;
 // 245 NTSTATUS NtSuspendProcess ['HANDLE ProcessHandle']
 case 245: {
+if (PPP_CHECK_CB(on_NtSuspendProcess_enter) || PPP_CHECK_CB(on_NtSuspendProcess_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtSuspendProcess_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSuspendProcess_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtSuspendProcess_enter, rp.proc_id, pc, 245, env,pc,arg0) ; 
+}
 }; break;
 // 246 NTSTATUS NtSuspendThread ['HANDLE ThreadHandle', ' PULONG PreviousSuspendCount']
 case 246: {
+if (PPP_CHECK_CB(on_NtSuspendThread_enter) || PPP_CHECK_CB(on_NtSuspendThread_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtSuspendThread_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSuspendThread_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtSuspendThread_enter, rp.proc_id, pc, 246, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 247 NTSTATUS NtSystemDebugControl ['SYSDBG_COMMAND Command', ' PVOID InputBuffer', ' ULONG InputBufferLength', ' PVOID OutputBuffer', ' ULONG OutputBufferLength', ' PULONG ReturnLength']
 case 247: {
+if (PPP_CHECK_CB(on_NtSystemDebugControl_enter) || PPP_CHECK_CB(on_NtSystemDebugControl_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3531,46 +4022,56 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtSystemDebugControl_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+PPP_RUN_CB_FILTERED(on_NtSystemDebugControl_enter, rp.proc_id, pc, 247, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 248 NTSTATUS NtTerminateJobObject ['HANDLE JobHandle', ' NTSTATUS ExitStatus']
 case 248: {
+if (PPP_CHECK_CB(on_NtTerminateJobObject_enter) || PPP_CHECK_CB(on_NtTerminateJobObject_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtTerminateJobObject_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtTerminateJobObject_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtTerminateJobObject_enter, rp.proc_id, pc, 248, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 249 NTSTATUS NtTerminateProcess ['HANDLE ProcessHandle', ' NTSTATUS ExitStatus']
 case 249: {
+if (PPP_CHECK_CB(on_NtTerminateProcess_enter) || PPP_CHECK_CB(on_NtTerminateProcess_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtTerminateProcess_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtTerminateProcess_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtTerminateProcess_enter, rp.proc_id, pc, 249, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 250 NTSTATUS NtTerminateThread ['HANDLE ThreadHandle', ' NTSTATUS ExitStatus']
 case 250: {
+if (PPP_CHECK_CB(on_NtTerminateThread_enter) || PPP_CHECK_CB(on_NtTerminateThread_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtTerminateThread_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtTerminateThread_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtTerminateThread_enter, rp.proc_id, pc, 250, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 251 NTSTATUS NtTestAlert ['']
 case 251: {
+if (PPP_CHECK_CB(on_NtTestAlert_enter) || PPP_CHECK_CB(on_NtTestAlert_return)) {
 if (PPP_CHECK_CB(on_NtTestAlert_return)) {
 }
-PPP_RUN_CB(on_NtTestAlert_enter, env,pc) ; 
+PPP_RUN_CB_FILTERED(on_NtTestAlert_enter, rp.proc_id, pc, 251, env,pc) ; 
+}
 }; break;
 // 252 NTSTATUS NtTraceEvent ['HANDLE TraceHandle', ' ULONG Flags', ' ULONG FieldSize', ' PVOID Fields']
 case 252: {
+if (PPP_CHECK_CB(on_NtTraceEvent_enter) || PPP_CHECK_CB(on_NtTraceEvent_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3581,10 +4082,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtTraceEvent_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtTraceEvent_enter, rp.proc_id, pc, 252, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 253 NTSTATUS NtTranslateFilePath ['PFILE_PATH InputFilePath', ' ULONG OutputType', ' PFILE_PATH OutputFilePath', ' PULONG OutputFilePathLength']
 case 253: {
+if (PPP_CHECK_CB(on_NtTranslateFilePath_enter) || PPP_CHECK_CB(on_NtTranslateFilePath_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3595,36 +4098,44 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtTranslateFilePath_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtTranslateFilePath_enter, rp.proc_id, pc, 253, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 254 NTSTATUS NtUnloadDriver ['PUNICODE_STRING DriverServiceName']
 case 254: {
+if (PPP_CHECK_CB(on_NtUnloadDriver_enter) || PPP_CHECK_CB(on_NtUnloadDriver_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtUnloadDriver_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtUnloadDriver_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtUnloadDriver_enter, rp.proc_id, pc, 254, env,pc,arg0) ; 
+}
 }; break;
 // 255 NTSTATUS NtUnloadKey ['POBJECT_ATTRIBUTES TargetKey']
 case 255: {
+if (PPP_CHECK_CB(on_NtUnloadKey_enter) || PPP_CHECK_CB(on_NtUnloadKey_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtUnloadKey_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtUnloadKey_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtUnloadKey_enter, rp.proc_id, pc, 255, env,pc,arg0) ; 
+}
 }; break;
 // 256 NTSTATUS NtUnloadKeyEx ['POBJECT_ATTRIBUTES TargetKey', ' HANDLE Event']
 case 256: {
+if (PPP_CHECK_CB(on_NtUnloadKeyEx_enter) || PPP_CHECK_CB(on_NtUnloadKeyEx_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtUnloadKeyEx_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtUnloadKeyEx_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtUnloadKeyEx_enter, rp.proc_id, pc, 256, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 257 NTSTATUS NtUnlockFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock', ' PLARGE_INTEGER ByteOffset', ' PLARGE_INTEGER Length', ' ULONG Key']
 case 257: {
+if (PPP_CHECK_CB(on_NtUnlockFile_enter) || PPP_CHECK_CB(on_NtUnlockFile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3637,10 +4148,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtUnlockFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtUnlockFile_enter, rp.proc_id, pc, 257, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 258 NTSTATUS NtUnlockVirtualMemory ['HANDLE ProcessHandle', ' PVOID *BaseAddress', ' PSIZE_T RegionSize', ' ULONG MapType']
 case 258: {
+if (PPP_CHECK_CB(on_NtUnlockVirtualMemory_enter) || PPP_CHECK_CB(on_NtUnlockVirtualMemory_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3651,30 +4164,36 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtUnlockVirtualMemory_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtUnlockVirtualMemory_enter, rp.proc_id, pc, 258, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 259 NTSTATUS NtUnmapViewOfSection ['HANDLE ProcessHandle', ' PVOID BaseAddress']
 case 259: {
+if (PPP_CHECK_CB(on_NtUnmapViewOfSection_enter) || PPP_CHECK_CB(on_NtUnmapViewOfSection_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtUnmapViewOfSection_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtUnmapViewOfSection_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtUnmapViewOfSection_enter, rp.proc_id, pc, 259, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 260 NTSTATUS NtVdmControl ['VDMSERVICECLASS Service', ' PVOID ServiceData']
 case 260: {
+if (PPP_CHECK_CB(on_NtVdmControl_enter) || PPP_CHECK_CB(on_NtVdmControl_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 if (PPP_CHECK_CB(on_NtVdmControl_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtVdmControl_enter, env,pc,arg0,arg1) ; 
+PPP_RUN_CB_FILTERED(on_NtVdmControl_enter, rp.proc_id, pc, 260, env,pc,arg0,arg1) ; 
+}
 }; break;
 // 261 NTSTATUS NtWaitForDebugEvent ['HANDLE DebugObjectHandle', ' BOOLEAN Alertable', ' PLARGE_INTEGER Timeout', ' PDBGUI_WAIT_STATE_CHANGE WaitStateChange']
 case 261: {
+if (PPP_CHECK_CB(on_NtWaitForDebugEvent_enter) || PPP_CHECK_CB(on_NtWaitForDebugEvent_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3685,10 +4204,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtWaitForDebugEvent_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtWaitForDebugEvent_enter, rp.proc_id, pc, 261, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 262 NTSTATUS NtWaitForMultipleObjects ['ULONG Count', ' HANDLE Handles[]', ' WAIT_TYPE WaitType', ' BOOLEAN Alertable', ' PLARGE_INTEGER Timeout']
 case 262: {
+if (PPP_CHECK_CB(on_NtWaitForMultipleObjects_enter) || PPP_CHECK_CB(on_NtWaitForMultipleObjects_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3701,10 +4222,12 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtWaitForMultipleObjects_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtWaitForMultipleObjects_enter, rp.proc_id, pc, 262, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 263 NTSTATUS NtWaitForSingleObject ['HANDLE Handle', ' BOOLEAN Alertable', ' PLARGE_INTEGER Timeout']
 case 263: {
+if (PPP_CHECK_CB(on_NtWaitForSingleObject_enter) || PPP_CHECK_CB(on_NtWaitForSingleObject_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3713,26 +4236,32 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtWaitForSingleObject_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtWaitForSingleObject_enter, rp.proc_id, pc, 263, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 264 NTSTATUS NtWaitHighEventPair ['HANDLE EventPairHandle']
 case 264: {
+if (PPP_CHECK_CB(on_NtWaitHighEventPair_enter) || PPP_CHECK_CB(on_NtWaitHighEventPair_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtWaitHighEventPair_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtWaitHighEventPair_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtWaitHighEventPair_enter, rp.proc_id, pc, 264, env,pc,arg0) ; 
+}
 }; break;
 // 265 NTSTATUS NtWaitLowEventPair ['HANDLE EventPairHandle']
 case 265: {
+if (PPP_CHECK_CB(on_NtWaitLowEventPair_enter) || PPP_CHECK_CB(on_NtWaitLowEventPair_return)) {
 uint32_t arg0 = get_32(env, 0);
 if (PPP_CHECK_CB(on_NtWaitLowEventPair_return)) {
 memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtWaitLowEventPair_enter, env,pc,arg0) ; 
+PPP_RUN_CB_FILTERED(on_NtWaitLowEventPair_enter, rp.proc_id, pc, 265, env,pc,arg0) ; 
+}
 }; break;
 // 266 NTSTATUS NtWriteFile ['HANDLE FileHandle', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID Buffer', ' ULONG Length', ' PLARGE_INTEGER ByteOffset', ' PULONG Key']
 case 266: {
+if (PPP_CHECK_CB(on_NtWriteFile_enter) || PPP_CHECK_CB(on_NtWriteFile_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3753,10 +4282,12 @@ memcpy(rp.params[6], &arg6, sizeof(uint32_t));
 memcpy(rp.params[7], &arg7, sizeof(uint32_t));
 memcpy(rp.params[8], &arg8, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtWriteFile_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+PPP_RUN_CB_FILTERED(on_NtWriteFile_enter, rp.proc_id, pc, 266, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+}
 }; break;
 // 267 NTSTATUS NtWriteFileGather ['HANDLE FileHandle', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' PFILE_SEGMENT_ELEMENT SegmentArray', ' ULONG Length', ' PLARGE_INTEGER ByteOffset', ' PULONG Key']
 case 267: {
+if (PPP_CHECK_CB(on_NtWriteFileGather_enter) || PPP_CHECK_CB(on_NtWriteFileGather_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3777,10 +4308,12 @@ memcpy(rp.params[6], &arg6, sizeof(uint32_t));
 memcpy(rp.params[7], &arg7, sizeof(uint32_t));
 memcpy(rp.params[8], &arg8, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtWriteFileGather_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+PPP_RUN_CB_FILTERED(on_NtWriteFileGather_enter, rp.proc_id, pc, 267, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
+}
 }; break;
 // 268 NTSTATUS NtWriteRequestData ['HANDLE PortHandle', ' PPORT_MESSAGE Message', ' ULONG DataEntryIndex', ' PVOID Buffer', ' SIZE_T BufferSize', ' PSIZE_T NumberOfBytesWritten']
 case 268: {
+if (PPP_CHECK_CB(on_NtWriteRequestData_enter) || PPP_CHECK_CB(on_NtWriteRequestData_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3795,10 +4328,12 @@ memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 memcpy(rp.params[5], &arg5, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtWriteRequestData_enter, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+PPP_RUN_CB_FILTERED(on_NtWriteRequestData_enter, rp.proc_id, pc, 268, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
+}
 }; break;
 // 269 NTSTATUS NtWriteVirtualMemory ['HANDLE ProcessHandle', ' PVOID BaseAddress', ' PVOID Buffer', ' SIZE_T BufferSize', ' PSIZE_T NumberOfBytesWritten']
 case 269: {
+if (PPP_CHECK_CB(on_NtWriteVirtualMemory_enter) || PPP_CHECK_CB(on_NtWriteVirtualMemory_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3811,16 +4346,20 @@ memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 memcpy(rp.params[4], &arg4, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtWriteVirtualMemory_enter, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+PPP_RUN_CB_FILTERED(on_NtWriteVirtualMemory_enter, rp.proc_id, pc, 269, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
+}
 }; break;
 // 270 NTSTATUS NtYieldExecution ['']
 case 270: {
+if (PPP_CHECK_CB(on_NtYieldExecution_enter) || PPP_CHECK_CB(on_NtYieldExecution_return)) {
 if (PPP_CHECK_CB(on_NtYieldExecution_return)) {
 }
-PPP_RUN_CB(on_NtYieldExecution_enter, env,pc) ; 
+PPP_RUN_CB_FILTERED(on_NtYieldExecution_enter, rp.proc_id, pc, 270, env,pc) ; 
+}
 }; break;
 // 271 NTSTATUS NtCreateKeyedEvent ['PHANDLE KeyedEventHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' ULONG Flags']
 case 271: {
+if (PPP_CHECK_CB(on_NtCreateKeyedEvent_enter) || PPP_CHECK_CB(on_NtCreateKeyedEvent_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3831,10 +4370,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtCreateKeyedEvent_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtCreateKeyedEvent_enter, rp.proc_id, pc, 271, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 272 NTSTATUS NtOpenKeyedEvent ['PHANDLE KeyedEventHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
 case 272: {
+if (PPP_CHECK_CB(on_NtOpenKeyedEvent_enter) || PPP_CHECK_CB(on_NtOpenKeyedEvent_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3843,10 +4384,12 @@ memcpy(rp.params[0], &arg0, sizeof(uint32_t));
 memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtOpenKeyedEvent_enter, env,pc,arg0,arg1,arg2) ; 
+PPP_RUN_CB_FILTERED(on_NtOpenKeyedEvent_enter, rp.proc_id, pc, 272, env,pc,arg0,arg1,arg2) ; 
+}
 }; break;
 // 273 NTSTATUS NtReleaseKeyedEvent ['HANDLE KeyedEventHandle', ' PVOID KeyValue', ' BOOLEAN Alertable', ' PLARGE_INTEGER Timeout']
 case 273: {
+if (PPP_CHECK_CB(on_NtReleaseKeyedEvent_enter) || PPP_CHECK_CB(on_NtReleaseKeyedEvent_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3857,10 +4400,12 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtReleaseKeyedEvent_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtReleaseKeyedEvent_enter, rp.proc_id, pc, 273, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 274 NTSTATUS NtWaitForKeyedEvent ['HANDLE KeyedEventHandle', ' PVOID KeyValue', ' BOOLEAN Alertable', ' PLARGE_INTEGER Timeout']
 case 274: {
+if (PPP_CHECK_CB(on_NtWaitForKeyedEvent_enter) || PPP_CHECK_CB(on_NtWaitForKeyedEvent_return)) {
 uint32_t arg0 = get_32(env, 0);
 uint32_t arg1 = get_32(env, 1);
 uint32_t arg2 = get_32(env, 2);
@@ -3871,18 +4416,21 @@ memcpy(rp.params[1], &arg1, sizeof(uint32_t));
 memcpy(rp.params[2], &arg2, sizeof(uint32_t));
 memcpy(rp.params[3], &arg3, sizeof(uint32_t));
 }
-PPP_RUN_CB(on_NtWaitForKeyedEvent_enter, env,pc,arg0,arg1,arg2,arg3) ; 
+PPP_RUN_CB_FILTERED(on_NtWaitForKeyedEvent_enter, rp.proc_id, pc, 274, env,pc,arg0,arg1,arg2,arg3) ; 
+}
 }; break;
 // 275 NTSTATUS NtQueryPortInformationProcess ['']
 case 275: {
+if (PPP_CHECK_CB(on_NtQueryPortInformationProcess_enter) || PPP_CHECK_CB(on_NtQueryPortInformationProcess_return)) {
 if (PPP_CHECK_CB(on_NtQueryPortInformationProcess_return)) {
 }
-PPP_RUN_CB(on_NtQueryPortInformationProcess_enter, env,pc) ; 
+PPP_RUN_CB_FILTERED(on_NtQueryPortInformationProcess_enter, rp.proc_id, pc, 275, env,pc) ; 
+}
 }; break;
 default:
-PPP_RUN_CB(on_unknown_sys_enter, env, pc, EAX);
+PPP_RUN_CB_FILTERED(on_unknown_sys_enter, rp.proc_id, pc, rp.ordinal, env, pc, rp.ordinal);
 }
-PPP_RUN_CB(on_all_sys_enter, env, pc, EAX);
+PPP_RUN_CB_FILTERED(on_all_sys_enter, rp.proc_id, pc, rp.ordinal, env, pc, rp.ordinal);
 appendReturnPoint(rp);
 #endif
  } 
@@ -18,24 +18,25 @@ void syscall_return_switch_windowsxp_sp3_x86 ( CPUState *env, target_ulong pc, t
     switch( ordinal ) {                          // CALLNO
 // 0 NTSTATUS NtAcceptConnectPort ['PHANDLE PortHandle', ' PVOID PortContext', ' PPORT_MESSAGE ConnectionRequest', ' BOOLEAN AcceptConnection', ' PPORT_VIEW ServerView', ' PREMOTE_PORT_VIEW ClientView']
 case 0: {
+if (PPP_CHECK_CB(on_NtAcceptConnectPort_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
 uint32_t arg5;
-if (PPP_CHECK_CB(on_NtAcceptConnectPort_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
 memcpy(&arg5, rp.params[5], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtAcceptConnectPort_return, rp.proc_id, pc, 0, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
 }
-PPP_RUN_CB(on_NtAcceptConnectPort_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
 }; break;
 // 1 NTSTATUS NtAccessCheck ['PSECURITY_DESCRIPTOR SecurityDescriptor', ' HANDLE ClientToken', ' ACCESS_MASK DesiredAccess', ' PGENERIC_MAPPING GenericMapping', ' PPRIVILEGE_SET PrivilegeSet', ' PULONG PrivilegeSetLength', ' PACCESS_MASK GrantedAccess', ' PNTSTATUS AccessStatus']
 case 1: {
+if (PPP_CHECK_CB(on_NtAccessCheck_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
@@ -44,7 +45,6 @@ uint32_t arg4;
 uint32_t arg5;
 uint32_t arg6;
 uint32_t arg7;
-if (PPP_CHECK_CB(on_NtAccessCheck_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
@@ -53,11 +53,12 @@ memcpy(&arg4, rp.params[4], sizeof(uint32_t));
 memcpy(&arg5, rp.params[5], sizeof(uint32_t));
 memcpy(&arg6, rp.params[6], sizeof(uint32_t));
 memcpy(&arg7, rp.params[7], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtAccessCheck_return, rp.proc_id, pc, 1, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
 }
-PPP_RUN_CB(on_NtAccessCheck_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
 }; break;
 // 2 NTSTATUS NtAccessCheckAndAuditAlarm ['PUNICODE_STRING SubsystemName', ' PVOID HandleId', ' PUNICODE_STRING ObjectTypeName', ' PUNICODE_STRING ObjectName', ' PSECURITY_DESCRIPTOR SecurityDescriptor', ' ACCESS_MASK DesiredAccess', ' PGENERIC_MAPPING GenericMapping', ' BOOLEAN ObjectCreation', ' PACCESS_MASK GrantedAccess', ' PNTSTATUS AccessStatus', ' PBOOLEAN GenerateOnClose']
 case 2: {
+if (PPP_CHECK_CB(on_NtAccessCheckAndAuditAlarm_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
@@ -69,7 +70,6 @@ uint32_t arg7;
 uint32_t arg8;
 uint32_t arg9;
 uint32_t arg10;
-if (PPP_CHECK_CB(on_NtAccessCheckAndAuditAlarm_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
@@ -81,11 +81,12 @@ memcpy(&arg7, rp.params[7], sizeof(uint32_t));
 memcpy(&arg8, rp.params[8], sizeof(uint32_t));
 memcpy(&arg9, rp.params[9], sizeof(uint32_t));
 memcpy(&arg10, rp.params[10], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtAccessCheckAndAuditAlarm_return, rp.proc_id, pc, 2, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10) ; 
 }
-PPP_RUN_CB(on_NtAccessCheckAndAuditAlarm_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10) ; 
 }; break;
 // 3 NTSTATUS NtAccessCheckByType ['PSECURITY_DESCRIPTOR SecurityDescriptor', ' PSID PrincipalSelfSid', ' HANDLE ClientToken', ' ACCESS_MASK DesiredAccess', ' POBJECT_TYPE_LIST ObjectTypeList', ' ULONG ObjectTypeListLength', ' PGENERIC_MAPPING GenericMapping', ' PPRIVILEGE_SET PrivilegeSet', ' PULONG PrivilegeSetLength', ' PACCESS_MASK GrantedAccess', ' PNTSTATUS AccessStatus']
 case 3: {
+if (PPP_CHECK_CB(on_NtAccessCheckByType_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
@@ -97,7 +98,6 @@ uint32_t arg7;
 uint32_t arg8;
 uint32_t arg9;
 uint32_t arg10;
-if (PPP_CHECK_CB(on_NtAccessCheckByType_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
@@ -109,11 +109,12 @@ memcpy(&arg7, rp.params[7], sizeof(uint32_t));
 memcpy(&arg8, rp.params[8], sizeof(uint32_t));
 memcpy(&arg9, rp.params[9], sizeof(uint32_t));
 memcpy(&arg10, rp.params[10], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtAccessCheckByType_return, rp.proc_id, pc, 3, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10) ; 
 }
-PPP_RUN_CB(on_NtAccessCheckByType_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10) ; 
 }; break;
 // 4 NTSTATUS NtAccessCheckByTypeAndAuditAlarm ['PUNICODE_STRING SubsystemName', ' PVOID HandleId', ' PUNICODE_STRING ObjectTypeName', ' PUNICODE_STRING ObjectName', ' PSECURITY_DESCRIPTOR SecurityDescriptor', ' PSID PrincipalSelfSid', ' ACCESS_MASK DesiredAccess', ' AUDIT_EVENT_TYPE AuditType', ' ULONG Flags', ' POBJECT_TYPE_LIST ObjectTypeList', ' ULONG ObjectTypeListLength', ' PGENERIC_MAPPING GenericMapping', ' BOOLEAN ObjectCreation', ' PACCESS_MASK GrantedAccess', ' PNTSTATUS AccessStatus', ' PBOOLEAN GenerateOnClose']
 case 4: {
+if (PPP_CHECK_CB(on_NtAccessCheckByTypeAndAuditAlarm_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
@@ -130,7 +131,6 @@ uint32_t arg12;
 uint32_t arg13;
 uint32_t arg14;
 uint32_t arg15;
-if (PPP_CHECK_CB(on_NtAccessCheckByTypeAndAuditAlarm_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
@@ -147,11 +147,12 @@ memcpy(&arg12, rp.params[12], sizeof(uint32_t));
 memcpy(&arg13, rp.params[13], sizeof(uint32_t));
 memcpy(&arg14, rp.params[14], sizeof(uint32_t));
 memcpy(&arg15, rp.params[15], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtAccessCheckByTypeAndAuditAlarm_return, rp.proc_id, pc, 4, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11,arg12,arg13,arg14,arg15) ; 
 }
-PPP_RUN_CB(on_NtAccessCheckByTypeAndAuditAlarm_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11,arg12,arg13,arg14,arg15) ; 
 }; break;
 // 5 NTSTATUS NtAccessCheckByTypeResultList ['PSECURITY_DESCRIPTOR SecurityDescriptor', ' PSID PrincipalSelfSid', ' HANDLE ClientToken', ' ACCESS_MASK DesiredAccess', ' POBJECT_TYPE_LIST ObjectTypeList', ' ULONG ObjectTypeListLength', ' PGENERIC_MAPPING GenericMapping', ' PPRIVILEGE_SET PrivilegeSet', ' PULONG PrivilegeSetLength', ' PACCESS_MASK GrantedAccess', ' PNTSTATUS AccessStatus']
 case 5: {
+if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultList_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
@@ -163,7 +164,6 @@ uint32_t arg7;
 uint32_t arg8;
 uint32_t arg9;
 uint32_t arg10;
-if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultList_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
@@ -175,11 +175,12 @@ memcpy(&arg7, rp.params[7], sizeof(uint32_t));
 memcpy(&arg8, rp.params[8], sizeof(uint32_t));
 memcpy(&arg9, rp.params[9], sizeof(uint32_t));
 memcpy(&arg10, rp.params[10], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtAccessCheckByTypeResultList_return, rp.proc_id, pc, 5, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10) ; 
 }
-PPP_RUN_CB(on_NtAccessCheckByTypeResultList_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10) ; 
 }; break;
 // 6 NTSTATUS NtAccessCheckByTypeResultListAndAuditAlarm ['PUNICODE_STRING SubsystemName', ' PVOID HandleId', ' PUNICODE_STRING ObjectTypeName', ' PUNICODE_STRING ObjectName', ' PSECURITY_DESCRIPTOR SecurityDescriptor', ' PSID PrincipalSelfSid', ' ACCESS_MASK DesiredAccess', ' AUDIT_EVENT_TYPE AuditType', ' ULONG Flags', ' POBJECT_TYPE_LIST ObjectTypeList', ' ULONG ObjectTypeListLength', ' PGENERIC_MAPPING GenericMapping', ' BOOLEAN ObjectCreation', ' PACCESS_MASK GrantedAccess', ' PNTSTATUS AccessStatus', ' PBOOLEAN GenerateOnClose']
 case 6: {
+if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarm_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
@@ -196,7 +197,6 @@ uint32_t arg12;
 uint32_t arg13;
 uint32_t arg14;
 uint32_t arg15;
-if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarm_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
@@ -213,11 +213,12 @@ memcpy(&arg12, rp.params[12], sizeof(uint32_t));
 memcpy(&arg13, rp.params[13], sizeof(uint32_t));
 memcpy(&arg14, rp.params[14], sizeof(uint32_t));
 memcpy(&arg15, rp.params[15], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtAccessCheckByTypeResultListAndAuditAlarm_return, rp.proc_id, pc, 6, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11,arg12,arg13,arg14,arg15) ; 
 }
-PPP_RUN_CB(on_NtAccessCheckByTypeResultListAndAuditAlarm_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11,arg12,arg13,arg14,arg15) ; 
 }; break;
 // 7 NTSTATUS NtAccessCheckByTypeResultListAndAuditAlarmByHandle ['PUNICODE_STRING SubsystemName', ' PVOID HandleId', ' HANDLE ClientToken', ' PUNICODE_STRING ObjectTypeName', ' PUNICODE_STRING ObjectName', ' PSECURITY_DESCRIPTOR SecurityDescriptor', ' PSID PrincipalSelfSid', ' ACCESS_MASK DesiredAccess', ' AUDIT_EVENT_TYPE AuditType', ' ULONG Flags', ' POBJECT_TYPE_LIST ObjectTypeList', ' ULONG ObjectTypeListLength', ' PGENERIC_MAPPING GenericMapping', ' BOOLEAN ObjectCreation', ' PACCESS_MASK GrantedAccess', ' PNTSTATUS AccessStatus', ' PBOOLEAN GenerateOnClose']
 case 7: {
+if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
@@ -235,7 +236,6 @@ uint32_t arg13;
 uint32_t arg14;
 uint32_t arg15;
 uint32_t arg16;
-if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
@@ -253,265 +253,266 @@ memcpy(&arg13, rp.params[13], sizeof(uint32_t));
 memcpy(&arg14, rp.params[14], sizeof(uint32_t));
 memcpy(&arg15, rp.params[15], sizeof(uint32_t));
 memcpy(&arg16, rp.params[16], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_return, rp.proc_id, pc, 7, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11,arg12,arg13,arg14,arg15,arg16) ; 
 }
-PPP_RUN_CB(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11,arg12,arg13,arg14,arg15,arg16) ; 
 }; break;
 // 8 NTSTATUS NtAddAtom ['PWSTR AtomName', ' ULONG Length', ' PRTL_ATOM Atom']
 case 8: {
+if (PPP_CHECK_CB(on_NtAddAtom_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
-if (PPP_CHECK_CB(on_NtAddAtom_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtAddAtom_return, rp.proc_id, pc, 8, env,pc,arg0,arg1,arg2) ; 
 }
-PPP_RUN_CB(on_NtAddAtom_return, env,pc,arg0,arg1,arg2) ; 
 }; break;
 // 9 NTSTATUS NtEnumerateBootEntries ['PVOID Buffer', ' PULONG BufferLength']
 case 9: {
+if (PPP_CHECK_CB(on_NtEnumerateBootEntries_return)) {
 uint32_t arg0;
 uint32_t arg1;
-if (PPP_CHECK_CB(on_NtEnumerateBootEntries_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtEnumerateBootEntries_return, rp.proc_id, pc, 9, env,pc,arg0,arg1) ; 
 }
-PPP_RUN_CB(on_NtEnumerateBootEntries_return, env,pc,arg0,arg1) ; 
 }; break;
 // 10 NTSTATUS NtAdjustGroupsToken ['HANDLE TokenHandle', ' BOOLEAN ResetToDefault', ' PTOKEN_GROUPS NewState', ' ULONG BufferLength', ' PTOKEN_GROUPS PreviousState', ' PULONG ReturnLength']
 case 10: {
+if (PPP_CHECK_CB(on_NtAdjustGroupsToken_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
 uint32_t arg5;
-if (PPP_CHECK_CB(on_NtAdjustGroupsToken_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
 memcpy(&arg5, rp.params[5], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtAdjustGroupsToken_return, rp.proc_id, pc, 10, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
 }
-PPP_RUN_CB(on_NtAdjustGroupsToken_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
 }; break;
 // 11 NTSTATUS NtAdjustPrivilegesToken ['HANDLE TokenHandle', ' BOOLEAN DisableAllPrivileges', ' PTOKEN_PRIVILEGES NewState', ' ULONG BufferLength', ' PTOKEN_PRIVILEGES PreviousState', ' PULONG ReturnLength']
 case 11: {
+if (PPP_CHECK_CB(on_NtAdjustPrivilegesToken_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
 uint32_t arg5;
-if (PPP_CHECK_CB(on_NtAdjustPrivilegesToken_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
 memcpy(&arg5, rp.params[5], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtAdjustPrivilegesToken_return, rp.proc_id, pc, 11, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
 }
-PPP_RUN_CB(on_NtAdjustPrivilegesToken_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
 }; break;
 // 12 NTSTATUS NtAlertResumeThread ['HANDLE ThreadHandle', ' PULONG PreviousSuspendCount']
 case 12: {
+if (PPP_CHECK_CB(on_NtAlertResumeThread_return)) {
 uint32_t arg0;
 uint32_t arg1;
-if (PPP_CHECK_CB(on_NtAlertResumeThread_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtAlertResumeThread_return, rp.proc_id, pc, 12, env,pc,arg0,arg1) ; 
 }
-PPP_RUN_CB(on_NtAlertResumeThread_return, env,pc,arg0,arg1) ; 
 }; break;
 // 13 NTSTATUS NtAlertThread ['HANDLE ThreadHandle']
 case 13: {
-uint32_t arg0;
 if (PPP_CHECK_CB(on_NtAlertThread_return)) {
+uint32_t arg0;
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtAlertThread_return, rp.proc_id, pc, 13, env,pc,arg0) ; 
 }
-PPP_RUN_CB(on_NtAlertThread_return, env,pc,arg0) ; 
 }; break;
 // 14 NTSTATUS NtAllocateLocallyUniqueId ['PLUID Luid']
 case 14: {
-uint32_t arg0;
 if (PPP_CHECK_CB(on_NtAllocateLocallyUniqueId_return)) {
+uint32_t arg0;
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtAllocateLocallyUniqueId_return, rp.proc_id, pc, 14, env,pc,arg0) ; 
 }
-PPP_RUN_CB(on_NtAllocateLocallyUniqueId_return, env,pc,arg0) ; 
 }; break;
 // 15 NTSTATUS NtAllocateUserPhysicalPages ['HANDLE ProcessHandle', ' PULONG_PTR NumberOfPages', ' PULONG_PTR UserPfnArray']
 case 15: {
+if (PPP_CHECK_CB(on_NtAllocateUserPhysicalPages_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
-if (PPP_CHECK_CB(on_NtAllocateUserPhysicalPages_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtAllocateUserPhysicalPages_return, rp.proc_id, pc, 15, env,pc,arg0,arg1,arg2) ; 
 }
-PPP_RUN_CB(on_NtAllocateUserPhysicalPages_return, env,pc,arg0,arg1,arg2) ; 
 }; break;
 // 16 NTSTATUS NtAllocateUuids ['PULARGE_INTEGER Time', ' PULONG Range', ' PULONG Sequence', ' PCHAR Seed']
 case 16: {
+if (PPP_CHECK_CB(on_NtAllocateUuids_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
-if (PPP_CHECK_CB(on_NtAllocateUuids_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtAllocateUuids_return, rp.proc_id, pc, 16, env,pc,arg0,arg1,arg2,arg3) ; 
 }
-PPP_RUN_CB(on_NtAllocateUuids_return, env,pc,arg0,arg1,arg2,arg3) ; 
 }; break;
 // 17 NTSTATUS NtAllocateVirtualMemory ['HANDLE ProcessHandle', ' PVOID *BaseAddress', ' ULONG_PTR ZeroBits', ' PSIZE_T RegionSize', ' ULONG AllocationType', ' ULONG Protect']
 case 17: {
+if (PPP_CHECK_CB(on_NtAllocateVirtualMemory_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
 uint32_t arg5;
-if (PPP_CHECK_CB(on_NtAllocateVirtualMemory_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
 memcpy(&arg5, rp.params[5], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtAllocateVirtualMemory_return, rp.proc_id, pc, 17, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
 }
-PPP_RUN_CB(on_NtAllocateVirtualMemory_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
 }; break;
 // 18 NTSTATUS NtAreMappedFilesTheSame ['PVOID File1MappedAsAnImage', ' PVOID File2MappedAsFile']
 case 18: {
+if (PPP_CHECK_CB(on_NtAreMappedFilesTheSame_return)) {
 uint32_t arg0;
 uint32_t arg1;
-if (PPP_CHECK_CB(on_NtAreMappedFilesTheSame_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtAreMappedFilesTheSame_return, rp.proc_id, pc, 18, env,pc,arg0,arg1) ; 
 }
-PPP_RUN_CB(on_NtAreMappedFilesTheSame_return, env,pc,arg0,arg1) ; 
 }; break;
 // 19 NTSTATUS NtAssignProcessToJobObject ['HANDLE JobHandle', ' HANDLE ProcessHandle']
 case 19: {
+if (PPP_CHECK_CB(on_NtAssignProcessToJobObject_return)) {
 uint32_t arg0;
 uint32_t arg1;
-if (PPP_CHECK_CB(on_NtAssignProcessToJobObject_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtAssignProcessToJobObject_return, rp.proc_id, pc, 19, env,pc,arg0,arg1) ; 
 }
-PPP_RUN_CB(on_NtAssignProcessToJobObject_return, env,pc,arg0,arg1) ; 
 }; break;
 // 20 NTSTATUS NtCallbackReturn ['PVOID OutputBuffer', ' ULONG OutputLength', ' NTSTATUS Status']
 case 20: {
+if (PPP_CHECK_CB(on_NtCallbackReturn_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
-if (PPP_CHECK_CB(on_NtCallbackReturn_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtCallbackReturn_return, rp.proc_id, pc, 20, env,pc,arg0,arg1,arg2) ; 
 }
-PPP_RUN_CB(on_NtCallbackReturn_return, env,pc,arg0,arg1,arg2) ; 
 }; break;
 // 21 NTSTATUS NtModifyBootEntry ['PBOOT_ENTRY BootEntry']
 case 21: {
-uint32_t arg0;
 if (PPP_CHECK_CB(on_NtModifyBootEntry_return)) {
+uint32_t arg0;
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtModifyBootEntry_return, rp.proc_id, pc, 21, env,pc,arg0) ; 
 }
-PPP_RUN_CB(on_NtModifyBootEntry_return, env,pc,arg0) ; 
 }; break;
 // 22 NTSTATUS NtCancelIoFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock']
 case 22: {
+if (PPP_CHECK_CB(on_NtCancelIoFile_return)) {
 uint32_t arg0;
 uint32_t arg1;
-if (PPP_CHECK_CB(on_NtCancelIoFile_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtCancelIoFile_return, rp.proc_id, pc, 22, env,pc,arg0,arg1) ; 
 }
-PPP_RUN_CB(on_NtCancelIoFile_return, env,pc,arg0,arg1) ; 
 }; break;
 // 23 NTSTATUS NtCancelTimer ['HANDLE TimerHandle', ' PBOOLEAN CurrentState']
 case 23: {
+if (PPP_CHECK_CB(on_NtCancelTimer_return)) {
 uint32_t arg0;
 uint32_t arg1;
-if (PPP_CHECK_CB(on_NtCancelTimer_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtCancelTimer_return, rp.proc_id, pc, 23, env,pc,arg0,arg1) ; 
 }
-PPP_RUN_CB(on_NtCancelTimer_return, env,pc,arg0,arg1) ; 
 }; break;
 // 24 NTSTATUS NtClearEvent ['HANDLE EventHandle']
 case 24: {
-uint32_t arg0;
 if (PPP_CHECK_CB(on_NtClearEvent_return)) {
+uint32_t arg0;
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtClearEvent_return, rp.proc_id, pc, 24, env,pc,arg0) ; 
 }
-PPP_RUN_CB(on_NtClearEvent_return, env,pc,arg0) ; 
 }; break;
 // 25 NTSTATUS NtClose ['HANDLE Handle']
 case 25: {
-uint32_t arg0;
 if (PPP_CHECK_CB(on_NtClose_return)) {
+uint32_t arg0;
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtClose_return, rp.proc_id, pc, 25, env,pc,arg0) ; 
 }
-PPP_RUN_CB(on_NtClose_return, env,pc,arg0) ; 
 }; break;
 // 26 NTSTATUS NtCloseObjectAuditAlarm ['PUNICODE_STRING SubsystemName', ' PVOID HandleId', ' BOOLEAN GenerateOnClose']
 case 26: {
+if (PPP_CHECK_CB(on_NtCloseObjectAuditAlarm_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
-if (PPP_CHECK_CB(on_NtCloseObjectAuditAlarm_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtCloseObjectAuditAlarm_return, rp.proc_id, pc, 26, env,pc,arg0,arg1,arg2) ; 
 }
-PPP_RUN_CB(on_NtCloseObjectAuditAlarm_return, env,pc,arg0,arg1,arg2) ; 
 }; break;
 // 27 NTSTATUS NtCompactKeys ['ULONG Count', ' HANDLE KeyArray[]']
 case 27: {
+if (PPP_CHECK_CB(on_NtCompactKeys_return)) {
 uint32_t arg0;
 uint32_t arg1;
-if (PPP_CHECK_CB(on_NtCompactKeys_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtCompactKeys_return, rp.proc_id, pc, 27, env,pc,arg0,arg1) ; 
 }
-PPP_RUN_CB(on_NtCompactKeys_return, env,pc,arg0,arg1) ; 
 }; break;
 // 28 NTSTATUS NtCompareTokens ['HANDLE FirstTokenHandle', ' HANDLE SecondTokenHandle', ' PBOOLEAN Equal']
 case 28: {
+if (PPP_CHECK_CB(on_NtCompareTokens_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
-if (PPP_CHECK_CB(on_NtCompareTokens_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtCompareTokens_return, rp.proc_id, pc, 28, env,pc,arg0,arg1,arg2) ; 
 }
-PPP_RUN_CB(on_NtCompareTokens_return, env,pc,arg0,arg1,arg2) ; 
 }; break;
 // 29 NTSTATUS NtCompleteConnectPort ['HANDLE PortHandle']
 case 29: {
-uint32_t arg0;
 if (PPP_CHECK_CB(on_NtCompleteConnectPort_return)) {
+uint32_t arg0;
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtCompleteConnectPort_return, rp.proc_id, pc, 29, env,pc,arg0) ; 
 }
-PPP_RUN_CB(on_NtCompleteConnectPort_return, env,pc,arg0) ; 
 }; break;
 // 30 NTSTATUS NtCompressKey ['HANDLE Key']
 case 30: {
-uint32_t arg0;
 if (PPP_CHECK_CB(on_NtCompressKey_return)) {
+uint32_t arg0;
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtCompressKey_return, rp.proc_id, pc, 30, env,pc,arg0) ; 
 }
-PPP_RUN_CB(on_NtCompressKey_return, env,pc,arg0) ; 
 }; break;
 // 31 NTSTATUS NtConnectPort ['PHANDLE PortHandle', ' PUNICODE_STRING PortName', ' PSECURITY_QUALITY_OF_SERVICE SecurityQos', ' PPORT_VIEW ClientView', ' PREMOTE_PORT_VIEW ServerView', ' PULONG MaxMessageLength', ' PVOID ConnectionInformation', ' PULONG ConnectionInformationLength']
 case 31: {
+if (PPP_CHECK_CB(on_NtConnectPort_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
@@ -520,7 +521,6 @@ uint32_t arg4;
 uint32_t arg5;
 uint32_t arg6;
 uint32_t arg7;
-if (PPP_CHECK_CB(on_NtConnectPort_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
@@ -529,75 +529,76 @@ memcpy(&arg4, rp.params[4], sizeof(uint32_t));
 memcpy(&arg5, rp.params[5], sizeof(uint32_t));
 memcpy(&arg6, rp.params[6], sizeof(uint32_t));
 memcpy(&arg7, rp.params[7], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtConnectPort_return, rp.proc_id, pc, 31, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
 }
-PPP_RUN_CB(on_NtConnectPort_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
 }; break;
 // 32 NTSTATUS NtContinue ['PCONTEXT ContextRecord', ' BOOLEAN TestAlert']
 case 32: {
+if (PPP_CHECK_CB(on_NtContinue_return)) {
 uint32_t arg0;
 uint32_t arg1;
-if (PPP_CHECK_CB(on_NtContinue_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtContinue_return, rp.proc_id, pc, 32, env,pc,arg0,arg1) ; 
 }
-PPP_RUN_CB(on_NtContinue_return, env,pc,arg0,arg1) ; 
 }; break;
 // 33 NTSTATUS NtCreateDebugObject ['PHANDLE DebugObjectHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' ULONG Flags']
 case 33: {
+if (PPP_CHECK_CB(on_NtCreateDebugObject_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
-if (PPP_CHECK_CB(on_NtCreateDebugObject_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtCreateDebugObject_return, rp.proc_id, pc, 33, env,pc,arg0,arg1,arg2,arg3) ; 
 }
-PPP_RUN_CB(on_NtCreateDebugObject_return, env,pc,arg0,arg1,arg2,arg3) ; 
 }; break;
 // 34 NTSTATUS NtCreateDirectoryObject ['PHANDLE DirectoryHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
 case 34: {
+if (PPP_CHECK_CB(on_NtCreateDirectoryObject_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
-if (PPP_CHECK_CB(on_NtCreateDirectoryObject_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtCreateDirectoryObject_return, rp.proc_id, pc, 34, env,pc,arg0,arg1,arg2) ; 
 }
-PPP_RUN_CB(on_NtCreateDirectoryObject_return, env,pc,arg0,arg1,arg2) ; 
 }; break;
 // 35 NTSTATUS NtCreateEvent ['PHANDLE EventHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' EVENT_TYPE EventType', ' BOOLEAN InitialState']
 case 35: {
+if (PPP_CHECK_CB(on_NtCreateEvent_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
-if (PPP_CHECK_CB(on_NtCreateEvent_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtCreateEvent_return, rp.proc_id, pc, 35, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }
-PPP_RUN_CB(on_NtCreateEvent_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }; break;
 // 36 NTSTATUS NtCreateEventPair ['PHANDLE EventPairHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
 case 36: {
+if (PPP_CHECK_CB(on_NtCreateEventPair_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
-if (PPP_CHECK_CB(on_NtCreateEventPair_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtCreateEventPair_return, rp.proc_id, pc, 36, env,pc,arg0,arg1,arg2) ; 
 }
-PPP_RUN_CB(on_NtCreateEventPair_return, env,pc,arg0,arg1,arg2) ; 
 }; break;
 // 37 NTSTATUS NtCreateFile ['PHANDLE FileHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PIO_STATUS_BLOCK IoStatusBlock', ' PLARGE_INTEGER AllocationSize', ' ULONG FileAttributes', ' ULONG ShareAccess', ' ULONG CreateDisposition', ' ULONG CreateOptions', ' PVOID EaBuffer', ' ULONG EaLength']
 case 37: {
+if (PPP_CHECK_CB(on_NtCreateFile_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
@@ -609,7 +610,6 @@ uint32_t arg7;
 uint32_t arg8;
 uint32_t arg9;
 uint32_t arg10;
-if (PPP_CHECK_CB(on_NtCreateFile_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
@@ -621,49 +621,50 @@ memcpy(&arg7, rp.params[7], sizeof(uint32_t));
 memcpy(&arg8, rp.params[8], sizeof(uint32_t));
 memcpy(&arg9, rp.params[9], sizeof(uint32_t));
 memcpy(&arg10, rp.params[10], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtCreateFile_return, rp.proc_id, pc, 37, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10) ; 
 }
-PPP_RUN_CB(on_NtCreateFile_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10) ; 
 }; break;
 // 38 NTSTATUS NtCreateIoCompletion ['PHANDLE IoCompletionHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' ULONG Count']
 case 38: {
+if (PPP_CHECK_CB(on_NtCreateIoCompletion_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
-if (PPP_CHECK_CB(on_NtCreateIoCompletion_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtCreateIoCompletion_return, rp.proc_id, pc, 38, env,pc,arg0,arg1,arg2,arg3) ; 
 }
-PPP_RUN_CB(on_NtCreateIoCompletion_return, env,pc,arg0,arg1,arg2,arg3) ; 
 }; break;
 // 39 NTSTATUS NtCreateJobObject ['PHANDLE JobHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
 case 39: {
+if (PPP_CHECK_CB(on_NtCreateJobObject_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
-if (PPP_CHECK_CB(on_NtCreateJobObject_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtCreateJobObject_return, rp.proc_id, pc, 39, env,pc,arg0,arg1,arg2) ; 
 }
-PPP_RUN_CB(on_NtCreateJobObject_return, env,pc,arg0,arg1,arg2) ; 
 }; break;
 // 40 NTSTATUS NtCreateJobSet ['ULONG NumJob', ' PJOB_SET_ARRAY UserJobSet', ' ULONG Flags']
 case 40: {
+if (PPP_CHECK_CB(on_NtCreateJobSet_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
-if (PPP_CHECK_CB(on_NtCreateJobSet_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtCreateJobSet_return, rp.proc_id, pc, 40, env,pc,arg0,arg1,arg2) ; 
 }
-PPP_RUN_CB(on_NtCreateJobSet_return, env,pc,arg0,arg1,arg2) ; 
 }; break;
 // 41 NTSTATUS NtCreateKey ['PHANDLE KeyHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' ULONG TitleIndex', ' PUNICODE_STRING Class', ' ULONG CreateOptions', ' PULONG Disposition']
 case 41: {
+if (PPP_CHECK_CB(on_NtCreateKey_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
@@ -671,7 +672,6 @@ uint32_t arg3;
 uint32_t arg4;
 uint32_t arg5;
 uint32_t arg6;
-if (PPP_CHECK_CB(on_NtCreateKey_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
@@ -679,11 +679,12 @@ memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
 memcpy(&arg5, rp.params[5], sizeof(uint32_t));
 memcpy(&arg6, rp.params[6], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtCreateKey_return, rp.proc_id, pc, 41, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
 }
-PPP_RUN_CB(on_NtCreateKey_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
 }; break;
 // 42 NTSTATUS NtCreateMailslotFile ['PHANDLE FileHandle', ' ULONG DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PIO_STATUS_BLOCK IoStatusBlock', ' ULONG CreateOptions', ' ULONG MailslotQuota', ' ULONG MaximumMessageSize', ' PLARGE_INTEGER ReadTimeout']
 case 42: {
+if (PPP_CHECK_CB(on_NtCreateMailslotFile_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
@@ -692,7 +693,6 @@ uint32_t arg4;
 uint32_t arg5;
 uint32_t arg6;
 uint32_t arg7;
-if (PPP_CHECK_CB(on_NtCreateMailslotFile_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
@@ -701,25 +701,26 @@ memcpy(&arg4, rp.params[4], sizeof(uint32_t));
 memcpy(&arg5, rp.params[5], sizeof(uint32_t));
 memcpy(&arg6, rp.params[6], sizeof(uint32_t));
 memcpy(&arg7, rp.params[7], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtCreateMailslotFile_return, rp.proc_id, pc, 42, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
 }
-PPP_RUN_CB(on_NtCreateMailslotFile_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
 }; break;
 // 43 NTSTATUS NtCreateMutant ['PHANDLE MutantHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' BOOLEAN InitialOwner']
 case 43: {
+if (PPP_CHECK_CB(on_NtCreateMutant_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
-if (PPP_CHECK_CB(on_NtCreateMutant_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtCreateMutant_return, rp.proc_id, pc, 43, env,pc,arg0,arg1,arg2,arg3) ; 
 }
-PPP_RUN_CB(on_NtCreateMutant_return, env,pc,arg0,arg1,arg2,arg3) ; 
 }; break;
 // 44 NTSTATUS NtCreateNamedPipeFile ['PHANDLE FileHandle', ' ULONG DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PIO_STATUS_BLOCK IoStatusBlock', ' ULONG ShareAccess', ' ULONG CreateDisposition', ' ULONG CreateOptions', ' ULONG NamedPipeType', ' ULONG ReadMode', ' ULONG CompletionMode', ' ULONG MaximumInstances', ' ULONG InboundQuota', ' ULONG OutboundQuota', ' PLARGE_INTEGER DefaultTimeout']
 case 44: {
+if (PPP_CHECK_CB(on_NtCreateNamedPipeFile_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
@@ -734,7 +735,6 @@ uint32_t arg10;
 uint32_t arg11;
 uint32_t arg12;
 uint32_t arg13;
-if (PPP_CHECK_CB(on_NtCreateNamedPipeFile_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
@@ -749,41 +749,42 @@ memcpy(&arg10, rp.params[10], sizeof(uint32_t));
 memcpy(&arg11, rp.params[11], sizeof(uint32_t));
 memcpy(&arg12, rp.params[12], sizeof(uint32_t));
 memcpy(&arg13, rp.params[13], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtCreateNamedPipeFile_return, rp.proc_id, pc, 44, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11,arg12,arg13) ; 
 }
-PPP_RUN_CB(on_NtCreateNamedPipeFile_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11,arg12,arg13) ; 
 }; break;
 // 45 NTSTATUS NtCreatePagingFile ['PUNICODE_STRING PageFileName', ' PLARGE_INTEGER MinimumSize', ' PLARGE_INTEGER MaximumSize', ' ULONG Priority']
 case 45: {
+if (PPP_CHECK_CB(on_NtCreatePagingFile_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
-if (PPP_CHECK_CB(on_NtCreatePagingFile_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtCreatePagingFile_return, rp.proc_id, pc, 45, env,pc,arg0,arg1,arg2,arg3) ; 
 }
-PPP_RUN_CB(on_NtCreatePagingFile_return, env,pc,arg0,arg1,arg2,arg3) ; 
 }; break;
 // 46 NTSTATUS NtCreatePort ['PHANDLE PortHandle', ' POBJECT_ATTRIBUTES ObjectAttributes', ' ULONG MaxConnectionInfoLength', ' ULONG MaxMessageLength', ' ULONG MaxPoolUsage']
 case 46: {
+if (PPP_CHECK_CB(on_NtCreatePort_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
-if (PPP_CHECK_CB(on_NtCreatePort_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtCreatePort_return, rp.proc_id, pc, 46, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }
-PPP_RUN_CB(on_NtCreatePort_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }; break;
 // 47 NTSTATUS NtCreateProcess ['PHANDLE ProcessHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' HANDLE ParentProcess', ' BOOLEAN InheritObjectTable', ' HANDLE SectionHandle', ' HANDLE DebugPort', ' HANDLE ExceptionPort']
 case 47: {
+if (PPP_CHECK_CB(on_NtCreateProcess_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
@@ -792,7 +793,6 @@ uint32_t arg4;
 uint32_t arg5;
 uint32_t arg6;
 uint32_t arg7;
-if (PPP_CHECK_CB(on_NtCreateProcess_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
@@ -801,11 +801,12 @@ memcpy(&arg4, rp.params[4], sizeof(uint32_t));
 memcpy(&arg5, rp.params[5], sizeof(uint32_t));
 memcpy(&arg6, rp.params[6], sizeof(uint32_t));
 memcpy(&arg7, rp.params[7], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtCreateProcess_return, rp.proc_id, pc, 47, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
 }
-PPP_RUN_CB(on_NtCreateProcess_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
 }; break;
 // 48 NTSTATUS NtCreateProcessEx ['PHANDLE ProcessHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' HANDLE ParentProcess', ' ULONG Flags', ' HANDLE SectionHandle', ' HANDLE DebugPort', ' HANDLE ExceptionPort', ' ULONG JobMemberLevel']
 case 48: {
+if (PPP_CHECK_CB(on_NtCreateProcessEx_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
@@ -815,7 +816,6 @@ uint32_t arg5;
 uint32_t arg6;
 uint32_t arg7;
 uint32_t arg8;
-if (PPP_CHECK_CB(on_NtCreateProcessEx_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
@@ -825,11 +825,12 @@ memcpy(&arg5, rp.params[5], sizeof(uint32_t));
 memcpy(&arg6, rp.params[6], sizeof(uint32_t));
 memcpy(&arg7, rp.params[7], sizeof(uint32_t));
 memcpy(&arg8, rp.params[8], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtCreateProcessEx_return, rp.proc_id, pc, 48, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
 }
-PPP_RUN_CB(on_NtCreateProcessEx_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
 }; break;
 // 49 NTSTATUS NtCreateProfile ['PHANDLE ProfileHandle', ' HANDLE Process', ' PVOID RangeBase', ' SIZE_T RangeSize', ' ULONG BucketSize', ' PULONG Buffer', ' ULONG BufferSize', ' KPROFILE_SOURCE ProfileSource', ' KAFFINITY Affinity']
 case 49: {
+if (PPP_CHECK_CB(on_NtCreateProfile_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
@@ -839,7 +840,6 @@ uint32_t arg5;
 uint32_t arg6;
 uint32_t arg7;
 uint32_t arg8;
-if (PPP_CHECK_CB(on_NtCreateProfile_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
@@ -849,11 +849,12 @@ memcpy(&arg5, rp.params[5], sizeof(uint32_t));
 memcpy(&arg6, rp.params[6], sizeof(uint32_t));
 memcpy(&arg7, rp.params[7], sizeof(uint32_t));
 memcpy(&arg8, rp.params[8], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtCreateProfile_return, rp.proc_id, pc, 49, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
 }
-PPP_RUN_CB(on_NtCreateProfile_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
 }; break;
 // 50 NTSTATUS NtCreateSection ['PHANDLE SectionHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PLARGE_INTEGER MaximumSize', ' ULONG SectionPageProtection', ' ULONG AllocationAttributes', ' HANDLE FileHandle']
 case 50: {
+if (PPP_CHECK_CB(on_NtCreateSection_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
@@ -861,7 +862,6 @@ uint32_t arg3;
 uint32_t arg4;
 uint32_t arg5;
 uint32_t arg6;
-if (PPP_CHECK_CB(on_NtCreateSection_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
@@ -869,41 +869,42 @@ memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
 memcpy(&arg5, rp.params[5], sizeof(uint32_t));
 memcpy(&arg6, rp.params[6], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtCreateSection_return, rp.proc_id, pc, 50, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
 }
-PPP_RUN_CB(on_NtCreateSection_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
 }; break;
 // 51 NTSTATUS NtCreateSemaphore ['PHANDLE SemaphoreHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' LONG InitialCount', ' LONG MaximumCount']
 case 51: {
+if (PPP_CHECK_CB(on_NtCreateSemaphore_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 int32_t arg3;
 int32_t arg4;
-if (PPP_CHECK_CB(on_NtCreateSemaphore_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(int32_t));
 memcpy(&arg4, rp.params[4], sizeof(int32_t));
+PPP_RUN_CB_FILTERED(on_NtCreateSemaphore_return, rp.proc_id, pc, 51, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }
-PPP_RUN_CB(on_NtCreateSemaphore_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }; break;
 // 52 NTSTATUS NtCreateSymbolicLinkObject ['PHANDLE LinkHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PUNICODE_STRING LinkTarget']
 case 52: {
+if (PPP_CHECK_CB(on_NtCreateSymbolicLinkObject_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
-if (PPP_CHECK_CB(on_NtCreateSymbolicLinkObject_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtCreateSymbolicLinkObject_return, rp.proc_id, pc, 52, env,pc,arg0,arg1,arg2,arg3) ; 
 }
-PPP_RUN_CB(on_NtCreateSymbolicLinkObject_return, env,pc,arg0,arg1,arg2,arg3) ; 
 }; break;
 // 53 NTSTATUS NtCreateThread ['PHANDLE ThreadHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' HANDLE ProcessHandle', ' PCLIENT_ID ClientId', ' PCONTEXT ThreadContext', ' PINITIAL_TEB InitialTeb', ' BOOLEAN CreateSuspended']
 case 53: {
+if (PPP_CHECK_CB(on_NtCreateThread_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
@@ -912,7 +913,6 @@ uint32_t arg4;
 uint32_t arg5;
 uint32_t arg6;
 uint32_t arg7;
-if (PPP_CHECK_CB(on_NtCreateThread_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
@@ -921,25 +921,26 @@ memcpy(&arg4, rp.params[4], sizeof(uint32_t));
 memcpy(&arg5, rp.params[5], sizeof(uint32_t));
 memcpy(&arg6, rp.params[6], sizeof(uint32_t));
 memcpy(&arg7, rp.params[7], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtCreateThread_return, rp.proc_id, pc, 53, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
 }
-PPP_RUN_CB(on_NtCreateThread_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7) ; 
 }; break;
 // 54 NTSTATUS NtCreateTimer ['PHANDLE TimerHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' TIMER_TYPE TimerType']
 case 54: {
+if (PPP_CHECK_CB(on_NtCreateTimer_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
-if (PPP_CHECK_CB(on_NtCreateTimer_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtCreateTimer_return, rp.proc_id, pc, 54, env,pc,arg0,arg1,arg2,arg3) ; 
 }
-PPP_RUN_CB(on_NtCreateTimer_return, env,pc,arg0,arg1,arg2,arg3) ; 
 }; break;
 // 55 NTSTATUS NtCreateToken ['PHANDLE TokenHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' TOKEN_TYPE TokenType', ' PLUID AuthenticationId', ' PLARGE_INTEGER ExpirationTime', ' PTOKEN_USER User', ' PTOKEN_GROUPS Groups', ' PTOKEN_PRIVILEGES Privileges', ' PTOKEN_OWNER Owner', ' PTOKEN_PRIMARY_GROUP PrimaryGroup', ' PTOKEN_DEFAULT_DACL DefaultDacl', ' PTOKEN_SOURCE TokenSource']
 case 55: {
+if (PPP_CHECK_CB(on_NtCreateToken_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
@@ -953,7 +954,6 @@ uint32_t arg9;
 uint32_t arg10;
 uint32_t arg11;
 uint32_t arg12;
-if (PPP_CHECK_CB(on_NtCreateToken_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
@@ -967,105 +967,106 @@ memcpy(&arg9, rp.params[9], sizeof(uint32_t));
 memcpy(&arg10, rp.params[10], sizeof(uint32_t));
 memcpy(&arg11, rp.params[11], sizeof(uint32_t));
 memcpy(&arg12, rp.params[12], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtCreateToken_return, rp.proc_id, pc, 55, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11,arg12) ; 
 }
-PPP_RUN_CB(on_NtCreateToken_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11,arg12) ; 
 }; break;
 // 56 NTSTATUS NtCreateWaitablePort ['PHANDLE PortHandle', ' POBJECT_ATTRIBUTES ObjectAttributes', ' ULONG MaxConnectionInfoLength', ' ULONG MaxMessageLength', ' ULONG MaxPoolUsage']
 case 56: {
+if (PPP_CHECK_CB(on_NtCreateWaitablePort_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
-if (PPP_CHECK_CB(on_NtCreateWaitablePort_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtCreateWaitablePort_return, rp.proc_id, pc, 56, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }
-PPP_RUN_CB(on_NtCreateWaitablePort_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }; break;
 // 57 NTSTATUS NtDebugActiveProcess ['HANDLE ProcessHandle', ' HANDLE DebugObjectHandle']
 case 57: {
+if (PPP_CHECK_CB(on_NtDebugActiveProcess_return)) {
 uint32_t arg0;
 uint32_t arg1;
-if (PPP_CHECK_CB(on_NtDebugActiveProcess_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtDebugActiveProcess_return, rp.proc_id, pc, 57, env,pc,arg0,arg1) ; 
 }
-PPP_RUN_CB(on_NtDebugActiveProcess_return, env,pc,arg0,arg1) ; 
 }; break;
 // 58 NTSTATUS NtDebugContinue ['HANDLE DebugObjectHandle', ' PCLIENT_ID ClientId', ' NTSTATUS ContinueStatus']
 case 58: {
+if (PPP_CHECK_CB(on_NtDebugContinue_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
-if (PPP_CHECK_CB(on_NtDebugContinue_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtDebugContinue_return, rp.proc_id, pc, 58, env,pc,arg0,arg1,arg2) ; 
 }
-PPP_RUN_CB(on_NtDebugContinue_return, env,pc,arg0,arg1,arg2) ; 
 }; break;
 // 59 NTSTATUS NtDelayExecution ['BOOLEAN Alertable', ' PLARGE_INTEGER DelayInterval']
 case 59: {
+if (PPP_CHECK_CB(on_NtDelayExecution_return)) {
 uint32_t arg0;
 uint32_t arg1;
-if (PPP_CHECK_CB(on_NtDelayExecution_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtDelayExecution_return, rp.proc_id, pc, 59, env,pc,arg0,arg1) ; 
 }
-PPP_RUN_CB(on_NtDelayExecution_return, env,pc,arg0,arg1) ; 
 }; break;
 // 60 NTSTATUS NtDeleteAtom ['RTL_ATOM Atom']
 case 60: {
-uint32_t arg0;
 if (PPP_CHECK_CB(on_NtDeleteAtom_return)) {
+uint32_t arg0;
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtDeleteAtom_return, rp.proc_id, pc, 60, env,pc,arg0) ; 
 }
-PPP_RUN_CB(on_NtDeleteAtom_return, env,pc,arg0) ; 
 }; break;
 // 61 NTSTATUS NtDeleteFile ['POBJECT_ATTRIBUTES ObjectAttributes']
 case 61: {
-uint32_t arg0;
 if (PPP_CHECK_CB(on_NtDeleteFile_return)) {
+uint32_t arg0;
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtDeleteFile_return, rp.proc_id, pc, 61, env,pc,arg0) ; 
 }
-PPP_RUN_CB(on_NtDeleteFile_return, env,pc,arg0) ; 
 }; break;
 // 62 NTSTATUS NtDeleteKey ['HANDLE KeyHandle']
 case 62: {
-uint32_t arg0;
 if (PPP_CHECK_CB(on_NtDeleteKey_return)) {
+uint32_t arg0;
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtDeleteKey_return, rp.proc_id, pc, 62, env,pc,arg0) ; 
 }
-PPP_RUN_CB(on_NtDeleteKey_return, env,pc,arg0) ; 
 }; break;
 // 63 NTSTATUS NtDeleteObjectAuditAlarm ['PUNICODE_STRING SubsystemName', ' PVOID HandleId', ' BOOLEAN GenerateOnClose']
 case 63: {
+if (PPP_CHECK_CB(on_NtDeleteObjectAuditAlarm_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
-if (PPP_CHECK_CB(on_NtDeleteObjectAuditAlarm_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtDeleteObjectAuditAlarm_return, rp.proc_id, pc, 63, env,pc,arg0,arg1,arg2) ; 
 }
-PPP_RUN_CB(on_NtDeleteObjectAuditAlarm_return, env,pc,arg0,arg1,arg2) ; 
 }; break;
 // 64 NTSTATUS NtDeleteValueKey ['HANDLE KeyHandle', ' PUNICODE_STRING ValueName']
 case 64: {
+if (PPP_CHECK_CB(on_NtDeleteValueKey_return)) {
 uint32_t arg0;
 uint32_t arg1;
-if (PPP_CHECK_CB(on_NtDeleteValueKey_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtDeleteValueKey_return, rp.proc_id, pc, 64, env,pc,arg0,arg1) ; 
 }
-PPP_RUN_CB(on_NtDeleteValueKey_return, env,pc,arg0,arg1) ; 
 }; break;
 // 65 NTSTATUS NtDeviceIoControlFile ['HANDLE FileHandle', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' ULONG IoControlCode', ' PVOID InputBuffer', ' ULONG InputBufferLength', ' PVOID OutputBuffer', ' ULONG OutputBufferLength']
 case 65: {
+if (PPP_CHECK_CB(on_NtDeviceIoControlFile_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
@@ -1076,7 +1077,6 @@ uint32_t arg6;
 uint32_t arg7;
 uint32_t arg8;
 uint32_t arg9;
-if (PPP_CHECK_CB(on_NtDeviceIoControlFile_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
@@ -1087,19 +1087,20 @@ memcpy(&arg6, rp.params[6], sizeof(uint32_t));
 memcpy(&arg7, rp.params[7], sizeof(uint32_t));
 memcpy(&arg8, rp.params[8], sizeof(uint32_t));
 memcpy(&arg9, rp.params[9], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtDeviceIoControlFile_return, rp.proc_id, pc, 65, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9) ; 
 }
-PPP_RUN_CB(on_NtDeviceIoControlFile_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9) ; 
 }; break;
 // 66 NTSTATUS NtDisplayString ['PUNICODE_STRING String']
 case 66: {
-uint32_t arg0;
 if (PPP_CHECK_CB(on_NtDisplayString_return)) {
+uint32_t arg0;
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtDisplayString_return, rp.proc_id, pc, 66, env,pc,arg0) ; 
 }
-PPP_RUN_CB(on_NtDisplayString_return, env,pc,arg0) ; 
 }; break;
 // 67 NTSTATUS NtDuplicateObject ['HANDLE SourceProcessHandle', ' HANDLE SourceHandle', ' HANDLE TargetProcessHandle', ' PHANDLE TargetHandle', ' ACCESS_MASK DesiredAccess', ' ULONG HandleAttributes', ' ULONG Options']
 case 67: {
+if (PPP_CHECK_CB(on_NtDuplicateObject_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
@@ -1107,7 +1108,6 @@ uint32_t arg3;
 uint32_t arg4;
 uint32_t arg5;
 uint32_t arg6;
-if (PPP_CHECK_CB(on_NtDuplicateObject_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
@@ -1115,193 +1115,194 @@ memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
 memcpy(&arg5, rp.params[5], sizeof(uint32_t));
 memcpy(&arg6, rp.params[6], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtDuplicateObject_return, rp.proc_id, pc, 67, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
 }
-PPP_RUN_CB(on_NtDuplicateObject_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
 }; break;
 // 68 NTSTATUS NtDuplicateToken ['HANDLE ExistingTokenHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' BOOLEAN EffectiveOnly', ' TOKEN_TYPE TokenType', ' PHANDLE NewTokenHandle']
 case 68: {
+if (PPP_CHECK_CB(on_NtDuplicateToken_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
 uint32_t arg5;
-if (PPP_CHECK_CB(on_NtDuplicateToken_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
 memcpy(&arg5, rp.params[5], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtDuplicateToken_return, rp.proc_id, pc, 68, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
 }
-PPP_RUN_CB(on_NtDuplicateToken_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
 }; break;
 // 69 NTSTATUS NtEnumerateKey ['HANDLE KeyHandle', ' ULONG Index', ' KEY_INFORMATION_CLASS KeyInformationClass', ' PVOID KeyInformation', ' ULONG Length', ' PULONG ResultLength']
 case 69: {
+if (PPP_CHECK_CB(on_NtEnumerateKey_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
 uint32_t arg5;
-if (PPP_CHECK_CB(on_NtEnumerateKey_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
 memcpy(&arg5, rp.params[5], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtEnumerateKey_return, rp.proc_id, pc, 69, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
 }
-PPP_RUN_CB(on_NtEnumerateKey_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
 }; break;
 // 70 NTSTATUS NtEnumerateSystemEnvironmentValuesEx ['ULONG InformationClass', ' PVOID Buffer', ' PULONG BufferLength']
 case 70: {
+if (PPP_CHECK_CB(on_NtEnumerateSystemEnvironmentValuesEx_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
-if (PPP_CHECK_CB(on_NtEnumerateSystemEnvironmentValuesEx_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtEnumerateSystemEnvironmentValuesEx_return, rp.proc_id, pc, 70, env,pc,arg0,arg1,arg2) ; 
 }
-PPP_RUN_CB(on_NtEnumerateSystemEnvironmentValuesEx_return, env,pc,arg0,arg1,arg2) ; 
 }; break;
 // 71 NTSTATUS NtEnumerateValueKey ['HANDLE KeyHandle', ' ULONG Index', ' KEY_VALUE_INFORMATION_CLASS KeyValueInformationClass', ' PVOID KeyValueInformation', ' ULONG Length', ' PULONG ResultLength']
 case 71: {
+if (PPP_CHECK_CB(on_NtEnumerateValueKey_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
 uint32_t arg5;
-if (PPP_CHECK_CB(on_NtEnumerateValueKey_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
 memcpy(&arg5, rp.params[5], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtEnumerateValueKey_return, rp.proc_id, pc, 71, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
 }
-PPP_RUN_CB(on_NtEnumerateValueKey_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
 }; break;
 // 72 NTSTATUS NtExtendSection ['HANDLE SectionHandle', ' PLARGE_INTEGER NewSectionSize']
 case 72: {
+if (PPP_CHECK_CB(on_NtExtendSection_return)) {
 uint32_t arg0;
 uint32_t arg1;
-if (PPP_CHECK_CB(on_NtExtendSection_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtExtendSection_return, rp.proc_id, pc, 72, env,pc,arg0,arg1) ; 
 }
-PPP_RUN_CB(on_NtExtendSection_return, env,pc,arg0,arg1) ; 
 }; break;
 // 73 NTSTATUS NtFilterToken ['HANDLE ExistingTokenHandle', ' ULONG Flags', ' PTOKEN_GROUPS SidsToDisable', ' PTOKEN_PRIVILEGES PrivilegesToDelete', ' PTOKEN_GROUPS RestrictedSids', ' PHANDLE NewTokenHandle']
 case 73: {
+if (PPP_CHECK_CB(on_NtFilterToken_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
 uint32_t arg5;
-if (PPP_CHECK_CB(on_NtFilterToken_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
 memcpy(&arg5, rp.params[5], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtFilterToken_return, rp.proc_id, pc, 73, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
 }
-PPP_RUN_CB(on_NtFilterToken_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
 }; break;
 // 74 NTSTATUS NtFindAtom ['PWSTR AtomName', ' ULONG Length', ' PRTL_ATOM Atom']
 case 74: {
+if (PPP_CHECK_CB(on_NtFindAtom_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
-if (PPP_CHECK_CB(on_NtFindAtom_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtFindAtom_return, rp.proc_id, pc, 74, env,pc,arg0,arg1,arg2) ; 
 }
-PPP_RUN_CB(on_NtFindAtom_return, env,pc,arg0,arg1,arg2) ; 
 }; break;
 // 75 NTSTATUS NtFlushBuffersFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock']
 case 75: {
+if (PPP_CHECK_CB(on_NtFlushBuffersFile_return)) {
 uint32_t arg0;
 uint32_t arg1;
-if (PPP_CHECK_CB(on_NtFlushBuffersFile_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtFlushBuffersFile_return, rp.proc_id, pc, 75, env,pc,arg0,arg1) ; 
 }
-PPP_RUN_CB(on_NtFlushBuffersFile_return, env,pc,arg0,arg1) ; 
 }; break;
 // 76 NTSTATUS NtFlushInstructionCache ['HANDLE ProcessHandle', ' PVOID BaseAddress', ' SIZE_T Length']
 case 76: {
+if (PPP_CHECK_CB(on_NtFlushInstructionCache_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
-if (PPP_CHECK_CB(on_NtFlushInstructionCache_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtFlushInstructionCache_return, rp.proc_id, pc, 76, env,pc,arg0,arg1,arg2) ; 
 }
-PPP_RUN_CB(on_NtFlushInstructionCache_return, env,pc,arg0,arg1,arg2) ; 
 }; break;
 // 77 NTSTATUS NtFlushKey ['HANDLE KeyHandle']
 case 77: {
-uint32_t arg0;
 if (PPP_CHECK_CB(on_NtFlushKey_return)) {
+uint32_t arg0;
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtFlushKey_return, rp.proc_id, pc, 77, env,pc,arg0) ; 
 }
-PPP_RUN_CB(on_NtFlushKey_return, env,pc,arg0) ; 
 }; break;
 // 78 NTSTATUS NtFlushVirtualMemory ['HANDLE ProcessHandle', ' PVOID *BaseAddress', ' PSIZE_T RegionSize', ' PIO_STATUS_BLOCK IoStatus']
 case 78: {
+if (PPP_CHECK_CB(on_NtFlushVirtualMemory_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
-if (PPP_CHECK_CB(on_NtFlushVirtualMemory_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtFlushVirtualMemory_return, rp.proc_id, pc, 78, env,pc,arg0,arg1,arg2,arg3) ; 
 }
-PPP_RUN_CB(on_NtFlushVirtualMemory_return, env,pc,arg0,arg1,arg2,arg3) ; 
 }; break;
 // 79 NTSTATUS NtFlushWriteBuffer ['']
 case 79: {
 if (PPP_CHECK_CB(on_NtFlushWriteBuffer_return)) {
+PPP_RUN_CB_FILTERED(on_NtFlushWriteBuffer_return, rp.proc_id, pc, 79, env,pc) ; 
 }
-PPP_RUN_CB(on_NtFlushWriteBuffer_return, env,pc) ; 
 }; break;
 // 80 NTSTATUS NtFreeUserPhysicalPages ['HANDLE ProcessHandle', ' PULONG_PTR NumberOfPages', ' PULONG_PTR UserPfnArray']
 case 80: {
+if (PPP_CHECK_CB(on_NtFreeUserPhysicalPages_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
-if (PPP_CHECK_CB(on_NtFreeUserPhysicalPages_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtFreeUserPhysicalPages_return, rp.proc_id, pc, 80, env,pc,arg0,arg1,arg2) ; 
 }
-PPP_RUN_CB(on_NtFreeUserPhysicalPages_return, env,pc,arg0,arg1,arg2) ; 
 }; break;
 // 81 NTSTATUS NtFreeVirtualMemory ['HANDLE ProcessHandle', ' PVOID *BaseAddress', ' PSIZE_T RegionSize', ' ULONG FreeType']
 case 81: {
+if (PPP_CHECK_CB(on_NtFreeVirtualMemory_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
-if (PPP_CHECK_CB(on_NtFreeVirtualMemory_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtFreeVirtualMemory_return, rp.proc_id, pc, 81, env,pc,arg0,arg1,arg2,arg3) ; 
 }
-PPP_RUN_CB(on_NtFreeVirtualMemory_return, env,pc,arg0,arg1,arg2,arg3) ; 
 }; break;
 // 82 NTSTATUS NtFsControlFile ['HANDLE FileHandle', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' ULONG IoControlCode', ' PVOID InputBuffer', ' ULONG InputBufferLength', ' PVOID OutputBuffer', ' ULONG OutputBufferLength']
 case 82: {
+if (PPP_CHECK_CB(on_NtFsControlFile_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
@@ -1312,7 +1313,6 @@ uint32_t arg6;
 uint32_t arg7;
 uint32_t arg8;
 uint32_t arg9;
-if (PPP_CHECK_CB(on_NtFsControlFile_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
@@ -1323,45 +1323,46 @@ memcpy(&arg6, rp.params[6], sizeof(uint32_t));
 memcpy(&arg7, rp.params[7], sizeof(uint32_t));
 memcpy(&arg8, rp.params[8], sizeof(uint32_t));
 memcpy(&arg9, rp.params[9], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtFsControlFile_return, rp.proc_id, pc, 82, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9) ; 
 }
-PPP_RUN_CB(on_NtFsControlFile_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9) ; 
 }; break;
 // 83 NTSTATUS NtGetContextThread ['HANDLE ThreadHandle', ' PCONTEXT ThreadContext']
 case 83: {
+if (PPP_CHECK_CB(on_NtGetContextThread_return)) {
 uint32_t arg0;
 uint32_t arg1;
-if (PPP_CHECK_CB(on_NtGetContextThread_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtGetContextThread_return, rp.proc_id, pc, 83, env,pc,arg0,arg1) ; 
 }
-PPP_RUN_CB(on_NtGetContextThread_return, env,pc,arg0,arg1) ; 
 }; break;
 // 84 NTSTATUS NtGetDevicePowerState ['HANDLE Device', ' DEVICE_POWER_STATE *State']
 case 84: {
+if (PPP_CHECK_CB(on_NtGetDevicePowerState_return)) {
 uint32_t arg0;
 uint32_t arg1;
-if (PPP_CHECK_CB(on_NtGetDevicePowerState_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtGetDevicePowerState_return, rp.proc_id, pc, 84, env,pc,arg0,arg1) ; 
 }
-PPP_RUN_CB(on_NtGetDevicePowerState_return, env,pc,arg0,arg1) ; 
 }; break;
 // 85 NTSTATUS NtGetPlugPlayEvent ['HANDLE EventHandle', ' PVOID Context', ' PPLUGPLAY_EVENT_BLOCK EventBlock', ' ULONG EventBufferSize']
 case 85: {
+if (PPP_CHECK_CB(on_NtGetPlugPlayEvent_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
-if (PPP_CHECK_CB(on_NtGetPlugPlayEvent_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtGetPlugPlayEvent_return, rp.proc_id, pc, 85, env,pc,arg0,arg1,arg2,arg3) ; 
 }
-PPP_RUN_CB(on_NtGetPlugPlayEvent_return, env,pc,arg0,arg1,arg2,arg3) ; 
 }; break;
 // 86 NTSTATUS NtGetWriteWatch ['HANDLE ProcessHandle', ' ULONG Flags', ' PVOID BaseAddress', ' SIZE_T RegionSize', ' PVOID *UserAddressArray', ' PULONG_PTR EntriesInUserAddressArray', ' PULONG Granularity']
 case 86: {
+if (PPP_CHECK_CB(on_NtGetWriteWatch_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
@@ -1369,7 +1370,6 @@ uint32_t arg3;
 uint32_t arg4;
 uint32_t arg5;
 uint32_t arg6;
-if (PPP_CHECK_CB(on_NtGetWriteWatch_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
@@ -1377,119 +1377,120 @@ memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
 memcpy(&arg5, rp.params[5], sizeof(uint32_t));
 memcpy(&arg6, rp.params[6], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtGetWriteWatch_return, rp.proc_id, pc, 86, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
 }
-PPP_RUN_CB(on_NtGetWriteWatch_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
 }; break;
 // 87 NTSTATUS NtImpersonateAnonymousToken ['HANDLE ThreadHandle']
 case 87: {
-uint32_t arg0;
 if (PPP_CHECK_CB(on_NtImpersonateAnonymousToken_return)) {
+uint32_t arg0;
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtImpersonateAnonymousToken_return, rp.proc_id, pc, 87, env,pc,arg0) ; 
 }
-PPP_RUN_CB(on_NtImpersonateAnonymousToken_return, env,pc,arg0) ; 
 }; break;
 // 88 NTSTATUS NtImpersonateClientOfPort ['HANDLE PortHandle', ' PPORT_MESSAGE Message']
 case 88: {
+if (PPP_CHECK_CB(on_NtImpersonateClientOfPort_return)) {
 uint32_t arg0;
 uint32_t arg1;
-if (PPP_CHECK_CB(on_NtImpersonateClientOfPort_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtImpersonateClientOfPort_return, rp.proc_id, pc, 88, env,pc,arg0,arg1) ; 
 }
-PPP_RUN_CB(on_NtImpersonateClientOfPort_return, env,pc,arg0,arg1) ; 
 }; break;
 // 89 NTSTATUS NtImpersonateThread ['HANDLE ServerThreadHandle', ' HANDLE ClientThreadHandle', ' PSECURITY_QUALITY_OF_SERVICE SecurityQos']
 case 89: {
+if (PPP_CHECK_CB(on_NtImpersonateThread_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
-if (PPP_CHECK_CB(on_NtImpersonateThread_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtImpersonateThread_return, rp.proc_id, pc, 89, env,pc,arg0,arg1,arg2) ; 
 }
-PPP_RUN_CB(on_NtImpersonateThread_return, env,pc,arg0,arg1,arg2) ; 
 }; break;
 // 90 NTSTATUS NtInitializeRegistry ['USHORT BootCondition']
 case 90: {
-uint32_t arg0;
 if (PPP_CHECK_CB(on_NtInitializeRegistry_return)) {
+uint32_t arg0;
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtInitializeRegistry_return, rp.proc_id, pc, 90, env,pc,arg0) ; 
 }
-PPP_RUN_CB(on_NtInitializeRegistry_return, env,pc,arg0) ; 
 }; break;
 // 91 NTSTATUS NtInitiatePowerAction ['POWER_ACTION SystemAction', ' SYSTEM_POWER_STATE MinSystemState', ' ULONG Flags', ' BOOLEAN Asynchronous']
 case 91: {
+if (PPP_CHECK_CB(on_NtInitiatePowerAction_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
-if (PPP_CHECK_CB(on_NtInitiatePowerAction_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtInitiatePowerAction_return, rp.proc_id, pc, 91, env,pc,arg0,arg1,arg2,arg3) ; 
 }
-PPP_RUN_CB(on_NtInitiatePowerAction_return, env,pc,arg0,arg1,arg2,arg3) ; 
 }; break;
 // 92 NTSTATUS NtIsProcessInJob ['HANDLE ProcessHandle', ' HANDLE JobHandle']
 case 92: {
+if (PPP_CHECK_CB(on_NtIsProcessInJob_return)) {
 uint32_t arg0;
 uint32_t arg1;
-if (PPP_CHECK_CB(on_NtIsProcessInJob_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtIsProcessInJob_return, rp.proc_id, pc, 92, env,pc,arg0,arg1) ; 
 }
-PPP_RUN_CB(on_NtIsProcessInJob_return, env,pc,arg0,arg1) ; 
 }; break;
 // 93 BOOLEAN NtIsSystemResumeAutomatic ['']
 case 93: {
 if (PPP_CHECK_CB(on_NtIsSystemResumeAutomatic_return)) {
+PPP_RUN_CB_FILTERED(on_NtIsSystemResumeAutomatic_return, rp.proc_id, pc, 93, env,pc) ; 
 }
-PPP_RUN_CB(on_NtIsSystemResumeAutomatic_return, env,pc) ; 
 }; break;
 // 94 NTSTATUS NtListenPort ['HANDLE PortHandle', ' PPORT_MESSAGE ConnectionRequest']
 case 94: {
+if (PPP_CHECK_CB(on_NtListenPort_return)) {
 uint32_t arg0;
 uint32_t arg1;
-if (PPP_CHECK_CB(on_NtListenPort_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtListenPort_return, rp.proc_id, pc, 94, env,pc,arg0,arg1) ; 
 }
-PPP_RUN_CB(on_NtListenPort_return, env,pc,arg0,arg1) ; 
 }; break;
 // 95 NTSTATUS NtLoadDriver ['PUNICODE_STRING DriverServiceName']
 case 95: {
-uint32_t arg0;
 if (PPP_CHECK_CB(on_NtLoadDriver_return)) {
+uint32_t arg0;
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtLoadDriver_return, rp.proc_id, pc, 95, env,pc,arg0) ; 
 }
-PPP_RUN_CB(on_NtLoadDriver_return, env,pc,arg0) ; 
 }; break;
 // 96 NTSTATUS NtLoadKey ['POBJECT_ATTRIBUTES TargetKey', ' POBJECT_ATTRIBUTES SourceFile']
 case 96: {
+if (PPP_CHECK_CB(on_NtLoadKey_return)) {
 uint32_t arg0;
 uint32_t arg1;
-if (PPP_CHECK_CB(on_NtLoadKey_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtLoadKey_return, rp.proc_id, pc, 96, env,pc,arg0,arg1) ; 
 }
-PPP_RUN_CB(on_NtLoadKey_return, env,pc,arg0,arg1) ; 
 }; break;
 // 97 NTSTATUS NtLoadKey2 ['POBJECT_ATTRIBUTES TargetKey', ' POBJECT_ATTRIBUTES SourceFile', ' ULONG Flags']
 case 97: {
+if (PPP_CHECK_CB(on_NtLoadKey2_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
-if (PPP_CHECK_CB(on_NtLoadKey2_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtLoadKey2_return, rp.proc_id, pc, 97, env,pc,arg0,arg1,arg2) ; 
 }
-PPP_RUN_CB(on_NtLoadKey2_return, env,pc,arg0,arg1,arg2) ; 
 }; break;
 // 98 NTSTATUS NtLockFile ['HANDLE FileHandle', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' PLARGE_INTEGER ByteOffset', ' PLARGE_INTEGER Length', ' ULONG Key', ' BOOLEAN FailImmediately', ' BOOLEAN ExclusiveLock']
 case 98: {
+if (PPP_CHECK_CB(on_NtLockFile_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
@@ -1500,7 +1501,6 @@ uint32_t arg6;
 uint32_t arg7;
 uint32_t arg8;
 uint32_t arg9;
-if (PPP_CHECK_CB(on_NtLockFile_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
@@ -1511,83 +1511,84 @@ memcpy(&arg6, rp.params[6], sizeof(uint32_t));
 memcpy(&arg7, rp.params[7], sizeof(uint32_t));
 memcpy(&arg8, rp.params[8], sizeof(uint32_t));
 memcpy(&arg9, rp.params[9], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtLockFile_return, rp.proc_id, pc, 98, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9) ; 
 }
-PPP_RUN_CB(on_NtLockFile_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9) ; 
 }; break;
 // 99 NTSTATUS NtLockProductActivationKeys ['ULONG *pPrivateVer', ' ULONG *pSafeMode']
 case 99: {
+if (PPP_CHECK_CB(on_NtLockProductActivationKeys_return)) {
 uint32_t arg0;
 uint32_t arg1;
-if (PPP_CHECK_CB(on_NtLockProductActivationKeys_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtLockProductActivationKeys_return, rp.proc_id, pc, 99, env,pc,arg0,arg1) ; 
 }
-PPP_RUN_CB(on_NtLockProductActivationKeys_return, env,pc,arg0,arg1) ; 
 }; break;
 // 100 NTSTATUS NtLockRegistryKey ['HANDLE KeyHandle']
 case 100: {
-uint32_t arg0;
 if (PPP_CHECK_CB(on_NtLockRegistryKey_return)) {
+uint32_t arg0;
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtLockRegistryKey_return, rp.proc_id, pc, 100, env,pc,arg0) ; 
 }
-PPP_RUN_CB(on_NtLockRegistryKey_return, env,pc,arg0) ; 
 }; break;
 // 101 NTSTATUS NtLockVirtualMemory ['HANDLE ProcessHandle', ' PVOID *BaseAddress', ' PSIZE_T RegionSize', ' ULONG MapType']
 case 101: {
+if (PPP_CHECK_CB(on_NtLockVirtualMemory_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
-if (PPP_CHECK_CB(on_NtLockVirtualMemory_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtLockVirtualMemory_return, rp.proc_id, pc, 101, env,pc,arg0,arg1,arg2,arg3) ; 
 }
-PPP_RUN_CB(on_NtLockVirtualMemory_return, env,pc,arg0,arg1,arg2,arg3) ; 
 }; break;
 // 102 NTSTATUS NtMakePermanentObject ['HANDLE Handle']
 case 102: {
-uint32_t arg0;
 if (PPP_CHECK_CB(on_NtMakePermanentObject_return)) {
+uint32_t arg0;
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtMakePermanentObject_return, rp.proc_id, pc, 102, env,pc,arg0) ; 
 }
-PPP_RUN_CB(on_NtMakePermanentObject_return, env,pc,arg0) ; 
 }; break;
 // 103 NTSTATUS NtMakeTemporaryObject ['HANDLE Handle']
 case 103: {
-uint32_t arg0;
 if (PPP_CHECK_CB(on_NtMakeTemporaryObject_return)) {
+uint32_t arg0;
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtMakeTemporaryObject_return, rp.proc_id, pc, 103, env,pc,arg0) ; 
 }
-PPP_RUN_CB(on_NtMakeTemporaryObject_return, env,pc,arg0) ; 
 }; break;
 // 104 NTSTATUS NtMapUserPhysicalPages ['PVOID VirtualAddress', ' ULONG_PTR NumberOfPages', ' PULONG_PTR UserPfnArray']
 case 104: {
+if (PPP_CHECK_CB(on_NtMapUserPhysicalPages_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
-if (PPP_CHECK_CB(on_NtMapUserPhysicalPages_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtMapUserPhysicalPages_return, rp.proc_id, pc, 104, env,pc,arg0,arg1,arg2) ; 
 }
-PPP_RUN_CB(on_NtMapUserPhysicalPages_return, env,pc,arg0,arg1,arg2) ; 
 }; break;
 // 105 NTSTATUS NtMapUserPhysicalPagesScatter ['PVOID *VirtualAddresses', ' ULONG_PTR NumberOfPages', ' PULONG_PTR UserPfnArray']
 case 105: {
+if (PPP_CHECK_CB(on_NtMapUserPhysicalPagesScatter_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
-if (PPP_CHECK_CB(on_NtMapUserPhysicalPagesScatter_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtMapUserPhysicalPagesScatter_return, rp.proc_id, pc, 105, env,pc,arg0,arg1,arg2) ; 
 }
-PPP_RUN_CB(on_NtMapUserPhysicalPagesScatter_return, env,pc,arg0,arg1,arg2) ; 
 }; break;
 // 106 NTSTATUS NtMapViewOfSection ['HANDLE SectionHandle', ' HANDLE ProcessHandle', ' PVOID *BaseAddress', ' ULONG_PTR ZeroBits', ' SIZE_T CommitSize', ' PLARGE_INTEGER SectionOffset', ' PSIZE_T ViewSize', ' SECTION_INHERIT InheritDisposition', ' ULONG AllocationType', ' WIN32_PROTECTION_MASK Win32Protect']
 case 106: {
+if (PPP_CHECK_CB(on_NtMapViewOfSection_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
@@ -1598,7 +1599,6 @@ uint32_t arg6;
 uint32_t arg7;
 uint32_t arg8;
 uint32_t arg9;
-if (PPP_CHECK_CB(on_NtMapViewOfSection_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
@@ -1609,11 +1609,12 @@ memcpy(&arg6, rp.params[6], sizeof(uint32_t));
 memcpy(&arg7, rp.params[7], sizeof(uint32_t));
 memcpy(&arg8, rp.params[8], sizeof(uint32_t));
 memcpy(&arg9, rp.params[9], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtMapViewOfSection_return, rp.proc_id, pc, 106, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9) ; 
 }
-PPP_RUN_CB(on_NtMapViewOfSection_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9) ; 
 }; break;
 // 107 NTSTATUS NtNotifyChangeDirectoryFile ['HANDLE FileHandle', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID Buffer', ' ULONG Length', ' ULONG CompletionFilter', ' BOOLEAN WatchTree']
 case 107: {
+if (PPP_CHECK_CB(on_NtNotifyChangeDirectoryFile_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
@@ -1623,7 +1624,6 @@ uint32_t arg5;
 uint32_t arg6;
 uint32_t arg7;
 uint32_t arg8;
-if (PPP_CHECK_CB(on_NtNotifyChangeDirectoryFile_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
@@ -1633,11 +1633,12 @@ memcpy(&arg5, rp.params[5], sizeof(uint32_t));
 memcpy(&arg6, rp.params[6], sizeof(uint32_t));
 memcpy(&arg7, rp.params[7], sizeof(uint32_t));
 memcpy(&arg8, rp.params[8], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtNotifyChangeDirectoryFile_return, rp.proc_id, pc, 107, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
 }
-PPP_RUN_CB(on_NtNotifyChangeDirectoryFile_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
 }; break;
 // 108 NTSTATUS NtNotifyChangeKey ['HANDLE KeyHandle', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' ULONG CompletionFilter', ' BOOLEAN WatchTree', ' PVOID Buffer', ' ULONG BufferSize', ' BOOLEAN Asynchronous']
 case 108: {
+if (PPP_CHECK_CB(on_NtNotifyChangeKey_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
@@ -1648,7 +1649,6 @@ uint32_t arg6;
 uint32_t arg7;
 uint32_t arg8;
 uint32_t arg9;
-if (PPP_CHECK_CB(on_NtNotifyChangeKey_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
@@ -1659,11 +1659,12 @@ memcpy(&arg6, rp.params[6], sizeof(uint32_t));
 memcpy(&arg7, rp.params[7], sizeof(uint32_t));
 memcpy(&arg8, rp.params[8], sizeof(uint32_t));
 memcpy(&arg9, rp.params[9], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtNotifyChangeKey_return, rp.proc_id, pc, 108, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9) ; 
 }
-PPP_RUN_CB(on_NtNotifyChangeKey_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9) ; 
 }; break;
 // 109 NTSTATUS NtNotifyChangeMultipleKeys ['HANDLE MasterKeyHandle', ' ULONG Count', ' OBJECT_ATTRIBUTES SlaveObjects[]', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' ULONG CompletionFilter', ' BOOLEAN WatchTree', ' PVOID Buffer', ' ULONG BufferSize', ' BOOLEAN Asynchronous']
 case 109: {
+if (PPP_CHECK_CB(on_NtNotifyChangeMultipleKeys_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
@@ -1676,7 +1677,6 @@ uint32_t arg8;
 uint32_t arg9;
 uint32_t arg10;
 uint32_t arg11;
-if (PPP_CHECK_CB(on_NtNotifyChangeMultipleKeys_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
@@ -1689,113 +1689,114 @@ memcpy(&arg8, rp.params[8], sizeof(uint32_t));
 memcpy(&arg9, rp.params[9], sizeof(uint32_t));
 memcpy(&arg10, rp.params[10], sizeof(uint32_t));
 memcpy(&arg11, rp.params[11], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtNotifyChangeMultipleKeys_return, rp.proc_id, pc, 109, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11) ; 
 }
-PPP_RUN_CB(on_NtNotifyChangeMultipleKeys_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11) ; 
 }; break;
 // 110 NTSTATUS NtOpenDirectoryObject ['PHANDLE DirectoryHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
 case 110: {
+if (PPP_CHECK_CB(on_NtOpenDirectoryObject_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
-if (PPP_CHECK_CB(on_NtOpenDirectoryObject_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtOpenDirectoryObject_return, rp.proc_id, pc, 110, env,pc,arg0,arg1,arg2) ; 
 }
-PPP_RUN_CB(on_NtOpenDirectoryObject_return, env,pc,arg0,arg1,arg2) ; 
 }; break;
 // 111 NTSTATUS NtOpenEvent ['PHANDLE EventHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
 case 111: {
+if (PPP_CHECK_CB(on_NtOpenEvent_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
-if (PPP_CHECK_CB(on_NtOpenEvent_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtOpenEvent_return, rp.proc_id, pc, 111, env,pc,arg0,arg1,arg2) ; 
 }
-PPP_RUN_CB(on_NtOpenEvent_return, env,pc,arg0,arg1,arg2) ; 
 }; break;
 // 112 NTSTATUS NtOpenEventPair ['PHANDLE EventPairHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
 case 112: {
+if (PPP_CHECK_CB(on_NtOpenEventPair_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
-if (PPP_CHECK_CB(on_NtOpenEventPair_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtOpenEventPair_return, rp.proc_id, pc, 112, env,pc,arg0,arg1,arg2) ; 
 }
-PPP_RUN_CB(on_NtOpenEventPair_return, env,pc,arg0,arg1,arg2) ; 
 }; break;
 // 113 NTSTATUS NtOpenFile ['PHANDLE FileHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PIO_STATUS_BLOCK IoStatusBlock', ' ULONG ShareAccess', ' ULONG OpenOptions']
 case 113: {
+if (PPP_CHECK_CB(on_NtOpenFile_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
 uint32_t arg5;
-if (PPP_CHECK_CB(on_NtOpenFile_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
 memcpy(&arg5, rp.params[5], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtOpenFile_return, rp.proc_id, pc, 113, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
 }
-PPP_RUN_CB(on_NtOpenFile_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
 }; break;
 // 114 NTSTATUS NtOpenIoCompletion ['PHANDLE IoCompletionHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
 case 114: {
+if (PPP_CHECK_CB(on_NtOpenIoCompletion_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
-if (PPP_CHECK_CB(on_NtOpenIoCompletion_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtOpenIoCompletion_return, rp.proc_id, pc, 114, env,pc,arg0,arg1,arg2) ; 
 }
-PPP_RUN_CB(on_NtOpenIoCompletion_return, env,pc,arg0,arg1,arg2) ; 
 }; break;
 // 115 NTSTATUS NtOpenJobObject ['PHANDLE JobHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
 case 115: {
+if (PPP_CHECK_CB(on_NtOpenJobObject_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
-if (PPP_CHECK_CB(on_NtOpenJobObject_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtOpenJobObject_return, rp.proc_id, pc, 115, env,pc,arg0,arg1,arg2) ; 
 }
-PPP_RUN_CB(on_NtOpenJobObject_return, env,pc,arg0,arg1,arg2) ; 
 }; break;
 // 116 NTSTATUS NtOpenKey ['PHANDLE KeyHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
 case 116: {
+if (PPP_CHECK_CB(on_NtOpenKey_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
-if (PPP_CHECK_CB(on_NtOpenKey_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtOpenKey_return, rp.proc_id, pc, 116, env,pc,arg0,arg1,arg2) ; 
 }
-PPP_RUN_CB(on_NtOpenKey_return, env,pc,arg0,arg1,arg2) ; 
 }; break;
 // 117 NTSTATUS NtOpenMutant ['PHANDLE MutantHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
 case 117: {
+if (PPP_CHECK_CB(on_NtOpenMutant_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
-if (PPP_CHECK_CB(on_NtOpenMutant_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtOpenMutant_return, rp.proc_id, pc, 117, env,pc,arg0,arg1,arg2) ; 
 }
-PPP_RUN_CB(on_NtOpenMutant_return, env,pc,arg0,arg1,arg2) ; 
 }; break;
 // 118 NTSTATUS NtOpenObjectAuditAlarm ['PUNICODE_STRING SubsystemName', ' PVOID HandleId', ' PUNICODE_STRING ObjectTypeName', ' PUNICODE_STRING ObjectName', ' PSECURITY_DESCRIPTOR SecurityDescriptor', ' HANDLE ClientToken', ' ACCESS_MASK DesiredAccess', ' ACCESS_MASK GrantedAccess', ' PPRIVILEGE_SET Privileges', ' BOOLEAN ObjectCreation', ' BOOLEAN AccessGranted', ' PBOOLEAN GenerateOnClose']
 case 118: {
+if (PPP_CHECK_CB(on_NtOpenObjectAuditAlarm_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
@@ -1808,7 +1809,6 @@ uint32_t arg8;
 uint32_t arg9;
 uint32_t arg10;
 uint32_t arg11;
-if (PPP_CHECK_CB(on_NtOpenObjectAuditAlarm_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
@@ -1821,281 +1821,282 @@ memcpy(&arg8, rp.params[8], sizeof(uint32_t));
 memcpy(&arg9, rp.params[9], sizeof(uint32_t));
 memcpy(&arg10, rp.params[10], sizeof(uint32_t));
 memcpy(&arg11, rp.params[11], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtOpenObjectAuditAlarm_return, rp.proc_id, pc, 118, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11) ; 
 }
-PPP_RUN_CB(on_NtOpenObjectAuditAlarm_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11) ; 
 }; break;
 // 119 NTSTATUS NtOpenProcess ['PHANDLE ProcessHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PCLIENT_ID ClientId']
 case 119: {
+if (PPP_CHECK_CB(on_NtOpenProcess_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
-if (PPP_CHECK_CB(on_NtOpenProcess_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtOpenProcess_return, rp.proc_id, pc, 119, env,pc,arg0,arg1,arg2,arg3) ; 
 }
-PPP_RUN_CB(on_NtOpenProcess_return, env,pc,arg0,arg1,arg2,arg3) ; 
 }; break;
 // 120 NTSTATUS NtOpenProcessToken ['HANDLE ProcessHandle', ' ACCESS_MASK DesiredAccess', ' PHANDLE TokenHandle']
 case 120: {
+if (PPP_CHECK_CB(on_NtOpenProcessToken_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
-if (PPP_CHECK_CB(on_NtOpenProcessToken_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtOpenProcessToken_return, rp.proc_id, pc, 120, env,pc,arg0,arg1,arg2) ; 
 }
-PPP_RUN_CB(on_NtOpenProcessToken_return, env,pc,arg0,arg1,arg2) ; 
 }; break;
 // 121 NTSTATUS NtOpenProcessTokenEx ['HANDLE ProcessHandle', ' ACCESS_MASK DesiredAccess', ' ULONG HandleAttributes', ' PHANDLE TokenHandle']
 case 121: {
+if (PPP_CHECK_CB(on_NtOpenProcessTokenEx_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
-if (PPP_CHECK_CB(on_NtOpenProcessTokenEx_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtOpenProcessTokenEx_return, rp.proc_id, pc, 121, env,pc,arg0,arg1,arg2,arg3) ; 
 }
-PPP_RUN_CB(on_NtOpenProcessTokenEx_return, env,pc,arg0,arg1,arg2,arg3) ; 
 }; break;
 // 122 NTSTATUS NtOpenSection ['PHANDLE SectionHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
 case 122: {
+if (PPP_CHECK_CB(on_NtOpenSection_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
-if (PPP_CHECK_CB(on_NtOpenSection_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtOpenSection_return, rp.proc_id, pc, 122, env,pc,arg0,arg1,arg2) ; 
 }
-PPP_RUN_CB(on_NtOpenSection_return, env,pc,arg0,arg1,arg2) ; 
 }; break;
 // 123 NTSTATUS NtOpenSemaphore ['PHANDLE SemaphoreHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
 case 123: {
+if (PPP_CHECK_CB(on_NtOpenSemaphore_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
-if (PPP_CHECK_CB(on_NtOpenSemaphore_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtOpenSemaphore_return, rp.proc_id, pc, 123, env,pc,arg0,arg1,arg2) ; 
 }
-PPP_RUN_CB(on_NtOpenSemaphore_return, env,pc,arg0,arg1,arg2) ; 
 }; break;
 // 124 NTSTATUS NtOpenSymbolicLinkObject ['PHANDLE LinkHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
 case 124: {
+if (PPP_CHECK_CB(on_NtOpenSymbolicLinkObject_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
-if (PPP_CHECK_CB(on_NtOpenSymbolicLinkObject_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtOpenSymbolicLinkObject_return, rp.proc_id, pc, 124, env,pc,arg0,arg1,arg2) ; 
 }
-PPP_RUN_CB(on_NtOpenSymbolicLinkObject_return, env,pc,arg0,arg1,arg2) ; 
 }; break;
 // 125 NTSTATUS NtOpenThread ['PHANDLE ThreadHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' PCLIENT_ID ClientId']
 case 125: {
+if (PPP_CHECK_CB(on_NtOpenThread_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
-if (PPP_CHECK_CB(on_NtOpenThread_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtOpenThread_return, rp.proc_id, pc, 125, env,pc,arg0,arg1,arg2,arg3) ; 
 }
-PPP_RUN_CB(on_NtOpenThread_return, env,pc,arg0,arg1,arg2,arg3) ; 
 }; break;
 // 126 NTSTATUS NtOpenThreadToken ['HANDLE ThreadHandle', ' ACCESS_MASK DesiredAccess', ' BOOLEAN OpenAsSelf', ' PHANDLE TokenHandle']
 case 126: {
+if (PPP_CHECK_CB(on_NtOpenThreadToken_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
-if (PPP_CHECK_CB(on_NtOpenThreadToken_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtOpenThreadToken_return, rp.proc_id, pc, 126, env,pc,arg0,arg1,arg2,arg3) ; 
 }
-PPP_RUN_CB(on_NtOpenThreadToken_return, env,pc,arg0,arg1,arg2,arg3) ; 
 }; break;
 // 127 NTSTATUS NtOpenThreadTokenEx ['HANDLE ThreadHandle', ' ACCESS_MASK DesiredAccess', ' BOOLEAN OpenAsSelf', ' ULONG HandleAttributes', ' PHANDLE TokenHandle']
 case 127: {
+if (PPP_CHECK_CB(on_NtOpenThreadTokenEx_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
-if (PPP_CHECK_CB(on_NtOpenThreadTokenEx_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtOpenThreadTokenEx_return, rp.proc_id, pc, 127, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }
-PPP_RUN_CB(on_NtOpenThreadTokenEx_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }; break;
 // 128 NTSTATUS NtOpenTimer ['PHANDLE TimerHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
 case 128: {
+if (PPP_CHECK_CB(on_NtOpenTimer_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
-if (PPP_CHECK_CB(on_NtOpenTimer_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtOpenTimer_return, rp.proc_id, pc, 128, env,pc,arg0,arg1,arg2) ; 
 }
-PPP_RUN_CB(on_NtOpenTimer_return, env,pc,arg0,arg1,arg2) ; 
 }; break;
 // 129 NTSTATUS NtPlugPlayControl ['PLUGPLAY_CONTROL_CLASS PnPControlClass', ' PVOID PnPControlData', ' ULONG PnPControlDataLength']
 case 129: {
+if (PPP_CHECK_CB(on_NtPlugPlayControl_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
-if (PPP_CHECK_CB(on_NtPlugPlayControl_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtPlugPlayControl_return, rp.proc_id, pc, 129, env,pc,arg0,arg1,arg2) ; 
 }
-PPP_RUN_CB(on_NtPlugPlayControl_return, env,pc,arg0,arg1,arg2) ; 
 }; break;
 // 130 NTSTATUS NtPowerInformation ['POWER_INFORMATION_LEVEL InformationLevel', ' PVOID InputBuffer', ' ULONG InputBufferLength', ' PVOID OutputBuffer', ' ULONG OutputBufferLength']
 case 130: {
+if (PPP_CHECK_CB(on_NtPowerInformation_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
-if (PPP_CHECK_CB(on_NtPowerInformation_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtPowerInformation_return, rp.proc_id, pc, 130, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }
-PPP_RUN_CB(on_NtPowerInformation_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }; break;
 // 131 NTSTATUS NtPrivilegeCheck ['HANDLE ClientToken', ' PPRIVILEGE_SET RequiredPrivileges', ' PBOOLEAN Result']
 case 131: {
+if (PPP_CHECK_CB(on_NtPrivilegeCheck_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
-if (PPP_CHECK_CB(on_NtPrivilegeCheck_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtPrivilegeCheck_return, rp.proc_id, pc, 131, env,pc,arg0,arg1,arg2) ; 
 }
-PPP_RUN_CB(on_NtPrivilegeCheck_return, env,pc,arg0,arg1,arg2) ; 
 }; break;
 // 132 NTSTATUS NtPrivilegeObjectAuditAlarm ['PUNICODE_STRING SubsystemName', ' PVOID HandleId', ' HANDLE ClientToken', ' ACCESS_MASK DesiredAccess', ' PPRIVILEGE_SET Privileges', ' BOOLEAN AccessGranted']
 case 132: {
+if (PPP_CHECK_CB(on_NtPrivilegeObjectAuditAlarm_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
 uint32_t arg5;
-if (PPP_CHECK_CB(on_NtPrivilegeObjectAuditAlarm_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
 memcpy(&arg5, rp.params[5], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtPrivilegeObjectAuditAlarm_return, rp.proc_id, pc, 132, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
 }
-PPP_RUN_CB(on_NtPrivilegeObjectAuditAlarm_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
 }; break;
 // 133 NTSTATUS NtPrivilegedServiceAuditAlarm ['PUNICODE_STRING SubsystemName', ' PUNICODE_STRING ServiceName', ' HANDLE ClientToken', ' PPRIVILEGE_SET Privileges', ' BOOLEAN AccessGranted']
 case 133: {
+if (PPP_CHECK_CB(on_NtPrivilegedServiceAuditAlarm_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
-if (PPP_CHECK_CB(on_NtPrivilegedServiceAuditAlarm_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtPrivilegedServiceAuditAlarm_return, rp.proc_id, pc, 133, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }
-PPP_RUN_CB(on_NtPrivilegedServiceAuditAlarm_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }; break;
 // 134 NTSTATUS NtProtectVirtualMemory ['HANDLE ProcessHandle', ' PVOID *BaseAddress', ' PSIZE_T RegionSize', ' WIN32_PROTECTION_MASK NewProtectWin32', ' PULONG OldProtect']
 case 134: {
+if (PPP_CHECK_CB(on_NtProtectVirtualMemory_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
-if (PPP_CHECK_CB(on_NtProtectVirtualMemory_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtProtectVirtualMemory_return, rp.proc_id, pc, 134, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }
-PPP_RUN_CB(on_NtProtectVirtualMemory_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }; break;
 // 135 NTSTATUS NtPulseEvent ['HANDLE EventHandle', ' PLONG PreviousState']
 case 135: {
+if (PPP_CHECK_CB(on_NtPulseEvent_return)) {
 uint32_t arg0;
 uint32_t arg1;
-if (PPP_CHECK_CB(on_NtPulseEvent_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtPulseEvent_return, rp.proc_id, pc, 135, env,pc,arg0,arg1) ; 
 }
-PPP_RUN_CB(on_NtPulseEvent_return, env,pc,arg0,arg1) ; 
 }; break;
 // 136 NTSTATUS NtQueryAttributesFile ['POBJECT_ATTRIBUTES ObjectAttributes', ' PFILE_BASIC_INFORMATION FileInformation']
 case 136: {
+if (PPP_CHECK_CB(on_NtQueryAttributesFile_return)) {
 uint32_t arg0;
 uint32_t arg1;
-if (PPP_CHECK_CB(on_NtQueryAttributesFile_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtQueryAttributesFile_return, rp.proc_id, pc, 136, env,pc,arg0,arg1) ; 
 }
-PPP_RUN_CB(on_NtQueryAttributesFile_return, env,pc,arg0,arg1) ; 
 }; break;
 // 137 NTSTATUS NtQueryDebugFilterState ['ULONG ComponentId', ' ULONG Level']
 case 137: {
+if (PPP_CHECK_CB(on_NtQueryDebugFilterState_return)) {
 uint32_t arg0;
 uint32_t arg1;
-if (PPP_CHECK_CB(on_NtQueryDebugFilterState_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtQueryDebugFilterState_return, rp.proc_id, pc, 137, env,pc,arg0,arg1) ; 
 }
-PPP_RUN_CB(on_NtQueryDebugFilterState_return, env,pc,arg0,arg1) ; 
 }; break;
 // 138 NTSTATUS NtQueryDefaultLocale ['BOOLEAN UserProfile', ' PLCID DefaultLocaleId']
 case 138: {
+if (PPP_CHECK_CB(on_NtQueryDefaultLocale_return)) {
 uint32_t arg0;
 uint32_t arg1;
-if (PPP_CHECK_CB(on_NtQueryDefaultLocale_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtQueryDefaultLocale_return, rp.proc_id, pc, 138, env,pc,arg0,arg1) ; 
 }
-PPP_RUN_CB(on_NtQueryDefaultLocale_return, env,pc,arg0,arg1) ; 
 }; break;
 // 139 NTSTATUS NtQueryDefaultUILanguage ['LANGID *DefaultUILanguageId']
 case 139: {
-uint32_t arg0;
 if (PPP_CHECK_CB(on_NtQueryDefaultUILanguage_return)) {
+uint32_t arg0;
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtQueryDefaultUILanguage_return, rp.proc_id, pc, 139, env,pc,arg0) ; 
 }
-PPP_RUN_CB(on_NtQueryDefaultUILanguage_return, env,pc,arg0) ; 
 }; break;
 // 140 NTSTATUS NtQueryDirectoryFile ['HANDLE FileHandle', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID FileInformation', ' ULONG Length', ' FILE_INFORMATION_CLASS FileInformationClass', ' BOOLEAN ReturnSingleEntry', ' PUNICODE_STRING FileName', ' BOOLEAN RestartScan']
 case 140: {
+if (PPP_CHECK_CB(on_NtQueryDirectoryFile_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
@@ -2107,7 +2108,6 @@ uint32_t arg7;
 uint32_t arg8;
 uint32_t arg9;
 uint32_t arg10;
-if (PPP_CHECK_CB(on_NtQueryDirectoryFile_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
@@ -2119,11 +2119,12 @@ memcpy(&arg7, rp.params[7], sizeof(uint32_t));
 memcpy(&arg8, rp.params[8], sizeof(uint32_t));
 memcpy(&arg9, rp.params[9], sizeof(uint32_t));
 memcpy(&arg10, rp.params[10], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtQueryDirectoryFile_return, rp.proc_id, pc, 140, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10) ; 
 }
-PPP_RUN_CB(on_NtQueryDirectoryFile_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10) ; 
 }; break;
 // 141 NTSTATUS NtQueryDirectoryObject ['HANDLE DirectoryHandle', ' PVOID Buffer', ' ULONG Length', ' BOOLEAN ReturnSingleEntry', ' BOOLEAN RestartScan', ' PULONG Context', ' PULONG ReturnLength']
 case 141: {
+if (PPP_CHECK_CB(on_NtQueryDirectoryObject_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
@@ -2131,7 +2132,6 @@ uint32_t arg3;
 uint32_t arg4;
 uint32_t arg5;
 uint32_t arg6;
-if (PPP_CHECK_CB(on_NtQueryDirectoryObject_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
@@ -2139,11 +2139,12 @@ memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
 memcpy(&arg5, rp.params[5], sizeof(uint32_t));
 memcpy(&arg6, rp.params[6], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtQueryDirectoryObject_return, rp.proc_id, pc, 141, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
 }
-PPP_RUN_CB(on_NtQueryDirectoryObject_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
 }; break;
 // 142 NTSTATUS NtQueryEaFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID Buffer', ' ULONG Length', ' BOOLEAN ReturnSingleEntry', ' PVOID EaList', ' ULONG EaListLength', ' PULONG EaIndex', ' BOOLEAN RestartScan']
 case 142: {
+if (PPP_CHECK_CB(on_NtQueryEaFile_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
@@ -2153,7 +2154,6 @@ uint32_t arg5;
 uint32_t arg6;
 uint32_t arg7;
 uint32_t arg8;
-if (PPP_CHECK_CB(on_NtQueryEaFile_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
@@ -2163,269 +2163,270 @@ memcpy(&arg5, rp.params[5], sizeof(uint32_t));
 memcpy(&arg6, rp.params[6], sizeof(uint32_t));
 memcpy(&arg7, rp.params[7], sizeof(uint32_t));
 memcpy(&arg8, rp.params[8], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtQueryEaFile_return, rp.proc_id, pc, 142, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
 }
-PPP_RUN_CB(on_NtQueryEaFile_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
 }; break;
 // 143 NTSTATUS NtQueryEvent ['HANDLE EventHandle', ' EVENT_INFORMATION_CLASS EventInformationClass', ' PVOID EventInformation', ' ULONG EventInformationLength', ' PULONG ReturnLength']
 case 143: {
+if (PPP_CHECK_CB(on_NtQueryEvent_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
-if (PPP_CHECK_CB(on_NtQueryEvent_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtQueryEvent_return, rp.proc_id, pc, 143, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }
-PPP_RUN_CB(on_NtQueryEvent_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }; break;
 // 144 NTSTATUS NtQueryFullAttributesFile ['POBJECT_ATTRIBUTES ObjectAttributes', ' PFILE_NETWORK_OPEN_INFORMATION FileInformation']
 case 144: {
+if (PPP_CHECK_CB(on_NtQueryFullAttributesFile_return)) {
 uint32_t arg0;
 uint32_t arg1;
-if (PPP_CHECK_CB(on_NtQueryFullAttributesFile_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtQueryFullAttributesFile_return, rp.proc_id, pc, 144, env,pc,arg0,arg1) ; 
 }
-PPP_RUN_CB(on_NtQueryFullAttributesFile_return, env,pc,arg0,arg1) ; 
 }; break;
 // 145 NTSTATUS NtQueryInformationAtom ['RTL_ATOM Atom', ' ATOM_INFORMATION_CLASS InformationClass', ' PVOID AtomInformation', ' ULONG AtomInformationLength', ' PULONG ReturnLength']
 case 145: {
+if (PPP_CHECK_CB(on_NtQueryInformationAtom_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
-if (PPP_CHECK_CB(on_NtQueryInformationAtom_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtQueryInformationAtom_return, rp.proc_id, pc, 145, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }
-PPP_RUN_CB(on_NtQueryInformationAtom_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }; break;
 // 146 NTSTATUS NtQueryInformationFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID FileInformation', ' ULONG Length', ' FILE_INFORMATION_CLASS FileInformationClass']
 case 146: {
+if (PPP_CHECK_CB(on_NtQueryInformationFile_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
-if (PPP_CHECK_CB(on_NtQueryInformationFile_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtQueryInformationFile_return, rp.proc_id, pc, 146, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }
-PPP_RUN_CB(on_NtQueryInformationFile_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }; break;
 // 147 NTSTATUS NtQueryInformationJobObject ['HANDLE JobHandle', ' JOBOBJECTINFOCLASS JobObjectInformationClass', ' PVOID JobObjectInformation', ' ULONG JobObjectInformationLength', ' PULONG ReturnLength']
 case 147: {
+if (PPP_CHECK_CB(on_NtQueryInformationJobObject_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
-if (PPP_CHECK_CB(on_NtQueryInformationJobObject_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtQueryInformationJobObject_return, rp.proc_id, pc, 147, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }
-PPP_RUN_CB(on_NtQueryInformationJobObject_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }; break;
 // 148 NTSTATUS NtQueryInformationPort ['HANDLE PortHandle', ' PORT_INFORMATION_CLASS PortInformationClass', ' PVOID PortInformation', ' ULONG Length', ' PULONG ReturnLength']
 case 148: {
+if (PPP_CHECK_CB(on_NtQueryInformationPort_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
-if (PPP_CHECK_CB(on_NtQueryInformationPort_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtQueryInformationPort_return, rp.proc_id, pc, 148, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }
-PPP_RUN_CB(on_NtQueryInformationPort_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }; break;
 // 149 NTSTATUS NtQueryInformationProcess ['HANDLE ProcessHandle', ' PROCESSINFOCLASS ProcessInformationClass', ' PVOID ProcessInformation', ' ULONG ProcessInformationLength', ' PULONG ReturnLength']
 case 149: {
+if (PPP_CHECK_CB(on_NtQueryInformationProcess_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
-if (PPP_CHECK_CB(on_NtQueryInformationProcess_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtQueryInformationProcess_return, rp.proc_id, pc, 149, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }
-PPP_RUN_CB(on_NtQueryInformationProcess_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }; break;
 // 150 NTSTATUS NtQueryInformationThread ['HANDLE ThreadHandle', ' THREADINFOCLASS ThreadInformationClass', ' PVOID ThreadInformation', ' ULONG ThreadInformationLength', ' PULONG ReturnLength']
 case 150: {
+if (PPP_CHECK_CB(on_NtQueryInformationThread_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
-if (PPP_CHECK_CB(on_NtQueryInformationThread_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtQueryInformationThread_return, rp.proc_id, pc, 150, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }
-PPP_RUN_CB(on_NtQueryInformationThread_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }; break;
 // 151 NTSTATUS NtQueryInformationToken ['HANDLE TokenHandle', ' TOKEN_INFORMATION_CLASS TokenInformationClass', ' PVOID TokenInformation', ' ULONG TokenInformationLength', ' PULONG ReturnLength']
 case 151: {
+if (PPP_CHECK_CB(on_NtQueryInformationToken_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
-if (PPP_CHECK_CB(on_NtQueryInformationToken_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtQueryInformationToken_return, rp.proc_id, pc, 151, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }
-PPP_RUN_CB(on_NtQueryInformationToken_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }; break;
 // 152 NTSTATUS NtQueryInstallUILanguage ['LANGID *InstallUILanguageId']
 case 152: {
-uint32_t arg0;
 if (PPP_CHECK_CB(on_NtQueryInstallUILanguage_return)) {
+uint32_t arg0;
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtQueryInstallUILanguage_return, rp.proc_id, pc, 152, env,pc,arg0) ; 
 }
-PPP_RUN_CB(on_NtQueryInstallUILanguage_return, env,pc,arg0) ; 
 }; break;
 // 153 NTSTATUS NtQueryIntervalProfile ['KPROFILE_SOURCE ProfileSource', ' PULONG Interval']
 case 153: {
+if (PPP_CHECK_CB(on_NtQueryIntervalProfile_return)) {
 uint32_t arg0;
 uint32_t arg1;
-if (PPP_CHECK_CB(on_NtQueryIntervalProfile_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtQueryIntervalProfile_return, rp.proc_id, pc, 153, env,pc,arg0,arg1) ; 
 }
-PPP_RUN_CB(on_NtQueryIntervalProfile_return, env,pc,arg0,arg1) ; 
 }; break;
 // 154 NTSTATUS NtQueryIoCompletion ['HANDLE IoCompletionHandle', ' IO_COMPLETION_INFORMATION_CLASS IoCompletionInformationClass', ' PVOID IoCompletionInformation', ' ULONG IoCompletionInformationLength', ' PULONG ReturnLength']
 case 154: {
+if (PPP_CHECK_CB(on_NtQueryIoCompletion_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
-if (PPP_CHECK_CB(on_NtQueryIoCompletion_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtQueryIoCompletion_return, rp.proc_id, pc, 154, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }
-PPP_RUN_CB(on_NtQueryIoCompletion_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }; break;
 // 155 NTSTATUS NtQueryKey ['HANDLE KeyHandle', ' KEY_INFORMATION_CLASS KeyInformationClass', ' PVOID KeyInformation', ' ULONG Length', ' PULONG ResultLength']
 case 155: {
+if (PPP_CHECK_CB(on_NtQueryKey_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
-if (PPP_CHECK_CB(on_NtQueryKey_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtQueryKey_return, rp.proc_id, pc, 155, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }
-PPP_RUN_CB(on_NtQueryKey_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }; break;
 // 156 NTSTATUS NtQueryMultipleValueKey ['HANDLE KeyHandle', ' PKEY_VALUE_ENTRY ValueEntries', ' ULONG EntryCount', ' PVOID ValueBuffer', ' PULONG BufferLength', ' PULONG RequiredBufferLength']
 case 156: {
+if (PPP_CHECK_CB(on_NtQueryMultipleValueKey_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
 uint32_t arg5;
-if (PPP_CHECK_CB(on_NtQueryMultipleValueKey_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
 memcpy(&arg5, rp.params[5], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtQueryMultipleValueKey_return, rp.proc_id, pc, 156, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
 }
-PPP_RUN_CB(on_NtQueryMultipleValueKey_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
 }; break;
 // 157 NTSTATUS NtQueryMutant ['HANDLE MutantHandle', ' MUTANT_INFORMATION_CLASS MutantInformationClass', ' PVOID MutantInformation', ' ULONG MutantInformationLength', ' PULONG ReturnLength']
 case 157: {
+if (PPP_CHECK_CB(on_NtQueryMutant_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
-if (PPP_CHECK_CB(on_NtQueryMutant_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtQueryMutant_return, rp.proc_id, pc, 157, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }
-PPP_RUN_CB(on_NtQueryMutant_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }; break;
 // 158 NTSTATUS NtQueryObject ['HANDLE Handle', ' OBJECT_INFORMATION_CLASS ObjectInformationClass', ' PVOID ObjectInformation', ' ULONG ObjectInformationLength', ' PULONG ReturnLength']
 case 158: {
+if (PPP_CHECK_CB(on_NtQueryObject_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
-if (PPP_CHECK_CB(on_NtQueryObject_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtQueryObject_return, rp.proc_id, pc, 158, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }
-PPP_RUN_CB(on_NtQueryObject_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }; break;
 // 159 NTSTATUS NtQueryOpenSubKeys ['POBJECT_ATTRIBUTES TargetKey', ' PULONG HandleCount']
 case 159: {
+if (PPP_CHECK_CB(on_NtQueryOpenSubKeys_return)) {
 uint32_t arg0;
 uint32_t arg1;
-if (PPP_CHECK_CB(on_NtQueryOpenSubKeys_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtQueryOpenSubKeys_return, rp.proc_id, pc, 159, env,pc,arg0,arg1) ; 
 }
-PPP_RUN_CB(on_NtQueryOpenSubKeys_return, env,pc,arg0,arg1) ; 
 }; break;
 // 160 NTSTATUS NtQueryPerformanceCounter ['PLARGE_INTEGER PerformanceCounter', ' PLARGE_INTEGER PerformanceFrequency']
 case 160: {
+if (PPP_CHECK_CB(on_NtQueryPerformanceCounter_return)) {
 uint32_t arg0;
 uint32_t arg1;
-if (PPP_CHECK_CB(on_NtQueryPerformanceCounter_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtQueryPerformanceCounter_return, rp.proc_id, pc, 160, env,pc,arg0,arg1) ; 
 }
-PPP_RUN_CB(on_NtQueryPerformanceCounter_return, env,pc,arg0,arg1) ; 
 }; break;
 // 161 NTSTATUS NtQueryQuotaInformationFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID Buffer', ' ULONG Length', ' BOOLEAN ReturnSingleEntry', ' PVOID SidList', ' ULONG SidListLength', ' PULONG StartSid', ' BOOLEAN RestartScan']
 case 161: {
+if (PPP_CHECK_CB(on_NtQueryQuotaInformationFile_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
@@ -2435,7 +2436,6 @@ uint32_t arg5;
 uint32_t arg6;
 uint32_t arg7;
 uint32_t arg8;
-if (PPP_CHECK_CB(on_NtQueryQuotaInformationFile_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
@@ -2445,249 +2445,250 @@ memcpy(&arg5, rp.params[5], sizeof(uint32_t));
 memcpy(&arg6, rp.params[6], sizeof(uint32_t));
 memcpy(&arg7, rp.params[7], sizeof(uint32_t));
 memcpy(&arg8, rp.params[8], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtQueryQuotaInformationFile_return, rp.proc_id, pc, 161, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
 }
-PPP_RUN_CB(on_NtQueryQuotaInformationFile_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
 }; break;
 // 162 NTSTATUS NtQuerySection ['HANDLE SectionHandle', ' SECTION_INFORMATION_CLASS SectionInformationClass', ' PVOID SectionInformation', ' SIZE_T SectionInformationLength', ' PSIZE_T ReturnLength']
 case 162: {
+if (PPP_CHECK_CB(on_NtQuerySection_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
-if (PPP_CHECK_CB(on_NtQuerySection_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtQuerySection_return, rp.proc_id, pc, 162, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }
-PPP_RUN_CB(on_NtQuerySection_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }; break;
 // 163 NTSTATUS NtQuerySecurityObject ['HANDLE Handle', ' SECURITY_INFORMATION SecurityInformation', ' PSECURITY_DESCRIPTOR SecurityDescriptor', ' ULONG Length', ' PULONG LengthNeeded']
 case 163: {
+if (PPP_CHECK_CB(on_NtQuerySecurityObject_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
-if (PPP_CHECK_CB(on_NtQuerySecurityObject_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtQuerySecurityObject_return, rp.proc_id, pc, 163, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }
-PPP_RUN_CB(on_NtQuerySecurityObject_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }; break;
 // 164 NTSTATUS NtQuerySemaphore ['HANDLE SemaphoreHandle', ' SEMAPHORE_INFORMATION_CLASS SemaphoreInformationClass', ' PVOID SemaphoreInformation', ' ULONG SemaphoreInformationLength', ' PULONG ReturnLength']
 case 164: {
+if (PPP_CHECK_CB(on_NtQuerySemaphore_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
-if (PPP_CHECK_CB(on_NtQuerySemaphore_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtQuerySemaphore_return, rp.proc_id, pc, 164, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }
-PPP_RUN_CB(on_NtQuerySemaphore_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }; break;
 // 165 NTSTATUS NtQuerySymbolicLinkObject ['HANDLE LinkHandle', ' PUNICODE_STRING LinkTarget', ' PULONG ReturnedLength']
 case 165: {
+if (PPP_CHECK_CB(on_NtQuerySymbolicLinkObject_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
-if (PPP_CHECK_CB(on_NtQuerySymbolicLinkObject_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtQuerySymbolicLinkObject_return, rp.proc_id, pc, 165, env,pc,arg0,arg1,arg2) ; 
 }
-PPP_RUN_CB(on_NtQuerySymbolicLinkObject_return, env,pc,arg0,arg1,arg2) ; 
 }; break;
 // 166 NTSTATUS NtQuerySystemEnvironmentValue ['PUNICODE_STRING VariableName', ' PWSTR VariableValue', ' USHORT ValueLength', ' PUSHORT ReturnLength']
 case 166: {
+if (PPP_CHECK_CB(on_NtQuerySystemEnvironmentValue_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
-if (PPP_CHECK_CB(on_NtQuerySystemEnvironmentValue_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtQuerySystemEnvironmentValue_return, rp.proc_id, pc, 166, env,pc,arg0,arg1,arg2,arg3) ; 
 }
-PPP_RUN_CB(on_NtQuerySystemEnvironmentValue_return, env,pc,arg0,arg1,arg2,arg3) ; 
 }; break;
 // 167 NTSTATUS NtQuerySystemEnvironmentValueEx ['PUNICODE_STRING VariableName', ' LPGUID VendorGuid', ' PVOID Value', ' PULONG ValueLength', ' PULONG Attributes']
 case 167: {
+if (PPP_CHECK_CB(on_NtQuerySystemEnvironmentValueEx_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
-if (PPP_CHECK_CB(on_NtQuerySystemEnvironmentValueEx_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtQuerySystemEnvironmentValueEx_return, rp.proc_id, pc, 167, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }
-PPP_RUN_CB(on_NtQuerySystemEnvironmentValueEx_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }; break;
 // 168 NTSTATUS NtQuerySystemInformation ['SYSTEM_INFORMATION_CLASS SystemInformationClass', ' PVOID SystemInformation', ' ULONG SystemInformationLength', ' PULONG ReturnLength']
 case 168: {
+if (PPP_CHECK_CB(on_NtQuerySystemInformation_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
-if (PPP_CHECK_CB(on_NtQuerySystemInformation_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtQuerySystemInformation_return, rp.proc_id, pc, 168, env,pc,arg0,arg1,arg2,arg3) ; 
 }
-PPP_RUN_CB(on_NtQuerySystemInformation_return, env,pc,arg0,arg1,arg2,arg3) ; 
 }; break;
 // 169 NTSTATUS NtQuerySystemTime ['PLARGE_INTEGER SystemTime']
 case 169: {
-uint32_t arg0;
 if (PPP_CHECK_CB(on_NtQuerySystemTime_return)) {
+uint32_t arg0;
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtQuerySystemTime_return, rp.proc_id, pc, 169, env,pc,arg0) ; 
 }
-PPP_RUN_CB(on_NtQuerySystemTime_return, env,pc,arg0) ; 
 }; break;
 // 170 NTSTATUS NtQueryTimer ['HANDLE TimerHandle', ' TIMER_INFORMATION_CLASS TimerInformationClass', ' PVOID TimerInformation', ' ULONG TimerInformationLength', ' PULONG ReturnLength']
 case 170: {
+if (PPP_CHECK_CB(on_NtQueryTimer_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
-if (PPP_CHECK_CB(on_NtQueryTimer_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtQueryTimer_return, rp.proc_id, pc, 170, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }
-PPP_RUN_CB(on_NtQueryTimer_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }; break;
 // 171 NTSTATUS NtQueryTimerResolution ['PULONG MaximumTime', ' PULONG MinimumTime', ' PULONG CurrentTime']
 case 171: {
+if (PPP_CHECK_CB(on_NtQueryTimerResolution_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
-if (PPP_CHECK_CB(on_NtQueryTimerResolution_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtQueryTimerResolution_return, rp.proc_id, pc, 171, env,pc,arg0,arg1,arg2) ; 
 }
-PPP_RUN_CB(on_NtQueryTimerResolution_return, env,pc,arg0,arg1,arg2) ; 
 }; break;
 // 172 NTSTATUS NtQueryValueKey ['HANDLE KeyHandle', ' PUNICODE_STRING ValueName', ' KEY_VALUE_INFORMATION_CLASS KeyValueInformationClass', ' PVOID KeyValueInformation', ' ULONG Length', ' PULONG ResultLength']
 case 172: {
+if (PPP_CHECK_CB(on_NtQueryValueKey_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
 uint32_t arg5;
-if (PPP_CHECK_CB(on_NtQueryValueKey_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
 memcpy(&arg5, rp.params[5], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtQueryValueKey_return, rp.proc_id, pc, 172, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
 }
-PPP_RUN_CB(on_NtQueryValueKey_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
 }; break;
 // 173 NTSTATUS NtQueryVirtualMemory ['HANDLE ProcessHandle', ' PVOID BaseAddress', ' MEMORY_INFORMATION_CLASS MemoryInformationClass', ' PVOID MemoryInformation', ' SIZE_T MemoryInformationLength', ' PSIZE_T ReturnLength']
 case 173: {
+if (PPP_CHECK_CB(on_NtQueryVirtualMemory_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
 uint32_t arg5;
-if (PPP_CHECK_CB(on_NtQueryVirtualMemory_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
 memcpy(&arg5, rp.params[5], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtQueryVirtualMemory_return, rp.proc_id, pc, 173, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
 }
-PPP_RUN_CB(on_NtQueryVirtualMemory_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
 }; break;
 // 174 NTSTATUS NtQueryVolumeInformationFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID FsInformation', ' ULONG Length', ' FS_INFORMATION_CLASS FsInformationClass']
 case 174: {
+if (PPP_CHECK_CB(on_NtQueryVolumeInformationFile_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
-if (PPP_CHECK_CB(on_NtQueryVolumeInformationFile_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtQueryVolumeInformationFile_return, rp.proc_id, pc, 174, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }
-PPP_RUN_CB(on_NtQueryVolumeInformationFile_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }; break;
 // 175 NTSTATUS NtQueueApcThread ['HANDLE ThreadHandle', ' PPS_APC_ROUTINE ApcRoutine', ' PVOID ApcArgument1', ' PVOID ApcArgument2', ' PVOID ApcArgument3']
 case 175: {
+if (PPP_CHECK_CB(on_NtQueueApcThread_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
-if (PPP_CHECK_CB(on_NtQueueApcThread_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtQueueApcThread_return, rp.proc_id, pc, 175, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }
-PPP_RUN_CB(on_NtQueueApcThread_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }; break;
 // 176 NTSTATUS NtRaiseException ['PEXCEPTION_RECORD ExceptionRecord', ' PCONTEXT ContextRecord', ' BOOLEAN FirstChance']
 case 176: {
+if (PPP_CHECK_CB(on_NtRaiseException_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
-if (PPP_CHECK_CB(on_NtRaiseException_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtRaiseException_return, rp.proc_id, pc, 176, env,pc,arg0,arg1,arg2) ; 
 }
-PPP_RUN_CB(on_NtRaiseException_return, env,pc,arg0,arg1,arg2) ; 
 }; break;
 // 177 NTSTATUS NtRaiseHardError ['NTSTATUS ErrorStatus', ' ULONG NumberOfParameters', ' ULONG UnicodeStringParameterMask', ' PULONG_PTR Parameters', ' ULONG ValidResponseOptions', ' PULONG Response']
 case 177: {
+if (PPP_CHECK_CB(on_NtRaiseHardError_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
 uint32_t arg5;
-if (PPP_CHECK_CB(on_NtRaiseHardError_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
 memcpy(&arg5, rp.params[5], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtRaiseHardError_return, rp.proc_id, pc, 177, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
 }
-PPP_RUN_CB(on_NtRaiseHardError_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
 }; break;
 // 178 NTSTATUS NtReadFile ['HANDLE FileHandle', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID Buffer', ' ULONG Length', ' PLARGE_INTEGER ByteOffset', ' PULONG Key']
 case 178: {
+if (PPP_CHECK_CB(on_NtReadFile_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
@@ -2697,7 +2698,6 @@ uint32_t arg5;
 uint32_t arg6;
 uint32_t arg7;
 uint32_t arg8;
-if (PPP_CHECK_CB(on_NtReadFile_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
@@ -2707,11 +2707,12 @@ memcpy(&arg5, rp.params[5], sizeof(uint32_t));
 memcpy(&arg6, rp.params[6], sizeof(uint32_t));
 memcpy(&arg7, rp.params[7], sizeof(uint32_t));
 memcpy(&arg8, rp.params[8], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtReadFile_return, rp.proc_id, pc, 178, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
 }
-PPP_RUN_CB(on_NtReadFile_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
 }; break;
 // 179 NTSTATUS NtReadFileScatter ['HANDLE FileHandle', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' PFILE_SEGMENT_ELEMENT SegmentArray', ' ULONG Length', ' PLARGE_INTEGER ByteOffset', ' PULONG Key']
 case 179: {
+if (PPP_CHECK_CB(on_NtReadFileScatter_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
@@ -2721,7 +2722,6 @@ uint32_t arg5;
 uint32_t arg6;
 uint32_t arg7;
 uint32_t arg8;
-if (PPP_CHECK_CB(on_NtReadFileScatter_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
@@ -2731,281 +2731,282 @@ memcpy(&arg5, rp.params[5], sizeof(uint32_t));
 memcpy(&arg6, rp.params[6], sizeof(uint32_t));
 memcpy(&arg7, rp.params[7], sizeof(uint32_t));
 memcpy(&arg8, rp.params[8], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtReadFileScatter_return, rp.proc_id, pc, 179, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
 }
-PPP_RUN_CB(on_NtReadFileScatter_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
 }; break;
 // 180 NTSTATUS NtReadRequestData ['HANDLE PortHandle', ' PPORT_MESSAGE Message', ' ULONG DataEntryIndex', ' PVOID Buffer', ' SIZE_T BufferSize', ' PSIZE_T NumberOfBytesRead']
 case 180: {
+if (PPP_CHECK_CB(on_NtReadRequestData_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
 uint32_t arg5;
-if (PPP_CHECK_CB(on_NtReadRequestData_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
 memcpy(&arg5, rp.params[5], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtReadRequestData_return, rp.proc_id, pc, 180, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
 }
-PPP_RUN_CB(on_NtReadRequestData_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
 }; break;
 // 181 NTSTATUS NtReadVirtualMemory ['HANDLE ProcessHandle', ' PVOID BaseAddress', ' PVOID Buffer', ' SIZE_T BufferSize', ' PSIZE_T NumberOfBytesRead']
 case 181: {
+if (PPP_CHECK_CB(on_NtReadVirtualMemory_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
-if (PPP_CHECK_CB(on_NtReadVirtualMemory_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtReadVirtualMemory_return, rp.proc_id, pc, 181, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }
-PPP_RUN_CB(on_NtReadVirtualMemory_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }; break;
 // 182 NTSTATUS NtRegisterThreadTerminatePort ['HANDLE PortHandle']
 case 182: {
-uint32_t arg0;
 if (PPP_CHECK_CB(on_NtRegisterThreadTerminatePort_return)) {
+uint32_t arg0;
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtRegisterThreadTerminatePort_return, rp.proc_id, pc, 182, env,pc,arg0) ; 
 }
-PPP_RUN_CB(on_NtRegisterThreadTerminatePort_return, env,pc,arg0) ; 
 }; break;
 // 183 NTSTATUS NtReleaseMutant ['HANDLE MutantHandle', ' PLONG PreviousCount']
 case 183: {
+if (PPP_CHECK_CB(on_NtReleaseMutant_return)) {
 uint32_t arg0;
 uint32_t arg1;
-if (PPP_CHECK_CB(on_NtReleaseMutant_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtReleaseMutant_return, rp.proc_id, pc, 183, env,pc,arg0,arg1) ; 
 }
-PPP_RUN_CB(on_NtReleaseMutant_return, env,pc,arg0,arg1) ; 
 }; break;
 // 184 NTSTATUS NtReleaseSemaphore ['HANDLE SemaphoreHandle', ' LONG ReleaseCount', ' PLONG PreviousCount']
 case 184: {
+if (PPP_CHECK_CB(on_NtReleaseSemaphore_return)) {
 uint32_t arg0;
 int32_t arg1;
 uint32_t arg2;
-if (PPP_CHECK_CB(on_NtReleaseSemaphore_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(int32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtReleaseSemaphore_return, rp.proc_id, pc, 184, env,pc,arg0,arg1,arg2) ; 
 }
-PPP_RUN_CB(on_NtReleaseSemaphore_return, env,pc,arg0,arg1,arg2) ; 
 }; break;
 // 185 NTSTATUS NtRemoveIoCompletion ['HANDLE IoCompletionHandle', ' PVOID *KeyContext', ' PVOID *ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' PLARGE_INTEGER Timeout']
 case 185: {
+if (PPP_CHECK_CB(on_NtRemoveIoCompletion_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
-if (PPP_CHECK_CB(on_NtRemoveIoCompletion_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtRemoveIoCompletion_return, rp.proc_id, pc, 185, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }
-PPP_RUN_CB(on_NtRemoveIoCompletion_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }; break;
 // 186 NTSTATUS NtRemoveProcessDebug ['HANDLE ProcessHandle', ' HANDLE DebugObjectHandle']
 case 186: {
+if (PPP_CHECK_CB(on_NtRemoveProcessDebug_return)) {
 uint32_t arg0;
 uint32_t arg1;
-if (PPP_CHECK_CB(on_NtRemoveProcessDebug_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtRemoveProcessDebug_return, rp.proc_id, pc, 186, env,pc,arg0,arg1) ; 
 }
-PPP_RUN_CB(on_NtRemoveProcessDebug_return, env,pc,arg0,arg1) ; 
 }; break;
 // 187 NTSTATUS NtRenameKey ['HANDLE KeyHandle', ' PUNICODE_STRING NewName']
 case 187: {
+if (PPP_CHECK_CB(on_NtRenameKey_return)) {
 uint32_t arg0;
 uint32_t arg1;
-if (PPP_CHECK_CB(on_NtRenameKey_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtRenameKey_return, rp.proc_id, pc, 187, env,pc,arg0,arg1) ; 
 }
-PPP_RUN_CB(on_NtRenameKey_return, env,pc,arg0,arg1) ; 
 }; break;
 // 188 NTSTATUS NtReplaceKey ['POBJECT_ATTRIBUTES NewFile', ' HANDLE TargetHandle', ' POBJECT_ATTRIBUTES OldFile']
 case 188: {
+if (PPP_CHECK_CB(on_NtReplaceKey_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
-if (PPP_CHECK_CB(on_NtReplaceKey_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtReplaceKey_return, rp.proc_id, pc, 188, env,pc,arg0,arg1,arg2) ; 
 }
-PPP_RUN_CB(on_NtReplaceKey_return, env,pc,arg0,arg1,arg2) ; 
 }; break;
 // 189 NTSTATUS NtReplyPort ['HANDLE PortHandle', ' PPORT_MESSAGE ReplyMessage']
 case 189: {
+if (PPP_CHECK_CB(on_NtReplyPort_return)) {
 uint32_t arg0;
 uint32_t arg1;
-if (PPP_CHECK_CB(on_NtReplyPort_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtReplyPort_return, rp.proc_id, pc, 189, env,pc,arg0,arg1) ; 
 }
-PPP_RUN_CB(on_NtReplyPort_return, env,pc,arg0,arg1) ; 
 }; break;
 // 190 NTSTATUS NtReplyWaitReceivePort ['HANDLE PortHandle', ' PVOID *PortContext ', ' PPORT_MESSAGE ReplyMessage', ' PPORT_MESSAGE ReceiveMessage']
 case 190: {
+if (PPP_CHECK_CB(on_NtReplyWaitReceivePort_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
-if (PPP_CHECK_CB(on_NtReplyWaitReceivePort_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtReplyWaitReceivePort_return, rp.proc_id, pc, 190, env,pc,arg0,arg1,arg2,arg3) ; 
 }
-PPP_RUN_CB(on_NtReplyWaitReceivePort_return, env,pc,arg0,arg1,arg2,arg3) ; 
 }; break;
 // 191 NTSTATUS NtReplyWaitReceivePortEx ['HANDLE PortHandle', ' PVOID *PortContext', ' PPORT_MESSAGE ReplyMessage', ' PPORT_MESSAGE ReceiveMessage', ' PLARGE_INTEGER Timeout']
 case 191: {
+if (PPP_CHECK_CB(on_NtReplyWaitReceivePortEx_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
-if (PPP_CHECK_CB(on_NtReplyWaitReceivePortEx_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtReplyWaitReceivePortEx_return, rp.proc_id, pc, 191, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }
-PPP_RUN_CB(on_NtReplyWaitReceivePortEx_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }; break;
 // 192 NTSTATUS NtReplyWaitReplyPort ['HANDLE PortHandle', ' PPORT_MESSAGE ReplyMessage']
 case 192: {
+if (PPP_CHECK_CB(on_NtReplyWaitReplyPort_return)) {
 uint32_t arg0;
 uint32_t arg1;
-if (PPP_CHECK_CB(on_NtReplyWaitReplyPort_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtReplyWaitReplyPort_return, rp.proc_id, pc, 192, env,pc,arg0,arg1) ; 
 }
-PPP_RUN_CB(on_NtReplyWaitReplyPort_return, env,pc,arg0,arg1) ; 
 }; break;
 // 194 NTSTATUS NtRequestPort ['HANDLE PortHandle', ' PPORT_MESSAGE RequestMessage']
 case 194: {
+if (PPP_CHECK_CB(on_NtRequestPort_return)) {
 uint32_t arg0;
 uint32_t arg1;
-if (PPP_CHECK_CB(on_NtRequestPort_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtRequestPort_return, rp.proc_id, pc, 194, env,pc,arg0,arg1) ; 
 }
-PPP_RUN_CB(on_NtRequestPort_return, env,pc,arg0,arg1) ; 
 }; break;
 // 195 NTSTATUS NtRequestWaitReplyPort ['HANDLE PortHandle', ' PPORT_MESSAGE RequestMessage', ' PPORT_MESSAGE ReplyMessage']
 case 195: {
+if (PPP_CHECK_CB(on_NtRequestWaitReplyPort_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
-if (PPP_CHECK_CB(on_NtRequestWaitReplyPort_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtRequestWaitReplyPort_return, rp.proc_id, pc, 195, env,pc,arg0,arg1,arg2) ; 
 }
-PPP_RUN_CB(on_NtRequestWaitReplyPort_return, env,pc,arg0,arg1,arg2) ; 
 }; break;
 // 197 NTSTATUS NtResetEvent ['HANDLE EventHandle', ' PLONG PreviousState']
 case 197: {
+if (PPP_CHECK_CB(on_NtResetEvent_return)) {
 uint32_t arg0;
 uint32_t arg1;
-if (PPP_CHECK_CB(on_NtResetEvent_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtResetEvent_return, rp.proc_id, pc, 197, env,pc,arg0,arg1) ; 
 }
-PPP_RUN_CB(on_NtResetEvent_return, env,pc,arg0,arg1) ; 
 }; break;
 // 198 NTSTATUS NtResetWriteWatch ['HANDLE ProcessHandle', ' PVOID BaseAddress', ' SIZE_T RegionSize']
 case 198: {
+if (PPP_CHECK_CB(on_NtResetWriteWatch_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
-if (PPP_CHECK_CB(on_NtResetWriteWatch_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtResetWriteWatch_return, rp.proc_id, pc, 198, env,pc,arg0,arg1,arg2) ; 
 }
-PPP_RUN_CB(on_NtResetWriteWatch_return, env,pc,arg0,arg1,arg2) ; 
 }; break;
 // 199 NTSTATUS NtRestoreKey ['HANDLE KeyHandle', ' HANDLE FileHandle', ' ULONG Flags']
 case 199: {
+if (PPP_CHECK_CB(on_NtRestoreKey_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
-if (PPP_CHECK_CB(on_NtRestoreKey_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtRestoreKey_return, rp.proc_id, pc, 199, env,pc,arg0,arg1,arg2) ; 
 }
-PPP_RUN_CB(on_NtRestoreKey_return, env,pc,arg0,arg1,arg2) ; 
 }; break;
 // 200 NTSTATUS NtResumeProcess ['HANDLE ProcessHandle']
 case 200: {
-uint32_t arg0;
 if (PPP_CHECK_CB(on_NtResumeProcess_return)) {
+uint32_t arg0;
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtResumeProcess_return, rp.proc_id, pc, 200, env,pc,arg0) ; 
 }
-PPP_RUN_CB(on_NtResumeProcess_return, env,pc,arg0) ; 
 }; break;
 // 201 NTSTATUS NtResumeThread ['HANDLE ThreadHandle', ' PULONG PreviousSuspendCount']
 case 201: {
+if (PPP_CHECK_CB(on_NtResumeThread_return)) {
 uint32_t arg0;
 uint32_t arg1;
-if (PPP_CHECK_CB(on_NtResumeThread_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtResumeThread_return, rp.proc_id, pc, 201, env,pc,arg0,arg1) ; 
 }
-PPP_RUN_CB(on_NtResumeThread_return, env,pc,arg0,arg1) ; 
 }; break;
 // 202 NTSTATUS NtSaveKey ['HANDLE KeyHandle', ' HANDLE FileHandle']
 case 202: {
+if (PPP_CHECK_CB(on_NtSaveKey_return)) {
 uint32_t arg0;
 uint32_t arg1;
-if (PPP_CHECK_CB(on_NtSaveKey_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtSaveKey_return, rp.proc_id, pc, 202, env,pc,arg0,arg1) ; 
 }
-PPP_RUN_CB(on_NtSaveKey_return, env,pc,arg0,arg1) ; 
 }; break;
 // 203 NTSTATUS NtSaveKeyEx ['HANDLE KeyHandle', ' HANDLE FileHandle', ' ULONG Format']
 case 203: {
+if (PPP_CHECK_CB(on_NtSaveKeyEx_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
-if (PPP_CHECK_CB(on_NtSaveKeyEx_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtSaveKeyEx_return, rp.proc_id, pc, 203, env,pc,arg0,arg1,arg2) ; 
 }
-PPP_RUN_CB(on_NtSaveKeyEx_return, env,pc,arg0,arg1,arg2) ; 
 }; break;
 // 204 NTSTATUS NtSaveMergedKeys ['HANDLE HighPrecedenceKeyHandle', ' HANDLE LowPrecedenceKeyHandle', ' HANDLE FileHandle']
 case 204: {
+if (PPP_CHECK_CB(on_NtSaveMergedKeys_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
-if (PPP_CHECK_CB(on_NtSaveMergedKeys_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtSaveMergedKeys_return, rp.proc_id, pc, 204, env,pc,arg0,arg1,arg2) ; 
 }
-PPP_RUN_CB(on_NtSaveMergedKeys_return, env,pc,arg0,arg1,arg2) ; 
 }; break;
 // 205 NTSTATUS NtSecureConnectPort ['PHANDLE PortHandle', ' PUNICODE_STRING PortName', ' PSECURITY_QUALITY_OF_SERVICE SecurityQos', ' PPORT_VIEW ClientView', ' PSID RequiredServerSid', ' PREMOTE_PORT_VIEW ServerView', ' PULONG MaxMessageLength', ' PVOID ConnectionInformation', ' PULONG ConnectionInformationLength']
 case 205: {
+if (PPP_CHECK_CB(on_NtSecureConnectPort_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
@@ -3015,7 +3016,6 @@ uint32_t arg5;
 uint32_t arg6;
 uint32_t arg7;
 uint32_t arg8;
-if (PPP_CHECK_CB(on_NtSecureConnectPort_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
@@ -3025,363 +3025,364 @@ memcpy(&arg5, rp.params[5], sizeof(uint32_t));
 memcpy(&arg6, rp.params[6], sizeof(uint32_t));
 memcpy(&arg7, rp.params[7], sizeof(uint32_t));
 memcpy(&arg8, rp.params[8], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtSecureConnectPort_return, rp.proc_id, pc, 205, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
 }
-PPP_RUN_CB(on_NtSecureConnectPort_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
 }; break;
 // 206 NTSTATUS NtSetContextThread ['HANDLE ThreadHandle', ' PCONTEXT ThreadContext']
 case 206: {
+if (PPP_CHECK_CB(on_NtSetContextThread_return)) {
 uint32_t arg0;
 uint32_t arg1;
-if (PPP_CHECK_CB(on_NtSetContextThread_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtSetContextThread_return, rp.proc_id, pc, 206, env,pc,arg0,arg1) ; 
 }
-PPP_RUN_CB(on_NtSetContextThread_return, env,pc,arg0,arg1) ; 
 }; break;
 // 207 NTSTATUS NtSetDebugFilterState ['ULONG ComponentId', ' ULONG Level', ' BOOLEAN State']
 case 207: {
+if (PPP_CHECK_CB(on_NtSetDebugFilterState_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
-if (PPP_CHECK_CB(on_NtSetDebugFilterState_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtSetDebugFilterState_return, rp.proc_id, pc, 207, env,pc,arg0,arg1,arg2) ; 
 }
-PPP_RUN_CB(on_NtSetDebugFilterState_return, env,pc,arg0,arg1,arg2) ; 
 }; break;
 // 208 NTSTATUS NtSetDefaultHardErrorPort ['HANDLE DefaultHardErrorPort']
 case 208: {
-uint32_t arg0;
 if (PPP_CHECK_CB(on_NtSetDefaultHardErrorPort_return)) {
+uint32_t arg0;
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtSetDefaultHardErrorPort_return, rp.proc_id, pc, 208, env,pc,arg0) ; 
 }
-PPP_RUN_CB(on_NtSetDefaultHardErrorPort_return, env,pc,arg0) ; 
 }; break;
 // 209 NTSTATUS NtSetDefaultLocale ['BOOLEAN UserProfile', ' LCID DefaultLocaleId']
 case 209: {
+if (PPP_CHECK_CB(on_NtSetDefaultLocale_return)) {
 uint32_t arg0;
 uint32_t arg1;
-if (PPP_CHECK_CB(on_NtSetDefaultLocale_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtSetDefaultLocale_return, rp.proc_id, pc, 209, env,pc,arg0,arg1) ; 
 }
-PPP_RUN_CB(on_NtSetDefaultLocale_return, env,pc,arg0,arg1) ; 
 }; break;
 // 210 NTSTATUS NtSetDefaultUILanguage ['LANGID DefaultUILanguageId']
 case 210: {
-uint32_t arg0;
 if (PPP_CHECK_CB(on_NtSetDefaultUILanguage_return)) {
+uint32_t arg0;
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtSetDefaultUILanguage_return, rp.proc_id, pc, 210, env,pc,arg0) ; 
 }
-PPP_RUN_CB(on_NtSetDefaultUILanguage_return, env,pc,arg0) ; 
 }; break;
 // 211 NTSTATUS NtSetEaFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID Buffer', ' ULONG Length']
 case 211: {
+if (PPP_CHECK_CB(on_NtSetEaFile_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
-if (PPP_CHECK_CB(on_NtSetEaFile_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtSetEaFile_return, rp.proc_id, pc, 211, env,pc,arg0,arg1,arg2,arg3) ; 
 }
-PPP_RUN_CB(on_NtSetEaFile_return, env,pc,arg0,arg1,arg2,arg3) ; 
 }; break;
 // 212 NTSTATUS NtSetEvent ['HANDLE EventHandle', ' PLONG PreviousState']
 case 212: {
+if (PPP_CHECK_CB(on_NtSetEvent_return)) {
 uint32_t arg0;
 uint32_t arg1;
-if (PPP_CHECK_CB(on_NtSetEvent_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtSetEvent_return, rp.proc_id, pc, 212, env,pc,arg0,arg1) ; 
 }
-PPP_RUN_CB(on_NtSetEvent_return, env,pc,arg0,arg1) ; 
 }; break;
 // 213 NTSTATUS NtSetEventBoostPriority ['HANDLE EventHandle']
 case 213: {
-uint32_t arg0;
 if (PPP_CHECK_CB(on_NtSetEventBoostPriority_return)) {
+uint32_t arg0;
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtSetEventBoostPriority_return, rp.proc_id, pc, 213, env,pc,arg0) ; 
 }
-PPP_RUN_CB(on_NtSetEventBoostPriority_return, env,pc,arg0) ; 
 }; break;
 // 214 NTSTATUS NtSetHighEventPair ['HANDLE EventPairHandle']
 case 214: {
-uint32_t arg0;
 if (PPP_CHECK_CB(on_NtSetHighEventPair_return)) {
+uint32_t arg0;
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtSetHighEventPair_return, rp.proc_id, pc, 214, env,pc,arg0) ; 
 }
-PPP_RUN_CB(on_NtSetHighEventPair_return, env,pc,arg0) ; 
 }; break;
 // 215 NTSTATUS NtSetHighWaitLowEventPair ['HANDLE EventPairHandle']
 case 215: {
-uint32_t arg0;
 if (PPP_CHECK_CB(on_NtSetHighWaitLowEventPair_return)) {
+uint32_t arg0;
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtSetHighWaitLowEventPair_return, rp.proc_id, pc, 215, env,pc,arg0) ; 
 }
-PPP_RUN_CB(on_NtSetHighWaitLowEventPair_return, env,pc,arg0) ; 
 }; break;
 // 216 NTSTATUS NtSetInformationDebugObject ['HANDLE DebugObjectHandle', ' DEBUGOBJECTINFOCLASS DebugObjectInformationClass', ' PVOID DebugInformation', ' ULONG DebugInformationLength', ' PULONG ReturnLength']
 case 216: {
+if (PPP_CHECK_CB(on_NtSetInformationDebugObject_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
-if (PPP_CHECK_CB(on_NtSetInformationDebugObject_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtSetInformationDebugObject_return, rp.proc_id, pc, 216, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }
-PPP_RUN_CB(on_NtSetInformationDebugObject_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }; break;
 // 217 NTSTATUS NtSetInformationFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID FileInformation', ' ULONG Length', ' FILE_INFORMATION_CLASS FileInformationClass']
 case 217: {
+if (PPP_CHECK_CB(on_NtSetInformationFile_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
-if (PPP_CHECK_CB(on_NtSetInformationFile_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtSetInformationFile_return, rp.proc_id, pc, 217, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }
-PPP_RUN_CB(on_NtSetInformationFile_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }; break;
 // 218 NTSTATUS NtSetInformationJobObject ['HANDLE JobHandle', ' JOBOBJECTINFOCLASS JobObjectInformationClass', ' PVOID JobObjectInformation', ' ULONG JobObjectInformationLength']
 case 218: {
+if (PPP_CHECK_CB(on_NtSetInformationJobObject_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
-if (PPP_CHECK_CB(on_NtSetInformationJobObject_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtSetInformationJobObject_return, rp.proc_id, pc, 218, env,pc,arg0,arg1,arg2,arg3) ; 
 }
-PPP_RUN_CB(on_NtSetInformationJobObject_return, env,pc,arg0,arg1,arg2,arg3) ; 
 }; break;
 // 219 NTSTATUS NtSetInformationKey ['HANDLE KeyHandle', ' KEY_SET_INFORMATION_CLASS KeySetInformationClass', ' PVOID KeySetInformation', ' ULONG KeySetInformationLength']
 case 219: {
+if (PPP_CHECK_CB(on_NtSetInformationKey_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
-if (PPP_CHECK_CB(on_NtSetInformationKey_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtSetInformationKey_return, rp.proc_id, pc, 219, env,pc,arg0,arg1,arg2,arg3) ; 
 }
-PPP_RUN_CB(on_NtSetInformationKey_return, env,pc,arg0,arg1,arg2,arg3) ; 
 }; break;
 // 220 NTSTATUS NtSetInformationObject ['HANDLE Handle', ' OBJECT_INFORMATION_CLASS ObjectInformationClass', ' PVOID ObjectInformation', ' ULONG ObjectInformationLength']
 case 220: {
+if (PPP_CHECK_CB(on_NtSetInformationObject_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
-if (PPP_CHECK_CB(on_NtSetInformationObject_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtSetInformationObject_return, rp.proc_id, pc, 220, env,pc,arg0,arg1,arg2,arg3) ; 
 }
-PPP_RUN_CB(on_NtSetInformationObject_return, env,pc,arg0,arg1,arg2,arg3) ; 
 }; break;
 // 221 NTSTATUS NtSetInformationProcess ['HANDLE ProcessHandle', ' PROCESSINFOCLASS ProcessInformationClass', ' PVOID ProcessInformation', ' ULONG ProcessInformationLength']
 case 221: {
+if (PPP_CHECK_CB(on_NtSetInformationProcess_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
-if (PPP_CHECK_CB(on_NtSetInformationProcess_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtSetInformationProcess_return, rp.proc_id, pc, 221, env,pc,arg0,arg1,arg2,arg3) ; 
 }
-PPP_RUN_CB(on_NtSetInformationProcess_return, env,pc,arg0,arg1,arg2,arg3) ; 
 }; break;
 // 222 NTSTATUS NtSetInformationThread ['HANDLE ThreadHandle', ' THREADINFOCLASS ThreadInformationClass', ' PVOID ThreadInformation', ' ULONG ThreadInformationLength']
 case 222: {
+if (PPP_CHECK_CB(on_NtSetInformationThread_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
-if (PPP_CHECK_CB(on_NtSetInformationThread_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtSetInformationThread_return, rp.proc_id, pc, 222, env,pc,arg0,arg1,arg2,arg3) ; 
 }
-PPP_RUN_CB(on_NtSetInformationThread_return, env,pc,arg0,arg1,arg2,arg3) ; 
 }; break;
 // 223 NTSTATUS NtSetInformationToken ['HANDLE TokenHandle', ' TOKEN_INFORMATION_CLASS TokenInformationClass', ' PVOID TokenInformation', ' ULONG TokenInformationLength']
 case 223: {
+if (PPP_CHECK_CB(on_NtSetInformationToken_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
-if (PPP_CHECK_CB(on_NtSetInformationToken_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtSetInformationToken_return, rp.proc_id, pc, 223, env,pc,arg0,arg1,arg2,arg3) ; 
 }
-PPP_RUN_CB(on_NtSetInformationToken_return, env,pc,arg0,arg1,arg2,arg3) ; 
 }; break;
 // 224 NTSTATUS NtSetIntervalProfile ['ULONG Interval', ' KPROFILE_SOURCE Source']
 case 224: {
+if (PPP_CHECK_CB(on_NtSetIntervalProfile_return)) {
 uint32_t arg0;
 uint32_t arg1;
-if (PPP_CHECK_CB(on_NtSetIntervalProfile_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtSetIntervalProfile_return, rp.proc_id, pc, 224, env,pc,arg0,arg1) ; 
 }
-PPP_RUN_CB(on_NtSetIntervalProfile_return, env,pc,arg0,arg1) ; 
 }; break;
 // 225 NTSTATUS NtSetIoCompletion ['HANDLE IoCompletionHandle', ' PVOID KeyContext', ' PVOID ApcContext', ' NTSTATUS IoStatus', ' ULONG_PTR IoStatusInformation']
 case 225: {
+if (PPP_CHECK_CB(on_NtSetIoCompletion_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
-if (PPP_CHECK_CB(on_NtSetIoCompletion_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtSetIoCompletion_return, rp.proc_id, pc, 225, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }
-PPP_RUN_CB(on_NtSetIoCompletion_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }; break;
 // 226 NTSTATUS NtSetLdtEntries ['ULONG Selector0', ' ULONG Entry0Low', ' ULONG Entry0Hi', ' ULONG Selector1', ' ULONG Entry1Low', ' ULONG Entry1Hi']
 case 226: {
+if (PPP_CHECK_CB(on_NtSetLdtEntries_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
 uint32_t arg5;
-if (PPP_CHECK_CB(on_NtSetLdtEntries_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
 memcpy(&arg5, rp.params[5], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtSetLdtEntries_return, rp.proc_id, pc, 226, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
 }
-PPP_RUN_CB(on_NtSetLdtEntries_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
 }; break;
 // 227 NTSTATUS NtSetLowEventPair ['HANDLE EventPairHandle']
 case 227: {
-uint32_t arg0;
 if (PPP_CHECK_CB(on_NtSetLowEventPair_return)) {
+uint32_t arg0;
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtSetLowEventPair_return, rp.proc_id, pc, 227, env,pc,arg0) ; 
 }
-PPP_RUN_CB(on_NtSetLowEventPair_return, env,pc,arg0) ; 
 }; break;
 // 228 NTSTATUS NtSetLowWaitHighEventPair ['HANDLE EventPairHandle']
 case 228: {
-uint32_t arg0;
 if (PPP_CHECK_CB(on_NtSetLowWaitHighEventPair_return)) {
+uint32_t arg0;
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtSetLowWaitHighEventPair_return, rp.proc_id, pc, 228, env,pc,arg0) ; 
 }
-PPP_RUN_CB(on_NtSetLowWaitHighEventPair_return, env,pc,arg0) ; 
 }; break;
 // 229 NTSTATUS NtSetQuotaInformationFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID Buffer', ' ULONG Length']
 case 229: {
+if (PPP_CHECK_CB(on_NtSetQuotaInformationFile_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
-if (PPP_CHECK_CB(on_NtSetQuotaInformationFile_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtSetQuotaInformationFile_return, rp.proc_id, pc, 229, env,pc,arg0,arg1,arg2,arg3) ; 
 }
-PPP_RUN_CB(on_NtSetQuotaInformationFile_return, env,pc,arg0,arg1,arg2,arg3) ; 
 }; break;
 // 230 NTSTATUS NtSetSecurityObject ['HANDLE Handle', ' SECURITY_INFORMATION SecurityInformation', ' PSECURITY_DESCRIPTOR SecurityDescriptor']
 case 230: {
+if (PPP_CHECK_CB(on_NtSetSecurityObject_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
-if (PPP_CHECK_CB(on_NtSetSecurityObject_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtSetSecurityObject_return, rp.proc_id, pc, 230, env,pc,arg0,arg1,arg2) ; 
 }
-PPP_RUN_CB(on_NtSetSecurityObject_return, env,pc,arg0,arg1,arg2) ; 
 }; break;
 // 231 NTSTATUS NtSetSystemEnvironmentValue ['PUNICODE_STRING VariableName', ' PUNICODE_STRING VariableValue']
 case 231: {
+if (PPP_CHECK_CB(on_NtSetSystemEnvironmentValue_return)) {
 uint32_t arg0;
 uint32_t arg1;
-if (PPP_CHECK_CB(on_NtSetSystemEnvironmentValue_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtSetSystemEnvironmentValue_return, rp.proc_id, pc, 231, env,pc,arg0,arg1) ; 
 }
-PPP_RUN_CB(on_NtSetSystemEnvironmentValue_return, env,pc,arg0,arg1) ; 
 }; break;
 // 232 NTSTATUS NtSetSystemInformation ['SYSTEM_INFORMATION_CLASS SystemInformationClass', ' PVOID SystemInformation', ' ULONG SystemInformationLength']
 case 232: {
+if (PPP_CHECK_CB(on_NtSetSystemInformation_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
-if (PPP_CHECK_CB(on_NtSetSystemInformation_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtSetSystemInformation_return, rp.proc_id, pc, 232, env,pc,arg0,arg1,arg2) ; 
 }
-PPP_RUN_CB(on_NtSetSystemInformation_return, env,pc,arg0,arg1,arg2) ; 
 }; break;
 // 233 NTSTATUS NtSetSystemPowerState ['POWER_ACTION SystemAction', ' SYSTEM_POWER_STATE MinSystemState', ' ULONG Flags']
 case 233: {
+if (PPP_CHECK_CB(on_NtSetSystemPowerState_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
-if (PPP_CHECK_CB(on_NtSetSystemPowerState_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtSetSystemPowerState_return, rp.proc_id, pc, 233, env,pc,arg0,arg1,arg2) ; 
 }
-PPP_RUN_CB(on_NtSetSystemPowerState_return, env,pc,arg0,arg1,arg2) ; 
 }; break;
 // 234 NTSTATUS NtSetSystemTime ['PLARGE_INTEGER SystemTime', ' PLARGE_INTEGER PreviousTime']
 case 234: {
+if (PPP_CHECK_CB(on_NtSetSystemTime_return)) {
 uint32_t arg0;
 uint32_t arg1;
-if (PPP_CHECK_CB(on_NtSetSystemTime_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtSetSystemTime_return, rp.proc_id, pc, 234, env,pc,arg0,arg1) ; 
 }
-PPP_RUN_CB(on_NtSetSystemTime_return, env,pc,arg0,arg1) ; 
 }; break;
 // 235 NTSTATUS NtSetThreadExecutionState ['EXECUTION_STATE esFlags', ' PEXECUTION_STATE PreviousFlags']
 case 235: {
+if (PPP_CHECK_CB(on_NtSetThreadExecutionState_return)) {
 uint32_t arg0;
 uint32_t arg1;
-if (PPP_CHECK_CB(on_NtSetThreadExecutionState_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtSetThreadExecutionState_return, rp.proc_id, pc, 235, env,pc,arg0,arg1) ; 
 }
-PPP_RUN_CB(on_NtSetThreadExecutionState_return, env,pc,arg0,arg1) ; 
 }; break;
 // 236 NTSTATUS NtSetTimer ['HANDLE TimerHandle', ' PLARGE_INTEGER DueTime', ' PTIMER_APC_ROUTINE TimerApcRoutine', ' PVOID TimerContext', ' BOOLEAN WakeTimer', ' LONG Period', ' PBOOLEAN PreviousState']
 case 236: {
+if (PPP_CHECK_CB(on_NtSetTimer_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
@@ -3389,7 +3390,6 @@ uint32_t arg3;
 uint32_t arg4;
 int32_t arg5;
 uint32_t arg6;
-if (PPP_CHECK_CB(on_NtSetTimer_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
@@ -3397,337 +3397,338 @@ memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
 memcpy(&arg5, rp.params[5], sizeof(int32_t));
 memcpy(&arg6, rp.params[6], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtSetTimer_return, rp.proc_id, pc, 236, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
 }
-PPP_RUN_CB(on_NtSetTimer_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6) ; 
 }; break;
 // 237 NTSTATUS NtSetTimerResolution ['ULONG DesiredTime', ' BOOLEAN SetResolution', ' PULONG ActualTime']
 case 237: {
+if (PPP_CHECK_CB(on_NtSetTimerResolution_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
-if (PPP_CHECK_CB(on_NtSetTimerResolution_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtSetTimerResolution_return, rp.proc_id, pc, 237, env,pc,arg0,arg1,arg2) ; 
 }
-PPP_RUN_CB(on_NtSetTimerResolution_return, env,pc,arg0,arg1,arg2) ; 
 }; break;
 // 238 NTSTATUS NtSetUuidSeed ['PCHAR Seed']
 case 238: {
-uint32_t arg0;
 if (PPP_CHECK_CB(on_NtSetUuidSeed_return)) {
+uint32_t arg0;
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtSetUuidSeed_return, rp.proc_id, pc, 238, env,pc,arg0) ; 
 }
-PPP_RUN_CB(on_NtSetUuidSeed_return, env,pc,arg0) ; 
 }; break;
 // 239 NTSTATUS NtSetValueKey ['HANDLE KeyHandle', ' PUNICODE_STRING ValueName', ' ULONG TitleIndex', ' ULONG Type', ' PVOID Data', ' ULONG DataSize']
 case 239: {
+if (PPP_CHECK_CB(on_NtSetValueKey_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
 uint32_t arg5;
-if (PPP_CHECK_CB(on_NtSetValueKey_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
 memcpy(&arg5, rp.params[5], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtSetValueKey_return, rp.proc_id, pc, 239, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
 }
-PPP_RUN_CB(on_NtSetValueKey_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
 }; break;
 // 240 NTSTATUS NtSetVolumeInformationFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID FsInformation', ' ULONG Length', ' FS_INFORMATION_CLASS FsInformationClass']
 case 240: {
+if (PPP_CHECK_CB(on_NtSetVolumeInformationFile_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
-if (PPP_CHECK_CB(on_NtSetVolumeInformationFile_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtSetVolumeInformationFile_return, rp.proc_id, pc, 240, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }
-PPP_RUN_CB(on_NtSetVolumeInformationFile_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }; break;
 // 241 NTSTATUS NtShutdownSystem ['SHUTDOWN_ACTION Action']
 case 241: {
-uint32_t arg0;
 if (PPP_CHECK_CB(on_NtShutdownSystem_return)) {
+uint32_t arg0;
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtShutdownSystem_return, rp.proc_id, pc, 241, env,pc,arg0) ; 
 }
-PPP_RUN_CB(on_NtShutdownSystem_return, env,pc,arg0) ; 
 }; break;
 // 242 NTSTATUS NtSignalAndWaitForSingleObject ['HANDLE SignalHandle', ' HANDLE WaitHandle', ' BOOLEAN Alertable', ' PLARGE_INTEGER Timeout']
 case 242: {
+if (PPP_CHECK_CB(on_NtSignalAndWaitForSingleObject_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
-if (PPP_CHECK_CB(on_NtSignalAndWaitForSingleObject_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtSignalAndWaitForSingleObject_return, rp.proc_id, pc, 242, env,pc,arg0,arg1,arg2,arg3) ; 
 }
-PPP_RUN_CB(on_NtSignalAndWaitForSingleObject_return, env,pc,arg0,arg1,arg2,arg3) ; 
 }; break;
 // 243 NTSTATUS NtStartProfile ['HANDLE ProfileHandle']
 case 243: {
-uint32_t arg0;
 if (PPP_CHECK_CB(on_NtStartProfile_return)) {
+uint32_t arg0;
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtStartProfile_return, rp.proc_id, pc, 243, env,pc,arg0) ; 
 }
-PPP_RUN_CB(on_NtStartProfile_return, env,pc,arg0) ; 
 }; break;
 // 244 NTSTATUS NtStopProfile ['HANDLE ProfileHandle']
 case 244: {
-uint32_t arg0;
 if (PPP_CHECK_CB(on_NtStopProfile_return)) {
+uint32_t arg0;
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtStopProfile_return, rp.proc_id, pc, 244, env,pc,arg0) ; 
 }
-PPP_RUN_CB(on_NtStopProfile_return, env,pc,arg0) ; 
 }; break;
 // 245 NTSTATUS NtSuspendProcess ['HANDLE ProcessHandle']
 case 245: {
-uint32_t arg0;
 if (PPP_CHECK_CB(on_NtSuspendProcess_return)) {
+uint32_t arg0;
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtSuspendProcess_return, rp.proc_id, pc, 245, env,pc,arg0) ; 
 }
-PPP_RUN_CB(on_NtSuspendProcess_return, env,pc,arg0) ; 
 }; break;
 // 246 NTSTATUS NtSuspendThread ['HANDLE ThreadHandle', ' PULONG PreviousSuspendCount']
 case 246: {
+if (PPP_CHECK_CB(on_NtSuspendThread_return)) {
 uint32_t arg0;
 uint32_t arg1;
-if (PPP_CHECK_CB(on_NtSuspendThread_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtSuspendThread_return, rp.proc_id, pc, 246, env,pc,arg0,arg1) ; 
 }
-PPP_RUN_CB(on_NtSuspendThread_return, env,pc,arg0,arg1) ; 
 }; break;
 // 247 NTSTATUS NtSystemDebugControl ['SYSDBG_COMMAND Command', ' PVOID InputBuffer', ' ULONG InputBufferLength', ' PVOID OutputBuffer', ' ULONG OutputBufferLength', ' PULONG ReturnLength']
 case 247: {
+if (PPP_CHECK_CB(on_NtSystemDebugControl_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
 uint32_t arg5;
-if (PPP_CHECK_CB(on_NtSystemDebugControl_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
 memcpy(&arg5, rp.params[5], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtSystemDebugControl_return, rp.proc_id, pc, 247, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
 }
-PPP_RUN_CB(on_NtSystemDebugControl_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
 }; break;
 // 248 NTSTATUS NtTerminateJobObject ['HANDLE JobHandle', ' NTSTATUS ExitStatus']
 case 248: {
+if (PPP_CHECK_CB(on_NtTerminateJobObject_return)) {
 uint32_t arg0;
 uint32_t arg1;
-if (PPP_CHECK_CB(on_NtTerminateJobObject_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtTerminateJobObject_return, rp.proc_id, pc, 248, env,pc,arg0,arg1) ; 
 }
-PPP_RUN_CB(on_NtTerminateJobObject_return, env,pc,arg0,arg1) ; 
 }; break;
 // 249 NTSTATUS NtTerminateProcess ['HANDLE ProcessHandle', ' NTSTATUS ExitStatus']
 case 249: {
+if (PPP_CHECK_CB(on_NtTerminateProcess_return)) {
 uint32_t arg0;
 uint32_t arg1;
-if (PPP_CHECK_CB(on_NtTerminateProcess_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtTerminateProcess_return, rp.proc_id, pc, 249, env,pc,arg0,arg1) ; 
 }
-PPP_RUN_CB(on_NtTerminateProcess_return, env,pc,arg0,arg1) ; 
 }; break;
 // 250 NTSTATUS NtTerminateThread ['HANDLE ThreadHandle', ' NTSTATUS ExitStatus']
 case 250: {
+if (PPP_CHECK_CB(on_NtTerminateThread_return)) {
 uint32_t arg0;
 uint32_t arg1;
-if (PPP_CHECK_CB(on_NtTerminateThread_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtTerminateThread_return, rp.proc_id, pc, 250, env,pc,arg0,arg1) ; 
 }
-PPP_RUN_CB(on_NtTerminateThread_return, env,pc,arg0,arg1) ; 
 }; break;
 // 251 NTSTATUS NtTestAlert ['']
 case 251: {
 if (PPP_CHECK_CB(on_NtTestAlert_return)) {
+PPP_RUN_CB_FILTERED(on_NtTestAlert_return, rp.proc_id, pc, 251, env,pc) ; 
 }
-PPP_RUN_CB(on_NtTestAlert_return, env,pc) ; 
 }; break;
 // 252 NTSTATUS NtTraceEvent ['HANDLE TraceHandle', ' ULONG Flags', ' ULONG FieldSize', ' PVOID Fields']
 case 252: {
+if (PPP_CHECK_CB(on_NtTraceEvent_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
-if (PPP_CHECK_CB(on_NtTraceEvent_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtTraceEvent_return, rp.proc_id, pc, 252, env,pc,arg0,arg1,arg2,arg3) ; 
 }
-PPP_RUN_CB(on_NtTraceEvent_return, env,pc,arg0,arg1,arg2,arg3) ; 
 }; break;
 // 253 NTSTATUS NtTranslateFilePath ['PFILE_PATH InputFilePath', ' ULONG OutputType', ' PFILE_PATH OutputFilePath', ' PULONG OutputFilePathLength']
 case 253: {
+if (PPP_CHECK_CB(on_NtTranslateFilePath_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
-if (PPP_CHECK_CB(on_NtTranslateFilePath_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtTranslateFilePath_return, rp.proc_id, pc, 253, env,pc,arg0,arg1,arg2,arg3) ; 
 }
-PPP_RUN_CB(on_NtTranslateFilePath_return, env,pc,arg0,arg1,arg2,arg3) ; 
 }; break;
 // 254 NTSTATUS NtUnloadDriver ['PUNICODE_STRING DriverServiceName']
 case 254: {
-uint32_t arg0;
 if (PPP_CHECK_CB(on_NtUnloadDriver_return)) {
+uint32_t arg0;
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtUnloadDriver_return, rp.proc_id, pc, 254, env,pc,arg0) ; 
 }
-PPP_RUN_CB(on_NtUnloadDriver_return, env,pc,arg0) ; 
 }; break;
 // 255 NTSTATUS NtUnloadKey ['POBJECT_ATTRIBUTES TargetKey']
 case 255: {
-uint32_t arg0;
 if (PPP_CHECK_CB(on_NtUnloadKey_return)) {
+uint32_t arg0;
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtUnloadKey_return, rp.proc_id, pc, 255, env,pc,arg0) ; 
 }
-PPP_RUN_CB(on_NtUnloadKey_return, env,pc,arg0) ; 
 }; break;
 // 256 NTSTATUS NtUnloadKeyEx ['POBJECT_ATTRIBUTES TargetKey', ' HANDLE Event']
 case 256: {
+if (PPP_CHECK_CB(on_NtUnloadKeyEx_return)) {
 uint32_t arg0;
 uint32_t arg1;
-if (PPP_CHECK_CB(on_NtUnloadKeyEx_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtUnloadKeyEx_return, rp.proc_id, pc, 256, env,pc,arg0,arg1) ; 
 }
-PPP_RUN_CB(on_NtUnloadKeyEx_return, env,pc,arg0,arg1) ; 
 }; break;
 // 257 NTSTATUS NtUnlockFile ['HANDLE FileHandle', ' PIO_STATUS_BLOCK IoStatusBlock', ' PLARGE_INTEGER ByteOffset', ' PLARGE_INTEGER Length', ' ULONG Key']
 case 257: {
+if (PPP_CHECK_CB(on_NtUnlockFile_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
-if (PPP_CHECK_CB(on_NtUnlockFile_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtUnlockFile_return, rp.proc_id, pc, 257, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }
-PPP_RUN_CB(on_NtUnlockFile_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }; break;
 // 258 NTSTATUS NtUnlockVirtualMemory ['HANDLE ProcessHandle', ' PVOID *BaseAddress', ' PSIZE_T RegionSize', ' ULONG MapType']
 case 258: {
+if (PPP_CHECK_CB(on_NtUnlockVirtualMemory_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
-if (PPP_CHECK_CB(on_NtUnlockVirtualMemory_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtUnlockVirtualMemory_return, rp.proc_id, pc, 258, env,pc,arg0,arg1,arg2,arg3) ; 
 }
-PPP_RUN_CB(on_NtUnlockVirtualMemory_return, env,pc,arg0,arg1,arg2,arg3) ; 
 }; break;
 // 259 NTSTATUS NtUnmapViewOfSection ['HANDLE ProcessHandle', ' PVOID BaseAddress']
 case 259: {
+if (PPP_CHECK_CB(on_NtUnmapViewOfSection_return)) {
 uint32_t arg0;
 uint32_t arg1;
-if (PPP_CHECK_CB(on_NtUnmapViewOfSection_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtUnmapViewOfSection_return, rp.proc_id, pc, 259, env,pc,arg0,arg1) ; 
 }
-PPP_RUN_CB(on_NtUnmapViewOfSection_return, env,pc,arg0,arg1) ; 
 }; break;
 // 260 NTSTATUS NtVdmControl ['VDMSERVICECLASS Service', ' PVOID ServiceData']
 case 260: {
+if (PPP_CHECK_CB(on_NtVdmControl_return)) {
 uint32_t arg0;
 uint32_t arg1;
-if (PPP_CHECK_CB(on_NtVdmControl_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtVdmControl_return, rp.proc_id, pc, 260, env,pc,arg0,arg1) ; 
 }
-PPP_RUN_CB(on_NtVdmControl_return, env,pc,arg0,arg1) ; 
 }; break;
 // 261 NTSTATUS NtWaitForDebugEvent ['HANDLE DebugObjectHandle', ' BOOLEAN Alertable', ' PLARGE_INTEGER Timeout', ' PDBGUI_WAIT_STATE_CHANGE WaitStateChange']
 case 261: {
+if (PPP_CHECK_CB(on_NtWaitForDebugEvent_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
-if (PPP_CHECK_CB(on_NtWaitForDebugEvent_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtWaitForDebugEvent_return, rp.proc_id, pc, 261, env,pc,arg0,arg1,arg2,arg3) ; 
 }
-PPP_RUN_CB(on_NtWaitForDebugEvent_return, env,pc,arg0,arg1,arg2,arg3) ; 
 }; break;
 // 262 NTSTATUS NtWaitForMultipleObjects ['ULONG Count', ' HANDLE Handles[]', ' WAIT_TYPE WaitType', ' BOOLEAN Alertable', ' PLARGE_INTEGER Timeout']
 case 262: {
+if (PPP_CHECK_CB(on_NtWaitForMultipleObjects_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
-if (PPP_CHECK_CB(on_NtWaitForMultipleObjects_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtWaitForMultipleObjects_return, rp.proc_id, pc, 262, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }
-PPP_RUN_CB(on_NtWaitForMultipleObjects_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }; break;
 // 263 NTSTATUS NtWaitForSingleObject ['HANDLE Handle', ' BOOLEAN Alertable', ' PLARGE_INTEGER Timeout']
 case 263: {
+if (PPP_CHECK_CB(on_NtWaitForSingleObject_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
-if (PPP_CHECK_CB(on_NtWaitForSingleObject_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtWaitForSingleObject_return, rp.proc_id, pc, 263, env,pc,arg0,arg1,arg2) ; 
 }
-PPP_RUN_CB(on_NtWaitForSingleObject_return, env,pc,arg0,arg1,arg2) ; 
 }; break;
 // 264 NTSTATUS NtWaitHighEventPair ['HANDLE EventPairHandle']
 case 264: {
-uint32_t arg0;
 if (PPP_CHECK_CB(on_NtWaitHighEventPair_return)) {
+uint32_t arg0;
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtWaitHighEventPair_return, rp.proc_id, pc, 264, env,pc,arg0) ; 
 }
-PPP_RUN_CB(on_NtWaitHighEventPair_return, env,pc,arg0) ; 
 }; break;
 // 265 NTSTATUS NtWaitLowEventPair ['HANDLE EventPairHandle']
 case 265: {
-uint32_t arg0;
 if (PPP_CHECK_CB(on_NtWaitLowEventPair_return)) {
+uint32_t arg0;
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtWaitLowEventPair_return, rp.proc_id, pc, 265, env,pc,arg0) ; 
 }
-PPP_RUN_CB(on_NtWaitLowEventPair_return, env,pc,arg0) ; 
 }; break;
 // 266 NTSTATUS NtWriteFile ['HANDLE FileHandle', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' PVOID Buffer', ' ULONG Length', ' PLARGE_INTEGER ByteOffset', ' PULONG Key']
 case 266: {
+if (PPP_CHECK_CB(on_NtWriteFile_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
@@ -3737,7 +3738,6 @@ uint32_t arg5;
 uint32_t arg6;
 uint32_t arg7;
 uint32_t arg8;
-if (PPP_CHECK_CB(on_NtWriteFile_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
@@ -3747,11 +3747,12 @@ memcpy(&arg5, rp.params[5], sizeof(uint32_t));
 memcpy(&arg6, rp.params[6], sizeof(uint32_t));
 memcpy(&arg7, rp.params[7], sizeof(uint32_t));
 memcpy(&arg8, rp.params[8], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtWriteFile_return, rp.proc_id, pc, 266, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
 }
-PPP_RUN_CB(on_NtWriteFile_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
 }; break;
 // 267 NTSTATUS NtWriteFileGather ['HANDLE FileHandle', ' HANDLE Event', ' PIO_APC_ROUTINE ApcRoutine', ' PVOID ApcContext', ' PIO_STATUS_BLOCK IoStatusBlock', ' PFILE_SEGMENT_ELEMENT SegmentArray', ' ULONG Length', ' PLARGE_INTEGER ByteOffset', ' PULONG Key']
 case 267: {
+if (PPP_CHECK_CB(on_NtWriteFileGather_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
@@ -3761,7 +3762,6 @@ uint32_t arg5;
 uint32_t arg6;
 uint32_t arg7;
 uint32_t arg8;
-if (PPP_CHECK_CB(on_NtWriteFileGather_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
@@ -3771,112 +3771,112 @@ memcpy(&arg5, rp.params[5], sizeof(uint32_t));
 memcpy(&arg6, rp.params[6], sizeof(uint32_t));
 memcpy(&arg7, rp.params[7], sizeof(uint32_t));
 memcpy(&arg8, rp.params[8], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtWriteFileGather_return, rp.proc_id, pc, 267, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
 }
-PPP_RUN_CB(on_NtWriteFileGather_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8) ; 
 }; break;
 // 268 NTSTATUS NtWriteRequestData ['HANDLE PortHandle', ' PPORT_MESSAGE Message', ' ULONG DataEntryIndex', ' PVOID Buffer', ' SIZE_T BufferSize', ' PSIZE_T NumberOfBytesWritten']
 case 268: {
+if (PPP_CHECK_CB(on_NtWriteRequestData_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
 uint32_t arg5;
-if (PPP_CHECK_CB(on_NtWriteRequestData_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
 memcpy(&arg5, rp.params[5], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtWriteRequestData_return, rp.proc_id, pc, 268, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
 }
-PPP_RUN_CB(on_NtWriteRequestData_return, env,pc,arg0,arg1,arg2,arg3,arg4,arg5) ; 
 }; break;
 // 269 NTSTATUS NtWriteVirtualMemory ['HANDLE ProcessHandle', ' PVOID BaseAddress', ' PVOID Buffer', ' SIZE_T BufferSize', ' PSIZE_T NumberOfBytesWritten']
 case 269: {
+if (PPP_CHECK_CB(on_NtWriteVirtualMemory_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
 uint32_t arg4;
-if (PPP_CHECK_CB(on_NtWriteVirtualMemory_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
 memcpy(&arg4, rp.params[4], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtWriteVirtualMemory_return, rp.proc_id, pc, 269, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }
-PPP_RUN_CB(on_NtWriteVirtualMemory_return, env,pc,arg0,arg1,arg2,arg3,arg4) ; 
 }; break;
 // 270 NTSTATUS NtYieldExecution ['']
 case 270: {
 if (PPP_CHECK_CB(on_NtYieldExecution_return)) {
+PPP_RUN_CB_FILTERED(on_NtYieldExecution_return, rp.proc_id, pc, 270, env,pc) ; 
 }
-PPP_RUN_CB(on_NtYieldExecution_return, env,pc) ; 
 }; break;
 // 271 NTSTATUS NtCreateKeyedEvent ['PHANDLE KeyedEventHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes', ' ULONG Flags']
 case 271: {
+if (PPP_CHECK_CB(on_NtCreateKeyedEvent_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
-if (PPP_CHECK_CB(on_NtCreateKeyedEvent_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtCreateKeyedEvent_return, rp.proc_id, pc, 271, env,pc,arg0,arg1,arg2,arg3) ; 
 }
-PPP_RUN_CB(on_NtCreateKeyedEvent_return, env,pc,arg0,arg1,arg2,arg3) ; 
 }; break;
 // 272 NTSTATUS NtOpenKeyedEvent ['PHANDLE KeyedEventHandle', ' ACCESS_MASK DesiredAccess', ' POBJECT_ATTRIBUTES ObjectAttributes']
 case 272: {
+if (PPP_CHECK_CB(on_NtOpenKeyedEvent_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
-if (PPP_CHECK_CB(on_NtOpenKeyedEvent_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtOpenKeyedEvent_return, rp.proc_id, pc, 272, env,pc,arg0,arg1,arg2) ; 
 }
-PPP_RUN_CB(on_NtOpenKeyedEvent_return, env,pc,arg0,arg1,arg2) ; 
 }; break;
 // 273 NTSTATUS NtReleaseKeyedEvent ['HANDLE KeyedEventHandle', ' PVOID KeyValue', ' BOOLEAN Alertable', ' PLARGE_INTEGER Timeout']
 case 273: {
+if (PPP_CHECK_CB(on_NtReleaseKeyedEvent_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
-if (PPP_CHECK_CB(on_NtReleaseKeyedEvent_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtReleaseKeyedEvent_return, rp.proc_id, pc, 273, env,pc,arg0,arg1,arg2,arg3) ; 
 }
-PPP_RUN_CB(on_NtReleaseKeyedEvent_return, env,pc,arg0,arg1,arg2,arg3) ; 
 }; break;
 // 274 NTSTATUS NtWaitForKeyedEvent ['HANDLE KeyedEventHandle', ' PVOID KeyValue', ' BOOLEAN Alertable', ' PLARGE_INTEGER Timeout']
 case 274: {
+if (PPP_CHECK_CB(on_NtWaitForKeyedEvent_return)) {
 uint32_t arg0;
 uint32_t arg1;
 uint32_t arg2;
 uint32_t arg3;
-if (PPP_CHECK_CB(on_NtWaitForKeyedEvent_return)) {
 memcpy(&arg0, rp.params[0], sizeof(uint32_t));
 memcpy(&arg1, rp.params[1], sizeof(uint32_t));
 memcpy(&arg2, rp.params[2], sizeof(uint32_t));
 memcpy(&arg3, rp.params[3], sizeof(uint32_t));
+PPP_RUN_CB_FILTERED(on_NtWaitForKeyedEvent_return, rp.proc_id, pc, 274, env,pc,arg0,arg1,arg2,arg3) ; 
 }
-PPP_RUN_CB(on_NtWaitForKeyedEvent_return, env,pc,arg0,arg1,arg2,arg3) ; 
 }; break;
 // 275 NTSTATUS NtQueryPortInformationProcess ['']
 case 275: {
 if (PPP_CHECK_CB(on_NtQueryPortInformationProcess_return)) {
+PPP_RUN_CB_FILTERED(on_NtQueryPortInformationProcess_return, rp.proc_id, pc, 275, env,pc) ; 
 }
-PPP_RUN_CB(on_NtQueryPortInformationProcess_return, env,pc) ; 
 }; break;
 default:
-PPP_RUN_CB(on_unknown_sys_return, env, pc, EAX);
+PPP_RUN_CB_FILTERED(on_unknown_sys_return, rp.proc_id, pc, ordinal, env, pc, ordinal);
 }
-PPP_RUN_CB(on_all_sys_return, env, pc, EAX);
+PPP_RUN_CB_FILTERED(on_all_sys_return, rp.proc_id, pc, ordinal, env, pc, ordinal);
 #endif
  } 
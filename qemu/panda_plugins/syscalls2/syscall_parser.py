@@ -118,7 +118,7 @@ extern "C" {
 
 void syscall_enter_switch_%s ( CPUState *env, target_ulong pc ) {  // osarch
 %s                                          // GUARD
-    ReturnPoint rp;
+    ReturnPoint rp = {};                    // params stay zero unless captured below
     rp.ordinal = %s;                        // CALLNO
     rp.proc_id = panda_current_asid(env);
     rp.retaddr = calc_retaddr(env, pc);
@@ -283,6 +283,9 @@ void syscall_return_switch_%s ( CPUState *env, target_ulong pc, target_ulong ord
 
             syscall_enter_switch += "case " + callno + ": {\n"
             syscall_return_switch += "case " + callno + ": {\n"
+            # Don't fetch any arguments unless someone is listening
+            syscall_enter_switch += "if (PPP_CHECK_CB(on_{0}_enter) || PPP_CHECK_CB(on_{0}_return)) {{\n".format(callname)
+            syscall_return_switch += "if (PPP_CHECK_CB(on_{0}_return)) {{\n".format(callname)
             argno = 0
             for i, val in enumerate(arg_types):
                 arg_type = val.type
@@ -324,27 +327,27 @@ void syscall_return_switch_%s ( CPUState *env, target_ulong pc, target_ulong ord
             # Unmarshal the args from the ReturnPoint
             for i, x in enumerate(arg_types):
                 syscall_return_switch += "%s arg%d;\n" % (ARG_TYPE_C_TRANSLATIONS[x.type], i)
-            syscall_return_switch += "if (PPP_CHECK_CB(on_{0}_return)) {{\n".format(callname)
             for i, x in enumerate(arg_types):
                 syscall_return_switch += "memcpy(&arg%d, rp.params[%d], sizeof(%s));\n" % (i, i, ARG_TYPE_C_TRANSLATIONS[x.type])
-            syscall_return_switch += "}\n"
             # prototype for the C++ callback (with arg types and names)
-            syscall_enter_switch += "PPP_RUN_CB(on_{0}_enter, {1}) ; \n".format(callname, _c_args)
+            syscall_enter_switch += "PPP_RUN_CB_FILTERED(on_{0}_enter, rp.proc_id, pc, {1}, {2}) ; \n".format(callname, callno, _c_args)
+            syscall_enter_switch += "}\n"
             syscall_enter_switch += "}; break;"+'\n'
-            syscall_return_switch += "PPP_RUN_CB(on_{0}_return, {1}) ; \n".format(callname, _c_args)
+            syscall_return_switch += "PPP_RUN_CB_FILTERED(on_{0}_return, rp.proc_id, pc, {1}, {2}) ; \n".format(callname, callno, _c_args)
+            syscall_return_switch += "}\n"
             syscall_return_switch += "}; break;"+'\n'
            
         # The "all" and "unknown" callbacks
         syscall_enter_switch += "default:\n"
-        syscall_enter_switch += "PPP_RUN_CB(on_unknown_sys_enter, env, pc, %s);\n" % CALLNO
+        syscall_enter_switch += "PPP_RUN_CB_FILTERED(on_unknown_sys_enter, rp.proc_id, pc, rp.ordinal, env, pc, rp.ordinal);\n"
         syscall_enter_switch += "}"+'\n'
-        syscall_enter_switch += "PPP_RUN_CB(on_all_sys_enter, env, pc, %s);\n" % CALLNO
+        syscall_enter_switch += "PPP_RUN_CB_FILTERED(on_all_sys_enter, rp.proc_id, pc, rp.ordinal, env, pc, rp.ordinal);\n"
         syscall_enter_switch += "appendReturnPoint(rp);\n"
 
         syscall_return_switch += "default:\n"
-        syscall_return_switch += "PPP_RUN_CB(on_unknown_sys_return, env, pc, %s);\n" % CALLNO
+        syscall_return_switch += "PPP_RUN_CB_FILTERED(on_unknown_sys_return, rp.proc_id, pc, ordinal, env, pc, ordinal);\n"
         syscall_return_switch += "}"+'\n'
-        syscall_return_switch += "PPP_RUN_CB(on_all_sys_return, env, pc, %s);\n" % CALLNO
+        syscall_return_switch += "PPP_RUN_CB_FILTERED(on_all_sys_return, rp.proc_id, pc, ordinal, env, pc, ordinal);\n"
 
     syscall_return_switch += "#endif\n } \n"
     syscall_enter_switch += "#endif\n } \n"
@@ -374,7 +377,7 @@ with open(os.path.join(DESTDIR, "gen_syscall_ppp_register_enter.cpp"), "w") as p
     for GUARD in cb_names_enter:
         pppfile.write(GUARD + "\n")
         for ppp in cb_names_enter[GUARD]:
-            pppfile.write("PPP_PROT_REG_CB({0})\n".format(ppp))
+            pppfile.write("PPP_PROT_REG_CB_FILTERED({0})\n".format(ppp))
         pppfile.write("#endif\n")
 
 with open(os.path.join(DESTDIR, "gen_syscall_ppp_register_return.cpp"), "w") as pppfile:
@@ -382,7 +385,7 @@ with open(os.path.join(DESTDIR, "gen_syscall_ppp_register_return.cpp"), "w") as
     for GUARD in cb_names_return:
         pppfile.write(GUARD + "\n")
         for ppp in cb_names_return[GUARD]:
-            pppfile.write("PPP_PROT_REG_CB({0})\n".format(ppp))
+            pppfile.write("PPP_PROT_REG_CB_FILTERED({0})\n".format(ppp))
         pppfile.write("#endif\n")
 
 
@@ -391,7 +394,7 @@ with open(os.path.join(DESTDIR, "gen_syscall_ppp_boilerplate_enter.cpp"), "w") a
     for GUARD in cb_names_enter:
         pppfile.write(GUARD + "\n")
         for ppp in cb_names_enter[GUARD]:
-            pppfile.write("PPP_CB_BOILERPLATE({0})\n".format(ppp))
+            pppfile.write("PPP_CB_BOILERPLATE_FILTERED({0})\n".format(ppp))
         pppfile.write("#endif\n")
 
 with open(os.path.join(DESTDIR, "gen_syscall_ppp_boilerplate_return.cpp"), "w") as pppfile:
@@ -399,7 +402,7 @@ with open(os.path.join(DESTDIR, "gen_syscall_ppp_boilerplate_return.cpp"), "w")
     for GUARD in cb_names_return:
         pppfile.write(GUARD + "\n")
         for ppp in cb_names_return[GUARD]:
-            pppfile.write("PPP_CB_BOILERPLATE({0})\n".format(ppp))
+            pppfile.write("PPP_CB_BOILERPLATE_FILTERED({0})\n".format(ppp))
         pppfile.write("#endif\n")
 
 with open(os.path.join(DESTDIR, "gen_syscall_ppp_extern_enter.h"), "w") as pppfile:
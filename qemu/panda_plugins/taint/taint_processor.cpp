@@ -1679,7 +1679,7 @@ SB_INLINE void process_insn_start_op(Shad *shad,  TaintOp *op, TaintOpBuffer *bu
                         break;
 		    case LDCALLBACKOP:
 		      {
-			if (ppp_on_load_num_cb > 0) {
+			if (PPP_CHECK_CB(on_load)) {
 			  if (dventry.entry.memaccess.addr.typ == MADDR) {
 			    // load callback.  fill in the address
 			    cur_op->val.ldcallback.a.flag = (AddrFlag) 0;
@@ -1803,7 +1803,7 @@ SB_INLINE void process_insn_start_op(Shad *shad,  TaintOp *op, TaintOpBuffer *bu
 
 		    case STCALLBACKOP:
 		      {
-			if (ppp_on_store_num_cb > 0) {
+			if (PPP_CHECK_CB(on_store)) {
 			  if (dventry.entry.memaccess.addr.typ == MADDR){
 			    cur_op->val.stcallback.a.flag = (AddrFlag) 0;
 			    cur_op->val.stcallback.a.typ = MADDR;
@@ -2472,7 +2472,7 @@ void tob_process(TaintOpBuffer *buf, Shad *shad, DynValBuffer *dynval_buf) {
 
  	    case LDCALLBACKOP:
 	      {
-		if (ppp_on_load_num_cb > 0) {
+		if (PPP_CHECK_CB(on_load)) {
 		  // semantically right after ld has happened.
 		  uint64_t ld_addr = op->val.ldcallback.a.val.ma + op->val.ldcallback.a.off;
 		  PPP_RUN_CB(on_load, shad->pc, ld_addr);
@@ -2483,7 +2483,7 @@ void tob_process(TaintOpBuffer *buf, Shad *shad, DynValBuffer *dynval_buf) {
 
  	    case STCALLBACKOP:
 	      {
-		if (ppp_on_store_num_cb > 0) {  
+		if (PPP_CHECK_CB(on_store)) {  
 		  // semantically right after st has happened.
 		  uint64_t st_addr = op->val.stcallback.a.val.ma + op->val.stcallback.a.off;
 		  PPP_RUN_CB(on_store, shad->pc, st_addr);
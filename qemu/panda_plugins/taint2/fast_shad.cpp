@@ -32,42 +32,81 @@ PANDAENDCOMMENT */
 
 typedef const std::set<uint32_t> *LabelSetP;
 
-FastShad::FastShad(std::string name, uint64_t labelsets) : _name(name) {
-    uint64_t bytes = sizeof(TaintData) * labelsets;
+// Zeroed storage for n records of the given size. Large arrays come from
+// mmap so that untouched pages cost nothing.
+static void *shad_alloc(const char *what, uint64_t n, size_t elt_size) {
+    uint64_t bytes = elt_size * n;
 
-    TaintData *array;
-    if (labelsets < (1UL << 24)) {
-        array = (TaintData *)malloc(bytes);
-        printf("taint2: Allocating small fast_shad (%" PRIu64 " bytes) using malloc @ %lx.\n",
-                bytes, (uint64_t)array);
+    void *array;
+    if (n < (1UL << 24)) {
+        array = malloc(bytes);
+        printf("taint2: Allocating small %s (%" PRIu64 " bytes) using malloc @ %lx.\n",
+                what, bytes, (uint64_t)array);
         assert(array);
         memset(array, 0, bytes);
     } else {
-        printf("taint2: Allocating large fast_shad (%lu bytes).\n", bytes);
-        array = (TaintData *)mmap(NULL, bytes, PROT_READ | PROT_WRITE,
+        printf("taint2: Allocating large %s (%" PRIu64 " bytes).\n", what, bytes);
+        array = mmap(NULL, bytes, PROT_READ | PROT_WRITE,
                 MAP_ANONYMOUS | MAP_PRIVATE | MAP_HUGETLB,
                 -1, 0);
-        if (array == (TaintData *)MAP_FAILED) {
+        if (array == MAP_FAILED) {
             printf("taint2: Hugetlb failed. Trying without.\n");
             // try without HUGETLB
-            array = (TaintData *)mmap(NULL, bytes, PROT_READ | PROT_WRITE,
+            array = mmap(NULL, bytes, PROT_READ | PROT_WRITE,
                     MAP_ANONYMOUS | MAP_PRIVATE, -1, 0);
         }
-        if (array == (TaintData *)MAP_FAILED) {
+        if (array == MAP_FAILED) {
             puts(strerror(errno));
         }
     }
+    return array;
+}
+
+static void shad_free(void *array, uint64_t n, size_t elt_size) {
+    if (!array) return;
+    if (n < (1UL << 24)) {
+        free(array);
+    } else {
+        munmap(array, elt_size * n);
+    }
+}
+
+FastShad::FastShad(std::string name, uint64_t labelsets) : _name(name) {
+    LabelSetP *array = (LabelSetP *)shad_alloc("fast_shad", labelsets,
+            sizeof(LabelSetP));
 
     labels = array;
     orig_labels = array;
     size = labelsets;
+
+    tcns = NULL;
+    masks = NULL;
+
+    num_tainted = 0;
+    page_tainted = (uint32_t *)calloc((labelsets >> SHAD_PAGE_BITS) + 1,
+            sizeof(uint32_t));
+    assert(page_tainted);
+}
+
+void FastShad::enable_tcn() {
+    if (tcns) return;
+    tcns = (uint32_t *)shad_alloc("tcn table", size, sizeof(uint32_t));
+}
+
+void FastShad::enable_cb_masks() {
+    if (masks) return;
+    masks = (CBMaskData *)shad_alloc("cb mask table", size, sizeof(CBMaskData));
+
+    if (num_tainted == 0) return;
+    for (uint64_t i = 0; i < size; i++) {
+        if (orig_labels[i]) masks[i].cb_mask = 0xFF;
+    }
 }
 
 // release all memory associated with this fast_shad.
 FastShad::~FastShad() {
-    if (size < (1UL << 24)) {
-        free(orig_labels);
-    } else {
-        munmap(orig_labels, sizeof(TaintData) * size);
-    }
+    shad_free(orig_labels, size, sizeof(LabelSetP));
+    shad_free(tcns, size, sizeof(uint32_t));
+    shad_free(masks, size, sizeof(CBMaskData));
+    free(page_tainted);
 }
@@ -91,36 +91,146 @@ struct TaintData {
     }
 };
 
+// Records per page for the tainted-record summaries below.
+#define SHAD_PAGE_BITS 12
+
+// Controlled-bit masks for one record; see TaintData.
+struct CBMaskData {
+    uint8_t cb_mask;
+    uint8_t one_mask;
+    uint8_t zero_mask;
+};
+
+// Shadow storage. The main array holds only the label set of each record.
+// Taint compute numbers and controlled-bit masks are kept in parallel side
+// tables, which are only allocated once something asks for them
+// (enable_tcn / enable_cb_masks); until then they read as zero and writes to
+// them are dropped. TaintData is still the unit the taint ops work with.
 class FastShad {
 private:
-    TaintData *labels;
-    TaintData *orig_labels;
+    LabelSetP *labels;
+    LabelSetP *orig_labels;
     uint64_t size; // Number of labelsets contained.
     std::string _name;
 
-    inline TaintData *get_td_p(uint64_t guest_addr) {
-        //taint_log("  %lx->get_ls_p(%lx)\n", (uint64_t)this, guest_addr);
+    // Side tables, indexed by absolute position (see abs_addr). NULL when
+    // the field isn't tracked.
+    uint32_t *tcns;
+    CBMaskData *masks;
+
+    // Number of records carrying a label set, overall and per page of
+    // (1 << SHAD_PAGE_BITS) records. Lets the common case, where nothing
+    // or almost nothing is tainted, skip the shadow entirely.
+    uint64_t num_tainted;
+    uint32_t *page_tainted;
+
+    inline LabelSetP *get_ls_p(uint64_t guest_addr) {
         tassert(guest_addr < size);
         return &labels[guest_addr];
     }
 
+    // Offset of addr from the start of the array, independent of frame.
+    inline uint64_t abs_addr(uint64_t addr) {
+        return (labels - orig_labels) + addr;
+    }
+
+    // Adjust the counters for the labeled records in a range, before (-1)
+    // or after (+1) it is overwritten.
+    inline void account(uint64_t addr, uint64_t n, int sign) {
+        LabelSetP *ls = get_ls_p(addr);
+        uint64_t abs = abs_addr(addr);
+        for (uint64_t i = 0; i < n; i++) {
+            if (ls[i]) {
+                num_tainted += sign;
+                page_tainted[(abs + i) >> SHAD_PAGE_BITS] += sign;
+            }
+        }
+    }
+
+    // Keep the counters right for a single-record overwrite.
+    inline void account_one(uint64_t addr, LabelSetP old_ls, LabelSetP new_ls) {
+        if (!old_ls == !new_ls) return;
+        int sign = new_ls ? 1 : -1;
+        num_tainted += sign;
+        page_tainted[abs_addr(addr) >> SHAD_PAGE_BITS] += sign;
+    }
+
     inline bool range_tainted(uint64_t addr, uint64_t size) {
+        if (!range_maybe_tainted(addr, size)) return false;
         for (unsigned i = addr; i < addr+size; i++) {
-            if (get_td_p(i)->ls) return true;
+            if (*get_ls_p(i)) return true;
         }
         return false;
     }
 
+    // Write one record, returning whether anything observable changed.
+    // Unlabeled records are all equivalent; masks on them mean nothing.
+    inline bool store(uint64_t addr, const TaintData &td) {
+        LabelSetP *dest = get_ls_p(addr);
+        if (!td.ls && !*dest) return false;
+
+        uint64_t abs = abs_addr(addr);
+        bool change = td.ls != *dest;
+        if (tcns) {
+            change |= tcns[abs] != td.tcn;
+            tcns[abs] = td.tcn;
+        }
+        if (masks) {
+            CBMaskData &m = masks[abs];
+            change |= m.cb_mask != td.cb_mask || m.one_mask != td.one_mask ||
+                m.zero_mask != td.zero_mask;
+            m.cb_mask = td.cb_mask;
+            m.one_mask = td.one_mask;
+            m.zero_mask = td.zero_mask;
+        }
+        account_one(addr, *dest, td.ls);
+        *dest = td.ls;
+        return change;
+    }
+
 public:
     FastShad(std::string name, uint64_t size);
     ~FastShad();
 
     uint64_t get_size() { return size; }
 
+    uint64_t get_num_tainted() { return num_tainted; }
+
+    // Allocate the side tables. Records labeled before this get tcn 0 and
+    // the masks of a fresh label.
+    void enable_tcn();
+    void enable_cb_masks();
+
+    inline bool has_tcn() { return tcns != NULL; }
+    inline bool has_cb_masks() { return masks != NULL; }
+
+    // Cheap conservative check: false means no record in the range has a
+    // label set. Only looks at the page summaries.
+    inline bool range_maybe_tainted(uint64_t addr, uint64_t n) {
+        if (n == 0 || num_tainted == 0) return false;
+        uint64_t first = abs_addr(addr) >> SHAD_PAGE_BITS;
+        uint64_t last = (abs_addr(addr) + n - 1) >> SHAD_PAGE_BITS;
+        for (uint64_t p = first; p <= last; p++) {
+            if (page_tainted[p]) return true;
+        }
+        return false;
+    }
+
     // Taint an address with a labelset.
     inline void label(uint64_t addr, LabelSetP ls) {
         taint_log("LABEL: %s[%lx] (%p)\n", name(), addr, ls);
-        *get_td_p(addr) = TaintData(ls);
+        LabelSetP *dest = get_ls_p(addr);
+        account_one(addr, *dest, ls);
+        *dest = ls;
+
+        uint64_t abs = abs_addr(addr);
+        if (tcns) tcns[abs] = 0;
+        if (masks) {
+            TaintData td(ls);
+            masks[abs].cb_mask = td.cb_mask;
+            masks[abs].one_mask = 0;
+            masks[abs].zero_mask = 0;
+        }
     }
 
     static inline void copy(FastShad *shad_dest, uint64_t dest, FastShad *shad_src, uint64_t src, uint64_t size) {
@@ -128,14 +238,19 @@ public:
         tassert(src + size >= src);
         tassert(dest + size <= shad_dest->size);
         tassert(src + size <= shad_src->size);
+
+        // Untainted over untainted: nothing to do.
+        if (!shad_dest->range_maybe_tainted(dest, size) &&
+                !shad_src->range_maybe_tainted(src, size))
+            return;
         
 #ifdef TAINTDEBUG
         for (unsigned i = 0; i < size; i++) {
-            if (shad_src->get_td_p(src + i)->ls != NULL) {
+            if (*shad_src->get_ls_p(src + i) != NULL) {
                 taint_log("TAINTED_COPY: %s[%lx] <- %s[%lx] (%lx)\n",
                         shad_dest->name(), dest + i,
                         shad_src->name(), src + i,
-                        (uint64_t)shad_src->get_td_p(src + i)->ls);
+                        (uint64_t)*shad_src->get_ls_p(src + i));
                 break;
             }
         }
@@ -146,7 +261,28 @@ public:
                     shad_src->range_tainted(src, size)))
             change = true;
 
-        memcpy(shad_dest->get_td_p(dest), shad_src->get_td_p(src), size * sizeof(TaintData));
+        shad_dest->account(dest, size, -1);
+        memcpy(shad_dest->get_ls_p(dest), shad_src->get_ls_p(src), size * sizeof(LabelSetP));
+        shad_dest->account(dest, size, 1);
+
+        uint64_t dest_abs = shad_dest->abs_addr(dest);
+        uint64_t src_abs = shad_src->abs_addr(src);
+        if (shad_dest->tcns) {
+            if (shad_src->tcns) {
+                memcpy(&shad_dest->tcns[dest_abs], &shad_src->tcns[src_abs],
+                        size * sizeof(uint32_t));
+            } else {
+                memset(&shad_dest->tcns[dest_abs], 0, size * sizeof(uint32_t));
+            }
+        }
+        if (shad_dest->masks) {
+            if (shad_src->masks) {
+                memcpy(&shad_dest->masks[dest_abs], &shad_src->masks[src_abs],
+                        size * sizeof(CBMaskData));
+            } else {
+                memset(&shad_dest->masks[dest_abs], 0, size * sizeof(CBMaskData));
+            }
+        }
 
         if (change) taint_state_changed(shad_dest, dest, size);
     }
@@ -155,10 +291,12 @@ public:
     inline void remove(uint64_t addr, uint64_t remove_size) {
         tassert(addr + remove_size >= addr);
         tassert(addr + remove_size <= size);
+
+        if (!range_maybe_tainted(addr, remove_size)) return;
         
 #ifdef TAINTDEBUG
         for (unsigned i = 0; i < remove_size && remove_size < 64; i++) {
-            if (get_td_p(addr + i)->ls != NULL) {
+            if (*get_ls_p(addr + i) != NULL) {
                 taint_log("TAINTED_DELETE: %s[%lx+%lx]\n",
                         name(), addr, remove_size);
                 break;
@@ -169,14 +307,18 @@ public:
         bool change = false;
         if (track_taint_state && range_tainted(addr, remove_size))
             change = true;
-        memset(get_td_p(addr), 0, remove_size * sizeof(TaintData));
+        account(addr, remove_size, -1);
+        memset(get_ls_p(addr), 0, remove_size * sizeof(LabelSetP));
+        uint64_t abs = abs_addr(addr);
+        if (tcns) memset(&tcns[abs], 0, remove_size * sizeof(uint32_t));
+        if (masks) memset(&masks[abs], 0, remove_size * sizeof(CBMaskData));
 
         if (change) taint_state_changed(this, addr, remove_size);
     }
 
     // Query. NULL if untainted.
     inline LabelSetP query(uint64_t addr) {
-        return get_td_p(addr)->ls;
+        return *get_ls_p(addr);
     } 
 
     inline void reset_frame() {
@@ -197,16 +339,51 @@ public:
     }
 
     inline TaintData query_full(uint64_t addr) {
-        return labels[addr];
+        TaintData td;
+        td.ls = *get_ls_p(addr);
+        if (!td.ls) return td;
+
+        uint64_t abs = abs_addr(addr);
+        if (tcns) td.tcn = tcns[abs];
+        if (masks) {
+            td.cb_mask = masks[abs].cb_mask;
+            td.one_mask = masks[abs].one_mask;
+            td.zero_mask = masks[abs].zero_mask;
+        }
+        return td;
     }
 
     inline void set_full(uint64_t addr, TaintData td) {
         tassert(addr < size);
 
-        bool change = !(td == *get_td_p(addr));
-        labels[addr] = td;
+        if (store(addr, td)) taint_state_changed(this, addr, 1);
+    }
+
+    // Write a run of records, with a single state change notification for
+    // the whole range.
+    inline void set_full_range(uint64_t addr, const TaintData *tds, uint64_t n) {
+        tassert(addr + n <= size);
+
+        bool change = false;
+        for (uint64_t i = 0; i < n; i++) {
+            change |= store(addr + i, tds[i]);
+        }
+
+        if (change) taint_state_changed(this, addr, n);
+    }
+
+    // Same, but broadcasting one record over the range.
+    inline void set_range(uint64_t addr, TaintData td, uint64_t n) {
+        tassert(addr + n <= size);
+
+        if (!td.ls && !range_maybe_tainted(addr, n)) return;
+
+        bool change = false;
+        for (uint64_t i = 0; i < n; i++) {
+            change |= store(addr + i, td);
+        }
 
-        if (change) taint_state_changed(this, addr, 1);
+        if (change) taint_state_changed(this, addr, n);
     }
 
     inline uint32_t query_tcn(uint64_t addr) {
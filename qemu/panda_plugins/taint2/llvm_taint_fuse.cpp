@@ -0,0 +1,462 @@
+/* PANDABEGINCOMMENT
+ *
+ * Authors:
+ *  Tim Leek               tleek@ll.mit.edu
+ *  Ryan Whelan            rwhelan@ll.mit.edu
+ *  Joshua Hodosh          josh.hodosh@ll.mit.edu
+ *  Michael Zhivich        mzhivich@ll.mit.edu
+ *  Brendan Dolan-Gavitt   brendandg@gatech.edu
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2.
+ * See the COPYING file in the top-level directory.
+ *
+PANDAENDCOMMENT */
+
+/*
+ * Peephole optimizer for the taint ops inserted by PandaTaintVisitor.
+ *
+ * The visitor emits one op per LLVM instruction, so a guest instruction that
+ * e.g. updates the flags turns into a string of copies and deletes on gsv,
+ * most of which get overwritten by the next guest instruction. This pass
+ * works on the ops in each basic block as a straight-line list:
+ *
+ *  1. forwardCopies: a pure copy whose source is an LLVM register that was
+ *     itself filled by a pure copy reads from the original source instead.
+ *  2. eliminateDead: an op whose (constant) destination is overwritten before
+ *     it is read in the same block, or that writes an LLVM register nothing in
+ *     the function reads, is removed. Helper functions skip this step, since
+ *     they are instrumented once and have to stay correct for on_taint_change.
+ *  3. coalesce: adjacent deletes, and adjacent copies over contiguous source
+ *     and destination ranges, become one op.
+ *
+ * Any call that isn't a taint op (helpers, the softmmu load/store functions)
+ * may longjmp out of the block or touch the shadow itself, so it ends every
+ * window. The same goes for frame ops and host ops, which have addresses we
+ * can't see statically.
+ */
+
+#include <algorithm>
+#include <map>
+
+#include <llvm/IR/Constants.h>
+#include <llvm/IR/Function.h>
+#include <llvm/IR/Instructions.h>
+
+#include "fast_shad.h"
+#include "llvm_taint_lib.h"
+#include "taint2.h"
+
+using namespace llvm;
+
+char PandaTaintFusionPass::ID = 0;
+
+// Set of disjoint half-open ranges [lo, hi).
+struct PandaTaintFusionPass::RangeSet {
+    std::map<uint64_t, uint64_t> r;
+
+    bool covers(uint64_t lo, uint64_t hi) const {
+        auto it = r.upper_bound(lo);
+        if (it == r.begin()) return false;
+        --it;
+        return it->second >= hi;
+    }
+
+    bool overlaps(uint64_t lo, uint64_t hi) const {
+        auto it = r.lower_bound(hi);
+        if (it == r.begin()) return false;
+        --it;
+        return it->second > lo;
+    }
+
+    void add(uint64_t lo, uint64_t hi) {
+        if (lo >= hi) return;
+        auto it = r.upper_bound(lo);
+        if (it != r.begin()) {
+            auto prev = std::prev(it);
+            if (prev->second >= lo) {
+                lo = prev->first;
+                hi = std::max(hi, prev->second);
+                it = r.erase(prev);
+            }
+        }
+        while (it != r.end() && it->first <= hi) {
+            hi = std::max(hi, it->second);
+            it = r.erase(it);
+        }
+        r[lo] = hi;
+    }
+
+    void remove(uint64_t lo, uint64_t hi) {
+        if (lo >= hi) return;
+        auto it = r.upper_bound(lo);
+        if (it != r.begin()) --it;
+        while (it != r.end() && it->first < hi) {
+            uint64_t s = it->first, e = it->second;
+            if (e <= lo) { ++it; continue; }
+            it = r.erase(it);
+            if (s < lo) r[s] = lo;
+            if (e > hi) { r[hi] = e; break; }
+        }
+    }
+
+    void clear() { r.clear(); }
+};
+
+static inline bool ranges_overlap(uint64_t a, uint64_t a_size,
+        uint64_t b, uint64_t b_size) {
+    return a < b + b_size && b < a + a_size;
+}
+
+// The visitor passes the originating instruction as a constant pointer so
+// taint_copy can update controlled-bit masks. For these opcodes update_cb
+// leaves the masks alone, so the copy is a plain memcpy of shadow.
+static bool is_pure_copy(Value *instrArg) {
+    if (isa<ConstantPointerNull>(instrArg)) return true;
+    ConstantExpr *CE = dyn_cast<ConstantExpr>(instrArg);
+    if (!CE) return false;
+    ConstantInt *CI = dyn_cast<ConstantInt>(CE->getOperand(0));
+    if (!CI) return false;
+    Instruction *I = (Instruction *)CI->getZExtValue();
+    if (!I) return true;
+
+    switch (I->getOpcode()) {
+        case Instruction::Load:
+        case Instruction::Store:
+        case Instruction::BitCast:
+        case Instruction::PtrToInt:
+        case Instruction::IntToPtr:
+        case Instruction::ZExt:
+        case Instruction::SExt:
+        case Instruction::ExtractValue:
+        case Instruction::InsertValue:
+            return true;
+        default:
+            return false;
+    }
+}
+
+uint64_t PandaTaintFusionPass::shadSize(Value *shadConst) {
+    if (shadConst == PTV.llvConst) return shad->llv->get_size();
+    if (shadConst == PTV.memConst) return shad->ram->get_size();
+    if (shadConst == PTV.grvConst) return shad->grv->get_size();
+    if (shadConst == PTV.gsvConst) return shad->gsv->get_size();
+    if (shadConst == PTV.retConst) return shad->ret->get_size();
+    return 0;
+}
+
+// Fills in op from a call. Returns false if the call doesn't touch shadow
+// memory at all (breadcrumbs, memlog pops, intrinsics).
+bool PandaTaintFusionPass::parseOp(CallInst *CI, TaintOp &op) {
+    op.CI = CI;
+    op.reads.clear();
+    op.writes = op.must_write = op.pure = false;
+    op.write = ShadRange();
+    op.kind = TaintOp::BARRIER;
+
+    Function *F = CI->getCalledFunction();
+    if (!F) return true;
+    if (F->isIntrinsic()) return false;
+    if (F == PTV.breadcrumbF || F == PTV.memlogPopF) return false;
+
+    auto range = [&](unsigned s, unsigned a, unsigned n) {
+        ConstantInt *A = dyn_cast<ConstantInt>(CI->getArgOperand(a));
+        ConstantInt *N = dyn_cast<ConstantInt>(CI->getArgOperand(n));
+        ShadRange r = { CI->getArgOperand(s), 0, 0, A && N };
+        if (r.known) {
+            r.addr = A->getZExtValue();
+            r.size = N->getZExtValue();
+        }
+        return r;
+    };
+    auto set_write = [&](ShadRange r, bool must) {
+        op.writes = true;
+        op.write = r;
+        // taint_copy and friends silently ignore out-of-range destinations.
+        op.must_write = must && r.known &&
+            r.addr + r.size < shadSize(r.shad);
+    };
+    auto add_read = [&](ShadRange r) {
+        // ~0 is a weak slot, i.e. a constant operand.
+        if (r.known && r.addr == ~0UL) return;
+        op.reads.push_back(r);
+    };
+
+    if (F == PTV.copyF) {
+        op.kind = TaintOp::COPY;
+        set_write(range(0, 1, 4), true);
+        add_read(range(2, 3, 4));
+        op.pure = is_pure_copy(CI->getArgOperand(5));
+    } else if (F == PTV.deleteF) {
+        op.kind = TaintOp::DELETE;
+        set_write(range(0, 1, 2), true);
+    } else if (F == PTV.parallelCompF) {
+        op.kind = TaintOp::COMPUTE;
+        set_write(range(0, 1, 5), true);
+        add_read(range(0, 3, 5));
+        add_read(range(0, 4, 5));
+    } else if (F == PTV.mixCompF) {
+        op.kind = TaintOp::COMPUTE;
+        set_write(range(0, 1, 2), true);
+        add_read(range(0, 3, 5));
+        add_read(range(0, 4, 5));
+    } else if (F == PTV.mixF || F == PTV.sextF) {
+        op.kind = TaintOp::COMPUTE;
+        set_write(range(0, 1, 2), true);
+        add_read(range(0, 3, 4));
+    } else if (F == PTV.pointerF) {
+        op.kind = TaintOp::COMPUTE;
+        set_write(range(0, 1, 7), true);
+        add_read(range(2, 3, 4));
+        add_read(range(5, 6, 7));
+    } else if (F == PTV.selectF) {
+        op.kind = TaintOp::SELECT;
+        set_write(range(0, 1, 2), false);
+        // (value, selector) pairs follow the selector, ~0-terminated.
+        for (unsigned i = 4; i + 1 < CI->getNumArgOperands(); i += 2) {
+            ShadRange r = range(0, i, 2);
+            if (r.known && r.addr == ~0UL) {
+                ConstantInt *Sel = dyn_cast<ConstantInt>(CI->getArgOperand(i + 1));
+                if (Sel && Sel->getZExtValue() == ~0UL) break;
+            }
+            add_read(r);
+        }
+    } else if (F == PTV.branchF) {
+        op.kind = TaintOp::READER;
+        ConstantInt *A = dyn_cast<ConstantInt>(CI->getArgOperand(1));
+        ShadRange r = { CI->getArgOperand(0), A ? A->getZExtValue() : 0,
+            MAXREGSIZE, A != NULL };
+        add_read(r);
+    } else if (F == PTV.hostCopyF) {
+        // Guest side of the copy is dynamic; only the LLVM side is known.
+        ConstantInt *IsStore = dyn_cast<ConstantInt>(CI->getArgOperand(8));
+        if (!IsStore || IsStore->getZExtValue()) add_read(range(2, 3, 6));
+        else set_write(range(2, 3, 6), false);
+    }
+    return true;
+}
+
+void PandaTaintFusionPass::collectOps(BasicBlock &BB, vector<TaintOp> &ops) {
+    for (Instruction &I : BB) {
+        CallInst *CI = dyn_cast<CallInst>(&I);
+        if (!CI) continue;
+        TaintOp op;
+        if (parseOp(CI, op)) ops.push_back(op);
+    }
+}
+
+unsigned PandaTaintFusionPass::forwardCopies(vector<TaintOp> &ops) {
+    struct CopyFact { ShadRange dest, src; };
+    vector<CopyFact> facts;
+    unsigned forwarded = 0;
+
+    for (TaintOp &op : ops) {
+        if (op.kind == TaintOp::BARRIER) {
+            facts.clear();
+            continue;
+        }
+
+        if (op.kind == TaintOp::COPY && op.pure && op.reads.size() == 1 &&
+                op.reads[0].known && op.reads[0].shad == PTV.llvConst) {
+            ShadRange &src = op.reads[0];
+            for (CopyFact &f : facts) {
+                if (f.dest.shad != src.shad || src.addr < f.dest.addr ||
+                        src.addr + src.size > f.dest.addr + f.dest.size) {
+                    continue;
+                }
+                uint64_t new_src = f.src.addr + (src.addr - f.dest.addr);
+                if (f.src.shad == op.write.shad && ranges_overlap(
+                            new_src, src.size, op.write.addr, op.write.size)) {
+                    break;
+                }
+                LLVMContext &ctx = op.CI->getContext();
+                op.CI->setArgOperand(2, f.src.shad);
+                op.CI->setArgOperand(3,
+                        ConstantInt::get(Type::getInt64Ty(ctx), new_src));
+                src.shad = f.src.shad;
+                src.addr = new_src;
+                forwarded++;
+                break;
+            }
+        }
+
+        if (op.writes) {
+            const ShadRange &w = op.write;
+            auto clobbered = [&](const ShadRange &r) {
+                return r.shad == w.shad && (!w.known || !r.known ||
+                        ranges_overlap(r.addr, r.size, w.addr, w.size));
+            };
+            facts.erase(std::remove_if(facts.begin(), facts.end(),
+                        [&](const CopyFact &f) {
+                            return clobbered(f.dest) || clobbered(f.src);
+                        }), facts.end());
+        }
+
+        if (op.kind == TaintOp::COPY && op.pure && op.must_write &&
+                op.reads.size() == 1 && op.reads[0].known &&
+                !(op.reads[0].shad == op.write.shad && ranges_overlap(
+                        op.reads[0].addr, op.reads[0].size,
+                        op.write.addr, op.write.size))) {
+            facts.push_back({ op.write, op.reads[0] });
+        }
+    }
+    return forwarded;
+}
+
+// Walks the block backwards tracking shadow that is certain to be
+// overwritten before it is next read. llv_reads, if given, is every LLVM
+// register range read anywhere in the function.
+unsigned PandaTaintFusionPass::eliminateDead(vector<TaintOp> &ops,
+        RangeSet *llv_reads) {
+    std::map<Value *, RangeSet> killed;
+    uint64_t frame_limit = (uint64_t)shad->num_vals * MAXREGSIZE;
+    unsigned removed = 0;
+
+    for (auto it = ops.rbegin(); it != ops.rend(); ++it) {
+        TaintOp &op = *it;
+        if (op.kind == TaintOp::BARRIER) {
+            killed.clear();
+            continue;
+        }
+
+        if (op.kind != TaintOp::READER && op.writes && op.write.known &&
+                op.write.size > 0) {
+            const ShadRange &w = op.write;
+            bool dead = killed[w.shad].covers(w.addr, w.addr + w.size);
+            // Slots at and above num_vals belong to the callee frame and are
+            // read by helper calls, which we can't see.
+            if (!dead && llv_reads && w.shad == PTV.llvConst &&
+                    w.addr + w.size <= frame_limit &&
+                    !llv_reads->overlaps(w.addr, w.addr + w.size)) {
+                dead = true;
+            }
+            if (dead) {
+                op.CI->eraseFromParent();
+                op.CI = NULL;
+                removed++;
+                continue;
+            }
+        }
+
+        if (op.must_write) {
+            killed[op.write.shad].add(op.write.addr,
+                    op.write.addr + op.write.size);
+        }
+        for (const ShadRange &r : op.reads) {
+            if (r.known) killed[r.shad].remove(r.addr, r.addr + r.size);
+            else killed[r.shad].clear();
+        }
+    }
+
+    ops.erase(std::remove_if(ops.begin(), ops.end(),
+                [](const TaintOp &op) { return op.CI == NULL; }), ops.end());
+    return removed;
+}
+
+unsigned PandaTaintFusionPass::coalesce(vector<TaintOp> &ops) {
+    unsigned merged = 0;
+    for (size_t i = 1; i < ops.size(); i++) {
+        TaintOp &a = ops[i - 1], &b = ops[i];
+        if (!a.CI || !b.CI) continue;
+        if (a.kind != b.kind) continue;
+        if (a.kind != TaintOp::DELETE && a.kind != TaintOp::COPY) continue;
+        if (!a.write.known || !b.write.known) continue;
+        if (a.write.shad != b.write.shad) continue;
+
+        LLVMContext &ctx = b.CI->getContext();
+        Type *i64T = Type::getInt64Ty(ctx);
+        uint64_t limit = shadSize(a.write.shad);
+
+        if (a.kind == TaintOp::DELETE && b.kind == TaintOp::DELETE) {
+            uint64_t lo = std::min(a.write.addr, b.write.addr);
+            uint64_t hi = std::max(a.write.addr + a.write.size,
+                    b.write.addr + b.write.size);
+            if (hi - lo > a.write.size + b.write.size) continue; // gap
+            if (hi > limit) continue;
+
+            b.CI->setArgOperand(1, ConstantInt::get(i64T, lo));
+            b.CI->setArgOperand(2, ConstantInt::get(i64T, hi - lo));
+            b.write.addr = lo;
+            b.write.size = hi - lo;
+        } else if (a.kind == TaintOp::COPY && b.kind == TaintOp::COPY &&
+                a.pure && b.pure && a.must_write && b.must_write &&
+                a.reads.size() == 1 && b.reads.size() == 1 &&
+                a.reads[0].known && b.reads[0].known &&
+                a.reads[0].shad == b.reads[0].shad) {
+            // Either order works as long as both sides are contiguous.
+            TaintOp &lo = a.write.addr < b.write.addr ? a : b;
+            TaintOp &hi = a.write.addr < b.write.addr ? b : a;
+            if (hi.write.addr != lo.write.addr + lo.write.size) continue;
+            if (hi.reads[0].addr != lo.reads[0].addr + lo.reads[0].size) continue;
+
+            uint64_t dest = lo.write.addr, src = lo.reads[0].addr;
+            uint64_t size = lo.write.size + hi.write.size;
+            Value *src_shad = lo.reads[0].shad;
+            if (dest + size >= limit || src + size >= shadSize(src_shad)) continue;
+            if (src_shad == a.write.shad &&
+                    ranges_overlap(dest, size, src, size)) continue;
+
+            b.CI->setArgOperand(1, ConstantInt::get(i64T, dest));
+            b.CI->setArgOperand(3, ConstantInt::get(i64T, src));
+            b.CI->setArgOperand(4, ConstantInt::get(i64T, size));
+            // Sizes past 8 bytes don't fit in update_cb's word; the merged
+            // copy is pure anyway.
+            b.CI->setArgOperand(5, ConstantPointerNull::get(
+                        cast<PointerType>(PTV.instrT)));
+            b.write.addr = dest;
+            b.write.size = size;
+            b.reads[0].addr = src;
+            b.reads[0].size = size;
+        } else {
+            continue;
+        }
+
+        a.CI->eraseFromParent();
+        a.CI = NULL;
+        merged++;
+    }
+
+    ops.erase(std::remove_if(ops.begin(), ops.end(),
+                [](const TaintOp &op) { return op.CI == NULL; }), ops.end());
+    return merged;
+}
+
+bool PandaTaintFusionPass::runOnFunction(Function &F) {
+    if (F.isDeclaration() || F.getName().startswith("taint")) return false;
+
+    vector<vector<TaintOp>> blocks;
+    for (BasicBlock &BB : F) {
+        blocks.emplace_back();
+        collectOps(BB, blocks.back());
+        ops_seen += blocks.back().size();
+    }
+
+    for (auto &ops : blocks) {
+        ops_forwarded += forwardCopies(ops);
+    }
+
+    // Dropping ops changes which on_taint_change callbacks fire, so leave
+    // them alone when somebody is watching.
+    if (eliminate_dead && !track_taint_state) {
+        RangeSet llv_reads;
+        bool llv_known = true;
+        for (auto &ops : blocks) {
+            for (TaintOp &op : ops) {
+                for (const ShadRange &r : op.reads) {
+                    if (r.shad != PTV.llvConst) continue;
+                    if (!r.known) llv_known = false;
+                    else llv_reads.add(r.addr, r.addr + r.size);
+                }
+            }
+        }
+
+        for (auto &ops : blocks) {
+            ops_removed += eliminateDead(ops, llv_known ? &llv_reads : NULL);
+        }
+    }
+
+    for (auto &ops : blocks) {
+        ops_removed += coalesce(ops);
+    }
+
+    return true;
+}
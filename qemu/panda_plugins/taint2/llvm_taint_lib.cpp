@@ -35,6 +35,7 @@ PANDAENDCOMMENT */
 #include "fast_shad.h"
 #include "llvm_taint_lib.h"
 #include "taint_ops.h"
+#include "taint_ring.h"
 #include "guestarch.h"
 #include "taint2.h"
 
@@ -86,11 +87,21 @@ static inline Constant *const_struct_ptr(LLVMContext &C, Type *ptrT, void *ptr)
 }
 
 static void taint_branch_run(FastShad *shad, uint64_t src) {
+    // Consumers only care about tainted branches; don't bother them otherwise.
+    if (!shad->range_maybe_tainted(src, MAXREGSIZE)) return;
     // this arg should be the register number
     Addr a = make_laddr(src / MAXREGSIZE, 0);
     PPP_RUN_CB(on_branch2, a);
 }
 
+// Threaded propagation: listeners run here on the vCPU thread, so the shadow
+// has to be caught up first. Nobody listening, nothing to do.
+static void taint_branch_deferred(FastShad *shad, uint64_t src) {
+    if (!PPP_CHECK_CB(on_branch2)) return;
+    taint_ring_sync();
+    taint_branch_run(shad, src);
+}
+
 extern "C" { extern TCGLLVMContext *tcg_llvm_ctx; }
 bool PandaTaintFunctionPass::doInitialization(Module &M) {
     // Add taint functions to module
@@ -178,25 +189,31 @@ bool PandaTaintFunctionPass::doInitialization(Module &M) {
             GlobalVariable::ExternalLinkage, "taint_branch", &M);
     }
     assert(PTV.branchF);
-    EE->addGlobalMapping(PTV.branchF, (void *)taint_branch_run);
+    EE->addGlobalMapping(PTV.branchF, taint_ring_enabled ?
+            (void *)taint_branch_deferred : (void *)taint_branch_run);
 #define ADD_MAPPING(func) \
     EE->addGlobalMapping(M.getFunction(#func), (void *)(func));\
     M.getFunction(#func)->deleteBody();
-    ADD_MAPPING(taint_delete);
-    ADD_MAPPING(taint_mix);
-    ADD_MAPPING(taint_pointer);
-    ADD_MAPPING(taint_mix_compute);
-    ADD_MAPPING(taint_parallel_compute);
-    ADD_MAPPING(taint_copy);
-    ADD_MAPPING(taint_sext);
-    ADD_MAPPING(taint_select);
-    ADD_MAPPING(taint_host_copy);
-    ADD_MAPPING(taint_host_memcpy);
-    ADD_MAPPING(taint_host_delete);
-
-    ADD_MAPPING(taint_push_frame);
-    ADD_MAPPING(taint_pop_frame);
-    ADD_MAPPING(taint_reset_frame);
+// Ops that touch shadow memory go through the ring in threaded mode.
+#define ADD_DEFERRED_MAPPING(func) \
+    EE->addGlobalMapping(M.getFunction(#func), taint_ring_enabled ? \
+            (void *)(deferred_##func) : (void *)(func));\
+    M.getFunction(#func)->deleteBody();
+    ADD_DEFERRED_MAPPING(taint_delete);
+    ADD_DEFERRED_MAPPING(taint_mix);
+    ADD_DEFERRED_MAPPING(taint_pointer);
+    ADD_DEFERRED_MAPPING(taint_mix_compute);
+    ADD_DEFERRED_MAPPING(taint_parallel_compute);
+    ADD_DEFERRED_MAPPING(taint_copy);
+    ADD_DEFERRED_MAPPING(taint_sext);
+    ADD_DEFERRED_MAPPING(taint_select);
+    ADD_DEFERRED_MAPPING(taint_host_copy);
+    ADD_DEFERRED_MAPPING(taint_host_memcpy);
+    ADD_DEFERRED_MAPPING(taint_host_delete);
+
+    ADD_DEFERRED_MAPPING(taint_push_frame);
+    ADD_DEFERRED_MAPPING(taint_pop_frame);
+    ADD_DEFERRED_MAPPING(taint_reset_frame);
     ADD_MAPPING(taint_breadcrumb);
 
     ADD_MAPPING(taint_memlog_pop);
@@ -204,6 +221,7 @@ bool PandaTaintFunctionPass::doInitialization(Module &M) {
     //ADD_MAPPING(label_set_union);
     //ADD_MAPPING(label_set_singleton);
 #undef ADD_MAPPING
+#undef ADD_DEFERRED_MAPPING
 
     std::cout << "taint2: Done initializing taint transformation." << std::endl;
 
@@ -399,6 +417,12 @@ void PandaTaintVisitor::visitFunction(Function& F) {
     // create slot tracker to keep track of LLVM values
     PST.reset(new PandaSlotTracker(&F));
     PST->initialize();
+
+    summary = NULL;
+    if (tbSummaries && F.getName().startswith("tcg-llvm-tb-")) {
+        summary = &(*tbSummaries)[&F];
+        *summary = TaintTBSummary();
+    }
 }
 
 void PandaTaintVisitor::visitBasicBlock(BasicBlock &BB) {
@@ -826,6 +850,10 @@ void PandaTaintVisitor::insertStateOp(Instruction &I) {
             ptrConst = gsvConst;
             ptrAddr = addr.val.gs;
         }
+        if (summary) {
+            (addr.typ == GREG ? summary->grv : summary->gsv)
+                .push_back(std::make_pair(ptrAddr, size));
+        }
 
         Constant *destConst = isStore ? ptrConst : llvConst;
         Constant *srcConst = isStore ? llvConst : ptrConst;
@@ -837,6 +865,7 @@ void PandaTaintVisitor::insertStateOp(Instruction &I) {
             insertTaintCopy(I, destConst, dest, srcConst, src, size);
         }
     } else if (isa<Constant>(val) && isStore) {
+        if (summary) summary->dynamic = true;
         PtrToIntInst *P2II = new PtrToIntInst(ptr, Type::getInt64Ty(ctx), "", &I);
         vector<Value *> args{
             const_uint64_ptr(ctx, cpu_single_env), P2II,
@@ -850,6 +879,7 @@ void PandaTaintVisitor::insertStateOp(Instruction &I) {
             insertTaintCopy(I, llvConst, ptr, llvConst, val, size);
         }
     } else {
+        if (summary) summary->dynamic = true;
         PtrToIntInst *P2II = new PtrToIntInst(ptr, Type::getInt64Ty(ctx), "", &I);
         vector<Value *> args{
             const_uint64_ptr(ctx, cpu_single_env), P2II,
@@ -979,6 +1009,7 @@ void PandaTaintVisitor::visitMemCpyInst(MemTransferInst &I) {
     PtrToIntInst *destP2II = new PtrToIntInst(dest, Type::getInt64Ty(ctx), "", &I);
     PtrToIntInst *srcP2II = new PtrToIntInst(src, Type::getInt64Ty(ctx), "", &I);
     assert(destP2II && srcP2II);
+    if (summary) summary->dynamic = true;
     vector<Value *> args{
         const_uint64_ptr(ctx, cpu_single_env), destP2II, srcP2II,
         grvConst, gsvConst, size, const_uint64(ctx, WORDSIZE)
@@ -999,6 +1030,7 @@ void PandaTaintVisitor::visitMemSetInst(MemSetInst &I) {
 
     PtrToIntInst *P2II = new PtrToIntInst(dest, Type::getInt64Ty(ctx), "", &I);
     assert(P2II);
+    if (summary) summary->dynamic = true;
 
     vector<Value *> args{
         const_uint64_ptr(ctx, cpu_single_env), P2II,
@@ -1055,6 +1087,7 @@ void PandaTaintVisitor::visitCallInst(CallInst &I) {
                 || !calledName.compare("__ldl_mmu_panda")
                 || !calledName.compare("__ldq_mmu_panda")) {
 
+            if (summary) summary->loads = true;
             Value *ptr = I.getArgOperand(0);
             if (tainted_pointer && !isa<Constant>(ptr)) {
                 insertTaintPointer(I, ptr, &I, false);
@@ -1146,6 +1179,7 @@ void PandaTaintVisitor::visitCallInst(CallInst &I) {
 
     // This is a call that we aren't going to model, so we need to process
     // it instruction by instruction.
+    if (summary) summary->calls = summary->dynamic = true;
     // First, we need to set up a new stack frame and copy argument taint.
     vector<Value *> fargs{ llvConst };
     int numArgs = I.getNumArgOperands();
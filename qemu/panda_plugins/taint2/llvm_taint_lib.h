@@ -65,6 +65,25 @@ public:
     unsigned getMaxSlot();
 };
 
+/* TaintTBSummary
+ * What the taint ops in one translated block can read, filled in by the
+ * visitor as it instruments the block. If none of it is tainted when the
+ * block is about to run, the block can't create or move taint and we can run
+ * it without instrumentation. grv/gsv ranges are (addr, size) pairs.
+ * load_pages is filled in at run time by taint2.cpp.
+ */
+struct TaintTBSummary {
+    bool loads = false;   // guest memory loads (__ld*_mmu_panda)
+    bool calls = false;   // calls we don't model, which may read anything
+    bool dynamic = false; // CPUState accesses at offsets unknown statically
+    vector<pair<uint64_t, uint64_t>> grv;
+    vector<pair<uint64_t, uint64_t>> gsv;
+    // RAM pages the loads hit the last time the block ran to its end, if
+    // load_pages_known (it has run and didn't hit too many).
+    bool load_pages_known = false;
+    vector<uint64_t> load_pages;
+};
+
 class ReturnInst;
 class BranchInst;
 class BinaryOperator;
@@ -81,6 +100,7 @@ private:
     std::unique_ptr<PandaSlotTracker> PST;
     Shad *shad; // no ownership. weak ptr.
     taint2_memlog *taint_memlog; // same.
+    TaintTBSummary *summary; // for the block being visited, if any.
 
     Constant *constSlot(LLVMContext &ctx, Value *value);
     Constant *constWeakSlot(LLVMContext &ctx, Value *value);
@@ -155,8 +175,11 @@ public:
 
     Type *instrT;
 
+    // Where to keep per-block summaries. NULL to skip them.
+    std::map<const Function *, TaintTBSummary> *tbSummaries = NULL;
+
     PandaTaintVisitor(Shad *shad, taint2_memlog *taint_memlog)
-        : shad(shad), taint_memlog(taint_memlog) {}
+        : shad(shad), taint_memlog(taint_memlog), summary(NULL) {}
 
     ~PandaTaintVisitor() {}
 
@@ -224,6 +247,68 @@ public:
     }
 };
 
+/* PandaTaintFusionPass class
+ * Runs after PandaTaintFunctionPass has instrumented a function and cleans up
+ * the taint ops it emitted, since the visitor works one instruction at a time.
+ * Within each basic block it forwards chains of register-to-register copies
+ * to their original source, drops ops whose destination is overwritten (or
+ * never read) before any use, and coalesces adjacent copies and deletes over
+ * contiguous ranges into a single op. Only ops with constant shadow
+ * addresses are touched; anything else (helper calls, host ops, frame ops)
+ * is a barrier.
+ */
+class PandaTaintFusionPass : public FunctionPass {
+private:
+    Shad *shad;
+    PandaTaintVisitor &PTV;
+
+    struct RangeSet;
+
+    struct ShadRange {
+        Value *shad;
+        uint64_t addr;
+        uint64_t size;
+        bool known; // false if address comes from the memlog.
+    };
+
+    struct TaintOp {
+        CallInst *CI;
+        enum { COPY, DELETE, COMPUTE, SELECT, READER, BARRIER } kind;
+        vector<ShadRange> reads;
+        bool writes;
+        bool must_write; // write always happens (i.e. not a select).
+        ShadRange write;
+        bool pure; // copy with no controlled-bit update.
+    };
+
+    bool parseOp(CallInst *CI, TaintOp &op);
+    uint64_t shadSize(Value *shadConst);
+    void collectOps(BasicBlock &BB, vector<TaintOp> &ops);
+    unsigned forwardCopies(vector<TaintOp> &ops);
+    unsigned eliminateDead(vector<TaintOp> &ops, RangeSet *llv_reads);
+    unsigned coalesce(vector<TaintOp> &ops);
+
+public:
+    static char ID;
+    uint64_t ops_seen = 0;
+    uint64_t ops_removed = 0;
+    uint64_t ops_forwarded = 0;
+    // Off while instrumenting helpers, which are never retranslated and so
+    // must keep every op in case on_taint_change tracking is turned on later.
+    bool eliminate_dead = true;
+
+    PandaTaintFusionPass(Shad *shad, PandaTaintVisitor &PTV)
+        : FunctionPass(ID), shad(shad), PTV(PTV) {}
+
+    ~PandaTaintFusionPass() { }
+
+    bool runOnFunction(Function &F);
+
+    virtual void getAnalysisUsage(AnalysisUsage &AU) const {
+        AU.setPreservesCFG();
+    }
+};
+
 } // End llvm namespace
 
 #endif
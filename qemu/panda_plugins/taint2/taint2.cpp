@@ -92,6 +92,8 @@ uint32_t *taint2_labels_applied(void);
 uint32_t taint2_num_labels_applied(void);
 
 void taint2_track_taint_state(void);
+void taint2_track_tcn(void);
+void taint2_track_cb_mask(void);
 
 }
 
@@ -109,6 +111,7 @@ void taint2_track_taint_state(void);
 #include "llvm_taint_lib.h"
 #include "fast_shad.h"
 #include "taint_ops.h"
+#include "taint_ring.h"
 #include "taint2.h"
 
 #ifdef PANDA_LAVA
@@ -136,6 +139,8 @@ int phys_mem_write_callback(CPUState *env, target_ulong pc, target_ulong addr,
                        target_ulong size, void *buf);
 int phys_mem_read_callback(CPUState *env, target_ulong pc, target_ulong addr,
         target_ulong size, void *buf);
+int phys_mem_before_read_callback(CPUState *env, target_ulong pc,
+        target_ulong addr, target_ulong size);
 
 void taint_state_changed(FastShad *, uint64_t, uint64_t);
 PPP_PROT_REG_CB(on_taint_change);
@@ -156,6 +161,42 @@ llvm::FunctionPassManager *FPM = NULL;
 // Taint function pass.
 llvm::PandaTaintFunctionPass *PTFP = NULL;
 
+// Taint op fusion pass; runs after PTFP. NULL if disabled.
+llvm::PandaTaintFusionPass *PTFusion = NULL;
+
+// What each instrumented block's taint ops read, keyed by LLVM function.
+static std::map<const llvm::Function *, llvm::TaintTBSummary> tb_summaries;
+static llvm::TaintTBSummary *load_summary;
+
+// The block's LLVM function is about to be deleted (tb_flush, tb_free), and
+// a later block may get the same address.
+static void taint2_tb_free(TranslationBlock *tb) {
+    auto it = tb_summaries.find(tb->llvm_function);
+    if (it == tb_summaries.end()) return;
+    if (load_summary == &it->second) load_summary = NULL;
+    tb_summaries.erase(it);
+}
+
+// A block is bypassed (runs its TCG code) while it is env->current_tb and
+// has llvm_bypass set. cpu_exec clears current_tb when a block is left
+// through longjmp, so this can't outlive the block.
+static inline bool tb_bypassed(CPUState *env) {
+    return env->current_tb && env->current_tb->llvm_bypass;
+}
+static uint64_t tbs_bypassed = 0, tbs_executed = 0, tbs_restarted = 0;
+
+// load_summary is the summary of the running block, if it loads from guest
+// memory; these are the RAM pages it has loaded from so far, which become its
+// load_pages when it finishes.
+#define MAX_LOAD_PAGES 8
+static uint64_t load_pages[MAX_LOAD_PAGES];
+static int num_load_pages = 0;
+static bool load_pages_overflow = false;
+
+// A bypassed block read tainted memory and was restarted; make sure the
+// instruction runs with taint ops this time.
+static bool no_bypass_next = false;
+
 // For now, taint becomes enabled when a label operation first occurs, and
 // becomes disabled when a query operation subsequently occurs
 bool taintEnabled = false;
@@ -171,6 +212,18 @@ bool tainted_pointer = true;
 static TaintGranularity granularity;
 static TaintLabelMode mode;
 bool optimize_llvm = true;
+bool fuse_taint_ops = true;
+// Whether to keep the optional per-byte fields (see FastShad).
+static bool track_tcn = false;
+static bool track_cb_mask = false;
+
+// Lazy activation: taint2_enable_taint() only sets up shadow memory, and
+// LLVM execution starts when the first label is applied.
+static bool lazy_taint = false;
+// Fast-forward: never turn on LLVM; instead cut the replay into ff_name at
+// the first request to enable taint, and stop.
+static const char *ff_name = NULL;
+static bool taint_requested = false;
 extern bool inline_taint;
 
 
@@ -183,6 +236,12 @@ int phys_mem_write_callback(CPUState *env, target_ulong pc, target_ulong addr,
     /*if (size == 4) {
         printf("pmem: " TARGET_FMT_lx "\n", addr);
     }*/
+    if (tb_bypassed(env)) {
+        // No taint op will consume this; the data written is clean.
+        if (addr + size <= shadow->ram->get_size())
+            shadow->ram->remove(addr, size);
+        return 0;
+    }
     taint_memlog_push(&taint_memlog, addr);
     return 0;
 }
@@ -196,6 +255,36 @@ int phys_mem_read_callback(CPUState *env, target_ulong pc, target_ulong addr,
     return 0;
 }
 
+// Note which RAM pages the running block loads from, and catch a bypassed
+// block before it reads anything tainted: its taint ops would have moved
+// that taint, so abandon it and run the instruction again with them.
+int phys_mem_before_read_callback(CPUState *env, target_ulong pc,
+        target_ulong addr, target_ulong size) {
+    if (addr + size > shadow->ram->get_size()) return 0;
+
+    if (tb_bypassed(env) && shadow->ram->range_maybe_tainted(addr, size)) {
+        load_summary = NULL;
+        no_bypass_next = true;
+        tbs_restarted++;
+        panda_restart_insn(env);
+    }
+
+    if (!load_summary || load_pages_overflow) return 0;
+
+    for (uint64_t p = addr >> SHAD_PAGE_BITS;
+            p <= (addr + size - 1) >> SHAD_PAGE_BITS; p++) {
+        int i;
+        for (i = 0; i < num_load_pages && load_pages[i] != p; i++);
+        if (i < num_load_pages) continue;
+        if (num_load_pages == MAX_LOAD_PAGES) {
+            load_pages_overflow = true;
+            return 0;
+        }
+        load_pages[num_load_pages++] = p;
+    }
+    return 0;
+}
+
 void verify(void) {
     llvm::Module *mod = tcg_llvm_ctx->getModule();
     std::string err;
@@ -204,12 +293,77 @@ void verify(void) {
     }
 }
 
+static void taint2_init_shadow(void) {
+    if (shadow) return;
+
+    /*
+     * Taint processor initialization
+     */
+
+    shadow = tp_init(TAINT_BYTE_LABEL, TAINT_GRANULARITY_BYTE);
+    if (shadow == NULL){
+        printf("Error initializing shadow memory...\n");
+        exit(1);
+    }
+    if (track_tcn) tp_enable_tcn(shadow);
+    if (track_cb_mask) tp_enable_cb_masks(shadow);
+
+    // Initialize memlog.
+    memset(&taint_memlog, 0, sizeof(taint_memlog));
+}
+
+// Snip the rest of the replay, from here on, into ff_name using scissors.
+static void taint2_ff_cut(void) {
+    char arg[256];
+    uint64_t count = rr_get_guest_instr_count();
+    printf("taint2: taint requested @ instr %" PRIu64 ". Writing replay %s"
+            " starting here.\n", count, ff_name);
+
+    snprintf(arg, sizeof(arg), "scissors:name=%s", ff_name);
+    panda_add_arg(arg, strlen(arg));
+    snprintf(arg, sizeof(arg), "scissors:start=%" PRIu64, count);
+    panda_add_arg(arg, strlen(arg));
+    snprintf(arg, sizeof(arg), "scissors:stop");
+    panda_add_arg(arg, strlen(arg));
+    panda_require("scissors");
+}
+
+static void __taint2_activate_taint(void);
+
 void __taint2_enable_taint(void) {
     if(taintEnabled) {return;}
+    if (ff_name && rr_in_replay()) {
+        taint2_init_shadow();
+        if (!taint_requested) {
+            taint_requested = true;
+            taint2_ff_cut();
+        }
+        return;
+    }
+    if (lazy_taint) {
+        taint2_init_shadow();
+        if (!taint_requested) {
+            taint_requested = true;
+            printf("taint2: taint requested @ instr %" PRIu64 ". Waiting for"
+                    " first label.\n", rr_get_guest_instr_count());
+        }
+        return;
+    }
+    __taint2_activate_taint();
+}
+
+static void __taint2_activate_taint(void) {
     printf ("taint2: __taint_enable_taint\n");
     taintEnabled = true;
     panda_cb pcb;
 
+    if (lazy_taint) {
+        // Deferred from init_plugin.
+        panda_enable_memcb();
+        panda_disable_tb_chaining();
+        panda_do_flush_tb();
+    }
+
     pcb.after_block_translate = after_block_translate;
     panda_register_callback(plugin_ptr, PANDA_CB_AFTER_BLOCK_TRANSLATE, pcb);
     pcb.before_block_exec_invalidate_opt = before_block_exec_invalidate_opt;
@@ -220,6 +374,8 @@ void __taint2_enable_taint(void) {
     panda_register_callback(plugin_ptr, PANDA_CB_AFTER_BLOCK_EXEC, pcb);
     pcb.phys_mem_read = phys_mem_read_callback;
     panda_register_callback(plugin_ptr, PANDA_CB_PHYS_MEM_READ, pcb);
+    pcb.phys_mem_before_read = phys_mem_before_read_callback;
+    panda_register_callback(plugin_ptr, PANDA_CB_PHYS_MEM_BEFORE_READ, pcb);
     pcb.phys_mem_write = phys_mem_write_callback;
     panda_register_callback(plugin_ptr, PANDA_CB_PHYS_MEM_WRITE, pcb);
 /*
@@ -240,26 +396,22 @@ void __taint2_enable_taint(void) {
     }
     panda_enable_llvm_helpers();
 
-    /*
-     * Taint processor initialization
-     */
-
-    shadow = tp_init(TAINT_BYTE_LABEL, TAINT_GRANULARITY_BYTE);
-    if (shadow == NULL){
-        printf("Error initializing shadow memory...\n");
-        exit(1);
-    }
-
-    // Initialize memlog.
-    memset(&taint_memlog, 0, sizeof(taint_memlog));
+    taint2_init_shadow();
 
     llvm::Module *mod = tcg_llvm_ctx->getModule();
     FPM = tcg_llvm_ctx->getFunctionPassManager();
 
     // Add the taint analysis pass to our taint pass manager
     PTFP = new llvm::PandaTaintFunctionPass(shadow, &taint_memlog);
+    PTFP->PTV.tbSummaries = &tb_summaries;
+    tcg_llvm_tb_free_hook = taint2_tb_free;
     FPM->add(PTFP);
 
+    if (fuse_taint_ops) {
+        PTFusion = new llvm::PandaTaintFusionPass(shadow, PTFP->PTV);
+        FPM->add(PTFusion);
+    }
+
     if (optimize_llvm) {
         printf("taint2: Adding default optimizations (-O1).\n");
         llvm::PassManagerBuilder Builder;
@@ -270,10 +422,23 @@ void __taint2_enable_taint(void) {
 
     FPM->doInitialization();
 
-    // Populate module with helper function taint ops
+    if (taint_ring_enabled) {
+        taint_ring_start();
+        // on_taint_change listeners expect to be called on the vCPU thread.
+        if (track_taint_state || PPP_CHECK_CB(on_taint_change)) {
+            taint_ring_run_inline();
+        }
+    }
+
+    // Populate module with helper function taint ops. These are only
+    // instrumented once, so dead ops are kept in case taint2_track_taint_state
+    // is called later.
+    if (PTFusion) PTFusion->eliminate_dead = false;
     for (auto i = mod->begin(); i != mod->end(); i++){
-        if (!i->isDeclaration()) PTFP->runOnFunction(*i);
+        if (i->isDeclaration()) continue;
+        if (PTFP->runOnFunction(*i) && PTFusion) PTFusion->runOnFunction(*i);
     }
+    if (PTFusion) PTFusion->eliminate_dead = true;
 
     printf("taint2: Done processing helper functions for taint.\n");
 
@@ -305,6 +470,13 @@ int after_block_translate(CPUState *env, TranslationBlock *tb){
 int after_block_exec(CPUState *env, TranslationBlock *tb,
         TranslationBlock *next_tb){
 
+    if (load_summary) {
+        load_summary->load_pages_known = !load_pages_overflow;
+        load_summary->load_pages.assign(load_pages,
+                load_pages + (load_pages_overflow ? 0 : num_load_pages));
+        load_summary = NULL;
+    }
+
     if (taintJustDisabled){
         taintJustDisabled = false;
         execute_llvm = 0;
@@ -436,6 +608,7 @@ std::set < LabelSetP > ls_returned;
 */ 
 
 Panda__TaintQuery *__taint2_query_pandalog (Addr a, uint32_t offset) {
+    taint_ring_sync();
     LabelSetP ls = tp_query(shadow, a);
     if (ls) {
         Panda__TaintQuery *tq = (Panda__TaintQuery *) malloc(sizeof(Panda__TaintQuery));
@@ -684,6 +857,7 @@ void i386_hypercall_callback(CPUState *env){
 #endif // TARGET_I386
 
 int guest_hypercall_callback(CPUState *env){
+    taint_ring_sync();
 #ifdef TARGET_I386
     i386_hypercall_callback(env);
 #endif
@@ -725,6 +899,13 @@ bool __taint2_enabled() {
 
 // label this phys addr in memory with this label
 void __taint2_label_ram(uint64_t pa, uint32_t l) {
+    taint_ring_sync();
+    if (lazy_taint && !taintEnabled && !ff_name) {
+        printf("taint2: first label @ instr %" PRIu64 ".\n",
+                rr_get_guest_instr_count());
+        __taint2_activate_taint();
+    }
+    if (!shadow) taint2_init_shadow();
     tp_label_ram(shadow, pa, l);
 }
 
@@ -778,6 +959,7 @@ void taint2_add_taint_ram_single_label(CPUState *env, uint64_t addr,
 }
 
 uint32_t __taint2_query(Addr a) {
+    taint_ring_sync();
     LabelSetP ls = tp_query(shadow, a);
     return ls_card(ls);
 }
@@ -785,17 +967,20 @@ uint32_t __taint2_query(Addr a) {
 // if phys addr pa is untainted, return 0.
 // else returns label set cardinality
 uint32_t __taint2_query_ram(uint64_t pa) {
+    taint_ring_sync();
     LabelSetP ls = tp_query_ram(shadow, pa);
     return ls_card(ls);
 }
 
 
 uint32_t __taint2_query_reg(int reg_num, int offset) {
+    taint_ring_sync();
     LabelSetP ls = tp_query_reg(shadow, reg_num, offset);
     return ls_card(ls);
 }
 
 uint32_t __taint2_query_llvm(int reg_num, int offset) {
+    taint_ring_sync();
     LabelSetP ls = tp_query_llvm(shadow, reg_num, offset);
     return ls_card(ls);
 }
@@ -803,31 +988,38 @@ uint32_t __taint2_query_llvm(int reg_num, int offset) {
 
 
 uint32_t __taint2_query_tcn(Addr a) {
+    taint_ring_sync();
     return tp_query_tcn(shadow, a);
 }
 
 uint32_t __taint2_query_tcn_ram(uint64_t pa) {
+    taint_ring_sync();
     return tp_query_tcn_ram(shadow, pa);
 }
 
 uint32_t __taint2_query_tcn_reg(int reg_num, int offset) {
+    taint_ring_sync();
     return tp_query_tcn_reg(shadow, reg_num, offset);
 }
 
 uint32_t __taint2_query_tcn_llvm(int reg_num, int offset) {
+    taint_ring_sync();
     return tp_query_tcn_llvm(shadow, reg_num, offset);
 }
 
 uint64_t __taint2_query_cb_mask(Addr a, uint8_t size) {
+    taint_ring_sync();
     return tp_query_cb_mask(shadow, a, size);
 }
 
 
 uint32_t *__taint2_labels_applied(void) {
+    taint_ring_sync();
     return tp_labels_applied();
 }
 
 uint32_t __taint2_num_labels_applied(void) {
+    taint_ring_sync();
     return tp_num_labels_applied();
 }
 
@@ -835,10 +1027,12 @@ uint32_t __taint2_num_labels_applied(void) {
 
 
 void __taint2_delete_ram(uint64_t pa) {
+    taint_ring_sync();
     tp_delete_ram(shadow, pa);
 }
 
 void __taint2_labelset_spit(LabelSetP ls) {
+    taint_ring_sync();
     std::set<uint32_t> rendered(label_set_render_set(ls));
     for (uint32_t l : rendered) {
         printf("%u ", l);
@@ -848,27 +1042,55 @@ void __taint2_labelset_spit(LabelSetP ls) {
 
 
 void __taint2_labelset_iter(LabelSetP ls,  int (*app)(uint32_t el, void *stuff1), void *stuff2) {
+    taint_ring_sync();
     tp_ls_iter(ls, app, stuff2);
 }
 
 void __taint2_labelset_addr_iter(Addr *a, int (*app)(uint32_t el, void *stuff1), void *stuff2) {
+    taint_ring_sync();
     tp_ls_a_iter(shadow, a, app, stuff2);
 }
 
 void __taint2_labelset_ram_iter(uint64_t pa, int (*app)(uint32_t el, void *stuff1), void *stuff2) {
+    taint_ring_sync();
     tp_ls_ram_iter(shadow, pa, app, stuff2);
 }
 
 void __taint2_labelset_reg_iter(int reg_num, int offset, int (*app)(uint32_t el, void *stuff1), void *stuff2) {
+    taint_ring_sync();
     tp_ls_reg_iter(shadow, reg_num, offset, app, stuff2);
 }
 
 void __taint2_labelset_llvm_iter(int reg_num, int offset, int (*app)(uint32_t el, void *stuff1), void *stuff2) {
+    taint_ring_sync();
     tp_ls_llvm_iter(shadow, reg_num, offset, app, stuff2);
 }
 
 void __taint2_track_taint_state(void) {
+    if (track_taint_state) return;
     track_taint_state = true;
+    taint_ring_run_inline();
+    // Code already translated may have had ops fused away that the new
+    // on_taint_change listener needs to see.
+    if (PTFusion) panda_do_flush_tb();
+}
+
+void __taint2_track_tcn(void) {
+    if (track_tcn) return;
+    track_tcn = true;
+    if (shadow) {
+        taint_ring_sync();
+        tp_enable_tcn(shadow);
+    }
+}
+
+void __taint2_track_cb_mask(void) {
+    if (track_cb_mask) return;
+    track_cb_mask = true;
+    if (shadow) {
+        taint_ring_sync();
+        tp_enable_cb_masks(shadow);
+    }
 }
 
 
@@ -981,12 +1203,63 @@ void taint2_track_taint_state(void) {
     __taint2_track_taint_state();
 }
 
+void taint2_track_tcn(void) {
+    __taint2_track_tcn();
+}
+
+void taint2_track_cb_mask(void) {
+    __taint2_track_cb_mask();
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////////
 
-int before_block_exec(CPUState *env, TranslationBlock *tb) {
+// True if none of the shadow state this block's taint ops read carries a
+// label, in which case running them would not change anything. Load
+// addresses aren't known until the block runs, so we guess that a block
+// loads from the same RAM pages as last time; if a load turns out to hit a
+// tainted page anyway, phys_mem_before_read_callback restarts it. Calls we
+// don't model can read memory we don't see, so blocks with those are only
+// skipped while no RAM at all is tainted.
+static bool tb_taint_free(const llvm::TaintTBSummary &s) {
+    if (s.calls && shadow->ram->get_num_tainted()) return false;
+    if (s.loads && shadow->ram->get_num_tainted()) {
+        if (!s.load_pages_known) return false;
+        for (uint64_t p : s.load_pages) {
+            if (shadow->ram->range_maybe_tainted(p << SHAD_PAGE_BITS,
+                        1 << SHAD_PAGE_BITS)) return false;
+        }
+    }
+    if (s.dynamic && (shadow->grv->get_num_tainted() ||
+                shadow->gsv->get_num_tainted())) return false;
+    for (auto &r : s.grv) {
+        if (shadow->grv->range_maybe_tainted(r.first, r.second)) return false;
+    }
+    for (auto &r : s.gsv) {
+        if (shadow->gsv->range_maybe_tainted(r.first, r.second)) return false;
+    }
+    return true;
+}
 
+int before_block_exec(CPUState *env, TranslationBlock *tb) {
+    load_summary = NULL;
+    tb->llvm_bypass = false;
+    // Checking the shadow here would mean waiting on the propagation thread.
+    if (!taintEnabled || !execute_llvm || taint_ring_enabled) return 0;
+
+    tbs_executed++;
+    auto it = tb_summaries.find(tb->llvm_function);
+    if (it == tb_summaries.end()) return 0;
+    llvm::TaintTBSummary &s = it->second;
+    if (s.loads) {
+        load_summary = &s;
+        num_load_pages = 0;
+        load_pages_overflow = false;
+    }
 
+    tb->llvm_bypass = !no_bypass_next && tb_taint_free(s);
+    no_bypass_next = false;
+    if (tb->llvm_bypass) tbs_bypassed++;
 
     return 0;
 }
@@ -1030,8 +1303,22 @@ bool init_plugin(void *self) {
     printf("Initializing taint plugin\n");
     plugin_ptr = self;
     panda_cb pcb;
-    panda_enable_memcb();
-    panda_disable_tb_chaining();
+    panda_arg_list *args = panda_get_args("taint2");
+
+    lazy_taint = panda_parse_bool(args, "lazy");
+    ff_name = panda_parse_string(args, "ff", NULL);
+    if (ff_name) {
+        printf("taint2: Fast-forward mode. Replay will be cut into %s where"
+                " taint is first enabled.\n", ff_name);
+        lazy_taint = true;
+    } else if (lazy_taint) {
+        printf("taint2: Lazy activation ENABLED. Taint starts at first label.\n");
+    }
+
+    if (!lazy_taint) {
+        panda_enable_memcb();
+        panda_disable_tb_chaining();
+    }
     pcb.guest_hypercall = guest_hypercall_callback;
     panda_register_callback(self, PANDA_CB_GUEST_HYPERCALL, pcb);
     pcb.before_block_exec_invalidate_opt = before_block_exec_invalidate_opt;
@@ -1041,8 +1328,6 @@ bool init_plugin(void *self) {
     panda_register_callback(plugin_ptr, PANDA_CB_REPLAY_HANDLE_PACKET, pcb);
     */
 
-    panda_arg_list *args = panda_get_args("taint2");
-
     tainted_pointer = !panda_parse_bool(args, "no_tp");
     if (tainted_pointer) {
         printf("taint2: Propagating taint through pointer dereference ENABLED.\n");
@@ -1061,6 +1346,24 @@ bool init_plugin(void *self) {
     if (panda_parse_bool(args, "word")) granularity = TAINT_GRANULARITY_WORD;
     optimize_llvm = panda_parse_bool(args, "opt");
 
+    if (panda_parse_bool(args, "tcn")) track_tcn = true;
+    if (panda_parse_bool(args, "cb_mask")) track_cb_mask = true;
+    printf("taint2: Taint compute numbers %s, controlled-bit masks %s.\n",
+            track_tcn ? "ENABLED" : "DISABLED",
+            track_cb_mask ? "ENABLED" : "DISABLED");
+
+    taint_ring_enabled = panda_parse_bool(args, "threaded");
+    if (taint_ring_enabled) {
+        printf("taint2: Threaded taint propagation ENABLED.\n");
+    }
+
+    fuse_taint_ops = !panda_parse_bool(args, "no_fuse");
+    if (fuse_taint_ops) {
+        printf("taint2: Fusing and eliminating redundant taint ops ENABLED.\n");
+    } else {
+        printf("taint2: Fusing and eliminating redundant taint ops DISABLED.\n");
+    }
+
     panda_require("callstack_instr");
     assert(init_callstack_instr_api());
 
@@ -1073,8 +1376,24 @@ void uninit_plugin(void *self) {
 
     printf ("uninit taint plugin\n");
 
+    if (PTFusion) {
+        printf("taint2: fusion forwarded %" PRIu64 " and removed %" PRIu64
+                " of %" PRIu64 " taint ops.\n", PTFusion->ops_forwarded,
+                PTFusion->ops_removed, PTFusion->ops_seen);
+    }
+    printf("taint2: ran %" PRIu64 " of %" PRIu64 " blocks without taint ops"
+            " (%" PRIu64 " restarted on a tainted load).\n",
+            tbs_bypassed, tbs_executed, tbs_restarted);
+
+    if (taint_ring_enabled) {
+        taint_ring_stop();
+        printf("taint2: %" PRIu64 " taint ops went through the propagation"
+                " thread.\n", taint_ring_records());
+    }
+
     if (shadow) tp_free(shadow);
 
+    tcg_llvm_tb_free_hook = NULL;
     panda_disable_llvm();
     panda_disable_memcb();
     panda_enable_tb_chaining();
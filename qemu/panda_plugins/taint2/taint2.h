@@ -80,6 +80,10 @@ Shad *tp_init(TaintLabelMode mode, TaintGranularity granularity);
 // Delete a shadow memory
 void tp_free(Shad *shad);
 
+// allocate the optional tcn / cb mask tables in every shadow
+void tp_enable_tcn(Shad *shad);
+void tp_enable_cb_masks(Shad *shad);
+
 // label -- associate label l with address a
 void tp_label(Shad *shad, Addr *a, uint32_t l);
 
@@ -35,6 +35,12 @@ uint32_t taint2_query_tcn_llvm(int reg_num, int offset);
 // reversibly from input).
 uint64_t taint2_query_cb_mask(Addr a, uint8_t size);
 
+// Taint compute numbers and controlled-bit masks are only kept once some
+// plugin asks for them; until then the queries above return 0. Call these
+// from init_plugin to have them from the start.
+void taint2_track_tcn(void);
+void taint2_track_cb_mask(void);
+
 // delete taint from this phys addr
 void taint2_delete_ram(uint64_t pa) ;
 
@@ -29,6 +29,8 @@ extern "C" {
 #include <llvm/IR/Instructions.h>
 #include <llvm/IR/Value.h>
 
+#include <algorithm>
+
 #include "fast_shad.h"
 #include "label_set.h"
 #include "taint_ops.h"
@@ -78,16 +80,20 @@ struct CBMasks {
 static void update_cb(
         FastShad *shad_dest, uint64_t dest,
         FastShad *shad_src, uint64_t src, uint64_t size,
-        llvm::Instruction *I);
+        const CBInstr &cbi);
 
 static inline CBMasks compile_cb_masks(FastShad *shad, uint64_t addr, uint64_t size);
 static inline void write_cb_masks(FastShad *shad, uint64_t addr, uint64_t size, CBMasks value);
 
 // Taint operations
-void taint_copy(
+//
+// The _impl versions take either the instruction, or its controlled-bit
+// details already extracted (for deferred propagation); the details are only
+// worked out once we know there's taint to update.
+static inline void taint_copy_impl(
         FastShad *shad_dest, uint64_t dest,
         FastShad *shad_src, uint64_t src,
-        uint64_t size, llvm::Instruction *I) {
+        uint64_t size, llvm::Instruction *I, const CBInstr *cbi) {
     taint_log("copy: %s[%lx+%lx] <- %s[%lx] (",
             shad_dest->name(), dest, size, shad_src->name(), src);
 #ifdef TAINTDEBUG
@@ -103,33 +109,65 @@ void taint_copy(
         return;
     }
 
+    // Clean over clean: no labels to move and no masks worth keeping.
+    if (!shad_dest->range_maybe_tainted(dest, size) &&
+            !shad_src->range_maybe_tainted(src, size))
+        return;
+
     FastShad::copy(shad_dest, dest, shad_src, src, size);
 
-    if (I) update_cb(shad_dest, dest, shad_src, src, size, I);
+    if (cbi) update_cb(shad_dest, dest, shad_src, src, size, *cbi);
+    else if (I) update_cb(shad_dest, dest, shad_src, src, size, taint_cb_instr(I));
 }
 
-void taint_parallel_compute(
+void taint_copy(
+        FastShad *shad_dest, uint64_t dest,
+        FastShad *shad_src, uint64_t src,
+        uint64_t size, llvm::Instruction *I) {
+    taint_copy_impl(shad_dest, dest, shad_src, src, size, I, NULL);
+}
+
+void taint_copy_cbi(
+        FastShad *shad_dest, uint64_t dest,
+        FastShad *shad_src, uint64_t src,
+        uint64_t size, const CBInstr *cbi) {
+    taint_copy_impl(shad_dest, dest, shad_src, src, size, NULL, cbi);
+}
+
+static inline void taint_parallel_compute_impl(
         FastShad *shad,
         uint64_t dest, uint64_t ignored,
         uint64_t src1, uint64_t src2, uint64_t src_size,
-        llvm::Instruction *I) {
+        llvm::Instruction *I, const CBInstr *cbi) {
     taint_log("pcompute: %s[%lx+%lx] <- %lx + %lx\n",
             shad->name(), dest, src_size, src1, src2);
-    uint64_t i;
-    for (i = 0; i < src_size; ++i) {
-        TaintData td = TaintData::make_union(
-                shad->query_full(src1 + i),
-                shad->query_full(src2 + i), true);
-        shad->set_full(dest + i, td);
+    if (!shad->range_maybe_tainted(src1, src_size) &&
+            !shad->range_maybe_tainted(src2, src_size) &&
+            !shad->range_maybe_tainted(dest, src_size))
+        return;
+
+    // Union a register's worth at a time and write it back in one go rather
+    // than notifying per byte.
+    TaintData out[MAXREGSIZE];
+    for (uint64_t base = 0; base < src_size; base += MAXREGSIZE) {
+        uint64_t n = std::min(src_size - base, (uint64_t)MAXREGSIZE);
+        for (uint64_t i = 0; i < n; ++i) {
+            out[i] = TaintData::make_union(
+                    shad->query_full(src1 + base + i),
+                    shad->query_full(src2 + base + i), true);
+        }
+        shad->set_full_range(dest + base, out, n);
     }
 
     // Unlike mixed computes, parallel computes guaranteed to be bitwise.
     // This means we can honestly compute CB masks; in fact we have to because
     // of the way e.g. the deposit TCG op is lifted to LLVM.
+    if (!shad->has_cb_masks()) return;
+    unsigned opcode = cbi ? cbi->opcode : (I ? I->getOpcode() : 0);
     CBMasks cb_mask_1 = compile_cb_masks(shad, src1, src_size);
     CBMasks cb_mask_2 = compile_cb_masks(shad, src2, src_size);
     CBMasks cb_mask_out = {0};
-    if (I && I->getOpcode() == llvm::Instruction::Or) {
+    if (opcode == llvm::Instruction::Or) {
         cb_mask_out.one_mask = cb_mask_1.one_mask | cb_mask_2.one_mask;
         cb_mask_out.zero_mask = cb_mask_1.zero_mask & cb_mask_2.zero_mask;
         // Anything that's a literal zero in one operand will not affect
@@ -137,7 +175,7 @@ void taint_parallel_compute(
         cb_mask_out.cb_mask =
             (cb_mask_1.zero_mask & cb_mask_2.cb_mask) |
             (cb_mask_2.zero_mask & cb_mask_1.cb_mask);
-    } else if (I && I->getOpcode() == llvm::Instruction::And) {
+    } else if (opcode == llvm::Instruction::And) {
         cb_mask_out.one_mask = cb_mask_1.one_mask & cb_mask_2.one_mask;
         cb_mask_out.zero_mask = cb_mask_1.zero_mask | cb_mask_2.zero_mask;
         // Anything that's a literal one in one operand will not affect
@@ -151,6 +189,24 @@ void taint_parallel_compute(
     write_cb_masks(shad, dest, src_size, cb_mask_out);
 }
 
+void taint_parallel_compute(
+        FastShad *shad,
+        uint64_t dest, uint64_t ignored,
+        uint64_t src1, uint64_t src2, uint64_t src_size,
+        llvm::Instruction *I) {
+    taint_parallel_compute_impl(shad, dest, ignored, src1, src2, src_size,
+            I, NULL);
+}
+
+void taint_parallel_compute_cbi(
+        FastShad *shad,
+        uint64_t dest, uint64_t ignored,
+        uint64_t src1, uint64_t src2, uint64_t src_size,
+        const CBInstr *cbi) {
+    taint_parallel_compute_impl(shad, dest, ignored, src1, src2, src_size,
+            NULL, cbi);
+}
+
 static inline TaintData mixed_labels(FastShad *shad, uint64_t addr, uint64_t size,
         bool increment_tcn) {
     TaintData td(shad->query_full(addr));
@@ -163,10 +219,7 @@ static inline TaintData mixed_labels(FastShad *shad, uint64_t addr, uint64_t siz
 }
 
 static inline void bulk_set(FastShad *shad, uint64_t addr, uint64_t size, TaintData td) {
-    uint64_t i;
-    for (i = 0; i < size; ++i) {
-        shad->set_full(addr + i, td);
-    }
+    shad->set_range(addr, td, size);
 }
 
 void taint_mix_compute(
@@ -176,6 +229,11 @@ void taint_mix_compute(
         llvm::Instruction *ignored) {
     taint_log("mcompute: %s[%lx+%lx] <- %lx + %lx\n",
             shad->name(), dest, dest_size, src1, src2);
+    if (!shad->range_maybe_tainted(src1, src_size) &&
+            !shad->range_maybe_tainted(src2, src_size) &&
+            !shad->range_maybe_tainted(dest, dest_size))
+        return;
+
     TaintData td = TaintData::make_union(
             mixed_labels(shad, src1, src_size, false),
             mixed_labels(shad, src2, src_size, false),
@@ -198,17 +256,38 @@ void taint_set(
     bulk_set(shad_dest, dest, dest_size, shad_src->query_full(src));
 }
 
-void taint_mix(
+static inline void taint_mix_impl(
         FastShad *shad,
         uint64_t dest, uint64_t dest_size,
         uint64_t src, uint64_t src_size,
-        llvm::Instruction *I) {
+        llvm::Instruction *I, const CBInstr *cbi) {
     taint_log("mix: %s[%lx+%lx] <- %lx+%lx\n",
             shad->name(), dest, dest_size, src, src_size);
+    if (!shad->range_maybe_tainted(src, src_size) &&
+            !shad->range_maybe_tainted(dest, dest_size))
+        return;
+
     TaintData td = mixed_labels(shad, src, src_size, true);
     bulk_set(shad, dest, dest_size, td);
 
-    if (I) update_cb(shad, dest, shad, src, dest_size, I);
+    if (cbi) update_cb(shad, dest, shad, src, dest_size, *cbi);
+    else if (I) update_cb(shad, dest, shad, src, dest_size, taint_cb_instr(I));
+}
+
+void taint_mix(
+        FastShad *shad,
+        uint64_t dest, uint64_t dest_size,
+        uint64_t src, uint64_t src_size,
+        llvm::Instruction *I) {
+    taint_mix_impl(shad, dest, dest_size, src, src_size, I, NULL);
+}
+
+void taint_mix_cbi(
+        FastShad *shad,
+        uint64_t dest, uint64_t dest_size,
+        uint64_t src, uint64_t src_size,
+        const CBInstr *cbi) {
+    taint_mix_impl(shad, dest, dest_size, src, src_size, NULL, cbi);
 }
 
 static const uint64_t ones = ~0UL;
@@ -233,6 +312,11 @@ void taint_pointer(
         src = ones; // ignore source.
     }
 
+    if (!shad_ptr->range_maybe_tainted(ptr, ptr_size) &&
+            (src == ones || !shad_src->range_maybe_tainted(src, size)) &&
+            !shad_dest->range_maybe_tainted(dest, size))
+        return;
+
     // this is [1234] in our example
     TaintData ptr_td = mixed_labels(shad_ptr, ptr, ptr_size, false);
     if (src == ones) {
@@ -252,6 +336,10 @@ void taint_pointer(
 
 void taint_sext(FastShad *shad, uint64_t dest, uint64_t dest_size, uint64_t src, uint64_t src_size) {
     taint_log("taint_sext\n");
+    if (!shad->range_maybe_tainted(src, src_size) &&
+            !shad->range_maybe_tainted(dest, dest_size))
+        return;
+
     FastShad::copy(shad, dest, shad, src, src_size);
     bulk_set(shad, dest + src_size, dest_size - src_size,
             shad->query_full(dest + src_size - 1));
@@ -416,6 +504,8 @@ void taint_host_delete(
 // The information is stored on a byte level. LLVM operations give us the
 // information on how to reconstruct word-level values. We use that information
 // to reconstruct and deconstruct the full mask.
+// Masks are only kept on labeled bytes; an unlabeled byte contributes
+// nothing, whatever happens to be stored in its record.
 static inline CBMasks compile_cb_masks(FastShad *shad, uint64_t addr, uint64_t size) {
     CBMasks result = {0};
     for (int i = size - 1; i >= 0; i--) {
@@ -423,6 +513,7 @@ static inline CBMasks compile_cb_masks(FastShad *shad, uint64_t addr, uint64_t s
         result.cb_mask <<= 8;
         result.one_mask <<= 8;
         result.zero_mask <<= 8;
+        if (!td.ls) continue;
         result.cb_mask |= td.cb_mask;
         result.one_mask |= td.one_mask;
         result.zero_mask |= td.zero_mask;
@@ -431,23 +522,41 @@ static inline CBMasks compile_cb_masks(FastShad *shad, uint64_t addr, uint64_t s
 }
 
 static inline void write_cb_masks(FastShad *shad, uint64_t addr, uint64_t size, CBMasks cb_masks) {
-    for (unsigned i = 0; i < size; i++) {
-        TaintData td = shad->query_full(addr + i);
-        td.cb_mask = (uint8_t)cb_masks.cb_mask;
-        td.one_mask = (uint8_t)cb_masks.one_mask;
-        td.zero_mask = (uint8_t)cb_masks.zero_mask;
-        cb_masks.cb_mask >>= 8;
-        cb_masks.one_mask >>= 8;
-        cb_masks.zero_mask >>= 8;
-        shad->set_full(addr + i, td);
+    TaintData out[MAXREGSIZE];
+    for (uint64_t base = 0; base < size; base += MAXREGSIZE) {
+        uint64_t n = std::min(size - base, (uint64_t)MAXREGSIZE);
+        for (uint64_t i = 0; i < n; i++) {
+            TaintData td = shad->query_full(addr + base + i);
+            td.cb_mask = (uint8_t)cb_masks.cb_mask;
+            td.one_mask = (uint8_t)cb_masks.one_mask;
+            td.zero_mask = (uint8_t)cb_masks.zero_mask;
+            cb_masks.cb_mask >>= 8;
+            cb_masks.one_mask >>= 8;
+            cb_masks.zero_mask >>= 8;
+            out[i] = td;
+        }
+        shad->set_full_range(addr + base, out, n);
     }
 }
 
+CBInstr taint_cb_instr(llvm::Instruction *I) {
+    CBInstr cbi = { 0, ~0UL, false };
+    if (!I) return cbi;
+
+    cbi.opcode = I->getOpcode();
+    llvm::Value *rhs = I->getNumOperands() >= 2 ? I->getOperand(1) : nullptr;
+    llvm::ConstantInt *CI = rhs ? llvm::dyn_cast<llvm::ConstantInt>(rhs) : nullptr;
+    if (CI) cbi.literal = CI->getZExtValue();
+    llvm::GetElementPtrInst *GEPI = llvm::dyn_cast<llvm::GetElementPtrInst>(I);
+    cbi.gep_const = GEPI && GEPI->hasAllConstantIndices();
+    return cbi;
+}
+
 static void update_cb(
         FastShad *shad_dest, uint64_t dest,
         FastShad *shad_src, uint64_t src, uint64_t size,
-        llvm::Instruction *I) {
-    if (!I) return;
+        const CBInstr &cbi) {
+    if (!cbi.opcode || !shad_dest->has_cb_masks()) return;
 
     CBMasks cb_masks = compile_cb_masks(shad_src, src, size);
     uint64_t &cb_mask = cb_masks.cb_mask;
@@ -455,12 +564,10 @@ static void update_cb(
     uint64_t &zero_mask = cb_masks.zero_mask;
 
     uint64_t orig_one_mask = one_mask, orig_zero_mask = zero_mask;
-    llvm::Value *rhs = I->getNumOperands() >= 2 ? I->getOperand(1) : nullptr;
-    llvm::ConstantInt *CI = rhs ? llvm::dyn_cast<llvm::ConstantInt>(rhs) : nullptr;
-    uint64_t literal = CI ? CI->getZExtValue() : ~0UL;
+    uint64_t literal = cbi.literal;
     int log2 = 0;
 
-    switch (I->getOpcode()) {
+    switch (cbi.opcode) {
         // Totally reversible cases.
         case llvm::Instruction::Add:
         case llvm::Instruction::Sub:
@@ -587,22 +694,17 @@ static void update_cb(
             break;
 
         case llvm::Instruction::GetElementPtr:
-        {
-            llvm::GetElementPtrInst *GEPI =
-                llvm::dyn_cast<llvm::GetElementPtrInst>(I);
-            tassert(GEPI);
             one_mask = 0;
             zero_mask = 0;
             // Constant indices => fully reversible
-            if (GEPI->hasAllConstantIndices()) break;
+            if (cbi.gep_const) break;
             // Otherwise we know nothing.
             cb_mask = 0;
             break;
-        }
 
         default:
-            printf("Unknown instruction in update_cb: ");
-            I->dump();
+            printf("Unknown instruction in update_cb: %s\n",
+                    llvm::Instruction::getOpcodeName(cbi.opcode));
             fflush(stdout);
             return;
     }
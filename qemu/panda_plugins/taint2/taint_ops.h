@@ -135,4 +135,32 @@ void taint_host_delete(
 
 } // extern "C"
 
+// What update_cb needs to know about an instruction. Extracted up front when
+// an op is applied after the fact (deferred propagation, see taint_ring.h),
+// since the instruction may be gone by then.
+typedef struct CBInstr {
+    unsigned opcode; // 0 for no instruction.
+    uint64_t literal; // constant second operand, or ~0UL.
+    bool gep_const; // GEP with all constant indices.
+} CBInstr;
+
+CBInstr taint_cb_instr(llvm::Instruction *I);
+
+void taint_copy_cbi(
+        FastShad *shad_dest, uint64_t dest,
+        FastShad *shad_src, uint64_t src,
+        uint64_t size, const CBInstr *cbi);
+
+void taint_parallel_compute_cbi(
+        FastShad *shad,
+        uint64_t dest, uint64_t ignored,
+        uint64_t src1, uint64_t src2, uint64_t src_size,
+        const CBInstr *cbi);
+
+void taint_mix_cbi(
+        FastShad *shad,
+        uint64_t dest, uint64_t dest_size,
+        uint64_t src, uint64_t src_size,
+        const CBInstr *cbi);
+
 #endif
@@ -125,6 +125,22 @@ Shad *tp_init(TaintLabelMode mode, TaintGranularity granularity) {
 }
 
 
+void tp_enable_tcn(Shad *shad) {
+    shad->ram->enable_tcn();
+    shad->llv->enable_tcn();
+    shad->ret->enable_tcn();
+    shad->grv->enable_tcn();
+    shad->gsv->enable_tcn();
+}
+
+void tp_enable_cb_masks(Shad *shad) {
+    shad->ram->enable_cb_masks();
+    shad->llv->enable_cb_masks();
+    shad->ret->enable_cb_masks();
+    shad->grv->enable_cb_masks();
+    shad->gsv->enable_cb_masks();
+}
+
 /*
  * Delete a shadow memory
  */
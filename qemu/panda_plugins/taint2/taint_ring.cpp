@@ -0,0 +1,481 @@
+/* PANDABEGINCOMMENT
+ *
+ * Authors:
+ *  Tim Leek               tleek@ll.mit.edu
+ *  Ryan Whelan            rwhelan@ll.mit.edu
+ *  Joshua Hodosh          josh.hodosh@ll.mit.edu
+ *  Michael Zhivich        mzhivich@ll.mit.edu
+ *  Brendan Dolan-Gavitt   brendandg@gatech.edu
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2.
+ * See the COPYING file in the top-level directory.
+ *
+PANDAENDCOMMENT */
+
+/*
+ * Deferred taint propagation: a single-producer, single-consumer ring of taint
+ * op records between the vCPU thread and a propagation thread.
+ *
+ * Ops have to be applied in the order they were produced (a copy into a
+ * register followed by a copy out of it, frame pushes and pops), so there is
+ * one consumer. What we win is that emulation and propagation overlap.
+ */
+
+extern "C" {
+#include <stdio.h>
+#include <stdarg.h>
+#include <assert.h>
+#include <unistd.h>
+
+#include "cpu.h"
+#include "qemu-log.h"
+}
+
+#include <atomic>
+#include <thread>
+
+#include "fast_shad.h"
+#include "taint_ops.h"
+#include "taint_ring.h"
+
+bool taint_ring_enabled = false;
+
+#define TAINT_RING_BITS 16
+#define TAINT_RING_SIZE (1UL << TAINT_RING_BITS)
+#define TAINT_RING_MASK (TAINT_RING_SIZE - 1)
+
+// How often the propagation thread publishes its progress.
+#define TAINT_RING_PUBLISH 256
+
+enum TaintRecordOp {
+    REC_COPY,
+    REC_PARALLEL_COMPUTE,
+    REC_MIX_COMPUTE,
+    REC_DELETE,
+    REC_MIX,
+    REC_POINTER,
+    REC_SEXT,
+    REC_SELECT_COPY, // a select, already resolved to the chosen copy.
+    REC_HOST_COPY,
+    REC_HOST_MEMCPY,
+    REC_HOST_DELETE,
+    REC_RESET_FRAME,
+    REC_PUSH_FRAME,
+    REC_POP_FRAME,
+};
+
+// Arguments are stored in the order of the op's parameters.
+struct TaintRecord {
+    uint32_t op;
+    CBInstr cbi;
+    uint64_t args[9];
+};
+
+static TaintRecord *ring = NULL;
+
+// Sequence numbers: records produced (written only by the vCPU thread) and
+// records applied (written only by the propagation thread).
+static std::atomic<uint64_t> ring_head(0);
+static std::atomic<uint64_t> ring_tail(0);
+
+// Producer's last look at ring_tail, so it only touches the consumer's cache
+// line when the ring looks full.
+static uint64_t cached_tail = 0;
+
+static std::atomic<bool> ring_running(false);
+static std::thread ring_thread;
+
+// False when ops should run on the vCPU thread as they come.
+static bool ring_async = false;
+
+static inline TaintRecord *ring_reserve(uint32_t op) {
+    uint64_t head = ring_head.load(std::memory_order_relaxed);
+    while (head - cached_tail >= TAINT_RING_SIZE) {
+        cached_tail = ring_tail.load(std::memory_order_acquire);
+        if (head - cached_tail >= TAINT_RING_SIZE) std::this_thread::yield();
+    }
+    TaintRecord *r = &ring[head & TAINT_RING_MASK];
+    r->op = op;
+    return r;
+}
+
+static inline void ring_commit(void) {
+    ring_head.store(ring_head.load(std::memory_order_relaxed) + 1,
+            std::memory_order_release);
+}
+
+static void apply_record(TaintRecord &r) {
+    uint64_t *a = r.args;
+    switch (r.op) {
+        case REC_COPY:
+            taint_copy_cbi((FastShad *)a[0], a[1], (FastShad *)a[2], a[3],
+                    a[4], &r.cbi);
+            break;
+        case REC_PARALLEL_COMPUTE:
+            taint_parallel_compute_cbi((FastShad *)a[0], a[1], a[2], a[3],
+                    a[4], a[5], &r.cbi);
+            break;
+        case REC_MIX_COMPUTE:
+            taint_mix_compute((FastShad *)a[0], a[1], a[2], a[3], a[4], a[5],
+                    NULL);
+            break;
+        case REC_DELETE:
+            taint_delete((FastShad *)a[0], a[1], a[2]);
+            break;
+        case REC_MIX:
+            taint_mix_cbi((FastShad *)a[0], a[1], a[2], a[3], a[4], &r.cbi);
+            break;
+        case REC_POINTER:
+            taint_pointer((FastShad *)a[0], a[1], (FastShad *)a[2], a[3], a[4],
+                    (FastShad *)a[5], a[6], a[7]);
+            break;
+        case REC_SEXT:
+            taint_sext((FastShad *)a[0], a[1], a[2], a[3], a[4]);
+            break;
+        case REC_SELECT_COPY:
+            FastShad::copy((FastShad *)a[0], a[1], (FastShad *)a[0], a[2], a[3]);
+            break;
+        case REC_HOST_COPY:
+            taint_host_copy(a[0], a[1], (FastShad *)a[2], a[3],
+                    (FastShad *)a[4], (FastShad *)a[5], a[6], a[7], a[8]);
+            break;
+        case REC_HOST_MEMCPY:
+            taint_host_memcpy(a[0], a[1], a[2], (FastShad *)a[3],
+                    (FastShad *)a[4], a[5], a[6]);
+            break;
+        case REC_HOST_DELETE:
+            taint_host_delete(a[0], a[1], (FastShad *)a[2], (FastShad *)a[3],
+                    a[4], a[5]);
+            break;
+        case REC_RESET_FRAME:
+            taint_reset_frame((FastShad *)a[0]);
+            break;
+        case REC_PUSH_FRAME:
+            taint_push_frame((FastShad *)a[0]);
+            break;
+        case REC_POP_FRAME:
+            taint_pop_frame((FastShad *)a[0]);
+            break;
+        default:
+            assert(false && "Bad taint ring record!");
+    }
+}
+
+static void ring_worker(void) {
+    uint64_t tail = ring_tail.load(std::memory_order_relaxed);
+    unsigned idle = 0;
+    while (true) {
+        uint64_t head = ring_head.load(std::memory_order_acquire);
+        if (tail == head) {
+            if (!ring_running.load(std::memory_order_acquire)) break;
+            // Spin a while before backing off; the vCPU is usually right
+            // behind us.
+            if (++idle < 1024) std::this_thread::yield();
+            else usleep(50);
+            continue;
+        }
+        idle = 0;
+        while (tail != head) {
+            apply_record(ring[tail & TAINT_RING_MASK]);
+            tail++;
+            if ((tail % TAINT_RING_PUBLISH) == 0) {
+                ring_tail.store(tail, std::memory_order_release);
+            }
+        }
+        ring_tail.store(tail, std::memory_order_release);
+    }
+}
+
+void taint_ring_start(void) {
+    if (ring) return;
+    ring = new TaintRecord[TAINT_RING_SIZE];
+    ring_async = true;
+    ring_running.store(true, std::memory_order_release);
+    ring_thread = std::thread(ring_worker);
+    printf("taint2: Propagating taint on a separate thread (%lu-entry ring).\n",
+            TAINT_RING_SIZE);
+}
+
+void taint_ring_sync(void) {
+    if (!ring_async) return;
+    uint64_t head = ring_head.load(std::memory_order_relaxed);
+    while (ring_tail.load(std::memory_order_acquire) != head) {
+        std::this_thread::yield();
+    }
+    cached_tail = head;
+}
+
+void taint_ring_run_inline(void) {
+    if (!ring_async) return;
+    taint_ring_sync();
+    ring_async = false;
+    printf("taint2: Propagating taint inline from here on.\n");
+}
+
+void taint_ring_stop(void) {
+    if (!ring) return;
+    taint_ring_sync();
+    ring_async = false;
+    ring_running.store(false, std::memory_order_release);
+    ring_thread.join();
+    delete[] ring;
+    ring = NULL;
+}
+
+uint64_t taint_ring_records(void) {
+    return ring_head.load(std::memory_order_relaxed);
+}
+
+// Deferred op versions. Same signatures as the ops in taint_ops.h.
+
+void deferred_taint_copy(
+        FastShad *shad_dest, uint64_t dest,
+        FastShad *shad_src, uint64_t src,
+        uint64_t size, llvm::Instruction *I) {
+    if (!ring_async) {
+        taint_copy(shad_dest, dest, shad_src, src, size, I);
+        return;
+    }
+    TaintRecord *r = ring_reserve(REC_COPY);
+    r->args[0] = (uint64_t)shad_dest;
+    r->args[1] = dest;
+    r->args[2] = (uint64_t)shad_src;
+    r->args[3] = src;
+    r->args[4] = size;
+    r->cbi = taint_cb_instr(I);
+    ring_commit();
+}
+
+void deferred_taint_parallel_compute(
+        FastShad *shad,
+        uint64_t dest, uint64_t ignored,
+        uint64_t src1, uint64_t src2, uint64_t src_size,
+        llvm::Instruction *I) {
+    if (!ring_async) {
+        taint_parallel_compute(shad, dest, ignored, src1, src2, src_size, I);
+        return;
+    }
+    TaintRecord *r = ring_reserve(REC_PARALLEL_COMPUTE);
+    r->args[0] = (uint64_t)shad;
+    r->args[1] = dest;
+    r->args[2] = ignored;
+    r->args[3] = src1;
+    r->args[4] = src2;
+    r->args[5] = src_size;
+    r->cbi = taint_cb_instr(I);
+    ring_commit();
+}
+
+void deferred_taint_mix_compute(
+        FastShad *shad,
+        uint64_t dest, uint64_t dest_size,
+        uint64_t src1, uint64_t src2, uint64_t src_size,
+        llvm::Instruction *ignored) {
+    if (!ring_async) {
+        taint_mix_compute(shad, dest, dest_size, src1, src2, src_size, ignored);
+        return;
+    }
+    TaintRecord *r = ring_reserve(REC_MIX_COMPUTE);
+    r->args[0] = (uint64_t)shad;
+    r->args[1] = dest;
+    r->args[2] = dest_size;
+    r->args[3] = src1;
+    r->args[4] = src2;
+    r->args[5] = src_size;
+    ring_commit();
+}
+
+void deferred_taint_delete(FastShad *shad, uint64_t dest, uint64_t size) {
+    if (!ring_async) {
+        taint_delete(shad, dest, size);
+        return;
+    }
+    TaintRecord *r = ring_reserve(REC_DELETE);
+    r->args[0] = (uint64_t)shad;
+    r->args[1] = dest;
+    r->args[2] = size;
+    ring_commit();
+}
+
+void deferred_taint_mix(
+        FastShad *shad,
+        uint64_t dest, uint64_t dest_size,
+        uint64_t src, uint64_t src_size,
+        llvm::Instruction *I) {
+    if (!ring_async) {
+        taint_mix(shad, dest, dest_size, src, src_size, I);
+        return;
+    }
+    TaintRecord *r = ring_reserve(REC_MIX);
+    r->args[0] = (uint64_t)shad;
+    r->args[1] = dest;
+    r->args[2] = dest_size;
+    r->args[3] = src;
+    r->args[4] = src_size;
+    r->cbi = taint_cb_instr(I);
+    ring_commit();
+}
+
+void deferred_taint_pointer(
+        FastShad *shad_dest, uint64_t dest,
+        FastShad *shad_ptr, uint64_t ptr, uint64_t ptr_size,
+        FastShad *shad_src, uint64_t src, uint64_t size) {
+    if (!ring_async) {
+        taint_pointer(shad_dest, dest, shad_ptr, ptr, ptr_size,
+                shad_src, src, size);
+        return;
+    }
+    TaintRecord *r = ring_reserve(REC_POINTER);
+    r->args[0] = (uint64_t)shad_dest;
+    r->args[1] = dest;
+    r->args[2] = (uint64_t)shad_ptr;
+    r->args[3] = ptr;
+    r->args[4] = ptr_size;
+    r->args[5] = (uint64_t)shad_src;
+    r->args[6] = src;
+    r->args[7] = size;
+    ring_commit();
+}
+
+void deferred_taint_sext(
+        FastShad *shad,
+        uint64_t dest, uint64_t dest_size,
+        uint64_t src, uint64_t src_size) {
+    if (!ring_async) {
+        taint_sext(shad, dest, dest_size, src, src_size);
+        return;
+    }
+    TaintRecord *r = ring_reserve(REC_SEXT);
+    r->args[0] = (uint64_t)shad;
+    r->args[1] = dest;
+    r->args[2] = dest_size;
+    r->args[3] = src;
+    r->args[4] = src_size;
+    ring_commit();
+}
+
+// The selector is a runtime value, so resolve it here and record only the
+// copy that taint_select would have made.
+void deferred_taint_select(
+        FastShad *shad,
+        uint64_t dest, uint64_t size, uint64_t selector,
+        ...) {
+    const uint64_t ones = ~0UL;
+    va_list argp;
+    uint64_t src, srcsel;
+
+#ifdef TAINTDEBUG
+    bool found = false;
+#endif
+    va_start(argp, selector);
+    src = va_arg(argp, uint64_t);
+    srcsel = va_arg(argp, uint64_t);
+    while (!(src == ones && srcsel == ones)) {
+        if (srcsel == selector) {
+#ifdef TAINTDEBUG
+            found = true;
+#endif
+            break;
+        }
+        src = va_arg(argp, uint64_t);
+        srcsel = va_arg(argp, uint64_t);
+    }
+    va_end(argp);
+
+#ifdef TAINTDEBUG
+    tassert(found && "Couldn't find selected argument!!");
+#endif
+    if (src == ones) return; // it's a constant.
+
+    if (!ring_async) {
+        FastShad::copy(shad, dest, shad, src, size);
+        return;
+    }
+    TaintRecord *r = ring_reserve(REC_SELECT_COPY);
+    r->args[0] = (uint64_t)shad;
+    r->args[1] = dest;
+    r->args[2] = src;
+    r->args[3] = size;
+    ring_commit();
+}
+
+void deferred_taint_host_copy(
+        uint64_t env_ptr, uint64_t addr,
+        FastShad *llv, uint64_t llv_offset,
+        FastShad *greg, FastShad *gspec,
+        uint64_t size, uint64_t labels_per_reg, bool is_store) {
+    if (!ring_async) {
+        taint_host_copy(env_ptr, addr, llv, llv_offset, greg, gspec,
+                size, labels_per_reg, is_store);
+        return;
+    }
+    TaintRecord *r = ring_reserve(REC_HOST_COPY);
+    r->args[0] = env_ptr;
+    r->args[1] = addr;
+    r->args[2] = (uint64_t)llv;
+    r->args[3] = llv_offset;
+    r->args[4] = (uint64_t)greg;
+    r->args[5] = (uint64_t)gspec;
+    r->args[6] = size;
+    r->args[7] = labels_per_reg;
+    r->args[8] = is_store;
+    ring_commit();
+}
+
+void deferred_taint_host_memcpy(
+        uint64_t env_ptr, uint64_t dest, uint64_t src,
+        FastShad *greg, FastShad *gspec,
+        uint64_t size, uint64_t labels_per_reg) {
+    if (!ring_async) {
+        taint_host_memcpy(env_ptr, dest, src, greg, gspec, size, labels_per_reg);
+        return;
+    }
+    TaintRecord *r = ring_reserve(REC_HOST_MEMCPY);
+    r->args[0] = env_ptr;
+    r->args[1] = dest;
+    r->args[2] = src;
+    r->args[3] = (uint64_t)greg;
+    r->args[4] = (uint64_t)gspec;
+    r->args[5] = size;
+    r->args[6] = labels_per_reg;
+    ring_commit();
+}
+
+void deferred_taint_host_delete(
+        uint64_t env_ptr, uint64_t dest_addr,
+        FastShad *greg, FastShad *gspec,
+        uint64_t size, uint64_t labels_per_reg) {
+    if (!ring_async) {
+        taint_host_delete(env_ptr, dest_addr, greg, gspec, size, labels_per_reg);
+        return;
+    }
+    TaintRecord *r = ring_reserve(REC_HOST_DELETE);
+    r->args[0] = env_ptr;
+    r->args[1] = dest_addr;
+    r->args[2] = (uint64_t)greg;
+    r->args[3] = (uint64_t)gspec;
+    r->args[4] = size;
+    r->args[5] = labels_per_reg;
+    ring_commit();
+}
+
+static inline void deferred_frame_op(uint32_t op, FastShad *shad) {
+    TaintRecord *r = ring_reserve(op);
+    r->args[0] = (uint64_t)shad;
+    ring_commit();
+}
+
+void deferred_taint_reset_frame(FastShad *shad) {
+    if (!ring_async) taint_reset_frame(shad);
+    else deferred_frame_op(REC_RESET_FRAME, shad);
+}
+
+void deferred_taint_push_frame(FastShad *shad) {
+    if (!ring_async) taint_push_frame(shad);
+    else deferred_frame_op(REC_PUSH_FRAME, shad);
+}
+
+void deferred_taint_pop_frame(FastShad *shad) {
+    if (!ring_async) taint_pop_frame(shad);
+    else deferred_frame_op(REC_POP_FRAME, shad);
+}
@@ -0,0 +1,111 @@
+/* PANDABEGINCOMMENT
+ *
+ * Authors:
+ *  Tim Leek               tleek@ll.mit.edu
+ *  Ryan Whelan            rwhelan@ll.mit.edu
+ *  Joshua Hodosh          josh.hodosh@ll.mit.edu
+ *  Michael Zhivich        mzhivich@ll.mit.edu
+ *  Brendan Dolan-Gavitt   brendandg@gatech.edu
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2.
+ * See the COPYING file in the top-level directory.
+ *
+PANDAENDCOMMENT */
+
+#ifndef __TAINT_RING_H_
+#define __TAINT_RING_H_
+
+#include <cstdint>
+
+namespace llvm { class Instruction; }
+
+class FastShad;
+
+// Deferred taint propagation.
+//
+// In threaded mode the instrumented code doesn't touch shadow memory. The taint
+// op functions are mapped to the deferred_ versions below instead, which
+// append a fixed-size record (op, shadow pointers, addresses, and whatever
+// dynamic values were already popped from taint2_memlog) to a ring. A
+// propagation thread consumes the ring in order and applies the real ops.
+//
+// The number of records produced so far is a sequence number; anything on
+// the vCPU thread that looks at or changes shadow state calls
+// taint_ring_sync() first, which waits until the propagation thread has
+// applied everything up to the current sequence number.
+
+// Whether to map taint ops to the deferred versions. Must be set before the
+// taint pass is initialized.
+extern bool taint_ring_enabled;
+
+void taint_ring_start(void);
+void taint_ring_stop(void);
+void taint_ring_sync(void);
+
+// Apply ops on the vCPU thread again, as they come, e.g. because some plugin
+// wants callbacks for each change. Syncs first.
+void taint_ring_run_inline(void);
+
+uint64_t taint_ring_records(void);
+
+void deferred_taint_copy(
+        FastShad *shad_dest, uint64_t dest,
+        FastShad *shad_src, uint64_t src,
+        uint64_t size, llvm::Instruction *I);
+
+void deferred_taint_parallel_compute(
+        FastShad *shad,
+        uint64_t dest, uint64_t ignored,
+        uint64_t src1, uint64_t src2, uint64_t src_size,
+        llvm::Instruction *I);
+
+void deferred_taint_mix_compute(
+        FastShad *shad,
+        uint64_t dest, uint64_t dest_size,
+        uint64_t src1, uint64_t src2, uint64_t src_size,
+        llvm::Instruction *ignored);
+
+void deferred_taint_delete(FastShad *shad, uint64_t dest, uint64_t size);
+
+void deferred_taint_mix(
+        FastShad *shad,
+        uint64_t dest, uint64_t dest_size,
+        uint64_t src, uint64_t src_size,
+        llvm::Instruction *I);
+
+void deferred_taint_pointer(
+        FastShad *shad_dest, uint64_t dest,
+        FastShad *shad_ptr, uint64_t ptr, uint64_t ptr_size,
+        FastShad *shad_src, uint64_t src, uint64_t size);
+
+void deferred_taint_sext(
+        FastShad *shad,
+        uint64_t dest, uint64_t dest_size,
+        uint64_t src, uint64_t src_size);
+
+void deferred_taint_select(
+        FastShad *shad,
+        uint64_t dest, uint64_t size, uint64_t selector,
+        ...);
+
+void deferred_taint_host_copy(
+        uint64_t env_ptr, uint64_t addr,
+        FastShad *llv, uint64_t llv_offset,
+        FastShad *greg, FastShad *gspec,
+        uint64_t size, uint64_t labels_per_reg, bool is_store);
+
+void deferred_taint_host_memcpy(
+        uint64_t env_ptr, uint64_t dest, uint64_t src,
+        FastShad *greg, FastShad *gspec,
+        uint64_t size, uint64_t labels_per_reg);
+
+void deferred_taint_host_delete(
+        uint64_t env_ptr, uint64_t dest_addr,
+        FastShad *greg, FastShad *gspec,
+        uint64_t size, uint64_t labels_per_reg);
+
+void deferred_taint_reset_frame(FastShad *shad);
+void deferred_taint_push_frame(FastShad *shad);
+void deferred_taint_pop_frame(FastShad *shad);
+
+#endif
@@ -130,6 +130,8 @@ bool init_plugin(void *self) {
     panda_register_callback(self, PANDA_CB_AFTER_BLOCK_EXEC, pcb);
     */
     PPP_REG_CB("taint2", on_branch2, tbranch_on_branch_taint2);                                                                       
+    // taint queries logged to the pandalog include the taint compute number
+    taint2_track_tcn();
     return true;
 }
 
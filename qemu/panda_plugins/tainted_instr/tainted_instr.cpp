@@ -121,6 +121,8 @@ bool init_plugin(void *self) {
     // this tells taint system to enable extra instrumentation
     // so it can tell when the taint state changes
     taint2_track_taint_state();
+    // taint queries logged to the pandalog include the taint compute number
+    taint2_track_tcn();
     return true;
 }
 
@@ -1,18 +1,24 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdint.h>
+#include <string.h>
+#include <errno.h>
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <unistd.h>
 #include <fcntl.h>
 #include <sys/mman.h>
 #include <assert.h>
+#include <zlib.h>
 
 #include <bitset>
 #include <vector>
 #include <set>
 #include <stack>
 #include <map>
+#include <unordered_map>
+#include <unordered_set>
+#include <algorithm>
 
 #include "llvm/IR/Constants.h"
 #include "llvm/IR/Instructions.h"
@@ -83,12 +89,34 @@ enum SliceVarType {
     HOST,
     REG,
     SPEC,
-    FRET
+    FRET,
+    NUM_SLICE_VAR_TYPES
 };
 uint64_t ret_ctr = 0;
 
 typedef std::pair<SliceVarType,uint64_t> SliceVar;
 
+// MEM and HOST variables are single bytes, and come in runs (a 4-byte
+// store defines 4 of them). Everything else is a single value.
+static inline bool is_byte_var(SliceVarType t) {
+    return t == MEM || t == HOST;
+}
+
+// A run of len variables of the same type starting at start; len is 1
+// except for MEM and HOST.
+struct SliceRange {
+    SliceVarType type;
+    uint64_t start;
+    uint64_t len;
+};
+
+// Uses or defs of a single instruction
+typedef std::vector<SliceRange> VarList;
+
+static inline void addVar(VarList &l, SliceVarType t, uint64_t v, uint64_t len = 1) {
+    if (len > 0) l.push_back(SliceRange{t, v, len});
+}
+
 std::string SliceVarStr(const SliceVar &s) {
     char output[128] = {};
 
@@ -161,6 +189,144 @@ SliceVar VarFromStr(const char *str) {
     return std::make_pair(typ, addr);
 }
 
+// Up to this many sets of criteria can be sliced in one pass over the
+// trace; each gets one bit of a CriteriaMask.
+#define MAX_CRITERIA 64
+typedef uint64_t CriteriaMask;
+
+// The working sets of all criteria being sliced. Each variable carries the
+// mask of the criteria whose working set it is in. Byte variables are kept
+// as disjoint [start, end) intervals of equal mask, so slicing on (or
+// through) a large buffer costs a few map nodes rather than one entry per
+// byte; other variables are hashed.
+class WorkingSet {
+    struct Interval {
+        uint64_t end;
+        CriteriaMask mask;
+    };
+    typedef std::map<uint64_t,Interval> IntervalMap;
+
+    IntervalMap intervals[NUM_SLICE_VAR_TYPES];
+    std::unordered_map<uint64_t,CriteriaMask> vars[NUM_SLICE_VAR_TYPES];
+
+    // Make sure no interval straddles x
+    static void split(IntervalMap &m, uint64_t x) {
+        auto it = m.upper_bound(x);
+        if (it == m.begin()) return;
+        --it;
+        if (it->first < x && it->second.end > x) {
+            m[x] = Interval{it->second.end, it->second.mask};
+            it->second.end = x;
+        }
+    }
+
+    // Merge adjacent intervals with the same mask in and around [start, end)
+    static void coalesce(IntervalMap &m, uint64_t start, uint64_t end) {
+        auto it = m.lower_bound(start);
+        if (it != m.begin()) --it;
+        while (it != m.end() && it->first <= end) {
+            auto next = std::next(it);
+            if (next != m.end() && next->first == it->second.end &&
+                    next->second.mask == it->second.mask) {
+                it->second.end = next->second.end;
+                m.erase(next);
+            }
+            else {
+                it = next;
+            }
+        }
+    }
+
+public:
+    // The criteria whose working set holds any part of r
+    CriteriaMask intersects(const SliceRange &r) const {
+        if (!is_byte_var(r.type)) {
+            auto it = vars[r.type].find(r.start);
+            return it == vars[r.type].end() ? 0 : it->second;
+        }
+        const IntervalMap &m = intervals[r.type];
+        uint64_t end = r.start + r.len;
+        CriteriaMask mask = 0;
+        auto it = m.upper_bound(r.start);
+        if (it != m.begin() && std::prev(it)->second.end > r.start) --it;
+        for (; it != m.end() && it->first < end; ++it) mask |= it->second.mask;
+        return mask;
+    }
+
+    void insert(const SliceRange &r, CriteriaMask mask) {
+        if (!mask) return;
+        if (!is_byte_var(r.type)) {
+            vars[r.type][r.start] |= mask;
+            return;
+        }
+        IntervalMap &m = intervals[r.type];
+        uint64_t start = r.start, end = r.start + r.len;
+        split(m, start);
+        split(m, end);
+        uint64_t pos = start;
+        auto it = m.lower_bound(start);
+        while (pos < end) {
+            if (it != m.end() && it->first == pos) {
+                it->second.mask |= mask;
+                pos = it->second.end;
+                ++it;
+            }
+            else {
+                uint64_t gap_end = (it != m.end() && it->first < end) ? it->first : end;
+                m.emplace_hint(it, pos, Interval{gap_end, mask});
+                pos = gap_end;
+            }
+        }
+        coalesce(m, start, end);
+    }
+
+    void erase(const SliceRange &r, CriteriaMask mask) {
+        if (!is_byte_var(r.type)) {
+            auto it = vars[r.type].find(r.start);
+            if (it != vars[r.type].end() && !(it->second &= ~mask))
+                vars[r.type].erase(it);
+            return;
+        }
+        IntervalMap &m = intervals[r.type];
+        uint64_t start = r.start, end = r.start + r.len;
+        split(m, start);
+        split(m, end);
+        for (auto it = m.lower_bound(start); it != m.end() && it->first < end; ) {
+            if (!(it->second.mask &= ~mask)) it = m.erase(it);
+            else ++it;
+        }
+        coalesce(m, start, end);
+    }
+
+    // The criteria that still have a non-empty working set
+    CriteriaMask live() const {
+        CriteriaMask mask = 0;
+        for (int t = 0; t < NUM_SLICE_VAR_TYPES; t++) {
+            for (auto &kvp : vars[t]) mask |= kvp.second;
+            for (auto &kvp : intervals[t]) mask |= kvp.second.mask;
+        }
+        return mask;
+    }
+
+    void print() const {
+        printf("{");
+        for (int t = 0; t < NUM_SLICE_VAR_TYPES; t++) {
+            SliceVarType typ = (SliceVarType)t;
+            for (auto &kvp : vars[t]) {
+                printf(" %s", SliceVarStr(std::make_pair(typ, kvp.first)).c_str());
+                if (kvp.second != 1) printf("/%" PRIx64, kvp.second);
+            }
+            for (auto &kvp : intervals[t]) {
+                printf(" %s", SliceVarStr(std::make_pair(typ, kvp.first)).c_str());
+                if (kvp.second.end - kvp.first > 1)
+                    printf("..%" PRIx64, kvp.second.end - 1);
+                if (kvp.second.mask != 1) printf("/%" PRIx64, kvp.second.mask);
+            }
+        }
+        printf(" }\n");
+    }
+};
+
 struct __attribute__((packed)) TUBTEntry {
     uint64_t asid;
     uint64_t pc;
@@ -236,14 +402,15 @@ struct trace_entry {
     Instruction *insn;
     TUBTEntry *dyn;
     TUBTEntry *dyn2; // Just for memcpy because it's a special snowflake
+    uint64_t phi_incoming; // For PHIs: index of the block we came from
 };
 
 static SliceVar get_value_name(Value *v) {
     return std::make_pair(LLVM, (uint64_t)v);
 }
 
-static void insertValue(std::set<SliceVar> &s, Value *v) {
-    if (!isa<Constant>(v)) s.insert(get_value_name(v));
+static void insertValue(VarList &s, Value *v) {
+    if (!isa<Constant>(v)) addVar(s, LLVM, (uint64_t)v);
 }
 
 int getLoadSize(LoadInst *l) {
@@ -262,17 +429,16 @@ int getStoreSize(StoreInst *s) {
 // AddrEntry. NOTE: don't use this on __ld / __st, as the
 // MADDR type means something different in that context.
 // arg2 is the TUBT arg2 column
-void insertAddr(std::set<SliceVar> &s, AddrType typ, uint64_t arg2, int sz) {
+void insertAddr(VarList &s, AddrType typ, uint64_t arg2, int sz) {
     switch (typ) {
         case GREG:
-            s.insert(std::make_pair(REG, arg2));
+            addVar(s, REG, arg2);
             break;
         case MADDR:
-            for (int off = 0; off < sz; off++)
-                s.insert(std::make_pair(HOST, arg2+off));
+            if (sz > 0) addVar(s, HOST, arg2, sz);
             break;
         case GSPEC:
-            s.insert(std::make_pair(SPEC,arg2));
+            addVar(s, SPEC, arg2);
             break;
         default:
             printf("Warning: unhandled address entry type %d\n", typ);
@@ -283,8 +449,8 @@ void insertAddr(std::set<SliceVar> &s, AddrType typ, uint64_t arg2, int sz) {
 // Handlers for individual instruction types
 
 static void handleStore(trace_entry &t,
-        std::set<SliceVar> &uses,
-        std::set<SliceVar> &defs) {
+        VarList &uses,
+        VarList &defs) {
     StoreInst *s = cast<StoreInst>(t.insn);
     AddrType typ;
     AddrFlag flag;
@@ -302,8 +468,8 @@ static void handleStore(trace_entry &t,
 }
 
 static void handleLoad(trace_entry &t,
-        std::set<SliceVar> &uses,
-        std::set<SliceVar> &defs) {
+        VarList &uses,
+        VarList &defs) {
     LoadInst *l = cast<LoadInst>(t.insn);
     AddrType typ;
     AddrFlag flag;
@@ -321,8 +487,8 @@ static void handleLoad(trace_entry &t,
 }
 
 static void handleDefault(trace_entry &t,
-        std::set<SliceVar> &uses,
-        std::set<SliceVar> &defs) {
+        VarList &uses,
+        VarList &defs) {
     for (User::op_iterator i = t.insn->op_begin(), e = t.insn->op_end(); i != e; ++i) {
         Value *v = *i;
         if (!isa<BasicBlock>(v)) { // So that br doesn't end up with block refs
@@ -334,8 +500,8 @@ static void handleDefault(trace_entry &t,
 }
 
 static void handleCall(trace_entry &t,
-        std::set<SliceVar> &uses,
-        std::set<SliceVar> &defs) {
+        VarList &uses,
+        VarList &defs) {
     CallInst *c =  cast<CallInst>(t.insn);
     Function *subf = c->getCalledFunction();
     StringRef func_name = subf->getName();
@@ -349,9 +515,7 @@ static void handleCall(trace_entry &t,
             case 'b': size = 1; break;
             default: assert(false && "Invalid size in call to load");
         }
-        for (int off = 0; off < size; off++) {
-            uses.insert(std::make_pair(MEM, t.dyn->arg2 + off));
-        }
+        addVar(uses, MEM, t.dyn->arg2, size);
         Value *load_addr = c->getArgOperand(0);
         insertValue(uses, load_addr);
         insertValue(defs, t.insn);
@@ -366,9 +530,7 @@ static void handleCall(trace_entry &t,
             case 'b': size = 1; break;
             default: assert(false && "Invalid size in call to store");
         }
-        for (int off = 0; off < size; off++) {
-            defs.insert(std::make_pair(MEM, t.dyn->arg2 + off));
-        }
+        addVar(defs, MEM, t.dyn->arg2, size);
         Value *store_addr = c->getArgOperand(0);
         Value *store_val  = c->getArgOperand(1);
         insertValue(uses, store_addr);
@@ -449,35 +611,35 @@ static void handleCall(trace_entry &t,
         // Note that it does *not* use the arguments -- these will
         // get included automatically if they're needed to compute
         // the return value.
-        uses.insert(std::make_pair(FRET, ret_ctr));
+        addVar(uses, FRET, ret_ctr);
     }
     return;
 }
 
 static void handleRet(trace_entry &t,
-        std::set<SliceVar> &uses,
-        std::set<SliceVar> &defs) {
+        VarList &uses,
+        VarList &defs) {
 
     ReturnInst *r = cast<ReturnInst>(t.insn);
     Value *v = r->getReturnValue();
     if (v != NULL) insertValue(uses, v);
 
-    defs.insert(std::make_pair(FRET, ret_ctr++));
+    addVar(defs, FRET, ret_ctr++);
 }
 
 static void handlePHI(trace_entry &t,
-        std::set<SliceVar> &uses,
-        std::set<SliceVar> &defs) {
-    // arg1 is the fake dynamic value we derived during trace alignment
+        VarList &uses,
+        VarList &defs) {
+    // phi_incoming was derived during trace alignment
     PHINode *p = cast<PHINode>(t.insn);
-    Value *v = p->getIncomingValue(t.dyn->arg1);
+    Value *v = p->getIncomingValue(t.phi_incoming);
     insertValue(uses, v);
     insertValue(defs, t.insn);
 }
 
 static void handleSelect(trace_entry &t,
-        std::set<SliceVar> &uses,
-        std::set<SliceVar> &defs) {
+        VarList &uses,
+        VarList &defs) {
 
     SelectInst *s = cast<SelectInst>(t.insn);
     Value *v;
@@ -496,8 +658,8 @@ static void handleSelect(trace_entry &t,
 // want to operate on a trace element, not an Instruction (and hence we need
 // the accompanying dynamic info).
 void get_uses_and_defs(trace_entry &t,
-        std::set<SliceVar> &uses,
-        std::set<SliceVar> &defs) {
+        VarList &uses,
+        VarList &defs) {
     switch (t.insn->getOpcode()) {
         case Instruction::Store:
             handleStore(t, uses, defs);
@@ -559,26 +721,50 @@ void get_uses_and_defs(trace_entry &t,
     return;
 }
 
-std::map<std::pair<Function*,int>,std::bitset<MAX_BITSET>> marked;
+typedef std::pair<Function*,int> BlockId;
+
+struct BlockIdHash {
+    size_t operator()(const BlockId &b) const {
+        return std::hash<Function*>()(b.first) ^ ((size_t)b.second * 0x9e3779b97f4a7c15ULL);
+    }
+};
+
+// Marked instructions of each (function, basic block), as a bitmap only as
+// long as the highest marked instruction; most blocks have a few dozen.
+typedef std::unordered_map<BlockId,std::vector<uint64_t>,BlockIdHash> MarkMap;
+
+// One per set of criteria
+std::vector<MarkMap> marked;
 
 // Don't ever call this with an array of size < MAX_BITSET/8
-void bits2bytes(std::bitset<MAX_BITSET> &bs, uint8_t out[]) {
-    for (int i = 0; i < MAX_BITSET / 8; i++) {
-        uint8_t byte = 0;
+void bits2bytes(const std::vector<uint64_t> &bs, uint8_t out[]) {
+    memset(out, 0, MAX_BITSET / 8);
+    for (size_t w = 0; w < bs.size(); w++) {
         for (int j = 0; j < 8; j++) {
-            byte |= (bs[(i*8) + j] << j);
+            out[w*8 + j] = (bs[w] >> (j*8)) & 0xff;
         }
-        out[i] = byte;
     }
 }
 
-void mark(trace_entry &t) {
+static inline uint64_t count_bits(const std::vector<uint64_t> &bs) {
+    uint64_t n = 0;
+    for (uint64_t w : bs) n += __builtin_popcountll(w);
+    return n;
+}
+
+void mark(trace_entry &t, CriteriaMask mask) {
     int bb_num = t.index >> 16;
     int insn_index = t.index & 0xffff;
     assert (insn_index < MAX_BITSET);
-    marked[std::make_pair(t.func,bb_num)][insn_index] = true;
+    for (size_t c = 0; c < marked.size(); c++) {
+        if (!(mask & (1ULL << c))) continue;
+        std::vector<uint64_t> &bs = marked[c][std::make_pair(t.func,bb_num)];
+        if (bs.size() <= (size_t)insn_index / 64) bs.resize(insn_index / 64 + 1);
+        bs[insn_index / 64] |= 1ULL << (insn_index % 64);
+    }
     if (debug)
-        printf("Marking %s, block %d, instruction %d.\n", t.func->getName().str().c_str(), bb_num, insn_index);
+        printf("Marking %s, block %d, instruction %d for %" PRIx64 ".\n",
+                t.func->getName().str().c_str(), bb_num, insn_index, mask);
 }
 
 void print_insn(Instruction *insn) {
@@ -608,25 +794,32 @@ bool is_ignored(Function *f) {
         return false;
 }
 
-void print_set(std::set<SliceVar> &s) {
+void print_set(VarList &s) {
     printf("{");
-    for (const SliceVar &w : s) printf(" %s", SliceVarStr(w).c_str());
+    for (const SliceRange &r : s) {
+        printf(" %s", SliceVarStr(std::make_pair(r.type, r.start)).c_str());
+        if (r.len > 1) printf("..%" PRIx64, r.start + r.len - 1);
+    }
     printf(" }\n");
 }
 
 // Core slicing algorithm. If the current instruction
 // defines something we currently care about, then kill
 // the defs and add in the uses.
+// Each set of criteria is sliced independently: an instruction only
+// affects the working sets of the criteria in whose working set it
+// defines something. 'live' is the criteria still being sliced.
 // Note that this *modifies* the working set 'work' and
 // updates the global map of LLVM functions => bitsets
 void slice_trace(std::vector<trace_entry> &trace,
-        std::set<SliceVar> &work) {
+        WorkingSet &work, CriteriaMask live) {
     Function *entry_func = trace[0].func;
 
     // Keeps track of argument->value binding when we descend into
-    // functions
-    std::stack<std::map<SliceVar,SliceVar>> argmap_stack;
+    // functions. Only LLVM values are ever bound.
+    std::stack<std::unordered_map<uint64_t,uint64_t>> argmap_stack;
 
+    VarList uses, defs;
     for(std::vector<trace_entry>::reverse_iterator it = trace.rbegin();
             it != trace.rend(); it++) {
 
@@ -636,7 +829,8 @@ void slice_trace(std::vector<trace_entry> &trace,
         if (debug) printf(">> %s\n", it->insn->getOpcodeName());
         if (debug) print_insn(it->insn);
 
-        std::set<SliceVar> uses, defs;
+        uses.clear();
+        defs.clear();
         get_uses_and_defs(*it, uses, defs);
 
         if (debug) printf("DEBUG: %lu defs, %lu uses\n", defs.size(), uses.size());
@@ -645,56 +839,47 @@ void slice_trace(std::vector<trace_entry> &trace,
         if (debug) printf("USES: ");
         if (debug) print_set(uses);
 
-        if (it->func != entry_func) {
+        if (it->func != entry_func && !argmap_stack.empty()) {
             // If we're not at top level (i.e. we're in a helper function)
             // we need to map the uses through the current argument map. We
             // don't need to do this with the defs because you can't define
             // a function argument inside the function.
-            for (auto it = uses.begin(); it != uses.end(); ) {
-                std::map<SliceVar,SliceVar> &argmap = argmap_stack.top();
-                auto arg_it = argmap.find(*it);
-                if (arg_it != argmap.end()) {
-                    uses.erase(it++);
-                    uses.insert(arg_it->second);
-                }
-                else {
-                    ++it;
-                }
+            std::unordered_map<uint64_t,uint64_t> &argmap = argmap_stack.top();
+            for (SliceRange &u : uses) {
+                if (u.type != LLVM) continue;
+                auto arg_it = argmap.find(u.start);
+                if (arg_it != argmap.end()) u.start = arg_it->second;
             }
 
             if (debug) printf("USES (remapped): ");
             if (debug) print_set(uses);
         }
         
-        bool has_overlap = false;
-        for (auto &s : defs) {
-            if (work.find(s) != work.end()) {
-                has_overlap = true;
-                break;
-            }
-        }
+        CriteriaMask overlap = 0;
+        for (auto &s : defs) overlap |= work.intersects(s);
 
-        if (has_overlap) {
+        if (overlap) {
             if (debug) printf("Current instruction defines something in the working set\n");
 
             // Mark the instruction
-            mark(*it);
+            mark(*it, overlap);
 
             // Update the working set
-            for (auto &d : defs) work.erase(d);
-            work.insert(uses.begin(), uses.end());
+            for (auto &d : defs) work.erase(d, overlap);
+            for (auto &u : uses) work.insert(u, overlap);
 
         }
-        else if (it->insn->isTerminator() && !isa<ReturnInst>(it->insn) && include_branches) {
+        CriteriaMask rest = live & ~overlap;
+        if (rest && it->insn->isTerminator() && !isa<ReturnInst>(it->insn) && include_branches) {
             // Special case: branch/switch
             if (debug) printf("Current instruction is a branch, adding it.\n");
-            mark(*it);
-            work.insert(uses.begin(), uses.end());
+            mark(*it, rest);
+            for (auto &u : uses) work.insert(u, rest);
         }
 
         // Special handling for function calls. We need to bind arguments to values
         if (CallInst *c = dyn_cast<CallInst>(it->insn)) {
-            std::map<SliceVar,SliceVar> argmap;
+            std::unordered_map<uint64_t,uint64_t> argmap;
             Function *subf = c->getCalledFunction();
 
             if (!is_ignored(subf)) {
@@ -704,7 +889,7 @@ void slice_trace(std::vector<trace_entry> &trace,
                 for (argIter = subf->arg_begin(), p = 0;
                      argIter != subf->arg_end() && p < c->getNumArgOperands();
                      argIter++, p++) {
-                    argmap[get_value_name(&*argIter)] = get_value_name(c->getArgOperand(p));
+                    argmap[(uint64_t)&*argIter] = (uint64_t)c->getArgOperand(p);
                     if (debug) printf("ArgMap %s => %s\n", SliceVarStr(get_value_name(&*argIter)).c_str(), SliceVarStr(get_value_name(c->getArgOperand(p))).c_str());
                 }
                 argmap_stack.push(argmap);
@@ -717,12 +902,12 @@ void slice_trace(std::vector<trace_entry> &trace,
         }
 
         if (debug) printf("Working set: ");
-        if (debug) print_set(work);
+        if (debug) work.print();
     }
 
     // At the end we want to get rid of the argument to the basic block,
     // since it's just env.
-    work.erase(get_value_name(&*entry_func->arg_begin()));
+    work.erase(SliceRange{LLVM, (uint64_t)&*entry_func->arg_begin(), 1}, ~0ULL);
 }
 
 // Find the index of a block in a function
@@ -822,17 +1007,16 @@ TUBTEntry * process_func(Function *f, TUBTEntry *dynvals, std::vector<trace_entr
                     // our trace, which should be the predecessor basic block
                     // to this PHI
                     PHINode *p = cast<PHINode>(&*i);
-                    TUBTEntry *new_dyn = new TUBTEntry;
-                    new_dyn->arg1 = -1; // sentinel
+                    t.phi_incoming = -1; // sentinel
                     // Find the last non-PHI instruction
                     for (auto sit = serialized.rbegin(); sit != serialized.rend(); sit++) {
                         if (sit->insn->getOpcode() != Instruction::PHI) {
-                            new_dyn->arg1 = p->getBasicBlockIndex(sit->insn->getParent());
+                            t.phi_incoming = p->getBasicBlockIndex(sit->insn->getParent());
                             break;
                         }
                     }
-                    assert(new_dyn->arg1 != (uint64_t) -1);
-                    t.func = f; t.insn = i; t.dyn = new_dyn;
+                    assert(t.phi_incoming != (uint64_t) -1);
+                    t.func = f; t.insn = i; t.dyn = NULL;
                     serialized.push_back(t);
                     break;
                 }
@@ -924,6 +1108,226 @@ TUBTEntry * process_func(Function *f, TUBTEntry *dynvals, std::vector<trace_entr
     return cursor;
 }
 
+#define TUBT_HEADER_SIZE TUBTF_HEADER_SIZE
+#define READ_CHUNK_ROWS (1 << 16)
+
+static bool read_rows(int fd, TUBTEntry *buf, uint64_t first, uint64_t count) {
+    uint8_t *p = (uint8_t *)buf;
+    uint64_t len = count * sizeof(TUBTEntry);
+    off_t off = TUBT_HEADER_SIZE + first * sizeof(TUBTEntry);
+    while (len > 0) {
+        ssize_t n = pread(fd, p, len, off);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return false;
+        p += n; off += n; len -= n;
+    }
+    return true;
+}
+
+// Hands out the blocks of a TUBT log from last to first, each as its
+// TUBTFE_LLVM_FN row followed by its dynamic values in execution order.
+// process_func peeks one row past the end of a block, so a copy of the FN
+// row is appended as a sentinel. Only the current chunk of the log and the
+// block being assembled are kept in memory.
+class BlockReader {
+protected:
+    int fd;
+    uint64_t num_rows;
+    std::vector<TUBTEntry> window; // rows [win_start, win_start + window.size())
+    uint64_t win_start;
+
+    BlockReader(int fd, uint64_t num_rows) : fd(fd), num_rows(num_rows), win_start(0) {}
+
+    void emit(uint64_t start, uint64_t end, std::vector<TUBTEntry> &block) {
+        block.assign(window.begin() + (start - win_start), window.begin() + (end - win_start));
+        block.push_back(block[0]);
+    }
+
+public:
+    virtual ~BlockReader() {}
+    virtual bool next(std::vector<TUBTEntry> &block) = 0;
+    // Skip (cheaply, if the log has an index) to around guest instruction
+    // icount; blocks after it may still be handed out.
+    virtual void seek_instr(uint64_t icount) {}
+    // Rows handed out so far
+    virtual uint64_t consumed() = 0;
+    uint64_t total_rows() { return num_rows; }
+};
+
+// A log as written by tubtf/llvm_trace: blocks in execution order. Read
+// backwards a chunk at a time.
+class ForwardLogReader : public BlockReader {
+protected:
+    uint64_t end; // rows [end, num_rows) have been handed out
+
+    // First row of the chunk of the log that ends at row 'end'
+    virtual uint64_t chunk_start(uint64_t end) {
+        return end > READ_CHUNK_ROWS ? end - READ_CHUNK_ROWS : 0;
+    }
+
+    // Read the rows [first, first + count) picked by chunk_start
+    virtual void read_chunk(TUBTEntry *buf, uint64_t first, uint64_t count) {
+        if (!read_rows(fd, buf, first, count)) {
+            perror("read");
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    // Drop everything and continue with the block that ends at row
+    void seek(uint64_t row) {
+        window.clear();
+        win_start = end = row;
+    }
+
+    // Read the chunk before the window, keeping the rows we haven't
+    // handed out yet.
+    void load_before() {
+        uint64_t start = chunk_start(win_start);
+        std::vector<TUBTEntry> w(end - start);
+        read_chunk(w.data(), start, win_start - start);
+        std::copy(window.begin(), window.begin() + (end - win_start),
+                w.begin() + (win_start - start));
+        window.swap(w);
+        win_start = start;
+    }
+
+public:
+    ForwardLogReader(int fd, uint64_t num_rows) : BlockReader(fd, num_rows), end(num_rows) {
+        win_start = num_rows;
+    }
+
+    bool next(std::vector<TUBTEntry> &block) {
+        if (end == 0) return false;
+        uint64_t i = end;
+        while (true) {
+            while (i > win_start) {
+                i--;
+                if (window[i - win_start].type == TUBTFE_LLVM_FN) {
+                    emit(i, end, block);
+                    end = i;
+                    return true;
+                }
+            }
+            if (win_start == 0) {
+                fprintf(stderr, "ERROR: %" PRIu64 " rows before the first block.\n", end);
+                exit(EXIT_FAILURE);
+            }
+            load_before();
+        }
+    }
+
+    uint64_t consumed() { return num_rows - end; }
+};
+
+// A version 1 (columnar) log: the same rows, in compressed chunks that
+// start on block boundaries, with an index at the end. See tubtf.h.
+class ColumnarLogReader : public ForwardLogReader {
+    std::vector<TubtfChunkIndex> index;
+    std::vector<uint8_t> zbuf;
+    std::vector<uint64_t> cols;
+
+    // The chunk holding row
+    size_t find_chunk(uint64_t row) {
+        auto it = std::upper_bound(index.begin(), index.end(), row,
+                [](uint64_t r, const TubtfChunkIndex &ie) { return r < ie.first_row; });
+        assert(it != index.begin());
+        return (it - index.begin()) - 1;
+    }
+
+    uint64_t chunk_start(uint64_t end) {
+        return index[find_chunk(end - 1)].first_row;
+    }
+
+    void read_chunk(TUBTEntry *buf, uint64_t first, uint64_t count) {
+        const TubtfChunkIndex &ie = index[find_chunk(first)];
+        assert(ie.first_row == first && ie.num_rows == count);
+        zbuf.resize(ie.stored_size);
+        cols.resize(count * TUBTF_NUM_COL);
+        uLongf len = cols.size() * sizeof(uint64_t);
+        if (pread(fd, zbuf.data(), ie.stored_size, ie.offset + 2 * sizeof(uint32_t)) != (ssize_t)ie.stored_size ||
+                uncompress((Bytef *)cols.data(), &len, zbuf.data(), ie.stored_size) != Z_OK ||
+                len != cols.size() * sizeof(uint64_t)) {
+            fprintf(stderr, "ERROR: can't read chunk at offset %" PRIu64 ".\n", ie.offset);
+            exit(EXIT_FAILURE);
+        }
+        for (uint64_t r = 0; r < count; r++) {
+            uint64_t *row = (uint64_t *)&buf[r];
+            for (int c = 0; c < TUBTF_NUM_COL; c++) row[c] = cols[c * count + r];
+        }
+    }
+
+public:
+    ColumnarLogReader(int fd, const TubtfFooter &footer, std::vector<TubtfChunkIndex> &idx)
+        : ForwardLogReader(fd, footer.num_rows) {
+        index.swap(idx);
+    }
+
+    // Returns NULL if the log has no valid index
+    static ColumnarLogReader *open(int fd, uint64_t file_size) {
+        TubtfFooter footer;
+        if (file_size < TUBTF_HEADER_SIZE + sizeof(footer) ||
+                pread(fd, &footer, sizeof(footer), file_size - sizeof(footer)) != (ssize_t)sizeof(footer) ||
+                memcmp(footer.magic, TUBTF_INDEX_MAGIC, sizeof(footer.magic)) != 0 ||
+                footer.index_offset + footer.num_chunks * sizeof(TubtfChunkIndex) + sizeof(footer) != file_size) {
+            return NULL;
+        }
+        std::vector<TubtfChunkIndex> idx(footer.num_chunks);
+        ssize_t len = idx.size() * sizeof(TubtfChunkIndex);
+        if (pread(fd, idx.data(), len, footer.index_offset) != len) return NULL;
+        return new ColumnarLogReader(fd, footer, idx);
+    }
+
+    // Chunks are in execution order, so first_instr only grows
+    void seek_instr(uint64_t icount) {
+        auto it = std::upper_bound(index.begin(), index.end(), icount,
+                [](uint64_t i, const TubtfChunkIndex &ie) { return i < ie.first_instr; });
+        if (it != index.end()) seek(it->first_row);
+    }
+};
+
+// A log already reversed by logreverse_mmap: blocks last to first, each in
+// execution order. Read forwards a chunk at a time.
+class ReversedLogReader : public BlockReader {
+    uint64_t pos; // rows [0, pos) have been handed out
+
+    // Read the chunk after the window, keeping the rows we haven't handed
+    // out yet.
+    void load_after() {
+        uint64_t win_end = win_start + window.size();
+        uint64_t end = std::min(win_end + READ_CHUNK_ROWS, num_rows);
+        window.erase(window.begin(), window.begin() + (pos - win_start));
+        win_start = pos;
+        window.resize(end - win_start);
+        if (!read_rows(fd, window.data() + (win_end - win_start), win_end, end - win_end)) {
+            perror("read");
+            exit(EXIT_FAILURE);
+        }
+    }
+
+public:
+    ReversedLogReader(int fd, uint64_t num_rows) : BlockReader(fd, num_rows), pos(0) {}
+
+    bool next(std::vector<TUBTEntry> &block) {
+        if (pos == num_rows) return false;
+        if (pos == win_start + window.size()) load_after();
+        assert(window[pos - win_start].type == TUBTFE_LLVM_FN);
+        uint64_t i = pos + 1;
+        while (true) {
+            for (; i < win_start + window.size(); i++) {
+                if (window[i - win_start].type == TUBTFE_LLVM_FN) goto found;
+            }
+            if (i == num_rows) break;
+            load_after();
+        }
+found:
+        emit(pos, i, block);
+        pos = i;
+        return true;
+    }
+
+    uint64_t consumed() { return pos; }
+};
+
 static inline void update_progress(uint64_t cur, uint64_t total) {
     double pct = cur / (double)total;
     const int columns = 80;
@@ -938,9 +1342,56 @@ static inline void update_progress(uint64_t cur, uint64_t total) {
     fflush(stdout);
 }
 
+// Read sets of criteria from fname, one set per line, criteria separated by
+// whitespace. Blank lines and lines starting with '#' are skipped.
+static void read_criteria_file(const char *fname,
+        std::vector<std::vector<SliceVar>> &criteria) {
+    FILE *f = fopen(fname, "r");
+    if (!f) {
+        perror(fname);
+        exit(EXIT_FAILURE);
+    }
+    char line[4096];
+    while (fgets(line, sizeof(line), f)) {
+        std::vector<SliceVar> vars;
+        char *save = NULL;
+        for (char *tok = strtok_r(line, " \t\r\n", &save); tok != NULL;
+                tok = strtok_r(NULL, " \t\r\n", &save)) {
+            if (vars.empty() && tok[0] == '#') break;
+            vars.push_back(VarFromStr(tok));
+        }
+        if (!vars.empty()) criteria.push_back(vars);
+    }
+    fclose(f);
+}
+
+static void write_report(const char *fname, MarkMap &marks) {
+    FILE *outf = fopen(fname, "wb");
+    if (!outf) {
+        perror(fname);
+        exit(EXIT_FAILURE);
+    }
+    for (auto &kvp : marks) {
+        uint32_t name_size = 0;
+        uint32_t index = kvp.first.second;
+        uint8_t bytes[MAX_BITSET/8] = {};
+
+        StringRef name = kvp.first.first->getName();
+        name_size = name.size();
+        bits2bytes(kvp.second, bytes);
+
+        fwrite(&name_size, sizeof(uint32_t), 1, outf);
+        fwrite(name.str().c_str(), name_size, 1, outf);
+        fwrite(&index, sizeof(uint32_t), 1, outf);
+        fwrite(bytes, MAX_BITSET / 8, 1, outf);
+    }
+    fclose(outf);
+}
+
 void usage(char *prog) {
-   fprintf(stderr, "Usage: %s [OPTIONS] <llvm_mod> <dynlog> <criterion> [<criterion> ...]\n",
-           prog);
+   fprintf(stderr, "Usage: %s [OPTIONS] <llvm_mod> <dynlog> <criterion> [<criterion> ...]\n"
+                   "       %s [OPTIONS] -c CRITERIA_FILE <llvm_mod> <dynlog>\n",
+           prog, prog);
    fprintf(stderr, "Options:\n"
            "  -b                : include branch conditions in slice\n"
            "  -d                : enable debug output\n"
@@ -948,7 +1399,11 @@ void usage(char *prog) {
            "  -a                : just align, don't slice\n"
            "  -w                : print working set after each block\n"
            "  -n NUM -p PC      : skip ahead to TB NUM-PC\n"
+           "  -i ICOUNT         : skip ahead to guest instruction ICOUNT\n"
+           "  -r                : <dynlog> was reversed with logreverse_mmap\n"
            "  -o OUTPUT         : save results to OUTPUT\n"
+           "  -c CRITERIA_FILE  : slice on each line of CRITERIA_FILE independently,\n"
+           "                      in one pass; results for line N go to OUTPUT.N\n"
            "  <llvm_mod>        : the LLVM bitcode module\n"
            "  <dynlog>          : the TUBT log file\n"
            "  <criterion> ...   : the slicing criteria, i.e., what to slice on\n"
@@ -963,10 +1418,14 @@ int main(int argc, char **argv) {
     unsigned long num, pc;
     bool show_progress = false;
     bool have_num = false, have_pc = false;
+    bool have_icount = false;
+    uint64_t icount = 0;
     bool print_work = false;
     bool align_only = false;
+    bool reversed_log = false;
     const char *output = NULL;
-    while ((opt = getopt(argc, argv, "vawbdn:p:o:")) != -1) {
+    const char *criteria_file = NULL;
+    while ((opt = getopt(argc, argv, "vawbdrn:p:i:o:c:")) != -1) {
         switch (opt) {
         case 'n':
             num = strtoul(optarg, NULL, 10);
@@ -976,6 +1435,10 @@ int main(int argc, char **argv) {
             pc = strtoul(optarg, NULL, 16);
             have_pc = true;
             break;
+        case 'i':
+            icount = strtoull(optarg, NULL, 10);
+            have_icount = true;
+            break;
         case 'd':
             debug = true;
             break;
@@ -988,9 +1451,15 @@ int main(int argc, char **argv) {
         case 'a':
             align_only = true;
             break;
+        case 'r':
+            reversed_log = true;
+            break;
         case 'o':
             output = optarg;
             break;
+        case 'c':
+            criteria_file = optarg;
+            break;
         case 'v':
             show_progress = true;
             break;
@@ -1012,7 +1481,13 @@ int main(int argc, char **argv) {
         exit(EXIT_FAILURE);
     }
     
-    if (optind + 2 >= argc) {
+    if (criteria_file && optind + 2 < argc) {
+        fprintf(stderr, "ERROR: criteria go either on the command line or in -c CRITERIA_FILE.\n");
+        usage(argv[0]);
+        exit(EXIT_FAILURE);
+    }
+
+    if (!criteria_file && optind + 2 >= argc) {
         fprintf(stderr, "WARNING: You did not specify any slicing criteria. This is probably not what you want.\n");
         fprintf(stderr, "Continuing anyway.\n");
     }
@@ -1026,10 +1501,28 @@ int main(int argc, char **argv) {
     char *tubt_log_fname = argv[optind+1];
 
     // Add the slicing criteria
-    std::set<SliceVar> work;
-    for (int i = optind + 2; i < argc; i++) {
-        work.insert(VarFromStr(argv[i]));
+    std::vector<std::vector<SliceVar>> criteria;
+    if (criteria_file) {
+        read_criteria_file(criteria_file, criteria);
+        if (criteria.empty() || criteria.size() > MAX_CRITERIA) {
+            fprintf(stderr, "ERROR: %s has %zu sets of criteria, need 1 to %d.\n",
+                    criteria_file, criteria.size(), MAX_CRITERIA);
+            exit(EXIT_FAILURE);
+        }
+    }
+    else {
+        criteria.resize(1);
+        for (int i = optind + 2; i < argc; i++) {
+            criteria[0].push_back(VarFromStr(argv[i]));
+        }
+    }
+
+    WorkingSet work;
+    for (size_t c = 0; c < criteria.size(); c++) {
+        for (const SliceVar &v : criteria[c])
+            work.insert(SliceRange{v.first, v.second, 1}, 1ULL << c);
     }
+    marked.resize(criteria.size());
 
     struct stat st;
     if (stat(tubt_log_fname, &st) != 0) {
@@ -1037,16 +1530,32 @@ int main(int argc, char **argv) {
         exit(EXIT_FAILURE);
     }
 
-    uint64_t num_rows = (st.st_size - 20) / sizeof(TUBTEntry);
-    int fd = open(tubt_log_fname, O_RDWR|O_LARGEFILE);
-    uint8_t *mapping = (uint8_t *)mmap(NULL, st.st_size, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
-    if (mapping == MAP_FAILED) {
-        perror("mmap");
+    uint64_t num_rows = (st.st_size - TUBT_HEADER_SIZE) / sizeof(TUBTEntry);
+    int fd = open(tubt_log_fname, O_RDONLY|O_LARGEFILE);
+    uint32_t version;
+    if (fd < 0 || pread(fd, &version, sizeof(version), 0) != (ssize_t)sizeof(version)) {
+        perror("open");
         return 1;
     }
+    BlockReader *reader;
+    if (version == TUBTF_VERSION_COLUMNAR) {
+        if (reversed_log) {
+            fprintf(stderr, "ERROR: -r doesn't apply to columnar logs.\n");
+            exit(EXIT_FAILURE);
+        }
+        ColumnarLogReader *cr = ColumnarLogReader::open(fd, st.st_size);
+        if (!cr) {
+            fprintf(stderr, "ERROR: %s has no chunk index; was the trace closed properly?\n", tubt_log_fname);
+            exit(EXIT_FAILURE);
+        }
+        num_rows = cr->total_rows();
+        reader = cr;
+    }
+    else if (reversed_log) reader = new ReversedLogReader(fd, num_rows);
+    else reader = new ForwardLogReader(fd, num_rows);
 
-    TUBTEntry *rows = (TUBTEntry *)(mapping + 20);
-    TUBTEntry *endp = rows + num_rows;
+    // llvm_trace puts the guest instruction count in arg3 of each block
+    if (have_icount) reader->seek_instr(icount);
 
     LLVMContext &ctx = getGlobalContext();
 
@@ -1055,15 +1564,22 @@ int main(int argc, char **argv) {
 
     Module *mod = ParseIRFile(llvm_mod_fname, err, ctx);
 
-    TUBTEntry *cursor = rows;
+    std::vector<TUBTEntry> block;
+    std::vector<trace_entry> aligned_block;
+    bool have_block = reader->next(block);
+    if (have_icount) {
+        while (have_block && block[0].arg3 > icount)
+            have_block = reader->next(block);
+    }
     if (have_pc) {
-        while (!(cursor->type == TUBTFE_LLVM_FN && cursor->pc == pc && cursor->arg1 == num)) cursor++;
+        while (have_block && !(block[0].pc == pc && block[0].arg1 == num))
+            have_block = reader->next(block);
     }
 
-    uint64_t rows_processed = 0;
-
+    CriteriaMask live = work.live();
     printf("Slicing trace...\n");
-    while (cursor != endp) {
+    for (; have_block; have_block = reader->next(block)) {
+        TUBTEntry *cursor = &block[0];
         assert (cursor->type == TUBTFE_LLVM_FN);
         char namebuf[128];
         sprintf(namebuf, "tcg-llvm-tb-%llu-%llx", cursor->arg1, cursor->pc);
@@ -1078,49 +1594,47 @@ int main(int argc, char **argv) {
 
         // Get the aligned trace of this block
         in_exception = false; // reset this in case the last function ended with an exception
-        std::vector<trace_entry> aligned_block;
+        aligned_block.clear();
         cursor = process_func(f, cursor, aligned_block);
+        assert(cursor == &block.back());
 
         // And slice it
-        if (!align_only) slice_trace(aligned_block, work);
+        if (!align_only) slice_trace(aligned_block, work, live);
 
         if (print_work) printf("Working set: ");
-        if (print_work) print_set(work);
+        if (print_work) work.print();
 
-        rows_processed = cursor - rows;
-        if (show_progress) update_progress(rows_processed, num_rows);
+        if (show_progress) update_progress(reader->consumed(), num_rows);
 
-        if (work.empty() && !align_only) {
+        CriteriaMask still_live = work.live();
+        if (debug && still_live != live)
+            printf("Done with criteria %" PRIx64 ".\n", live & ~still_live);
+        live = still_live;
+        if (!live && !align_only) {
             printf("\n");
             printf("Note: working set is empty, will stop slicing.\n");
             break;
         }
     }
+    delete reader;
+    close(fd);
 
     printf("\n");
 
-    uint64_t insns_marked = 0;
-    for (auto &kvp : marked) insns_marked += kvp.second.count();
-    printf("Done slicing. Marked %lu blocks, %llu instructions.\n", marked.size(), insns_marked);
-
-    // Write slice report
-    FILE *outf = fopen(output, "wb");
-    for (auto &kvp : marked) {
-        uint32_t name_size = 0;
-        uint32_t index = kvp.first.second;
-        uint8_t bytes[MAX_BITSET/8] = {};
+    for (size_t c = 0; c < criteria.size(); c++) {
+        uint64_t insns_marked = 0;
+        for (auto &kvp : marked[c]) insns_marked += count_bits(kvp.second);
 
-        StringRef name = kvp.first.first->getName();
-        name_size = name.size();
-        bits2bytes(kvp.second, bytes);
-
-        fwrite(&name_size, sizeof(uint32_t), 1, outf);
-        fwrite(name.str().c_str(), name_size, 1, outf);
-        fwrite(&index, sizeof(uint32_t), 1, outf);
-        fwrite(bytes, MAX_BITSET / 8, 1, outf);
+        // Write slice report
+        std::string fname = output;
+        if (criteria_file) {
+            fname += "." + std::to_string(c);
+            printf("Criteria %zu: ", c);
+        }
+        printf("Done slicing. Marked %lu blocks, %llu instructions.\n", marked[c].size(), insns_marked);
+        write_report(fname.c_str(), marked[c]);
+        printf("Wrote slicing results to %s\n", fname.c_str());
     }
-    fclose(outf);
-    printf("Wrote slicing results to %s\n", output);
 
     return 0;
 }
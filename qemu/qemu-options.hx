@@ -377,6 +377,17 @@ STEXI
 Allocate guest RAM from a temporarily created file in @var{path}.
 ETEXI
 
+DEF("mem-shared", HAS_ARG, QEMU_OPTION_mem_shared,
+    "-mem-shared FILE keep guest RAM in FILE, shared with other processes\n",
+    QEMU_ARCH_ALL)
+STEXI
+@item -mem-shared @var{file}
+Allocate guest RAM in @var{file} (e.g. under /dev/shm), mapped shared, so
+that introspection tools can map it read-only. Each RAM block sits at its
+ram_addr offset in the file; the pmemaccess socket reports where guest
+physical addresses fall.
+ETEXI
+
 #ifdef MAP_POPULATE
 DEF("mem-prealloc", 0, QEMU_OPTION_mem_prealloc,
     "-mem-prealloc   preallocate guest memory (use with -mem-path)\n",
@@ -2609,6 +2620,10 @@ DEF("record-from", HAS_ARG, QEMU_OPTION_record_from,
     "-record-from <snapshot>\n"
     "                load snapshot <snapshot> and begin recording\n", QEMU_ARCH_ALL)
 
+DEF("record-base", HAS_ARG, QEMU_OPTION_record_base,
+    "-record-base <recording>\n"
+    "                store new recordings' snapshot RAM against <recording>'s\n", QEMU_ARCH_ALL)
+
 DEF("replay", HAS_ARG, QEMU_OPTION_replay,
     "-replay <snapshot>\n"
     "                replay the recording that starts at <snapshot>\n", QEMU_ARCH_ALL)
@@ -2630,6 +2645,10 @@ DEF("panda", HAS_ARG, QEMU_OPTION_panda_plugins,
     "               load <plugin1> with <opt1=val1> and <opt2=val2>; load <plugin2>\n"
     "               uses qemubuilddir/panda_plugins/panda_%s.so by default\n", QEMU_ARCH_ALL)
 
+DEF("panda-profile", 0, QEMU_OPTION_panda_profile,
+    "-panda-profile  count calls and CPU ticks of each plugin callback, reported\n"
+    "                at exit and by the panda_profile monitor command\n", QEMU_ARCH_ALL)
+
 DEF("os", HAS_ARG, QEMU_OPTION_panda_os_name,
     "-os os_name\n"
     "               inform panda about guest operating system\n", QEMU_ARCH_ALL)
@@ -2025,3 +2025,31 @@ EQMP
         .args_type  = "",
         .mhandler.cmd_new = qmp_marshal_input_end_replay,
     },
+
+SQMP
+panda_profile
+-------------
+
+Report time spent in PANDA plugin callbacks. QEMU must have been started
+with -panda-profile.
+
+Arguments:
+
+- "reset": zero the counters after reporting (json-bool, optional)
+
+Example:
+
+-> { "execute": "panda_profile" }
+<- { "return": { "ticks": 81234567890,
+                 "callbacks": [ { "plugin": "taint2.so",
+                                  "callback": "before_block_exec",
+                                  "ppp": false, "calls": 1520394,
+                                  "ticks": 914025117 } ] } }
+
+EQMP
+
+    {
+        .name       = "panda_profile",
+        .args_type  = "reset:b?",
+        .mhandler.cmd_new = qmp_marshal_input_panda_profile,
+    },
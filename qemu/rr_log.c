@@ -33,6 +33,8 @@
 #include <sys/stat.h>
 #include <sys/resource.h>
 #include <sys/time.h>
+#include <sys/mman.h>
+#include <fcntl.h>
 #include <unistd.h>
 
 #include <libgen.h>
@@ -41,7 +43,9 @@
 #include "qmp-commands.h"
 #include "hmp.h"
 #include "sysemu.h"
+#include "migration.h"
 #include "rr_log.h"
+#include "rr_pack.h"
 
 #include "panda_plugin.h"
 #include "pandalog.h"
@@ -57,6 +61,13 @@ volatile RR_mode rr_mode = RR_OFF;
 RR_log_entry *rr_queue_head;
 RR_log_entry *rr_queue_tail;
 
+// packed recording being replayed, if any (see rr_pack.h)
+static RR_pack *rr_replay_pack = NULL;
+
+//mz SMP: vCPU the log follows, and (record) where its current slice ends
+CPUState *rr_cpu = NULL;
+uint64_t rr_cpu_slice_end = 0;
+
 //mz 11.06.2009 Flags to manage nested recording
 volatile sig_atomic_t rr_record_in_progress = 0;
 volatile sig_atomic_t rr_skipped_callsite_location = 0;
@@ -91,8 +102,10 @@ volatile sig_atomic_t rr_replay_requested = 0;
 volatile sig_atomic_t rr_record_requested = 0;
 volatile sig_atomic_t rr_end_record_requested = 0;
 volatile sig_atomic_t rr_end_replay_requested = 0;
+volatile uint64_t rr_pause_at_instr_count = 0;
 char * rr_requested_name = NULL;
 char * rr_snapshot_name  = NULL;
+const char *rr_record_base_name = NULL;
 
 //
 //mz Other useful things
@@ -120,8 +133,8 @@ uint8_t rr_replay_finished(void) {
 //mz "performance" counters - basically, how much of the log is taken up by
 //mz each kind of entry. 
 #ifdef RR_STATS
-volatile unsigned long long rr_number_of_log_entries[RR_LAST];
-volatile unsigned long long rr_size_of_log_entries[RR_LAST];
+volatile unsigned long long rr_number_of_log_entries[RR_NUM_LOG_ENTRY_KINDS];
+volatile unsigned long long rr_size_of_log_entries[RR_NUM_LOG_ENTRY_KINDS];
 #endif
 volatile unsigned long long rr_max_num_queue_entries;
 
@@ -180,6 +193,9 @@ static void rr_spit_log_entry(RR_log_entry item) {
         case RR_DEBUG:
             printf("\tRR_DEBUG\n");
             break;
+        case RR_CPU_SWITCH:
+            printf("\tRR_CPU_SWITCH to cpu %u\n", item.variant.cpu_index);
+            break;
         default:
             printf("\tUNKNOWN RR log kind %d\n", item.header.kind);
             break;
@@ -247,6 +263,239 @@ inline void rr_assert_fail(const char *exp, const char *file, int line, const ch
     /* NOT REACHED */
 }
 
+/******************************************************************************************/
+/* PAYLOAD STORE */
+/******************************************************************************************/
+
+// In record, chunks are appended to the store and indexed by content hash. In
+// replay, the whole store is mapped read-only and references are resolved
+// against the mapping. Chunks are shared by every entry that references them,
+// so buffers a consumer may write to are always copied out (see
+// rr_read_payload).
+typedef struct {
+    uint64_t hash;
+    uint64_t offset;
+} RR_payload_chunk;
+
+static struct {
+    int fd;
+    uint64_t size;
+    GHashTable *chunks;     // hash -> RR_payload_chunk, record only
+    uint8_t *map;           // replay only
+    uint64_t bytes_in;      // payload bytes seen / referenced
+    uint64_t bytes_stored;  // of which written to the store
+} rr_payload_store = { .fd = -1 };
+
+char *rr_get_payload_file_name(const char *nondet_log_name) {
+    const char *suffix = "-rr-nondet.log";
+    size_t len = strlen(nondet_log_name);
+    size_t slen = strlen(suffix);
+    if (len >= slen && strcmp(nondet_log_name + len - slen, suffix) == 0) {
+        return g_strdup_printf("%.*s-rr-payload", (int)(len - slen), nondet_log_name);
+    }
+    return g_strdup_printf("%s.payload", nondet_log_name);
+}
+
+static uint64_t rr_payload_hash(const uint8_t *p, uint64_t len) {
+    uint64_t h = 0x9e3779b97f4a7c15ULL ^ len;
+    uint64_t i, w;
+    for (i = 0; i + 8 <= len; i += 8) {
+        memcpy(&w, p + i, 8);
+        h = (h ^ w) * 0xff51afd7ed558ccdULL;
+        h ^= h >> 32;
+    }
+    for (; i < len; i++) {
+        h = (h ^ p[i]) * 0x100000001b3ULL;
+    }
+    return h ^ (h >> 29);
+}
+
+static void rr_payload_store_open_record(const char *nondet_log_name) {
+    char *name = rr_get_payload_file_name(nondet_log_name);
+    rr_payload_store.fd = open(name, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    rr_assert(rr_payload_store.fd >= 0);
+    g_free(name);
+    rr_payload_store.size = 0;
+    rr_payload_store.bytes_in = 0;
+    rr_payload_store.bytes_stored = 0;
+    rr_payload_store.chunks = g_hash_table_new_full(g_int64_hash, g_int64_equal,
+            NULL, g_free);
+}
+
+// A missing or empty store is fine as long as the log never references it.
+static void rr_payload_store_open_replay(const char *nondet_log_name) {
+    struct stat statbuf = {0};
+    char *name;
+    if (rr_replay_pack) {
+        rr_payload_store.bytes_in = 0;
+        rr_payload_store.size = 0;
+        rr_payload_store.map = rr_pack_map(rr_replay_pack, RR_PACK_PAYLOAD,
+                &rr_payload_store.size);
+        // rr_pack_map refuses empty members; those count as absent
+        rr_assert(rr_payload_store.map != NULL ||
+                rr_pack_member_size(rr_replay_pack, RR_PACK_PAYLOAD) == 0);
+        return;
+    }
+    name = rr_get_payload_file_name(nondet_log_name);
+    rr_payload_store.fd = open(name, O_RDONLY);
+    g_free(name);
+    rr_payload_store.bytes_in = 0;
+    if (rr_payload_store.fd < 0) return;
+
+    rr_assert(fstat(rr_payload_store.fd, &statbuf) == 0);
+    rr_payload_store.size = statbuf.st_size;
+    if (rr_payload_store.size > 0) {
+        rr_payload_store.map = mmap(NULL, rr_payload_store.size,
+                PROT_READ, MAP_PRIVATE, rr_payload_store.fd, 0);
+        rr_assert(rr_payload_store.map != MAP_FAILED);
+    }
+}
+
+static void rr_payload_store_close(void) {
+    if (rr_payload_store.map) {
+        munmap(rr_payload_store.map, rr_payload_store.size);
+        rr_payload_store.map = NULL;
+    }
+    if (rr_payload_store.chunks) {
+        g_hash_table_destroy(rr_payload_store.chunks);
+        rr_payload_store.chunks = NULL;
+    }
+    if (rr_payload_store.fd >= 0) {
+        close(rr_payload_store.fd);
+        rr_payload_store.fd = -1;
+    }
+}
+
+// Offset of a chunk with these contents in the store, appending it if it
+// isn't there yet. Hash hits are checked against the stored bytes.
+static uint64_t rr_payload_store_put(const uint8_t *p, uint64_t len) {
+    uint64_t hash = rr_payload_hash(p, len);
+    RR_payload_chunk *chunk = g_hash_table_lookup(rr_payload_store.chunks, &hash);
+    if (chunk) {
+        uint8_t stored[RR_PAYLOAD_CHUNK];
+        if (pread(rr_payload_store.fd, stored, len, chunk->offset) == (ssize_t)len
+                && memcmp(stored, p, len) == 0) {
+            return chunk->offset;
+        }
+    }
+
+    uint64_t offset = rr_payload_store.size;
+    uint64_t done = 0;
+    while (done < len) {
+        ssize_t n = pwrite(rr_payload_store.fd, p + done, len - done, offset + done);
+        rr_assert(n > 0);
+        done += n;
+    }
+    rr_payload_store.size += len;
+    rr_payload_store.bytes_stored += len;
+
+    // On a (real) hash collision the first chunk keeps the entry.
+    if (!chunk) {
+        chunk = g_new(RR_payload_chunk, 1);
+        chunk->hash = hash;
+        chunk->offset = offset;
+        g_hash_table_insert(rr_payload_store.chunks, &chunk->hash, chunk);
+    }
+    return offset;
+}
+
+static inline bool rr_payload_use_ref(uint64_t len) {
+    return rr_payload_store.fd >= 0 && len >= RR_PAYLOAD_MIN_REF;
+}
+
+// Write a payload buffer to the log, inline or as chunk references.
+static void rr_write_payload(const uint8_t *buf, uint64_t len, bool ref) {
+    if (!ref) {
+        fwrite(buf, 1, len, rr_nondet_log->fp);
+        return;
+    }
+    uint64_t i;
+    rr_payload_store.bytes_in += len;
+    for (i = 0; i < len; i += RR_PAYLOAD_CHUNK) {
+        uint64_t n = MIN(len - i, RR_PAYLOAD_CHUNK);
+        uint64_t offset = rr_payload_store_put(buf + i, n);
+        fwrite(&offset, sizeof(offset), 1, rr_nondet_log->fp);
+    }
+}
+
+// Read a payload buffer from the log. Referenced payloads whose chunks are
+// contiguous in the store (the usual case for data seen for the first time)
+// are used in place, unless the buffer is handed to code that may write to
+// it (writable); others are gathered into a fresh buffer.
+static uint8_t *rr_read_payload(uint64_t len, bool ref, bool writable,
+        RR_skipped_call_args *args) {
+    uint8_t *buf;
+    if (!ref) {
+        buf = g_malloc(len);
+        rr_assert(len == 0 || fread(buf, 1, len, rr_nondet_log->fp) == len);
+        rr_nondet_log->bytes_read += len;
+        return buf;
+    }
+
+    uint64_t nchunks = rr_payload_num_chunks(len);
+    uint64_t *offsets = g_new(uint64_t, nchunks);
+    rr_assert(fread(offsets, sizeof(uint64_t), nchunks, rr_nondet_log->fp) == nchunks);
+    rr_nondet_log->bytes_read += nchunks * sizeof(uint64_t);
+    rr_assert(rr_payload_store.map != NULL);
+    rr_assert(offsets[nchunks - 1] + len - (nchunks - 1) * RR_PAYLOAD_CHUNK
+            <= rr_payload_store.size);
+    rr_payload_store.bytes_in += len;
+
+    uint64_t i;
+    bool contiguous = true;
+    for (i = 1; i < nchunks; i++) {
+        if (offsets[i] != offsets[0] + i * RR_PAYLOAD_CHUNK) {
+            contiguous = false;
+            break;
+        }
+    }
+    if (contiguous && !writable) {
+        buf = rr_payload_store.map + offsets[0];
+        args->buf_in_store = 1;
+    } else {
+        buf = g_malloc(len);
+        for (i = 0; i < nchunks; i++) {
+            rr_assert(offsets[i] + RR_PAYLOAD_CHUNK <= rr_payload_store.size
+                    || i == nchunks - 1);
+            memcpy(buf + i * RR_PAYLOAD_CHUNK, rr_payload_store.map + offsets[i],
+                    MIN(len - i * RR_PAYLOAD_CHUNK, RR_PAYLOAD_CHUNK));
+        }
+    }
+    g_free(offsets);
+    return buf;
+}
+
+void rr_copy_payload_store(const char *dest_nondet_log_name) {
+    char *src = rr_get_payload_file_name(rr_nondet_log->name);
+    char *dest = rr_get_payload_file_name(dest_nondet_log_name);
+    unlink(dest);
+    if (rr_replay_pack) {
+        // the store is a member of the pack; write out the mapped copy
+        if (rr_payload_store.map) {
+            FILE *out = fopen(dest, "w");
+            rr_assert(out);
+            rr_assert(fwrite(rr_payload_store.map, 1, rr_payload_store.size, out)
+                    == rr_payload_store.size);
+            fclose(out);
+        }
+    }
+    else if (access(src, F_OK) == 0 && link(src, dest) != 0) {
+        // Different file system, probably; copy it.
+        FILE *in = fopen(src, "r");
+        FILE *out = fopen(dest, "w");
+        char buf[1 << 16];
+        size_t n;
+        rr_assert(in && out);
+        while ((n = fread(buf, 1, sizeof(buf), in)) > 0) {
+            rr_assert(fwrite(buf, 1, n, out) == n);
+        }
+        fclose(in);
+        fclose(out);
+    }
+    g_free(src);
+    g_free(dest);
+}
+
 /******************************************************************************************/
 /* RECORD */
 /******************************************************************************************/
@@ -286,11 +535,28 @@ static inline void rr_write_item(void) {
         case RR_EXIT_REQUEST:
             fwrite(&(item->variant.exit_request), sizeof(item->variant.exit_request), 1, rr_nondet_log->fp);
             break;
+        case RR_CPU_SWITCH:
+            fwrite(&(item->variant.cpu_index), sizeof(item->variant.cpu_index), 1, rr_nondet_log->fp);
+            break;
         case RR_SKIPPED_CALL:
             {
                 RR_skipped_call_args *args = &item->variant.call_args;
+                uint8_t kind = args->kind;
+                bool ref = false;
+                switch (args->kind) {
+                    case RR_CALL_CPU_MEM_RW:
+                        ref = rr_payload_use_ref(args->variant.cpu_mem_rw_args.len);
+                        break;
+                    case RR_CALL_CPU_MEM_UNMAP:
+                        ref = rr_payload_use_ref(args->variant.cpu_mem_unmap.len);
+                        break;
+                    case RR_CALL_HANDLE_PACKET:
+                        ref = rr_payload_use_ref(args->variant.handle_packet_args.size);
+                        break;
+                }
+                if (ref) kind |= RR_CALL_PAYLOAD_REF;
                 //mz write kind first!
-                fwrite(&(args->kind), sizeof(args->kind), 1, rr_nondet_log->fp);
+                fwrite(&kind, sizeof(kind), 1, rr_nondet_log->fp);
                 switch (args->kind) {
                     case RR_CALL_CPU_MEM_RW:
                         rr_assert(args->variant.cpu_mem_rw_args.buf != NULL || 
@@ -299,8 +565,8 @@ static inline void rr_write_item(void) {
 			       sizeof(args->variant.cpu_mem_rw_args), 
 			       1, rr_nondet_log->fp);
                         //mz write the buffer
-                        fwrite(args->variant.cpu_mem_rw_args.buf, 1, 
-			       args->variant.cpu_mem_rw_args.len, rr_nondet_log->fp);
+                        rr_write_payload(args->variant.cpu_mem_rw_args.buf,
+                                args->variant.cpu_mem_rw_args.len, ref);
                         break;
                     case RR_CALL_CPU_MEM_UNMAP:
                         //bdg same deal as RR_CALL_CPU_MEM_RW
@@ -308,8 +574,8 @@ static inline void rr_write_item(void) {
                                 args->variant.cpu_mem_unmap.len == 0);
                         fwrite(&(args->variant.cpu_mem_unmap),
 			       sizeof(args->variant.cpu_mem_unmap), 1, rr_nondet_log->fp);
-                        fwrite(args->variant.cpu_mem_unmap.buf, 1, 
-			       args->variant.cpu_mem_unmap.len, rr_nondet_log->fp);
+                        rr_write_payload(args->variant.cpu_mem_unmap.buf,
+                                args->variant.cpu_mem_unmap.len, ref);
                         break;
                     case RR_CALL_CPU_REG_MEM_REGION:
                         fwrite(&(args->variant.cpu_mem_reg_region_args), 
@@ -329,8 +595,8 @@ static inline void rr_write_item(void) {
                         fwrite(&(args->variant.handle_packet_args), 
 			       sizeof(args->variant.handle_packet_args), 1, rr_nondet_log->fp);
                         //mz write the buffer
-                        fwrite(args->variant.handle_packet_args.buf, 1, 
-			       args->variant.handle_packet_args.size, rr_nondet_log->fp);
+                        rr_write_payload(args->variant.handle_packet_args.buf,
+                                args->variant.handle_packet_args.size, ref);
                         break;
                     default:
                         //mz unimplemented
@@ -456,6 +722,23 @@ void rr_record_exit_request(RR_callsite_id call_site, uint32_t exit_request) {
     }
 }
 
+//mz record that the log moves on to another vCPU
+void rr_record_cpu_switch(CPUState *next) {
+    RR_log_entry *item = &(rr_nondet_log->current_item);
+    //mz just in case
+    memset(item, 0, sizeof(RR_log_entry));
+
+    item->header.kind = RR_CPU_SWITCH;
+    item->header.callsite_loc = RR_CALLSITE_TCG_EXEC_ALL;
+    //mz prog point is that of the vCPU being switched out
+    item->header.prog_point = rr_prog_point();
+
+    item->variant.cpu_index = next->cpu_index;
+
+    rr_write_item();
+    rr_cpu = next;
+}
+
 //mz record call to cpu_physical_memory_rw() that will need to be replayed.
 //mz only "write" modifications are recorded
 void rr_record_cpu_mem_rw_call(RR_callsite_id call_site,
@@ -611,6 +894,7 @@ static inline void free_entry_params(RR_log_entry *entry)
     //mz cleanup associated resources
     switch (entry->header.kind) {
         case RR_SKIPPED_CALL:
+            if (entry->variant.call_args.buf_in_store) break;
             switch (entry->variant.call_args.kind) {
                 case RR_CALL_CPU_MEM_RW:
                     g_free(entry->variant.call_args.variant.cpu_mem_rw_args.buf);
@@ -750,6 +1034,13 @@ static RR_log_entry *rr_read_item(void) {
 #endif
             rr_nondet_log->bytes_read += sizeof(item->variant.exit_request);
             break;
+        case RR_CPU_SWITCH:
+            rr_assert(fread(&(item->variant.cpu_index), sizeof(item->variant.cpu_index), 1, rr_nondet_log->fp) == 1);
+#ifdef RR_STATS
+            rr_size_of_log_entries[item->header.kind] += sizeof(item->variant.cpu_index);
+#endif
+            rr_nondet_log->bytes_read += sizeof(item->variant.cpu_index);
+            break;
         case RR_SKIPPED_CALL:
             {
                 RR_skipped_call_args *args = &item->variant.call_args;
@@ -759,6 +1050,8 @@ static RR_log_entry *rr_read_item(void) {
                 rr_size_of_log_entries[item->header.kind] += sizeof(args->kind);
 #endif
                 rr_nondet_log->bytes_read += sizeof(args->kind);
+                bool ref = args->kind & RR_CALL_PAYLOAD_REF;
+                args->kind &= ~RR_CALL_PAYLOAD_REF;
                 switch(args->kind) {
                     case RR_CALL_CPU_MEM_RW:
                         rr_assert(fread(&(args->variant.cpu_mem_rw_args), sizeof(args->variant.cpu_mem_rw_args), 1, rr_nondet_log->fp) == 1);
@@ -768,13 +1061,12 @@ static RR_log_entry *rr_read_item(void) {
                         rr_nondet_log->bytes_read += sizeof(args->variant.cpu_mem_rw_args);
                         //mz buffer length in args->variant.cpu_mem_rw_args.len
                         //mz always allocate a new one. we free it when the item is added to the recycle list
-                        args->variant.cpu_mem_rw_args.buf = g_malloc(args->variant.cpu_mem_rw_args.len);
                         //mz read the buffer
-                        rr_assert(fread(args->variant.cpu_mem_rw_args.buf, 1, args->variant.cpu_mem_rw_args.len, rr_nondet_log->fp) > 0);
+                        args->variant.cpu_mem_rw_args.buf = rr_read_payload(
+                                args->variant.cpu_mem_rw_args.len, ref, false, args);
 #ifdef RR_STATS
                         rr_size_of_log_entries[item->header.kind] += args->variant.cpu_mem_rw_args.len;
 #endif
-                        rr_nondet_log->bytes_read += args->variant.cpu_mem_rw_args.len;
                         break;
                     case RR_CALL_CPU_MEM_UNMAP:
                         rr_assert(fread(&(args->variant.cpu_mem_unmap), sizeof(args->variant.cpu_mem_unmap), 1, rr_nondet_log->fp) == 1);
@@ -782,12 +1074,11 @@ static RR_log_entry *rr_read_item(void) {
                         rr_size_of_log_entries[item->header.kind] += sizeof(args->variant.cpu_mem_unmap);
 #endif
                         rr_nondet_log->bytes_read += sizeof(args->variant.cpu_mem_unmap);
-                        args->variant.cpu_mem_unmap.buf = g_malloc(args->variant.cpu_mem_unmap.len);
-                        rr_assert(fread(args->variant.cpu_mem_unmap.buf, 1, args->variant.cpu_mem_unmap.len, rr_nondet_log->fp) > 0);
+                        args->variant.cpu_mem_unmap.buf = rr_read_payload(
+                                args->variant.cpu_mem_unmap.len, ref, false, args);
 #ifdef RR_STATS
                         rr_size_of_log_entries[item->header.kind] += args->variant.cpu_mem_unmap.len;
 #endif
-                        rr_nondet_log->bytes_read += args->variant.cpu_mem_unmap.len;
                         break;
 
                     case RR_CALL_CPU_REG_MEM_REGION:
@@ -828,16 +1119,13 @@ static RR_log_entry *rr_read_item(void) {
 			args->old_buf_addr = (uint64_t) args->variant.handle_packet_args.buf;
 			//mz buffer length in args->variant.cpu_mem_rw_args.len 
 			//mz always allocate a new one. we free it when the item is added to the recycle list
-			args->variant.handle_packet_args.buf = 
-			  g_malloc(args->variant.handle_packet_args.size);
 			//mz read the buffer 
-			assert (fread(args->variant.handle_packet_args.buf, 
-				      args->variant.handle_packet_args.size, 1,
-                                      rr_nondet_log->fp) == 1 /*> 0*/);
+			// replay_handle_packet callbacks get a writable buffer
+			args->variant.handle_packet_args.buf = rr_read_payload(
+                                args->variant.handle_packet_args.size, ref, true, args);
 #ifdef RR_STATS
 			rr_size_of_log_entries[item->header.kind] += args->variant.handle_packet_args.size;
 #endif
-                        rr_nondet_log->bytes_read += args->variant.handle_packet_args.size;
 			break;
 
                     default:
@@ -885,7 +1173,8 @@ static void rr_fill_queue(void) {
         RR_log_entry entry = *log_entry;
         if ((entry.header.kind == RR_SKIPPED_CALL
                     && entry.header.callsite_loc == RR_CALLSITE_MAIN_LOOP_WAIT)
-                || entry.header.kind == RR_INTERRUPT_REQUEST) {
+                || entry.header.kind == RR_INTERRUPT_REQUEST
+                || entry.header.kind == RR_CPU_SWITCH) {
             break;
         }
 
@@ -1126,6 +1415,32 @@ void rr_replay_exit_request(RR_callsite_id call_site, uint32_t *exit_request) {
     }
 }
 
+bool rr_replay_cpu_switch(void) {
+    RR_log_entry *current_item;
+    CPUState *env;
+
+    if (rr_queue_head == NULL || rr_queue_head->header.kind != RR_CPU_SWITCH) {
+        return false;
+    }
+    current_item = get_next_entry(RR_CPU_SWITCH, RR_CALLSITE_TCG_EXEC_ALL, true);
+    if (current_item == NULL) {
+        return false;
+    }
+    for (env = first_cpu; env != NULL; env = env->next_cpu) {
+        if (env->cpu_index == current_item->variant.cpu_index) break;
+    }
+    if (env == NULL) {
+        printf("Log switches to cpu %u, which the guest doesn't have\n",
+                current_item->variant.cpu_index);
+        rr_assert(env != NULL);
+    }
+    rr_cpu = env;
+    add_to_recycle_list(current_item);
+    //mz as with interrupts, fill the queue up to the next stopping point
+    rr_fill_queue();
+    return true;
+}
+
 //bdg Externs for replaying skipped calls
 // FIXME: We want the real prototypes here at some point (with correct target address sizes)
 //        I guess that will require figuring out how to rebuild this for each target?
@@ -1196,7 +1511,7 @@ void rr_replay_skipped_calls_internal(RR_callsite_id call_site) {
                         // run all callbacks registered for hd transfer
                         RR_hd_transfer_args hdt = args.variant.hd_transfer_args;
                         panda_cb_list *plist;
-                        for (plist = panda_cbs[PANDA_CB_REPLAY_HD_TRANSFER]; plist != NULL; plist = panda_cb_list_next(plist)) {
+                        for (plist = panda_cb_list_first(PANDA_CB_REPLAY_HD_TRANSFER); plist != NULL; plist = panda_cb_list_next(plist)) {
                             plist->entry.replay_hd_transfer
                                 (cpu_single_env,
                                  hdt.type,
@@ -1212,7 +1527,7 @@ void rr_replay_skipped_calls_internal(RR_callsite_id call_site) {
                         // run all callbacks registered for packet handling
                         RR_handle_packet_args hp = args.variant.handle_packet_args;
                         panda_cb_list *plist;
-                        for (plist = panda_cbs[PANDA_CB_REPLAY_HANDLE_PACKET]; plist != NULL; plist = panda_cb_list_next(plist)) {
+                        for (plist = panda_cb_list_first(PANDA_CB_REPLAY_HANDLE_PACKET); plist != NULL; plist = panda_cb_list_next(plist)) {
                             plist->entry.replay_handle_packet
                                 (cpu_single_env,
                                  hp.buf,
@@ -1231,7 +1546,7 @@ void rr_replay_skipped_calls_internal(RR_callsite_id call_site) {
                         RR_net_transfer_args nta =
                             args.variant.net_transfer_args;
                         panda_cb_list *plist;
-                        for (plist = panda_cbs[PANDA_CB_REPLAY_NET_TRANSFER];
+                        for (plist = panda_cb_list_first(PANDA_CB_REPLAY_NET_TRANSFER);
                                 plist != NULL; plist = panda_cb_list_next(plist)) {
                             plist->entry.replay_net_transfer
                                 (cpu_single_env,
@@ -1287,10 +1602,20 @@ void rr_create_record_log (const char *filename) {
   //This way, when we print progress, we can use something better than size of log consumed
   //(as that can jump //sporadically).
   fwrite(&(rr_nondet_log->last_prog_point), sizeof(RR_prog_point), 1, rr_nondet_log->fp);
+
+  rr_payload_store_open_record(filename);
 }
 
 
 // create replay log
+// A new stream over the log being replayed, positioned at its start.
+FILE *rr_reopen_replay_log(void) {
+  if (rr_replay_pack) {
+    return rr_pack_fopen(rr_replay_pack, RR_PACK_NONDET);
+  }
+  return fopen(rr_nondet_log->name, "r");
+}
+
 void rr_create_replay_log (const char *filename) {
   struct stat statbuf = {0};
   // create log
@@ -1299,12 +1624,16 @@ void rr_create_replay_log (const char *filename) {
 
   rr_nondet_log->type = REPLAY;
   rr_nondet_log->name = g_strdup(filename);
-  rr_nondet_log->fp = fopen(rr_nondet_log->name, "r");
+  rr_nondet_log->fp = rr_reopen_replay_log();
   rr_assert(rr_nondet_log->fp != NULL);
 
   //mz fill in log size
-  stat(rr_nondet_log->name, &statbuf);
-  rr_nondet_log->size = statbuf.st_size;
+  if (rr_replay_pack) {
+    rr_nondet_log->size = rr_pack_member_size(rr_replay_pack, RR_PACK_NONDET);
+  } else {
+    stat(rr_nondet_log->name, &statbuf);
+    rr_nondet_log->size = statbuf.st_size;
+  }
   rr_nondet_log->bytes_read = 0;
   if (rr_debug_whisper()) {
     fprintf (logfile, "opened %s for read.  len=%llu bytes.\n",
@@ -1313,6 +1642,8 @@ void rr_create_replay_log (const char *filename) {
   //mz read the last program point from the log header.
   rr_assert(fread(&(rr_nondet_log->last_prog_point), sizeof(RR_prog_point), 1, rr_nondet_log->fp) == 1);
   rr_nondet_log->bytes_read += sizeof(RR_prog_point);
+
+  rr_payload_store_open_replay(filename);
 }
 
 
@@ -1327,6 +1658,20 @@ void rr_destroy_log(void) {
     fclose(rr_nondet_log->fp);
     rr_nondet_log->fp = NULL;
   }
+  if (rr_payload_store.bytes_in > 0) {
+    if (rr_nondet_log->type == RECORD) {
+      printf("Payload store: %" PRIu64 " bytes of payload, %" PRIu64 " bytes stored.\n",
+             rr_payload_store.bytes_in, rr_payload_store.bytes_stored);
+    } else {
+      printf("Payload store: %" PRIu64 " bytes of payload read from %" PRIu64 " byte store.\n",
+             rr_payload_store.bytes_in, rr_payload_store.size);
+    }
+  }
+  rr_payload_store_close();
+  if (rr_replay_pack) {
+    rr_pack_close(rr_replay_pack);
+    rr_replay_pack = NULL;
+  }
   g_free(rr_nondet_log->name);
   g_free(rr_nondet_log);
   rr_nondet_log = NULL;
@@ -1422,12 +1767,17 @@ static void rr_get_cmdline_file_name(char *rr_name, char *rr_path, char *file_na
 
 
 void rr_reset_state(void *cpu_state) {
+    CPUState *env;
     // set flag to signal that we'll be needing the tb flushed. 
     rr_flush_tb_on();
     // clear flags
     rr_record_in_progress = 0;
     rr_skipped_callsite_location = 0;
-    rr_clear_rr_guest_instr_count(cpu_state);
+    // the count is summed over all vCPUs; start each of them at 0
+    for (env = first_cpu; env != NULL; env = env->next_cpu) {
+        rr_clear_rr_guest_instr_count(env);
+    }
+    rr_cpu = NULL;
 }
 
 
@@ -1516,6 +1866,36 @@ static time_t rr_start_time;
 extern int gargc;
 extern char **gargv;
 
+#ifdef CONFIG_SOFTMMU
+// Store the new snapshot's RAM image against that of an earlier recording
+// (-record-base), unpacked or packed, so the pages they share are kept once.
+static void rr_set_ram_base(const char *base_name) {
+  char *ram_name = g_strdup_printf("%s-rr-snp.ram", base_name);
+  char *pack_name = g_strdup_printf("%s.rr", base_name);
+  struct stat st;
+  int fd = open(ram_name, O_RDONLY);
+  if (fd >= 0) {
+    fstat(fd, &st);
+    ram_set_external_base(fd, 0, st.st_size);
+  } else if (rr_pack_is_packed(pack_name)) {
+    RR_pack *pack = rr_pack_open(pack_name);
+    int pack_fd;
+    uint64_t offset;
+    if (pack && rr_pack_member_location(pack, RR_PACK_RAM, &pack_fd, &offset)) {
+      ram_set_external_base(dup(pack_fd), offset,
+                            rr_pack_member_size(pack, RR_PACK_RAM));
+    } else {
+      printf("%s has no usable RAM image; not using it as a base\n", pack_name);
+    }
+    if (pack) rr_pack_close(pack);
+  } else {
+    printf("%s not found; not using it as a base\n", ram_name);
+  }
+  g_free(ram_name);
+  g_free(pack_name);
+}
+#endif
+
 //mz file_name_full should be full path to desired record/replay log file
 int rr_do_begin_record(const char *file_name_full, void *cpu_state) {
 #ifdef CONFIG_SOFTMMU 
@@ -1544,6 +1924,9 @@ int rr_do_begin_record(const char *file_name_full, void *cpu_state) {
   if (rr_record_requested  == 1 || rr_record_requested == 2) {
     rr_get_snapshot_file_name(rr_name, rr_path, name_buf, sizeof(name_buf));
     printf ("writing snapshot:\t%s\n", name_buf);
+    if (rr_record_base_name) {
+      rr_set_ram_base(rr_record_base_name);
+    }
     snapshot_ret = do_savevm_rr(get_monitor(), name_buf);
     if (snapshot_ret != 0){
         printf("Failed to save VM state! Aborting recording. Code: %d\n", snapshot_ret);
@@ -1630,6 +2013,25 @@ int rr_do_begin_replay(const char *file_name_full, void *cpu_state) {
     fprintf (logfile,"Begin vm replay for file_name_full = %s\n", file_name_full);    
     fprintf (logfile,"path = [%s]  file_name_base = [%s]\n", rr_path, rr_name);
   }
+  // a packed recording (<name>.rr) is read in place
+  {
+    char *pack_name = g_strdup_printf("%s.rr", file_name_full);
+    rr_get_nondet_log_file_name(rr_name, rr_path, name_buf, sizeof(name_buf));
+    if (rr_pack_is_packed(file_name_full)) {
+      g_free(pack_name);
+      pack_name = g_strdup(file_name_full);
+    }
+    else if (access(name_buf, F_OK) == 0 || !rr_pack_is_packed(pack_name)) {
+      g_free(pack_name);
+      pack_name = NULL;
+    }
+    if (pack_name) {
+      printf ("opening packed recording %s\n", pack_name);
+      rr_replay_pack = rr_pack_open(pack_name);
+      rr_assert(rr_replay_pack != NULL);
+      g_free(pack_name);
+    }
+  }
   // first retrieve snapshot
   rr_get_snapshot_file_name(rr_name, rr_path, name_buf, sizeof(name_buf));
   if (rr_debug_whisper()) {
@@ -1638,11 +2040,22 @@ int rr_do_begin_replay(const char *file_name_full, void *cpu_state) {
   printf ("loading snapshot\n");
   //  vm_stop(0) RUN_STATE_RESTORE_VM);
     panda_cb_list *plist;
-    for(plist = panda_cbs[PANDA_CB_BEFORE_REPLAY_LOADVM]; plist != NULL;
+    for(plist = panda_cb_list_first(PANDA_CB_BEFORE_REPLAY_LOADVM); plist != NULL;
             plist = panda_cb_list_next(plist)) {
         plist->entry.before_loadvm();
     }
-  snapshot_ret = load_vmstate_rr(name_buf);
+  if (rr_replay_pack) {
+    FILE *snp = rr_pack_fopen(rr_replay_pack, RR_PACK_SNAPSHOT);
+    int ram_fd = -1;
+    uint64_t ram_offset = 0;
+    rr_assert(snp != NULL);
+    if (rr_pack_has_member(rr_replay_pack, RR_PACK_RAM)) {
+      rr_assert(rr_pack_member_location(rr_replay_pack, RR_PACK_RAM, &ram_fd, &ram_offset));
+    }
+    snapshot_ret = load_vmstate_rr_stream(snp, ram_fd, ram_offset);
+  } else {
+    snapshot_ret = load_vmstate_rr(name_buf);
+  }
   // If the loadvm failed, fail
   /*if (0 != snapshot_ret){
       // TODO: free rr_path and rr_name
@@ -1689,11 +2102,17 @@ void rr_do_end_replay(int is_error) {
     time_t rr_end_time;
     time(&rr_end_time);
     printf("Time taken was: %ld seconds.\n", rr_end_time - rr_start_time);
+    printf("TBs translated: %" PRIu64 "\n", tb_gen_count);
+    {
+        struct rusage rusage;
+        getrusage(RUSAGE_SELF, &rusage);
+        printf("Peak RSS: %ld kB\n", rusage.ru_maxrss);
+    }
     
 #ifdef RR_STATS
     int i;
     printf ("Stats:\n");
-    for (i = 0; i < RR_LAST; i++) {
+    for (i = 0; i < RR_NUM_LOG_ENTRY_KINDS; i++) {
         printf("%s number = %llu, size = %llu bytes\n", get_log_entry_kind_string(i), 
                 rr_number_of_log_entries[i], rr_size_of_log_entries[i]);
         rr_number_of_log_entries[i] = 0;
@@ -79,6 +79,8 @@ typedef struct {
     } variant;
     //mz XXX HACK 
   uint64_t old_buf_addr;
+  // payload buffer points into the mapped payload store; don't free it
+  uint8_t buf_in_store;
 } RR_skipped_call_args;
 
 // an item in a program-point indexed record/replay log
@@ -100,6 +102,8 @@ typedef struct rr_log_entry_t {
         uint16_t exit_request;
         // if log_entry.kind == RR_SKIPPED_CALL
         RR_skipped_call_args call_args;
+        // if log_entry.kind == RR_CPU_SWITCH
+        uint32_t cpu_index;
         // if log_entry.kind == RR_LAST
         // no variant fields
     } variant;
@@ -132,27 +136,68 @@ void panda_end_replay(void);
 
 extern CPUState *first_cpu;
 extern RR_log_entry *rr_queue_tail;
+
+//mz SMP: all vCPUs run on the one TCG thread, so record/replay only has to
+//reproduce the order in which they were run.  The log follows one vCPU at a
+//time; RR_CPU_SWITCH entries mark the points where it moves on to the next.
+//In record a vCPU is switched out once it has run for RR_SMP_QUANTUM
+//instructions (checked at TB boundaries), or when it halts or exits.
+#define RR_SMP_QUANTUM 100000
+
+// vCPU the log currently follows. NULL means first_cpu.
+extern CPUState *rr_cpu;
+// record: guest instruction count at which the current slice is over
+extern uint64_t rr_cpu_slice_end;
+
+static inline CPUState *rr_get_cpu(void) {
+    return rr_cpu ? rr_cpu : first_cpu;
+}
+
+static inline bool rr_smp(void) {
+    return first_cpu && first_cpu->next_cpu;
+}
+
+// The log's time axis: instructions retired by all vCPUs together.
 static inline uint64_t rr_get_guest_instr_count(void) {
+    CPUState *env;
+    uint64_t count;
     assert(first_cpu);
-    return first_cpu->rr_guest_instr_count;
+    count = first_cpu->rr_guest_instr_count;
+    for (env = first_cpu->next_cpu; env != NULL; env = env->next_cpu) {
+        count += env->rr_guest_instr_count;
+    }
+    return count;
 }
 
 //mz program execution state
 static inline RR_prog_point rr_prog_point(void) {
     RR_prog_point ret = {0};
-    assert(first_cpu);
+    CPUState *env = rr_get_cpu();
+    assert(env);
 
 #ifdef TARGET_I386
-    ret.pc = first_cpu->eip;
-    ret.secondary = first_cpu->regs[R_ECX];
+    ret.pc = env->eip;
+    ret.secondary = env->regs[R_ECX];
 #else
-    ret.pc = panda_current_pc(first_cpu);
+    ret.pc = panda_current_pc(env);
     ret.secondary = 0;
 #endif
     ret.guest_instr_count = rr_get_guest_instr_count();
     return ret;
 }
 
+void rr_record_cpu_switch(CPUState *next);
+// true if the log switches away from the current vCPU at this point
+bool rr_replay_cpu_switch(void);
+
+static inline void rr_begin_cpu_slice(void) {
+    rr_cpu_slice_end = rr_get_guest_instr_count() + RR_SMP_QUANTUM;
+}
+
+static inline bool rr_cpu_slice_expired(void) {
+    return rr_smp() && rr_get_guest_instr_count() >= rr_cpu_slice_end;
+}
+
 static inline uint64_t rr_num_instr_before_next_interrupt(void) {
     if (!rr_queue_tail) {
         return -1;
@@ -165,6 +210,7 @@ static inline uint64_t rr_num_instr_before_next_interrupt(void) {
             } // otherwise fall through
         case RR_LAST:
         case RR_INTERRUPT_REQUEST:
+        case RR_CPU_SWITCH:
             return last.header.prog_point.guest_instr_count -
                 rr_get_guest_instr_count();
         default:
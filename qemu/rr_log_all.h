@@ -44,6 +44,28 @@ void rr_create_replay_log (const char *filename);
 void rr_destroy_log(void);
 uint8_t rr_replay_finished(void);
 
+// Payload store. DMA and packet payloads of at least RR_PAYLOAD_MIN_REF bytes
+// are split into RR_PAYLOAD_CHUNK-byte chunks, and each distinct chunk is
+// written once to a side file next to the nondet log (<name>-rr-payload).
+// The log entry then has RR_CALL_PAYLOAD_REF set in its skipped call kind and
+// carries one uint64_t store offset per chunk instead of the bytes.
+#define RR_CALL_PAYLOAD_REF 0x80
+#define RR_PAYLOAD_CHUNK 4096
+#define RR_PAYLOAD_MIN_REF 512
+
+static inline uint64_t rr_payload_num_chunks(uint64_t len) {
+    return (len + RR_PAYLOAD_CHUNK - 1) / RR_PAYLOAD_CHUNK;
+}
+
+// caller frees
+char *rr_get_payload_file_name(const char *nondet_log_name);
+// make the payload store of the log being replayed available to another log
+// (for scissors)
+void rr_copy_payload_store(const char *dest_nondet_log_name);
+// a fresh stream over the nondet log being replayed (which may live in a
+// packed recording), positioned at its start
+FILE *rr_reopen_replay_log(void);
+
 //mz Flags set by monitor to indicate requested record/replay action
 extern volatile int rr_replay_requested;
 extern volatile int rr_record_requested;
@@ -51,6 +73,10 @@ extern volatile int rr_end_record_requested;
 extern volatile int rr_end_replay_requested;
 extern char *rr_requested_name;
 extern char *rr_snapshot_name;
+extern const char *rr_record_base_name;
+// pause the replay once this many instructions have run (0 = don't); set
+// by memory-access.c
+extern volatile uint64_t rr_pause_at_instr_count;
 
 // used from monitor.c 
 int  rr_do_begin_record(const char *name, void *cpu_state);
@@ -131,10 +157,12 @@ static inline const char *get_skipped_call_kind_string(RR_skipped_call_kind kind
         return NULL;
 }
 
-// Log entries come in 3 different flavors:
+// Log entries come in 4 different flavors:
 // - IO input (1, 2, 4 and 8 bytes)
 // - interrupt request (value is stored only when non-zero)
 // - skipped call (as described above)
+// - vCPU switch (SMP guests only): entries that follow belong to the vCPU
+//   with the given index.  Absent a switch, entries belong to the first vCPU.
 
 typedef enum {
     RR_INPUT_1,
@@ -145,7 +173,10 @@ typedef enum {
     RR_EXIT_REQUEST,
     RR_SKIPPED_CALL,
     RR_DEBUG,
-    RR_LAST
+    RR_LAST,
+    // kinds added after RR_LAST so that older logs keep their encoding
+    RR_CPU_SWITCH,
+    RR_NUM_LOG_ENTRY_KINDS
 } RR_log_entry_kind;
 
 static const char *log_entry_kind_str[] = {
@@ -157,12 +188,13 @@ static const char *log_entry_kind_str[] = {
     "RR_EXIT_REQUEST",
     "RR_SKIPPED_CALL",
     "RR_DEBUG",
-    "RR_LAST"
+    "RR_LAST",
+    "RR_CPU_SWITCH"
 };
 
 static inline const char *get_log_entry_kind_string(RR_log_entry_kind kind)
 {
-    if (kind <= RR_LAST)
+    if (kind < RR_NUM_LOG_ENTRY_KINDS)
         return log_entry_kind_str[kind];
     else
         return NULL;
@@ -240,6 +272,9 @@ typedef enum {
   RR_CALLSITE_E1000_TXDESC_WRITEBACK,
   RR_CALLSITE_E1000_START_XMIT,
   RR_CALLSITE_LAST,
+  // Call sites are stored in recordings by number: add new ones here, after
+  // RR_CALLSITE_LAST, so that no existing id changes.
+  RR_CALLSITE_TCG_EXEC_ALL,
 } RR_callsite_id;
 
 static const char *callsite_str[] = {
@@ -311,13 +346,14 @@ static const char *callsite_str[] = {
   "RR_CALLSITE_E1000_PROCESS_TX_DESC_MEMMOVE_2",
   "RR_CALLSITE_E1000_TXDESC_WRITEBACK",
   "RR_CALLSITE_E1000_START_XMIT",
-  "RR_CALLSITE_LAST"
+  "RR_CALLSITE_LAST",
+  "RR_CALLSITE_TCG_EXEC_ALL"
 };
 
 
 static inline const char *get_callsite_string(RR_callsite_id cid)
 {
-    if (cid <= RR_CALLSITE_LAST)
+    if (cid < sizeof(callsite_str) / sizeof(callsite_str[0]))
         return callsite_str[cid];
     else
         return NULL;
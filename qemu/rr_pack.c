@@ -0,0 +1,363 @@
+/*
+ * Record and Replay for QEMU: packed recordings
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE  // fopencookie
+#endif
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <errno.h>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <zlib.h>
+#include <glib.h>
+
+#include "rr_pack.h"
+
+// The format is little-endian and so are all hosts we record on; the
+// structures are read as they are.
+
+struct RR_pack {
+    char *file_name;
+    int fd;
+    uint64_t file_size;
+    uint64_t num_instructions;
+    uint32_t chunk_size;
+    uint32_t num_members;
+    RR_pack_member *members;
+    RR_pack_chunk **index;      // per member, loaded on open
+};
+
+typedef struct {
+    RR_pack *pack;
+    uint32_t member;
+    uint64_t pos;
+    int64_t cur_chunk;          // chunk held in buf, -1 if none
+    uint8_t *buf;
+    uint32_t buf_len;
+    uint8_t *zbuf;
+} RR_pack_stream;
+
+static bool read_at(int fd, void *buf, uint64_t len, uint64_t offset) {
+    uint64_t done = 0;
+    while (done < len) {
+        ssize_t n = pread(fd, (uint8_t *)buf + done, len - done, offset + done);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return false;
+        done += n;
+    }
+    return true;
+}
+
+bool rr_pack_is_packed(const char *file_name) {
+    char magic[8];
+    bool ret = false;
+    FILE *fp = fopen(file_name, "rb");
+    if (!fp) return false;
+    if (fread(magic, sizeof(magic), 1, fp) == 1) {
+        ret = memcmp(magic, RR_PACK_MAGIC, sizeof(magic)) == 0;
+    }
+    fclose(fp);
+    return ret;
+}
+
+static int rr_pack_find(RR_pack *pack, const char *name) {
+    uint32_t i;
+    for (i = 0; i < pack->num_members; i++) {
+        if (strncmp(pack->members[i].name, name, sizeof(pack->members[i].name)) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+RR_pack *rr_pack_open(const char *file_name) {
+    uint8_t header[RR_PACK_HEADER_SIZE];
+    struct stat statbuf;
+    uint32_t version, crc, stored_crc, i;
+    RR_pack *pack = g_new0(RR_pack, 1);
+
+    pack->file_name = g_strdup(file_name);
+    pack->fd = open(file_name, O_RDONLY);
+    if (pack->fd < 0 || fstat(pack->fd, &statbuf) != 0) {
+        printf("%s: can't open packed recording: %s\n", file_name, strerror(errno));
+        goto fail;
+    }
+    pack->file_size = statbuf.st_size;
+
+    if (!read_at(pack->fd, header, sizeof(header), 0)) {
+        printf("%s: truncated header\n", file_name);
+        goto fail;
+    }
+    if (memcmp(header, "PANDA_RR", 8) == 0) {
+        printf("%s: tar.xz recording from an older rrpack.py; "
+               "use scripts/rrunpack.py to unpack it\n", file_name);
+        goto fail;
+    }
+    if (memcmp(header, RR_PACK_MAGIC, 8) != 0) {
+        printf("%s: not a packed recording\n", file_name);
+        goto fail;
+    }
+    memcpy(&version, header + 0x08, 4);
+    memcpy(&pack->num_members, header + 0x0c, 4);
+    memcpy(&pack->num_instructions, header + 0x10, 8);
+    memcpy(&pack->chunk_size, header + 0x20, 4);
+    memcpy(&stored_crc, header + 0x24, 4);
+    if (version != RR_PACK_VERSION) {
+        printf("%s: unsupported version %u\n", file_name, version);
+        goto fail;
+    }
+    if (pack->chunk_size == 0 ||
+            (uint64_t)pack->num_members * sizeof(RR_pack_member) > pack->file_size) {
+        printf("%s: bad header\n", file_name);
+        goto fail;
+    }
+
+    pack->members = g_new0(RR_pack_member, pack->num_members);
+    if (!read_at(pack->fd, pack->members,
+                pack->num_members * sizeof(RR_pack_member), RR_PACK_HEADER_SIZE)) {
+        printf("%s: truncated member table\n", file_name);
+        goto fail;
+    }
+    memset(header + 0x24, 0, 4);
+    crc = crc32(0, header, sizeof(header));
+    crc = crc32(crc, (const Bytef *)pack->members,
+            pack->num_members * sizeof(RR_pack_member));
+    if (crc != stored_crc) {
+        printf("%s: header checksum mismatch\n", file_name);
+        goto fail;
+    }
+
+    pack->index = g_new0(RR_pack_chunk *, pack->num_members);
+    for (i = 0; i < pack->num_members; i++) {
+        RR_pack_member *m = &pack->members[i];
+        uint64_t expected = (m->size + pack->chunk_size - 1) / pack->chunk_size;
+        if (m->num_chunks != expected ||
+                m->num_chunks * sizeof(RR_pack_chunk) > pack->file_size) {
+            printf("%s: bad index for member %.16s\n", file_name, m->name);
+            goto fail;
+        }
+        pack->index[i] = g_new(RR_pack_chunk, m->num_chunks);
+        if (!read_at(pack->fd, pack->index[i], m->num_chunks * sizeof(RR_pack_chunk),
+                    m->index_offset)) {
+            printf("%s: truncated index for member %.16s\n", file_name, m->name);
+            goto fail;
+        }
+    }
+    return pack;
+
+fail:
+    rr_pack_close(pack);
+    return NULL;
+}
+
+void rr_pack_close(RR_pack *pack) {
+    uint32_t i;
+    if (!pack) return;
+    if (pack->index) {
+        for (i = 0; i < pack->num_members; i++) {
+            g_free(pack->index[i]);
+        }
+        g_free(pack->index);
+    }
+    g_free(pack->members);
+    if (pack->fd >= 0) close(pack->fd);
+    g_free(pack->file_name);
+    g_free(pack);
+}
+
+uint64_t rr_pack_num_instructions(RR_pack *pack) {
+    return pack->num_instructions;
+}
+
+bool rr_pack_has_member(RR_pack *pack, const char *name) {
+    return rr_pack_find(pack, name) >= 0;
+}
+
+uint64_t rr_pack_member_size(RR_pack *pack, const char *name) {
+    int m = rr_pack_find(pack, name);
+    return m < 0 ? 0 : pack->members[m].size;
+}
+
+// Uncompressed length of chunk n of member m
+static uint32_t chunk_len(RR_pack *pack, RR_pack_member *m, uint64_t n) {
+    uint64_t start = n * pack->chunk_size;
+    return MIN(m->size - start, pack->chunk_size);
+}
+
+static bool rr_pack_load_chunk(RR_pack_stream *s, uint64_t n) {
+    RR_pack *pack = s->pack;
+    RR_pack_member *m = &pack->members[s->member];
+    RR_pack_chunk *c = &pack->index[s->member][n];
+    uint32_t len = chunk_len(pack, m, n);
+
+    if (m->flags & RR_PACK_COMPRESSED) {
+        uLongf out_len = len;
+        if (c->stored_size > compressBound(pack->chunk_size) ||
+                !read_at(pack->fd, s->zbuf, c->stored_size, c->offset) ||
+                uncompress(s->buf, &out_len, s->zbuf, c->stored_size) != Z_OK ||
+                out_len != len) {
+            printf("%s: can't inflate chunk %" PRIu64 " of %.16s\n",
+                    pack->file_name, n, m->name);
+            return false;
+        }
+    } else if (c->stored_size != len || !read_at(pack->fd, s->buf, len, c->offset)) {
+        printf("%s: can't read chunk %" PRIu64 " of %.16s\n",
+                pack->file_name, n, m->name);
+        return false;
+    }
+    if (crc32(0, s->buf, len) != c->crc) {
+        printf("%s: checksum mismatch in chunk %" PRIu64 " of %.16s\n",
+                pack->file_name, n, m->name);
+        return false;
+    }
+    s->cur_chunk = n;
+    s->buf_len = len;
+    return true;
+}
+
+static ssize_t rr_pack_stream_read(void *cookie, char *buf, size_t size) {
+    RR_pack_stream *s = cookie;
+    RR_pack_member *m = &s->pack->members[s->member];
+    size_t done = 0;
+
+    while (done < size && s->pos < m->size) {
+        uint64_t n = s->pos / s->pack->chunk_size;
+        uint32_t off = s->pos % s->pack->chunk_size;
+        uint32_t avail;
+        if ((int64_t)n != s->cur_chunk && !rr_pack_load_chunk(s, n)) {
+            errno = EIO;
+            return done > 0 ? (ssize_t)done : -1;
+        }
+        avail = MIN(s->buf_len - off, size - done);
+        memcpy(buf + done, s->buf + off, avail);
+        done += avail;
+        s->pos += avail;
+    }
+    return done;
+}
+
+static int rr_pack_stream_seek(void *cookie, off64_t *offset, int whence) {
+    RR_pack_stream *s = cookie;
+    int64_t base;
+    switch (whence) {
+        case SEEK_SET: base = 0; break;
+        case SEEK_CUR: base = s->pos; break;
+        case SEEK_END: base = s->pack->members[s->member].size; break;
+        default: errno = EINVAL; return -1;
+    }
+    if (base + *offset < 0) {
+        errno = EINVAL;
+        return -1;
+    }
+    s->pos = base + *offset;
+    *offset = s->pos;
+    return 0;
+}
+
+static int rr_pack_stream_close(void *cookie) {
+    RR_pack_stream *s = cookie;
+    g_free(s->buf);
+    g_free(s->zbuf);
+    g_free(s);
+    return 0;
+}
+
+FILE *rr_pack_fopen(RR_pack *pack, const char *name) {
+    cookie_io_functions_t io = {
+        .read = rr_pack_stream_read,
+        .write = NULL,
+        .seek = rr_pack_stream_seek,
+        .close = rr_pack_stream_close,
+    };
+    RR_pack_stream *s;
+    FILE *fp;
+    int m = rr_pack_find(pack, name);
+    if (m < 0) return NULL;
+
+    s = g_new0(RR_pack_stream, 1);
+    s->pack = pack;
+    s->member = m;
+    s->cur_chunk = -1;
+    s->buf = g_malloc(pack->chunk_size);
+    s->zbuf = g_malloc(compressBound(pack->chunk_size));
+    fp = fopencookie(s, "r", io);
+    if (!fp) {
+        rr_pack_stream_close(s);
+        return NULL;
+    }
+    return fp;
+}
+
+void *rr_pack_map(RR_pack *pack, const char *name, uint64_t *size) {
+    RR_pack_member *m;
+    RR_pack_chunk *index;
+    uint8_t *map;
+    uint64_t i;
+    int n = rr_pack_find(pack, name);
+    if (n < 0) return NULL;
+    m = &pack->members[n];
+    index = pack->index[n];
+    if ((m->flags & RR_PACK_COMPRESSED) || m->size == 0) return NULL;
+    if (index[0].offset % getpagesize() != 0 ||
+            index[0].offset + m->size > pack->file_size) {
+        printf("%s: member %.16s can't be mapped\n", pack->file_name, m->name);
+        return NULL;
+    }
+
+    map = mmap(NULL, m->size, PROT_READ, MAP_PRIVATE,
+            pack->fd, index[0].offset);
+    if (map == MAP_FAILED) return NULL;
+    // raw chunks are contiguous; check them all once up front
+    for (i = 0; i < m->num_chunks; i++) {
+        uint32_t len = chunk_len(pack, m, i);
+        if (index[i].offset != index[0].offset + i * pack->chunk_size ||
+                index[i].stored_size != len ||
+                crc32(0, map + i * pack->chunk_size, len) != index[i].crc) {
+            printf("%s: checksum mismatch in chunk %" PRIu64 " of %.16s\n",
+                    pack->file_name, i, m->name);
+            munmap(map, m->size);
+            return NULL;
+        }
+    }
+    *size = m->size;
+    return map;
+}
+
+bool rr_pack_member_location(RR_pack *pack, const char *name, int *fd, uint64_t *offset) {
+    RR_pack_member *m;
+    RR_pack_chunk *index;
+    uint64_t i;
+    int n = rr_pack_find(pack, name);
+    if (n < 0) return false;
+    m = &pack->members[n];
+    index = pack->index[n];
+    if ((m->flags & RR_PACK_COMPRESSED) || m->size == 0) return false;
+    if (index[0].offset % getpagesize() != 0 ||
+            index[0].offset + m->size > pack->file_size) {
+        return false;
+    }
+    for (i = 0; i < m->num_chunks; i++) {
+        if (index[i].offset != index[0].offset + i * pack->chunk_size ||
+                index[i].stored_size != chunk_len(pack, m, i)) {
+            return false;
+        }
+    }
+    *fd = pack->fd;
+    *offset = index[0].offset;
+    return true;
+}
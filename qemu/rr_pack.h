@@ -0,0 +1,93 @@
+/*
+ * Record and Replay for QEMU: packed recordings
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ */
+
+#ifndef __RR_PACK_H_
+#define __RR_PACK_H_
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// A packed recording (<name>.rr) holds everything needed to replay in one
+// file, which replay reads in place. All integers are little-endian.
+//
+// 0x00: magic "PANDARR2"
+// 0x08: uint32_t version (1)
+// 0x0c: uint32_t number of members
+// 0x10: uint64_t guest instructions in the recording
+// 0x18: uint64_t creation time (seconds since the epoch)
+// 0x20: uint32_t chunk size
+// 0x24: uint32_t CRC-32 of header and member table, with this field zeroed
+// 0x28: member table, RR_pack_member each
+//
+// Each member (snapshot, nondet log, ...) is split into chunk-size pieces,
+// stored either zlib-compressed or raw. The member's index has one
+// RR_pack_chunk per piece, so any offset can be reached by inflating at
+// most one chunk, and every chunk is checked against its CRC-32 when read.
+// Raw members start on a page boundary so they can be mapped.
+//
+// scripts/rrpack.py writes these; scripts/rrunpack.py extracts them.
+
+#define RR_PACK_MAGIC "PANDARR2"
+#define RR_PACK_VERSION 1
+#define RR_PACK_HEADER_SIZE 0x28
+
+#define RR_PACK_COMPRESSED 1
+
+// member names
+#define RR_PACK_SNAPSHOT "snp"
+#define RR_PACK_NONDET "nondet"
+#define RR_PACK_PAYLOAD "payload"
+#define RR_PACK_CMDLINE "cmd"
+#define RR_PACK_RAM "ram"
+
+typedef struct {
+    char name[16];
+    uint32_t flags;
+    uint32_t reserved;
+    uint64_t size;          // uncompressed
+    uint64_t index_offset;  // RR_pack_chunk[num_chunks]
+    uint64_t num_chunks;
+} __attribute__((packed)) RR_pack_member;
+
+typedef struct {
+    uint64_t offset;
+    uint32_t stored_size;
+    uint32_t crc;           // of the uncompressed chunk
+} __attribute__((packed)) RR_pack_chunk;
+
+typedef struct RR_pack RR_pack;
+
+// true if file_name looks like a packed recording (by its magic)
+bool rr_pack_is_packed(const char *file_name);
+
+// Returns NULL (and says why) if the file can't be used.
+RR_pack *rr_pack_open(const char *file_name);
+void rr_pack_close(RR_pack *pack);
+
+uint64_t rr_pack_num_instructions(RR_pack *pack);
+bool rr_pack_has_member(RR_pack *pack, const char *name);
+uint64_t rr_pack_member_size(RR_pack *pack, const char *name);
+
+// A read-only, seekable stdio stream over a member. Chunks are inflated as
+// they are read. Each stream keeps its own position; the pack must outlive
+// its streams.
+FILE *rr_pack_fopen(RR_pack *pack, const char *name);
+
+// Map a raw member read-only. Returns NULL if the member is missing, empty
+// or compressed.
+void *rr_pack_map(RR_pack *pack, const char *name, uint64_t *size);
+
+// Where a raw member's data starts in the pack, for callers that map it
+// themselves and only touch what they need. Its chunks are not checked
+// against their CRCs. Returns false if the member is missing, compressed
+// or not contiguous.
+bool rr_pack_member_location(RR_pack *pack, const char *name, int *fd, uint64_t *offset);
+
+#endif
@@ -6,6 +6,7 @@
 #define RR_LOG_STANDALONE
 #include "cpu.h"
 #include "rr_log.h"
+#include "rr_pack.h"
 
 /******************************************************************************************/
 /* GLOBALS */
@@ -111,6 +112,9 @@ static void rr_spit_log_entry(RR_log_entry item) {
         case RR_DEBUG:
             printf("\tRR_DEBUG\n");
             break;
+        case RR_CPU_SWITCH:
+            printf("\tRR_CPU_SWITCH to cpu %u\n", item.variant.cpu_index);
+            break;
         default:
             printf("\tUNKNOWN RR log kind %d\n", item.header.kind);
             break;
@@ -199,11 +203,17 @@ static RR_log_entry *rr_read_item(void) {
         case RR_EXIT_REQUEST:
             assert(fread(&(item->variant.exit_request), sizeof(item->variant.exit_request), 1, rr_nondet_log->fp) == 1);
             break;
+        case RR_CPU_SWITCH:
+            assert(fread(&(item->variant.cpu_index), sizeof(item->variant.cpu_index), 1, rr_nondet_log->fp) == 1);
+            break;
         case RR_SKIPPED_CALL:
             {
                 RR_skipped_call_args *args = &item->variant.call_args;
                 //mz read kind first!
                 assert(fread(&(args->kind), sizeof(args->kind), 1, rr_nondet_log->fp) == 1);
+                // Payloads in the store leave just their chunk offsets here.
+                bool ref = args->kind & RR_CALL_PAYLOAD_REF;
+                args->kind &= ~RR_CALL_PAYLOAD_REF;
                 switch(args->kind) {
                     case RR_CALL_CPU_MEM_RW:
                         assert(fread(&(args->variant.cpu_mem_rw_args), sizeof(args->variant.cpu_mem_rw_args), 1, rr_nondet_log->fp) == 1);
@@ -212,7 +222,9 @@ static RR_log_entry *rr_read_item(void) {
                         //args->variant.cpu_mem_rw_args.buf = g_malloc(args->variant.cpu_mem_rw_args.len);
                         //mz read the buffer
                         //assert(fread(args->variant.cpu_mem_rw_args.buf, 1, args->variant.cpu_mem_rw_args.len, rr_nondet_log->fp) > 0);
-                        fseek(rr_nondet_log->fp, args->variant.cpu_mem_rw_args.len, SEEK_CUR);
+                        fseek(rr_nondet_log->fp, ref ?
+                              rr_payload_num_chunks(args->variant.cpu_mem_rw_args.len) * sizeof(uint64_t) :
+                              args->variant.cpu_mem_rw_args.len, SEEK_CUR);
                         break;
                     case RR_CALL_CPU_MEM_UNMAP:
                         assert(fread(&(args->variant.cpu_mem_unmap), sizeof(args->variant.cpu_mem_unmap), 1, rr_nondet_log->fp) == 1);
@@ -221,7 +233,9 @@ static RR_log_entry *rr_read_item(void) {
                         //args->variant.cpu_mem_unmap.buf = g_malloc(args->variant.cpu_mem_unmap.len);
                         //mz read the buffer
                         //assert(fread(args->variant.cpu_mem_unmap.buf, 1, args->variant.cpu_mem_unmap.len, rr_nondet_log->fp) > 0);
-                        fseek(rr_nondet_log->fp, args->variant.cpu_mem_unmap.len, SEEK_CUR);
+                        fseek(rr_nondet_log->fp, ref ?
+                              rr_payload_num_chunks(args->variant.cpu_mem_unmap.len) * sizeof(uint64_t) :
+                              args->variant.cpu_mem_unmap.len, SEEK_CUR);
                         break;
                     case RR_CALL_CPU_REG_MEM_REGION:
                         assert(fread(&(args->variant.cpu_mem_reg_region_args), 
@@ -234,8 +248,9 @@ static RR_log_entry *rr_read_item(void) {
                     case RR_CALL_HANDLE_PACKET:
                         assert(fread(&(args->variant.handle_packet_args),
                               sizeof(args->variant.handle_packet_args), 1, rr_nondet_log->fp) == 1);
-                        fseek(rr_nondet_log->fp,
-                            args->variant.handle_packet_args.size, SEEK_CUR);
+                        fseek(rr_nondet_log->fp, ref ?
+                              rr_payload_num_chunks(args->variant.handle_packet_args.size) * sizeof(uint64_t) :
+                              args->variant.handle_packet_args.size, SEEK_CUR);
                         break;
                     case RR_CALL_NET_TRANSFER:
                         assert(fread(&(args->variant.net_transfer_args),
@@ -270,12 +285,21 @@ void rr_create_replay_log (const char *filename) {
 
   rr_nondet_log->type = REPLAY;
   rr_nondet_log->name = g_strdup(filename);
-  rr_nondet_log->fp = fopen(rr_nondet_log->name, "r");
-  assert(rr_nondet_log->fp != NULL);
+  if (rr_pack_is_packed(filename)) {
+    // the pack stays open until we exit
+    RR_pack *pack = rr_pack_open(filename);
+    assert(pack != NULL);
+    rr_nondet_log->fp = rr_pack_fopen(pack, RR_PACK_NONDET);
+    assert(rr_nondet_log->fp != NULL);
+    rr_nondet_log->size = rr_pack_member_size(pack, RR_PACK_NONDET);
+  } else {
+    rr_nondet_log->fp = fopen(rr_nondet_log->name, "r");
+    assert(rr_nondet_log->fp != NULL);
 
-  //mz fill in log size
-  stat(rr_nondet_log->name, &statbuf);
-  rr_nondet_log->size = statbuf.st_size;
+    //mz fill in log size
+    stat(rr_nondet_log->name, &statbuf);
+    rr_nondet_log->size = statbuf.st_size;
+  }
   if (rr_debug_whisper()) {
     fprintf (stdout, "opened %s for read.  len=%llu bytes.\n",
 	     rr_nondet_log->name, rr_nondet_log->size);
@@ -2270,36 +2270,58 @@ void do_savevm(Monitor *mon, const QDict *qdict) {
   do_savevm_aux(mon, name);
 }
 
+/* RAM goes to <name>.ram, which replay maps rather than reads (see
+   ram_set_external).  It is written under a temporary name so replays
+   still mapping an older image are not disturbed. */
 int do_savevm_rr(Monitor *mon, const char *name) {
-    int ret;
+    int ret, ram_fd;
     QEMUFile *f;
+    char *ram_name = g_strdup_printf("%s.ram", name);
+    char *ram_tmp_name = g_strdup_printf("%s.ram.tmp", name);
 
     /* save the VM state */
     f = qemu_fopen(name, "wb");
     if (!f) {
         error_report("Could not open VM state file\n");
-        return -1;
+        ret = -1;
+        goto out;
+    }
+    ram_fd = open(ram_tmp_name, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (ram_fd < 0) {
+        error_report("Could not open RAM image %s: %s\n", ram_tmp_name,
+                     strerror(errno));
+        qemu_fclose(f);
+        ret = -1;
+        goto out;
     }
+    ram_set_external(ram_fd, 0);
     ret = qemu_savevm_state(mon, f);
+    ram_set_external(-1, 0);
     qemu_fclose(f);
+    close(ram_fd);
     if (ret < 0) {
         monitor_printf(mon, "Error %d while writing VM\n", ret);
-        return -2;
+        unlink(ram_tmp_name);
+        ret = -2;
+        goto out;
     }
-    return 0;
+    if (rename(ram_tmp_name, ram_name) != 0) {
+        error_report("Could not rename RAM image to %s: %s\n", ram_name,
+                     strerror(errno));
+        ret = -2;
+        goto out;
+    }
+    ret = 0;
+out:
+    g_free(ram_name);
+    g_free(ram_tmp_name);
+    return ret;
 }
 
 // Just implement vmstate loading (don't apply block dev snapshots)
-int load_vmstate_rr(const char *name) {
-    QEMUFile *f;
+static int load_vmstate_rr_file(QEMUFile *f) {
     int ret;
 
-    f = qemu_fopen(name, "rb");
-    if (!f) {
-        error_report("Could not open VM state file");
-        return -EINVAL;
-    }
-
     qemu_system_reset(VMRESET_SILENT);
     ret = qemu_loadvm_state(f);
 
@@ -2311,6 +2333,46 @@ int load_vmstate_rr(const char *name) {
     return 0;
 }
 
+/* Snapshots written by do_savevm_rr have their RAM in <name>.ram; older
+   ones carry it in the stream. */
+int load_vmstate_rr(const char *name) {
+    QEMUFile *f;
+    int ret, ram_fd;
+    char *ram_name;
+
+    f = qemu_fopen(name, "rb");
+    if (!f) {
+        error_report("Could not open VM state file");
+        return -EINVAL;
+    }
+    ram_name = g_strdup_printf("%s.ram", name);
+    ram_fd = open(ram_name, O_RDONLY);
+    g_free(ram_name);
+    ram_set_external(ram_fd, 0);
+    ret = load_vmstate_rr_file(f);
+    ram_set_external(-1, 0);
+    if (ram_fd >= 0) {
+        close(ram_fd);
+    }
+    return ret;
+}
+
+/* Load a record/replay snapshot from a seekable stdio stream (e.g. a member
+   of a packed recording).  The stream is closed.  Its RAM image, if it has
+   one, is at ram_offset in ram_fd (-1 if there is none). */
+int load_vmstate_rr_stream(FILE *fp, int ram_fd, uint64_t ram_offset) {
+    QEMUFileStdio *s = g_malloc0(sizeof(QEMUFileStdio));
+    int ret;
+
+    s->stdio_file = fp;
+    s->file = qemu_fopen_ops(s, NULL, file_get_buffer, stdio_fclose,
+                             NULL, NULL, NULL);
+    ram_set_external(ram_fd, ram_offset);
+    ret = load_vmstate_rr_file(s->file);
+    ram_set_external(-1, 0);
+    return ret;
+}
+
 int load_vmstate(const char *name)
 {
     BlockDriverState *bs, *bs_vm_state;
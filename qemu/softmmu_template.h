@@ -134,14 +134,17 @@ DATA_TYPE REGPARM glue(glue(__ld, SUFFIX), MMUSUFFIX)(target_ulong addr,
 
 #ifdef MMU_INSTR
 
+    // lets a before-read callback restart the instruction
+    env->panda_mem_retaddr = GETPC();
+
     // newer version
     panda_cb_list *plist;
-    for(plist = panda_cbs[PANDA_CB_VIRT_MEM_BEFORE_READ]; plist != NULL;
+    for(plist = panda_cb_list_first(PANDA_CB_VIRT_MEM_BEFORE_READ); plist != NULL;
             plist = panda_cb_list_next(plist)) {
         plist->entry.virt_mem_before_read(env, env->panda_guest_pc, addr,
             DATA_SIZE);
     }
-    for(plist = panda_cbs[PANDA_CB_PHYS_MEM_BEFORE_READ]; plist != NULL;
+    for(plist = panda_cb_list_first(PANDA_CB_PHYS_MEM_BEFORE_READ); plist != NULL;
             plist = panda_cb_list_next(plist)) {
         plist->entry.phys_mem_before_read(env, env->panda_guest_pc,
             cpu_get_phys_addr(env, addr), DATA_SIZE);
@@ -197,24 +200,24 @@ DATA_TYPE REGPARM glue(glue(__ld, SUFFIX), MMUSUFFIX)(target_ulong addr,
 #ifdef MMU_INSTR
     // deprecated versions
     // PANDA instrumentation: memory read
-    for(plist = panda_cbs[PANDA_CB_VIRT_MEM_READ]; plist != NULL;
+    for(plist = panda_cb_list_first(PANDA_CB_VIRT_MEM_READ); plist != NULL;
             plist = panda_cb_list_next(plist)) {
         plist->entry.virt_mem_read(env, env->panda_guest_pc, addr,
             DATA_SIZE, &res);
     }
-    for(plist = panda_cbs[PANDA_CB_PHYS_MEM_READ]; plist != NULL;
+    for(plist = panda_cb_list_first(PANDA_CB_PHYS_MEM_READ); plist != NULL;
             plist = panda_cb_list_next(plist)) {
         plist->entry.phys_mem_read(env, env->panda_guest_pc,
             cpu_get_phys_addr(env, addr), DATA_SIZE, &res);
     }
 
     // newer version
-    for(plist = panda_cbs[PANDA_CB_VIRT_MEM_AFTER_READ]; plist != NULL;
+    for(plist = panda_cb_list_first(PANDA_CB_VIRT_MEM_AFTER_READ); plist != NULL;
             plist = panda_cb_list_next(plist)) {
         plist->entry.virt_mem_after_read(env, env->panda_guest_pc, addr,
             DATA_SIZE, &res);
     }
-    for(plist = panda_cbs[PANDA_CB_PHYS_MEM_AFTER_READ]; plist != NULL;
+    for(plist = panda_cb_list_first(PANDA_CB_PHYS_MEM_AFTER_READ); plist != NULL;
             plist = panda_cb_list_next(plist)) {
         plist->entry.phys_mem_after_read(env, env->panda_guest_pc,
             cpu_get_phys_addr(env, addr), DATA_SIZE, &res);
@@ -278,7 +281,7 @@ static DATA_TYPE glue(glue(slow_ld, SUFFIX), MMUSUFFIX)(target_ulong addr,
     // PANDA instrumentation: memory read
     // rwhelan: redundant?
     /*panda_cb_list *plist;
-    for(plist = panda_cbs[PANDA_CB_VIRT_MEM_READ]; plist != NULL;
+    for(plist = panda_cb_list_first(PANDA_CB_VIRT_MEM_READ); plist != NULL;
             plist = panda_cb_list_next(plist)) {
         plist->entry.virt_mem_read(env, env->panda_guest_pc, addr,
             DATA_SIZE, &res);
@@ -365,24 +368,24 @@ void REGPARM glue(glue(__st, SUFFIX), MMUSUFFIX)(target_ulong addr,
 
     // deprecated version
     panda_cb_list *plist;
-    for(plist = panda_cbs[PANDA_CB_VIRT_MEM_WRITE]; plist != NULL;
+    for(plist = panda_cb_list_first(PANDA_CB_VIRT_MEM_WRITE); plist != NULL;
             plist = panda_cb_list_next(plist)) {
         plist->entry.virt_mem_write(env, env->panda_guest_pc, addr,
             DATA_SIZE, &val);
     }
-    for(plist = panda_cbs[PANDA_CB_PHYS_MEM_WRITE]; plist != NULL;
+    for(plist = panda_cb_list_first(PANDA_CB_PHYS_MEM_WRITE); plist != NULL;
             plist = panda_cb_list_next(plist)) {
         plist->entry.phys_mem_write(env, env->panda_guest_pc,
             cpu_get_phys_addr(env, addr), DATA_SIZE, &val);
     }
 
     // newer version
-    for(plist = panda_cbs[PANDA_CB_VIRT_MEM_BEFORE_WRITE]; plist != NULL;
+    for(plist = panda_cb_list_first(PANDA_CB_VIRT_MEM_BEFORE_WRITE); plist != NULL;
             plist = panda_cb_list_next(plist)) {
         plist->entry.virt_mem_before_write(env, env->panda_guest_pc, addr,
             DATA_SIZE, &val);
     }
-    for(plist = panda_cbs[PANDA_CB_PHYS_MEM_BEFORE_WRITE]; plist != NULL;
+    for(plist = panda_cb_list_first(PANDA_CB_PHYS_MEM_BEFORE_WRITE); plist != NULL;
             plist = panda_cb_list_next(plist)) {
         plist->entry.phys_mem_before_write(env, env->panda_guest_pc,
             cpu_get_phys_addr(env, addr), DATA_SIZE, &val);
@@ -437,12 +440,12 @@ void REGPARM glue(glue(__st, SUFFIX), MMUSUFFIX)(target_ulong addr,
     // PANDA instrumentation: memory write
 
     // newer version
-    for(plist = panda_cbs[PANDA_CB_VIRT_MEM_AFTER_WRITE]; plist != NULL;
+    for(plist = panda_cb_list_first(PANDA_CB_VIRT_MEM_AFTER_WRITE); plist != NULL;
             plist = panda_cb_list_next(plist)) {
         plist->entry.virt_mem_after_write(env, env->panda_guest_pc, addr,
             DATA_SIZE, &val);
     }
-    for(plist = panda_cbs[PANDA_CB_PHYS_MEM_AFTER_WRITE]; plist != NULL;
+    for(plist = panda_cb_list_first(PANDA_CB_PHYS_MEM_AFTER_WRITE); plist != NULL;
             plist = panda_cb_list_next(plist)) {
         plist->entry.phys_mem_after_write(env, env->panda_guest_pc,
             cpu_get_phys_addr(env, addr), DATA_SIZE, &val);
@@ -469,7 +472,7 @@ static void glue(glue(slow_st, SUFFIX), MMUSUFFIX)(target_ulong addr,
     // PANDA instrumentation: memory write
     // rwhelan: redundant?
     /*panda_cb_list *plist;
-    for(plist = panda_cbs[PANDA_CB_VIRT_MEM_WRITE]; plist != NULL; plist = panda_cb_list_next(plist)) {
+    for(plist = panda_cb_list_first(PANDA_CB_VIRT_MEM_WRITE); plist != NULL; plist = panda_cb_list_next(plist)) {
         plist->entry.virt_mem_write(env, env->panda_guest_pc, addr, DATA_SIZE, &val);
     }*/
 #endif
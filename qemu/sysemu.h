@@ -63,6 +63,7 @@ void do_savevm(Monitor *mon, const QDict *qdict);
 int do_savevm_rr(Monitor *mon, const char *name);
 int load_vmstate(const char *name);
 int load_vmstate_rr(const char *name);
+int load_vmstate_rr_stream(FILE *fp, int ram_fd, uint64_t ram_offset);
 void do_delvm(Monitor *mon, const QDict *qdict);
 void do_info_snapshots(Monitor *mon);
 
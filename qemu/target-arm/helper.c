@@ -614,7 +614,7 @@ void HELPER(set_cp)(CPUState *env, uint32_t insn, uint32_t val)
     if (op1 == 7){
         // PANDA instrumentation: guest hypercall
         panda_cb_list *plist;
-        for (plist = panda_cbs[PANDA_CB_GUEST_HYPERCALL]; plist != NULL;
+        for (plist = panda_cb_list_first(PANDA_CB_GUEST_HYPERCALL); plist != NULL;
                 plist = panda_cb_list_next(plist)){
             plist->entry.guest_hypercall(env);
         }
@@ -1383,7 +1383,7 @@ void HELPER(set_cp)(CPUState *env, uint32_t insn, uint32_t val)
     if (cp_num == 7){
         // PANDA instrumentation: guest hypercall
         panda_cb_list *plist;
-        for (plist = panda_cbs[PANDA_CB_GUEST_HYPERCALL]; plist != NULL;
+        for (plist = panda_cb_list_first(PANDA_CB_GUEST_HYPERCALL); plist != NULL;
                 plist = panda_cb_list_next(plist)) {
             plist->entry.guest_hypercall(env);
         }
@@ -1506,17 +1506,19 @@ void HELPER(set_cp15)(CPUState *env, uint32_t insn, uint32_t val)
 	    switch (op2) {
 	    case 0:
                 oldval = env->cp15.c2_base0;
-		for(plist = panda_cbs[PANDA_CB_VMI_PGD_CHANGED]; plist != NULL; plist = panda_cb_list_next(plist)) {
+		for(plist = panda_cb_list_first(PANDA_CB_VMI_PGD_CHANGED); plist != NULL; plist = panda_cb_list_next(plist)) {
                     plist->entry.after_PGD_write(env, oldval, val);
 		}
 		env->cp15.c2_base0 = val;
+                panda_v2p_flush_asid(val);
 		break;
 	    case 1:
                 oldval = env->cp15.c2_base1;
-		for(plist = panda_cbs[PANDA_CB_VMI_PGD_CHANGED]; plist != NULL; plist = panda_cb_list_next(plist)) {
+		for(plist = panda_cb_list_first(PANDA_CB_VMI_PGD_CHANGED); plist != NULL; plist = panda_cb_list_next(plist)) {
                     plist->entry.after_PGD_write(env, oldval, val);
 		}
 		env->cp15.c2_base1 = val;
+                panda_v2p_flush_asid(val);
 		break;
 	    case 2:
                 val &= 7;
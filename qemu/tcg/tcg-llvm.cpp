@@ -147,11 +147,13 @@ static char *qemu_st_helper_names[5] = {
 
 #include <iostream>
 #include <sstream>
+#include <map>
 
 //#undef NDEBUG
 
 extern "C" {
     TCGLLVMContext* tcg_llvm_ctx = 0;
+    void (*tcg_llvm_tb_free_hook)(struct TranslationBlock *tb) = 0;
 
     /* These data is accessible from generated code */
     TCGLLVMRuntime tcg_llvm_runtime = {
@@ -166,6 +168,30 @@ using namespace llvm;
 
 class TJITMemoryManager;
 
+/* TBs with JITed code, by the start of that code, so tb_find_pc doesn't
+   have to scan every TB. Code ranges never overlap. */
+typedef std::map<uintptr_t, TranslationBlock*> TCIndex;
+static TCIndex llvm_tc_index;
+
+static void tcg_llvm_index_tb(TranslationBlock *tb)
+{
+    uintptr_t start = (uintptr_t) tb->llvm_tc_ptr;
+    TCIndex::iterator next = llvm_tc_index.lower_bound(start);
+
+    // Sanity check. We had a bug before where we were misrecording
+    // translated code sizes, and so TC blocks appeared to overlap.
+    assert((next == llvm_tc_index.end() ||
+            next->first >= (uintptr_t) tb->llvm_tc_end) &&
+            "Allocating apparently overlapping blocks!");
+    if(next != llvm_tc_index.begin()) {
+        TCIndex::iterator prev = next;
+        --prev;
+        assert((uintptr_t) prev->second->llvm_tc_end <= start &&
+                "Allocating apparently overlapping blocks!");
+    }
+    llvm_tc_index.insert(next, std::make_pair(start, tb));
+}
+
 struct TCGLLVMContextPrivate {
     LLVMContext& m_context;
     IRBuilder<> m_builder;
@@ -1417,6 +1443,7 @@ void TCGLLVMContextPrivate::generateCode(TCGContext *s, TranslationBlock *tb)
 
         assert(tb->llvm_tc_ptr);
         assert(tb->llvm_tc_end > tb->llvm_tc_ptr);
+        tcg_llvm_index_tb(tb);
     } else {
         tb->llvm_tc_ptr = 0;
         tb->llvm_tc_end = 0;
@@ -1527,6 +1554,12 @@ void tcg_llvm_tb_alloc(TranslationBlock *tb)
 void tcg_llvm_tb_free(TranslationBlock *tb)
 {
     if(tb->llvm_function) {
+        if(tcg_llvm_tb_free_hook) {
+            tcg_llvm_tb_free_hook(tb);
+        }
+        if(tb->llvm_tc_ptr) {
+            llvm_tc_index.erase((uintptr_t) tb->llvm_tc_ptr);
+        }
         tb->llvm_function->eraseFromParent();
         tb->llvm_function = NULL;
         tb->llvm_tc_ptr = NULL;
@@ -1534,6 +1567,17 @@ void tcg_llvm_tb_free(TranslationBlock *tb)
     }
 }
 
+TranslationBlock *tcg_llvm_find_tb(uintptr_t tc_ptr)
+{
+    TCIndex::iterator it = llvm_tc_index.upper_bound(tc_ptr);
+    if(it == llvm_tc_index.begin())
+        return NULL;
+    --it;
+    if(tc_ptr < (uintptr_t) it->second->llvm_tc_end)
+        return it->second;
+    return NULL;
+}
+
 int tcg_llvm_search_last_pc(TranslationBlock *tb, uintptr_t searched_pc)
 {
     assert(tb->llvm_function && tb == tcg_llvm_runtime.last_tb);
@@ -53,6 +53,10 @@ struct TCGLLVMContext;
 
 extern struct TCGLLVMContext* tcg_llvm_ctx;
 
+/* if set, called with each TB (flushed or freed) just before its LLVM
+   function is deleted */
+extern void (*tcg_llvm_tb_free_hook)(struct TranslationBlock *tb);
+
 struct TCGLLVMRuntime {
     // NOTE: The order of these are fixed !
     uint64_t helper_ret_addr;
@@ -73,6 +77,9 @@ void tcg_llvm_destroy(void);
 void tcg_llvm_tb_alloc(struct TranslationBlock *tb);
 void tcg_llvm_tb_free(struct TranslationBlock *tb);
 
+/* the TB whose JITed code contains tc_ptr, or NULL */
+struct TranslationBlock *tcg_llvm_find_tb(uintptr_t tc_ptr);
+
 void tcg_llvm_gen_code(struct TCGLLVMContext *l, struct TCGContext *s,
                        struct TranslationBlock *tb);
 const char* tcg_llvm_get_func_name(struct TranslationBlock *tb);
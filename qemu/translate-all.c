@@ -152,7 +152,7 @@ int cpu_restore_state(TranslationBlock *tb,
 {
     // PANDA instrumentation: CPU restore state
     panda_cb_list *plist;
-    for(plist = panda_cbs[PANDA_CB_CPU_RESTORE_STATE]; plist != NULL;
+    for(plist = panda_cb_list_first(PANDA_CB_CPU_RESTORE_STATE); plist != NULL;
             plist = panda_cb_list_next(plist)) {
         plist->entry.cb_cpu_restore_state(env, tb);
     }
@@ -179,7 +179,7 @@ int cpu_restore_state(TranslationBlock *tb,
     }
 
 #if defined(CONFIG_LLVM)
-    if(execute_llvm) {
+    if(execute_llvm && !tb->llvm_bypass) {
         assert(tb->llvm_function != NULL);
         j = tcg_llvm_search_last_pc(tb, searched_pc);
     } else {
@@ -205,6 +205,8 @@ void tcg_llvm_destroy(void);
 extern bool panda_add_arg(const char *, int);
 extern bool panda_load_plugin(const char *);
 extern void panda_unload_plugins(void);
+extern bool panda_profiling;
+extern void panda_profile_reset(void);
 extern char *panda_plugin_path(const char *name);
 void panda_set_os_name(char *os_name);
 
@@ -233,6 +235,7 @@ int display_remote = 0;
 const char* keyboard_layout = NULL;
 ram_addr_t ram_size;
 const char *mem_path = NULL;
+const char *mem_shared_path = NULL;
 #ifdef MAP_POPULATE
 int mem_prealloc = 0; /* force preallocation of physical target memory */
 #endif
@@ -2700,6 +2703,9 @@ int main(int argc, char **argv, char **envp)
             case QEMU_OPTION_mempath:
                 mem_path = optarg;
                 break;
+            case QEMU_OPTION_mem_shared:
+                mem_shared_path = optarg;
+                break;
 #ifdef MAP_POPULATE
             case QEMU_OPTION_mem_prealloc:
                 mem_prealloc = 1;
@@ -3235,6 +3241,10 @@ int main(int argc, char **argv, char **envp)
                 record_name = optarg;
 	            break;
 
+            case QEMU_OPTION_record_base:
+                rr_record_base_name = optarg;
+                break;
+
             case QEMU_OPTION_replay:
                 display_type = DT_NONE;
                 replay_name = optarg;
@@ -3298,6 +3308,11 @@ int main(int argc, char **argv, char **envp)
                     break;
                 }
 
+            case QEMU_OPTION_panda_profile:
+                panda_profile_reset();
+                panda_profiling = true;
+                break;
+
             case QEMU_OPTION_panda_os_name:
             {
                 char *os_name = strdup(optarg);
@@ -0,0 +1,80 @@
+#!/usr/bin/env python
+
+from __future__ import print_function
+import sys, os
+import shutil
+import struct
+
+# Rebuilds a full memory image from an incremental series written by the
+# memsavep or memsnap plugins (incremental=true). The index has one line per
+# snapshot, "<instruction count> <file>", in the order they were taken. The
+# first file is a raw image; the rest are deltas (see
+# panda_memsavep_dirty in qemu/panda_plugin.h):
+# 0x00: magic "PANDADLT"
+# 0x08: uint32_t version (1)
+# 0x0c: uint32_t page size
+# 0x10: records of uint64_t physical address followed by one page
+DELTA_MAGIC = b"PANDADLT"
+HEADER_FMT = "<8sII"
+
+def usage():
+    print("usage: %s <index> <snapshot> <output>" % sys.argv[0], file=sys.stderr)
+    print("  <snapshot> is a position in the index (0 is the first) or a file name", file=sys.stderr)
+    sys.exit(1)
+
+def read_index(index_name):
+    base = os.path.dirname(index_name)
+    entries = []
+    with open(index_name) as f:
+        for line in f:
+            if not line.strip():
+                continue
+            count, name = line.split(None, 1)
+            name = name.strip()
+            if not os.path.isabs(name) and not os.path.exists(name):
+                name = os.path.join(base, name)
+            entries.append((int(count), name))
+    return entries
+
+def apply_delta(delta_name, outf):
+    pages = 0
+    with open(delta_name, 'rb') as f:
+        magic, version, page_size = struct.unpack(HEADER_FMT, f.read(struct.calcsize(HEADER_FMT)))
+        if magic != DELTA_MAGIC or version != 1:
+            print("%s is not a memory delta. Aborting." % delta_name, file=sys.stderr)
+            sys.exit(1)
+        while True:
+            addr = f.read(8)
+            if len(addr) < 8:
+                break
+            page = f.read(page_size)
+            if len(page) < page_size:
+                print("%s is truncated. Aborting." % delta_name, file=sys.stderr)
+                sys.exit(1)
+            outf.seek(struct.unpack("<Q", addr)[0])
+            outf.write(page)
+            pages += 1
+    return pages
+
+if len(sys.argv) != 4:
+    usage()
+
+entries = read_index(sys.argv[1])
+target = sys.argv[2]
+names = [os.path.basename(name) for _, name in entries]
+if target.isdigit():
+    last = int(target)
+elif os.path.basename(target) in names:
+    last = names.index(os.path.basename(target))
+else:
+    last = -1
+if last < 0 or last >= len(entries):
+    print("No snapshot %s in %s." % (target, sys.argv[1]), file=sys.stderr)
+    sys.exit(1)
+
+shutil.copyfile(entries[0][1], sys.argv[3])
+with open(sys.argv[3], 'r+b') as outf:
+    for count, name in entries[1:last+1]:
+        pages = apply_delta(name, outf)
+        print("Applied %s (%d pages, instruction %d)" % (name, pages, count))
+print("Wrote snapshot %d (instruction %d) to %s" % (last, entries[last][0], sys.argv[3]))
@@ -1,27 +1,50 @@
 #!/usr/bin/env python
 
+from __future__ import print_function
 import sys, os
-import subprocess
 import struct
-import hashlib
+import time
+import zlib
 
-RRPACK_MAGIC = "PANDA_RR"
+RRPACK_MAGIC = b"PANDARR2"
+RRPACK_VERSION = 1
+CHUNK_SIZE = 1 << 20
+PAGE_SIZE = 4096
+COMPRESSED = 1
 
-# PANDA Packed RR file format (all integers are little-endian):
-# 0x00: magic "PANDA_RR"
-# 0x08: uint64_t num_instructions
-# 0x10: MD5 (16 bytes) of remaining data
-# 0x20: archive data in .tar.xz format
+# PANDA packed RR file format; see qemu/rr_pack.h. All integers are
+# little-endian.
+# 0x00: magic "PANDARR2"
+# 0x08: uint32_t version
+# 0x0c: uint32_t number of members
+# 0x10: uint64_t num_instructions
+# 0x18: uint64_t creation time
+# 0x20: uint32_t chunk size
+# 0x24: uint32_t CRC-32 of header + member table (this field zeroed)
+# 0x28: members: char name[16], uint32_t flags, uint32_t reserved,
+#       uint64_t size, uint64_t index_offset, uint64_t num_chunks
+# Each member's data is stored in chunk-size pieces (zlib-compressed unless
+# the member is mapped during replay), followed by an index of
+# (uint64_t offset, uint32_t stored_size, uint32_t crc32) per chunk.
+HEADER_FMT = "<8sIIQQII"
+MEMBER_FMT = "<16sIIQQQ"
+CHUNK_FMT = "<QII"
+ZERO_PAGE = b"\0" * PAGE_SIZE
 
 if len(sys.argv) != 2:
-    print >>sys.stderr, "usage: %s <rr_basename>" % sys.argv[0]
+    print("usage: %s <rr_basename>" % sys.argv[0], file=sys.stderr)
+    print("Packs the recording into <rr_basename>.rr, which can be replayed "
+          "directly. The snapshot's RAM image is stored uncompressed so "
+          "replay can map it; its all-zero pages are left as holes, so the "
+          "pack is a sparse file. Copy it with a sparse-aware tool (e.g. "
+          "cp --sparse=always, rsync -S) to keep it small.", file=sys.stderr)
     sys.exit(1)
 
 base = sys.argv[1]
 outfname = base + '.rr'
 
 if os.path.exists(outfname):
-    print >>sys.stderr, "%s already exists; will not overwrite. Aborting." % outfname
+    print("%s already exists; will not overwrite. Aborting." % outfname, file=sys.stderr)
     sys.exit(1)
 
 # Get number of instructions
@@ -31,28 +54,66 @@ try:
         f.seek(16)
         num_guest_insns = struct.unpack("<Q", f.read(8))[0]
 except EnvironmentError:
-    print >>sys.stderr, "Failed to open", base + '-rr-nondet.log. Aborting.'
+    print("Failed to open", base + '-rr-nondet.log. Aborting.', file=sys.stderr)
     sys.exit(1)
 
-print "Packing RR log %s with %d instructions..." % (base, num_guest_insns)
+# (member name, file, flags); the payload store and the snapshot's RAM image
+# are mapped by replay, so they stay uncompressed.
+members = [(b'nondet', base + '-rr-nondet.log', COMPRESSED),
+           (b'snp', base + '-rr-snp', COMPRESSED)]
+# Recording always creates the payload store, even if nothing goes in it.
+if os.path.exists(base + '-rr-payload') and os.path.getsize(base + '-rr-payload') > 0:
+    members.append((b'payload', base + '-rr-payload', 0))
+if os.path.exists(base + '-rr-snp.ram'):
+    members.append((b'ram', base + '-rr-snp.ram', 0))
+if os.path.exists(base + '-rr.cmd'):
+    members.append((b'cmd', base + '-rr.cmd', COMPRESSED))
+
+# Raw members are mapped at replay, where holes read back as zeros, so
+# all-zero pages are skipped rather than written. Offsets stay page-aligned.
+def write_sparse(outf, data):
+    for off in range(0, len(data), PAGE_SIZE):
+        page = data[off:off + PAGE_SIZE]
+        if page == ZERO_PAGE[:len(page)]:
+            outf.seek(len(page), os.SEEK_CUR)
+        else:
+            outf.write(page)
+
+print("Packing RR log %s with %d instructions..." % (base, num_guest_insns))
 outf = open(outfname, 'wb')
-outf.write(RRPACK_MAGIC)
-outf.write(struct.pack("<Q", num_guest_insns))
-outf.write("\0" * 16) # Placeholder for checksum
-outf.flush()
-subprocess.check_call(['tar', 'cJf', '-', base + '-rr-snp', base + '-rr-nondet.log'], stdout=outf)
-outf.close()
+table_size = struct.calcsize(HEADER_FMT) + len(members) * struct.calcsize(MEMBER_FMT)
+outf.write(b"\0" * table_size) # Placeholder for header and member table
+
+table = b""
+for name, fname, flags in members:
+    size = os.path.getsize(fname)
+    if not flags & COMPRESSED:
+        outf.seek(-outf.tell() % PAGE_SIZE, os.SEEK_CUR)
+    index = []
+    with open(fname, 'rb') as f:
+        while True:
+            data = f.read(CHUNK_SIZE)
+            if not data: break
+            crc = zlib.crc32(data) & 0xffffffff
+            if flags & COMPRESSED:
+                stored = zlib.compress(data, 6)
+                index.append((outf.tell(), len(stored), crc))
+                outf.write(stored)
+            else:
+                index.append((outf.tell(), len(data), crc))
+                write_sparse(outf, data)
+    index_offset = outf.tell()
+    for entry in index:
+        outf.write(struct.pack(CHUNK_FMT, *entry))
+    table += struct.pack(MEMBER_FMT, name, flags, 0, size, index_offset, len(index))
+    print("  %s: %d bytes -> %d bytes" % (name.decode(), size,
+            sum(e[1] for e in index)))
 
-print "Calculating checksum...",
-outf = open(outfname, 'r+b')
-outf.seek(0x20)
-m = hashlib.md5()
-while True:
-    data = outf.read(4096)
-    if not data: break
-    m.update(data)
-digest = m.digest()
-outf.seek(0x10)
-outf.write(digest)
+header = struct.pack(HEADER_FMT, RRPACK_MAGIC, RRPACK_VERSION, len(members),
+        num_guest_insns, int(time.time()), CHUNK_SIZE, 0)
+crc = zlib.crc32(header + table) & 0xffffffff
+header = header[:-4] + struct.pack("<I", crc)
+outf.seek(0)
+outf.write(header + table)
 outf.close()
-print "Done."
+print("Done.")
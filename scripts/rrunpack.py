@@ -1,32 +1,101 @@
 #!/usr/bin/env python
 
+from __future__ import print_function
 import sys, os
 import subprocess
 import struct
 import hashlib
+import zlib
 
-RRPACK_MAGIC = "PANDA_RR"
+RRPACK_MAGIC = b"PANDA_RR"
+RRPACK2_MAGIC = b"PANDARR2"
 
 # PANDA Packed RR file format (all integers are little-endian):
 # 0x00: magic "PANDA_RR"
 # 0x08: uint64_t num_instructions
 # 0x10: MD5 (16 bytes) of remaining data
 # 0x20: archive data in .tar.xz format
+#
+# Files with magic "PANDARR2" are in the native format written by
+# rrpack.py (see qemu/rr_pack.h). Those can be replayed directly; unpacking
+# them is only needed for tools that want the separate files.
+HEADER_FMT = "<8sIIQQII"
+MEMBER_FMT = "<16sIIQQQ"
+CHUNK_FMT = "<QII"
+COMPRESSED = 1
+SUFFIXES = {b'nondet': '-rr-nondet.log', b'snp': '-rr-snp',
+            b'payload': '-rr-payload', b'cmd': '-rr.cmd',
+            b'ram': '-rr-snp.ram'}
+
+ZERO_PAGE = b"\0" * 4096
 
 if len(sys.argv) != 2:
-    print >>sys.stderr, "usage: %s <filename.rr>" % sys.argv[0]
+    print("usage: %s <filename.rr>" % sys.argv[0], file=sys.stderr)
     sys.exit(1)
 
+# Raw members (the RAM image in particular) keep their zero pages as holes,
+# as they are in the pack.
+def write_sparse(outf, data):
+    for off in range(0, len(data), len(ZERO_PAGE)):
+        page = data[off:off + len(ZERO_PAGE)]
+        if page == ZERO_PAGE[:len(page)]:
+            outf.seek(len(page), os.SEEK_CUR)
+        else:
+            outf.write(page)
+
 infname = sys.argv[1]
 
+def unpack_v2(f):
+    header = f.read(struct.calcsize(HEADER_FMT))
+    magic, version, num_members, num_guest_insns, created, chunk_size, crc = \
+        struct.unpack(HEADER_FMT, header)
+    table = f.read(num_members * struct.calcsize(MEMBER_FMT))
+    print("Verifying checksums...", end=' ')
+    if zlib.crc32(header[:-4] + b"\0" * 4 + table) & 0xffffffff != crc:
+        print("FAILED (header). Aborting.")
+        sys.exit(1)
+    base = os.path.basename(infname)
+    if base.endswith('.rr'): base = base[:-3]
+    print("Unpacking RR log %s with %d instructions..." % (infname, num_guest_insns))
+    for i in range(num_members):
+        name, flags, _, size, index_offset, num_chunks = struct.unpack_from(
+            MEMBER_FMT, table, i * struct.calcsize(MEMBER_FMT))
+        name = name.rstrip(b"\0")
+        outfname = base + SUFFIXES.get(name, '-' + name.decode())
+        f.seek(index_offset)
+        index = [struct.unpack(CHUNK_FMT, f.read(struct.calcsize(CHUNK_FMT)))
+                 for _ in range(num_chunks)]
+        with open(outfname, 'wb') as outf:
+            for offset, stored_size, chunk_crc in index:
+                f.seek(offset)
+                data = f.read(stored_size)
+                if flags & COMPRESSED:
+                    data = zlib.decompress(data)
+                if zlib.crc32(data) & 0xffffffff != chunk_crc:
+                    print("FAILED (%s). Aborting." % outfname)
+                    sys.exit(1)
+                if flags & COMPRESSED:
+                    outf.write(data)
+                else:
+                    write_sparse(outf, data)
+            # a trailing hole still has to count towards the size
+            outf.truncate(size)
+        print(outfname)
+    print("Done.")
+
 # Get file info
 try:
     with open(infname, 'rb') as f:
+        if f.read(8) == RRPACK2_MAGIC:
+            f.seek(0)
+            unpack_v2(f)
+            sys.exit(0)
+        f.seek(0)
         magic, num_guest_insns, file_digest = struct.unpack("<8sQ16s", f.read(0x20))
         if magic != RRPACK_MAGIC:
-            print >>sys.stderr, infname, "is not in PANDA Record/Replay format"
+            print(infname, "is not in PANDA Record/Replay format", file=sys.stderr)
             sys.exit(1)
-        print "Verifying checksum...",
+        print("Verifying checksum...", end=' ')
         m = hashlib.md5()
         while True:
             data = f.read(4096)
@@ -34,14 +103,15 @@ try:
             m.update(data)
         digest = m.digest()
         if digest != file_digest:
-            print "FAILED. Aborting."
+            print("FAILED. Aborting.")
             sys.exit(1)
         else:
-            print "Success."
+            print("Success.")
         f.seek(0x20)
-        print "Unacking RR log %s with %d instructions..." % (infname, num_guest_insns),
+        print("Unacking RR log %s with %d instructions..." % (infname, num_guest_insns), end=' ')
+        sys.stdout.flush()
         subprocess.check_call(['tar', 'xJvf', '-'], stdin=f)
-        print "Done."
+        print("Done.")
 except EnvironmentError:
-    print >>sys.stderr, "Failed to open", infname
+    print("Failed to open", infname, file=sys.stderr)
     sys.exit(1)
@@ -0,0 +1,158 @@
+#!/bin/bash
+#
+# bench.bash mode regressiondir
+#
+# Replays each reference recording in bench_recordings.txt under each
+# standard plugin configuration (see bench.defs) and records, per run,
+# guest instructions per second, peak RSS, TB translations and pandalog
+# size in $outdir/bench.tsv.
+#
+# arg 1, mode, must be present.
+# allowable values are 'ref', 'test' and 'compare'
+# if 'ref' then we run the benchmarks and install the results as the
+# baseline
+# if 'test' then we run the benchmarks and compare the results with the
+# baseline
+# if 'compare' then we just compare the last results with the baseline
+#
+# arg 2, regressiondir, also must be present
+#
+usage="try again with bench.bash mode regressiondir"
+
+if [ $# != 2 ]
+then
+    echo $usage
+    exit 1
+fi
+
+mode=$1
+regressiondir=$2
+
+if [[ $mode != "ref" ]] && [[ $mode != "test" ]] && [[ $mode != "compare" ]]
+then
+    echo $usage
+    exit 1
+fi
+
+source testing.defs
+source bench.defs
+
+echo "mode=[$mode]"
+echo "regressiondir=[$regressiondir]"
+
+# compare $benchout with $benchref.  A run regresses if it is more than
+# $benchtolerance percent slower, or uses that much more memory,
+# translates that many more blocks or writes that much more pandalog.
+function compare_bench {
+    if [ ! -f $benchref ]
+    then
+        echo "no baseline [$benchref]; create one with bench.bash ref"
+        exit 1
+    fi
+    echo "comparing [$benchout] with baseline [$benchref], tolerance $benchtolerance%"
+    awk -v tol=$benchtolerance '
+        function pct(new, old) { return old > 0 ? 100.0 * (new - old) / old : 0 }
+        FNR == 1 { next }
+        NR == FNR { base[$1 " " $2] = $0; next }
+        {
+            key = $1 " " $2
+            if ($3 != "ok") { printf "%-40s %s\n", key, $3; bad++; next }
+            if (!(key in base)) { printf "%-40s new, no baseline\n", key; next }
+            split(base[key], b, "\t")
+            if (b[3] != "ok") { printf "%-40s baseline run %s\n", key, b[3]; next }
+            speed = pct($6, b[6]); rss = pct($7, b[7]); tbs = pct($8, b[8]); plog = pct($9, b[9])
+            verdict = "ok"
+            if (-speed > tol || rss > tol || tbs > tol || plog > tol) { verdict = "REGRESSION"; bad++ }
+            printf "%-40s instr/s %+6.1f%%  rss %+6.1f%%  tbs %+6.1f%%  pandalog %+6.1f%%  %s\n",
+                key, speed, rss, tbs, plog, verdict
+        }
+        END { exit bad > 0 }' $benchref $benchout
+}
+
+if [[ $mode == "compare" ]]
+then
+    compare_bench
+    exit $?
+fi
+
+allstarttime=$(date +%s%N)
+
+/bin/rm -f $benchout
+printf "recording\tconfig\tstatus\tinstr\tseconds\tinstr_per_sec\tpeak_rss_kb\ttbs\tpandalog_bytes\n" > $benchout
+
+grep -v '^#' $benchrecordings | while read name arch replay os osi kconf profile taintfile searchstr
+do
+    if [ -z "$name" ]
+    then
+        continue
+    fi
+    for config in $benchconfigs
+    do
+        set_bench_args $config $os $osi $kconf $profile $taintfile $searchstr
+        if [[ $bench_args == "skip" ]]
+        then
+            echo "bench [${name} ${config}] skipped"
+            continue
+        fi
+        log=${outdir}/bench-${name}-${config}.log
+        pandalog=${outdir}/bench-${name}-${config}.pandalog
+        /bin/rm -f $log $pandalog
+        cmdline="${pandadir}/qemu/${arch}-softmmu/qemu-system-${arch} -replay ${replaydir}/${replay} -pandalog $pandalog $bench_args"
+        echo "=============="
+        echo "bench [${name} ${config}] BEGIN"
+        echo "running [$cmdline]"
+        starttime=$(date +%s%N)
+        $cmdline > $log 2>&1 < /dev/null
+        endtime=$(date +%s%N)
+        seconds=$(awk -v ns=$(( $endtime - $starttime )) 'BEGIN { printf "%.2f", ns / 1e9 }')
+
+        instr=$(awk '/^total_instr in replay:/ { print $4 }' $log | tail -1)
+        tbs=$(awk '/^TBs translated:/ { print $3 }' $log | tail -1)
+        peak_rss=$(awk '/^Peak RSS:/ { print $3 }' $log | tail -1)
+        plog_bytes=$(stat -c %s $pandalog 2>/dev/null || echo 0)
+        if grep -q "^Replay completed successfully" $log && [ -n "$instr" ]
+        then
+            status=ok
+            ips=$(awk -v i=$instr -v s=$seconds 'BEGIN { printf "%d", (s > 0 ? i / s : 0) }')
+        else
+            status=failed
+            ips=0
+        fi
+        printf "%s\t%s\t%s\t%s\t%s\t%s\t%s\t%s\t%s\n" $name $config $status \
+            ${instr:-0} $seconds $ips ${peak_rss:-0} ${tbs:-0} $plog_bytes >> $benchout
+        echo "bench [${name} ${config}] END.  $status, $seconds seconds, $ips instr/sec"
+    done
+done
+
+allendtime=$(date +%s%N)
+elapsed=$(( $allendtime - $allstarttime ))
+elapsed=$(awk -v ns=$elapsed 'BEGIN { printf "%.2f", ns / 1e9 }')
+
+echo " "
+echo "//////////////////"
+echo " "
+echo "SUMMARY"
+awk -F '\t' '{ printf "%-20s %-14s %-7s %14s %9s %13s %12s %10s %15s\n", $1, $2, $3, $4, $5, $6, $7, $8, $9 }' $benchout
+echo " "
+echo "total time required: $elapsed seconds"
+echo "results in [$benchout]"
+
+if [[ $mode == "ref" ]]
+then
+    mkdir -p $(dirname $benchref)
+    echo "installing results [$benchout] as baseline [$benchref]"
+    cp $benchout $benchref
+    echo "** baseline created"
+fi
+if [[ $mode == "test" ]]
+then
+    compare_bench
+    if [ $? -eq 0 ]
+    then
+        echo "** no regressions"
+        exit 0
+    else
+        echo "** regressions found"
+        exit 1
+    fi
+fi